@@ -61,10 +61,14 @@ enum class CallbackType : uint32
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 471
     BindPipeline,           ///< This callback is to inform that a pipeline (client or internal) has been bound.
 #endif
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 573
+    PipelineCodeReuse,      ///< This callback is to inform that a pipeline reused another pipeline's uploaded code.
+#endif
 #if PAL_BUILD_PM4_INSTRUMENTOR
     DrawDispatchValidation, ///< This callback is to describe the state validation needed by a draw or dispatch.
     OptimizedRegisters,     ///< This callback is to describe the PM4 optimizer's removal of redundant register
                             ///  sets.
+    NestedCmdBufferReuse,   ///< This callback is to describe how nested command buffers were launched by a caller.
 #endif
     Count,                  ///< The number of info types.
 };
@@ -194,6 +198,17 @@ struct BarrierOperations
         uint16 u16All; ///< Unsigned integer containing all the values.
 
     } caches; ///< Information about cache operations performed for the barrier.
+
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 573
+    struct
+    {
+        uint32 barriersMerged; ///< Number of deferred barriers whose syncs were merged into this barrier.
+        uint32 pm4BytesSaved;  ///< Number of PM4 bytes saved by merging the deferred barriers' syncs: the size of
+                               ///  the syncs each of them would have issued on its own, minus the merged syncs.
+    } coalescing; ///< Information about barrier coalescing.  Only valid if barriersMerged is non-zero, in which case
+                  ///  the barrier's reason is that of the first merged barrier, or BarrierReasonDeferredSyncs if it
+                  ///  had none.
+#endif
 };
 
 /// Enumeration for PAL barrier reasons
@@ -229,6 +244,10 @@ enum BarrierReason : uint32
     BarrierReasonPrePerfDataCopy,                           ///< Barrier issued to wait for perf data to become
                                                             ///  available for copy
     BarrierReasonFlushL2CachedData,                         ///< Barrier issued to flush L2 cached data to main memory
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 573
+    BarrierReasonDeferredSyncs,                             ///< Barrier issued to perform the merged syncs of
+                                                            ///  deferred barriers, the first of which had no reason
+#endif
     BarrierReasonInternalLastDefined,                       ///< Only used for asserts.
     BarrierReasonUnknown = 0xFFFFFFFF,                      ///< Unknown barrier reason
 
@@ -413,6 +432,18 @@ struct BindPipelineData
     PipelineBindPoint bindPoint;  ///< The bind point of the pipeline within a queue.
 };
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 573
+/// Information for PipelineCodeReuse callbacks
+struct PipelineCodeReuseData
+{
+    uint64  codeHash;        ///< Lower 64 bits of the content hash of the shared code and data image.
+    GpuHeap heap;            ///< GPU heap the shared image resides in.
+    gpusize bytesSaved;      ///< Size of the upload which was avoided by reusing the existing image.
+    gpusize totalBytesSaved; ///< Running total of upload bytes saved by code reuse on this device.
+    uint32  refCount;        ///< Number of pipelines referencing the shared image, including this one.
+};
+#endif
+
 #if PAL_BUILD_PM4_INSTRUMENTOR
 /// Information for DrawDispatchValidation callbacks
 struct DrawDispatchValidationData
@@ -440,6 +471,18 @@ struct OptimizedRegistersData
     uint32        ctxRegCount;      ///< Number of context registers
     uint16        ctxRegBase;       ///< Base address of context registers
 };
+
+/// Information for NestedCmdBufferReuse callbacks. PAL launches a nested command buffer in place whenever its build
+/// flags and the hardware allow it, so copiedCount only counts calls where that wasn't possible.
+struct NestedCmdBufferReuseData
+{
+    ICmdBuffer* pCmdBuffer;            ///< The command buffer which executed the nested command buffers.
+    uint32      reusedCount;           ///< Number of nested command buffers launched in-place (IB2 or chained)
+                                       ///  instead of being copied into the caller.
+    uint32      reusedCmdSize;         ///< Size of nested PM4 commands which did not need to be copied (bytes).
+    uint32      copiedCount;           ///< Number of nested command buffers copied into the caller.
+    uint32      copiedCmdSize;         ///< Size of nested PM4 commands which were copied into the caller (bytes).
+};
 #endif
 
 } // Developer
@@ -40,6 +40,12 @@
 #include "palFence.h"
 #include "palCmdAllocator.h"
 
+namespace Util
+{
+class ICacheLayer;
+class IPlatformKey;
+}
+
 namespace Pal
 {
 
@@ -1515,6 +1521,22 @@ struct DeviceFinalizeInfo
     /// Specify the texture optimization level which only applies to internally-created views by PAL (e.g., for BLTs),
     /// client-created views must use the texOptLevel parameter in ImageViewInfo.
     ImageTexOptLevel internalTexOptLevel;
+
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 573
+    /// Optional cache layer, typically backed by the client's pipeline cache, which PAL uses to store the
+    /// device-specific hardware register state it derives from each pipeline ELF.  When a pipeline is created from an
+    /// ELF whose derived state is already present, PAL skips interpreting the ELF's register metadata and rebuilding
+    /// the register state.  Entries are keyed by a hash of the ELF, pPlatformKey and any PAL settings which affect the
+    /// derived state.  Ignored unless pPlatformKey is also provided.  The cache layer must be safe to call from
+    /// multiple threads at once and must remain valid for the lifetime of the device.  Currently only compute
+    /// pipelines on GFX9+ hardware use this cache; graphics pipelines and shader libraries always rebuild their
+    /// register state from the ELF.
+    Util::ICacheLayer*        pPipelineRegisterCache;
+
+    /// Identifies the hardware and driver which produced the entries in pPipelineRegisterCache, so that entries
+    /// written by a different GPU or driver build are never used.  Only consulted during Finalize().
+    const Util::IPlatformKey* pPlatformKey;
+#endif
 };
 
 /// Reports the compatibility and available features when using two particular devices in a multi-GPU system.  Output
@@ -3972,6 +3994,35 @@ public:
         void*                             pPlacementAddr,
         IPipeline**                       ppPipeline) = 0;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 573
+    /// Opens a pipeline upload batch on this device.
+    ///
+    /// While a batch is open, pipelines whose code and data are placed in the local invisible heap are not uploaded
+    /// with one DMA submission each.  Instead, their copies are recorded into a single internal DMA command buffer
+    /// which is submitted (and waited on) once when the batch is closed by EndPipelineUploadBatch().  This is intended
+    /// for loading large numbers of pipelines at once, such as when warming up from a pipeline cache.
+    ///
+    /// Batches may be nested; the upload is only flushed when the outermost batch is closed.  A batch is device-wide,
+    /// so pipelines created on other threads while it is open are also batched.
+    ///
+    /// @warning The GPU copy of any pipeline created while a batch is open is not valid until the outermost
+    ///          EndPipelineUploadBatch() call returns.  The client must not submit work referencing such pipelines
+    ///          before then.
+    ///
+    /// @returns Success if the batch was opened.
+    virtual Result BeginPipelineUploadBatch() = 0;
+
+    /// Closes a pipeline upload batch previously opened with BeginPipelineUploadBatch().  If this closes the outermost
+    /// batch, all pending pipeline uploads are submitted to the GPU with a single DMA submission and this call waits
+    /// for that submission to complete.
+    ///
+    /// @returns Success if the batch was closed and any pending uploads completed.  Otherwise, one of the following
+    ///          errors may be returned:
+    ///          + ErrorUnavailable if no batch is currently open.
+    ///          + Any error returned by the internal DMA submission.
+    virtual Result EndPipelineUploadBatch() = 0;
+#endif
+
     /// Determines the amount of system memory required for a MSAA state object.  An allocation of this amount of memory
     /// must be provided in the pPlacementAddr parameter of CreateMsaaState().
     ///
@@ -43,7 +43,7 @@
 ///            compatible, it is not assumed that the client will initialize all input structs to 0.
 ///
 /// @ingroup LibInit
-#define PAL_INTERFACE_MAJOR_VERSION 572
+#define PAL_INTERFACE_MAJOR_VERSION 573
 
 /// Minor interface version.  Note that the interface version is distinct from the PAL version itself, which is returned
 /// in @ref Pal::PlatformProperties.
@@ -81,6 +81,11 @@
  */
 #define PAL_INTERFACE_VERSION ((PAL_INTERFACE_MAJOR_VERSION << 16) | PAL_INTERFACE_MINOR_VERSION)
 
+namespace Util
+{
+class IPlatformKey;
+}
+
 namespace Pal
 {
 
@@ -190,6 +195,23 @@ struct PlatformCreateInfo
                                                         ///  set by client based on their contract with RGP.
     gpusize                      maxSvmSize;            ///  Maximum amount of virtual address space that will be
                                                         ///  reserved for SVM
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 573
+    const Util::IPlatformKey*    pDeviceSnapshotKey;    ///< Optional.  If non-null, PAL saves the properties it derives
+                                                        ///  for each device to a snapshot file in the device's cache
+                                                        ///  directory and later platforms reuse them instead of
+                                                        ///  deriving them again.  Snapshots are only reused when this
+                                                        ///  key and the kernel driver version both match.  Null devices
+                                                        ///  load a matching snapshot to emulate the real GPU but never
+                                                        ///  save one.  Only consulted during platform creation.
+#endif
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 573
+    uint32                       jobSystemWorkerCount;  ///< Number of worker threads PAL may start for its internal
+                                                        ///  job system.  If zero, no threads are started and internal
+                                                        ///  jobs run on the thread that issues them.
+    uint64                       jobSystemAffinityMask; ///< Optional.  If non-zero, each job system worker is pinned to
+                                                        ///  one logical processor from this mask (bit N selects
+                                                        ///  processor N), assigned in order and wrapping around.
+#endif
 };
 
 /**
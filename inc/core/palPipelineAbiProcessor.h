@@ -33,6 +33,7 @@
 #pragma once
 
 #include "palElfProcessorImpl.h"
+#include "palJobSystem.h"
 #include "palPipelineAbi.h"
 #include "g_palPipelineAbiMetadata.h"
 
@@ -387,7 +388,17 @@ public:
     /// @param [in] bufferSize Size of the buffer in bytes to load from.
     Result LoadFromBuffer(const void* pBuffer, size_t bufferSize);
 
+    /// Load the ELF from a buffer without copying its sections.  Section data, names, symbols and metadata all
+    /// reference the caller's buffer directly, so it must remain valid and unchanged for the lifetime of this
+    /// processor.  Prefer this over LoadFromBuffer when the ELF is only being inspected.
+    ///
+    /// @param [in] pBuffer    Pointer to the buffer to load from.
+    /// @param [in] bufferSize Size of the buffer in bytes to load from.
+    Result LoadFromBufferView(const void* pBuffer, size_t bufferSize);
+
 private:
+    Result FinishLoad();
+
     void RelocationHelper(
         void*                    pBuffer,
         uint64                   baseAddress,
@@ -440,5 +451,34 @@ private:
     PAL_DISALLOW_COPY_AND_ASSIGN(PipelineAbiProcessor<Allocator>);
 };
 
+/// Describes one pipeline ELF in a batch passed to @ref ResolvePipelineSymbols.
+struct PipelineSymbolQuery
+{
+    const void*               pBinary;      ///< [in] Pipeline ELF.  It is loaded in view mode, so it must remain valid
+                                            ///  and unchanged until ResolvePipelineSymbols returns.
+    size_t                    binarySize;   ///< [in] Size of pBinary in bytes.
+    const PipelineSymbolType* pSymbolTypes; ///< [in] Array of symbolCount pipeline symbols to look up.
+    uint32                    symbolCount;  ///< [in] Number of entries in pSymbolTypes and pSymbols.
+    PipelineSymbolEntry*      pSymbols;     ///< [out] Array of symbolCount entries.  Symbols which the ELF doesn't
+                                            ///  define have their type set to PipelineSymbolType::Unknown.
+    Result                    result;       ///< [out] Result of loading the ELF.  pSymbols is only written on success.
+};
+
+/// Loads a batch of pipeline ELFs and looks up their pipeline symbols, spreading the ELFs over the workers of a job
+/// system.  Each ELF is loaded into its own processor in view mode, so the only state which the jobs share is the
+/// allocator; it must be safe to call from multiple threads.  The calling thread helps with the batch and returns once
+/// every query has been resolved.
+///
+/// @param [in]     pJobSystem Job system to run on.  If it has no workers, the queries are resolved on this thread.
+/// @param [in]     pAllocator Allocator used by each query's processor.
+/// @param [in,out] pQueries   Array of queryCount queries.
+/// @param [in]     queryCount Number of queries in pQueries.
+template <typename Allocator>
+void ResolvePipelineSymbols(
+    JobSystem<Allocator>* pJobSystem,
+    Allocator*            pAllocator,
+    PipelineSymbolQuery*  pQueries,
+    uint32                queryCount);
+
 } // Abi
 } // Pal
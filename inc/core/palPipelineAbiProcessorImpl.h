@@ -38,6 +38,7 @@
 #include "palMsgPackImpl.h"
 #include "palInlineFuncs.h"
 #include "palHashLiteralString.h"
+#include "palJobSystemImpl.h"
 #include "g_palPipelineAbiMetadataImpl.h"
 
 namespace Util
@@ -1018,9 +1019,35 @@ Result PipelineAbiProcessor<Allocator>::LoadFromBuffer(
 
     if (result == Result::Success)
     {
-         result = m_genericSymbolsMap.Init();
+        result = FinishLoad();
     }
 
+    return result;
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+Result PipelineAbiProcessor<Allocator>::LoadFromBufferView(
+    const void* pBuffer,
+    size_t      bufferSize)
+{
+    Result result = m_elfProcessor.LoadFromBufferView(pBuffer, bufferSize);
+
+    if (result == Result::Success)
+    {
+        result = FinishLoad();
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Validates the freshly loaded ELF and extracts the ABI sections, notes and symbols from it.
+template <typename Allocator>
+Result PipelineAbiProcessor<Allocator>::FinishLoad()
+{
+    Result result = m_genericSymbolsMap.Init();
+
     if (result == Result::Success)
     {
         if ((m_elfProcessor.GetFileHeader()->ei_osabi != ElfOsAbiVersion) ||
@@ -1646,5 +1673,70 @@ Result PipelineAbiProcessor<Allocator>::TranslateLegacyMetadata(
     return result;
 }
 
+// State shared by the jobs which ResolvePipelineSymbols() launches for one batch.
+template <typename Allocator>
+struct PipelineSymbolBatch
+{
+    Allocator*           pAllocator;
+    PipelineSymbolQuery* pQueries;
+    uint32               queryCount;
+    std::atomic<uint32>  nextQuery;   // Index of the next query to be claimed by a job.
+};
+
+// =====================================================================================================================
+// Job which claims and resolves queries from a PipelineSymbolBatch until every query has been claimed.
+template <typename Allocator>
+void ResolvePipelineSymbolsJob(
+    void* pData)
+{
+    PipelineSymbolBatch<Allocator>*const pBatch = static_cast<PipelineSymbolBatch<Allocator>*>(pData);
+
+    uint32 idx = pBatch->nextQuery.fetch_add(1, std::memory_order_relaxed);
+
+    while (idx < pBatch->queryCount)
+    {
+        PipelineSymbolQuery*const       pQuery = &pBatch->pQueries[idx];
+        PipelineAbiProcessor<Allocator> abiProcessor(pBatch->pAllocator);
+
+        pQuery->result = abiProcessor.LoadFromBufferView(pQuery->pBinary, pQuery->binarySize);
+
+        for (uint32 symbol = 0; (pQuery->result == Result::Success) && (symbol < pQuery->symbolCount); ++symbol)
+        {
+            if (abiProcessor.HasPipelineSymbolEntry(pQuery->pSymbolTypes[symbol], &pQuery->pSymbols[symbol]) == false)
+            {
+                pQuery->pSymbols[symbol]      = { };
+                pQuery->pSymbols[symbol].type = PipelineSymbolType::Unknown;
+            }
+        }
+
+        idx = pBatch->nextQuery.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+void ResolvePipelineSymbols(
+    JobSystem<Allocator>* pJobSystem,
+    Allocator*            pAllocator,
+    PipelineSymbolQuery*  pQueries,
+    uint32                queryCount)
+{
+    PAL_ASSERT((pJobSystem != nullptr) && ((pQueries != nullptr) || (queryCount == 0)));
+
+    PipelineSymbolBatch<Allocator> batch = { pAllocator, pQueries, queryCount, { 0 } };
+    JobGroup                       group;
+
+    // Queries are claimed from a shared counter rather than submitted one job each, so a batch needs no allocations
+    // and a worker which finds a cheap ELF simply moves on to the next one.  The waiting thread runs one of the jobs.
+    const uint32 numJobs = Min(queryCount, pJobSystem->NumWorkers() + 1);
+
+    for (uint32 job = 0; job < numJobs; ++job)
+    {
+        pJobSystem->Submit(&ResolvePipelineSymbolsJob<Allocator>, &batch, &group);
+    }
+
+    pJobSystem->Wait(&group);
+}
+
 } // Abi
 } // Util
@@ -37,6 +37,9 @@
 namespace Pal
 {
 
+// Forward declarations.
+class IFence;
+
 /// Specifies a category of GPU query pool.
 enum class QueryPoolType : uint32
 {
@@ -93,8 +96,12 @@ struct QueryPoolCreateInfo
             /// and can be reset using the CPU (using @ref IQueryPool::Reset).  Otherwise, the client must use command
             /// buffers to perform these operations (using @ref ICmdBuffer::CmdResetQueryPool and
             /// @ref ICmdBuffer::CmdResolveQuery).
-            uint32  enableCpuAccess :  1;
-            uint32  reserved        : 31;   ///< Reserved for future use.
+            uint32  enableCpuAccess    :  1;
+            /// If true, PAL keeps the bound GPU memory mapped for the lifetime of the binding so that
+            /// @ref IQueryPool::GetResults and @ref IQueryPool::Reset don't need to map and unmap it on every call.
+            /// Only valid if enableCpuAccess is also set.  The bound memory must outlive the pool or its binding.
+            uint32  persistentlyMapped :  1;
+            uint32  reserved           : 30;   ///< Reserved for future use.
         };
         uint32  u32All; ///< Flags packed together as a uint32.
     } flags;            ///< Flags controlling QueryPool behavior.
@@ -168,6 +175,37 @@ public:
         void*            pData,
         size_t           stride) = 0;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 573
+    /// Retrieves query results from a query pool once the given fence has been signaled.
+    ///
+    /// The client must have submitted the fence after all command buffers which end the requested queries.  Rather than
+    /// spinning on the query memory as @ref GetResults does when QueryResultWait is set, this blocks the calling thread
+    /// on the fence and then computes all results in one pass.  The QueryResultWait flag is ignored.
+    ///
+    /// @param [in]     fence      Fence which signals once all of the requested queries have ended.
+    /// @param [in]     timeoutNs  Maximum number of nanoseconds to wait on the fence.
+    /// @param [in]     flags      Flags that control the result data layout.
+    /// @param [in]     queryType  Specifies what data the query slots must produce.
+    /// @param [in]     startQuery First query pool slot to retrieve data for.
+    /// @param [in]     queryCount Number of query pool slots to retrieve data for.
+    /// @param [in,out] pDataSize  Same as for @ref GetResults.
+    /// @param [out]    pData      Same as for @ref GetResults.
+    /// @param [in]     stride     Same as for @ref GetResults.
+    ///
+    /// @returns Timeout if the fence was not signaled within timeoutNs, otherwise any of the values returned by
+    ///          @ref IDevice::WaitForFences or @ref GetResults.
+    virtual Result GetResultsAfterFence(
+        const IFence&    fence,
+        uint64           timeoutNs,
+        QueryResultFlags flags,
+        QueryType        queryType,
+        uint32           startQuery,
+        uint32           queryCount,
+        size_t*          pDataSize,
+        void*            pData,
+        size_t           stride) = 0;
+#endif
+
     /// Use CPU to reset the query pool slots.
     ///
     /// Supported for occlusion and video decode statistics query pools.
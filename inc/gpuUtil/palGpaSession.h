@@ -61,6 +61,10 @@ namespace Pal
     struct ThreadTraceLayout;
     enum   HwPipePoint : uint32;
 }
+namespace Util
+{
+    class File;
+}
 struct SqttFileChunkCpuInfo;
 struct SqttFileChunkAsicInfo;
 struct SqttCodeObjectDatabaseRecord;
@@ -332,6 +336,15 @@ struct SampleTraceApiInfo
     InstructionTraceModeData instructionTraceModeData;  ///< Instruction trace mode data.
 };
 
+/// Callback used by GpaSession::StreamResults() to hand the contents of an RGP file to the client in order.
+///
+/// @param [in] pUserData   Client data provided to StreamResults().
+/// @param [in] pData       Next bytes of the file.  Only valid for the duration of the call.
+/// @param [in] sizeInBytes Number of bytes at pData.
+///
+/// @returns Success if the data was consumed.  Any other value aborts the dump and is returned by StreamResults().
+typedef Pal::Result (PAL_STDCALL *RgpWriteCallback)(void* pUserData, const void* pData, size_t sizeInBytes);
+
 /**
 ***********************************************************************************************************************
 * @class GpaSession
@@ -600,6 +613,43 @@ public:
         size_t*     pSizeInBytes,
         void*       pData) const;
 
+    /// Streams the RGP file of a thread trace and/or SPM trace sample to the client in a single pass.  Only valid for
+    /// sessions in the _ready_ state.
+    ///
+    /// Unlike GetResults(), no size query or contiguous destination allocation is needed: the file is handed to
+    /// pfnWrite chunk by chunk and the trace data is passed through directly from the mapped sample memory.
+    ///
+    /// @param [in]  sampleId     Trace sample to be reported.  Corresponds to value returned by BeginSample().
+    /// @param [in]  pfnWrite     Callback which receives the file contents in order.
+    /// @param [in]  pUserData    Client data passed back to pfnWrite.
+    /// @param [out] pSizeInBytes Optional; set to the total size of the file that was written.
+    ///
+    /// @returns Success if the whole file was written.  Otherwise, possible errors include:
+    ///          + Unsupported if the sample is not a trace sample.
+    ///          + ErrorInvalidPointer if pfnWrite is null.
+    ///          + ErrorOutOfMemory if a temporary allocation fails.
+    ///          + Any error returned by pfnWrite, which aborts the dump.
+    Pal::Result StreamResults(
+        Pal::uint32      sampleId,
+        RgpWriteCallback pfnWrite,
+        void*            pUserData,
+        size_t*          pSizeInBytes) const;
+
+    /// Streams the RGP file of a thread trace and/or SPM trace sample into a file.  See the callback version of
+    /// StreamResults() for details.
+    ///
+    /// @param [in]  sampleId     Trace sample to be reported.  Corresponds to value returned by BeginSample().
+    /// @param [in]  pFile        File opened for binary write access.  The RGP data is appended at its current
+    ///                           position.
+    /// @param [out] pSizeInBytes Optional; set to the total size of the file that was written.
+    ///
+    /// @returns Success if the whole file was written, ErrorInvalidPointer if pFile is null or not open, or any error
+    ///          described for the callback version of StreamResults().
+    Pal::Result StreamResults(
+        Pal::uint32 sampleId,
+        Util::File* pFile,
+        size_t*     pSizeInBytes) const;
+
     /// Moves the session to the _reset_ state, marking all sessions resources as unused and available for reuse when
     /// the session is re-built.
     ///
@@ -720,6 +770,7 @@ private:
     class CounterSample;
     class TraceSample;
     class TimingSample;
+    class RgpWriter;
     class QuerySample;
 
     Util::Vector<SampleItem*, 16, GpaAllocator> m_sampleItemArray;
@@ -894,14 +945,14 @@ private:
         Pal::gpusize*           pHeapSize,
         Pal::IQueryPool**       ppQuery);
 
-    // Dump SQ thread trace data in rgp format
+    // Dump SQ thread trace data in rgp format into a caller-provided buffer
     Pal::Result DumpRgpData(TraceSample* pTraceSample, void* pRgpOutput, size_t* pTraceSize) const;
 
-    // Dumps the spm trace data in the buffer provided.
-    Pal::Result AppendSpmTraceData(TraceSample*  pTraceSample,
-                                   size_t        bufferSize,
-                                   void*         pData,
-                                   Pal::gpusize* pSizeInBytes) const;
+    // Dump SQ thread trace data in rgp format through an RGP file writer
+    Pal::Result DumpRgpData(TraceSample* pTraceSample, RgpWriter* pWriter) const;
+
+    // Appends the spm trace data chunk to the RGP file being written.
+    void AppendSpmTraceData(TraceSample* pTraceSample, RgpWriter* pWriter) const;
 
     Pal::Result AddCodeObjectLoadEvent(const Pal::IPipeline* pPipeline, CodeObjectLoadEventType eventType);
 
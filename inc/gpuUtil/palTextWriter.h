@@ -49,6 +49,14 @@ struct TextDrawShaderInfo
     Pal::uint32 backgroundColor[4]; ///< Color of the letter outlines.
 };
 
+/// Describes one string drawn by TextWriter::DrawDebugTextBatch().
+struct TextDrawInfo
+{
+    const char* pText; ///< Null-terminated text to draw.
+    Pal::uint32 x;     ///< X offset on the image for the beginning of the text.
+    Pal::uint32 y;     ///< Y offset on the image for the beginning of the text.
+};
+
 /**
  ***********************************************************************************************************************
  * @brief TextWriter is GPU utility which uses PAL core and Utility classes to draw text onto a Pal::IImage object using
@@ -75,7 +83,19 @@ public:
         Pal::uint32        x,
         Pal::uint32        y) const;
 
+    /// Draws several strings to the specified image using the specific command buffer.  The pipeline, descriptor table
+    /// and text data are set up once for the whole batch, so this is much cheaper than calling DrawDebugText() for each
+    /// string.
+    void DrawDebugTextBatch(
+        const Pal::IImage&  dstImage,
+        Pal::ICmdBuffer*    pCmdBuffer,
+        Pal::uint32         textCount,
+        const TextDrawInfo* pTexts) const;
+
 private:
+    // Packs the text colors into the raw format of the destination image.
+    static void GetTextColors(Pal::SwizzledFormat imgFormat, TextDrawShaderInfo* pInfo);
+
     // Creates the GPU memory for the constant font data binary.
     Pal::Result CreateDrawFontData();
 
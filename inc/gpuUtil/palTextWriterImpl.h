@@ -231,116 +231,183 @@ void TextWriter<Allocator>::DrawDebugText(
     Pal::uint32        y            // Y drawing offset
     ) const
 {
-    const Pal::uint32 stringLen = static_cast<Pal::uint32>(strlen(pText));
+    const TextDrawInfo text = { pText, x, y };
 
-    if (stringLen > 0)
+    DrawDebugTextBatch(dstImage, pCmdBuffer, 1, &text);
+}
+
+// =====================================================================================================================
+// Executes a batch of text draws (using one dispatch per string) onto the destination image. The colors, descriptor
+// table and pipeline are only set up once, and the text of as many strings as possible is packed into one embedded
+// data allocation.
+template <typename Allocator>
+void TextWriter<Allocator>::DrawDebugTextBatch(
+    const Pal::IImage&  dstImage,   // Desintation image.
+    Pal::ICmdBuffer*    pCmdBuffer, // Command buffer for drawing text
+    Pal::uint32         textCount,  // Number of strings to draw
+    const TextDrawInfo* pTexts      // Strings to draw and their drawing offsets
+    ) const
+{
+    constexpr Pal::uint32 InfoDwords = sizeof(TextDrawShaderInfo) / sizeof(Pal::uint32);
+
+    TextDrawShaderInfo info = {};
+    bool               stateBound = false;
+
+    const Pal::uint32 dataLimit = pCmdBuffer->GetEmbeddedDataLimit();
+
+    for (Pal::uint32 first = 0; first < textCount; )
     {
-        TextDrawShaderInfo info = {};
-        info.startX = x;
-        info.startY = y;
-
-        // Pack the raw draw colors into the destination format.
-        const Pal::SwizzledFormat imgFormat = dstImage.GetImageCreateInfo().swizzledFormat;
-        Pal::uint32 foregroundColor[4] = {};
-        Pal::uint32 backgroundColor[4] = {};
-
-        // Convert the raw color into the destination format.
-        if (Pal::Formats::IsUnorm(imgFormat.format)   || Pal::Formats::IsSnorm(imgFormat.format)   ||
-            Pal::Formats::IsUscaled(imgFormat.format) || Pal::Formats::IsSscaled(imgFormat.format) ||
-            Pal::Formats::IsFloat(imgFormat.format)   || Pal::Formats::IsSrgb(imgFormat.format))
-        {
-            constexpr float ColorTable[][4] =
-            {
-                { 1.0f, 1.0f, 1.0f, 1.0f },     // White
-                { 0.0f, 0.0f, 0.0f, 1.0f },     // Black
-            };
+        // Gather as many of the remaining strings as will fit in one embedded data allocation.
+        Pal::uint32 last       = first;
+        Pal::uint32 dataDwords = 0;
 
-            Pal::Formats::ConvertColor(imgFormat, &ColorTable[WhiteColor][0], &foregroundColor[0]);
-            Pal::Formats::ConvertColor(imgFormat, &ColorTable[BlackColor][0], &backgroundColor[0]);
-        }
-        else if (Pal::Formats::IsSint(imgFormat.format))
+        for (; last < textCount; last++)
         {
-            constexpr Pal::uint32 ColorTable[][4] =
+            const Pal::uint32 stringLen  = static_cast<Pal::uint32>(strlen(pTexts[last].pText));
+            const Pal::uint32 textDwords = (stringLen > 0) ? (InfoDwords + stringLen) : 0;
+
+            if ((last > first) && ((dataDwords + textDwords) > dataLimit))
             {
-                { 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF },     // White
-                { 0x00000000, 0x00000000, 0x00000000, 0xFFFFFFFF },     // Black
-            };
-            memcpy(&foregroundColor[0], &ColorTable[WhiteColor][0], sizeof(foregroundColor));
-            memcpy(&backgroundColor[0], &ColorTable[BlackColor][0], sizeof(backgroundColor));
+                break;
+            }
+
+            dataDwords += textDwords;
         }
-        else
-        {
-            PAL_ASSERT(Pal::Formats::IsUint(imgFormat.format));
 
-            constexpr Pal::uint32 ColorTable[][4] =
+        if (dataDwords > 0)
+        {
+            if (stateBound == false)
             {
-                { 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF },     // White
-                { 0x00000000, 0x00000000, 0x00000000, 0xFFFFFFFF },     // Black
-            };
+                GetTextColors(dstImage.GetImageCreateInfo().swizzledFormat, &info);
 
-            memcpy(&foregroundColor[0], &ColorTable[WhiteColor][0], sizeof(foregroundColor));
-            memcpy(&backgroundColor[0], &ColorTable[BlackColor][0], sizeof(backgroundColor));
-        }
+                // Construct an embedded descriptor table. The first entry is a buffer view for the font data and the
+                // second is an image view for the target image.
+                const Pal::uint32 srdDwords = m_maxSrdSize / sizeof(Pal::uint32);
 
-        Pal::uint32 swizzledForegroundColor[4] = {};
-        Pal::uint32 swizzledBackgroundColor[4] = {};
+                Pal::gpusize      tableGpuAddr = 0;
+                Pal::uint32*const pTable       = pCmdBuffer->CmdAllocateEmbeddedData(2 * srdDwords, 1, &tableGpuAddr);
 
-        Pal::Formats::SwizzleColor(imgFormat, foregroundColor, swizzledForegroundColor);
-        Pal::Formats::SwizzleColor(imgFormat, backgroundColor, swizzledBackgroundColor);
+                memcpy(pTable, m_fontSrd, sizeof(m_fontSrd));
+                CreateImageView(&dstImage, pTable + srdDwords);
 
-        Pal::Formats::PackRawClearColor(imgFormat, swizzledForegroundColor, &info.foregroundColor[0]);
-        Pal::Formats::PackRawClearColor(imgFormat, swizzledBackgroundColor, &info.backgroundColor[0]);
+                // Bind that descriptor table to user data #0.
+                const Pal::uint32 tableGpuAddrLo = Util::LowPart(tableGpuAddr);
+                pCmdBuffer->CmdSetUserData(Pal::PipelineBindPoint::Compute, 0, 1, &tableGpuAddrLo);
 
-        // Get enough embedded space to store the text draw info struct and the string.
-        Pal::gpusize      dataAddr   = 0;
-        const Pal::uint32 dataDwords = (sizeof(TextDrawShaderInfo) / sizeof(Pal::uint32)) + stringLen;
-        Pal::uint32*      pData      = pCmdBuffer->CmdAllocateEmbeddedData(dataDwords, 1, &dataAddr);
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 471
+                pCmdBuffer->CmdBindPipeline({ Pal::PipelineBindPoint::Compute, m_pPipeline, Pal::InternalApiPsoHash, });
+#else
+                pCmdBuffer->CmdBindPipeline({ Pal::PipelineBindPoint::Compute, m_pPipeline, });
+#endif
+                stateBound = true;
+            }
 
-        // Copy the info struct into the embedded space.
-        memcpy(pData, &info, sizeof(TextDrawShaderInfo));
+            // Get enough embedded space to store the text draw info struct and the string of every gathered text.
+            Pal::gpusize dataAddr = 0;
+            Pal::uint32* pData    = pCmdBuffer->CmdAllocateEmbeddedData(dataDwords, 1, &dataAddr);
 
-        // NOTE: The string data immediately follows the info struct in the buffer. The shader's thread group is
-        //       responsible for one letter. Each uint32 contains the ASCII value of the character, which is how
-        //       the shader determines the offset into the font data buffer.
-        pData += (sizeof(TextDrawShaderInfo) / sizeof(Pal::uint32));
-        for (Pal::uint32 index = 0; index < stringLen; index++)
-        {
-            pData[index] = pText[index];
+            for (Pal::uint32 textIdx = first; textIdx < last; textIdx++)
+            {
+                const char*const  pText     = pTexts[textIdx].pText;
+                const Pal::uint32 stringLen = static_cast<Pal::uint32>(strlen(pText));
+
+                if (stringLen > 0)
+                {
+                    // Copy the info struct into the embedded space.
+                    info.startX = pTexts[textIdx].x;
+                    info.startY = pTexts[textIdx].y;
+                    memcpy(pData, &info, sizeof(TextDrawShaderInfo));
+
+                    // NOTE: The string data immediately follows the info struct in the buffer. The shader's thread
+                    //       group is responsible for one letter. Each uint32 contains the ASCII value of the character,
+                    //       which is how the shader determines the offset into the font data buffer.
+                    for (Pal::uint32 index = 0; index < stringLen; index++)
+                    {
+                        pData[InfoDwords + index] = pText[index];
+                    }
+
+                    // Bind a buffer view for this text's info struct and string in user data #1-4.
+                    const Pal::uint32 textDwords = InfoDwords + stringLen;
+
+                    Pal::BufferViewInfo dynamicViewInfo = {};
+                    dynamicViewInfo.gpuAddr        = dataAddr;
+                    dynamicViewInfo.range          = textDwords * sizeof(Pal::uint32);
+                    dynamicViewInfo.stride         = 1;
+                    dynamicViewInfo.swizzledFormat = Pal::UndefinedSwizzledFormat;
+
+                    Pal::uint32 dynamicViewSrd[4] = {};
+                    m_pDevice->CreateUntypedBufferViewSrds(1, &dynamicViewInfo, &dynamicViewSrd[0]);
+                    pCmdBuffer->CmdSetUserData(Pal::PipelineBindPoint::Compute, 1, 4, &dynamicViewSrd[0]);
+
+                    // Issue one thread group per letter.
+                    pCmdBuffer->CmdDispatch(stringLen, 1, 1);
+
+                    pData    += textDwords;
+                    dataAddr += textDwords * sizeof(Pal::uint32);
+                }
+            }
         }
 
-        // Construct an embedded descriptor table. The first entry is a buffer view for the font data and the second is
-        // an image view for the target image.
-        const Pal::uint32 srdDwords = m_maxSrdSize / sizeof(Pal::uint32);
-
-        Pal::gpusize      tableGpuAddr = 0;
-        Pal::uint32*const pTable       = pCmdBuffer->CmdAllocateEmbeddedData(2 * srdDwords, 1, &tableGpuAddr);
+        first = last;
+    }
+}
 
-        memcpy(pTable, m_fontSrd, sizeof(m_fontSrd));
-        CreateImageView(&dstImage, pTable + srdDwords);
+// =====================================================================================================================
+// Converts the raw text colors into the destination format and packs them into the draw info.
+template <typename Allocator>
+void TextWriter<Allocator>::GetTextColors(
+    Pal::SwizzledFormat imgFormat,
+    TextDrawShaderInfo* pInfo)
+{
+    Pal::uint32 foregroundColor[4] = {};
+    Pal::uint32 backgroundColor[4] = {};
 
-        // Bind that descriptor table to user data #0.
-        const Pal::uint32 tableGpuAddrLo = Util::LowPart(tableGpuAddr);
-        pCmdBuffer->CmdSetUserData(Pal::PipelineBindPoint::Compute, 0, 1, &tableGpuAddrLo);
+    // Convert the raw color into the destination format.
+    if (Pal::Formats::IsUnorm(imgFormat.format)   || Pal::Formats::IsSnorm(imgFormat.format)   ||
+        Pal::Formats::IsUscaled(imgFormat.format) || Pal::Formats::IsSscaled(imgFormat.format) ||
+        Pal::Formats::IsFloat(imgFormat.format)   || Pal::Formats::IsSrgb(imgFormat.format))
+    {
+        constexpr float ColorTable[][4] =
+        {
+            { 1.0f, 1.0f, 1.0f, 1.0f },     // White
+            { 0.0f, 0.0f, 0.0f, 1.0f },     // Black
+        };
 
-        // Bind a buffer view for the embedded info struct and string in user data #1-4.
-        Pal::BufferViewInfo dynamicViewInfo = {};
-        dynamicViewInfo.gpuAddr        = dataAddr;
-        dynamicViewInfo.range          = dataDwords * sizeof(Pal::uint32);
-        dynamicViewInfo.stride         = 1;
-        dynamicViewInfo.swizzledFormat = Pal::UndefinedSwizzledFormat;
+        Pal::Formats::ConvertColor(imgFormat, &ColorTable[WhiteColor][0], &foregroundColor[0]);
+        Pal::Formats::ConvertColor(imgFormat, &ColorTable[BlackColor][0], &backgroundColor[0]);
+    }
+    else if (Pal::Formats::IsSint(imgFormat.format))
+    {
+        constexpr Pal::uint32 ColorTable[][4] =
+        {
+            { 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF },     // White
+            { 0x00000000, 0x00000000, 0x00000000, 0xFFFFFFFF },     // Black
+        };
+        memcpy(&foregroundColor[0], &ColorTable[WhiteColor][0], sizeof(foregroundColor));
+        memcpy(&backgroundColor[0], &ColorTable[BlackColor][0], sizeof(backgroundColor));
+    }
+    else
+    {
+        PAL_ASSERT(Pal::Formats::IsUint(imgFormat.format));
 
-        Pal::uint32 dynamicViewSrd[4] = {};
-        m_pDevice->CreateUntypedBufferViewSrds(1, &dynamicViewInfo, &dynamicViewSrd[0]);
-        pCmdBuffer->CmdSetUserData(Pal::PipelineBindPoint::Compute, 1, 4, &dynamicViewSrd[0]);
+        constexpr Pal::uint32 ColorTable[][4] =
+        {
+            { 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF },     // White
+            { 0x00000000, 0x00000000, 0x00000000, 0xFFFFFFFF },     // Black
+        };
 
-        // Bind the pipeline and issue one thread group per letter.
-#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 471
-        pCmdBuffer->CmdBindPipeline({ Pal::PipelineBindPoint::Compute, m_pPipeline, Pal::InternalApiPsoHash, });
-#else
-        pCmdBuffer->CmdBindPipeline({ Pal::PipelineBindPoint::Compute, m_pPipeline, });
-#endif
-        pCmdBuffer->CmdDispatch(stringLen, 1, 1);
+        memcpy(&foregroundColor[0], &ColorTable[WhiteColor][0], sizeof(foregroundColor));
+        memcpy(&backgroundColor[0], &ColorTable[BlackColor][0], sizeof(backgroundColor));
     }
+
+    Pal::uint32 swizzledForegroundColor[4] = {};
+    Pal::uint32 swizzledBackgroundColor[4] = {};
+
+    Pal::Formats::SwizzleColor(imgFormat, foregroundColor, swizzledForegroundColor);
+    Pal::Formats::SwizzleColor(imgFormat, backgroundColor, swizzledBackgroundColor);
+
+    Pal::Formats::PackRawClearColor(imgFormat, swizzledForegroundColor, &pInfo->foregroundColor[0]);
+    Pal::Formats::PackRawClearColor(imgFormat, swizzledBackgroundColor, &pInfo->backgroundColor[0]);
 }
 
 // =====================================================================================================================
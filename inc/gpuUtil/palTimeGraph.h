@@ -52,6 +52,16 @@ struct ColorInfo
     Pal::uint32 lineColor[4]; ///< Color of the line.
 };
 
+/// Describes one line drawn by TimeGraph::DrawGraphLines().
+struct TimeGraphLineInfo
+{
+    const Pal::uint32* pTimeData;     ///< Scaled time values, one per data point.
+    Pal::uint32        xPosition;     ///< X offset on the image for the beginning of the line.
+    Pal::uint32        yPosition;     ///< Y offset on the image for the base of the line.
+    const Pal::uint32* pLineColor;    ///< Color of the line.
+    Pal::uint32        numDataPoints; ///< Number of data points.
+};
+
 /**
 ***********************************************************************************************************************
 * @brief TimeGraph is GPU utility which uses PAL core and Utility classes to draw non-vertical lines (horizontal and
@@ -81,6 +91,15 @@ public:
         const Pal::uint32* pLineColor,
         Pal::uint32        numDataPoints) const;
 
+    /// Draws several lines to the specified image using the specific command buffer.  The pipeline, image view and
+    /// time data are set up once for the whole batch, so this is much cheaper than calling DrawGraphLine() for each
+    /// line.
+    void DrawGraphLines(
+        const Pal::IImage&       dstImage,
+        Pal::ICmdBuffer*         pCmdBuffer,
+        Pal::uint32              lineCount,
+        const TimeGraphLineInfo* pLines) const;
+
 private:
     // Helper function to create GPU memory for the TextWriter.
     Pal::Result CreateGpuMemory(
@@ -154,69 +154,133 @@ void TimeGraph<Allocator>::DrawGraphLine(
     Pal::uint32        numDataPoints // Number of data points
     ) const
 {
-    ColorInfo colorInfo = {};
+    const TimeGraphLineInfo line = { pTimeData, xPosition, yPosition, pLineColor, numDataPoints };
 
-    // Pack the raw draw colors into the destination format.
+    DrawGraphLines(dstImage, pCmdBuffer, 1, &line);
+}
+
+// =====================================================================================================================
+// Executes a batch of line draws (using one dispatch per line) onto the destination image. The pipeline is only bound
+// once and the descriptor tables and time data of as many lines as possible are packed into one embedded data
+// allocation each.
+template <typename Allocator>
+void TimeGraph<Allocator>::DrawGraphLines(
+    const Pal::IImage&       dstImage,   // Desintation image.
+    Pal::ICmdBuffer*         pCmdBuffer, // Command buffer for drawing graph
+    Pal::uint32              lineCount,  // Number of lines to draw
+    const TimeGraphLineInfo* pLines      // Lines to draw
+    ) const
+{
     const Pal::SwizzledFormat imgFormat = dstImage.GetImageCreateInfo().swizzledFormat;
 
-    Pal::uint32 swizzledLineColor[4] = {};
-    Pal::Formats::SwizzleColor(imgFormat, pLineColor, swizzledLineColor);
-    Pal::Formats::PackRawClearColor(imgFormat, swizzledLineColor, &colorInfo.lineColor[0]);
+    // Each line gets its own embedded descriptor table. The first entry is an image view for the target image and the
+    // second is for the color data.
+    const Pal::uint32 srdDwords   = m_maxSrdSize / sizeof(Pal::uint32);
+    const Pal::uint32 tableDwords = srdDwords + (sizeof(ColorInfo) / sizeof(Pal::uint32));
+
+    const Pal::uint32 dataLimit     = pCmdBuffer->GetEmbeddedDataLimit();
+    bool              pipelineBound = false;
+
+    for (Pal::uint32 first = 0; first < lineCount; )
+    {
+        // Gather as many of the remaining lines as will fit in one embedded data allocation for their tables and one
+        // for their scaled time values.
+        Pal::uint32 last       = first;
+        Pal::uint32 dataDwords = 0;
+
+        for (; last < lineCount; last++)
+        {
+            const Pal::uint32 lineDwords = pLines[last].numDataPoints;
+
+            if ((last > first) &&
+                (((dataDwords + lineDwords) > dataLimit) || ((tableDwords * (last - first + 1)) > dataLimit)))
+            {
+                break;
+            }
+
+            dataDwords += lineDwords;
+        }
+
+        if (pipelineBound == false)
+        {
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 471
+            pCmdBuffer->CmdBindPipeline({ Pal::PipelineBindPoint::Compute, m_pPipeline, Pal::InternalApiPsoHash, });
+#else
+            pCmdBuffer->CmdBindPipeline({ Pal::PipelineBindPoint::Compute, m_pPipeline, });
+#endif
+            pipelineBound = true;
+        }
+
+        Pal::gpusize tableGpuAddr = 0;
+        Pal::uint32* pTable       = pCmdBuffer->CmdAllocateEmbeddedData(tableDwords * (last - first),
+                                                                        1,
+                                                                        &tableGpuAddr);
 
-    Pal::gpusize dataAddr = 0;
-    Pal::uint32* pData    = pCmdBuffer->CmdAllocateEmbeddedData(numDataPoints * sizeof(float), 1, &dataAddr);
+        Pal::gpusize dataAddr = 0;
+        Pal::uint32* pData    = pCmdBuffer->CmdAllocateEmbeddedData(dataDwords, 1, &dataAddr);
 
-    memcpy(pData, pTimeData, numDataPoints * sizeof(float));
+        for (Pal::uint32 lineIdx = first; lineIdx < last; lineIdx++)
+        {
+            const TimeGraphLineInfo& line = pLines[lineIdx];
+
+            // The image view is only created for the first table of each allocation, the others get a copy of it.
+            if (lineIdx == first)
+            {
+                CreateImageView(&dstImage, pTable);
+            }
+            else
+            {
+                memcpy(pTable, pTable - tableDwords, m_maxSrdSize);
+            }
 
-    Pal::BufferViewInfo bufferViewInfo = {};
+            // Pack the raw draw colors into the destination format.
+            ColorInfo colorInfo = {};
 
-    // Create an SRD for the Time data.
-    bufferViewInfo.gpuAddr        = dataAddr;
-    bufferViewInfo.range          = numDataPoints * sizeof(float);
-    bufferViewInfo.stride         = sizeof(float);
-    bufferViewInfo.swizzledFormat = Pal::UndefinedSwizzledFormat;
+            Pal::uint32 swizzledLineColor[4] = {};
+            Pal::Formats::SwizzleColor(imgFormat, line.pLineColor, swizzledLineColor);
+            Pal::Formats::PackRawClearColor(imgFormat, swizzledLineColor, &colorInfo.lineColor[0]);
 
-    Pal::uint32 bufferViewSrd[4] = {};
-    m_pDevice->CreateUntypedBufferViewSrds(1, &bufferViewInfo, &bufferViewSrd[0]);
+            memcpy(pTable + srdDwords, &colorInfo, sizeof(ColorInfo));
 
-    // Bind a buffer view for the Scaled Time Data in user data #0-3.
-    pCmdBuffer->CmdSetUserData(Pal::PipelineBindPoint::Compute, 0, 4, &bufferViewSrd[0]);
+            memcpy(pData, line.pTimeData, line.numDataPoints * sizeof(Pal::uint32));
 
-    // Construct an embedded descriptor table. The first entry is an image view for the target image and the second is
-    // for the color data .
-    const Pal::uint32 srdDwords = m_maxSrdSize / sizeof(Pal::uint32);
+            // Create an SRD for the Time data.
+            Pal::BufferViewInfo bufferViewInfo = {};
+            bufferViewInfo.gpuAddr        = dataAddr;
+            bufferViewInfo.range          = line.numDataPoints * sizeof(float);
+            bufferViewInfo.stride         = sizeof(float);
+            bufferViewInfo.swizzledFormat = Pal::UndefinedSwizzledFormat;
 
-    Pal::gpusize tableGpuAddr = 0;
-    Pal::uint32* pTable       = pCmdBuffer->CmdAllocateEmbeddedData(srdDwords + (sizeof(ColorInfo) / sizeof(Pal::uint32)),
-                                                                    1,
-                                                                    &tableGpuAddr);
+            Pal::uint32 bufferViewSrd[4] = {};
+            m_pDevice->CreateUntypedBufferViewSrds(1, &bufferViewInfo, &bufferViewSrd[0]);
 
-    CreateImageView(&dstImage, pTable);
+            // Bind a buffer view for the Scaled Time Data in user data #0-3.
+            pCmdBuffer->CmdSetUserData(Pal::PipelineBindPoint::Compute, 0, 4, &bufferViewSrd[0]);
 
-    pTable += srdDwords;
-    memcpy(pTable, &colorInfo, sizeof(ColorInfo));
+            // Bind this line's descriptor table to user data #4.
+            const Pal::uint32 tableGpuAddrLo = Util::LowPart(tableGpuAddr);
+            pCmdBuffer->CmdSetUserData(Pal::PipelineBindPoint::Compute, 4, 1, &tableGpuAddrLo);
 
-    const Pal::uint32 tableGpuAddrLo = Util::LowPart(tableGpuAddr);
+            const Pal::uint32 constantInfo[3] =
+            {
+                line.xPosition,
+                line.yPosition,
+                line.numDataPoints
+            };
 
-    // Bind that descriptor table to user data #4.
-    pCmdBuffer->CmdSetUserData(Pal::PipelineBindPoint::Compute, 4, 1, &tableGpuAddrLo);
+            pCmdBuffer->CmdSetUserData(Pal::PipelineBindPoint::Compute, 5, 3, &constantInfo[0]);
 
-    const Pal::uint32 constantInfo[3] =
-    {
-        xPosition,
-        yPosition,
-        numDataPoints
-    };
+            // Issue one thread group.
+            pCmdBuffer->CmdDispatch(32, 1, 1);
 
-    pCmdBuffer->CmdSetUserData(Pal::PipelineBindPoint::Compute, 5, 3, &constantInfo[0]);
+            pTable       += tableDwords;
+            tableGpuAddr += tableDwords * sizeof(Pal::uint32);
+            pData        += line.numDataPoints;
+            dataAddr     += line.numDataPoints * sizeof(Pal::uint32);
+        }
 
-    // Bind the pipeline and issue one thread group.
-#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 471
-    pCmdBuffer->CmdBindPipeline({ Pal::PipelineBindPoint::Compute, m_pPipeline, Pal::InternalApiPsoHash, });
-#else
-    pCmdBuffer->CmdBindPipeline({ Pal::PipelineBindPoint::Compute, m_pPipeline, });
-#endif
-    pCmdBuffer->CmdDispatch(32, 1, 1);
+        first = last;
+    }
 }
 
 // =====================================================================================================================
@@ -98,6 +98,9 @@ public:
         return (m_numSuballocations == 0);
     }
 
+    /// Returns the number of blocks currently suballocated from the base allocation.
+    uint32 NumSuballocations() const { return m_numSuballocations; }
+
     /// Returns the size of the largest allocation that can be suballocated with this buddy allocator.
     Pal::gpusize MaximumAllocationSize() const;
 
@@ -68,6 +68,18 @@ struct QueryResult
     } context;
 };
 
+/**
+***********************************************************************************************************************
+* @brief Running usage counters for a single cache layer, see ICacheLayer::GetStats
+***********************************************************************************************************************
+*/
+struct CacheLayerStats
+{
+    uint64 queryCount;  ///< Number of valid Query() calls made on this layer
+    uint64 hitCount;    ///< Number of those queries which were satisfied by this layer without asking the next layer
+    uint64 storeCount;  ///< Number of successful Store() calls made on this layer
+};
+
 /**
 ***********************************************************************************************************************
 * @brief Common cache layer interface. Allows all cache layers to be interfaced with agnostically
@@ -178,6 +190,17 @@ public:
     /// @return Link policy used during Store().
     virtual uint32 GetStorePolicy() const = 0;
 
+    /// Retrieve the layer's usage counters. These are cheap to maintain and are always tracked by the layers
+    /// implemented in PAL, so they can be used to report cache hit rates on release builds.
+    ///
+    /// @param [out] pStats     Current counters for this layer alone; linked layers track their own counters
+    ///
+    /// @return Success if the counters were written. Otherwise, one of the following may be returned:
+    ///         + Unsupported if the layer doesn't track usage counters
+    ///         + ErrorInvalidPointer if pStats is nullptr
+    virtual Result GetStats(
+        CacheLayerStats* pStats) const { return Result::Unsupported; }
+
     /// Destroy Cache Layer
     virtual void Destroy() = 0;
 
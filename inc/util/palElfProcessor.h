@@ -223,6 +223,14 @@ public:
     /// @returns  Pointer to the saved data if successful, or nullptr if memory allocation fails.
     void* SetData(const void* pData, size_t dataSize);
 
+    /// Points the section at externally owned data without copying it.  The data must remain valid and unchanged for
+    /// the lifetime of the section.  Any later call which modifies the section data will first copy it into memory
+    /// owned by the section.
+    ///
+    /// @param [in] pData    Pointer to the data to reference.
+    /// @param [in] dataSize Size in bytes of the data being referenced.
+    void SetDataView(const void* pData, size_t dataSize);
+
     /// Append data to the section.
     ///
     /// @param [in] pData    Pointer to the data to append.
@@ -316,6 +324,7 @@ private:
 
     const char*         m_pName;
     void*               m_pData;
+    bool                m_ownsData;  // False if m_pData references memory set with SetDataView().
 
     Section<Allocator>* m_pLinkSection;
     Section<Allocator>* m_pInfoSection;
@@ -868,7 +877,19 @@ public:
     /// @returns Success if successful, or ErrorOutOfMemory upon allocation failure.
     Result LoadFromBuffer(const void* pBuffer, size_t bufferSize);
 
+    /// Load the ELF from a buffer without copying any section data.  The sections reference the caller's buffer
+    /// directly, so the buffer must remain valid and unchanged for the lifetime of this ElfProcessor.  This is intended
+    /// for read-only access; sections which are later modified are copied on first write.
+    ///
+    /// @param [in] pBuffer    Pointer to the buffer to load from.
+    /// @param [in] bufferSize Size of the buffer in bytes to load from.
+    ///
+    /// @returns Success if successful, or ErrorOutOfMemory upon allocation failure.
+    Result LoadFromBufferView(const void* pBuffer, size_t bufferSize);
+
 private:
+    Result LoadFromBufferInternal(const void* pBuffer, size_t bufferSize, bool copySections);
+
     FileHeader          m_fileHeader;
     Sections<Allocator> m_sections;
     Segments<Allocator> m_segments;
@@ -268,7 +268,9 @@ Section<Allocator>* Sections<Allocator>::Add(
             pSection = PAL_NEW(Section<Allocator>, m_pAllocator, AllocInternalTemp)(m_pAllocator);
             if (pSection != nullptr)
             {
-                const uint32 nameOffset = m_pStringProcessor->Add(pName);
+                // Sections loaded from an existing ELF already have their name in the loaded .shstrtab.
+                const uint32 nameOffset =
+                    (pSectionHdr == nullptr) ? m_pStringProcessor->Add(pName) : pSectionHdr->sh_name;
                 if (nameOffset == 0)
                 {
                     result = Result::ErrorOutOfMemory;
@@ -344,6 +346,7 @@ Section<Allocator>::Section(
     m_index(0),
     m_pName(nullptr),
     m_pData(nullptr),
+    m_ownsData(true),
     m_pLinkSection(nullptr),
     m_pInfoSection(nullptr),
     m_sectionHeader(),
@@ -355,7 +358,10 @@ Section<Allocator>::Section(
 template <typename Allocator>
 Section<Allocator>::~Section()
 {
-    PAL_SAFE_FREE(m_pData, m_pAllocator);
+    if (m_ownsData)
+    {
+        PAL_SAFE_FREE(m_pData, m_pAllocator);
+    }
 }
 
 // =====================================================================================================================
@@ -391,13 +397,14 @@ void* Section<Allocator>::SetData(
     void* pNewData = PAL_MALLOC(dataSize, m_pAllocator, AllocInternalTemp);
     if (pNewData != nullptr)
     {
-        if (m_pData != nullptr)
+        if (m_ownsData && (m_pData != nullptr))
         {
             PAL_SAFE_FREE(m_pData, m_pAllocator);
         }
 
         memcpy(pNewData, pData, dataSize);
-        m_pData = pNewData;
+        m_pData    = pNewData;
+        m_ownsData = true;
         m_sectionHeader.sh_size = dataSize;
     }
     // NOTE: If memory allocation fails, no state will be changed, and nullptr is returned.
@@ -405,6 +412,25 @@ void* Section<Allocator>::SetData(
     return pNewData;
 }
 
+// =====================================================================================================================
+template <typename Allocator>
+void Section<Allocator>::SetDataView(
+    const void* pData,
+    size_t      dataSize)
+{
+    PAL_ASSERT((pData != nullptr) || ((pData == nullptr) && (dataSize == 0)));
+
+    if (m_ownsData && (m_pData != nullptr))
+    {
+        PAL_SAFE_FREE(m_pData, m_pAllocator);
+    }
+
+    // The data is never written through m_pData while m_ownsData is false; the first modification makes a copy.
+    m_pData    = const_cast<void*>(pData);
+    m_ownsData = false;
+    m_sectionHeader.sh_size = dataSize;
+}
+
 // =====================================================================================================================
 template <typename Allocator>
 void* Section<Allocator>::AppendData(
@@ -440,10 +466,14 @@ void* Section<Allocator>::AppendUninitializedData(
         if (m_pData != nullptr)
         {
             memcpy(pNewData, m_pData, GetDataSize());
-            PAL_SAFE_FREE(m_pData, m_pAllocator);
+            if (m_ownsData)
+            {
+                PAL_SAFE_FREE(m_pData, m_pAllocator);
+            }
         }
 
-        m_pData = pNewData;
+        m_pData    = pNewData;
+        m_ownsData = true;
         m_sectionHeader.sh_size = newDataSize;
     }
     // NOTE: If memory allocation fails, no state will be changed, and nullptr is returned.
@@ -1275,6 +1305,25 @@ template <typename Allocator>
 Result ElfProcessor<Allocator>::LoadFromBuffer(
     const void*  pBuffer,
     size_t       bufferSize)
+{
+    return LoadFromBufferInternal(pBuffer, bufferSize, true);
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+Result ElfProcessor<Allocator>::LoadFromBufferView(
+    const void*  pBuffer,
+    size_t       bufferSize)
+{
+    return LoadFromBufferInternal(pBuffer, bufferSize, false);
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+Result ElfProcessor<Allocator>::LoadFromBufferInternal(
+    const void*  pBuffer,
+    size_t       bufferSize,
+    bool         copySections)
 {
     const void* pBufferStart = pBuffer;
     PAL_ASSERT(bufferSize >= FileHeaderSize);
@@ -1335,12 +1384,19 @@ Result ElfProcessor<Allocator>::LoadFromBuffer(
                 pSection->SetEntrySize(pSectionHdrReader->sh_entsize);
                 pSection->SetOffset(static_cast<size_t>(pSectionHdrReader->sh_offset));
 
-                const void* pData = VoidPtrInc(pBufferStart, static_cast<size_t>(pSectionHdrReader->sh_offset));
-                if ((pSectionHdrReader->sh_size != 0) &&
-                    (pSection->SetData(pData, static_cast<size_t>(pSectionHdrReader->sh_size)) == nullptr))
+                const void*  pData    = VoidPtrInc(pBufferStart, static_cast<size_t>(pSectionHdrReader->sh_offset));
+                const size_t dataSize = static_cast<size_t>(pSectionHdrReader->sh_size);
+                if (dataSize != 0)
                 {
-                    result = Result::ErrorOutOfMemory;
-                    break;
+                    if (copySections == false)
+                    {
+                        pSection->SetDataView(pData, dataSize);
+                    }
+                    else if (pSection->SetData(pData, dataSize) == nullptr)
+                    {
+                        result = Result::ErrorOutOfMemory;
+                        break;
+                    }
                 }
 
                 pSectionHdrReader++;
@@ -0,0 +1,203 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palJobSystem.h
+ * @brief PAL utility collection JobSystem class declaration.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palConditionVariable.h"
+#include "palDeque.h"
+#include "palMutex.h"
+#include "palSemaphore.h"
+#include "palThread.h"
+#include <atomic>
+
+namespace Util
+{
+
+/// Function executed by a job.  Jobs must not block on other jobs except through @ref JobSystem::Wait.
+typedef void (*JobFunction)(void* pData);
+
+/// Specifies the properties of a @ref JobSystem.
+struct JobSystemCreateInfo
+{
+    uint32 numWorkers;        ///< Number of worker threads to launch.  If zero, no threads are created and every job
+                              ///  is executed immediately on the thread that submits it.
+    uint32 maxJobsPerWorker;  ///< Capacity of each worker's local job queue, rounded up to a power of two.  A worker
+                              ///  which submits more jobs than this runs the overflow inline.  Zero selects a default.
+    uint64 affinityMask;      ///< If non-zero, worker N is restricted to the Nth set bit in this mask, wrapping around
+                              ///  when there are more workers than set bits.  If zero, workers may run on any core.
+};
+
+/**
+ ***********************************************************************************************************************
+ * @brief Tracks completion of a set of jobs submitted to a @ref JobSystem.
+ *
+ * A JobGroup may be reused once it is idle.  It must outlive every job submitted with it.
+ ***********************************************************************************************************************
+ */
+class JobGroup
+{
+public:
+    JobGroup() : m_numPending(0) { }
+    ~JobGroup() { PAL_ASSERT(IsIdle()); }
+
+    /// Returns true if every job submitted with this group has finished executing.
+    bool IsIdle() const { return (m_numPending.load(std::memory_order_acquire) == 0); }
+
+private:
+    std::atomic<uint32> m_numPending;
+
+    template <typename Allocator> friend class JobSystem;
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(JobGroup);
+};
+
+/**
+ ***********************************************************************************************************************
+ * @brief Work-stealing pool of worker threads for short, independent CPU tasks.
+ *
+ * Each worker owns a fixed-size Chase-Lev deque: jobs submitted from a worker thread are pushed and popped at the
+ * bottom of that worker's deque without locking, while idle workers steal from the top of other workers' deques.  Jobs
+ * submitted from any other thread go to a shared, mutex-protected queue which every worker drains before stealing.
+ * Workers with nothing to do sleep on a semaphore which submissions signal only while a worker is asleep.
+ *
+ * Jobs are not ordered with respect to each other.  @ref Wait helps execute pending jobs while waiting for a group, so
+ * it may be called from inside a job without deadlocking the pool.
+ ***********************************************************************************************************************
+ */
+template <typename Allocator>
+class JobSystem
+{
+public:
+    /// Constructor.
+    ///
+    /// @param [in] pAllocator The allocator that will allocate memory if required.
+    explicit JobSystem(Allocator*const pAllocator);
+    ~JobSystem();
+
+    /// Launches the worker threads.  Must be called once, before any jobs are submitted.
+    ///
+    /// @param [in] createInfo Number, queue size and affinity of the workers.
+    ///
+    /// @returns Success if the job system was initialized, ErrorOutOfMemory if an allocation failed, or
+    ///          ErrorInitializationFailed if a thread or synchronization object could not be created.
+    Result Init(const JobSystemCreateInfo& createInfo);
+
+    /// Stops and joins the worker threads.  Jobs which are still queued are executed first.  Called automatically by
+    /// the destructor; calling it more than once is harmless.
+    void Destroy();
+
+    /// Queues a job.  If the job system has no workers the job is executed before this call returns.
+    ///
+    /// @param [in] pfnJob Function to execute.
+    /// @param [in] pData  Argument passed to pfnJob.
+    /// @param [in] pGroup Optional group used to wait for this job; may be null.
+    void Submit(JobFunction pfnJob, void* pData, JobGroup* pGroup);
+
+    /// Executes pending jobs on the calling thread until every job in the given group has finished.  If the group's
+    /// remaining jobs are all running on other threads, the caller sleeps until a job finishes or a new one is queued.
+    ///
+    /// @param [in] pGroup Group to wait on.
+    void Wait(JobGroup* pGroup);
+
+    /// Returns the number of worker threads.
+    uint32 NumWorkers() const { return m_numWorkers; }
+
+    /// Returns true if the calling thread is one of this job system's workers.
+    bool IsWorkerThread() const { return (CurrentWorker() != nullptr); }
+
+private:
+    struct Job
+    {
+        JobFunction pfnJob;
+        void*       pData;
+        JobGroup*   pGroup;
+    };
+
+    // Fixed-capacity Chase-Lev deque.  Only the owning worker may call Push and Pop; any thread may call Steal.
+    class WorkStealingDeque
+    {
+    public:
+        WorkStealingDeque() : m_pJobs(nullptr), m_mask(0), m_top(0), m_bottom(0) { }
+
+        void Init(Job* pJobs, uint32 capacity) { m_pJobs = pJobs; m_mask = (capacity - 1); }
+
+        bool Push(const Job& job);
+        bool Pop(Job* pJob);
+        bool Steal(Job* pJob);
+
+    private:
+        Job*                m_pJobs;
+        int64               m_mask;
+        std::atomic<int64>  m_top;     // Next slot to steal from.
+        std::atomic<int64>  m_bottom;  // Next slot to push to.
+
+        PAL_DISALLOW_COPY_AND_ASSIGN(WorkStealingDeque);
+    };
+
+    struct Worker
+    {
+        JobSystem*        pJobSystem;
+        uint32            index;
+        Thread            thread;
+        WorkStealingDeque deque;
+    };
+
+    static void WorkerThreadFunc(void* pParam);
+
+    Worker* CurrentWorker() const;
+    bool    TryGetJob(Worker* pSelf, Job* pJob);
+    void    ExecuteJob(const Job& job);
+    void    WakeWorkers();
+    void    WakeWaiters();
+
+    Allocator*const        m_pAllocator;
+    uint32                 m_numWorkers;
+    Worker*                m_pWorkers;
+    Job*                   m_pJobStorage;       // Backing storage for all of the workers' deques.
+    ThreadLocalKey         m_workerKey;         // Maps a worker thread to its Worker.
+    bool                   m_workerKeyCreated;
+
+    Deque<Job, Allocator>  m_sharedQueue;       // Jobs submitted from threads which are not workers.
+    Mutex                  m_sharedQueueLock;
+
+    Semaphore              m_wakeSemaphore;
+    std::atomic<uint32>    m_numQueuedJobs;     // Jobs submitted but not yet picked up by any thread.
+    std::atomic<uint32>    m_numSleeping;       // Workers sleeping, or about to sleep, on m_wakeSemaphore.
+    std::atomic<bool>      m_shutdown;
+
+    Mutex                  m_waiterLock;        // Protects m_waiterCondition.
+    ConditionVariable      m_waiterCondition;   // Signaled when a job finishes or is queued while a Wait() is asleep.
+    std::atomic<uint32>    m_numWaitersAsleep;  // Threads sleeping, or about to sleep, in Wait().
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(JobSystem);
+};
+
+} // Util
@@ -0,0 +1,505 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palJobSystemImpl.h
+ * @brief PAL utility collection JobSystem class implementation.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palDequeImpl.h"
+#include "palInlineFuncs.h"
+#include "palJobSystem.h"
+
+namespace Util
+{
+
+// =====================================================================================================================
+// Pushes a job onto the bottom of the deque.  Returns false if the deque is full.  Only called by the owning worker.
+template <typename Allocator>
+bool JobSystem<Allocator>::WorkStealingDeque::Push(
+    const Job& job)
+{
+    const int64 bottom = m_bottom.load(std::memory_order_relaxed);
+    const int64 top    = m_top.load(std::memory_order_acquire);
+
+    bool pushed = false;
+    if ((bottom - top) <= m_mask)
+    {
+        m_pJobs[bottom & m_mask] = job;
+
+        // The job must be visible to thieves before the new bottom is.
+        m_bottom.store(bottom + 1, std::memory_order_release);
+
+        pushed = true;
+    }
+
+    return pushed;
+}
+
+// =====================================================================================================================
+// Pops the most recently pushed job from the bottom of the deque.  Only called by the owning worker.
+template <typename Allocator>
+bool JobSystem<Allocator>::WorkStealingDeque::Pop(
+    Job* pJob)
+{
+    const int64 bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+    m_bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64 top = m_top.load(std::memory_order_relaxed);
+
+    bool popped = false;
+    if (top <= bottom)
+    {
+        *pJob  = m_pJobs[bottom & m_mask];
+        popped = true;
+
+        if (top == bottom)
+        {
+            // This is the last job, so we must race any thieves for it.
+            popped = m_top.compare_exchange_strong(top,
+                                                   top + 1,
+                                                   std::memory_order_seq_cst,
+                                                   std::memory_order_relaxed);
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+    }
+    else
+    {
+        // The deque was already empty.
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+
+    return popped;
+}
+
+// =====================================================================================================================
+// Steals the oldest job from the top of the deque.  May be called by any thread.
+template <typename Allocator>
+bool JobSystem<Allocator>::WorkStealingDeque::Steal(
+    Job* pJob)
+{
+    int64 top = m_top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const int64 bottom = m_bottom.load(std::memory_order_acquire);
+
+    bool stolen = false;
+    if (top < bottom)
+    {
+        // The owner can only overwrite this slot after top has moved past it, in which case the exchange below fails
+        // and the copy is discarded.
+        *pJob  = m_pJobs[top & m_mask];
+        stolen = m_top.compare_exchange_strong(top,
+                                               top + 1,
+                                               std::memory_order_seq_cst,
+                                               std::memory_order_relaxed);
+    }
+
+    return stolen;
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+JobSystem<Allocator>::JobSystem(
+    Allocator*const pAllocator)
+    :
+    m_pAllocator(pAllocator),
+    m_numWorkers(0),
+    m_pWorkers(nullptr),
+    m_pJobStorage(nullptr),
+    m_workerKey(),
+    m_workerKeyCreated(false),
+    m_sharedQueue(pAllocator),
+    m_numQueuedJobs(0),
+    m_numSleeping(0),
+    m_shutdown(false),
+    m_numWaitersAsleep(0)
+{
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+JobSystem<Allocator>::~JobSystem()
+{
+    Destroy();
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+Result JobSystem<Allocator>::Init(
+    const JobSystemCreateInfo& createInfo)
+{
+    // Each worker can hold this many jobs locally before it has to run them inline.
+    constexpr uint32 DefaultMaxJobsPerWorker = 256;
+
+    PAL_ASSERT(m_pWorkers == nullptr);
+
+    Result result = m_sharedQueueLock.Init();
+
+    if (result == Result::Success)
+    {
+        result = m_waiterLock.Init();
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_waiterCondition.Init();
+    }
+
+    if ((result == Result::Success) && (createInfo.numWorkers > 0))
+    {
+        const uint32 capacity = Pow2Pad((createInfo.maxJobsPerWorker > 0) ? createInfo.maxJobsPerWorker
+                                                                           : DefaultMaxJobsPerWorker);
+
+        result = m_wakeSemaphore.Init(createInfo.numWorkers, 0);
+
+        if (result == Result::Success)
+        {
+            result = CreateThreadLocalKey(&m_workerKey);
+            m_workerKeyCreated = (result == Result::Success);
+        }
+
+        if (result == Result::Success)
+        {
+            m_pJobStorage = static_cast<Job*>(PAL_MALLOC(sizeof(Job) * capacity * createInfo.numWorkers,
+                                                         m_pAllocator,
+                                                         AllocInternal));
+            m_pWorkers    = PAL_NEW_ARRAY(Worker, createInfo.numWorkers, m_pAllocator, AllocInternal);
+
+            if ((m_pJobStorage == nullptr) || (m_pWorkers == nullptr))
+            {
+                result = Result::ErrorOutOfMemory;
+            }
+        }
+
+        if (result == Result::Success)
+        {
+            m_numWorkers = createInfo.numWorkers;
+
+            for (uint32 idx = 0; idx < m_numWorkers; ++idx)
+            {
+                m_pWorkers[idx].pJobSystem = this;
+                m_pWorkers[idx].index      = idx;
+                m_pWorkers[idx].deque.Init(m_pJobStorage + (idx * capacity), capacity);
+            }
+
+            const uint32 numAffinityCores = CountSetBits(createInfo.affinityMask);
+
+            for (uint32 idx = 0; (result == Result::Success) && (idx < m_numWorkers); ++idx)
+            {
+                Thread*const pThread = &m_pWorkers[idx].thread;
+
+                if (pThread->Begin(&WorkerThreadFunc, &m_pWorkers[idx]) != Result::Success)
+                {
+                    result = Result::ErrorInitializationFailed;
+                }
+                else if (numAffinityCores > 0)
+                {
+                    // Find the (idx % numAffinityCores)'th set bit of the mask.
+                    uint64 remainingMask = createInfo.affinityMask;
+                    for (uint32 skip = (idx % numAffinityCores); skip > 0; --skip)
+                    {
+                        remainingMask &= (remainingMask - 1);
+                    }
+
+                    // Running unpinned is only a performance concern.
+                    const Result affinityResult = pThread->SetAffinityMask(remainingMask & (~remainingMask + 1));
+                    PAL_ALERT(affinityResult != Result::Success);
+                }
+            }
+        }
+
+        if (result != Result::Success)
+        {
+            Destroy();
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+void JobSystem<Allocator>::Destroy()
+{
+    if (m_pWorkers != nullptr)
+    {
+        // Workers only exit once they find no more work, so everything queued so far is executed.
+        m_shutdown.store(true, std::memory_order_seq_cst);
+        m_wakeSemaphore.Post(m_numWorkers);
+
+        for (uint32 idx = 0; idx < m_numWorkers; ++idx)
+        {
+            if (m_pWorkers[idx].thread.IsCreated())
+            {
+                m_pWorkers[idx].thread.Join();
+            }
+        }
+
+        PAL_SAFE_DELETE_ARRAY(m_pWorkers, m_pAllocator);
+    }
+
+    PAL_SAFE_FREE(m_pJobStorage, m_pAllocator);
+
+    if (m_workerKeyCreated)
+    {
+        DeleteThreadLocalKey(m_workerKey);
+        m_workerKeyCreated = false;
+    }
+
+    m_numWorkers = 0;
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+void JobSystem<Allocator>::Submit(
+    JobFunction pfnJob,
+    void*       pData,
+    JobGroup*   pGroup)
+{
+    PAL_ASSERT(pfnJob != nullptr);
+
+    if (pGroup != nullptr)
+    {
+        pGroup->m_numPending.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    const Job job = { pfnJob, pData, pGroup };
+
+    bool queued = false;
+    if (m_numWorkers > 0)
+    {
+        // Count the job before it becomes visible so that thieves never see the counter underflow.
+        m_numQueuedJobs.fetch_add(1, std::memory_order_seq_cst);
+
+        Worker*const pSelf = CurrentWorker();
+        if (pSelf != nullptr)
+        {
+            queued = pSelf->deque.Push(job);
+        }
+        else
+        {
+            MutexAuto lock(&m_sharedQueueLock);
+            queued = (m_sharedQueue.PushBack(job) == Result::Success);
+        }
+
+        if (queued)
+        {
+            WakeWorkers();
+            WakeWaiters();
+        }
+        else
+        {
+            m_numQueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    if (queued == false)
+    {
+        // There are no workers or the queue is full; either way the caller has to do the work itself.
+        ExecuteJob(job);
+    }
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+void JobSystem<Allocator>::Wait(
+    JobGroup* pGroup)
+{
+    // Jobs are expected to be short, so a waiter whose group is running elsewhere yields this many times before it
+    // goes to sleep.
+    constexpr uint32 MaxSpinsBeforeSleep = 64;
+
+    PAL_ASSERT(pGroup != nullptr);
+
+    Worker*const pSelf = CurrentWorker();
+    uint32       spins = 0;
+
+    while (pGroup->IsIdle() == false)
+    {
+        Job job;
+        if (TryGetJob(pSelf, &job))
+        {
+            ExecuteJob(job);
+            spins = 0;
+        }
+        else if (spins < MaxSpinsBeforeSleep)
+        {
+            // The remaining jobs are running on other threads.
+            YieldThread();
+            ++spins;
+        }
+        else
+        {
+            // Announce that we're going to sleep before the final check.  Paired with the seq_cst accesses in Submit,
+            // ExecuteJob and WakeWaiters, either we see the finished or queued job or its thread sees us and wakes us.
+            m_numWaitersAsleep.fetch_add(1, std::memory_order_seq_cst);
+
+            {
+                MutexAuto lock(&m_waiterLock);
+
+                if ((pGroup->m_numPending.load(std::memory_order_seq_cst) > 0) &&
+                    (m_numQueuedJobs.load(std::memory_order_seq_cst) == 0))
+                {
+                    m_waiterCondition.Wait(&m_waiterLock, UINT32_MAX);
+                }
+            }
+
+            m_numWaitersAsleep.fetch_sub(1, std::memory_order_relaxed);
+            spins = 0;
+        }
+    }
+}
+
+// =====================================================================================================================
+// Returns the calling thread's Worker, or null if it isn't one of our workers.
+template <typename Allocator>
+typename JobSystem<Allocator>::Worker* JobSystem<Allocator>::CurrentWorker() const
+{
+    return (m_numWorkers > 0) ? static_cast<Worker*>(GetThreadLocalValue(m_workerKey)) : nullptr;
+}
+
+// =====================================================================================================================
+// Looks for a job in, in order, the calling worker's own deque, the shared queue and the other workers' deques.
+template <typename Allocator>
+bool JobSystem<Allocator>::TryGetJob(
+    Worker* pSelf,
+    Job*    pJob)
+{
+    bool found = false;
+
+    if (m_numQueuedJobs.load(std::memory_order_relaxed) > 0)
+    {
+        if (pSelf != nullptr)
+        {
+            found = pSelf->deque.Pop(pJob);
+        }
+
+        if (found == false)
+        {
+            MutexAuto lock(&m_sharedQueueLock);
+            found = (m_sharedQueue.NumElements() > 0) && (m_sharedQueue.PopFront(pJob) == Result::Success);
+        }
+
+        // Start with the next worker over so that thieves spread out over their victims.
+        const uint32 firstVictim = (pSelf != nullptr) ? (pSelf->index + 1) : 0;
+        for (uint32 idx = 0; (found == false) && (idx < m_numWorkers); ++idx)
+        {
+            Worker*const pVictim = &m_pWorkers[(firstVictim + idx) % m_numWorkers];
+            if (pVictim != pSelf)
+            {
+                found = pVictim->deque.Steal(pJob);
+            }
+        }
+
+        if (found)
+        {
+            m_numQueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    return found;
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+void JobSystem<Allocator>::ExecuteJob(
+    const Job& job)
+{
+    job.pfnJob(job.pData);
+
+    if ((job.pGroup != nullptr) && (job.pGroup->m_numPending.fetch_sub(1, std::memory_order_seq_cst) == 1))
+    {
+        WakeWaiters();
+    }
+}
+
+// =====================================================================================================================
+// Wakes one sleeping worker after a job was queued.  Submitters only pay for the semaphore if a worker is asleep.
+template <typename Allocator>
+void JobSystem<Allocator>::WakeWorkers()
+{
+    if (m_numSleeping.load(std::memory_order_seq_cst) > 0)
+    {
+        m_wakeSemaphore.Post();
+    }
+}
+
+// =====================================================================================================================
+// Wakes every thread sleeping in Wait() after a group finished or a job was queued.  Either may let a waiter make
+// progress, and the waiters have to recheck their own groups anyway.
+template <typename Allocator>
+void JobSystem<Allocator>::WakeWaiters()
+{
+    if (m_numWaitersAsleep.load(std::memory_order_seq_cst) > 0)
+    {
+        MutexAuto lock(&m_waiterLock);
+        m_waiterCondition.WakeAll();
+    }
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+void JobSystem<Allocator>::WorkerThreadFunc(
+    void* pParam)
+{
+    Worker*const    pSelf = static_cast<Worker*>(pParam);
+    JobSystem*const pThis = pSelf->pJobSystem;
+
+    SetThreadLocalValue(pThis->m_workerKey, pSelf);
+
+    while (true)
+    {
+        Job job;
+        if (pThis->TryGetJob(pSelf, &job))
+        {
+            pThis->ExecuteJob(job);
+        }
+        else if (pThis->m_shutdown.load(std::memory_order_acquire))
+        {
+            break;
+        }
+        else
+        {
+            // Announce that we're going to sleep before the final check for work.  Paired with the seq_cst accesses
+            // in Submit and WakeWorkers, either we see the new job or the submitter sees us and posts the semaphore.
+            pThis->m_numSleeping.fetch_add(1, std::memory_order_seq_cst);
+
+            if ((pThis->m_numQueuedJobs.load(std::memory_order_seq_cst) == 0) &&
+                (pThis->m_shutdown.load(std::memory_order_seq_cst) == false))
+            {
+                pThis->m_wakeSemaphore.Wait(UINT32_MAX);
+            }
+
+            pThis->m_numSleeping.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    SetThreadLocalValue(pThis->m_workerKey, nullptr);
+}
+
+} // Util
@@ -37,6 +37,28 @@
 namespace Util
 {
 
+/// Controls how a VirtualLinearAllocator backs its virtual address reservation with committed memory.
+struct VirtualLinearAllocatorPolicy
+{
+    size_t maxCommitAhead;    ///< Maximum number of bytes to commit beyond the end of the allocation which needed a
+                              ///  commit.  The commit-ahead size starts at one page and doubles after every commit
+                              ///  until it reaches this size.  Zero commits only the pages each allocation needs.
+    size_t decommitHighWater; ///< Number of bytes at the start of the reservation which stay committed when Rewind() is
+                              ///  asked to decommit.  Allocators which are rewound and refilled frequently can use this
+                              ///  to avoid decommitting and recommitting the same pages over and over.
+    bool   useHugePages;      ///< Asks the OS to back committed memory with huge pages.  Ignored for reservations
+                              ///  smaller than VirtualLinearAllocator::HugePageSize.
+};
+
+/// Counters describing the OS calls a VirtualLinearAllocator has made to manage its committed memory.
+struct VirtualLinearAllocatorStats
+{
+    uint32 commitCount;        ///< Number of times memory was committed.
+    uint32 decommitCount;      ///< Number of times memory was decommitted.
+    size_t committedBytes;     ///< Number of bytes currently committed.
+    size_t peakCommittedBytes; ///< Largest number of bytes committed at any one time.
+};
+
 /**
  ***********************************************************************************************************************
  * @brief A linear allocator that allocates virtual memory.
@@ -46,7 +68,8 @@ namespace Util
  * incrementally back it with real memory as necessary.
  *
  * As clients reach a steady state, allocations from this allocator will become "free," essentially just costing a
- * pointer increment.
+ * pointer increment.  The number of OS calls needed to reach that steady state can be reduced by committing memory
+ * ahead of the allocations which need it; see VirtualLinearAllocatorPolicy.
  *
  * This allocator can be used with any of the memory management macros. @see Allocators for more information about the
  * Allocation pattern.
@@ -55,15 +78,30 @@ namespace Util
 class VirtualLinearAllocator
 {
 public:
+    /// Reservations of at least this many bytes may be backed with huge pages.
+    static constexpr size_t HugePageSize = 2 * 1024 * 1024;
+
     /// Constructor.
     ///
     /// @param [in] size Maximum size, in bytes, of virtual memory that this allocator should reserve.
     ///                  Does not need to be aligned to page size.
     VirtualLinearAllocator(size_t size) :
+        VirtualLinearAllocator(size, VirtualLinearAllocatorPolicy{}) {}
+
+    /// Constructor.
+    ///
+    /// @param [in] size   Maximum size, in bytes, of virtual memory that this allocator should reserve.
+    ///                    Does not need to be aligned to page size.
+    /// @param [in] policy Controls how the reservation is backed with committed memory.
+    VirtualLinearAllocator(size_t size, const VirtualLinearAllocatorPolicy& policy) :
         m_pStart(nullptr),
         m_pCurrent(nullptr),
+        m_pCommittedToPage(nullptr),
         m_size(size),
-        m_pageSize(0) {}
+        m_pageSize(0),
+        m_policy(policy),
+        m_commitAhead(0),
+        m_stats() {}
 
     /// Destructor.
     virtual ~VirtualLinearAllocator()
@@ -84,17 +122,19 @@ public:
         m_pageSize = VirtualPageSize();
         m_size     = Pow2Align(m_size, m_pageSize);
 
-        Result result = VirtualReserve(m_size, &m_pStart);
+        m_policy.maxCommitAhead    = Pow2Align(m_policy.maxCommitAhead, m_pageSize);
+        m_policy.decommitHighWater = Pow2Align(m_policy.decommitHighWater, m_pageSize);
+        m_policy.useHugePages      = m_policy.useHugePages && (m_size >= HugePageSize);
+        m_commitAhead              = Min(m_pageSize, m_policy.maxCommitAhead);
 
-        if (result == Result::_Success)
-        {
-            result = VirtualCommit(m_pStart, m_pageSize);
-        }
+        Result result = VirtualReserve(m_size, &m_pStart);
 
         if (result == Result::_Success)
         {
             m_pCurrent         = m_pStart;
-            m_pCommittedToPage = VoidPtrInc(m_pCurrent, m_pageSize);
+            m_pCommittedToPage = m_pStart;
+
+            result = Commit(VoidPtrInc(m_pStart, m_pageSize));
         }
 
         return result;
@@ -111,26 +151,14 @@ public:
         void* pNextCurrent    = VoidPtrInc(pAlignedCurrent, allocInfo.bytes);
         void* pAlignedEnd     = VoidPtrAlign(pNextCurrent, m_pageSize);
 
-        if (pAlignedEnd > m_pCommittedToPage)
+        if ((pAlignedEnd <= m_pCommittedToPage) || (Commit(pAlignedEnd) == Result::_Success))
         {
-            const size_t commitBytes = VoidPtrDiff(pAlignedEnd, m_pCommittedToPage);
-
-            const Result result = VirtualCommit(m_pCommittedToPage, commitBytes);
-
-            if (result == Result::_Success)
-            {
-                m_pCommittedToPage = VoidPtrInc(m_pCommittedToPage, commitBytes);
-                m_pCurrent         = pNextCurrent;
-            }
-            else
-            {
-                // Return nullptr if allocation fails.
-                pAlignedCurrent = nullptr;
-            }
+            m_pCurrent = pNextCurrent;
         }
         else
         {
-            m_pCurrent = pNextCurrent;
+            // Return nullptr if allocation fails.
+            pAlignedCurrent = nullptr;
         }
 
         return pAlignedCurrent;
@@ -144,7 +172,8 @@ public:
     /// Rewinds the current pointer to the specified location to reuse already allocated memory.
     ///
     /// @param pStart   Where to reset the m_pCurrent to.
-    /// @param decommit If true, pages that are rewound are freed/decommitted.
+    /// @param decommit If true, pages that are rewound are freed/decommitted, except for those below the policy's
+    ///                 decommit high-water mark.
     void   Rewind(void* pStart, bool decommit)
     {
         PAL_ASSERT((m_pStart <= pStart) && (pStart <= m_pCurrent));
@@ -153,16 +182,28 @@ public:
         {
             if (decommit)
             {
-                void*        pStartPage   = VoidPtrAlign(VoidPtrInc(pStart, 1), m_pageSize);
-                void*        pCurrentPage = VoidPtrAlign(m_pCurrent, m_pageSize);
-                const size_t numPages     = VoidPtrDiff(pCurrentPage, pStartPage) / m_pageSize;
+                void* pStartPage = VoidPtrAlign(VoidPtrInc(pStart, 1), m_pageSize);
+                void* pHighWater = VoidPtrInc(m_pStart, m_policy.decommitHighWater);
+
+                if (pStartPage < pHighWater)
+                {
+                    pStartPage = pHighWater;
+                }
 
-                if (numPages > 0)
+                if (pStartPage < m_pCommittedToPage)
                 {
-                    Result result = VirtualDecommit(pStartPage, m_pageSize * numPages);
+                    const size_t decommitBytes = VoidPtrDiff(m_pCommittedToPage, pStartPage);
+
+                    Result result = VirtualDecommit(pStartPage, decommitBytes);
                     PAL_ASSERT(result == Result::_Success);
 
                     m_pCommittedToPage = pStartPage;
+
+                    m_stats.decommitCount++;
+                    m_stats.committedBytes -= decommitBytes;
+
+                    // Start growing the commit-ahead size from a single page again.
+                    m_commitAhead = Min(m_pageSize, m_policy.maxCommitAhead);
                 }
             }
 #if DEBUG
@@ -204,7 +245,46 @@ public:
     /// @returns The size of the remaining unallocated space in bytes.
     size_t Remaining() const { return m_size - VoidPtrDiff(m_pCurrent, m_pStart); }
 
+    /// Returns counters describing the OS calls this allocator has made to manage its committed memory.
+    ///
+    /// @returns This allocator's commit statistics.
+    const VirtualLinearAllocatorStats& Stats() const { return m_stats; }
+
 private:
+    // Commits enough memory to back everything up to pAlignedEnd, plus the current commit-ahead size.
+    Result Commit(void* pAlignedEnd)
+    {
+        void*const pReserveEnd = VoidPtrInc(m_pStart, m_size);
+
+        Result result = (pAlignedEnd <= pReserveEnd) ? Result::_Success : Result::ErrorOutOfMemory;
+
+        if (result == Result::_Success)
+        {
+            const size_t aheadBytes  = Min(m_commitAhead, VoidPtrDiff(pReserveEnd, pAlignedEnd));
+            const size_t commitBytes = VoidPtrDiff(pAlignedEnd, m_pCommittedToPage) + aheadBytes;
+
+            result = VirtualCommit(m_pCommittedToPage, commitBytes);
+
+            if (result == Result::_Success)
+            {
+                if (m_policy.useHugePages)
+                {
+                    // This is only a hint, the memory is still usable if the OS ignores it.
+                    VirtualAdviseHugePages(m_pCommittedToPage, commitBytes);
+                }
+
+                m_pCommittedToPage = VoidPtrInc(m_pCommittedToPage, commitBytes);
+                m_commitAhead      = Min(m_commitAhead * 2, m_policy.maxCommitAhead);
+
+                m_stats.commitCount++;
+                m_stats.committedBytes    += commitBytes;
+                m_stats.peakCommittedBytes = Max(m_stats.peakCommittedBytes, m_stats.committedBytes);
+            }
+        }
+
+        return result;
+    }
+
     void*  m_pStart;            ///< Pointer to where the backing allocation starts.
     void*  m_pCurrent;          ///< Pointer to the current position of backing memory.
     void*  m_pCommittedToPage;  ///< Pointer to the end of the last committed page.
@@ -212,6 +292,10 @@ private:
     size_t m_size;              ///< Size of the allocation.
     size_t m_pageSize;          ///< OS' defined page size.
 
+    VirtualLinearAllocatorPolicy m_policy;      ///< How the reservation is backed with committed memory.
+    size_t                       m_commitAhead; ///< Number of bytes the next commit will commit ahead.
+    VirtualLinearAllocatorStats  m_stats;       ///< Counters of the OS calls made by this allocator.
+
     PAL_DISALLOW_DEFAULT_CTOR(VirtualLinearAllocator);
     PAL_DISALLOW_COPY_AND_ASSIGN(VirtualLinearAllocator);
 };
@@ -324,6 +408,10 @@ public:
     /// Constructor.
     VirtualLinearAllocatorWithNode(size_t size) : VirtualLinearAllocator(size), m_node(this) {}
 
+    /// Constructor.
+    VirtualLinearAllocatorWithNode(size_t size, const VirtualLinearAllocatorPolicy& policy)
+        : VirtualLinearAllocator(size, policy), m_node(this) {}
+
     /// Destructor.
     virtual ~VirtualLinearAllocatorWithNode() {}
 
@@ -32,6 +32,7 @@
 #pragma once
 
 #include "palFile.h"
+#include "palHashMap.h"
 #include "palInlineFuncs.h"
 #include "palList.h"
 
@@ -50,7 +51,9 @@ namespace Util
  *        ; The following settings are pre-hashed.
  *        #0x9370a0c8, AnotherStringValue
  *
- *        After loading the file, a value can be retrieved by either specifying a setting string or hash value.
+ *        After loading the file, a value can be retrieved by either specifying a setting string or hash value.  The
+ *        parsed pairs are indexed by hash so each lookup is constant time regardless of the size of the file; when a
+ *        setting appears more than once, the first occurrence in the file wins.
  ***********************************************************************************************************************
  */
 template <typename Allocator>
@@ -64,7 +67,10 @@ public:
     SettingsFileMgr(const char* pSettingsFileName, Allocator*const pAllocator)
         :
         m_pSettingsFileName(pSettingsFileName),
-        m_settingsList(pAllocator)
+        m_settingsList(pAllocator),
+        m_settingsIndex(IndexBuckets, pAllocator),
+        m_indexInitialized(false),
+        m_pZeroHashValue(nullptr)
     {
     }
 
@@ -107,6 +113,9 @@ public:
     ///          type; false otherwise.
     bool GetValueByHash(uint32 hashedName, ValueType type, void* pValue, size_t bufferSz = 0) const;
 
+    /// Returns the number of distinct settings loaded from the settings file.
+    uint32 NumSettings() const { return m_settingsIndex.GetNumEntries() + ((m_pZeroHashValue != nullptr) ? 1 : 0); }
+
 private:
     // Describes a single { setting, value } pair as loaded from a settings file.
     struct SettingValuePair
@@ -121,6 +130,13 @@ private:
     // List of setting, value pairs parsed from the config file.
     List<SettingValuePair, Allocator> m_settingsList;
 
+    // Maps each setting name hash to the value string of its first occurrence in m_settingsList.  The hash map treats
+    // a key of zero as an empty slot, so a setting whose name happens to hash to zero is tracked separately.
+    static constexpr uint32 IndexBuckets = 64;
+    HashMap<uint32, const char*, Allocator> m_settingsIndex;
+    bool                                    m_indexInitialized;
+    const char*                             m_pZeroHashValue;
+
     PAL_DISALLOW_COPY_AND_ASSIGN(SettingsFileMgr);
 };
 
@@ -27,6 +27,7 @@
 
 #include "palSettingsFileMgr.h"
 #include "palDbgPrint.h"
+#include "palHashMapImpl.h"
 #include "palListImpl.h"
 #include <string.h>
 #include <ctype.h>
@@ -74,6 +75,12 @@ Result SettingsFileMgr<Allocator>::Init(
         ret = m_settingsFile.Open(&fileName[0], FileAccessRead);
     }
 
+    if ((ret == Result::Success) && (m_indexInitialized == false))
+    {
+        ret = m_settingsIndex.Init();
+        m_indexInitialized = (ret == Result::Success);
+    }
+
     if (ret == Result::Success)
     {
         // Read the settings file one line at a time
@@ -139,7 +146,27 @@ Result SettingsFileMgr<Allocator>::Init(
                             SettingValuePair pair = { hashedName, {0} };
                             PAL_ASSERT(strlen(pToken) < sizeof(pair.strValue));
                             strncpy(&pair.strValue[0], pToken, sizeof(pair.strValue));
-                            m_settingsList.PushBack(pair);
+
+                            if (m_settingsList.PushBack(pair) == Result::Success)
+                            {
+                                // Index the copy owned by the list.  Insert() leaves existing keys untouched, which
+                                // preserves the first-match-wins behavior of the original linear lookup.
+                                auto tail = m_settingsList.End();
+                                tail.Prev();
+                                const char* pStoredValue = &tail.Get()->strValue[0];
+
+                                if (hashedName == 0)
+                                {
+                                    if (m_pZeroHashValue == nullptr)
+                                    {
+                                        m_pZeroHashValue = pStoredValue;
+                                    }
+                                }
+                                else
+                                {
+                                    m_settingsIndex.Insert(hashedName, pStoredValue);
+                                }
+                            }
                         }
                     }
                 }
@@ -189,17 +216,19 @@ bool SettingsFileMgr<Allocator>::GetValueByHash(
 {
     bool foundValue = false;
 
-    // Get the value from the list
-    auto iterator = m_settingsList.Begin();
+    // Look the value up in the hash index built by Init().
     const char* pSettingValue = nullptr;
-    while(iterator.Get() != nullptr)
+    if (hashedName == 0)
+    {
+        pSettingValue = m_pZeroHashValue;
+    }
+    else if (m_indexInitialized)
     {
-        if (iterator.Get()->hashName == hashedName)
+        const char*const* ppValue = m_settingsIndex.FindKey(hashedName);
+        if (ppValue != nullptr)
         {
-            pSettingValue = &iterator.Get()->strValue[0];
-            break;
+            pSettingValue = *ppValue;
         }
-        iterator.Next();
     }
 
     if(pSettingValue != nullptr)
@@ -578,6 +578,22 @@ extern Result VirtualCommit(void* pMem, size_t sizeInBytes, bool isExecutable =
 ///             - ErrorInvalidPointer if pMem is null.
 extern Result VirtualDecommit(void* pMem, size_t sizeInBytes);
 
+/// Hints to the OS that the specified committed virtual address range should be backed by huge pages if possible.
+///
+/// @note    The hint only affects the pages which are committed when this function is called.
+///
+/// @param [in]  pMem        Pointer to the start of committed memory. Must be aligned to the page size returned from
+///                          @ref Util::VirtualPageSize();
+/// @param [in]  sizeInBytes Size in bytes of the range to advise. Must be aligned to the page size returned from
+///                          @ref Util::VirtualPageSize();
+///
+/// @returns Success if the OS accepted the hint.
+///          Otherwise:
+///             - Unsupported if the OS does not support huge page backing.
+///             - ErrorInvalidValue if sizeInBytes is zero.
+///             - ErrorInvalidPointer if pMem is null.
+extern Result VirtualAdviseHugePages(void* pMem, size_t sizeInBytes);
+
 /// Releases the specified amount of virtual address space, both freeing the backing memory and virtual address space
 /// back to the OS.
 ///
@@ -89,6 +89,14 @@ public:
     /// Returns true if the thread was created successfully
     bool IsCreated() const;
 
+    /// Restricts this object's thread to run only on the logical processors whose bits are set in affinityMask.
+    ///
+    /// @param [in] affinityMask Bit N selects logical processor N.  Must be non-zero.
+    ///
+    /// @returns @ref Success if the affinity was changed, @ref ErrorUnavailable if this object does not represent a
+    ///          thread, or @ref ErrorUnknown if the OS rejected the mask.
+    Result SetAffinityMask(uint64 affinityMask);
+
 private:
     // Our platforms' internal start functions all return different types so we can't directly launch our client's
     // StartFunction. We must bootstrap each thread using an internal function which then calls the client's function.
@@ -431,6 +431,7 @@ namespace DevDriver
     {
         Local = 0,
         Remote,
+        SharedMemory, // Shared memory rings to a host on the same machine, hostname names the segment
     };
 
     // Struct used to designate a transport type, port number, and hostname
@@ -468,6 +469,14 @@ namespace DevDriver
 
     };
 
+    // Default shared memory segment information
+    DD_STATIC_CONST HostInfo kDefaultSharedMemHost =
+    {
+        TransportType::SharedMemory,
+        0,
+        "AMD-Developer-Service-Shm"
+    };
+
     ////////////////////////////
     // Common definition of a message header
     //
@@ -48,6 +48,28 @@ namespace DevDriver
         virtual Result WriteMessage(const MessageBuffer &messageBuffer) = 0;
         virtual Result ReadMessage(MessageBuffer &messageBuffer, uint32 timeoutInMs) = 0;
 
+        // Write several messages at once. pNumWritten receives the number of messages that were written before the
+        // first failure. Transports that can't batch their writes just write the messages one by one.
+        virtual Result WriteMessages(const MessageBuffer* pMessages, uint32 messageCount, uint32* pNumWritten)
+        {
+            Result result = Result::Success;
+            uint32 numWritten = 0;
+
+            while ((result == Result::Success) && (numWritten < messageCount))
+            {
+                result = WriteMessage(pMessages[numWritten]);
+
+                if (result == Result::Success)
+                {
+                    ++numWritten;
+                }
+            }
+
+            *pNumWritten = numWritten;
+
+            return result;
+        }
+
         // Get a human-readable string describing the connection type.
         virtual const char* GetTransportName() const = 0;
 
@@ -69,6 +91,18 @@ namespace DevDriver
         {
             return false;
         }
+
+        // Static method to be implemented by individual transports
+        // true indicates that WriteMessages is cheaper than individual WriteMessage calls, so the MessageChannel
+        //   should queue up outgoing messages while it's processing and write them out together
+        // false indicates that messages should be written as soon as they are sent
+        DD_STATIC_CONST bool SupportsBatchedWrites()
+        {
+            return false;
+        }
+
+        // Maximum number of messages the MessageChannel should queue up for a single WriteMessages call
+        DD_STATIC_CONST uint32 kMaxWriteBatchSize = 16;
     protected:
         IMsgTransport() {}
     };
@@ -0,0 +1,553 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+***********************************************************************************************************************
+* @file  ddSharedMemMsgTransport.cpp
+* @brief Class definition for SharedMemMsgTransport
+***********************************************************************************************************************
+*/
+
+#include "ddSharedMemMsgTransport.h"
+
+#include <fcntl.h>
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace DevDriver
+{
+    using namespace SharedMemTransport;
+
+    // Builds the POSIX shared memory object name for a host. Object names must start with a single slash and must
+    // not contain any other ones.
+    static void GetSegmentName(const HostInfo& hostInfo, char (&name)[kMaxStringLength + 1])
+    {
+        name[0] = '/';
+        Platform::Strncpy(&name[1], hostInfo.hostname, kMaxStringLength);
+
+        for (char* pChar = &name[1]; *pChar != '\0'; ++pChar)
+        {
+            if ((*pChar == '/') || (*pChar == '\\'))
+            {
+                *pChar = '_';
+            }
+        }
+    }
+
+    // Maps the segment created by the host. The segment stays mapped after the file descriptor is closed.
+    static Result OpenSegment(const HostInfo& hostInfo, Segment** ppSegment)
+    {
+        char name[kMaxStringLength + 1] = {};
+        GetSegmentName(hostInfo, name);
+
+        Result result = Result::Unavailable;
+
+        const int fd = shm_open(name, O_RDWR, 0);
+        if (fd != -1)
+        {
+            struct stat info = {};
+            if ((fstat(fd, &info) == 0) && (static_cast<size_t>(info.st_size) >= sizeof(Segment)))
+            {
+                void* pMemory = mmap(nullptr, sizeof(Segment), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                if (pMemory != MAP_FAILED)
+                {
+                    Segment* pSegment = static_cast<Segment*>(pMemory);
+                    if ((pSegment->magic == kSegmentMagic) && (pSegment->version == kSegmentVersion))
+                    {
+                        *ppSegment = pSegment;
+                        result     = Result::Success;
+                    }
+                    else
+                    {
+                        munmap(pMemory, sizeof(Segment));
+                        result = Result::VersionMismatch;
+                    }
+                }
+            }
+            close(fd);
+        }
+
+        return result;
+    }
+
+    // Sleeps until the futex word no longer holds the expected value, we are woken up, or the timeout elapses.
+    static void FutexWait(std::atomic<uint32>* pWord, uint32 expected, uint32 timeoutInMs)
+    {
+        const timespec timeout = { static_cast<time_t>(timeoutInMs / 1000),
+                                   static_cast<long>((timeoutInMs % 1000) * 1000000) };
+
+        // The segment is shared between processes, so the private futex operations can't be used here.
+        syscall(SYS_futex, reinterpret_cast<uint32*>(pWord), FUTEX_WAIT, expected, &timeout, nullptr, 0);
+    }
+
+    // Signals a wakeup word. This only costs a syscall if the other side is actually waiting on it.
+    static void Wake(WakeupWord* pWord)
+    {
+        pWord->sequence.fetch_add(1);
+
+        if (pWord->waiters.load() != 0)
+        {
+            syscall(SYS_futex, reinterpret_cast<uint32*>(&pWord->sequence), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+        }
+    }
+
+    // Waits on a wakeup word until isDone() returns true or the timeout elapses. Returns the final value of isDone().
+    template <typename Predicate>
+    static bool WaitUntil(WakeupWord* pWord, uint32 timeoutInMs, Predicate isDone)
+    {
+        bool done = isDone();
+
+        if ((done == false) && (timeoutInMs > 0))
+        {
+            const uint64 deadline = Platform::GetCurrentTimeInMs() + timeoutInMs;
+
+            // Announce ourselves before sampling the sequence so that the other side can't miss us: it bumps the
+            // sequence before checking for waiters.
+            pWord->waiters.fetch_add(1);
+
+            while (done == false)
+            {
+                const uint32 sequence = pWord->sequence.load();
+
+                done = isDone();
+
+                const uint64 currentTime = Platform::GetCurrentTimeInMs();
+                if ((done == false) && (currentTime < deadline))
+                {
+                    FutexWait(&pWord->sequence, sequence, static_cast<uint32>(deadline - currentTime));
+                }
+                else
+                {
+                    break;
+                }
+            }
+
+            pWord->waiters.fetch_sub(1);
+        }
+
+        return done;
+    }
+
+    // Copies data into the ring at the given free running offset, wrapping around the end of the ring as needed.
+    static void CopyToRing(Ring* pRing, uint32 offset, const void* pSrc, uint32 size)
+    {
+        const uint32 start     = (offset & (kRingSizeInBytes - 1));
+        const uint32 firstSize = Platform::Min(size, kRingSizeInBytes - start);
+
+        memcpy(&pRing->data[start], pSrc, firstSize);
+        memcpy(&pRing->data[0], VoidPtrInc(pSrc, firstSize), size - firstSize);
+    }
+
+    // Copies data out of the ring at the given free running offset, wrapping around the end of the ring as needed.
+    static void CopyFromRing(const Ring* pRing, uint32 offset, void* pDst, uint32 size)
+    {
+        const uint32 start     = (offset & (kRingSizeInBytes - 1));
+        const uint32 firstSize = Platform::Min(size, kRingSizeInBytes - start);
+
+        memcpy(pDst, &pRing->data[start], firstSize);
+        memcpy(VoidPtrInc(pDst, firstSize), &pRing->data[0], size - firstSize);
+    }
+
+    // Reads the next record out of a ring, waiting up to timeoutInMs for one to arrive.
+    static Result ReadRecord(Ring* pRing, MessageBuffer* pMessageBuffer, uint32 timeoutInMs)
+    {
+        const uint32 readOffset = pRing->readOffset.load(std::memory_order_relaxed);
+
+        const auto hasData = [pRing, readOffset]() -> bool
+        {
+            return (pRing->writeOffset.load(std::memory_order_acquire) != readOffset);
+        };
+
+        Result result = Result::NotReady;
+
+        if (WaitUntil(&pRing->dataReady, timeoutInMs, hasData))
+        {
+            uint32 recordSize = 0;
+            CopyFromRing(pRing, readOffset, &recordSize, sizeof(recordSize));
+
+            const uint32 messageSize = Platform::Min(recordSize, static_cast<uint32>(sizeof(MessageBuffer)));
+            DD_ASSERT(messageSize == recordSize);
+
+            CopyFromRing(pRing, readOffset + sizeof(recordSize), pMessageBuffer, messageSize);
+
+            const uint32 totalSize = Platform::Pow2Align(static_cast<uint32>(sizeof(recordSize)) + recordSize,
+                                                         kRecordAlignment);
+            pRing->readOffset.store(readOffset + totalSize, std::memory_order_release);
+            Wake(&pRing->spaceReady);
+
+            result = Result::Success;
+        }
+
+        return result;
+    }
+
+    // Writes a record into a ring, waiting up to timeoutInMs for the reader to free enough space for it.
+    static Result WriteRecord(Ring* pRing, const MessageBuffer& messageBuffer, uint32 timeoutInMs)
+    {
+        const uint32 messageSize = static_cast<uint32>(sizeof(MessageHeader) + messageBuffer.header.payloadSize);
+        const uint32 totalSize   = Platform::Pow2Align(static_cast<uint32>(sizeof(messageSize)) + messageSize,
+                                                       kRecordAlignment);
+        const uint32 writeOffset = pRing->writeOffset.load(std::memory_order_relaxed);
+
+        const auto hasSpace = [pRing, writeOffset, totalSize]() -> bool
+        {
+            const uint32 usedSize = writeOffset - pRing->readOffset.load(std::memory_order_acquire);
+            return ((kRingSizeInBytes - usedSize) >= totalSize);
+        };
+
+        Result result = Result::NotReady;
+
+        if (WaitUntil(&pRing->spaceReady, timeoutInMs, hasSpace))
+        {
+            CopyToRing(pRing, writeOffset, &messageSize, sizeof(messageSize));
+            CopyToRing(pRing, writeOffset + sizeof(messageSize), &messageBuffer, messageSize);
+
+            pRing->writeOffset.store(writeOffset + totalSize, std::memory_order_release);
+            Wake(&pRing->dataReady);
+
+            result = Result::Success;
+        }
+
+        return result;
+    }
+
+    // Empties a ring. Only safe while no client is attached to the segment.
+    static void ResetRing(Ring* pRing)
+    {
+        pRing->writeOffset.store(0);
+        pRing->readOffset.store(0);
+
+        // A client that went away while it was waiting never got to withdraw itself as a waiter.
+        pRing->dataReady.waiters.store(0);
+        pRing->spaceReady.waiters.store(0);
+    }
+
+    SharedMemMsgTransport::SharedMemMsgTransport(const HostInfo& hostInfo) :
+        m_pSegment(nullptr),
+        m_connected(false),
+        m_hostInfo(hostInfo)
+    {
+        DD_ASSERT(hostInfo.type == TransportType::SharedMemory);
+    }
+
+    SharedMemMsgTransport::~SharedMemMsgTransport()
+    {
+        Disconnect();
+    }
+
+    Result SharedMemMsgTransport::Connect(ClientId* pClientId, uint32 timeoutInMs)
+    {
+        DD_UNUSED(timeoutInMs);
+        DD_UNUSED(pClientId);
+
+        Result result = Result::Error;
+
+        if (!m_connected)
+        {
+            result = OpenSegment(m_hostInfo, &m_pSegment);
+
+            if (result == Result::Success)
+            {
+                // Only one client may own a segment at a time.
+                SegmentState expected = SegmentState::Listening;
+                if (m_pSegment->state.compare_exchange_strong(expected, SegmentState::Connected))
+                {
+                    // The host waits for clients on the client to host data wakeup.
+                    Wake(&m_pSegment->clientToHost.dataReady);
+                }
+                else
+                {
+                    munmap(m_pSegment, sizeof(Segment));
+                    m_pSegment = nullptr;
+                    result     = Result::Unavailable;
+                }
+            }
+
+            m_connected = (result == Result::Success);
+        }
+
+        return result;
+    }
+
+    Result SharedMemMsgTransport::Disconnect()
+    {
+        Result result = Result::Error;
+
+        if (m_connected)
+        {
+            m_connected = false;
+
+            // Let the host know that we're gone, waking it up in case it's waiting for data. If the host already
+            // gave up on us and recycled the segment, it may belong to the next client by now, so leave it alone.
+            SegmentState expected = SegmentState::Connected;
+            if (m_pSegment->state.compare_exchange_strong(expected, SegmentState::Closed) == false)
+            {
+                expected = SegmentState::Dropped;
+                m_pSegment->state.compare_exchange_strong(expected, SegmentState::Closed);
+            }
+            Wake(&m_pSegment->clientToHost.dataReady);
+
+            result = (munmap(m_pSegment, sizeof(Segment)) == 0) ? Result::Success : Result::Error;
+            m_pSegment = nullptr;
+        }
+
+        return result;
+    }
+
+    Result SharedMemMsgTransport::ReadMessage(MessageBuffer& messageBuffer, uint32 timeoutInMs)
+    {
+        Result result = Result::Error;
+
+        // The host drops a client by moving the segment out of the connected state.
+        if (m_connected && (m_pSegment->state.load() == SegmentState::Connected))
+        {
+            result = ReadRecord(&m_pSegment->hostToClient, &messageBuffer, timeoutInMs);
+        }
+
+        return result;
+    }
+
+    Result SharedMemMsgTransport::WriteMessage(const MessageBuffer& messageBuffer)
+    {
+        DD_ASSERT(m_connected);
+
+        Result result = Result::Error;
+
+        if (m_pSegment->state.load() == SegmentState::Connected)
+        {
+            // If the host isn't draining the ring fast enough, give it a short amount of time before giving up.
+            result = WriteRecord(&m_pSegment->clientToHost, messageBuffer, kTransmitTimeoutInMs);
+        }
+
+        return result;
+    }
+
+    // ================================================================================================================
+    // Tests to see if a host is listening on the segment named by hostInfo
+    Result SharedMemMsgTransport::TestConnection(const HostInfo& hostInfo, uint32 timeoutInMs)
+    {
+        DD_UNUSED(timeoutInMs);
+
+        Segment* pSegment = nullptr;
+        Result   result   = OpenSegment(hostInfo, &pSegment);
+
+        if (result == Result::Success)
+        {
+            result = (pSegment->state.load() == SegmentState::Listening) ? Result::Success : Result::Unavailable;
+            munmap(pSegment, sizeof(Segment));
+        }
+
+        return result;
+    }
+
+    SharedMemMsgHost::SharedMemMsgHost(const HostInfo& hostInfo) :
+        m_pSegment(nullptr),
+        m_hostInfo(hostInfo)
+    {
+        DD_ASSERT(hostInfo.type == TransportType::SharedMemory);
+    }
+
+    SharedMemMsgHost::~SharedMemMsgHost()
+    {
+        Close();
+    }
+
+    // ================================================================================================================
+    // Creates the segment named by the host info and puts it in the listening state
+    Result SharedMemMsgHost::Listen()
+    {
+        Result result = Result::Error;
+
+        if (m_pSegment == nullptr)
+        {
+            char name[kMaxStringLength + 1] = {};
+            GetSegmentName(m_hostInfo, name);
+
+            // As a precaution, remove any segment left behind by a host that didn't shut down cleanly.
+            shm_unlink(name);
+
+            const int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+            if (fd != -1)
+            {
+                if (ftruncate(fd, sizeof(Segment)) == 0)
+                {
+                    // A new shared memory object is zero filled, which is a valid empty state for every ring.
+                    void* pMemory = mmap(nullptr, sizeof(Segment), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                    if (pMemory != MAP_FAILED)
+                    {
+                        m_pSegment = static_cast<Segment*>(pMemory);
+
+                        m_pSegment->magic   = kSegmentMagic;
+                        m_pSegment->version = kSegmentVersion;
+
+                        // Publishing the state last makes the segment visible to clients.
+                        m_pSegment->state.store(SegmentState::Listening);
+
+                        result = Result::Success;
+                    }
+                }
+
+                close(fd);
+
+                if (result != Result::Success)
+                {
+                    shm_unlink(name);
+                }
+            }
+        }
+
+        return result;
+    }
+
+    // ================================================================================================================
+    // Removes the segment so that no new client can find it and drops the current one
+    void SharedMemMsgHost::Close()
+    {
+        if (m_pSegment != nullptr)
+        {
+            char name[kMaxStringLength + 1] = {};
+            GetSegmentName(m_hostInfo, name);
+
+            shm_unlink(name);
+
+            // Existing mappings stay valid after the unlink, so a connected client only sees the state change.
+            m_pSegment->state.store(SegmentState::Dropped);
+            Wake(&m_pSegment->hostToClient.dataReady);
+            Wake(&m_pSegment->clientToHost.spaceReady);
+
+            munmap(m_pSegment, sizeof(Segment));
+            m_pSegment = nullptr;
+        }
+    }
+
+    // ================================================================================================================
+    // Empties both rings and puts the segment back in the listening state
+    void SharedMemMsgHost::ResetSegment()
+    {
+        ResetRing(&m_pSegment->clientToHost);
+        ResetRing(&m_pSegment->hostToClient);
+
+        m_pSegment->state.store(SegmentState::Listening);
+    }
+
+    // ================================================================================================================
+    // Waits for a client to claim the segment
+    Result SharedMemMsgHost::WaitForClient(uint32 timeoutInMs)
+    {
+        Result result = Result::Error;
+
+        if (m_pSegment != nullptr)
+        {
+            // The previous client detached on its own, so the segment can be recycled right away.
+            if (m_pSegment->state.load() == SegmentState::Closed)
+            {
+                ResetSegment();
+            }
+
+            Segment*const pSegment = m_pSegment;
+
+            const auto hasClient = [pSegment]() -> bool
+            {
+                return (pSegment->state.load() != SegmentState::Listening);
+            };
+
+            // Clients wake the client to host data wakeup when they claim the segment.
+            if (WaitUntil(&m_pSegment->clientToHost.dataReady, timeoutInMs, hasClient))
+            {
+                result = (m_pSegment->state.load() == SegmentState::Connected) ? Result::Success : Result::NotReady;
+            }
+            else
+            {
+                result = Result::NotReady;
+            }
+        }
+
+        return result;
+    }
+
+    // ================================================================================================================
+    // Drops the connected client, giving it a short amount of time to detach before the rings are reset
+    Result SharedMemMsgHost::DropClient()
+    {
+        Result result = Result::Error;
+
+        if (m_pSegment != nullptr)
+        {
+            SegmentState expected = SegmentState::Connected;
+            if (m_pSegment->state.compare_exchange_strong(expected, SegmentState::Dropped))
+            {
+                // Wake the client up in case it's blocked on us.
+                Wake(&m_pSegment->hostToClient.dataReady);
+                Wake(&m_pSegment->clientToHost.spaceReady);
+
+                Segment*const pSegment = m_pSegment;
+
+                const auto hasDetached = [pSegment]() -> bool
+                {
+                    return (pSegment->state.load() == SegmentState::Closed);
+                };
+
+                // A client that crashed will never detach, so only wait for a bounded amount of time.
+                WaitUntil(&m_pSegment->clientToHost.dataReady, kDropTimeoutInMs, hasDetached);
+            }
+
+            ResetSegment();
+
+            result = Result::Success;
+        }
+
+        return result;
+    }
+
+    Result SharedMemMsgHost::ReadMessage(MessageBuffer& messageBuffer, uint32 timeoutInMs)
+    {
+        Result result = Result::Error;
+
+        // A client that detached can't send anything else.
+        if (IsClientConnected())
+        {
+            result = ReadRecord(&m_pSegment->clientToHost, &messageBuffer, timeoutInMs);
+        }
+
+        return result;
+    }
+
+    Result SharedMemMsgHost::WriteMessage(const MessageBuffer& messageBuffer)
+    {
+        Result result = Result::Error;
+
+        if (IsClientConnected())
+        {
+            // If the client isn't draining the ring fast enough, give it a short amount of time before giving up.
+            result = WriteRecord(&m_pSegment->hostToClient, messageBuffer, kTransmitTimeoutInMs);
+        }
+
+        return result;
+    }
+} // DevDriver
@@ -0,0 +1,172 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+***********************************************************************************************************************
+* @file  ddSharedMemMsgTransport.h
+* @brief Class declaration for SharedMemMsgTransport
+***********************************************************************************************************************
+*/
+
+#pragma once
+
+#include "msgTransport.h"
+#include "ddPlatform.h"
+
+#include <atomic>
+
+namespace DevDriver
+{
+    // Layout of the shared memory segment used by SharedMemMsgTransport.
+    //
+    // The segment is created by the local host (the router or tool, see SharedMemMsgHost) under the name given in
+    // HostInfo::hostname and contains one single-producer/single-consumer byte ring per direction. Each record in a
+    // ring is a uint32 byte count followed by a MessageBuffer truncated to its header + payload size, padded to
+    // kRecordAlignment.
+    // Ring offsets are free running and only ever advanced by their owner, so no locks are needed. A side that has to
+    // wait for data or space sleeps on a futex and is only woken by its peer if it announced itself as a waiter.
+    namespace SharedMemTransport
+    {
+        DD_STATIC_CONST uint32 kSegmentMagic    = 0x4D485344; // 'DSHM'
+        DD_STATIC_CONST uint32 kSegmentVersion  = 1;
+        DD_STATIC_CONST uint32 kRingSizeInBytes = 256 * 1024;
+        DD_STATIC_CONST uint32 kRecordAlignment = 8;
+
+        static_assert((kRingSizeInBytes & (kRingSizeInBytes - 1)) == 0, "Ring size must be a power of two");
+
+        // Connection state of the segment.
+        enum struct SegmentState : uint32
+        {
+            Listening = 0, // The host is waiting for a client to attach.
+            Connected,     // A client has claimed the segment.
+            Dropped,       // The host has dropped the client and is waiting for it to detach.
+            Closed,        // The client has detached; the host must reset the rings before listening again.
+        };
+
+        // Futex-backed wakeup word. The sequence is bumped for every wakeup and is what waiters sleep on.
+        struct WakeupWord
+        {
+            std::atomic<uint32> sequence;
+            std::atomic<uint32> waiters;
+        };
+
+        struct alignas(DD_CACHE_LINE_BYTES) Ring
+        {
+            alignas(DD_CACHE_LINE_BYTES) std::atomic<uint32> writeOffset; // Only written by the producer.
+            alignas(DD_CACHE_LINE_BYTES) std::atomic<uint32> readOffset;  // Only written by the consumer.
+            alignas(DD_CACHE_LINE_BYTES) WakeupWord          dataReady;   // Consumer waits here for new records.
+            alignas(DD_CACHE_LINE_BYTES) WakeupWord          spaceReady;  // Producer waits here for free space.
+            alignas(DD_CACHE_LINE_BYTES) uint8               data[kRingSizeInBytes];
+        };
+
+        struct Segment
+        {
+            uint32                    magic;
+            uint32                    version;
+            std::atomic<SegmentState> state;
+            Ring                      clientToHost;
+            Ring                      hostToClient;
+        };
+
+        static_assert(ATOMIC_INT_LOCK_FREE == 2, "Shared memory atomics must be lock free");
+    }
+
+    // Message transport for tools on the same machine. Messages are exchanged through a pair of rings in a shared
+    // memory segment, so a message only costs a syscall when the other side is actually asleep.
+    class SharedMemMsgTransport : public IMsgTransport
+    {
+    public:
+        explicit SharedMemMsgTransport(const HostInfo& hostInfo);
+        ~SharedMemMsgTransport();
+
+        Result Connect(ClientId* pClientId, uint32 timeoutInMs) override;
+        Result Disconnect() override;
+
+        Result ReadMessage(MessageBuffer& messageBuffer, uint32 timeoutInMs) override;
+        Result WriteMessage(const MessageBuffer& messageBuffer) override;
+
+        const char* GetTransportName() const override
+        {
+            return "Shared Memory";
+        }
+
+        static Result TestConnection(const HostInfo& hostInfo, uint32 timeoutInMs);
+
+        // A crashed host can't be detected through the segment, so rely on the message channel's keep alive.
+        DD_STATIC_CONST bool RequiresKeepAlive()
+        {
+            return true;
+        }
+
+        DD_STATIC_CONST bool RequiresClientRegistration()
+        {
+            return true;
+        }
+
+    private:
+        SharedMemTransport::Segment* m_pSegment;
+        bool                         m_connected;
+        const HostInfo               m_hostInfo;
+
+        DD_STATIC_CONST uint32 kTransmitTimeoutInMs = 50;
+    };
+
+    // Host side of the shared memory transport, used by the local router or tool that clients connect to. The host
+    // owns the segment, serves one client at a time and exchanges messages over the opposite ends of the rings.
+    class SharedMemMsgHost
+    {
+    public:
+        explicit SharedMemMsgHost(const HostInfo& hostInfo);
+        ~SharedMemMsgHost();
+
+        // Creates the segment and starts listening for a client.
+        Result Listen();
+        // Removes the segment. A connected client sees its reads fail and disconnects.
+        void Close();
+
+        // Waits for a client to claim the segment. Recycles the segment first if the previous client has detached.
+        Result WaitForClient(uint32 timeoutInMs);
+        // Drops the connected client and makes the segment available to the next one.
+        Result DropClient();
+
+        bool IsClientConnected() const
+        {
+            return (m_pSegment != nullptr) &&
+                   (m_pSegment->state.load() == SharedMemTransport::SegmentState::Connected);
+        }
+
+        Result ReadMessage(MessageBuffer& messageBuffer, uint32 timeoutInMs);
+        Result WriteMessage(const MessageBuffer& messageBuffer);
+
+    private:
+        void ResetSegment();
+
+        SharedMemTransport::Segment* m_pSegment;
+        const HostInfo               m_hostInfo;
+
+        DD_STATIC_CONST uint32 kTransmitTimeoutInMs = 50;
+        DD_STATIC_CONST uint32 kDropTimeoutInMs     = 100;
+    };
+
+} // DevDriver
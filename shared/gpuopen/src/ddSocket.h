@@ -87,6 +87,21 @@ namespace DevDriver
 
         Result ReceiveFrom(void *pSockAddr, size_t *addrSize, uint8* pBuffer, size_t bufferSize);
 
+        /// Sends up to kMaxBatchSize datagrams on a connected socket with a single call. Stops at the first datagram
+        /// that could not be sent; pNumSent receives the number of datagrams that were sent.
+        Result SendBatch(const uint8* const* ppData, const size_t* pDataSizes, uint32 count, uint32* pNumSent);
+
+        /// Receives up to kMaxBatchSize datagrams from a connected socket with a single call. Datagram i is written to
+        /// pBuffers + (i * bufferSize) and its size to pBytesReceived[i]; pNumReceived receives the datagram count.
+        Result ReceiveBatch(uint8*  pBuffers,
+                            size_t  bufferSize,
+                            uint32  count,
+                            size_t* pBytesReceived,
+                            uint32* pNumReceived);
+
+        // Maximum number of datagrams moved by one SendBatch() or ReceiveBatch() call.
+        DD_STATIC_CONST uint32 kMaxBatchSize = 16;
+
         Result Close();
 
         Result GetSocketName(char *pAddress, size_t addrLen, uint32 *pPort);
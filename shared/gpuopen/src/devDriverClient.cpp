@@ -33,6 +33,7 @@
 #include "messageChannel.h"
 #include "protocolClient.h"
 #include "socketMsgTransport.h"
+#include "ddSharedMemMsgTransport.h"
 #include "protocols/loggingClient.h"
 #include "protocols/settingsClient.h"
 #include "protocols/driverControlClient.h"
@@ -66,6 +67,13 @@ namespace DevDriver
                                                                 m_createInfo,
                                                                 m_createInfo.connectionInfo);
         }
+        else if (m_createInfo.connectionInfo.type == TransportType::SharedMemory)
+        {
+            using MsgChannelSharedMem = MessageChannel<SharedMemMsgTransport>;
+            m_pMsgChannel = DD_NEW(MsgChannelSharedMem, m_allocCb)(m_allocCb,
+                                                                   m_createInfo,
+                                                                   m_createInfo.connectionInfo);
+        }
         else
         {
             // Invalid transport type
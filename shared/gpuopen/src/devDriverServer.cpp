@@ -43,6 +43,7 @@
 #include "protocols/typemap.h"
 
     #include "socketMsgTransport.h"
+    #include "ddSharedMemMsgTransport.h"
 
 namespace DevDriver
 {
@@ -72,6 +73,13 @@ namespace DevDriver
                                                                 m_createInfo,
                                                                 m_createInfo.connectionInfo);
         }
+        else if (m_createInfo.connectionInfo.type == TransportType::SharedMemory)
+        {
+            using MsgChannelSharedMem = MessageChannel<SharedMemMsgTransport>;
+            m_pMsgChannel = DD_NEW(MsgChannelSharedMem, m_allocCb)(m_allocCb,
+                                                                   m_createInfo,
+                                                                   m_createInfo.connectionInfo);
+        }
         else
         {
             // Invalid transport type
@@ -358,6 +366,10 @@ namespace DevDriver
                 // On non windows platforms we try to use an AF_UNIX socket for communication
                 result = SocketMsgTransport::TestConnection(hostInfo, timeout);
                 break;
+            case TransportType::SharedMemory:
+                // Same-host tools can also expose a shared memory segment to avoid a syscall per message
+                result = SharedMemMsgTransport::TestConnection(hostInfo, timeout);
+                break;
             default:
                 // Invalid value passed to the function
                 DD_WARN_REASON("Invalid transport type specified");
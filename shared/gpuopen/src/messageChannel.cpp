@@ -38,6 +38,10 @@
     #include "socketMsgTransport.h"
 #endif
 
+#if defined(DD_PLATFORM_LINUX_UM)
+    #include "ddSharedMemMsgTransport.h"
+#endif
+
 namespace DevDriver
 {
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -54,6 +58,12 @@ namespace DevDriver
             result = SocketMsgTransport::TestConnection(hostInfo, timeoutInMs);
 #endif
         }
+#endif
+#if defined(DD_PLATFORM_LINUX_UM)
+        else if (hostInfo.type == TransportType::SharedMemory)
+        {
+            result = SharedMemMsgTransport::TestConnection(hostInfo, timeoutInMs);
+        }
 #endif
         else
         {
@@ -91,6 +101,15 @@ namespace DevDriver
                     createInfo.hostInfo);
 #endif
             }
+#endif
+#if defined(DD_PLATFORM_LINUX_UM)
+            else if (createInfo.hostInfo.type == TransportType::SharedMemory)
+            {
+                using MsgChannelSharedMem = MessageChannel<SharedMemMsgTransport>;
+                pMsgChannel = DD_NEW(MsgChannelSharedMem, createInfo.allocCb)(createInfo.allocCb,
+                    createInfo.channelInfo,
+                    createInfo.hostInfo);
+            }
 #endif
             else
             {
@@ -156,6 +156,24 @@ namespace DevDriver
                 , active(false) {}
         };
 
+        // Outgoing messages that are queued up while the message thread is processing so they can be written to the
+        // transport with a single WriteMessages call. Only transports that support batched writes use more than one
+        // entry.
+        struct SendQueue
+        {
+            static constexpr uint32 kCapacity =
+                MsgTransport::SupportsBatchedWrites() ? MsgTransport::kMaxWriteBatchSize : 1;
+
+            MessageBuffer   messages[kCapacity];
+            uint32          count;
+            bool            active;
+            Platform::Mutex lock;
+
+            SendQueue()
+                : count(0)
+                , active(false) {}
+        };
+
         Result CreateMsgThread();
         void DestroyMsgThread();
 
@@ -164,6 +182,19 @@ namespace DevDriver
 
         Result SendSystem(ClientId dstClientId, SystemProtocol::SystemMessage message, const ClientMetadata& metadata);
 
+        void BeginSendBatch();
+        Result EndSendBatch();
+        Result QueueTransportMessage(const MessageBuffer& messageBuffer);
+        Result FlushSendQueue();
+
+        // Copies the header and payload of a message, skipping the unused part of the payload buffer.
+        static void CopyMessage(const MessageBuffer& src, MessageBuffer* pDst)
+        {
+            const size_t messageSize = Platform::Min(sizeof(MessageHeader) + src.header.payloadSize,
+                                                     sizeof(MessageBuffer));
+            memcpy(pDst, &src, messageSize);
+        }
+
         bool IsConnected() const { return (m_clientId != kBroadcastClientId); }
 
 #ifdef DEVDRIVER_ENABLE_PACKET_LOSS
@@ -191,6 +222,27 @@ namespace DevDriver
             return m_msgTransport.WriteMessage(messageBuffer);
         }
 
+        // Write several messages into the internal transport, dropping packets one at a time
+        Result WriteTransportMessages(const MessageBuffer* pMessages, uint32 messageCount, uint32* pNumWritten)
+        {
+            Result result = Result::Success;
+            uint32 numWritten = 0;
+
+            while ((result == Result::Success) && (numWritten < messageCount))
+            {
+                result = WriteTransportMessage(pMessages[numWritten]);
+
+                if (result == Result::Success)
+                {
+                    ++numWritten;
+                }
+            }
+
+            *pNumWritten = numWritten;
+
+            return result;
+        }
+
         // Reads a message from the internal transport
         Result ReadTransportMessage(MessageBuffer& messageBuffer, uint32 timeoutInMs)
         {
@@ -212,6 +264,12 @@ namespace DevDriver
             return m_msgTransport.WriteMessage(messageBuffer);
         }
 
+        // Write several messages into the internal transport
+        Result WriteTransportMessages(const MessageBuffer* pMessages, uint32 messageCount, uint32* pNumWritten)
+        {
+            return m_msgTransport.WriteMessages(pMessages, messageCount, pNumWritten);
+        }
+
         // Reads a message from the internal transport
         Result ReadTransportMessage(MessageBuffer& messageBuffer, uint32 timeoutInMs)
         {
@@ -224,6 +282,7 @@ namespace DevDriver
         DD_STATIC_CONST uint64            kRetransmitTimeoutInMs = 50;
 
         MsgTransport                      m_msgTransport;
+        SendQueue                         m_sendQueue;
         DiscoveredClientsQueue            m_discoveredClientsQueue;
         ClientId                          m_clientId;
 
@@ -84,6 +84,7 @@ namespace DevDriver
                                                  const MessageChannelCreateInfo& createInfo,
                                                  Args&&...                       args) :
         m_msgTransport(Platform::Forward<Args>(args)...),
+        m_sendQueue(),
         m_discoveredClientsQueue(allocCb),
         m_clientId(kBroadcastClientId),
         m_allocCb(allocCb),
@@ -114,6 +115,10 @@ namespace DevDriver
 
         // Attempt to read a message from the queue with a timeout.
         Result result = ReadTransportMessage(messageBuffer, timeoutInMs);
+
+        // Everything we send while handling messages and updating sessions is queued up and written out in batches.
+        BeginSendBatch();
+
         while (result == Result::Success)
         {
             // Handle the message
@@ -178,6 +183,13 @@ namespace DevDriver
         // Give the session manager a chance to update its sessions.
         m_sessionManager.UpdateSessions();
 
+        // Anything the transport can't take yet stays queued and is retried by the next update.
+        const Result flushResult = EndSendBatch();
+        if ((flushResult != Result::Success) & (flushResult != Result::NotReady))
+        {
+            Disconnect();
+        }
+
 #if defined(DD_PLATFORM_LINUX_UM)
         // we yield the thread after processing messages to let other threads grab the lock if the need to
         // this works around an issue where the message processing thread releases the lock then reacquires
@@ -580,7 +592,8 @@ namespace DevDriver
         Result result = Result::Error;
         if (m_clientId != kBroadcastClientId)
         {
-            result = WriteTransportMessage(messageBuffer);
+            result = MsgTransport::SupportsBatchedWrites() ? QueueTransportMessage(messageBuffer)
+                                                           : WriteTransportMessage(messageBuffer);
             if ((result != Result::Success) & (result != Result::NotReady))
             {
                 Disconnect();
@@ -589,6 +602,107 @@ namespace DevDriver
         return result;
     }
 
+    template <class MsgTransport>
+    void MessageChannel<MsgTransport>::BeginSendBatch()
+    {
+        if (MsgTransport::SupportsBatchedWrites())
+        {
+            Platform::LockGuard<Platform::Mutex> lock(m_sendQueue.lock);
+            m_sendQueue.active = true;
+        }
+    }
+
+    template <class MsgTransport>
+    Result MessageChannel<MsgTransport>::EndSendBatch()
+    {
+        Result result = Result::Success;
+
+        if (MsgTransport::SupportsBatchedWrites())
+        {
+            Platform::LockGuard<Platform::Mutex> lock(m_sendQueue.lock);
+            m_sendQueue.active = false;
+            result = FlushSendQueue();
+        }
+
+        return result;
+    }
+
+    // Queues a message and, unless a send batch is active, writes it out immediately. Either way, messages reach the
+    // transport in the order they were forwarded. A queued message is only reported as sent once the queue has room
+    // for it; messages the transport can't take yet stay queued and are retried by the next flush.
+    template <class MsgTransport>
+    Result MessageChannel<MsgTransport>::QueueTransportMessage(const MessageBuffer& messageBuffer)
+    {
+        Platform::LockGuard<Platform::Mutex> lock(m_sendQueue.lock);
+
+        Result result = Result::Success;
+
+        if (m_sendQueue.count == SendQueue::kCapacity)
+        {
+            result = FlushSendQueue();
+        }
+
+        if ((result == Result::Success) | (result == Result::NotReady))
+        {
+            if (m_sendQueue.count < SendQueue::kCapacity)
+            {
+                CopyMessage(messageBuffer, &m_sendQueue.messages[m_sendQueue.count++]);
+                result = Result::Success;
+
+                if (m_sendQueue.active == false)
+                {
+                    // Whatever doesn't make it out now stays queued, so only a broken connection is an error here.
+                    const Result flushResult = FlushSendQueue();
+                    if ((flushResult != Result::Success) & (flushResult != Result::NotReady))
+                    {
+                        result = flushResult;
+                    }
+                }
+            }
+            else
+            {
+                // The transport couldn't take any of the queued messages, so the caller has to try this one again.
+                result = Result::NotReady;
+            }
+        }
+
+        return result;
+    }
+
+    // Writes out as many queued messages as the transport will take. The rest stay at the front of the queue so they
+    // are retried by the next flush, unless the connection is gone. The caller must hold the send queue lock.
+    template <class MsgTransport>
+    Result MessageChannel<MsgTransport>::FlushSendQueue()
+    {
+        Result result = Result::Success;
+
+        if ((m_sendQueue.count > 0) && IsConnected())
+        {
+            uint32 numWritten = 0;
+            result = WriteTransportMessages(&m_sendQueue.messages[0], m_sendQueue.count, &numWritten);
+
+            if ((result == Result::Success) | (result == Result::NotReady))
+            {
+                for (uint32 i = numWritten; i < m_sendQueue.count; ++i)
+                {
+                    CopyMessage(m_sendQueue.messages[i], &m_sendQueue.messages[i - numWritten]);
+                }
+
+                m_sendQueue.count -= numWritten;
+            }
+            else
+            {
+                m_sendQueue.count = 0;
+            }
+        }
+        else
+        {
+            m_sendQueue.count = 0;
+        }
+
+        return result;
+    }
+
     template <class MsgTransport>
     Result MessageChannel<MsgTransport>::Receive(MessageBuffer& message, uint32 timeoutInMs)
     {
@@ -547,6 +547,89 @@ namespace DevDriver
         return result;
     }
 
+    Result Socket::SendBatch(const uint8* const* ppData, const size_t* pDataSizes, uint32 count, uint32* pNumSent)
+    {
+        DD_ASSERT((m_socketType == SocketType::Udp) || (m_socketType == SocketType::Local));
+        DD_ASSERT(count <= kMaxBatchSize);
+
+        mmsghdr messages[kMaxBatchSize] = {};
+        iovec   vectors[kMaxBatchSize]  = {};
+
+        for (uint32 i = 0; i < count; ++i)
+        {
+            vectors[i].iov_base            = const_cast<uint8*>(ppData[i]);
+            vectors[i].iov_len             = pDataSizes[i];
+            messages[i].msg_hdr.msg_iov    = &vectors[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        Result result = Result::Error;
+
+        const int retVal = Platform::RetryTemporaryFailure(sendmmsg, m_osSocket, &messages[0], count, 0);
+
+        if (retVal >= 0)
+        {
+            *pNumSent = static_cast<uint32>(retVal);
+            result    = Result::Success;
+        }
+        else
+        {
+            *pNumSent = 0;
+            result    = GetDataError(m_isNonBlocking);
+        }
+
+        return result;
+    }
+
+    Result Socket::ReceiveBatch(uint8*  pBuffers,
+                                size_t  bufferSize,
+                                uint32  count,
+                                size_t* pBytesReceived,
+                                uint32* pNumReceived)
+    {
+        DD_ASSERT((m_socketType == SocketType::Udp) || (m_socketType == SocketType::Local));
+        DD_ASSERT(count <= kMaxBatchSize);
+
+        mmsghdr messages[kMaxBatchSize] = {};
+        iovec   vectors[kMaxBatchSize]  = {};
+
+        for (uint32 i = 0; i < count; ++i)
+        {
+            vectors[i].iov_base            = pBuffers + (i * bufferSize);
+            vectors[i].iov_len             = bufferSize;
+            messages[i].msg_hdr.msg_iov    = &vectors[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        Result result = Result::Error;
+
+        // Only return what is already queued on the socket, never wait for the rest of the batch to arrive.
+        const int retVal = Platform::RetryTemporaryFailure(recvmmsg,
+                                                           m_osSocket,
+                                                           &messages[0],
+                                                           count,
+                                                           MSG_DONTWAIT,
+                                                           static_cast<timespec*>(nullptr));
+
+        if (retVal > 0)
+        {
+            for (int i = 0; i < retVal; ++i)
+            {
+                pBytesReceived[i] = messages[i].msg_len;
+            }
+
+            *pNumReceived = static_cast<uint32>(retVal);
+            result        = Result::Success;
+        }
+        else
+        {
+            *pNumReceived = 0;
+            result        = (retVal == 0) ? Result::Unavailable : GetDataError(true);
+        }
+
+        return result;
+    }
+
     Result Socket::Close()
     {
         Result result = Result::Error;
@@ -53,7 +53,9 @@ namespace DevDriver
     SocketMsgTransport::SocketMsgTransport(const HostInfo& hostInfo) :
         m_connected(false),
         m_hostInfo(hostInfo),
-        m_socketType(TransportToSocketType(hostInfo.type))
+        m_socketType(TransportToSocketType(hostInfo.type)),
+        m_receiveQueueSize(0),
+        m_receiveQueueIndex(0)
     {
         if ((m_socketType != SocketType::Udp) && (m_socketType != SocketType::Local))
         {
@@ -98,6 +100,8 @@ namespace DevDriver
         if (m_connected)
         {
             m_connected = false;
+            m_receiveQueueSize = 0;
+            m_receiveQueueIndex = 0;
             result = m_clientSocket.Close();
         }
         return result;
@@ -105,31 +109,53 @@ namespace DevDriver
 
     Result SocketMsgTransport::ReadMessage(MessageBuffer &messageBuffer, uint32 timeoutInMs)
     {
-        bool canRead = m_connected;
-        bool exceptState = false;
         Result result = Result::Success;
 
-        if (canRead & (timeoutInMs > 0))
+        // Only go to the socket once all of the messages from the previous batch have been handed out.
+        if (m_receiveQueueIndex == m_receiveQueueSize)
         {
-            result = m_clientSocket.Select(&canRead, nullptr, &exceptState, timeoutInMs);
-        }
+            bool canRead = m_connected;
+            bool exceptState = false;
 
-        if (result == Result::Success)
-        {
-            if (canRead)
+            if (canRead & (timeoutInMs > 0))
             {
-                size_t bytesReceived;
-                result = m_clientSocket.Receive(reinterpret_cast<uint8*>(&messageBuffer), sizeof(MessageBuffer), &bytesReceived);
+                result = m_clientSocket.Select(&canRead, nullptr, &exceptState, timeoutInMs);
             }
-            else if (exceptState)
-            {
-                result = Result::Error;
-            }
-            else
+
+            if (result == Result::Success)
             {
-                result = Result::NotReady;
+                if (canRead)
+                {
+                    // Drain as many datagrams as are waiting on the socket with a single call.
+                    size_t bytesReceived[Socket::kMaxBatchSize];
+                    uint32 numReceived = 0;
+                    result = m_clientSocket.ReceiveBatch(reinterpret_cast<uint8*>(&m_receiveQueue[0]),
+                                                         sizeof(MessageBuffer),
+                                                         Socket::kMaxBatchSize,
+                                                         &bytesReceived[0],
+                                                         &numReceived);
+
+                    m_receiveQueueIndex = 0;
+                    m_receiveQueueSize = numReceived;
+                }
+                else if (exceptState)
+                {
+                    result = Result::Error;
+                }
+                else
+                {
+                    result = Result::NotReady;
+                }
             }
         }
+
+        if ((result == Result::Success) & (m_receiveQueueIndex < m_receiveQueueSize))
+        {
+            const MessageBuffer& queuedMessage = m_receiveQueue[m_receiveQueueIndex++];
+            const size_t messageSize = Platform::Min(sizeof(MessageHeader) + queuedMessage.header.payloadSize,
+                                                     sizeof(MessageBuffer));
+            memcpy(&messageBuffer, &queuedMessage, messageSize);
+        }
         return result;
     }
 
@@ -141,6 +167,43 @@ namespace DevDriver
         return m_clientSocket.Send(reinterpret_cast<const uint8*>(&messageBuffer), totalMsgSize, &bytesSent);
     }
 
+    Result SocketMsgTransport::WriteMessages(const MessageBuffer* pMessages, uint32 messageCount, uint32* pNumWritten)
+    {
+        DD_ASSERT(m_connected);
+
+        Result result = Result::Success;
+        uint32 numWritten = 0;
+
+        while ((result == Result::Success) && (numWritten < messageCount))
+        {
+            const uint32 batchSize = Platform::Min(messageCount - numWritten, Socket::kMaxBatchSize);
+
+            const uint8* pData[Socket::kMaxBatchSize];
+            size_t dataSizes[Socket::kMaxBatchSize];
+
+            for (uint32 i = 0; i < batchSize; ++i)
+            {
+                const MessageBuffer& message = pMessages[numWritten + i];
+                pData[i] = reinterpret_cast<const uint8*>(&message);
+                dataSizes[i] = (sizeof(MessageHeader) + message.header.payloadSize);
+            }
+
+            uint32 numSent = 0;
+            result = m_clientSocket.SendBatch(&pData[0], &dataSizes[0], batchSize, &numSent);
+            numWritten += numSent;
+
+            // A short batch means the socket's send buffer is full.
+            if ((result == Result::Success) & (numSent < batchSize))
+            {
+                result = Result::NotReady;
+            }
+        }
+
+        *pNumWritten = numWritten;
+
+        return result;
+    }
+
     // ================================================================================================================
     // Tests to see if the client can connect to RDS through this transport
     Result SocketMsgTransport::TestConnection(const HostInfo& hostInfo, uint32 timeoutInMs)
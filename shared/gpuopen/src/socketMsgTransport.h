@@ -47,6 +47,7 @@ namespace DevDriver
 
         Result ReadMessage(MessageBuffer& messageBuffer, uint32 timeoutInMs) override;
         Result WriteMessage(const MessageBuffer& messageBuffer) override;
+        Result WriteMessages(const MessageBuffer* pMessages, uint32 messageCount, uint32* pNumWritten) override;
 
         const char* GetTransportName() const override
         {
@@ -81,11 +82,23 @@ namespace DevDriver
             return true;
         }
 
+        DD_STATIC_CONST bool SupportsBatchedWrites()
+        {
+            return true;
+        }
+
+        DD_STATIC_CONST uint32 kMaxWriteBatchSize = Socket::kMaxBatchSize;
+
     private:
         Socket              m_clientSocket;
         bool                m_connected;
         const HostInfo      m_hostInfo;
         const SocketType    m_socketType;
+
+        // Messages received by the last batched receive which haven't been returned by ReadMessage yet.
+        MessageBuffer       m_receiveQueue[Socket::kMaxBatchSize];
+        uint32              m_receiveQueueSize;
+        uint32              m_receiveQueueIndex;
     };
 
 } // DevDriver
@@ -331,19 +331,49 @@ void CmdAllocator::FreeAllChunks()
 // Removes all linear allocators from our lists and deletes them.
 void CmdAllocator::FreeAllLinearAllocators()
 {
-    for (auto iter = m_linearAllocFreeList.Begin(); iter.IsValid();)
+#if PAL_ENABLE_PRINTS_ASSERTS
+    // Summarize how much OS work the linear allocators did so that the commit policy can be tuned.
+    VirtualLinearAllocatorStats totals  = {};
+    size_t                      maxPeak = 0;
+    uint32                      count   = 0;
+#endif
+
+    LinearAllocList*const pLists[] = { &m_linearAllocFreeList, &m_linearAllocBusyList };
+
+    for (uint32 listIdx = 0; listIdx < ArrayLen(pLists); ++listIdx)
     {
-        VirtualLinearAllocatorWithNode*const pAllocator = iter.Get();
-        m_linearAllocFreeList.Erase(&iter);
-        PAL_DELETE(pAllocator, m_pDevice->GetPlatform());
+        for (auto iter = pLists[listIdx]->Begin(); iter.IsValid();)
+        {
+            VirtualLinearAllocatorWithNode*const pAllocator = iter.Get();
+
+#if PAL_ENABLE_PRINTS_ASSERTS
+            const VirtualLinearAllocatorStats& stats = pAllocator->Stats();
+
+            totals.commitCount        += stats.commitCount;
+            totals.decommitCount      += stats.decommitCount;
+            totals.peakCommittedBytes += stats.peakCommittedBytes;
+            maxPeak                    = Max(maxPeak, stats.peakCommittedBytes);
+            count++;
+#endif
+
+            pLists[listIdx]->Erase(&iter);
+            PAL_DELETE(pAllocator, m_pDevice->GetPlatform());
+        }
     }
 
-    for (auto iter = m_linearAllocBusyList.Begin(); iter.IsValid();)
+#if PAL_ENABLE_PRINTS_ASSERTS
+    if (count > 0)
     {
-        VirtualLinearAllocatorWithNode*const pAllocator = iter.Get();
-        m_linearAllocBusyList.Erase(&iter);
-        PAL_DELETE(pAllocator, m_pDevice->GetPlatform());
+        // The allocators peak at different times, so the sum of their peaks only bounds the total committed memory.
+        PAL_DPINFO("CmdAllocator linear allocators: %u allocator(s), %u commit(s), %u decommit(s), "
+                   "%zu bytes max per-allocator peak, %zu bytes sum of per-allocator peaks",
+                   count,
+                   totals.commitCount,
+                   totals.decommitCount,
+                   maxPeak,
+                   totals.peakCommittedBytes);
     }
+#endif
 }
 
 // =====================================================================================================================
@@ -520,13 +550,15 @@ Result CmdAllocator::GetNewChunk(
     bool             systemMemory,
     CmdStreamChunk** ppChunk)
 {
+    PAL_CPU_TRACE_ZONE(m_pDevice->GetPlatform(), "CmdAllocator::GetNewChunk");
+
     // System memory allocations are only allowed for command data!
     PAL_ASSERT((systemMemory == false) || (allocType == CommandDataAlloc));
 
     // If necessary, engage the chunk lock while we search for a free chunk.
     if (m_pChunkLock != nullptr)
     {
-        m_pChunkLock->Lock();
+        m_pDevice->LockAndTrackContention(m_pChunkLock);
     }
 
     Result result = FindFreeChunk(systemMemory ? &m_sysAllocInfo : &m_gpuAllocInfo[allocType], ppChunk);
@@ -655,6 +687,10 @@ Result CmdAllocator::CreateAllocation(
         PAL_ASSERT(result == Result::Success);
         pAllocInfo->allocList.PushBack(pAlloc->ListNode());
 
+        DeviceMetrics*const pMetrics = m_pDevice->Metrics();
+        AtomicIncrement64(&pMetrics->cmdAllocations);
+        AtomicAdd64(&pMetrics->cmdChunks, allocCreateInfo.numChunks);
+
         pChunk = pAlloc->Chunks();
         for (uint32 idx = 1; idx < allocCreateInfo.numChunks; ++idx)
         {
@@ -734,7 +770,13 @@ VirtualLinearAllocator* CmdAllocator::GetNewLinearAllocator()
     {
         // Try to create a new linear allocator, we will return null if this fails.
         constexpr uint32 MaxAllocSize = 64 * 1024;
-        pAllocator = PAL_NEW(VirtualLinearAllocatorWithNode, m_pDevice->GetPlatform(), AllocInternal) (MaxAllocSize);
+
+        // Commit ahead of the allocations so that recording doesn't make an OS call every time it crosses a page.
+        VirtualLinearAllocatorPolicy policy = {};
+        policy.maxCommitAhead = m_pDevice->Settings().cmdAllocatorLinearAllocCommitAhead;
+
+        pAllocator = PAL_NEW(VirtualLinearAllocatorWithNode, m_pDevice->GetPlatform(), AllocInternal) (MaxAllocSize,
+                                                                                                         policy);
 
         if (pAllocator != nullptr)
         {
@@ -0,0 +1,312 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "core/cmdBufDumpWriter.h"
+#include "core/device.h"
+#include "core/platform.h"
+#include "palDequeImpl.h"
+#include "palSysUtil.h"
+#include "lz4frame.h"
+
+using namespace Util;
+
+namespace Pal
+{
+
+// The submitting thread is throttled once this many uncompressed bytes are waiting on the writer thread, so a long
+// capture can't run the process out of memory.
+constexpr uint64 MaxPendingBytes = 256ull * 1024 * 1024;
+
+// =====================================================================================================================
+CmdBufDumpWriter::CmdBufDumpWriter(
+    Platform* pPlatform)
+    :
+    m_pPlatform(pPlatform),
+    m_jobs(pPlatform),
+    m_pendingBytes(0),
+    m_exit(false),
+    m_pScratch(nullptr),
+    m_scratchSize(0)
+{
+}
+
+// =====================================================================================================================
+CmdBufDumpWriter::~CmdBufDumpWriter()
+{
+    if (m_writerThread.IsCreated())
+    {
+        // The writer thread drains every queued job before it exits.
+        m_exit = true;
+        m_jobSemaphore.Post();
+        m_writerThread.Join();
+    }
+
+    PAL_ASSERT(m_jobs.NumElements() == 0);
+
+    m_file.Close();
+    PAL_SAFE_FREE(m_pScratch, m_pPlatform);
+}
+
+// =====================================================================================================================
+// Opens the container file in the command buffer dump directory and starts the writer thread.
+Result CmdBufDumpWriter::Init(
+    const Device& device)
+{
+    const auto& settings = device.Settings();
+    const char* pLogDir  = &settings.cmdBufDumpDirectory[0];
+
+    // Create the directory. We don't care if it fails (existing is fine, failure is caught when opening the file).
+    MkDir(pLogDir);
+
+    constexpr uint32 MaxFilenameLength = 512;
+    char filename[MaxFilenameLength] = {};
+
+    Snprintf(filename, MaxFilenameLength, "%s/CmdBufDump_%u_%u.pcbd",
+             pLogDir,
+             GetIdOfCurrentProcess(),
+             device.ChipProperties().gpuIndex);
+
+    Result result = m_file.Open(&filename[0], FileAccessMode::FileAccessWrite | FileAccessMode::FileAccessBinary);
+    PAL_ALERT_MSG(result != Result::Success, "Failed to open CmdBuf dump container '%s'", filename);
+
+    if (result == Result::Success)
+    {
+        const CmdBufDumpContainerHeader header =
+        {
+            CmdBufDumpContainerMagic,
+            CmdBufDumpContainerVersion,
+            static_cast<uint32>(sizeof(CmdBufDumpContainerHeader)),
+            static_cast<uint32>(sizeof(CmdBufDumpRecordHeader)),
+            device.ChipProperties().familyId,
+            device.ChipProperties().eRevId,
+            static_cast<uint32>(settings.cmdBufDumpFormat),
+            0
+        };
+
+        result = m_file.Write(&header, sizeof(header));
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_jobLock.Init();
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_jobSemaphore.Init(Semaphore::MaximumCountLimit, 0);
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_writerThread.Begin(&WriterThreadCallback, this);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+Result CmdBufDumpWriter::SnapshotStream(
+    const SubmitKey&              key,
+    uint32                        streamIndex,
+    const CmdBufferDumpDesc&      cmdBufferDesc,
+    const CmdBufferChunkDumpDesc* pChunks,
+    uint32                        numChunks)
+{
+    Result result = Result::Success;
+
+    Job job = { };
+    job.header.queueId       = key.queueId;
+    job.header.frame         = key.frame;
+    job.header.submitId      = key.submitId;
+    job.header.streamIndex   = streamIndex;
+    job.header.numChunks     = numChunks;
+    job.header.queueType     = static_cast<uint32>(cmdBufferDesc.queueType);
+    job.header.engineType    = static_cast<uint32>(cmdBufferDesc.engineType);
+    job.header.engineIndex   = key.engineIndex;
+    job.header.subEngineType = static_cast<uint32>(cmdBufferDesc.subEngineType);
+    job.header.cmdBufferIdx  = cmdBufferDesc.cmdBufferIdx;
+    job.header.flags         = cmdBufferDesc.flags.u32All;
+
+    for (uint32 idx = 0; idx < numChunks; ++idx)
+    {
+        job.header.uncompressedSize += sizeof(uint32) + pChunks[idx].size;
+    }
+
+    // Give the writer thread a chance to catch up if it has fallen too far behind.
+    while (m_pendingBytes > MaxPendingBytes)
+    {
+        YieldThread();
+    }
+
+    if (job.header.uncompressedSize > 0)
+    {
+        job.pData = PAL_MALLOC(static_cast<size_t>(job.header.uncompressedSize), m_pPlatform, AllocInternalTemp);
+
+        if (job.pData == nullptr)
+        {
+            result = Result::ErrorOutOfMemory;
+        }
+        else
+        {
+            void* pNext = job.pData;
+
+            for (uint32 idx = 0; idx < numChunks; ++idx)
+            {
+                const uint32 chunkSize = static_cast<uint32>(pChunks[idx].size);
+
+                memcpy(pNext, &chunkSize, sizeof(chunkSize));
+                pNext = VoidPtrInc(pNext, sizeof(chunkSize));
+
+                memcpy(pNext, pChunks[idx].pCommands, chunkSize);
+                pNext = VoidPtrInc(pNext, chunkSize);
+            }
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        MutexAuto lock(&m_jobLock);
+        result = m_jobs.PushBack(job);
+    }
+
+    if (result == Result::Success)
+    {
+        AtomicAdd64(&m_pendingBytes, job.header.uncompressedSize);
+        m_jobSemaphore.Post();
+    }
+    else
+    {
+        PAL_SAFE_FREE(job.pData, m_pPlatform);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Callback for executing the dump writer's background thread.
+void CmdBufDumpWriter::WriterThreadCallback(
+    void* pParameter) // Opaque pointer to a CmdBufDumpWriter object
+{
+    static_cast<CmdBufDumpWriter*>(pParameter)->RunWriterThread();
+}
+
+// =====================================================================================================================
+// Compresses and writes snapshotted streams in the order they were submitted. Exits once the destructor has asked it to
+// and every job queued before that has been written.
+void CmdBufDumpWriter::RunWriterThread()
+{
+    bool done = false;
+
+    while (done == false)
+    {
+        const Result waitResult = m_jobSemaphore.Wait(UINT32_MAX);
+        PAL_ASSERT(IsErrorResult(waitResult) == false);
+
+        Job  job     = { };
+        bool haveJob = false;
+
+        m_jobLock.Lock();
+        if (m_jobs.NumElements() > 0)
+        {
+            haveJob = (m_jobs.PopFront(&job) == Result::Success);
+        }
+        else
+        {
+            // The exit request is the only post which doesn't come with a job.
+            done = m_exit;
+        }
+        m_jobLock.Unlock();
+
+        if (haveJob)
+        {
+            // Don't bother stopping if a stream wasn't written correctly as we don't want this to affect the rest of
+            // the capture... but still make it apparent that the container isn't accurate.
+            const Result result = WriteJob(job);
+            PAL_ALERT(result != Result::Success);
+
+            // Subtract by adding the two's complement.
+            AtomicAdd64(&m_pendingBytes, static_cast<uint64>(0) - job.header.uncompressedSize);
+            PAL_SAFE_FREE(job.pData, m_pPlatform);
+        }
+    }
+
+    m_file.Flush();
+}
+
+// =====================================================================================================================
+// Compresses a single stream into an LZ4 frame and appends it to the container.
+Result CmdBufDumpWriter::WriteJob(
+    const Job& job)
+{
+    Result result = Result::Success;
+
+    LZ4F_preferences_t prefs = { };
+    prefs.frameInfo.contentSize = job.header.uncompressedSize;
+
+    const size_t srcSize   = static_cast<size_t>(job.header.uncompressedSize);
+    const size_t boundSize = LZ4F_compressFrameBound(srcSize, &prefs);
+
+    if (boundSize > m_scratchSize)
+    {
+        PAL_SAFE_FREE(m_pScratch, m_pPlatform);
+
+        m_pScratch    = PAL_MALLOC(boundSize, m_pPlatform, AllocInternal);
+        m_scratchSize = (m_pScratch != nullptr) ? boundSize : 0;
+    }
+
+    CmdBufDumpRecordHeader header = job.header;
+
+    if (m_pScratch == nullptr)
+    {
+        result = Result::ErrorOutOfMemory;
+    }
+    else
+    {
+        const size_t compressedSize = LZ4F_compressFrame(m_pScratch, m_scratchSize, job.pData, srcSize, &prefs);
+
+        if (LZ4F_isError(compressedSize))
+        {
+            result = Result::ErrorUnknown;
+        }
+        else
+        {
+            header.compressedSize = compressedSize;
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_file.Write(&header, sizeof(header));
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_file.Write(m_pScratch, static_cast<size_t>(header.compressedSize));
+    }
+
+    return result;
+}
+
+} // Pal
@@ -0,0 +1,142 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#pragma once
+
+#include "pal.h"
+#include "palDeque.h"
+#include "palFile.h"
+#include "palMutex.h"
+#include "palQueue.h"
+#include "palSemaphore.h"
+#include "palThread.h"
+
+namespace Pal
+{
+
+class Device;
+class Platform;
+
+// The compressed command buffer dump container is a single binary file which holds every stream dumped at submit
+// time on a device. Its layout is:
+//  * A CmdBufDumpContainerHeader.
+//  * Any number of records, each made of a CmdBufDumpRecordHeader followed by compressedSize bytes of LZ4 frame. The
+//    decompressed frame holds, for each chunk of the stream, a uint32 byte count followed by the chunk's commands.
+//
+// tools/cmdBufDumpTools/decodeCmdBufDump.py converts a container back into the per-submit text or binary files which
+// the uncompressed dump path writes.
+
+constexpr uint32 CmdBufDumpContainerMagic   = 0x44424350; // 'PCBD'
+constexpr uint32 CmdBufDumpContainerVersion = 1;
+
+// Structure defining the top of a compressed command buffer dump container.
+struct CmdBufDumpContainerHeader
+{
+    uint32 magic;          // Always CmdBufDumpContainerMagic.
+    uint32 version;        // Container version, currently CmdBufDumpContainerVersion.
+    uint32 size;           // Size of this structure in bytes.
+    uint32 recordSize;     // Size of a CmdBufDumpRecordHeader in bytes.
+    uint32 asicFamily;     // ASIC family
+    uint32 asicRevision;   // ASIC revision
+    uint32 dumpFormat;     // CmdBufDumpFormat the device was configured with; the decoder's default output format.
+    uint32 reserved;       // Reserved field. Set to 0.
+};
+
+// Structure defining the header of each compressed stream in the container.
+struct CmdBufDumpRecordHeader
+{
+    uint64 queueId;           // Uniquely identifies the submitting queue for the lifetime of the container.
+    uint64 uncompressedSize;  // Size of the decompressed payload in bytes.
+    uint64 compressedSize;    // Size of the LZ4 frame which follows this header in bytes.
+    uint32 frame;             // Device frame count at submit time.
+    uint32 submitId;          // Index of this submission within the frame on this queue.
+    uint32 streamIndex;       // Index of this stream within the submission.
+    uint32 numChunks;         // Number of chunks in the payload.
+    uint32 queueType;         // QueueType of the submitting queue.
+    uint32 engineType;        // EngineType of the submitting queue.
+    uint32 engineIndex;       // Engine index for which this stream is destined.
+    uint32 subEngineType;     // SubEngineType of this stream.
+    uint32 cmdBufferIdx;      // Index into the submit's command buffer list, or UINT32_MAX for pre/postambles.
+    uint32 flags;             // CmdBufferDumpDesc flags (isPreamble, isPostamble).
+};
+
+// =====================================================================================================================
+// Writes submit-time command buffer dumps into a compressed container on a background thread. The submitting thread
+// only snapshots the chunk contents (copy-on-submit) so the command buffers may be reset or reused immediately; the
+// writer thread compresses each stream into an LZ4 frame and appends it to the file.
+class CmdBufDumpWriter
+{
+public:
+    explicit CmdBufDumpWriter(Platform* pPlatform);
+    ~CmdBufDumpWriter();
+
+    Result Init(const Device& device);
+
+    // Identifies the submission whose streams are passed to SnapshotStream.
+    struct SubmitKey
+    {
+        uint64 queueId;
+        uint32 engineIndex;
+        uint32 frame;
+        uint32 submitId;
+    };
+
+    // Copies one stream's chunks and queues it for compression. Called from the command dump callback.
+    Result SnapshotStream(
+        const SubmitKey&              key,
+        uint32                        streamIndex,
+        const CmdBufferDumpDesc&      cmdBufferDesc,
+        const CmdBufferChunkDumpDesc* pChunks,
+        uint32                        numChunks);
+
+private:
+    // A snapshotted stream waiting on the writer thread.
+    struct Job
+    {
+        CmdBufDumpRecordHeader header;
+        void*                  pData;     // Chunk sizes and contents in the container's payload layout.
+    };
+
+    static void WriterThreadCallback(void* pParameter);
+    void        RunWriterThread();
+    Result      WriteJob(const Job& job);
+
+    Platform*const               m_pPlatform;
+    Util::File                   m_file;
+    Util::Thread                 m_writerThread;
+    Util::Semaphore              m_jobSemaphore;   // Posted once for each job pushed to m_jobs.
+    Util::Mutex                  m_jobLock;        // Protects m_jobs.
+    Util::Deque<Job, Platform>   m_jobs;
+    volatile uint64              m_pendingBytes;   // Uncompressed bytes snapshotted but not yet written.
+    volatile bool                m_exit;
+
+    void*                        m_pScratch;       // Compression output buffer, only touched by the writer thread.
+    size_t                       m_scratchSize;
+
+    PAL_DISALLOW_DEFAULT_CTOR(CmdBufDumpWriter);
+    PAL_DISALLOW_COPY_AND_ASSIGN(CmdBufDumpWriter);
+};
+
+} // Pal
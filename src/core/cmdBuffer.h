@@ -810,6 +810,13 @@ public:
         m_status = Result::ErrorOutOfMemory;
     }
 
+    // Records an error which prevented a command from being recorded.  It is reported when the command buffer is ended.
+    void NotifyRecordingError(Result result)
+    {
+        PAL_ASSERT(result != Result::Success);
+        m_status = result;
+    }
+
     // Called once before initiating a copy that will target a peer memory object where the P2P BLT BAR workaround
     // is required.  It should not be called if the workaround is not requied.
     virtual void P2pBltWaCopyBegin(const GpuMemory* pDstMemory, uint32 regionCount, const gpusize* pChunkAddrs);
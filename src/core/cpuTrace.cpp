@@ -0,0 +1,324 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "core/cpuTrace.h"
+
+#if PAL_ENABLE_CPU_TRACE
+#include "core/devDriverUtil.h"
+#include "core/platform.h"
+#include "devDriverServer.h"
+#include "protocols/ddEventServer.h"
+
+using namespace Util;
+
+namespace Pal
+{
+namespace CpuTrace
+{
+
+// Describes the layout of ZoneEvent to tools which read the raw event stream.
+static const char ZoneEventDescription[] =
+    "PAL CPU trace zone: { uint32 threadIndex; uint32 reserved; int64 beginTicks; int64 endTicks; "
+    "int64 ticksPerSecond; char name[64]; }";
+
+// How many records are copied out of a thread buffer at a time while flushing.
+static constexpr uint32 DrainBatchSize = 256;
+
+// =====================================================================================================================
+ThreadBuffer::ThreadBuffer(
+    uint32 threadIndex)
+    :
+    m_pNext(nullptr),
+    m_threadIndex(threadIndex),
+    m_writeCount(0),
+    m_readCount(0),
+    m_droppedCount(0)
+{
+}
+
+// =====================================================================================================================
+uint32 ThreadBuffer::Drain(
+    ZoneRecord* pRecords,
+    uint32      maxRecords)
+{
+    const uint32 readCount  = m_readCount;
+    const uint32 numRecords = Min(m_writeCount - readCount, maxRecords);
+
+    for (uint32 idx = 0; idx < numRecords; ++idx)
+    {
+        pRecords[idx] = m_records[(readCount + idx) & (Capacity - 1)];
+    }
+
+    // The atomic add orders the record reads before the producer can reuse their slots.
+    AtomicAdd(&m_readCount, numRecords);
+
+    return numRecords;
+}
+
+// =====================================================================================================================
+ZoneEventProvider::ZoneEventProvider(
+    const DevDriver::AllocCb& allocCb)
+    :
+    DevDriver::EventProtocol::BaseEventProvider(allocCb, 1)
+{
+}
+
+// =====================================================================================================================
+const void* ZoneEventProvider::GetEventDescriptionData() const
+{
+    return &ZoneEventDescription[0];
+}
+
+// =====================================================================================================================
+uint32 ZoneEventProvider::GetEventDescriptionDataSize() const
+{
+    return static_cast<uint32>(sizeof(ZoneEventDescription));
+}
+
+// =====================================================================================================================
+void ZoneEventProvider::WriteZone(
+    const ZoneRecord& record,
+    uint32            threadIndex,
+    int64             ticksPerSecond)
+{
+    ZoneEvent zoneEvent = {};
+
+    zoneEvent.threadIndex    = threadIndex;
+    zoneEvent.beginTicks     = record.beginTicks;
+    zoneEvent.endTicks       = record.endTicks;
+    zoneEvent.ticksPerSecond = ticksPerSecond;
+    Strncpy(&zoneEvent.name[0], record.pName, sizeof(zoneEvent.name));
+
+    // Events are dropped if the server runs out of chunk space, there's nothing useful we can do about it here.
+    WriteEvent(ZoneEventId, &zoneEvent, sizeof(zoneEvent));
+}
+
+// =====================================================================================================================
+Tracer::Tracer(
+    Platform* pPlatform)
+    :
+    m_pPlatform(pPlatform),
+    m_isInitialized(false),
+    m_isAcceptingZones(0),
+    m_openZones(0),
+    m_threadKey(),
+    m_pFirstBuffer(nullptr),
+    m_numThreads(0),
+    m_ticksPerSecond(GetPerfFrequency()),
+    m_firstTicks(0),
+    m_isFirstFileZone(true),
+    m_eventProvider({ pPlatform, DevDriverAlloc, DevDriverFree }),
+    m_isProviderRegistered(false)
+{
+}
+
+// =====================================================================================================================
+Tracer::~Tracer()
+{
+    Destroy();
+}
+
+// =====================================================================================================================
+Result Tracer::Init()
+{
+    Result result = m_listLock.Init();
+
+    if (result == Result::Success)
+    {
+        result = m_flushLock.Init();
+    }
+
+    if (result == Result::Success)
+    {
+        result = CreateThreadLocalKey(&m_threadKey);
+    }
+
+    if (result == Result::Success)
+    {
+        m_firstTicks    = GetPerfCpuTime();
+        m_isInitialized = true;
+
+        AtomicExchange(&m_isAcceptingZones, 1);
+
+        DevDriver::DevDriverServer*const pServer = m_pPlatform->GetDevDriverServer();
+        if ((pServer != nullptr) && (pServer->GetEventServer() != nullptr))
+        {
+            m_isProviderRegistered =
+                (pServer->GetEventServer()->RegisterProvider(&m_eventProvider) == DevDriver::Result::Success);
+        }
+
+        if (m_pPlatform->PlatformSettings().enableCpuTraceFile)
+        {
+            char filePath[1024] = {};
+            Snprintf(&filePath[0],
+                     sizeof(filePath),
+                     "%sPalCpuTrace.json",
+                     &m_pPlatform->PlatformSettings().eventLogDirectory[0]);
+
+            // The trace file is a debugging aid, the tracer is still useful without it.
+            if (m_traceFile.Open(&filePath[0], FileAccessWrite) == Result::Success)
+            {
+                m_traceFile.Printf("{\"traceEvents\":[\n");
+            }
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Allocates and registers a zone buffer for the calling thread.
+ThreadBuffer* Tracer::CreateThreadBuffer()
+{
+    MutexAuto lock(&m_listLock);
+
+    ThreadBuffer* pBuffer = PAL_NEW(ThreadBuffer, m_pPlatform, AllocInternal)(m_numThreads);
+
+    if (pBuffer != nullptr)
+    {
+        if (SetThreadLocalValue(m_threadKey, pBuffer) == Result::Success)
+        {
+            pBuffer->m_pNext = m_pFirstBuffer;
+            m_pFirstBuffer   = pBuffer;
+            m_numThreads++;
+        }
+        else
+        {
+            PAL_SAFE_DELETE(pBuffer, m_pPlatform);
+        }
+    }
+
+    return pBuffer;
+}
+
+// =====================================================================================================================
+void Tracer::Flush()
+{
+    if (m_isInitialized)
+    {
+        MutexAuto flushLock(&m_flushLock);
+
+        const bool writeEvents = m_isProviderRegistered && m_eventProvider.IsZoneEventAccepted();
+        const bool writeFile   = m_traceFile.IsOpen();
+
+        ThreadBuffer* pBuffer = nullptr;
+        {
+            // New buffers are only ever added at the front of the list so we can walk it without the lock.
+            MutexAuto lock(&m_listLock);
+            pBuffer = m_pFirstBuffer;
+        }
+
+        ZoneRecord records[DrainBatchSize];
+
+        for (; pBuffer != nullptr; pBuffer = pBuffer->m_pNext)
+        {
+            uint32 numRecords = 0;
+
+            // Drain the buffer even if nobody is listening so it doesn't fill up with stale zones.
+            while ((numRecords = pBuffer->Drain(&records[0], DrainBatchSize)) > 0)
+            {
+                for (uint32 idx = 0; idx < numRecords; ++idx)
+                {
+                    if (writeEvents)
+                    {
+                        m_eventProvider.WriteZone(records[idx], pBuffer->ThreadIndex(), m_ticksPerSecond);
+                    }
+
+                    if (writeFile)
+                    {
+                        WriteFileZone(records[idx], pBuffer->ThreadIndex());
+                    }
+                }
+            }
+        }
+    }
+}
+
+// =====================================================================================================================
+// Writes a zone as a Chrome trace "complete" event. Timestamps are in microseconds.
+void Tracer::WriteFileZone(
+    const ZoneRecord& record,
+    uint32            threadIndex)
+{
+    const double ticksToUs = 1000000.0 / static_cast<double>(m_ticksPerSecond);
+    const double beginUs   = static_cast<double>(record.beginTicks - m_firstTicks) * ticksToUs;
+    const double durUs     = static_cast<double>(record.endTicks - record.beginTicks) * ticksToUs;
+
+    m_traceFile.Printf("%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":%u,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                       m_isFirstFileZone ? "" : ",\n",
+                       record.pName,
+                       GetIdOfCurrentProcess(),
+                       threadIndex,
+                       beginUs,
+                       durUs);
+
+    m_isFirstFileZone = false;
+}
+
+// =====================================================================================================================
+void Tracer::Destroy()
+{
+    if (m_isInitialized)
+    {
+        // The exchange is a full barrier, so any zone which counted itself before this point is waited for below and
+        // any zone which counts itself after it sees that we're no longer accepting zones.
+        AtomicExchange(&m_isAcceptingZones, 0);
+
+        while (m_openZones != 0)
+        {
+            YieldThread();
+        }
+
+        Flush();
+
+        m_isInitialized = false;
+
+        if (m_traceFile.IsOpen())
+        {
+            m_traceFile.Printf("\n]}\n");
+            m_traceFile.Close();
+        }
+
+        if (m_isProviderRegistered)
+        {
+            m_pPlatform->GetDevDriverServer()->GetEventServer()->UnregisterProvider(&m_eventProvider);
+            m_isProviderRegistered = false;
+        }
+
+        // No zone is open and no new one can get a buffer, so nobody else can be touching the buffers anymore.
+        while (m_pFirstBuffer != nullptr)
+        {
+            ThreadBuffer* pNext = m_pFirstBuffer->m_pNext;
+            PAL_DELETE(m_pFirstBuffer, m_pPlatform);
+            m_pFirstBuffer = pNext;
+        }
+
+        DeleteThreadLocalKey(m_threadKey);
+    }
+}
+
+} // CpuTrace
+} // Pal
+#endif
@@ -0,0 +1,260 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#pragma once
+
+#include "pal.h"
+
+#if PAL_ENABLE_CPU_TRACE
+#include "palFile.h"
+#include "palInlineFuncs.h"
+#include "palMutex.h"
+#include "palSysUtil.h"
+#include "palThread.h"
+#include "protocols/ddEventProvider.h"
+
+namespace Pal
+{
+
+class Platform;
+
+namespace CpuTrace
+{
+
+// A single completed zone, timestamps are in Util::GetPerfCpuTime() ticks.
+struct ZoneRecord
+{
+    const char* pName;      // Zone names must be string literals, we only record the pointer.
+    int64       beginTicks;
+    int64       endTicks;
+};
+
+// =====================================================================================================================
+// Fixed-size single-producer/single-consumer ring of zone records. Each thread which records a zone gets its own buffer
+// so the hot path never takes a lock; the thread that flushes the tracer is the only consumer. Records are dropped
+// (and counted) if the consumer falls behind.
+class ThreadBuffer
+{
+public:
+    static constexpr uint32 Capacity = 4096;
+
+    explicit ThreadBuffer(uint32 threadIndex);
+
+    // Called by the owning thread only.
+    void Push(const char* pName, int64 beginTicks, int64 endTicks)
+    {
+        const uint32 writeCount = m_writeCount;
+
+        if ((writeCount - m_readCount) < Capacity)
+        {
+            ZoneRecord*const pRecord = &m_records[writeCount & (Capacity - 1)];
+
+            pRecord->pName      = pName;
+            pRecord->beginTicks = beginTicks;
+            pRecord->endTicks   = endTicks;
+
+            // The atomic increment orders the record writes before the consumer can see them.
+            Util::AtomicIncrement(&m_writeCount);
+        }
+        else
+        {
+            Util::AtomicIncrement(&m_droppedCount);
+        }
+    }
+
+    // Called by the consumer only. Copies up to maxRecords of the oldest records and returns how many were copied.
+    uint32 Drain(ZoneRecord* pRecords, uint32 maxRecords);
+
+    uint32 ThreadIndex() const { return m_threadIndex; }
+    uint32 DroppedCount() const { return m_droppedCount; }
+
+    ThreadBuffer* m_pNext; // The tracer keeps all thread buffers in a singly-linked list.
+
+private:
+    static_assert(Util::IsPowerOfTwo(Capacity), "The ring capacity must be a power of two.");
+
+    const uint32    m_threadIndex;
+    volatile uint32 m_writeCount;
+    volatile uint32 m_readCount;
+    volatile uint32 m_droppedCount;
+    ZoneRecord      m_records[Capacity];
+
+    PAL_DISALLOW_DEFAULT_CTOR(ThreadBuffer);
+    PAL_DISALLOW_COPY_AND_ASSIGN(ThreadBuffer);
+};
+
+// =====================================================================================================================
+// Forwards flushed zones to tools through the DevDriver event protocol. Each zone is written as one ZoneEvent.
+class ZoneEventProvider : public DevDriver::EventProtocol::BaseEventProvider
+{
+public:
+    static constexpr DevDriver::EventProtocol::EventProviderId ProviderId = 0x50414c43; // 'PALC'
+
+    // The only event this provider writes.
+    static constexpr uint32 ZoneEventId  = 0;
+    static constexpr uint32 MaxNameChars = 64;
+
+    struct ZoneEvent
+    {
+        uint32 threadIndex;
+        uint32 reserved;
+        int64  beginTicks;
+        int64  endTicks;
+        int64  ticksPerSecond;
+        char   name[MaxNameChars];
+    };
+
+    explicit ZoneEventProvider(const DevDriver::AllocCb& allocCb);
+    virtual ~ZoneEventProvider() {}
+
+    virtual DevDriver::EventProtocol::EventProviderId GetId() const override { return ProviderId; }
+
+    virtual const void* GetEventDescriptionData() const override;
+    virtual uint32 GetEventDescriptionDataSize() const override;
+
+    // Returns true if a tool is currently listening for zone events.
+    bool IsZoneEventAccepted() const
+        { return (QueryEventWriteStatus(ZoneEventId) == DevDriver::Result::Success); }
+
+    void WriteZone(const ZoneRecord& record, uint32 threadIndex, int64 ticksPerSecond);
+};
+
+// =====================================================================================================================
+// Owns the per-thread zone buffers and drains them into the DevDriver event protocol and/or a Chrome trace JSON file.
+class Tracer
+{
+public:
+    explicit Tracer(Platform* pPlatform);
+    ~Tracer();
+
+    // Must be called after the platform settings are final and the DevDriver server (if any) is set up.
+    Result Init();
+
+    // Opens a zone on the calling thread and returns the thread's buffer, creating it on first use. Returns null if the
+    // tracer isn't accepting zones. Every zone which got a buffer must be closed with EndZone.
+    ThreadBuffer* BeginZone()
+    {
+        ThreadBuffer* pBuffer = nullptr;
+
+        // The zone is counted before the flag is checked, so Destroy either sees this zone or we see its flag.
+        Util::AtomicIncrement(&m_openZones);
+
+        if (m_isAcceptingZones != 0)
+        {
+            pBuffer = static_cast<ThreadBuffer*>(Util::GetThreadLocalValue(m_threadKey));
+
+            if (pBuffer == nullptr)
+            {
+                pBuffer = CreateThreadBuffer();
+            }
+        }
+
+        if (pBuffer == nullptr)
+        {
+            Util::AtomicDecrement(&m_openZones);
+        }
+
+        return pBuffer;
+    }
+
+    // Closes a zone opened by BeginZone. The zone must not touch its buffer after this.
+    void EndZone() { Util::AtomicDecrement(&m_openZones); }
+
+    // Drains every thread's buffer. If another thread is already flushing this waits for it to finish.
+    void Flush();
+
+    // Stops accepting new zones, waits for the open ones to close, flushes everything, finishes the trace file and
+    // unregisters from the event server.
+    void Destroy();
+
+private:
+    ThreadBuffer* CreateThreadBuffer();
+    void WriteFileZone(const ZoneRecord& record, uint32 threadIndex);
+
+    Platform*const            m_pPlatform;
+    bool                      m_isInitialized;
+    volatile uint32           m_isAcceptingZones; // Non-zero while new zones may get a thread buffer.
+    volatile uint32           m_openZones;        // Zones which got a thread buffer and haven't ended yet.
+    Util::ThreadLocalKey      m_threadKey;
+    Util::Mutex               m_listLock;     // Protects the thread buffer list and m_numThreads.
+    ThreadBuffer*             m_pFirstBuffer;
+    uint32                    m_numThreads;
+    Util::Mutex               m_flushLock;    // Serializes consumers; only one thread may drain at a time.
+    int64                     m_ticksPerSecond;
+    int64                     m_firstTicks;   // Chrome trace timestamps are written relative to this.
+    Util::File                m_traceFile;
+    bool                      m_isFirstFileZone;
+    ZoneEventProvider         m_eventProvider;
+    bool                      m_isProviderRegistered;
+
+    PAL_DISALLOW_DEFAULT_CTOR(Tracer);
+    PAL_DISALLOW_COPY_AND_ASSIGN(Tracer);
+};
+
+// =====================================================================================================================
+// Records the lifetime of a C++ scope as a zone on the current thread.
+class ScopedZone
+{
+public:
+    ScopedZone(Tracer* pTracer, const char* pName)
+        :
+        m_pTracer(pTracer),
+        m_pBuffer(pTracer->BeginZone()),
+        m_pName(pName),
+        m_beginTicks(Util::GetPerfCpuTime())
+    {
+    }
+
+    ~ScopedZone()
+    {
+        if (m_pBuffer != nullptr)
+        {
+            m_pBuffer->Push(m_pName, m_beginTicks, Util::GetPerfCpuTime());
+            m_pTracer->EndZone();
+        }
+    }
+
+private:
+    Tracer*const       m_pTracer;
+    ThreadBuffer*const m_pBuffer;
+    const char*const   m_pName;
+    const int64        m_beginTicks;
+
+    PAL_DISALLOW_DEFAULT_CTOR(ScopedZone);
+    PAL_DISALLOW_COPY_AND_ASSIGN(ScopedZone);
+};
+
+} // CpuTrace
+} // Pal
+
+#define PAL_CPU_TRACE_CONCAT_INNER(a, b) a##b
+#define PAL_CPU_TRACE_CONCAT(a, b)       PAL_CPU_TRACE_CONCAT_INNER(a, b)
+
+// Records the enclosing scope as a CPU trace zone. The zone name must be a string literal.
+#define PAL_CPU_TRACE_ZONE(pPlatform, pName) \
+    Pal::CpuTrace::ScopedZone PAL_CPU_TRACE_CONCAT(cpuTraceZone, __LINE__)((pPlatform)->GetCpuTracer(), pName)
+#else
+#define PAL_CPU_TRACE_ZONE(pPlatform, pName)
+#endif
@@ -0,0 +1,223 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "core/devDriverMetricsService.h"
+#include "core/device.h"
+#include "core/platform.h"
+#include "palInlineFuncs.h"
+#include "palSysUtil.h"
+
+using namespace DevDriver;
+
+namespace Pal
+{
+
+// =====================================================================================================================
+MetricsService::MetricsService(
+    Platform* pPlatform)
+    :
+    m_pPlatform(pPlatform),
+    m_numCacheLayers(0)
+{
+    memset(&m_cacheLayers[0], 0, sizeof(m_cacheLayers));
+}
+
+// =====================================================================================================================
+MetricsService::~MetricsService()
+{
+}
+
+// =====================================================================================================================
+// Handles a metrics request. Supported commands are:
+//     metrics://all      - Writes every section below as one map.
+//     metrics://platform - Writes a map of the platform's initialization times in microseconds.
+//     metrics://devices  - Writes a list with the counters of each device and its queues.
+//     metrics://caches   - Writes a map of the registered cache layers' usage counters and hit rates.
+DevDriver::Result MetricsService::HandleRequest(
+    IURIRequestContext* pContext)
+{
+    DD_ASSERT(pContext != nullptr);
+
+    DevDriver::Result result = DevDriver::Result::UriInvalidParameters;
+
+    const char* const pArgDelim = " ";
+    char* pStrtokContext = nullptr;
+    const char* pCmdName = DevDriver::Platform::Strtok(pContext->GetRequestArguments(), pArgDelim, &pStrtokContext);
+
+    if (pCmdName != nullptr)
+    {
+        const bool writeAll      = (strcmp(pCmdName, "all") == 0);
+        const bool writePlatform = writeAll || (strcmp(pCmdName, "platform") == 0);
+        const bool writeDevice   = writeAll || (strcmp(pCmdName, "devices") == 0);
+        const bool writeCaches   = writeAll || (strcmp(pCmdName, "caches") == 0);
+
+        if (writePlatform || writeDevice || writeCaches)
+        {
+            IStructuredWriter* pWriter = nullptr;
+            result = pContext->BeginJsonResponse(&pWriter);
+
+            if (result == DevDriver::Result::Success)
+            {
+                if (writeAll)
+                {
+                    pWriter->BeginMap();
+                    pWriter->Key("platform");
+                    WritePlatform(pWriter);
+                    pWriter->Key("devices");
+                    WriteDevices(pWriter);
+                    pWriter->Key("caches");
+                    WriteCacheLayers(pWriter);
+                    pWriter->EndMap();
+                }
+                else if (writePlatform)
+                {
+                    WritePlatform(pWriter);
+                }
+                else if (writeDevice)
+                {
+                    WriteDevices(pWriter);
+                }
+                else
+                {
+                    WriteCacheLayers(pWriter);
+                }
+
+                result = pWriter->End();
+            }
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Times are zero for any phase which hasn't completed yet, since this service is registered partway through init.
+void MetricsService::WritePlatform(
+    IStructuredWriter* pWriter)
+{
+    const PlatformInitTimes& initTimes     = m_pPlatform->InitTimes();
+    const uint64             perfFrequency = Util::GetPerfFrequency();
+
+    pWriter->BeginMap();
+    pWriter->KeyAndBeginMap("initTimesUs");
+    pWriter->KeyAndValue("enumerateDevices", initTimes.enumerateDevices * 1000000 / perfFrequency);
+    pWriter->KeyAndValue("settingsRead", initTimes.settingsRead * 1000000 / perfFrequency);
+    pWriter->KeyAndValue("total", initTimes.total * 1000000 / perfFrequency);
+    pWriter->EndMap();
+    pWriter->EndMap();
+}
+
+// =====================================================================================================================
+// The platform only registers this service while its devices are valid, so the device list is stable here.
+void MetricsService::WriteDevices(
+    IStructuredWriter* pWriter)
+{
+    pWriter->BeginList();
+
+    for (uint32 idx = 0; idx < m_pPlatform->GetDeviceCount(); ++idx)
+    {
+        m_pPlatform->GetDevice(idx)->WriteMetrics(pWriter);
+    }
+
+    pWriter->EndList();
+}
+
+// =====================================================================================================================
+void MetricsService::WriteCacheLayers(
+    IStructuredWriter* pWriter)
+{
+    DevDriver::Platform::LockGuard<DevDriver::Platform::Mutex> lock(m_cacheLayerMutex);
+
+    pWriter->BeginMap();
+
+    for (uint32 idx = 0; idx < m_numCacheLayers; ++idx)
+    {
+        Util::CacheLayerStats stats = {};
+
+        if (m_cacheLayers[idx].pLayer->GetStats(&stats) == Result::Success)
+        {
+            const double hitRate = (stats.queryCount > 0)
+                                   ? (static_cast<double>(stats.hitCount) / static_cast<double>(stats.queryCount))
+                                   : 0.0;
+
+            pWriter->KeyAndBeginMap(&m_cacheLayers[idx].name[0]);
+            pWriter->KeyAndValue("queries", stats.queryCount);
+            pWriter->KeyAndValue("hits", stats.hitCount);
+            pWriter->KeyAndValue("stores", stats.storeCount);
+            pWriter->KeyAndValue("hitRate", hitRate);
+            pWriter->EndMap();
+        }
+    }
+
+    pWriter->EndMap();
+}
+
+// =====================================================================================================================
+Result MetricsService::RegisterCacheLayer(
+    const char*              pName,
+    const Util::ICacheLayer* pLayer)
+{
+    Result result = Result::ErrorInvalidPointer;
+
+    if ((pName != nullptr) && (pLayer != nullptr))
+    {
+        DevDriver::Platform::LockGuard<DevDriver::Platform::Mutex> lock(m_cacheLayerMutex);
+
+        if (m_numCacheLayers < MaxCacheLayers)
+        {
+            CacheLayerEntry*const pEntry = &m_cacheLayers[m_numCacheLayers++];
+
+            Util::Strncpy(&pEntry->name[0], pName, sizeof(pEntry->name));
+            pEntry->pLayer = pLayer;
+
+            result = Result::Success;
+        }
+        else
+        {
+            result = Result::ErrorOutOfMemory;
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+void MetricsService::UnregisterCacheLayer(
+    const Util::ICacheLayer* pLayer)
+{
+    DevDriver::Platform::LockGuard<DevDriver::Platform::Mutex> lock(m_cacheLayerMutex);
+
+    for (uint32 idx = 0; idx < m_numCacheLayers; ++idx)
+    {
+        if (m_cacheLayers[idx].pLayer == pLayer)
+        {
+            // Keep the registered layers packed by moving the last entry into the freed slot.
+            m_cacheLayers[idx] = m_cacheLayers[--m_numCacheLayers];
+            break;
+        }
+    }
+}
+
+} // Pal
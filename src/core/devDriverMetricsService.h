@@ -0,0 +1,86 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#pragma once
+
+#include "pal.h"
+#include "ddUriInterface.h"
+#include "palCacheLayer.h"
+
+namespace Pal
+{
+class Platform;
+
+// String used to identify the service
+DD_STATIC_CONST char kMetricsServiceName[] = "metrics";
+
+DD_STATIC_CONST DevDriver::Version kMetricsServiceVersion = 1;
+
+// =====================================================================================================================
+// Exposes PAL's cheap, always-on counters to tools as JSON so a running process can be inspected without attaching a
+// profiler or using a debug build. The counters themselves live in the objects they describe (Device, Queue and any
+// registered cache layers); this service only gathers and writes them.
+class MetricsService : public DevDriver::IService
+{
+public:
+    // The maximum number of cache layers which can be registered at once.
+    static constexpr uint32 MaxCacheLayers = 8;
+
+    // The maximum length of a registered cache layer's name, including the null terminator.
+    static constexpr uint32 MaxCacheLayerNameLength = 32;
+
+    explicit MetricsService(Platform* pPlatform);
+    ~MetricsService();
+
+    // Returns the name of the service
+    const char* GetName() const override final { return kMetricsServiceName; }
+    DevDriver::Version GetVersion() const override final { return kMetricsServiceVersion; }
+
+    // Handles an incoming URI request
+    DevDriver::Result HandleRequest(DevDriver::IURIRequestContext* pContext) override final;
+
+    // Adds a cache layer whose hit rate should be reported under the given name. The layer must be unregistered
+    // before it is destroyed.
+    Result RegisterCacheLayer(const char* pName, const Util::ICacheLayer* pLayer);
+    void UnregisterCacheLayer(const Util::ICacheLayer* pLayer);
+
+private:
+    void WritePlatform(DevDriver::IStructuredWriter* pWriter);
+    void WriteDevices(DevDriver::IStructuredWriter* pWriter);
+    void WriteCacheLayers(DevDriver::IStructuredWriter* pWriter);
+
+    struct CacheLayerEntry
+    {
+        char                     name[MaxCacheLayerNameLength];
+        const Util::ICacheLayer* pLayer;
+    };
+
+    Platform*const             m_pPlatform;
+    DevDriver::Platform::Mutex m_cacheLayerMutex;  // Protects the registered cache layers
+    CacheLayerEntry            m_cacheLayers[MaxCacheLayers];
+    uint32                     m_numCacheLayers;
+};
+
+} // Pal
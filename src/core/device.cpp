@@ -25,6 +25,9 @@
 
 #include "core/cmdAllocator.h"
 #include "core/cmdBuffer.h"
+#if defined(PAL_BUILD_GPUOPEN)
+#include "core/cmdBufDumpWriter.h"
+#endif
 #include "core/device.h"
 #include "core/engine.h"
 #include "core/fence.h"
@@ -40,10 +43,13 @@
 #include "core/addrMgr/addrMgr.h"
 #include "core/svmMgr.h"
 #include "palDequeImpl.h"
+#include "palFile.h"
 #include "palFormatInfo.h"
 #include "palHashMapImpl.h"
 #include "palIntrusiveListImpl.h"
+#include "palMetroHash.h"
 #include "palPipeline.h"
+#include "palPlatformKey.h"
 #if defined(__unix__)
 #include "palSettingsFileMgrImpl.h"
 #endif
@@ -51,6 +57,7 @@
 #include "palTextWriterImpl.h"
 
 #include <limits.h>
+#include <stdio.h>
 
 // Dev Driver includes
 #include "msgChannel.h"
@@ -229,6 +236,7 @@ Device::Device(
     m_settingsCommitted(false),
     m_deviceFinalized(false),
     m_cmdBufDumpEnabled(false),
+    m_pCmdBufDumpWriter(nullptr),
 #endif
     m_force32BitVaSpace(pPlatform->Force32BitVaSpace()),
     m_disableSwapChainAcquireBeforeSignaling(false),
@@ -237,10 +245,16 @@ Device::Device(
 #if defined(__unix__)
     m_settingsMgr(SettingsFileName, pPlatform),
 #endif
+    m_initTimes(),
     m_copyQueuesLock(),
     m_pInternalCopyQueue(nullptr),
     m_copyCmdBufferLock(),
     m_pInternalCopyCmdBuffer(nullptr),
+    m_internalCopyCmdBufferRecording(false),
+    m_pipelineUploadBatchDepth(0),
+    m_pendingPipelineUploadBytes(0),
+    m_uploadBatchId(0),
+    m_submittedUploadBatchId(0),
     m_referencedGpuMem(ReferencedMemoryMapElements, pPlatform),
     m_referencedGpuMemLock(),
     m_pAddrMgr(nullptr),
@@ -252,7 +266,10 @@ Device::Device(
     m_maxSemaphoreCount(maxSemaphoreCount),
     m_frameCnt(0),
     m_texOptLevel(ImageTexOptLevel::Default),
-    m_hdrColorspaceFormat(ScreenColorSpace::TfUndefined)
+    m_pPipelineRegCache(nullptr),
+    m_pipelineRegCacheSalt(0),
+    m_hdrColorspaceFormat(ScreenColorSpace::TfUndefined),
+    m_metrics()
 {
     memset(&m_finalizeInfo, 0, sizeof(m_finalizeInfo));
     memset(&m_privateScreenInfo[0], 0, sizeof(m_privateScreenInfo));
@@ -328,6 +345,9 @@ Result Device::Cleanup()
         PAL_SAFE_FREE(m_pInternalCopyQueue, GetPlatform());
     }
 
+    // The client must close all pipeline upload batches before destroying the device.
+    PAL_ASSERT(m_pipelineUploadBatchDepth == 0);
+
     if (m_pInternalCopyCmdBuffer != nullptr)
     {
         m_pInternalCopyCmdBuffer->DestroyInternal();
@@ -362,6 +382,13 @@ Result Device::Cleanup()
         PAL_SAFE_DELETE(m_pTextWriter, m_pPlatform);
     }
 
+#if PAL_ENABLE_PRINTS_ASSERTS
+#if defined(PAL_BUILD_GPUOPEN)
+    // All queues are gone, so this flushes every snapshotted stream to the container before closing it.
+    PAL_SAFE_DELETE(m_pCmdBufDumpWriter, m_pPlatform);
+#endif
+#endif
+
     for (uint32 engineType = 0; engineType < EngineTypeCount; engineType++)
     {
         PAL_SAFE_DELETE(m_pDummyCommandStreams[engineType], m_pPlatform);
@@ -800,6 +827,229 @@ void Device::InitMemoryHeapProperties()
     }
 }
 
+// Device property snapshot files start with this header, followed by a PropertySnapshotPayload.
+constexpr uint32 PropertySnapshotMagic      = 0x504E5350; // "PSNP"
+constexpr uint32 PropertySnapshotVersion    = 1;
+constexpr char   PropertySnapshotFilePrefix[] = "AmdPalDeviceSnapshot";
+
+struct PropertySnapshotHeader
+{
+    uint32 magic;             // Must be PropertySnapshotMagic.
+    uint32 version;           // Must be PropertySnapshotVersion; bump it whenever a saved property changes meaning.
+    uint32 interfaceVersion;  // Client interface version, which changes the layout of the saved structures.
+    uint32 payloadSize;       // Must be sizeof(PropertySnapshotPayload).
+    uint64 platformKey;       // Digest of the client's snapshot key.
+    uint64 osKey;             // Identifies the kernel driver and raw device info the properties were derived from.
+    uint64 payloadHash;       // MetroHash64 of the payload, which catches torn or corrupted files.
+};
+
+// The saved properties. Any pointers in them refer to the saving process and are cleared before they're written.
+struct PropertySnapshotPayload
+{
+    GpuChipProperties        chipProperties;
+    GpuEngineProperties      engineProperties;
+    PerfExperimentProperties perfExperimentProperties;
+    char                     gpuName[MaxDeviceName];
+};
+
+// =====================================================================================================================
+// Snapshots are named after the GPU's family and device IDs rather than the adapter so that a null device which
+// emulates the same GPU can find them.
+void Device::GetPropertySnapshotPath(
+    char*  pPath,
+    size_t pathSize
+    ) const
+{
+    Snprintf(pPath,
+             pathSize,
+             "%s/%s_%02x_%04x.bin",
+             &m_cacheFilePath[0],
+             &PropertySnapshotFilePrefix[0],
+             m_chipProperties.familyId,
+             m_chipProperties.deviceId);
+}
+
+// =====================================================================================================================
+// Replaces this device's derived properties with the contents of its snapshot file if the snapshot matches this
+// platform, OS and GPU. Must be called after the OS layer has filled out the chip's IDs and IP levels and resolved the
+// cache file path, but before it derives any other properties. Returns true if the snapshot was applied, in which
+// case the caller should skip its own derivation.
+bool Device::LoadPropertySnapshot(
+    uint64 osKey,
+    bool   matchOsKey)
+{
+    bool loaded = false;
+
+    if (m_pPlatform->DeviceSnapshotEnabled() && (m_cacheFilePath[0] != '\0'))
+    {
+        char path[MaxPathStrLen];
+        GetPropertySnapshotPath(&path[0], sizeof(path));
+
+        auto* pPayload = static_cast<PropertySnapshotPayload*>(
+            PAL_MALLOC(sizeof(PropertySnapshotPayload), m_pPlatform, AllocInternalTemp));
+
+        File                   file;
+        PropertySnapshotHeader header    = {};
+        size_t                 bytesRead = 0;
+
+        if ((pPayload != nullptr)      &&
+            File::Exists(&path[0])     &&
+            (file.Open(&path[0], FileAccessRead | FileAccessBinary) == Result::Success) &&
+            (file.Read(&header, sizeof(header), &bytesRead) == Result::Success)         &&
+            (bytesRead == sizeof(header)))
+        {
+            loaded = (header.magic            == PropertySnapshotMagic)              &&
+                     (header.version          == PropertySnapshotVersion)            &&
+                     (header.interfaceVersion == PAL_CLIENT_INTERFACE_MAJOR_VERSION) &&
+                     (header.payloadSize      == sizeof(PropertySnapshotPayload))    &&
+                     (header.platformKey      == m_pPlatform->DeviceSnapshotKey())   &&
+                     ((matchOsKey == false) || (header.osKey == osKey));
+
+            if (loaded)
+            {
+                loaded = (file.Read(pPayload, sizeof(*pPayload), &bytesRead) == Result::Success) &&
+                         (bytesRead == sizeof(*pPayload));
+            }
+
+            if (loaded)
+            {
+                uint64 payloadHash = 0;
+                MetroHash64::Hash(reinterpret_cast<const uint8*>(pPayload),
+                                  sizeof(*pPayload),
+                                  reinterpret_cast<uint8*>(&payloadHash));
+
+                const GpuChipProperties& savedChipProps = pPayload->chipProperties;
+
+                loaded = (payloadHash             == header.payloadHash)          &&
+                         (savedChipProps.familyId == m_chipProperties.familyId)   &&
+                         (savedChipProps.deviceId == m_chipProperties.deviceId)   &&
+                         (savedChipProps.gfxLevel == m_chipProperties.gfxLevel)   &&
+                         (savedChipProps.ossLevel == m_chipProperties.ossLevel);
+            }
+        }
+
+        if (loaded)
+        {
+            // The PCI location identifies this adapter rather than its GPU model, so it always comes from the OS.
+            GpuChipProperties*const pSavedChipProps = &pPayload->chipProperties;
+            pSavedChipProps->gpuIndex                   = m_chipProperties.gpuIndex;
+            pSavedChipProps->pciDomainNumber            = m_chipProperties.pciDomainNumber;
+            pSavedChipProps->pciBusNumber               = m_chipProperties.pciBusNumber;
+            pSavedChipProps->pciDeviceNumber            = m_chipProperties.pciDeviceNumber;
+            pSavedChipProps->pciFunctionNumber          = m_chipProperties.pciFunctionNumber;
+            pSavedChipProps->gpuConnectedViaThunderbolt = m_chipProperties.gpuConnectedViaThunderbolt;
+
+            m_chipProperties           = pPayload->chipProperties;
+            m_engineProperties         = pPayload->engineProperties;
+            m_perfExperimentProperties = pPayload->perfExperimentProperties;
+            Strncpy(&m_gpuName[0], &pPayload->gpuName[0], sizeof(m_gpuName));
+
+            // Restore the state which lives in this process rather than in the snapshot.
+            switch (m_chipProperties.gfxLevel)
+            {
+#if PAL_BUILD_GFX6
+            case GfxIpLevel::GfxIp6:
+            case GfxIpLevel::GfxIp7:
+            case GfxIpLevel::GfxIp8:
+            case GfxIpLevel::GfxIp8_1:
+                m_pFormatPropertiesTable = Gfx6::GetFormatPropertiesTable(m_chipProperties.gfxLevel);
+                Gfx6::InitializeNullSrds(&m_chipProperties);
+                break;
+#endif
+            case GfxIpLevel::GfxIp9:
+            case GfxIpLevel::GfxIp10_1:
+                m_pFormatPropertiesTable = Gfx9::GetFormatPropertiesTable(m_chipProperties.gfxLevel,
+                                                                          m_pPlatform->PlatformSettings());
+                Gfx9::InitializeNullSrds(&m_chipProperties);
+                break;
+            default:
+                break;
+            }
+        }
+
+        PAL_SAFE_FREE(pPayload, m_pPlatform);
+    }
+
+    return loaded;
+}
+
+// =====================================================================================================================
+// Writes this device's derived properties to its snapshot file so later processes can load them instead. Must be
+// called after the OS layer derives the properties and before any settings are applied to them.
+void Device::SavePropertySnapshot(
+    uint64 osKey
+    ) const
+{
+    if (m_pPlatform->DeviceSnapshotEnabled() && (m_cacheFilePath[0] != '\0'))
+    {
+        auto* pPayload = static_cast<PropertySnapshotPayload*>(
+            PAL_CALLOC(sizeof(PropertySnapshotPayload), m_pPlatform, AllocInternalTemp));
+
+        if (pPayload != nullptr)
+        {
+            pPayload->chipProperties           = m_chipProperties;
+            pPayload->engineProperties         = m_engineProperties;
+            pPayload->perfExperimentProperties = m_perfExperimentProperties;
+            Strncpy(&pPayload->gpuName[0], &m_gpuName[0], sizeof(pPayload->gpuName));
+
+            // These point into this process and will be restored by whichever process loads the snapshot.
+            pPayload->chipProperties.imageProperties.pSwizzleEqs = nullptr;
+            memset(&pPayload->chipProperties.nullSrds, 0, sizeof(pPayload->chipProperties.nullSrds));
+
+            PropertySnapshotHeader header = {};
+            header.magic            = PropertySnapshotMagic;
+            header.version          = PropertySnapshotVersion;
+            header.interfaceVersion = PAL_CLIENT_INTERFACE_MAJOR_VERSION;
+            header.payloadSize      = sizeof(PropertySnapshotPayload);
+            header.platformKey      = m_pPlatform->DeviceSnapshotKey();
+            header.osKey            = osKey;
+
+            MetroHash64::Hash(reinterpret_cast<const uint8*>(pPayload),
+                              sizeof(*pPayload),
+                              reinterpret_cast<uint8*>(&header.payloadHash));
+
+            char path[MaxPathStrLen];
+            GetPropertySnapshotPath(&path[0], sizeof(path));
+
+            // Many processes may start at once, so write a private file and rename it into place. Readers will
+            // only ever see a complete snapshot.
+            char tempPath[MaxPathStrLen];
+            Snprintf(&tempPath[0], sizeof(tempPath), "%s.%u.tmp", &path[0], GetIdOfCurrentProcess());
+
+            MkDirRecursively(&m_cacheFilePath[0]);
+
+            File   file;
+            Result result = file.Open(&tempPath[0], FileAccessWrite | FileAccessBinary);
+
+            if (result == Result::Success)
+            {
+                result = file.Write(&header, sizeof(header));
+            }
+
+            if (result == Result::Success)
+            {
+                result = file.Write(pPayload, sizeof(*pPayload));
+            }
+
+            file.Close();
+
+            if ((result == Result::Success) && (rename(&tempPath[0], &path[0]) != 0))
+            {
+                result = Result::ErrorUnknown;
+            }
+
+            if (result != Result::Success)
+            {
+                // Failing to save a snapshot only costs the next process some startup time.
+                PAL_ALERT_ALWAYS();
+                remove(&tempPath[0]);
+            }
+
+            PAL_SAFE_FREE(pPayload, m_pPlatform);
+        }
+    }
+}
+
 // =====================================================================================================================
 // Initializes the Pal setting structures
 Result Device::InitSettings()
@@ -809,6 +1059,8 @@ Result Device::InitSettings()
     // Make sure we only initialize settings once
     if (m_pSettingsLoader == nullptr)
     {
+        const uint64 startTime = GetPerfCpuTime();
+
         m_pSettingsLoader = PAL_NEW(Pal::SettingsLoader, GetPlatform(), AllocInternal)(this);
 
         if (m_pSettingsLoader == nullptr)
@@ -825,6 +1077,8 @@ Result Device::InitSettings()
         {
             ret = SetupPublicSettingDefaults();
         }
+
+        m_initTimes.settingsRead = GetPerfCpuTime() - startTime;
     }
 
     return ret;
@@ -1203,6 +1457,8 @@ Result Device::FixupUsableGpuVirtualAddressRange(
 // =====================================================================================================================
 Result Device::CommitSettingsAndInit()
 {
+    const uint64 startTime = GetPerfCpuTime();
+
     PAL_ASSERT(m_pSettingsLoader != nullptr);
     m_pSettingsLoader->FinalizeSettings();
 
@@ -1243,7 +1499,11 @@ Result Device::CommitSettingsAndInit()
     m_settingsCommitted = true;
 #endif
 
-    return LateInit();
+    const Result result = LateInit();
+
+    m_initTimes.commitSettings = GetPerfCpuTime() - startTime;
+
+    return result;
 }
 
 // =====================================================================================================================
@@ -1473,6 +1733,8 @@ Result Device::CreateInternalCmdAllocators()
 Result Device::Finalize(
     const DeviceFinalizeInfo& finalizeInfo)
 {
+    const uint64 startTime = GetPerfCpuTime();
+
 #if PAL_ENABLE_PRINTS_ASSERTS
     // Clients must call CommitSettingsAndInit() before Finalize().
     PAL_ASSERT(m_settingsCommitted);
@@ -1585,10 +1847,52 @@ Result Device::Finalize(
 
     m_texOptLevel = finalizeInfo.internalTexOptLevel;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 573
+    // The platform key is snapshotted here so that pipeline creation never has to call back into the client's key.
+    if ((finalizeInfo.pPipelineRegisterCache != nullptr) && (finalizeInfo.pPlatformKey != nullptr))
+    {
+        m_pPipelineRegCache    = finalizeInfo.pPipelineRegisterCache;
+        m_pipelineRegCacheSalt = finalizeInfo.pPlatformKey->GetKey64();
+    }
+#endif
+
 #if PAL_ENABLE_PRINTS_ASSERTS
+#if defined(PAL_BUILD_GPUOPEN)
+    if ((result == Result::Success)                              &&
+        (Settings().cmdBufDumpMode == CmdBufDumpModeSubmitTime) &&
+        Settings().cmdBufDumpCompressed                         &&
+        (m_pCmdBufDumpWriter == nullptr))
+    {
+        m_pCmdBufDumpWriter = PAL_NEW(CmdBufDumpWriter, m_pPlatform, AllocInternal)(m_pPlatform);
+
+        if (m_pCmdBufDumpWriter == nullptr)
+        {
+            result = Result::ErrorOutOfMemory;
+        }
+        else
+        {
+            result = m_pCmdBufDumpWriter->Init(*this);
+
+            if (result != Result::Success)
+            {
+                PAL_SAFE_DELETE(m_pCmdBufDumpWriter, m_pPlatform);
+
+                // Failing to open the dump container shouldn't prevent the device from working; fall back to the
+                // uncompressed dump files.
+                result = Result::Success;
+            }
+        }
+    }
+#else
+    // The compressed container needs LZ4, which is only built along with GPUOpen; write uncompressed dumps instead.
+    PAL_ALERT_MSG(Settings().cmdBufDumpCompressed, "%s", "Compressed command buffer dumps require PAL_BUILD_GPUOPEN");
+#endif
+
     m_deviceFinalized = true;
 #endif
 
+    m_initTimes.finalize = GetPerfCpuTime() - startTime;
+
     return result;
 }
 
@@ -3092,6 +3396,16 @@ size_t Device::GetQueryPoolSize(
         {
             result = 0;
         }
+        else if (createInfo.flags.persistentlyMapped && (createInfo.flags.enableCpuAccess == 0))
+        {
+            // Only CPU accessible query pools can be kept mapped.
+            result = 0;
+
+            if (pResult != nullptr)
+            {
+                *pResult = Result::ErrorInvalidFlags;
+            }
+        }
         else
         {
             result = m_pGfxDevice->GetQueryPoolSize(createInfo, pResult);
@@ -4453,6 +4767,75 @@ void Device::RemoveQueue(
     m_queues.Erase(pQueue->DeviceMembershipNode());
 }
 
+// =====================================================================================================================
+// Writes the device-wide and per-queue metrics. This is called from the DevDriver message thread so everything read
+// here must either be atomic or protected by a lock.
+void Device::WriteMetrics(
+    DevDriver::IStructuredWriter* pWriter)
+{
+    pWriter->BeginMap();
+
+    pWriter->KeyAndValue("name", &m_gpuName[0]);
+    pWriter->KeyAndValue("cmdAllocations", m_metrics.cmdAllocations);
+    pWriter->KeyAndValue("cmdChunks", m_metrics.cmdChunks);
+    pWriter->KeyAndValue("contendedLocks", m_metrics.contendedLocks);
+
+    // Report each initialization phase in microseconds.
+    const uint64 perfFrequency = GetPerfFrequency();
+
+    pWriter->KeyAndBeginMap("initTimesUs");
+    pWriter->KeyAndValue("settingsFileLoad", m_initTimes.settingsFileLoad * 1000000 / perfFrequency);
+    pWriter->KeyAndValue("settingsRead", m_initTimes.settingsRead * 1000000 / perfFrequency);
+    pWriter->KeyAndValue("earlyInit", m_initTimes.earlyInit * 1000000 / perfFrequency);
+    pWriter->KeyAndValue("commitSettings", m_initTimes.commitSettings * 1000000 / perfFrequency);
+    pWriter->KeyAndValue("finalize", m_initTimes.finalize * 1000000 / perfFrequency);
+    pWriter->EndMap();
+
+    InternalMemPoolUsage poolUsage = {};
+    m_memMgr.GetPoolUsage(&poolUsage);
+
+    pWriter->KeyAndBeginMap("internalMemPools");
+    pWriter->KeyAndValue("poolCount", poolUsage.poolCount);
+    pWriter->KeyAndValue("poolBytes", poolUsage.poolBytes);
+    pWriter->KeyAndValue("suballocationCount", poolUsage.suballocationCount);
+    pWriter->EndMap();
+
+    pWriter->KeyAndBeginList("queues");
+    {
+        MutexAuto lock(&m_queueLock);
+
+        for (auto iter = m_queues.Begin(); iter.IsValid(); iter.Next())
+        {
+            const Queue*const        pQueue  = iter.Get();
+            const QueueMetrics&      metrics = pQueue->Metrics();
+
+            pWriter->BeginMap();
+            pWriter->KeyAndValue("queueType", static_cast<uint32>(pQueue->Type()));
+            pWriter->KeyAndValue("engineType", static_cast<uint32>(pQueue->GetEngineType()));
+            pWriter->KeyAndValue("engineIndex", pQueue->EngineId());
+            pWriter->KeyAndValue("submits", metrics.submitCount);
+            pWriter->KeyAndValue("cmdBuffers", metrics.cmdBufferCount);
+            pWriter->KeyAndValue("residencyListRebuilds", metrics.residencyListRebuilds);
+
+            if (pQueue->UsesAsyncSubmission())
+            {
+                // Report the average time a submission spent waiting on the submission thread in microseconds.
+                const uint64 avgLatencyUs = (metrics.asyncSubmitCount > 0) ?
+                    ((metrics.asyncSubmitLatency / metrics.asyncSubmitCount) * 1000000 / GetPerfFrequency()) : 0;
+
+                pWriter->KeyAndValue("pendingSubmits", pQueue->PendingSubmissionCount());
+                pWriter->KeyAndValue("maxPendingSubmits", metrics.maxPendingSubmits);
+                pWriter->KeyAndValue("asyncSubmits", metrics.asyncSubmitCount);
+                pWriter->KeyAndValue("avgAsyncSubmitLatencyUs", avgLatencyUs);
+            }
+            pWriter->EndMap();
+        }
+    }
+    pWriter->EndList();
+
+    pWriter->EndMap();
+}
+
 // =====================================================================================================================
 // Determines the start (inclusive) and end (exclusive) virtual addresses for the specified virtual address range.
 void Device::VirtualAddressRange(
@@ -4516,6 +4899,11 @@ void Device::IncFrameCount()
     m_cmdBufDumpEnabled = IsKeyPressed(KeyCode::Shift_F10);
 #endif
     Util::AtomicIncrement(&m_frameCnt);
+
+#if PAL_ENABLE_CPU_TRACE
+    // Frame boundaries are a convenient, regular point to hand the recorded zones to tools.
+    m_pPlatform->GetCpuTracer()->Flush();
+#endif
 }
 
 // =====================================================================================================================
@@ -4999,15 +5387,23 @@ Result Device::CreateInternalCopyQueues()
 }
 
 // =====================================================================================================================
-// Performs a CP DMA copy from a cpu accessible buffer to gpu memory.
+// Performs a CP DMA copy from a cpu accessible buffer to gpu memory.  The source data is copied into embedded data
+// immediately, so the caller may free it as soon as this returns.  If a pipeline upload batch is open, the copy is only
+// recorded and will be submitted when the batch is closed (or when the batch grows too large).  The ID of the batch
+// holding the copy is returned in pUploadBatchId so that the caller can later tell whether it is still pending.
 Result Device::CopyUsingEmbeddedData(
     const void* pSrcMem,
     gpusize     copySize,
     gpusize     destOffset,
-    GpuMemory*  pDstGpuMemory)
+    GpuMemory*  pDstGpuMemory,
+    uint64*     pUploadBatchId)
 {
     PAL_ASSERT(pSrcMem != nullptr);
 
+    // Upper bound on the amount of data we'll accumulate in the copy command buffer before forcing a submit, even if
+    // a pipeline upload batch is still open.  This keeps the embedded data footprint of huge batches bounded.
+    constexpr gpusize MaxBatchedUploadBytes = (16 * 1024 * 1024);
+
     MutexAuto lock(&m_copyCmdBufferLock);
     Result result = Result::Success;
 
@@ -5018,14 +5414,26 @@ Result Device::CopyUsingEmbeddedData(
 
     if ((result == Result::Success) && (copySize > 0))
     {
-        CmdBufferBuildFlags flags     = { };
-        flags.optimizeExclusiveSubmit = true;
-        flags.optimizeOneTimeSubmit   = true;
+        if (m_internalCopyCmdBufferRecording == false)
+        {
+            CmdBufferBuildFlags flags     = { };
+            flags.optimizeExclusiveSubmit = true;
+            flags.optimizeOneTimeSubmit   = true;
+
+            CmdBufferBuildInfo buildInfo = { };
+            buildInfo.flags              = flags;
+            result = m_pInternalCopyCmdBuffer->Begin(buildInfo);
 
-        CmdBufferBuildInfo buildInfo = { };
-        buildInfo.flags              = flags;
-        m_pInternalCopyCmdBuffer->Begin(buildInfo);
+            if (result == Result::Success)
+            {
+                m_internalCopyCmdBufferRecording = true;
+                m_uploadBatchId++;
+            }
+        }
+    }
 
+    if ((result == Result::Success) && (copySize > 0))
+    {
         int64 bytesLeft                = copySize;
         const uint32 embeddedDataLimit = m_pInternalCopyCmdBuffer->GetEmbeddedDataLimit() * sizeof(uint32);
         gpusize dstOffset              = destOffset;
@@ -5059,6 +5467,31 @@ Result Device::CopyUsingEmbeddedData(
 
         } while (bytesLeft > 0);
 
+        m_pendingPipelineUploadBytes += copySize;
+
+        if (pUploadBatchId != nullptr)
+        {
+            *pUploadBatchId = m_uploadBatchId;
+        }
+
+        if ((m_pipelineUploadBatchDepth == 0) || (m_pendingPipelineUploadBytes >= MaxBatchedUploadBytes))
+        {
+            result = SubmitInternalCopyCmdBuffer();
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Ends, submits and resets the internal copy command buffer, waiting for the copies to complete.  The caller must hold
+// the copy command buffer lock.
+Result Device::SubmitInternalCopyCmdBuffer()
+{
+    Result result = Result::Success;
+
+    if (m_internalCopyCmdBufferRecording)
+    {
         result = m_pInternalCopyCmdBuffer->End();
 
         if (result == Result::Success)
@@ -5079,11 +5512,63 @@ Result Device::CopyUsingEmbeddedData(
 
         // Reset the command buffer after the submission.
         m_pInternalCopyCmdBuffer->Reset(nullptr, true);
+
+        m_internalCopyCmdBufferRecording = false;
+        m_pendingPipelineUploadBytes     = 0;
+
+        // InternalDmaSubmit waits for the copies, so everything recorded into this batch has landed.
+        m_submittedUploadBatchId.store(m_uploadBatchId, std::memory_order_release);
     }
 
     return result;
 }
 
+// =====================================================================================================================
+// Submits any pipeline uploads recorded as part of an open batch without closing the batch.  This is needed before
+// the destination memory of a batched upload can be released.
+Result Device::FlushPipelineUploadBatch()
+{
+    MutexAuto lock(&m_copyCmdBufferLock);
+
+    return SubmitInternalCopyCmdBuffer();
+}
+
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 573
+// =====================================================================================================================
+Result Device::BeginPipelineUploadBatch()
+{
+    MutexAuto lock(&m_copyCmdBufferLock);
+
+    m_pipelineUploadBatchDepth++;
+
+    return Result::Success;
+}
+
+// =====================================================================================================================
+Result Device::EndPipelineUploadBatch()
+{
+    MutexAuto lock(&m_copyCmdBufferLock);
+
+    Result result = Result::Success;
+
+    if (m_pipelineUploadBatchDepth == 0)
+    {
+        result = Result::ErrorUnavailable;
+    }
+    else
+    {
+        m_pipelineUploadBatchDepth--;
+
+        if (m_pipelineUploadBatchDepth == 0)
+        {
+            result = SubmitInternalCopyCmdBuffer();
+        }
+    }
+
+    return result;
+}
+#endif
+
 // =====================================================================================================================
 // Performs a DMA queue submit and waits for its completion. Assumes the command buffers in the SubmitInfo are DMA
 // command buffers.
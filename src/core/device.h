@@ -45,6 +45,7 @@
 #endif
 #include "palSysMemory.h"
 #include "palTextWriter.h"
+#include <atomic>
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 556
 #include "palShaderLibrary.h"
 #endif
@@ -55,12 +56,14 @@ typedef void* ADDR_HANDLE;
 
 namespace Util { enum class ValueType : uint32; }
 namespace Util { namespace MetroHash { struct Hash; } }
+namespace DevDriver { class IStructuredWriter; }
 
 namespace Pal
 {
 
 class  CmdAllocator;
 class  CmdBuffer;
+class  CmdBufDumpWriter;
 class  Fence;
 class  GpuMemory;
 class  OssDevice;
@@ -975,6 +978,29 @@ struct GpuChipProperties
 // Helper function that calculates memory ops per clock for a given memory type.
 uint32 MemoryOpsPerClock(LocalMemoryType memoryType);
 
+// =====================================================================================================================
+// Cheap, always-on device-wide counters reported by the DevDriver "metrics" URI service. They may be updated by any
+// thread, so all updates must be atomic.
+struct DeviceMetrics
+{
+    volatile uint64 cmdAllocations;  // Command stream allocations created by this device's command allocators.
+    volatile uint64 cmdChunks;       // Command chunks carved out of those allocations.
+    volatile uint64 contendedLocks;  // Acquisitions of tracked device locks which had to wait for another thread.
+};
+
+// =====================================================================================================================
+// CPU time spent in each one-time initialization phase of a device, in performance counter ticks. These are recorded
+// once on the thread which initializes the device and are reported by the DevDriver "metrics" URI service so startup
+// latency can be tracked without a profiler.
+struct DeviceInitTimes
+{
+    uint64 settingsFileLoad;  // Locating and parsing the settings file.
+    uint64 settingsRead;      // Creating the settings loaders and reading every setting from the parsed file.
+    uint64 earlyInit;         // All of EarlyInit(), including the two phases above.
+    uint64 commitSettings;    // CommitSettingsAndInit(), including the device's late initialization.
+    uint64 finalize;          // Finalize().
+};
+
 // =====================================================================================================================
 // Represents a client-configurable context for a particular physical GPU. Responsibilities include allocating GDS
 // partitions. Also serves as a factory for other child objects, such as Command Buffers.
@@ -1338,6 +1364,14 @@ public:
         void*                             pPlacementAddr,
         IPipeline**                       ppPipeline) override;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 573
+    // NOTE: Part of the public IDevice interface.
+    virtual Result BeginPipelineUploadBatch() override;
+
+    // NOTE: Part of the public IDevice interface.
+    virtual Result EndPipelineUploadBatch() override;
+#endif
+
     // NOTE: Part of the public IDevice interface.
     virtual size_t GetMsaaStateSize(
         const MsaaStateCreateInfo& createInfo,
@@ -1757,12 +1791,36 @@ public:
 
 #if PAL_ENABLE_PRINTS_ASSERTS
     bool IsCmdBufDumpEnabled() const { return m_cmdBufDumpEnabled; }
+
+    // Returns the compressed command buffer dump writer, or null if compressed dumps are disabled.
+    CmdBufDumpWriter* GetCmdBufDumpWriter() const { return m_pCmdBufDumpWriter; }
 #endif
     uint32 GetFrameCount() const { return m_frameCnt; }
     void IncFrameCount();
 
     ImageTexOptLevel TexOptLevel() const { return m_texOptLevel; }
 
+    // Returns the client's pipeline register cache, or nullptr if the client didn't provide one.
+    Util::ICacheLayer* PipelineRegisterCache() const { return m_pPipelineRegCache; }
+    // Returns a digest of the client's platform key, which is mixed into every pipeline register cache entry's key.
+    uint64 PipelineRegisterCacheSalt() const { return m_pipelineRegCacheSalt; }
+
+    DeviceMetrics* Metrics() { return &m_metrics; }
+
+    // Acquires a lock that is commonly shared between threads, counting the acquisition in the device metrics if it
+    // had to wait for another thread to release it.
+    void LockAndTrackContention(Util::Mutex* pLock)
+    {
+        if (pLock->TryLock() == false)
+        {
+            Util::AtomicIncrement64(&m_metrics.contendedLocks);
+            pLock->Lock();
+        }
+    }
+
+    // Writes this device's metrics and those of its queues as a structured map.
+    void WriteMetrics(DevDriver::IStructuredWriter* pWriter);
+
     void ApplyDevOverlay(const IImage& dstImage, ICmdBuffer* pCmdBuffer) const;
 
     bool PhysicalEnginesAvailable() const { return m_flags.physicalEnginesAvailable; }
@@ -1826,7 +1884,18 @@ public:
 
     virtual bool ValidatePipelineUploadHeap(const GpuHeap& preferredHeap) const;
     Result InternalDmaSubmit(const MultiSubmitInfo& submitInfo);
-    Result CopyUsingEmbeddedData(const void* pSrcData, gpusize copySize, gpusize dstOffset, GpuMemory* pDstGpuMem);
+    Result CopyUsingEmbeddedData(
+        const void* pSrcData,
+        gpusize     copySize,
+        gpusize     dstOffset,
+        GpuMemory*  pDstGpuMem,
+        uint64*     pUploadBatchId = nullptr);
+    Result FlushPipelineUploadBatch();
+
+    // Returns true if the copy command buffer batch with the given ID (as returned by CopyUsingEmbeddedData) has not
+    // been submitted yet.  An ID of zero never refers to a pending batch.
+    bool IsPipelineUploadPending(uint64 uploadBatchId) const
+        { return (uploadBatchId > m_submittedUploadBatchId.load(std::memory_order_acquire)); }
 
     // Add or subtract some memory from our per-heap totals. We refcount each added GPU memory object so it's safe
     // to add memory multiple times or subtract it multiple times.
@@ -1865,6 +1934,13 @@ protected:
     void InitMemoryHeapProperties();
     Result InitSettings();
 
+    // Device property snapshots let short-lived processes skip deriving the chip, engine and perf experiment
+    // properties. Both are no-ops unless the client provided a snapshot key at platform creation. The OS key should
+    // identify the kernel driver and raw device info the properties were derived from; null devices don't have one
+    // and skip that check when loading.
+    bool LoadPropertySnapshot(uint64 osKey, bool matchOsKey);
+    void SavePropertySnapshot(uint64 osKey) const;
+
     virtual Result OsEarlyInit() = 0;
     virtual Result OsLateInit() = 0;
 
@@ -1931,6 +2007,7 @@ protected:
 
     // Helpers for creating queues for PAL internal use.
     Result CreateInternalCopyCmdBuffer();
+    Result SubmitInternalCopyCmdBuffer();
     Result CreateInternalCopyQueues();
     Result CreateInternalQueue(const QueueCreateInfo& queueCreatInfo,
                                Queue**                ppQueue,
@@ -1986,6 +2063,8 @@ protected:
     bool  m_settingsCommitted;  // Set if the client has ever called CommitSettingsAndInit().
     bool  m_deviceFinalized;    // Set if the client has ever call Finalize().
     bool  m_cmdBufDumpEnabled;  // Command buffer dumping is enabled on the next frame
+
+    CmdBufDumpWriter* m_pCmdBufDumpWriter; // Writes submit-time dumps into a compressed container, if enabled.
 #endif
 
     const bool m_force32BitVaSpace;  // Forces 32 bit virtual address space
@@ -2022,6 +2101,8 @@ protected:
     Util::SettingsFileMgr<Platform>  m_settingsMgr;
 #endif
 
+    DeviceInitTimes        m_initTimes; // Durations of this device's one-time initialization phases.
+
     // Get*FilePath need to return a persistent storage
     char m_cacheFilePath[MaxPathStrLen];
     char m_debugFilePath[MaxPathStrLen];
@@ -2031,9 +2112,16 @@ protected:
 
     Util::Mutex m_copyCmdBufferLock;
     CmdBuffer* m_pInternalCopyCmdBuffer;
+    bool       m_internalCopyCmdBufferRecording;   // True if copies have been recorded but not yet submitted.
+    uint32     m_pipelineUploadBatchDepth;         // Nesting depth of BeginPipelineUploadBatch() calls.
+    gpusize    m_pendingPipelineUploadBytes;       // Bytes recorded into the copy command buffer since the last submit.
+    uint64     m_uploadBatchId;                    // ID of the batch currently (or most recently) being recorded.
+    std::atomic<uint64> m_submittedUploadBatchId;  // ID of the most recently submitted batch.
 
 private:
     Result HwlEarlyInit();
+
+    void   GetPropertySnapshotPath(char* pPath, size_t pathSize) const;
     void   InitPageFaultDebugSrd();
     Result InitDummyChunkMem();
     Result CreateInternalCmdAllocators();
@@ -2061,7 +2149,10 @@ private:
     const uint32           m_maxSemaphoreCount; // The OS-specific GPU semaphore max signal count.
     volatile uint32        m_frameCnt;  // Device frame count
     ImageTexOptLevel       m_texOptLevel; // Client specified texture optimize level for internally-created views
+    Util::ICacheLayer*     m_pPipelineRegCache;    // Client cache layer for derived pipeline register state.
+    uint64                 m_pipelineRegCacheSalt; // Platform key digest for m_pPipelineRegCache entries.
     ScreenColorSpace       m_hdrColorspaceFormat;  // Current HDR Colorspace Format
+    DeviceMetrics          m_metrics;
 
     PAL_DISALLOW_DEFAULT_CTOR(Device);
     PAL_DISALLOW_COPY_AND_ASSIGN(Device);
@@ -2096,6 +2187,11 @@ private:
 // void InitializePerfExperimentProperties(const GpuChipProperties&, PerfExperimentProperties*);
 // * This function is used to setup default values for the fields in the PerfExperimentProperties structure for
 //   certain GFXIP levels.
+//
+// void InitializeNullSrds(GpuChipProperties*);
+// * This function is used to point the null SRD fields of GpuChipProperties at the hardware layer's static null
+//   descriptors. It is called by InitializeGpuChipProperties() and again whenever the chip properties are restored
+//   from a device property snapshot instead of being derived.
 
 #if PAL_BUILD_GFX6
 namespace Gfx6
@@ -2124,6 +2220,10 @@ extern void InitializePerfExperimentProperties(
     const GpuChipProperties&  chipProps,
     PerfExperimentProperties* pProperties);
 
+// Points the GPU chip properties at the static null SRDs for GFXIP 6/7/8 hardware.
+extern void InitializeNullSrds(
+    GpuChipProperties* pInfo);
+
 // Initialize default values for the GPU engine properties for GFXIP 6/7/8 hardware.
 extern void InitializeGpuEngineProperties(
     GfxIpLevel           gfxIpLevel,
@@ -2162,6 +2262,10 @@ extern void FinalizeGpuChipProperties(
     const Device&      device,
     GpuChipProperties* pInfo);
 
+// Points the GPU chip properties at the static null SRDs for GFXIP9+ hardware.
+extern void InitializeNullSrds(
+    GpuChipProperties* pInfo);
+
 // Initialize default values for the GPU engine properties for GFXIP9+ hardware.
 extern void InitializeGpuEngineProperties(
     const GpuChipProperties&  chipProps,
@@ -68,7 +68,9 @@ DmaCmdBuffer::DmaCmdBuffer(
     m_predInternalAddr(0),
     m_predCopyData(0),
     m_pT2tEmbeddedGpuMemory(nullptr),
-    m_t2tEmbeddedMemOffset(0)
+    m_t2tEmbeddedMemOffset(0),
+    m_pT2tPingPongGpuMemory(nullptr),
+    m_t2tPingPongMemOffset(0)
 {
     PAL_ASSERT(createInfo.queueType == QueueTypeDma);
 
@@ -138,6 +140,7 @@ Result DmaCmdBuffer::BeginCommandStreams(
     if (doReset)
     {
         m_pT2tEmbeddedGpuMemory = nullptr;
+        m_pT2tPingPongGpuMemory = nullptr;
         m_cmdStream.Reset(nullptr, true);
     }
 
@@ -209,8 +212,9 @@ Result DmaCmdBuffer::Reset(
 {
     Result result = CmdBuffer::Reset(pCmdAllocator, returnGpuMemory);
 
-    // The next scanline-based tile-to-tile copy will need to allocate a new embedded memory object
+    // The next scanline-based tile-to-tile copy will need to allocate new embedded memory objects
     m_pT2tEmbeddedGpuMemory = nullptr;
+    m_pT2tPingPongGpuMemory = nullptr;
 
     m_cmdStream.Reset(static_cast<CmdAllocator*>(pCmdAllocator), returnGpuMemory);
 
@@ -665,6 +669,10 @@ void DmaCmdBuffer::WriteCopyImageTiledToTiledCmdChunkCopy(
     // Calculate the maximum number of pixels we can copy per pass in the below loop
     const uint32 embeddedDataLimitBytes = GetEmbeddedDataLimit() * sizeof(uint32);
 
+    // Chunks which don't cover the full copy extent are trimmed to a multiple of the micro-tile dimensions so that
+    // each chunk touches whole micro-tiles in the tiled images wherever possible.
+    constexpr uint32 ChunkAlignment = 8;
+
     // How big a window can we copy given our linear data limit?
     uint32 widthToCopy   = 1;
     uint32 heightToCopy  = 1;
@@ -674,12 +682,20 @@ void DmaCmdBuffer::WriteCopyImageTiledToTiledCmdChunkCopy(
     if (embeddedDataLimitBytes > copySizeBytes)
     {
         //Widen the copy area to possibly fit more texels.
-        widthToCopy   = Min((embeddedDataLimitBytes / copySizeBytes), imageCopyInfo.copyExtent.width);
+        widthToCopy = Min((embeddedDataLimitBytes / copySizeBytes), imageCopyInfo.copyExtent.width);
+        if ((widthToCopy < imageCopyInfo.copyExtent.width) && (widthToCopy >= ChunkAlignment))
+        {
+            widthToCopy = Pow2AlignDown(widthToCopy, ChunkAlignment);
+        }
         copySizeBytes = widthToCopy * src.bytesPerPixel;
         if (embeddedDataLimitBytes > copySizeBytes)
         {
             //Heighten the copy area to possibly fit more rows.
-            heightToCopy  = Min((embeddedDataLimitBytes / copySizeBytes), imageCopyInfo.copyExtent.height);
+            heightToCopy = Min((embeddedDataLimitBytes / copySizeBytes), imageCopyInfo.copyExtent.height);
+            if ((heightToCopy < imageCopyInfo.copyExtent.height) && (heightToCopy >= ChunkAlignment))
+            {
+                heightToCopy = Pow2AlignDown(heightToCopy, ChunkAlignment);
+            }
             copySizeBytes = widthToCopy * heightToCopy * src.bytesPerPixel;
             if (embeddedDataLimitBytes > copySizeBytes)
             {
@@ -704,6 +720,23 @@ void DmaCmdBuffer::WriteCopyImageTiledToTiledCmdChunkCopy(
         PAL_ASSERT(m_pT2tEmbeddedGpuMemory != nullptr);
     }
 
+    // A second staging buffer lets the tiled-to-linear copy of each chunk overlap the linear-to-tiled copy of the
+    // previous one.  Like the first buffer, it lives for the rest of this command buffer's lifetime.
+    if (m_pT2tPingPongGpuMemory == nullptr)
+    {
+        CmdAllocateEmbeddedData(GetEmbeddedDataLimit(),
+                                1, // SDMA can access dword aligned linear data.
+                                &m_pT2tPingPongGpuMemory,
+                                &m_t2tPingPongMemOffset);
+    }
+
+    // Fall back to a single staging buffer (and a barrier after each half of every chunk) if the second buffer
+    // couldn't be allocated.
+    const bool    doubleBuffered      = (m_pT2tPingPongGpuMemory != nullptr);
+    GpuMemory*    pStagingMem[2]      = { m_pT2tEmbeddedGpuMemory, m_pT2tPingPongGpuMemory };
+    const gpusize stagingMemOffset[2] = { m_t2tEmbeddedMemOffset,  m_t2tPingPongMemOffset  };
+    uint32        chunkIdx            = 0;
+
     // A lot of the parameters are a constant for each copy region, so set those up here.
     MemoryImageCopyRegion  linearDstCopyRgn = {};
     linearDstCopyRgn.imageSubres        = src.pSubresInfo->subresId;
@@ -717,6 +750,9 @@ void DmaCmdBuffer::WriteCopyImageTiledToTiledCmdChunkCopy(
     // Tiled to tiled copies have been determined to not work for this case, so a dual-stage copy is required.
     // Because we have a limit on the amount of embedded data, we're going to do the copy chunk by chunk.
     // First by trying to go scanline by scanline, then groups of scanlines, then groups of [slices|depth].
+    // Consecutive chunks alternate between the two staging buffers, so only one barrier is needed per chunk: it
+    // guarantees both that the chunk has landed in its staging buffer and that the previous chunk has finished
+    // reading from the other buffer before the next chunk overwrites it.
     Pal::HwPipePoint  pipePoints   = HwPipePoint::HwPipeBottom;
     Pal::BarrierInfo  barrierInfo  = {};
     barrierInfo.pipePointWaitCount = 1;
@@ -799,22 +835,39 @@ void DmaCmdBuffer::WriteCopyImageTiledToTiledCmdChunkCopy(
                 linearDstCopyRgn.imageOffset.x = src.offset.x + xIdx;
                 tiledDstCopyRgn.imageOffset.x  = dst.offset.x + xIdx;
 
+                const uint32     bufferIdx  = doubleBuffered ? (chunkIdx & 1) : 0;
+                const GpuMemory& stagingMem = *pStagingMem[bufferIdx];
+
+                linearDstCopyRgn.gpuMemoryOffset = stagingMemOffset[bufferIdx];
+                tiledDstCopyRgn.gpuMemoryOffset  = stagingMemOffset[bufferIdx];
+
                 pCmdSpace  = m_cmdStream.ReserveCommands();
-                pCmdSpace = WriteCopyTiledImageToMemCmd(src, *m_pT2tEmbeddedGpuMemory, linearDstCopyRgn, pCmdSpace);
+                pCmdSpace = WriteCopyTiledImageToMemCmd(src, stagingMem, linearDstCopyRgn, pCmdSpace);
                 m_cmdStream.CommitCommands(pCmdSpace);
 
                 // Potentially have to wait for the copy to finish before we transfer out of that memory
                 CmdBarrier(barrierInfo);
 
                 pCmdSpace  = m_cmdStream.ReserveCommands();
-                pCmdSpace = WriteCopyMemToTiledImageCmd(*m_pT2tEmbeddedGpuMemory, dst, tiledDstCopyRgn, pCmdSpace);
+                pCmdSpace = WriteCopyMemToTiledImageCmd(stagingMem, dst, tiledDstCopyRgn, pCmdSpace);
                 m_cmdStream.CommitCommands(pCmdSpace);
 
-                // Wait for this copy to finish before we re-use the temp-linear buffer above.
-                CmdBarrier(barrierInfo);
+                if (doubleBuffered == false)
+                {
+                    // Wait for this copy to finish before we re-use the temp-linear buffer above.
+                    CmdBarrier(barrierInfo);
+                }
+
+                ++chunkIdx;
             }
         }
     }
+
+    if (doubleBuffered && (chunkIdx > 0))
+    {
+        // Wait for the final chunk to finish before the staging buffers can be re-used by a later copy.
+        CmdBarrier(barrierInfo);
+    }
 }
 
 // =====================================================================================================================
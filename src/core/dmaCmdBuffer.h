@@ -353,6 +353,8 @@ private:
 
     GpuMemory*   m_pT2tEmbeddedGpuMemory;    // Temp memory used for scanline tile-to-tile copies.
     gpusize      m_t2tEmbeddedMemOffset;
+    GpuMemory*   m_pT2tPingPongGpuMemory;    // Second temp buffer which double-buffers scanline tile-to-tile copies.
+    gpusize      m_t2tPingPongMemOffset;
 
     PAL_DISALLOW_COPY_AND_ASSIGN(DmaCmdBuffer);
     PAL_DISALLOW_DEFAULT_CTOR(DmaCmdBuffer);
@@ -72,6 +72,7 @@ void PlatformSettingsLoader::SetupDefaults()
 #endif
 
     m_settings.enableEventLogFile = false;
+    m_settings.enableCpuTraceFile = false;
 #if   (__unix__)
     memset(m_settings.eventLogDirectory, 0, 512);
     strncpy(m_settings.eventLogDirectory, "amdpal/", 512);
@@ -251,6 +252,11 @@ void PlatformSettingsLoader::ReadSettings(Pal::Device* pDevice)
                            &m_settings.enableEventLogFile,
                            InternalSettingScope::PrivatePalKey);
 
+    pDevice->ReadSetting(pEnableCpuTraceFileStr,
+                           Util::ValueType::Boolean,
+                           &m_settings.enableCpuTraceFile,
+                           InternalSettingScope::PrivatePalKey);
+
     pDevice->ReadSetting(pDebugOverlayEnabledStr,
                            Util::ValueType::Boolean,
                            &m_settings.debugOverlayEnabled,
@@ -718,6 +724,11 @@ void PlatformSettingsLoader::InitSettingsInfo()
     info.valueSize = sizeof(m_settings.enableEventLogFile);
     m_settingsInfoMap.Insert(3288205286, info);
 
+    info.type      = SettingType::Boolean;
+    info.pValuePtr = &m_settings.enableCpuTraceFile;
+    info.valueSize = sizeof(m_settings.enableCpuTraceFile);
+    m_settingsInfoMap.Insert(977156031, info);
+
     info.type      = SettingType::String;
     info.pValuePtr = &m_settings.eventLogDirectory;
     info.valueSize = sizeof(m_settings.eventLogDirectory);
@@ -113,6 +113,7 @@ struct PalPlatformSettings : public Pal::DriverSettings
 #endif
 
     bool                                        enableEventLogFile;
+    bool                                        enableCpuTraceFile;
     char                                        eventLogDirectory[MaxPathStrLen];
     char                                        eventLogFilename[MaxPathStrLen];
 
@@ -249,6 +250,7 @@ static const char* pAlertsEnabledStr = "#3333004859";
 #endif
 
 static const char* pEnableEventLogFileStr = "#3288205286";
+static const char* pEnableCpuTraceFileStr = "#977156031";
 
 static const char* pDebugOverlayEnabledStr = "#3362163801";
 static const char* pDebugOverlayConfig_VisualConfirmEnabledStr = "#1802476957";
@@ -327,7 +329,7 @@ static const char* pInterfaceLoggerConfig_MultithreadedStr = "#4177532476";
 static const char* pInterfaceLoggerConfig_BasePresetStr = "#3886684530";
 static const char* pInterfaceLoggerConfig_ElevatedPresetStr = "#3991423149";
 
-static const uint32 g_palPlatformNumSettings = 93;
+static const uint32 g_palPlatformNumSettings = 94;
 static const SettingNameHash g_palPlatformSettingHashList[] = {
 #if PAL_ENABLE_PRINTS_ASSERTS
 87264462,
@@ -362,6 +364,7 @@ static const SettingNameHash g_palPlatformSettingHashList[] = {
 #endif
 
 3288205286,
+977156031,
 3789517094,
 3387502554,
 
@@ -57,6 +57,8 @@ void SettingsLoader::SetupDefaults()
     m_settings.textureOptLevel = 1;
     m_settings.catalystAI = 1;
     m_settings.forcePreambleCmdStream = true;
+    m_settings.asyncSubmitQueueTypeMask = 0;
+    m_settings.asyncSubmitQueueDepth = 8;
     m_settings.maxNumCmdStreamsPerSubmit = 0;
     m_settings.requestHighPriorityVmid = false;
     m_settings.requestDebugVmid = false;
@@ -75,6 +77,8 @@ void SettingsLoader::SetupDefaults()
     m_settings.addr2DisableSModes8BppColor = false;
     m_settings.overlayReportHDR = true;
     m_settings.preferredPipelineUploadHeap = PipelineHeapDeferToClient;
+    m_settings.enablePipelineCodeDedup = true;
+    m_settings.rpmPipelineCreateMode = RpmPipelineCreateLazy;
 
     m_settings.forceHeapPerfToFixedValues = false;
     m_settings.cpuReadPerfForLocal = 1;
@@ -103,6 +107,7 @@ void SettingsLoader::SetupDefaults()
     m_settings.disableSyncObject = false;
     m_settings.cmdBufDumpMode = CmdBufDumpModeDisabled;
     m_settings.cmdBufDumpFormat = CmdBufDumpFormatText;
+    m_settings.cmdBufDumpCompressed = false;
 #if   (__unix__)
     memset(m_settings.cmdBufDumpDirectory, 0, 512);
     strncpy(m_settings.cmdBufDumpDirectory, "amdpal/", 512);
@@ -127,6 +132,7 @@ void SettingsLoader::SetupDefaults()
     m_settings.cmdStreamMemsetValue = 4294967295;
     m_settings.cmdBufChunkEnableStagingBuffer = false;
     m_settings.cmdAllocatorFreeOnReset = false;
+    m_settings.cmdAllocatorLinearAllocCommitAhead = 0x4000;
     m_settings.cmdBufOptimizePm4 = Pm4OptDefaultEnable;
     m_settings.cmdBufForceCpuUpdatePath = CmdBufForceCpuUpdatePathOn;
     m_settings.cmdBufForceOneTimeSubmit = CmdBufForceOneTimeSubmitDefault;
@@ -179,6 +185,16 @@ void SettingsLoader::ReadSettings()
                            &m_settings.forcePreambleCmdStream,
                            InternalSettingScope::PrivatePalKey);
 
+    static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pAsyncSubmitQueueTypeMaskStr,
+                           Util::ValueType::Uint,
+                           &m_settings.asyncSubmitQueueTypeMask,
+                           InternalSettingScope::PrivatePalKey);
+
+    static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pAsyncSubmitQueueDepthStr,
+                           Util::ValueType::Uint,
+                           &m_settings.asyncSubmitQueueDepth,
+                           InternalSettingScope::PrivatePalKey);
+
     static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pMaxNumCmdStreamsPerSubmitStr,
                            Util::ValueType::Uint,
                            &m_settings.maxNumCmdStreamsPerSubmit,
@@ -264,6 +280,16 @@ void SettingsLoader::ReadSettings()
                            &m_settings.preferredPipelineUploadHeap,
                            InternalSettingScope::PrivatePalKey);
 
+    static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pEnablePipelineCodeDedupStr,
+                           Util::ValueType::Boolean,
+                           &m_settings.enablePipelineCodeDedup,
+                           InternalSettingScope::PrivatePalKey);
+
+    static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pRpmPipelineCreateModeStr,
+                           Util::ValueType::Uint,
+                           &m_settings.rpmPipelineCreateMode,
+                           InternalSettingScope::PrivatePalKey);
+
     static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pForceHeapPerfToFixedValuesStr,
                            Util::ValueType::Boolean,
                            &m_settings.forceHeapPerfToFixedValues,
@@ -329,6 +355,11 @@ void SettingsLoader::ReadSettings()
                            &m_settings.cmdBufDumpFormat,
                            InternalSettingScope::PrivatePalKey);
 
+    static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pCmdBufDumpCompressedStr,
+                           Util::ValueType::Boolean,
+                           &m_settings.cmdBufDumpCompressed,
+                           InternalSettingScope::PrivatePalKey);
+
     static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pCmdBufDumpDirectoryStr,
                            Util::ValueType::Str,
                            &m_settings.cmdBufDumpDirectory,
@@ -421,6 +452,11 @@ void SettingsLoader::ReadSettings()
                            &m_settings.cmdAllocatorFreeOnReset,
                            InternalSettingScope::PrivatePalKey);
 
+    static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pCmdAllocatorLinearAllocCommitAheadStr,
+                           Util::ValueType::Uint,
+                           &m_settings.cmdAllocatorLinearAllocCommitAhead,
+                           InternalSettingScope::PrivatePalKey);
+
     static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pCmdBufOptimizePm4Str,
                            Util::ValueType::Uint,
                            &m_settings.cmdBufOptimizePm4,
@@ -593,6 +629,16 @@ void SettingsLoader::InitSettingsInfo()
     info.valueSize = sizeof(m_settings.forcePreambleCmdStream);
     m_settingsInfoMap.Insert(2987947496, info);
 
+    info.type      = SettingType::Uint;
+    info.pValuePtr = &m_settings.asyncSubmitQueueTypeMask;
+    info.valueSize = sizeof(m_settings.asyncSubmitQueueTypeMask);
+    m_settingsInfoMap.Insert(3240569230, info);
+
+    info.type      = SettingType::Uint;
+    info.pValuePtr = &m_settings.asyncSubmitQueueDepth;
+    info.valueSize = sizeof(m_settings.asyncSubmitQueueDepth);
+    m_settingsInfoMap.Insert(1357330199, info);
+
     info.type      = SettingType::Uint;
     info.pValuePtr = &m_settings.maxNumCmdStreamsPerSubmit;
     info.valueSize = sizeof(m_settings.maxNumCmdStreamsPerSubmit);
@@ -678,6 +724,16 @@ void SettingsLoader::InitSettingsInfo()
     info.valueSize = sizeof(m_settings.preferredPipelineUploadHeap);
     m_settingsInfoMap.Insert(1170638299, info);
 
+    info.type      = SettingType::Boolean;
+    info.pValuePtr = &m_settings.enablePipelineCodeDedup;
+    info.valueSize = sizeof(m_settings.enablePipelineCodeDedup);
+    m_settingsInfoMap.Insert(3977322071, info);
+
+    info.type      = SettingType::Uint;
+    info.pValuePtr = &m_settings.rpmPipelineCreateMode;
+    info.valueSize = sizeof(m_settings.rpmPipelineCreateMode);
+    m_settingsInfoMap.Insert(2279492967, info);
+
     info.type      = SettingType::Boolean;
     info.pValuePtr = &m_settings.forceHeapPerfToFixedValues;
     info.valueSize = sizeof(m_settings.forceHeapPerfToFixedValues);
@@ -813,6 +869,11 @@ void SettingsLoader::InitSettingsInfo()
     info.valueSize = sizeof(m_settings.cmdBufDumpFormat);
     m_settingsInfoMap.Insert(1905164977, info);
 
+    info.type      = SettingType::Boolean;
+    info.pValuePtr = &m_settings.cmdBufDumpCompressed;
+    info.valueSize = sizeof(m_settings.cmdBufDumpCompressed);
+    m_settingsInfoMap.Insert(586247011, info);
+
     info.type      = SettingType::String;
     info.pValuePtr = &m_settings.cmdBufDumpDirectory;
     info.valueSize = sizeof(m_settings.cmdBufDumpDirectory);
@@ -903,6 +964,11 @@ void SettingsLoader::InitSettingsInfo()
     info.valueSize = sizeof(m_settings.cmdAllocatorFreeOnReset);
     m_settingsInfoMap.Insert(1461164706, info);
 
+    info.type      = SettingType::Uint;
+    info.pValuePtr = &m_settings.cmdAllocatorLinearAllocCommitAhead;
+    info.valueSize = sizeof(m_settings.cmdAllocatorLinearAllocCommitAhead);
+    m_settingsInfoMap.Insert(1161890656, info);
+
     info.type      = SettingType::Uint;
     info.pValuePtr = &m_settings.cmdBufOptimizePm4;
     info.valueSize = sizeof(m_settings.cmdBufOptimizePm4);
@@ -1064,9 +1130,9 @@ void SettingsLoader::DevDriverRegister()
             component.pfnSetValue = ISettingsLoader::SetValue;
             component.pSettingsData = &g_palJsonData[0];
             component.settingsDataSize = sizeof(g_palJsonData);
-            component.settingsDataHash = 3147251323;
-            component.settingsDataHeader.isEncoded = true;
-            component.settingsDataHeader.magicBufferId = 402778310;
+            component.settingsDataHash = 904561015;
+            component.settingsDataHeader.isEncoded = false;
+            component.settingsDataHeader.magicBufferId = 0;
             component.settingsDataHeader.magicBufferOffset = 0;
 
             pSettingsService->RegisterComponent(component);
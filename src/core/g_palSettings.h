@@ -164,12 +164,21 @@ enum Addr2PreferredSwizzleTypeSet : uint32
     Addr2PreferredDefault = 15
 };
 
+enum RpmPipelineCreateMode : uint32
+{
+    RpmPipelineCreateEager = 0,  //< All RPM pipelines are created during device initialization.
+    RpmPipelineCreateLazy = 1,  //< RPM compute pipelines are created the first time they are used.
+    RpmPipelineCreatePrewarm = 2  //< RPM compute pipelines are created on first use, and the commonly used ones are also built on worker threads during device initialization.
+};
+
 /// Pal auto-generated settings struct
 struct PalSettings : public Pal::DriverSettings
 {
     uint32                                      textureOptLevel;
     uint32                                      catalystAI;
     bool                                        forcePreambleCmdStream;
+    uint32                                      asyncSubmitQueueTypeMask;
+    uint32                                      asyncSubmitQueueDepth;
     uint32                                      maxNumCmdStreamsPerSubmit;
     bool                                        requestHighPriorityVmid;
     bool                                        requestDebugVmid;
@@ -188,6 +197,8 @@ struct PalSettings : public Pal::DriverSettings
     bool                                        addr2DisableSModes8BppColor;
     bool                                        overlayReportHDR;
     PreferredPipelineUploadHeap                 preferredPipelineUploadHeap;
+    bool                                        enablePipelineCodeDedup;
+    RpmPipelineCreateMode                       rpmPipelineCreateMode;
 
     bool                                        forceHeapPerfToFixedValues;
     float                                       cpuReadPerfForLocal;
@@ -216,6 +227,7 @@ struct PalSettings : public Pal::DriverSettings
     bool                                        disableSyncObject;
     CmdBufDumpMode                              cmdBufDumpMode;
     CmdBufDumpFormat                            cmdBufDumpFormat;
+    bool                                        cmdBufDumpCompressed;
     char                                        cmdBufDumpDirectory[MaxPathStrLen];
     uint32                                      submitTimeCmdBufDumpStartFrame;
     uint32                                      submitTimeCmdBufDumpEndFrame;
@@ -236,6 +248,7 @@ struct PalSettings : public Pal::DriverSettings
     uint32                                      cmdStreamMemsetValue;
     bool                                        cmdBufChunkEnableStagingBuffer;
     bool                                        cmdAllocatorFreeOnReset;
+    uint32                                      cmdAllocatorLinearAllocCommitAhead;
     Pm4OptEnable                                cmdBufOptimizePm4;
     CmdBufForceCpuUpdatePath                    cmdBufForceCpuUpdatePath;
     CmdBufForceOneTimeSubmit                    cmdBufForceOneTimeSubmit;
@@ -269,6 +282,8 @@ struct PalSettings : public Pal::DriverSettings
 static const char* pTFQStr = "#4265240458";
 static const char* pCatalystAIStr = "#1901986348";
 static const char* pForcePreambleCmdStreamStr = "#2987947496";
+static const char* pAsyncSubmitQueueTypeMaskStr = "#3240569230";
+static const char* pAsyncSubmitQueueDepthStr = "#1357330199";
 static const char* pMaxNumCmdStreamsPerSubmitStr = "#2467045849";
 static const char* pRequestHighPriorityVmidStr = "#1580739202";
 static const char* pRequestDebugVmidStr = "#359792145";
@@ -287,6 +302,8 @@ static const char* pAddr2DisableXorTileModeStr = "#576052426";
 static const char* pAddr2DisableSModes8BppColorStr = "#3379142860";
 static const char* pOverlayReportHDRStr = "#2354711641";
 static const char* pPreferredPipelineUploadHeapStr = "#1170638299";
+static const char* pEnablePipelineCodeDedupStr = "#3977322071";
+static const char* pRpmPipelineCreateModeStr = "#2279492967";
 
 static const char* pForceHeapPerfToFixedValuesStr = "#2415703124";
 static const char* pAllocationListReusableStr = "#1727036994";
@@ -301,6 +318,7 @@ static const char* pEnableVmAlwaysValidStr = "#1718264096";
 static const char* pDisableSyncObjectStr = "#830933859";
 static const char* pCmdBufDumpModeStr = "#3607991033";
 static const char* pCmdBufDumpFormatStr = "#1905164977";
+static const char* pCmdBufDumpCompressedStr = "#586247011";
 static const char* pCmdBufDumpDirectoryStr = "#3293295025";
 static const char* pSubmitTimeCmdBufDumpStartFrameStr = "#1639305458";
 static const char* pSubmitTimeCmdBufDumpEndFrameStr = "#4221961293";
@@ -319,6 +337,7 @@ static const char* pCmdStreamEnableMemsetOnReserveStr = "#3927521274";
 static const char* pCmdStreamMemsetValueStr = "#3661455441";
 static const char* pCmdBufChunkEnableStagingBufferStr = "#169161685";
 static const char* pCmdAllocatorFreeOnResetStr = "#1461164706";
+static const char* pCmdAllocatorLinearAllocCommitAheadStr = "#1161890656";
 static const char* pCmdBufOptimizePm4Str = "#1018895288";
 static const char* pCmdBufForceCpuUpdatePathStr = "#3282911281";
 static const char* pCmdBufForceOneTimeSubmitStr = "#909934676";
@@ -349,11 +368,13 @@ static const char* pDebugForceResourceAdditionalPaddingStr = "#3601080919";
 static const char* pOverlayReportMesStr = "#1685803860";
 static const char* pMipGenUseFastPathStr = "#3353227045";
 
-static const uint32 g_palNumSettings = 99;
+static const uint32 g_palNumSettings = 105;
 static const SettingNameHash g_palSettingHashList[] = {
 4265240458,
 1901986348,
 2987947496,
+3240569230,
+1357330199,
 2467045849,
 1580739202,
 359792145,
@@ -372,6 +393,8 @@ static const SettingNameHash g_palSettingHashList[] = {
 3379142860,
 2354711641,
 1170638299,
+3977322071,
+2279492967,
 
 2415703124,
 1067711036,
@@ -400,6 +423,7 @@ static const SettingNameHash g_palSettingHashList[] = {
 830933859,
 3607991033,
 1905164977,
+586247011,
 3293295025,
 1639305458,
 4221961293,
@@ -418,6 +442,7 @@ static const SettingNameHash g_palSettingHashList[] = {
 3661455441,
 169161685,
 1461164706,
+1161890656,
 1018895288,
 3282911281,
 909934676,
@@ -450,1904 +475,1892 @@ static const SettingNameHash g_palSettingHashList[] = {
 };
 
 static const uint8 g_palJsonData[] = {
-    26, 250, 84, 220, 1, 92, 96, 106, 146, 207, 33, 32, 160, 3, 90, 155, 144, 218, 198, 78, 114, 176, 3, 33, 5, 77, 19,
-    112, 240, 60, 51, 124, 70, 64, 201, 5, 158, 97, 87, 77, 204, 74, 98, 194, 41, 7, 146, 217, 196, 241, 199, 35, 58,
-    39, 53, 61, 197, 5, 96, 122, 152, 156, 157, 71, 204, 69, 14, 191, 122, 45, 161, 99, 42, 5, 57, 6, 198, 213, 152,
-    136, 88, 210, 192, 81, 135, 7, 248, 144, 180, 82, 124, 194, 98, 17, 233, 67, 103, 94, 189, 156, 239, 52, 33, 34,
-    188, 34, 131, 127, 146, 3, 210, 182, 8, 207, 46, 242, 16, 228, 164, 82, 247, 207, 226, 65, 217, 121, 209, 208, 58,
-    137, 86, 56, 145, 153, 100, 193, 210, 221, 67, 222, 187, 217, 180, 204, 199, 57, 76, 73, 145, 70, 108, 165, 137,
-    220, 165, 172, 141, 95, 13, 198, 166, 5, 173, 172, 249, 89, 206, 81, 109, 196, 146, 52, 197, 55, 62, 6, 230, 135,
-    182, 145, 69, 66, 210, 145, 166, 39, 166, 217, 224, 220, 205, 13, 182, 186, 141, 97, 168, 83, 83, 158, 39, 160, 142,
-    207, 135, 207, 144, 227, 164, 33, 131, 162, 201, 16, 55, 178, 41, 148, 120, 183, 77, 195, 232, 232, 113, 2, 102,
-    150, 52, 251, 75, 237, 79, 36, 44, 61, 145, 125, 243, 152, 54, 209, 114, 15, 70, 60, 90, 66, 255, 10, 175, 216, 198,
-    113, 185, 184, 216, 252, 45, 47, 240, 244, 155, 216, 146, 253, 6, 26, 203, 211, 51, 82, 183, 169, 78, 112, 148, 135,
-    69, 96, 5, 36, 121, 217, 43, 3, 191, 67, 113, 45, 78, 134, 194, 119, 250, 68, 114, 171, 104, 149, 136, 19, 211, 167,
-    26, 48, 39, 65, 19, 92, 234, 73, 103, 239, 155, 54, 81, 123, 39, 12, 83, 72, 132, 242, 150, 226, 197, 253, 195, 16,
-    68, 213, 219, 180, 29, 162, 54, 9, 160, 88, 236, 255, 135, 31, 14, 92, 254, 197, 64, 151, 14, 46, 29, 129, 208, 144,
-    90, 118, 28, 90, 13, 216, 179, 14, 38, 49, 118, 240, 168, 117, 97, 169, 86, 167, 186, 209, 63, 67, 30, 75, 44, 93,
-    162, 105, 78, 203, 191, 32, 104, 149, 72, 202, 210, 230, 241, 22, 198, 138, 116, 97, 181, 7, 227, 105, 85, 102, 180,
-    38, 106, 2, 118, 4, 145, 14, 246, 157, 222, 55, 210, 230, 26, 127, 123, 31, 124, 124, 52, 252, 67, 192, 15, 75, 224,
-    22, 225, 220, 149, 82, 180, 134, 230, 173, 94, 182, 203, 20, 148, 105, 232, 113, 88, 157, 52, 120, 95, 216, 55, 131,
-    60, 89, 150, 155, 166, 105, 199, 157, 231, 67, 133, 222, 202, 247, 140, 194, 38, 15, 178, 122, 155, 84, 239, 222,
-    162, 154, 138, 164, 83, 16, 94, 97, 55, 1, 154, 141, 168, 75, 226, 18, 84, 55, 42, 56, 246, 12, 92, 42, 150, 198,
-    81, 110, 247, 236, 171, 212, 163, 65, 126, 135, 1, 191, 152, 216, 149, 44, 180, 192, 72, 58, 38, 167, 178, 132, 99,
-    71, 38, 25, 196, 238, 228, 3, 228, 217, 137, 181, 102, 55, 171, 96, 190, 43, 235, 179, 104, 237, 54, 248, 154, 89,
-    131, 177, 226, 17, 121, 110, 68, 144, 102, 25, 28, 180, 96, 199, 197, 147, 4, 161, 171, 99, 182, 71, 1, 10, 128,
-    134, 100, 115, 25, 51, 222, 130, 154, 190, 69, 175, 21, 42, 173, 8, 166, 83, 222, 68, 157, 32, 27, 93, 97, 98, 118,
-    30, 106, 59, 243, 83, 212, 54, 68, 94, 250, 113, 56, 81, 71, 100, 211, 132, 251, 76, 245, 237, 252, 135, 243, 140,
-    66, 55, 231, 92, 253, 132, 235, 148, 118, 9, 185, 12, 103, 133, 59, 165, 82, 185, 18, 25, 24, 148, 35, 205, 175, 91,
-    21, 34, 143, 227, 115, 108, 155, 204, 219, 37, 183, 32, 160, 12, 202, 160, 48, 145, 106, 124, 105, 212, 6, 7, 171,
-    47, 175, 191, 250, 184, 250, 146, 158, 157, 131, 181, 133, 72, 0, 9, 80, 18, 138, 251, 139, 26, 67, 95, 71, 233, 10,
-    8, 186, 238, 71, 84, 63, 221, 29, 241, 231, 197, 61, 98, 241, 182, 134, 166, 134, 86, 243, 191, 220, 39, 77, 154,
-    242, 138, 84, 35, 202, 125, 241, 159, 23, 218, 60, 203, 135, 129, 169, 224, 70, 201, 228, 104, 45, 37, 12, 168, 30,
-    152, 50, 165, 13, 118, 175, 67, 231, 79, 5, 95, 199, 123, 163, 162, 147, 177, 179, 200, 201, 138, 3, 19, 90, 172,
-    122, 205, 98, 31, 45, 92, 163, 193, 162, 14, 133, 143, 252, 26, 6, 107, 132, 190, 153, 247, 109, 207, 138, 141, 120,
-    2, 235, 75, 208, 62, 158, 77, 244, 42, 190, 236, 46, 68, 216, 119, 175, 115, 210, 190, 143, 4, 109, 39, 76, 66, 79,
-    118, 2, 206, 191, 63, 24, 110, 7, 122, 198, 141, 201, 38, 5, 132, 189, 208, 135, 97, 213, 46, 107, 28, 235, 20, 182,
-    83, 160, 86, 45, 31, 45, 113, 150, 213, 65, 216, 230, 97, 180, 121, 108, 194, 19, 137, 71, 164, 77, 119, 234, 81,
-    221, 48, 81, 248, 156, 217, 195, 132, 67, 57, 129, 140, 102, 49, 162, 50, 3, 69, 224, 246, 119, 153, 173, 191, 81,
-    119, 101, 61, 250, 3, 113, 16, 34, 216, 216, 70, 66, 76, 33, 35, 132, 163, 152, 121, 164, 27, 56, 229, 75, 75, 141,
-    30, 187, 70, 71, 227, 166, 170, 201, 71, 138, 141, 30, 237, 175, 160, 240, 237, 170, 140, 213, 147, 229, 46, 116,
-    210, 113, 45, 150, 251, 31, 188, 46, 17, 12, 25, 84, 153, 223, 130, 223, 149, 32, 93, 81, 180, 88, 138, 227, 237,
-    194, 151, 246, 158, 129, 166, 152, 10, 124, 218, 244, 199, 169, 164, 255, 174, 53, 104, 187, 67, 194, 75, 167, 87,
-    165, 241, 197, 110, 58, 202, 59, 131, 219, 201, 129, 109, 24, 113, 212, 224, 139, 111, 167, 201, 160, 117, 118, 182,
-    108, 209, 76, 54, 0, 56, 62, 170, 35, 192, 50, 199, 219, 99, 122, 133, 10, 47, 151, 223, 180, 59, 200, 23, 229, 59,
-    52, 208, 189, 67, 96, 183, 188, 220, 127, 87, 3, 22, 59, 192, 2, 224, 23, 60, 150, 238, 15, 48, 233, 114, 48, 118,
-    90, 196, 134, 78, 164, 220, 6, 14, 230, 55, 209, 247, 174, 207, 199, 212, 16, 231, 50, 23, 251, 60, 175, 218, 159,
-    32, 255, 33, 129, 108, 149, 253, 76, 221, 207, 16, 14, 145, 180, 69, 105, 253, 113, 50, 229, 113, 30, 171, 25, 166,
-    224, 183, 148, 174, 18, 122, 69, 170, 200, 126, 79, 251, 128, 189, 216, 45, 110, 81, 26, 85, 27, 110, 198, 12, 138,
-    207, 255, 223, 202, 32, 131, 152, 69, 143, 158, 204, 52, 220, 153, 109, 91, 124, 28, 55, 153, 136, 11, 17, 205, 203,
-    22, 247, 56, 139, 231, 225, 39, 59, 66, 152, 244, 250, 41, 170, 25, 54, 202, 63, 87, 7, 122, 104, 165, 79, 107, 69,
-    229, 218, 135, 182, 246, 205, 26, 201, 220, 115, 110, 76, 121, 147, 193, 60, 189, 33, 107, 86, 45, 188, 53, 185, 67,
-    177, 2, 252, 221, 61, 121, 159, 67, 109, 151, 151, 4, 115, 237, 25, 27, 188, 177, 244, 64, 214, 43, 182, 184, 245,
-    221, 210, 252, 32, 148, 127, 102, 23, 204, 147, 248, 164, 233, 152, 141, 45, 129, 211, 155, 154, 170, 70, 114, 0,
-    66, 54, 212, 77, 123, 71, 139, 176, 51, 140, 246, 198, 215, 79, 127, 60, 148, 214, 167, 206, 250, 178, 245, 131,
-    221, 247, 243, 84, 99, 213, 205, 252, 123, 252, 62, 155, 141, 40, 117, 168, 15, 77, 57, 101, 6, 106, 200, 196, 109,
-    98, 71, 159, 3, 104, 94, 212, 62, 214, 55, 253, 38, 30, 181, 28, 78, 52, 168, 164, 11, 71, 135, 127, 88, 67, 199,
-    224, 67, 94, 204, 213, 81, 69, 92, 234, 50, 250, 250, 18, 94, 41, 235, 161, 174, 148, 216, 32, 208, 99, 30, 48, 219,
-    193, 143, 129, 74, 188, 2, 49, 123, 130, 217, 205, 190, 240, 122, 18, 42, 247, 248, 197, 137, 215, 248, 38, 104,
-    238, 78, 33, 141, 243, 87, 74, 207, 53, 15, 18, 200, 225, 107, 203, 81, 154, 198, 166, 232, 252, 147, 240, 120, 33,
-    92, 7, 196, 94, 58, 69, 192, 79, 162, 175, 27, 165, 3, 178, 248, 6, 50, 79, 59, 218, 7, 187, 158, 182, 66, 219, 132,
-    226, 120, 105, 99, 222, 7, 28, 223, 237, 69, 87, 65, 123, 172, 241, 65, 67, 229, 226, 136, 185, 3, 200, 151, 14,
-    204, 193, 158, 227, 5, 95, 30, 156, 1, 0, 212, 150, 97, 12, 250, 42, 126, 18, 19, 154, 201, 201, 217, 241, 193, 70,
-    9, 1, 137, 69, 164, 90, 39, 165, 248, 154, 194, 190, 124, 250, 237, 86, 212, 24, 193, 143, 129, 27, 161, 154, 180,
-    7, 76, 226, 58, 176, 143, 65, 137, 190, 162, 184, 188, 18, 52, 130, 119, 19, 100, 106, 198, 43, 182, 166, 65, 103,
-    152, 184, 24, 247, 105, 170, 211, 182, 229, 188, 41, 193, 155, 5, 135, 8, 49, 8, 221, 255, 29, 186, 252, 231, 142,
-    157, 111, 188, 202, 32, 122, 71, 224, 121, 156, 235, 14, 85, 143, 103, 222, 123, 93, 61, 63, 148, 134, 91, 122, 74,
-    104, 222, 117, 246, 80, 220, 166, 64, 156, 84, 225, 126, 216, 34, 87, 240, 147, 92, 55, 121, 2, 56, 84, 194, 103,
-    19, 156, 115, 4, 3, 43, 168, 220, 178, 149, 59, 159, 184, 109, 88, 194, 242, 111, 151, 81, 105, 121, 130, 167, 66,
-    178, 244, 212, 39, 138, 8, 165, 178, 10, 31, 195, 137, 82, 122, 220, 251, 15, 90, 23, 131, 251, 99, 11, 192, 144,
-    144, 168, 99, 61, 94, 112, 10, 32, 183, 221, 90, 227, 71, 80, 157, 30, 234, 116, 89, 98, 158, 99, 16, 121, 31, 196,
-    204, 0, 12, 119, 119, 236, 43, 119, 246, 165, 101, 202, 151, 210, 32, 66, 2, 157, 14, 161, 174, 0, 223, 87, 179,
-    142, 207, 177, 179, 3, 234, 101, 164, 115, 149, 20, 75, 45, 32, 112, 239, 18, 188, 145, 176, 30, 19, 124, 226, 221,
-    26, 0, 33, 169, 44, 100, 144, 63, 63, 143, 30, 71, 223, 19, 177, 224, 70, 211, 148, 235, 238, 185, 74, 130, 218,
-    232, 229, 122, 97, 84, 74, 23, 220, 216, 135, 215, 43, 41, 193, 128, 51, 97, 125, 191, 83, 51, 46, 161, 143, 4, 67,
-    124, 48, 48, 102, 191, 177, 55, 15, 224, 49, 55, 129, 241, 173, 208, 242, 93, 103, 137, 39, 22, 33, 127, 79, 88, 79,
-    205, 148, 38, 16, 118, 172, 195, 193, 137, 93, 26, 13, 198, 80, 32, 36, 178, 203, 132, 212, 166, 65, 52, 60, 185,
-    19, 55, 85, 230, 10, 50, 99, 112, 242, 152, 39, 229, 133, 99, 46, 227, 179, 3, 15, 94, 36, 229, 85, 26, 193, 78,
-    115, 212, 58, 199, 133, 223, 232, 163, 239, 252, 193, 127, 59, 210, 7, 23, 218, 91, 32, 97, 104, 15, 95, 23, 139,
-    43, 232, 58, 155, 7, 189, 248, 195, 201, 38, 169, 12, 152, 208, 162, 19, 213, 96, 63, 26, 0, 155, 186, 62, 223, 199,
-    254, 81, 231, 81, 80, 40, 64, 1, 238, 64, 170, 8, 28, 91, 44, 129, 37, 230, 38, 247, 207, 69, 83, 3, 10, 1, 117,
-    138, 81, 231, 208, 105, 48, 51, 167, 124, 72, 218, 23, 224, 68, 255, 247, 177, 238, 35, 219, 114, 246, 162, 60, 175,
-    201, 169, 232, 55, 227, 153, 248, 87, 4, 17, 195, 104, 204, 122, 41, 122, 132, 43, 28, 125, 193, 228, 24, 178, 215,
-    76, 159, 244, 24, 110, 123, 37, 97, 17, 172, 243, 230, 191, 235, 206, 255, 39, 149, 176, 119, 216, 4, 171, 111, 38,
-    144, 125, 15, 248, 173, 87, 116, 29, 42, 72, 48, 165, 241, 194, 176, 92, 8, 113, 232, 45, 204, 242, 194, 17, 110,
-    145, 130, 15, 103, 143, 128, 215, 23, 11, 19, 70, 103, 250, 135, 126, 118, 240, 224, 54, 29, 134, 209, 86, 120, 176,
-    193, 58, 61, 52, 146, 229, 104, 149, 10, 96, 90, 125, 47, 91, 44, 107, 189, 134, 131, 203, 15, 36, 216, 203, 29,
-    174, 194, 200, 168, 239, 76, 24, 178, 214, 119, 92, 98, 103, 79, 180, 122, 205, 123, 108, 240, 132, 123, 18, 41,
-    202, 27, 85, 99, 215, 63, 136, 66, 184, 38, 214, 139, 130, 123, 164, 11, 60, 65, 132, 121, 50, 125, 204, 183, 81,
-    191, 163, 103, 242, 220, 224, 184, 47, 45, 232, 152, 117, 19, 173, 237, 63, 215, 29, 156, 129, 251, 231, 104, 10,
-    208, 178, 95, 97, 168, 201, 53, 237, 59, 0, 105, 70, 13, 59, 187, 125, 82, 72, 154, 229, 117, 219, 162, 93, 44, 73,
-    174, 76, 196, 20, 209, 51, 220, 29, 180, 245, 250, 41, 152, 98, 130, 52, 95, 8, 123, 80, 220, 219, 77, 128, 34, 217,
-    217, 107, 33, 15, 3, 100, 71, 249, 148, 80, 136, 121, 6, 180, 196, 20, 92, 34, 217, 96, 214, 180, 235, 204, 103, 41,
-    158, 248, 98, 239, 205, 70, 57, 41, 44, 114, 148, 211, 58, 211, 60, 249, 77, 150, 159, 152, 218, 125, 101, 99, 239,
-    141, 59, 120, 231, 130, 251, 180, 91, 34, 191, 115, 44, 110, 201, 203, 153, 231, 85, 18, 203, 161, 123, 156, 202,
-    145, 152, 13, 115, 148, 40, 14, 89, 241, 223, 228, 18, 181, 37, 205, 42, 128, 84, 103, 162, 247, 144, 87, 99, 39,
-    182, 245, 199, 76, 30, 54, 70, 49, 179, 10, 15, 74, 57, 172, 95, 17, 0, 230, 142, 39, 8, 204, 105, 87, 233, 3, 240,
-    168, 13, 91, 200, 79, 105, 95, 11, 127, 67, 24, 182, 209, 7, 34, 216, 82, 15, 91, 119, 137, 160, 57, 235, 148, 9, 3,
-    163, 224, 152, 106, 44, 190, 1, 119, 118, 77, 166, 136, 0, 27, 156, 237, 234, 15, 192, 249, 186, 209, 63, 193, 56,
-    4, 42, 219, 49, 76, 79, 187, 152, 49, 176, 0, 184, 210, 73, 56, 107, 238, 141, 115, 126, 192, 167, 208, 139, 104,
-    129, 67, 71, 20, 141, 199, 66, 101, 109, 221, 81, 218, 83, 141, 0, 124, 100, 88, 36, 52, 116, 165, 158, 181, 112,
-    84, 200, 152, 141, 222, 216, 215, 145, 14, 253, 4, 72, 226, 5, 144, 222, 76, 241, 73, 225, 138, 91, 140, 43, 188,
-    128, 136, 53, 178, 225, 52, 68, 109, 96, 162, 145, 200, 38, 29, 17, 34, 213, 248, 113, 75, 203, 52, 59, 41, 0, 34,
-    195, 78, 61, 208, 178, 176, 86, 225, 160, 88, 57, 224, 48, 135, 34, 190, 137, 59, 157, 247, 185, 223, 178, 175, 212,
-    25, 209, 3, 179, 182, 44, 142, 30, 162, 212, 207, 218, 212, 173, 66, 167, 151, 123, 39, 189, 172, 147, 70, 32, 115,
-    15, 147, 161, 8, 94, 203, 121, 47, 123, 139, 1, 101, 36, 176, 19, 43, 117, 3, 148, 0, 28, 187, 116, 12, 243, 227,
-    117, 24, 87, 18, 145, 204, 26, 150, 181, 75, 110, 231, 156, 13, 210, 82, 135, 33, 94, 46, 221, 189, 93, 75, 166,
-    100, 229, 179, 2, 62, 220, 47, 198, 162, 49, 185, 44, 83, 52, 16, 87, 191, 139, 45, 107, 167, 11, 83, 135, 220, 245,
-    198, 6, 160, 238, 95, 10, 21, 159, 84, 201, 14, 121, 58, 30, 182, 231, 223, 52, 162, 25, 250, 78, 124, 189, 247, 64,
-    41, 88, 230, 16, 93, 219, 190, 44, 107, 158, 54, 6, 87, 92, 173, 220, 75, 205, 69, 213, 174, 18, 120, 94, 25, 218,
-    54, 23, 53, 208, 130, 211, 108, 148, 138, 64, 26, 54, 18, 189, 191, 191, 70, 3, 95, 229, 118, 186, 242, 173, 221,
-    222, 104, 75, 118, 30, 223, 203, 67, 221, 104, 106, 179, 184, 15, 241, 36, 152, 186, 143, 163, 119, 66, 103, 42, 41,
-    125, 93, 222, 36, 61, 146, 68, 220, 177, 59, 125, 194, 88, 206, 131, 215, 249, 94, 196, 120, 199, 178, 203, 76, 98,
-    14, 106, 215, 253, 193, 49, 88, 200, 13, 30, 227, 13, 65, 52, 10, 76, 233, 189, 31, 237, 137, 213, 29, 62, 188, 115,
-    37, 246, 229, 107, 169, 40, 68, 146, 247, 191, 188, 42, 132, 204, 204, 235, 34, 9, 65, 80, 16, 183, 45, 154, 175, 9,
-    225, 102, 225, 166, 13, 52, 21, 153, 107, 172, 38, 8, 0, 92, 138, 60, 1, 100, 82, 87, 120, 153, 191, 113, 26, 210,
-    78, 76, 145, 149, 17, 5, 165, 96, 26, 132, 207, 210, 86, 55, 154, 42, 208, 152, 8, 242, 57, 67, 6, 72, 140, 108, 72,
-    60, 35, 235, 228, 219, 9, 190, 47, 178, 237, 75, 241, 230, 238, 186, 254, 230, 254, 224, 34, 39, 67, 63, 180, 55,
-    15, 126, 122, 56, 255, 89, 99, 223, 52, 98, 127, 15, 249, 139, 58, 59, 47, 185, 171, 195, 249, 102, 99, 39, 132,
-    215, 213, 76, 104, 173, 115, 179, 30, 30, 67, 74, 38, 36, 159, 224, 57, 26, 156, 198, 224, 14, 219, 246, 181, 233,
-    209, 20, 26, 230, 172, 181, 69, 149, 36, 32, 245, 163, 172, 91, 227, 129, 155, 90, 125, 182, 184, 201, 202, 83, 132,
-    43, 37, 147, 107, 172, 89, 228, 252, 225, 248, 214, 110, 103, 0, 127, 195, 220, 147, 120, 230, 231, 80, 41, 94, 243,
-    176, 8, 156, 75, 93, 3, 169, 8, 232, 28, 158, 178, 120, 13, 151, 40, 220, 47, 59, 77, 107, 100, 4, 196, 226, 199,
-    53, 13, 67, 193, 180, 157, 153, 203, 5, 44, 214, 58, 47, 157, 243, 23, 182, 147, 112, 139, 190, 127, 245, 4, 72,
-    227, 218, 210, 153, 0, 64, 35, 254, 241, 126, 212, 26, 158, 151, 152, 19, 113, 192, 152, 222, 83, 231, 14, 13, 139,
-    67, 106, 74, 136, 82, 100, 71, 143, 203, 213, 216, 167, 80, 13, 130, 151, 215, 95, 44, 198, 255, 17, 252, 194, 250,
-    84, 39, 201, 233, 142, 36, 121, 148, 42, 72, 23, 21, 89, 219, 39, 250, 24, 195, 100, 5, 235, 110, 84, 125, 1, 25,
-    237, 192, 135, 9, 150, 45, 132, 186, 22, 47, 38, 168, 195, 187, 60, 203, 248, 224, 169, 175, 37, 142, 246, 21, 159,
-    220, 172, 145, 210, 150, 225, 134, 141, 200, 154, 82, 209, 117, 244, 1, 64, 40, 110, 62, 5, 84, 20, 190, 67, 142,
-    57, 10, 250, 47, 98, 19, 73, 138, 207, 103, 0, 73, 5, 77, 34, 9, 255, 170, 8, 37, 154, 41, 64, 9, 111, 151, 68, 140,
-    73, 136, 189, 85, 196, 194, 79, 176, 190, 27, 165, 17, 87, 13, 221, 237, 133, 182, 190, 244, 204, 95, 120, 65, 150,
-    2, 238, 229, 83, 130, 47, 97, 229, 143, 23, 0, 167, 169, 187, 230, 89, 207, 227, 60, 87, 37, 86, 18, 57, 161, 142,
-    151, 123, 187, 184, 31, 46, 214, 28, 142, 144, 146, 76, 218, 58, 36, 166, 27, 4, 123, 129, 58, 10, 251, 182, 90,
-    251, 211, 151, 37, 136, 209, 182, 126, 169, 244, 149, 85, 107, 135, 101, 195, 38, 151, 14, 122, 115, 46, 65, 52,
-    135, 214, 217, 6, 83, 156, 155, 160, 202, 13, 173, 46, 229, 100, 12, 145, 72, 170, 203, 100, 228, 141, 123, 25, 217,
-    32, 61, 249, 54, 161, 94, 240, 144, 25, 229, 111, 114, 166, 192, 194, 120, 13, 60, 121, 224, 172, 113, 133, 141,
-    252, 79, 123, 43, 198, 66, 54, 137, 130, 186, 226, 120, 163, 235, 62, 203, 116, 132, 70, 144, 195, 70, 47, 181, 86,
-    72, 67, 94, 33, 57, 85, 46, 105, 207, 203, 243, 245, 170, 91, 196, 218, 94, 144, 243, 98, 240, 12, 20, 230, 157,
-    165, 11, 221, 16, 146, 27, 165, 54, 129, 128, 211, 4, 201, 252, 123, 251, 223, 155, 112, 120, 98, 239, 140, 102, 19,
-    73, 35, 26, 49, 141, 166, 216, 1, 72, 37, 112, 0, 92, 237, 239, 38, 95, 196, 49, 35, 180, 76, 83, 66, 16, 227, 22,
-    212, 238, 208, 83, 25, 84, 250, 224, 26, 144, 25, 25, 22, 82, 74, 148, 104, 248, 167, 170, 51, 60, 127, 127, 70,
-    210, 49, 131, 204, 127, 81, 27, 60, 113, 140, 230, 193, 149, 125, 243, 142, 172, 176, 31, 107, 1, 175, 151, 134,
-    183, 14, 124, 150, 146, 156, 148, 153, 99, 78, 22, 50, 164, 131, 160, 78, 130, 100, 78, 96, 160, 189, 36, 127, 162,
-    37, 1, 132, 64, 220, 1, 48, 194, 164, 40, 177, 231, 151, 92, 198, 91, 213, 131, 247, 157, 242, 48, 229, 41, 12, 117,
-    228, 213, 154, 69, 210, 191, 191, 51, 130, 241, 141, 46, 125, 104, 26, 134, 35, 180, 160, 115, 160, 214, 255, 213,
-    34, 251, 225, 162, 123, 221, 125, 247, 205, 112, 197, 153, 235, 200, 93, 151, 163, 48, 238, 40, 97, 59, 197, 118,
-    112, 226, 124, 197, 151, 186, 193, 133, 244, 46, 66, 248, 117, 211, 106, 242, 61, 186, 5, 11, 125, 199, 10, 232, 0,
-    253, 194, 19, 156, 106, 244, 198, 131, 42, 59, 196, 45, 221, 151, 128, 130, 177, 114, 249, 74, 99, 62, 157, 137, 42,
-    84, 30, 60, 187, 242, 45, 107, 99, 21, 151, 35, 7, 244, 137, 253, 197, 187, 85, 195, 159, 211, 199, 66, 107, 188,
-    158, 229, 90, 169, 71, 139, 237, 134, 39, 88, 183, 165, 188, 2, 80, 12, 249, 252, 39, 127, 122, 127, 89, 199, 178,
-    58, 81, 158, 47, 84, 162, 5, 144, 238, 24, 58, 202, 158, 36, 191, 3, 83, 165, 186, 155, 184, 99, 59, 130, 50, 220,
-    214, 32, 191, 93, 179, 210, 41, 235, 238, 232, 7, 191, 193, 154, 176, 210, 161, 251, 238, 150, 113, 47, 252, 233,
-    208, 69, 17, 6, 204, 73, 0, 202, 72, 63, 244, 22, 209, 51, 136, 115, 245, 222, 22, 171, 20, 198, 254, 178, 13, 232,
-    152, 247, 5, 195, 129, 65, 15, 49, 252, 53, 155, 239, 89, 175, 62, 150, 91, 220, 159, 42, 30, 24, 91, 227, 159, 148,
-    238, 229, 199, 66, 131, 91, 174, 68, 151, 81, 231, 199, 227, 131, 251, 144, 154, 206, 104, 3, 190, 231, 2, 221, 61,
-    118, 157, 12, 101, 65, 84, 107, 57, 239, 77, 112, 211, 100, 140, 112, 149, 162, 133, 166, 173, 243, 133, 191, 202,
-    229, 232, 25, 52, 254, 153, 193, 151, 192, 37, 191, 233, 150, 104, 133, 35, 254, 68, 147, 135, 188, 22, 136, 18,
-    145, 222, 49, 39, 211, 51, 129, 227, 234, 116, 196, 42, 47, 22, 12, 20, 253, 53, 199, 122, 210, 139, 23, 110, 5, 92,
-    247, 32, 30, 245, 120, 199, 65, 124, 51, 160, 194, 125, 232, 30, 122, 175, 142, 135, 238, 146, 41, 150, 6, 173, 241,
-    154, 113, 179, 97, 24, 71, 170, 148, 235, 99, 246, 109, 41, 82, 210, 74, 199, 232, 185, 2, 212, 160, 89, 221, 148,
-    90, 30, 175, 206, 113, 125, 24, 23, 49, 55, 150, 146, 189, 243, 13, 137, 5, 183, 169, 188, 38, 128, 197, 79, 173,
-    38, 73, 197, 211, 167, 54, 237, 121, 36, 212, 165, 172, 208, 85, 191, 137, 157, 248, 12, 239, 241, 21, 52, 6, 25,
-    243, 103, 18, 180, 203, 100, 224, 144, 130, 21, 213, 199, 209, 89, 125, 5, 160, 87, 128, 98, 233, 58, 119, 18, 26,
-    127, 159, 218, 83, 70, 251, 31, 154, 105, 44, 70, 21, 142, 212, 160, 61, 184, 16, 152, 160, 35, 199, 154, 137, 38,
-    135, 195, 106, 145, 254, 24, 1, 65, 51, 199, 66, 240, 156, 60, 99, 58, 244, 231, 227, 131, 95, 141, 52, 135, 62, 38,
-    136, 9, 86, 81, 2, 32, 235, 109, 158, 223, 28, 98, 149, 192, 142, 129, 204, 198, 122, 99, 72, 1, 178, 225, 192, 167,
-    110, 224, 238, 84, 103, 114, 94, 47, 221, 168, 15, 150, 170, 196, 77, 178, 98, 92, 136, 27, 105, 171, 108, 76, 31,
-    57, 122, 119, 68, 83, 12, 192, 118, 93, 103, 18, 232, 71, 140, 148, 108, 60, 201, 197, 243, 116, 135, 41, 172, 125,
-    158, 24, 182, 179, 113, 70, 149, 131, 154, 105, 178, 145, 39, 85, 8, 62, 165, 43, 78, 8, 224, 222, 149, 215, 145,
-    115, 69, 84, 205, 147, 105, 245, 238, 108, 84, 12, 53, 229, 163, 245, 181, 236, 54, 224, 206, 114, 184, 50, 222,
-    142, 109, 85, 103, 33, 152, 40, 242, 138, 127, 69, 186, 210, 14, 156, 187, 4, 212, 74, 55, 67, 100, 72, 144, 196,
-    17, 35, 20, 136, 31, 0, 63, 169, 125, 215, 87, 168, 109, 106, 135, 199, 243, 97, 22, 253, 187, 186, 205, 27, 35,
-    147, 24, 161, 252, 83, 213, 127, 33, 142, 90, 222, 100, 59, 92, 104, 48, 25, 177, 56, 165, 252, 142, 191, 36, 223,
-    117, 249, 94, 61, 142, 17, 218, 133, 49, 179, 21, 184, 224, 231, 53, 154, 114, 12, 5, 190, 194, 29, 125, 193, 77,
-    132, 186, 156, 229, 186, 230, 34, 197, 147, 36, 241, 26, 71, 77, 225, 37, 133, 88, 158, 152, 104, 216, 189, 211,
-    158, 27, 115, 85, 202, 186, 1, 243, 24, 169, 119, 119, 23, 88, 26, 98, 7, 221, 138, 233, 197, 30, 25, 101, 102, 208,
-    205, 229, 191, 121, 66, 100, 81, 63, 29, 40, 205, 6, 244, 165, 57, 195, 253, 189, 248, 158, 115, 214, 159, 247, 40,
-    132, 231, 143, 205, 9, 113, 40, 30, 156, 169, 64, 2, 240, 45, 59, 59, 85, 77, 12, 192, 13, 131, 207, 85, 245, 224,
-    244, 184, 148, 77, 33, 162, 222, 169, 199, 202, 75, 194, 52, 203, 159, 168, 70, 40, 247, 34, 192, 180, 145, 21, 237,
-    184, 53, 126, 133, 110, 220, 57, 180, 21, 2, 194, 104, 169, 145, 96, 177, 199, 250, 187, 100, 249, 64, 7, 163, 214,
-    22, 75, 224, 178, 144, 254, 61, 40, 164, 161, 67, 169, 158, 168, 105, 71, 27, 254, 143, 165, 32, 252, 31, 134, 95,
-    207, 156, 14, 95, 157, 60, 148, 136, 131, 13, 179, 173, 110, 185, 145, 241, 192, 212, 204, 34, 252, 28, 186, 242,
-    233, 6, 153, 166, 176, 152, 252, 140, 113, 154, 114, 139, 12, 201, 57, 234, 108, 221, 42, 47, 82, 25, 67, 96, 238,
-    148, 227, 219, 200, 101, 2, 150, 115, 12, 225, 155, 190, 56, 236, 99, 24, 197, 4, 110, 87, 233, 175, 89, 229, 212,
-    121, 186, 255, 206, 105, 183, 182, 129, 251, 211, 149, 149, 57, 84, 103, 161, 215, 196, 80, 103, 123, 159, 201, 153,
-    18, 170, 107, 188, 22, 178, 209, 100, 143, 195, 158, 20, 213, 241, 128, 91, 203, 234, 173, 80, 239, 143, 195, 80,
-    118, 90, 83, 120, 107, 75, 116, 71, 3, 28, 187, 9, 113, 49, 255, 92, 230, 195, 199, 61, 247, 94, 174, 179, 184, 13,
-    212, 182, 205, 197, 44, 146, 30, 72, 244, 150, 10, 49, 95, 119, 85, 188, 84, 209, 98, 187, 208, 222, 228, 131, 3,
-    105, 150, 118, 112, 32, 228, 135, 36, 173, 7, 90, 136, 215, 75, 9, 69, 98, 130, 117, 230, 252, 127, 130, 14, 223,
-    163, 221, 4, 189, 99, 19, 204, 107, 150, 141, 22, 5, 253, 60, 40, 206, 108, 76, 224, 117, 109, 53, 245, 116, 43,
-    126, 148, 202, 34, 29, 88, 44, 30, 205, 97, 255, 40, 149, 27, 250, 80, 220, 200, 143, 42, 146, 9, 217, 250, 7, 104,
-    126, 44, 146, 58, 16, 182, 77, 203, 131, 27, 72, 161, 77, 102, 209, 149, 28, 4, 253, 232, 69, 111, 245, 125, 146,
-    221, 58, 197, 237, 47, 6, 211, 146, 54, 85, 152, 98, 127, 72, 200, 172, 17, 81, 245, 223, 122, 186, 27, 192, 175,
-    95, 126, 237, 44, 176, 100, 220, 238, 223, 215, 162, 0, 97, 162, 18, 75, 177, 148, 1, 26, 103, 90, 203, 184, 34,
-    242, 213, 180, 171, 144, 32, 227, 210, 132, 180, 128, 223, 88, 80, 119, 163, 109, 249, 118, 27, 49, 44, 135, 129,
-    110, 150, 174, 192, 68, 181, 187, 168, 151, 172, 250, 175, 102, 72, 248, 30, 64, 129, 170, 170, 105, 99, 158, 149,
-    155, 230, 112, 234, 144, 176, 232, 162, 137, 182, 160, 132, 18, 195, 182, 184, 53, 164, 225, 43, 240, 117, 3, 241,
-    70, 222, 184, 230, 144, 164, 242, 100, 53, 36, 80, 230, 129, 86, 240, 123, 47, 244, 72, 122, 121, 106, 141, 43, 208,
-    162, 194, 108, 153, 94, 44, 56, 162, 110, 53, 90, 208, 184, 194, 149, 115, 107, 25, 223, 7, 230, 157, 14, 169, 199,
-    94, 246, 17, 242, 115, 44, 95, 22, 41, 194, 214, 219, 157, 195, 79, 242, 253, 239, 76, 185, 115, 242, 203, 117, 237,
-    223, 182, 79, 61, 171, 81, 243, 223, 141, 158, 136, 27, 47, 248, 245, 19, 93, 76, 199, 195, 4, 52, 19, 222, 124, 53,
-    243, 64, 188, 235, 216, 45, 245, 131, 251, 244, 167, 67, 47, 95, 3, 219, 140, 132, 11, 203, 239, 38, 35, 27, 225,
-    246, 166, 157, 227, 167, 218, 249, 141, 127, 195, 82, 142, 57, 163, 111, 220, 212, 241, 165, 152, 173, 53, 221, 33,
-    24, 95, 96, 180, 92, 107, 31, 79, 60, 21, 170, 221, 118, 19, 128, 154, 214, 78, 31, 249, 150, 58, 72, 9, 150, 116,
-    13, 176, 148, 235, 26, 211, 115, 160, 56, 162, 128, 216, 224, 63, 81, 152, 94, 48, 165, 58, 245, 124, 247, 67, 91,
-    213, 89, 144, 237, 212, 35, 19, 55, 109, 143, 28, 14, 149, 64, 55, 125, 182, 16, 210, 87, 58, 205, 55, 57, 173, 252,
-    167, 66, 239, 60, 43, 28, 157, 242, 86, 203, 81, 147, 94, 225, 170, 140, 186, 100, 177, 98, 249, 175, 253, 82, 197,
-    98, 97, 249, 249, 42, 167, 243, 88, 230, 192, 150, 24, 212, 65, 70, 125, 141, 156, 172, 222, 241, 235, 16, 192, 103,
-    60, 149, 102, 155, 88, 191, 200, 201, 197, 124, 130, 98, 68, 78, 120, 230, 43, 239, 82, 205, 35, 143, 96, 109, 24,
-    232, 98, 56, 171, 173, 52, 124, 7, 148, 29, 255, 205, 250, 205, 75, 142, 122, 12, 61, 169, 166, 1, 46, 127, 135,
-    146, 135, 208, 2, 107, 111, 184, 179, 93, 250, 232, 109, 6, 30, 155, 106, 176, 87, 250, 132, 125, 249, 138, 53, 110,
-    90, 79, 70, 114, 155, 39, 111, 77, 166, 129, 33, 191, 67, 107, 16, 243, 58, 198, 234, 163, 215, 0, 6, 130, 95, 213,
-    7, 167, 127, 228, 15, 194, 140, 232, 185, 227, 165, 214, 60, 91, 100, 148, 174, 165, 146, 135, 223, 91, 109, 133,
-    98, 122, 175, 194, 75, 251, 67, 41, 128, 22, 106, 180, 32, 147, 54, 197, 61, 138, 164, 143, 195, 211, 33, 184, 194,
-    183, 65, 15, 142, 138, 196, 92, 203, 2, 42, 117, 20, 45, 71, 18, 82, 12, 202, 172, 205, 152, 85, 164, 109, 18, 197,
-    0, 127, 166, 54, 164, 176, 17, 227, 69, 66, 65, 76, 3, 99, 154, 81, 15, 248, 144, 244, 245, 16, 226, 138, 81, 46,
-    28, 65, 226, 149, 208, 211, 164, 170, 45, 232, 4, 44, 206, 215, 161, 71, 33, 251, 63, 36, 221, 216, 30, 216, 144,
-    40, 170, 153, 193, 57, 108, 44, 202, 162, 235, 134, 40, 51, 230, 7, 157, 92, 141, 121, 177, 217, 228, 152, 181, 212,
-    254, 36, 178, 46, 210, 188, 149, 243, 188, 63, 57, 194, 166, 173, 69, 207, 143, 179, 17, 234, 132, 184, 28, 7, 8,
-    111, 36, 175, 77, 169, 245, 69, 118, 140, 254, 210, 49, 120, 57, 218, 38, 151, 48, 13, 177, 163, 42, 54, 193, 124,
-    172, 69, 92, 108, 201, 16, 34, 236, 230, 231, 179, 121, 165, 36, 254, 13, 49, 106, 43, 239, 229, 249, 166, 200, 136,
-    184, 195, 112, 119, 246, 35, 244, 56, 228, 168, 192, 201, 91, 64, 255, 83, 195, 68, 246, 33, 4, 124, 99, 213, 248,
-    232, 169, 90, 133, 61, 79, 172, 169, 14, 178, 238, 198, 37, 48, 164, 59, 197, 246, 116, 51, 238, 55, 128, 242, 65,
-    215, 124, 91, 4, 76, 6, 149, 252, 79, 140, 164, 176, 142, 54, 23, 113, 199, 193, 47, 53, 9, 98, 195, 27, 111, 79,
-    183, 60, 44, 100, 166, 13, 54, 130, 131, 8, 112, 0, 163, 163, 208, 124, 31, 125, 214, 101, 62, 70, 50, 61, 133, 243,
-    226, 150, 197, 141, 194, 67, 123, 182, 230, 97, 183, 70, 83, 172, 124, 69, 168, 157, 113, 66, 99, 82, 83, 13, 12,
-    101, 215, 197, 111, 136, 176, 34, 59, 204, 170, 21, 7, 27, 231, 182, 10, 55, 23, 72, 111, 85, 53, 242, 11, 103, 252,
-    30, 210, 100, 0, 33, 131, 195, 104, 163, 173, 150, 129, 4, 112, 117, 50, 104, 237, 219, 155, 85, 149, 109, 50, 31,
-    69, 186, 80, 40, 72, 103, 239, 192, 26, 112, 211, 189, 172, 56, 192, 1, 92, 39, 203, 28, 120, 176, 21, 86, 8, 197,
-    108, 19, 71, 40, 133, 111, 210, 211, 134, 244, 122, 24, 24, 196, 99, 25, 180, 242, 144, 143, 181, 87, 99, 199, 220,
-    90, 39, 66, 159, 182, 241, 160, 151, 134, 112, 1, 215, 67, 140, 53, 208, 196, 253, 10, 195, 223, 226, 48, 147, 176,
-    129, 223, 246, 147, 218, 250, 55, 92, 247, 37, 49, 107, 59, 175, 252, 139, 167, 22, 198, 58, 228, 38, 146, 166, 54,
-    106, 129, 201, 10, 201, 249, 16, 228, 143, 244, 114, 101, 207, 18, 157, 36, 224, 33, 1, 51, 121, 210, 140, 140, 85,
-    50, 232, 4, 220, 166, 201, 153, 120, 49, 87, 146, 45, 59, 196, 141, 9, 77, 121, 32, 230, 207, 190, 240, 108, 96,
-    154, 130, 27, 91, 87, 108, 173, 28, 1, 7, 219, 28, 114, 45, 167, 234, 10, 196, 164, 21, 204, 50, 231, 90, 126, 215,
-    227, 238, 221, 18, 13, 181, 206, 170, 239, 92, 69, 137, 158, 86, 5, 137, 97, 176, 97, 122, 21, 201, 79, 249, 214, 7,
-    4, 58, 201, 34, 244, 247, 21, 213, 109, 221, 94, 2, 12, 251, 16, 237, 240, 86, 152, 250, 25, 177, 67, 131, 61, 149,
-    52, 202, 12, 6, 188, 149, 43, 42, 47, 221, 235, 12, 28, 162, 114, 96, 252, 36, 140, 90, 20, 179, 130, 241, 194, 69,
-    235, 183, 144, 210, 0, 206, 194, 160, 68, 232, 41, 71, 141, 61, 197, 27, 41, 94, 25, 86, 6, 27, 57, 168, 38, 85,
-    134, 60, 8, 152, 108, 193, 165, 6, 151, 241, 108, 121, 234, 143, 20, 211, 2, 117, 209, 87, 111, 213, 88, 129, 111,
-    160, 245, 142, 177, 149, 254, 23, 142, 165, 223, 36, 108, 91, 105, 239, 178, 31, 227, 178, 156, 102, 3, 250, 26,
-    244, 36, 239, 190, 169, 196, 123, 79, 31, 4, 22, 72, 6, 209, 10, 193, 32, 127, 189, 97, 215, 128, 145, 11, 16, 241,
-    30, 9, 188, 104, 160, 17, 244, 152, 136, 222, 160, 125, 216, 141, 8, 24, 68, 95, 204, 170, 69, 139, 12, 228, 209,
-    240, 39, 194, 122, 69, 125, 83, 136, 158, 122, 72, 99, 176, 118, 10, 94, 66, 76, 178, 48, 239, 179, 136, 33, 165,
-    168, 146, 195, 255, 198, 197, 185, 240, 192, 148, 233, 74, 210, 113, 244, 101, 189, 60, 130, 208, 220, 123, 200, 51,
-    169, 148, 241, 233, 1, 33, 145, 102, 108, 153, 94, 220, 115, 75, 194, 67, 6, 159, 220, 158, 249, 59, 32, 239, 183,
-    209, 239, 13, 231, 198, 2, 216, 115, 241, 23, 237, 49, 211, 100, 59, 254, 249, 190, 102, 195, 103, 13, 87, 64, 29,
-    10, 45, 96, 106, 251, 167, 243, 89, 111, 38, 196, 217, 101, 172, 137, 213, 213, 163, 93, 27, 63, 127, 82, 225, 235,
-    89, 159, 188, 103, 187, 211, 79, 205, 146, 112, 37, 114, 65, 178, 107, 227, 224, 164, 108, 206, 152, 63, 38, 106,
-    225, 191, 55, 170, 76, 54, 130, 146, 177, 145, 45, 138, 108, 59, 12, 214, 137, 137, 75, 133, 87, 226, 66, 112, 164,
-    160, 139, 12, 188, 213, 179, 107, 58, 93, 39, 153, 88, 188, 137, 38, 211, 67, 184, 90, 19, 39, 149, 187, 89, 18,
-    154, 189, 29, 155, 238, 130, 185, 35, 208, 172, 130, 63, 210, 212, 198, 59, 161, 161, 36, 242, 140, 221, 49, 51, 43,
-    159, 110, 182, 234, 193, 235, 157, 152, 11, 64, 5, 168, 243, 180, 58, 22, 171, 14, 61, 33, 16, 131, 227, 104, 193,
-    70, 123, 233, 199, 130, 91, 4, 164, 99, 130, 106, 84, 125, 25, 207, 139, 54, 213, 9, 29, 203, 93, 162, 246, 153,
-    246, 15, 119, 172, 75, 222, 4, 32, 140, 146, 57, 200, 216, 234, 125, 175, 178, 53, 33, 115, 35, 31, 223, 114, 47,
-    34, 166, 45, 10, 97, 199, 128, 99, 104, 32, 20, 177, 161, 88, 32, 40, 213, 147, 5, 148, 173, 190, 65, 208, 137, 100,
-    160, 163, 126, 201, 108, 95, 178, 206, 164, 198, 152, 8, 95, 13, 204, 245, 10, 168, 116, 225, 168, 148, 255, 143,
-    171, 178, 52, 207, 108, 125, 191, 173, 131, 144, 39, 218, 118, 129, 252, 141, 130, 122, 134, 156, 122, 248, 220, 16,
-    7, 219, 43, 129, 88, 26, 37, 14, 82, 192, 161, 212, 14, 199, 221, 57, 58, 106, 5, 129, 224, 42, 174, 114, 76, 99,
-    177, 4, 144, 67, 125, 112, 3, 33, 139, 128, 245, 115, 213, 184, 132, 222, 119, 81, 212, 106, 215, 187, 155, 115,
-    136, 188, 57, 86, 251, 248, 84, 229, 47, 26, 65, 77, 92, 183, 149, 206, 165, 202, 121, 75, 39, 176, 198, 207, 11,
-    211, 217, 75, 218, 232, 188, 7, 235, 67, 21, 15, 92, 155, 122, 5, 119, 203, 179, 217, 108, 228, 122, 161, 37, 62,
-    78, 25, 182, 255, 179, 148, 114, 141, 200, 197, 57, 130, 58, 18, 104, 57, 63, 102, 131, 220, 213, 54, 47, 97, 207,
-    180, 59, 88, 248, 232, 45, 117, 194, 176, 33, 96, 124, 88, 189, 59, 18, 113, 29, 201, 79, 77, 133, 53, 240, 24, 238,
-    45, 208, 1, 98, 249, 117, 141, 28, 119, 136, 149, 118, 241, 219, 91, 151, 76, 18, 143, 103, 202, 109, 139, 128, 79,
-    37, 156, 37, 116, 60, 30, 48, 238, 53, 212, 9, 14, 6, 185, 152, 167, 188, 133, 108, 215, 212, 89, 181, 219, 143,
-    138, 118, 93, 218, 8, 113, 142, 232, 44, 22, 174, 11, 175, 102, 168, 122, 192, 217, 124, 114, 108, 30, 201, 48, 96,
-    38, 91, 81, 4, 172, 3, 47, 51, 157, 194, 42, 207, 172, 252, 255, 82, 37, 144, 122, 103, 86, 247, 156, 145, 19, 147,
-    194, 152, 56, 170, 185, 217, 71, 115, 140, 161, 137, 238, 247, 37, 20, 89, 116, 47, 56, 14, 205, 253, 124, 154, 230,
-    253, 74, 116, 44, 110, 224, 19, 99, 64, 9, 209, 255, 57, 130, 183, 244, 68, 170, 155, 253, 201, 21, 180, 61, 79, 89,
-    130, 180, 95, 73, 25, 154, 55, 20, 54, 38, 161, 107, 170, 156, 231, 123, 62, 54, 25, 196, 115, 25, 219, 176, 188,
-    169, 183, 127, 178, 99, 185, 5, 20, 46, 36, 34, 153, 110, 62, 6, 243, 160, 159, 70, 105, 191, 252, 34, 200, 123,
-    147, 8, 231, 164, 101, 187, 178, 67, 125, 159, 133, 194, 216, 166, 17, 45, 76, 50, 172, 103, 167, 216, 49, 212, 152,
-    236, 199, 197, 241, 48, 245, 226, 30, 94, 81, 85, 43, 31, 59, 131, 201, 167, 221, 101, 19, 6, 200, 255, 41, 17, 248,
-    234, 177, 109, 73, 100, 210, 176, 124, 196, 19, 51, 246, 202, 16, 12, 10, 14, 74, 137, 195, 208, 5, 190, 201, 76,
-    99, 248, 84, 123, 4, 83, 40, 18, 85, 12, 208, 162, 109, 141, 153, 89, 95, 225, 222, 243, 140, 39, 180, 59, 77, 24,
-    32, 117, 85, 227, 78, 215, 139, 113, 132, 130, 197, 167, 189, 199, 225, 177, 98, 228, 47, 167, 96, 191, 127, 241,
-    209, 253, 193, 168, 1, 107, 9, 221, 22, 233, 117, 72, 190, 10, 151, 55, 175, 134, 170, 49, 151, 107, 22, 97, 147,
-    244, 61, 24, 123, 157, 119, 45, 93, 110, 110, 126, 228, 69, 58, 108, 67, 196, 122, 98, 152, 49, 10, 122, 218, 80,
-    212, 54, 28, 84, 223, 221, 15, 181, 188, 175, 12, 50, 192, 177, 108, 172, 92, 222, 201, 25, 184, 64, 82, 93, 167,
-    126, 252, 61, 223, 185, 105, 180, 127, 169, 94, 250, 169, 43, 119, 109, 61, 6, 216, 38, 152, 219, 8, 84, 33, 231,
-    193, 78, 231, 239, 253, 173, 243, 11, 3, 230, 210, 79, 215, 181, 53, 100, 34, 41, 246, 127, 141, 135, 126, 68, 86,
-    167, 18, 139, 19, 51, 136, 235, 11, 127, 174, 54, 253, 204, 28, 226, 52, 161, 244, 118, 119, 97, 10, 88, 138, 203,
-    168, 118, 198, 13, 177, 32, 24, 218, 174, 2, 183, 217, 65, 135, 15, 160, 238, 83, 193, 40, 17, 139, 11, 71, 122, 28,
-    18, 131, 111, 176, 24, 165, 65, 26, 229, 11, 130, 44, 54, 134, 125, 247, 192, 28, 186, 67, 196, 87, 81, 32, 8, 117,
-    60, 68, 230, 58, 13, 233, 120, 141, 52, 221, 35, 204, 160, 49, 254, 69, 50, 158, 33, 44, 148, 115, 67, 204, 121, 3,
-    97, 125, 177, 149, 80, 84, 220, 91, 62, 83, 202, 38, 181, 62, 237, 11, 255, 73, 177, 89, 211, 46, 226, 211, 32, 111,
-    92, 227, 236, 25, 174, 189, 58, 219, 10, 82, 141, 20, 64, 252, 183, 157, 98, 30, 159, 28, 242, 162, 185, 173, 187,
-    176, 168, 107, 195, 7, 69, 158, 188, 29, 197, 107, 39, 133, 139, 2, 85, 247, 68, 141, 9, 14, 242, 89, 94, 221, 84,
-    216, 94, 134, 142, 17, 111, 60, 44, 108, 147, 147, 138, 125, 68, 41, 242, 14, 98, 172, 19, 103, 206, 211, 122, 152,
-    48, 134, 228, 221, 192, 56, 206, 52, 118, 67, 143, 228, 15, 133, 68, 11, 24, 41, 163, 16, 174, 242, 142, 186, 184,
-    239, 140, 28, 51, 10, 130, 102, 75, 2, 248, 66, 215, 108, 223, 159, 22, 24, 80, 196, 5, 151, 226, 157, 43, 3, 183,
-    162, 244, 10, 239, 223, 207, 12, 90, 92, 155, 20, 250, 51, 76, 66, 41, 86, 188, 28, 92, 171, 119, 192, 18, 62, 61,
-    67, 58, 12, 254, 44, 60, 215, 75, 9, 174, 35, 159, 178, 214, 91, 253, 8, 139, 190, 224, 122, 211, 4, 22, 121, 150,
-    51, 106, 27, 86, 207, 77, 129, 127, 19, 222, 59, 170, 162, 89, 43, 87, 73, 162, 133, 82, 96, 23, 129, 103, 235, 110,
-    19, 255, 150, 94, 51, 235, 180, 213, 20, 39, 22, 136, 19, 33, 209, 172, 44, 161, 102, 113, 201, 2, 155, 16, 180,
-    215, 178, 44, 46, 119, 169, 85, 60, 252, 14, 2, 228, 222, 164, 123, 116, 96, 240, 110, 243, 247, 49, 223, 45, 173,
-    173, 56, 56, 11, 119, 33, 5, 123, 182, 63, 43, 141, 241, 190, 225, 129, 88, 29, 120, 103, 175, 86, 235, 169, 1, 28,
-    189, 78, 93, 117, 103, 208, 15, 0, 151, 91, 57, 240, 15, 7, 45, 195, 69, 101, 174, 20, 31, 109, 173, 75, 47, 94, 36,
-    179, 149, 110, 209, 70, 147, 211, 222, 38, 173, 5, 45, 48, 218, 111, 47, 45, 63, 81, 64, 58, 169, 57, 97, 33, 196,
-    69, 27, 212, 232, 90, 219, 154, 48, 97, 71, 169, 70, 209, 160, 114, 28, 5, 96, 27, 154, 25, 182, 41, 23, 55, 39,
-    216, 60, 98, 21, 85, 235, 167, 242, 252, 165, 137, 72, 0, 147, 239, 235, 110, 131, 192, 33, 190, 41, 190, 170, 201,
-    12, 222, 100, 138, 119, 106, 104, 52, 125, 254, 195, 70, 2, 120, 121, 26, 201, 201, 176, 60, 38, 69, 48, 231, 51,
-    72, 119, 129, 124, 99, 40, 174, 202, 121, 150, 28, 79, 120, 206, 181, 111, 188, 161, 118, 1, 252, 210, 69, 180, 172,
-    198, 139, 224, 132, 184, 145, 40, 45, 147, 85, 212, 159, 141, 158, 254, 173, 235, 160, 23, 208, 238, 56, 162, 50,
-    128, 146, 207, 79, 100, 15, 170, 52, 254, 199, 137, 195, 166, 141, 58, 7, 127, 208, 90, 77, 123, 199, 141, 215, 173,
-    115, 249, 40, 178, 107, 220, 46, 56, 171, 198, 114, 183, 237, 122, 86, 30, 205, 28, 61, 23, 113, 190, 216, 150, 28,
-    44, 100, 13, 213, 40, 54, 76, 211, 223, 123, 110, 223, 124, 95, 24, 252, 249, 0, 207, 52, 244, 222, 16, 173, 213,
-    253, 38, 55, 171, 4, 211, 187, 48, 129, 27, 77, 147, 87, 62, 164, 214, 249, 184, 193, 178, 5, 22, 192, 35, 152, 147,
-    252, 198, 144, 241, 27, 195, 30, 250, 31, 38, 71, 184, 205, 80, 108, 222, 222, 180, 122, 86, 152, 68, 101, 45, 136,
-    154, 133, 101, 204, 174, 156, 57, 144, 235, 42, 112, 25, 48, 62, 153, 150, 28, 187, 144, 120, 66, 133, 171, 240,
-    173, 183, 126, 211, 94, 77, 67, 154, 206, 48, 117, 1, 149, 6, 221, 183, 181, 9, 232, 160, 51, 152, 114, 241, 106,
-    107, 162, 84, 221, 92, 210, 155, 154, 131, 44, 119, 246, 133, 60, 209, 74, 206, 174, 181, 189, 54, 5, 49, 12, 253,
-    134, 195, 222, 253, 139, 50, 29, 218, 238, 56, 147, 144, 65, 219, 134, 35, 3, 80, 88, 219, 39, 62, 234, 62, 108, 44,
-    95, 49, 171, 214, 1, 250, 160, 211, 33, 125, 155, 95, 11, 64, 96, 229, 243, 104, 125, 116, 184, 213, 109, 217, 224,
-    206, 123, 50, 180, 56, 221, 251, 236, 228, 159, 82, 62, 47, 52, 228, 110, 127, 153, 174, 227, 160, 100, 4, 105, 63,
-    29, 126, 12, 120, 72, 79, 74, 237, 165, 223, 242, 94, 223, 187, 213, 178, 225, 88, 142, 200, 170, 207, 83, 53, 103,
-    209, 92, 109, 55, 151, 234, 183, 62, 63, 23, 146, 159, 174, 233, 129, 128, 154, 162, 226, 100, 206, 235, 132, 58,
-    242, 93, 45, 108, 200, 194, 135, 249, 121, 65, 152, 100, 214, 195, 54, 98, 185, 151, 66, 171, 191, 60, 63, 112, 110,
-    121, 188, 24, 206, 30, 125, 133, 180, 94, 189, 25, 156, 18, 73, 76, 16, 30, 247, 239, 144, 116, 250, 215, 115, 144,
-    248, 177, 5, 160, 175, 210, 137, 213, 214, 65, 177, 238, 75, 225, 16, 39, 231, 28, 159, 167, 137, 164, 148, 133,
-    183, 94, 65, 238, 125, 209, 17, 78, 247, 235, 68, 0, 2, 28, 114, 181, 244, 116, 122, 149, 7, 230, 90, 252, 246, 255,
-    59, 11, 0, 188, 193, 185, 128, 177, 83, 14, 140, 8, 75, 56, 220, 224, 32, 52, 200, 165, 145, 91, 97, 232, 176, 196,
-    79, 41, 212, 50, 89, 108, 38, 209, 112, 21, 52, 103, 188, 210, 34, 72, 40, 84, 231, 203, 105, 246, 59, 50, 13, 155,
-    116, 145, 71, 175, 48, 24, 48, 14, 232, 45, 124, 66, 46, 201, 47, 29, 193, 18, 33, 109, 10, 189, 32, 214, 147, 16,
-    71, 232, 62, 167, 199, 4, 216, 130, 191, 203, 232, 220, 40, 49, 147, 170, 164, 136, 234, 77, 86, 172, 192, 136, 26,
-    194, 243, 117, 103, 242, 223, 156, 203, 242, 64, 42, 14, 12, 25, 224, 111, 106, 14, 192, 30, 125, 237, 52, 39, 141,
-    31, 31, 60, 60, 88, 96, 137, 192, 10, 41, 41, 217, 61, 206, 20, 254, 228, 182, 218, 144, 215, 136, 237, 100, 180,
-    173, 59, 238, 132, 103, 67, 192, 206, 119, 22, 56, 247, 99, 186, 125, 117, 53, 209, 206, 107, 136, 21, 167, 81, 117,
-    122, 56, 125, 249, 86, 43, 12, 129, 74, 0, 184, 112, 250, 26, 212, 84, 46, 171, 235, 95, 148, 56, 225, 31, 21, 255,
-    175, 198, 200, 127, 40, 97, 37, 227, 93, 56, 63, 162, 107, 2, 105, 178, 224, 71, 209, 109, 163, 204, 138, 188, 173,
-    199, 15, 255, 233, 139, 223, 84, 38, 156, 208, 18, 216, 243, 42, 254, 171, 137, 78, 117, 173, 1, 163, 83, 139, 6,
-    161, 215, 155, 23, 23, 86, 22, 68, 103, 97, 221, 19, 128, 130, 89, 237, 246, 213, 254, 19, 29, 21, 112, 122, 204,
-    125, 42, 52, 220, 60, 151, 30, 118, 131, 12, 102, 92, 71, 3, 224, 83, 48, 42, 59, 90, 170, 169, 127, 191, 41, 68,
-    210, 140, 202, 38, 70, 244, 145, 17, 151, 147, 198, 160, 141, 115, 211, 212, 165, 145, 196, 91, 121, 0, 153, 245,
-    72, 168, 193, 49, 186, 21, 226, 114, 68, 124, 19, 9, 108, 43, 163, 204, 5, 176, 10, 88, 109, 121, 6, 190, 247, 78,
-    189, 212, 46, 231, 30, 140, 106, 175, 130, 59, 194, 19, 138, 28, 244, 111, 190, 65, 203, 50, 211, 36, 32, 154, 23,
-    67, 121, 208, 119, 114, 123, 0, 243, 57, 166, 209, 83, 26, 203, 241, 17, 4, 61, 127, 183, 149, 44, 108, 9, 147, 215,
-    82, 242, 7, 124, 163, 106, 12, 160, 184, 185, 67, 227, 64, 114, 93, 198, 214, 224, 181, 202, 77, 84, 190, 249, 81,
-    235, 45, 135, 18, 193, 247, 240, 201, 170, 3, 141, 149, 124, 139, 66, 110, 61, 42, 137, 73, 217, 186, 23, 97, 80,
-    128, 44, 119, 227, 158, 105, 135, 34, 36, 6, 189, 4, 121, 185, 77, 11, 122, 6, 90, 104, 150, 157, 87, 244, 180, 56,
-    21, 36, 134, 144, 58, 175, 124, 201, 29, 3, 39, 34, 243, 5, 182, 41, 66, 185, 247, 5, 10, 154, 24, 198, 101, 31,
-    107, 70, 115, 130, 37, 166, 77, 242, 57, 2, 77, 168, 64, 174, 193, 240, 191, 113, 183, 38, 164, 62, 12, 115, 123,
-    204, 26, 173, 129, 33, 23, 129, 55, 1, 99, 105, 56, 156, 192, 113, 55, 58, 221, 129, 69, 124, 78, 173, 111, 77, 229,
-    59, 232, 85, 105, 82, 166, 64, 226, 8, 98, 205, 5, 181, 11, 208, 140, 213, 38, 44, 244, 146, 62, 95, 85, 21, 70, 54,
-    118, 204, 12, 230, 24, 149, 146, 145, 62, 55, 226, 159, 211, 18, 48, 114, 15, 36, 88, 207, 242, 177, 46, 167, 108,
-    14, 188, 116, 70, 57, 153, 86, 2, 27, 249, 134, 3, 27, 113, 193, 248, 85, 93, 218, 84, 123, 254, 249, 241, 111, 74,
-    88, 147, 82, 64, 92, 196, 102, 180, 188, 203, 41, 26, 158, 230, 249, 120, 129, 138, 184, 42, 19, 221, 65, 70, 248,
-    99, 140, 98, 153, 250, 0, 151, 190, 20, 99, 127, 170, 205, 97, 146, 104, 111, 59, 60, 101, 240, 134, 216, 95, 208,
-    200, 0, 248, 95, 52, 217, 204, 92, 238, 247, 32, 158, 183, 153, 40, 112, 36, 154, 14, 207, 106, 223, 60, 16, 35, 68,
-    103, 187, 119, 159, 145, 124, 177, 173, 181, 227, 99, 184, 127, 245, 221, 47, 14, 135, 204, 183, 185, 175, 188, 184,
-    25, 209, 115, 246, 44, 72, 64, 16, 172, 170, 108, 64, 108, 219, 35, 192, 233, 63, 7, 88, 17, 174, 29, 48, 194, 119,
-    125, 12, 17, 26, 82, 50, 88, 53, 55, 180, 200, 20, 97, 228, 17, 23, 10, 238, 208, 217, 189, 46, 92, 253, 63, 86, 7,
-    215, 234, 98, 93, 132, 81, 98, 151, 47, 92, 83, 50, 144, 184, 101, 192, 25, 215, 85, 95, 223, 197, 191, 138, 223,
-    136, 222, 11, 162, 99, 75, 70, 77, 180, 221, 85, 241, 33, 174, 125, 249, 147, 168, 31, 0, 197, 252, 173, 108, 29,
-    95, 69, 68, 75, 62, 52, 100, 225, 108, 125, 66, 150, 184, 104, 75, 168, 45, 167, 170, 26, 101, 64, 83, 128, 48, 114,
-    156, 82, 25, 223, 195, 100, 232, 148, 19, 52, 166, 105, 137, 136, 240, 82, 97, 101, 233, 239, 223, 178, 23, 11, 248,
-    251, 102, 147, 250, 172, 169, 159, 152, 221, 83, 70, 188, 175, 232, 108, 5, 26, 203, 1, 247, 101, 254, 236, 111,
-    115, 31, 241, 125, 223, 8, 155, 179, 20, 220, 85, 249, 243, 108, 159, 62, 227, 179, 34, 46, 239, 157, 27, 220, 43,
-    5, 70, 130, 147, 94, 229, 39, 184, 76, 223, 224, 248, 240, 136, 203, 22, 186, 4, 68, 195, 88, 222, 23, 248, 96, 131,
-    95, 173, 101, 225, 198, 213, 17, 184, 252, 196, 219, 157, 223, 28, 79, 4, 173, 217, 239, 193, 154, 157, 78, 148,
-    237, 94, 1, 180, 240, 100, 114, 153, 197, 115, 14, 147, 61, 179, 250, 169, 156, 113, 139, 181, 138, 245, 32, 124,
-    80, 123, 32, 36, 100, 196, 215, 50, 162, 192, 80, 215, 194, 183, 160, 229, 65, 203, 33, 28, 137, 203, 188, 203, 2,
-    1, 32, 10, 66, 52, 227, 132, 18, 116, 107, 179, 79, 103, 48, 71, 5, 22, 80, 147, 144, 72, 251, 100, 95, 88, 139, 99,
-    151, 209, 0, 24, 217, 13, 56, 33, 66, 250, 228, 106, 77, 42, 28, 91, 85, 174, 76, 139, 238, 249, 139, 201, 213, 46,
-    156, 47, 45, 170, 122, 110, 205, 188, 237, 13, 99, 87, 252, 188, 96, 170, 90, 250, 177, 74, 66, 255, 240, 3, 225,
-    94, 253, 34, 230, 197, 102, 210, 233, 137, 219, 67, 108, 8, 77, 222, 192, 118, 37, 131, 13, 32, 38, 122, 248, 193,
-    20, 222, 7, 200, 135, 255, 19, 20, 80, 42, 205, 103, 129, 88, 43, 253, 183, 142, 123, 12, 67, 117, 13, 99, 231, 246,
-    22, 218, 255, 162, 81, 234, 121, 83, 54, 100, 21, 225, 163, 134, 233, 91, 92, 230, 70, 190, 195, 250, 249, 247, 81,
-    77, 128, 241, 7, 148, 159, 7, 213, 97, 49, 106, 107, 87, 198, 206, 168, 178, 82, 47, 79, 97, 37, 235, 220, 80, 73,
-    122, 34, 220, 139, 70, 128, 226, 243, 219, 225, 120, 104, 171, 251, 207, 22, 98, 197, 253, 30, 104, 205, 243, 151,
-    250, 169, 82, 98, 52, 108, 199, 164, 222, 11, 149, 201, 145, 128, 150, 28, 107, 3, 89, 242, 25, 23, 137, 255, 175,
-    62, 50, 168, 132, 137, 106, 11, 90, 112, 177, 37, 217, 148, 154, 6, 77, 100, 4, 114, 1, 88, 113, 150, 44, 135, 147,
-    73, 194, 44, 184, 187, 153, 214, 252, 216, 200, 212, 21, 93, 81, 156, 28, 9, 40, 151, 119, 215, 120, 224, 217, 34,
-    51, 21, 32, 229, 126, 9, 174, 64, 76, 136, 250, 41, 92, 139, 182, 178, 36, 168, 125, 183, 187, 206, 166, 203, 116,
-    231, 35, 135, 222, 22, 16, 23, 110, 247, 130, 198, 253, 51, 190, 244, 56, 214, 124, 55, 24, 127, 16, 39, 169, 211,
-    80, 233, 247, 179, 240, 189, 192, 249, 149, 213, 176, 152, 124, 63, 100, 101, 192, 2, 254, 129, 187, 199, 123, 1,
-    180, 1, 234, 18, 193, 135, 89, 135, 1, 7, 219, 85, 107, 142, 108, 176, 87, 114, 3, 246, 158, 24, 63, 188, 221, 140,
-    184, 151, 75, 227, 182, 97, 10, 21, 26, 192, 156, 227, 126, 40, 126, 220, 178, 220, 87, 79, 63, 122, 73, 85, 54,
-    189, 125, 67, 214, 182, 128, 54, 14, 96, 66, 223, 53, 67, 140, 149, 103, 156, 157, 33, 118, 32, 34, 204, 19, 28,
-    219, 129, 77, 148, 61, 208, 119, 44, 202, 80, 110, 247, 172, 169, 120, 227, 214, 31, 178, 37, 123, 244, 112, 158,
-    176, 141, 16, 242, 241, 127, 114, 0, 142, 115, 89, 14, 72, 161, 135, 106, 188, 124, 183, 55, 64, 196, 186, 50, 51,
-    63, 30, 224, 86, 151, 21, 212, 77, 68, 243, 49, 17, 5, 37, 246, 125, 42, 227, 181, 139, 6, 36, 193, 194, 46, 177,
-    240, 74, 244, 249, 38, 107, 229, 234, 50, 201, 205, 136, 51, 255, 110, 9, 179, 103, 116, 190, 222, 60, 164, 45, 17,
-    105, 233, 178, 104, 136, 34, 75, 111, 15, 61, 115, 47, 204, 95, 199, 86, 140, 250, 75, 223, 221, 199, 213, 82, 109,
-    82, 175, 6, 181, 114, 141, 230, 132, 37, 214, 210, 251, 73, 210, 55, 32, 55, 175, 94, 114, 60, 112, 183, 147, 196,
-    114, 219, 52, 201, 143, 76, 231, 114, 204, 27, 37, 51, 131, 192, 50, 165, 28, 118, 187, 129, 56, 55, 165, 9, 106,
-    192, 74, 125, 50, 22, 81, 74, 65, 69, 59, 245, 251, 97, 97, 83, 199, 98, 13, 88, 101, 190, 123, 94, 249, 252, 89,
-    241, 238, 67, 126, 243, 40, 59, 68, 135, 97, 4, 18, 173, 143, 69, 113, 219, 144, 128, 157, 9, 38, 154, 152, 28, 150,
-    194, 117, 213, 4, 68, 171, 21, 80, 143, 95, 90, 221, 207, 161, 225, 44, 55, 177, 11, 66, 126, 252, 173, 158, 141,
-    34, 100, 9, 156, 102, 23, 88, 103, 209, 185, 78, 169, 207, 137, 84, 60, 121, 59, 176, 160, 35, 14, 75, 197, 163, 25,
-    125, 93, 221, 156, 147, 41, 192, 43, 115, 2, 149, 0, 110, 123, 122, 35, 2, 167, 43, 183, 115, 14, 27, 178, 73, 222,
-    33, 237, 155, 205, 41, 113, 77, 58, 224, 169, 191, 236, 89, 34, 163, 234, 31, 183, 143, 233, 252, 160, 189, 150, 91,
-    207, 13, 63, 158, 3, 38, 184, 247, 206, 117, 47, 146, 14, 101, 32, 127, 255, 212, 49, 73, 23, 239, 208, 75, 233,
-    112, 177, 117, 148, 46, 27, 52, 12, 190, 79, 173, 99, 189, 165, 90, 155, 232, 50, 189, 119, 99, 82, 119, 123, 150,
-    87, 96, 166, 252, 83, 145, 253, 34, 111, 8, 111, 51, 76, 92, 210, 144, 60, 137, 72, 66, 128, 239, 190, 29, 211, 198,
-    170, 98, 250, 200, 42, 164, 100, 27, 124, 65, 53, 215, 5, 70, 72, 204, 96, 121, 35, 85, 180, 104, 255, 249, 48, 23,
-    187, 32, 102, 5, 217, 199, 197, 76, 90, 62, 171, 140, 121, 89, 21, 174, 194, 107, 216, 142, 240, 167, 193, 211, 142,
-    58, 47, 66, 33, 200, 111, 250, 47, 211, 55, 248, 144, 182, 38, 209, 3, 40, 115, 229, 50, 164, 75, 200, 31, 206, 225,
-    170, 87, 16, 73, 160, 113, 164, 90, 6, 54, 67, 0, 18, 249, 27, 244, 131, 170, 255, 35, 231, 156, 21, 222, 236, 212,
-    195, 97, 127, 62, 224, 213, 63, 66, 184, 28, 0, 71, 165, 209, 179, 245, 178, 151, 88, 7, 255, 247, 56, 216, 165, 97,
-    20, 180, 125, 1, 13, 236, 109, 214, 142, 126, 25, 156, 139, 213, 80, 209, 92, 123, 96, 178, 50, 10, 142, 146, 180,
-    202, 142, 102, 73, 173, 16, 89, 104, 173, 116, 30, 160, 48, 96, 100, 85, 8, 25, 212, 109, 172, 68, 130, 10, 8, 237,
-    114, 68, 78, 190, 1, 12, 166, 95, 206, 76, 153, 158, 38, 96, 207, 69, 52, 203, 159, 88, 66, 148, 110, 19, 7, 177,
-    119, 166, 251, 93, 174, 79, 158, 58, 45, 203, 48, 69, 175, 156, 131, 188, 2, 0, 156, 191, 250, 90, 181, 198, 148,
-    185, 119, 79, 78, 224, 253, 221, 204, 180, 236, 83, 178, 103, 89, 235, 85, 41, 197, 141, 217, 157, 3, 53, 75, 170,
-    80, 157, 225, 90, 38, 38, 254, 220, 221, 144, 134, 82, 246, 3, 86, 34, 183, 75, 38, 234, 125, 9, 175, 33, 241, 1,
-    253, 245, 30, 23, 130, 94, 200, 3, 194, 32, 74, 93, 195, 39, 122, 112, 102, 66, 63, 247, 213, 4, 53, 43, 120, 186,
-    207, 232, 137, 103, 254, 47, 38, 9, 186, 127, 148, 189, 166, 3, 214, 167, 203, 98, 185, 175, 244, 142, 104, 120,
-    185, 155, 171, 254, 124, 73, 82, 143, 31, 28, 135, 227, 186, 73, 182, 11, 176, 112, 56, 110, 141, 57, 104, 28, 238,
-    11, 47, 255, 149, 69, 113, 84, 46, 104, 219, 187, 171, 75, 138, 185, 184, 231, 106, 249, 146, 41, 158, 89, 123, 74,
-    197, 2, 112, 243, 231, 156, 104, 137, 212, 235, 247, 199, 231, 87, 62, 251, 54, 190, 191, 34, 39, 242, 126, 76, 48,
-    83, 148, 157, 69, 246, 59, 98, 18, 38, 163, 238, 1, 39, 167, 187, 205, 130, 114, 149, 41, 92, 248, 97, 203, 11, 250,
-    22, 23, 101, 14, 43, 8, 246, 74, 195, 31, 47, 76, 223, 111, 0, 24, 248, 111, 218, 13, 74, 45, 228, 253, 232, 198,
-    161, 59, 164, 161, 77, 191, 151, 90, 69, 49, 228, 7, 84, 242, 165, 69, 121, 135, 245, 221, 52, 72, 105, 11, 136, 63,
-    9, 106, 146, 151, 62, 197, 43, 75, 235, 168, 155, 42, 218, 245, 64, 87, 75, 84, 23, 187, 174, 231, 109, 31, 78, 157,
-    224, 119, 5, 167, 109, 161, 229, 203, 116, 97, 37, 21, 250, 109, 65, 26, 40, 113, 208, 91, 19, 13, 22, 161, 81, 80,
-    74, 2, 252, 255, 53, 251, 51, 89, 152, 216, 214, 146, 202, 21, 17, 134, 89, 159, 227, 198, 103, 140, 20, 170, 24,
-    14, 142, 12, 244, 157, 135, 203, 29, 164, 179, 202, 240, 228, 199, 185, 132, 5, 55, 29, 89, 188, 13, 252, 174, 186,
-    245, 4, 19, 8, 23, 127, 64, 58, 163, 190, 9, 105, 6, 230, 78, 246, 97, 33, 218, 33, 147, 108, 147, 215, 78, 166,
-    191, 39, 168, 68, 173, 83, 127, 242, 206, 88, 180, 2, 209, 179, 153, 142, 206, 217, 204, 42, 33, 144, 26, 140, 149,
-    69, 61, 193, 250, 50, 35, 223, 149, 176, 117, 0, 251, 94, 255, 20, 37, 101, 11, 171, 194, 242, 13, 169, 190, 108,
-    36, 249, 214, 101, 149, 236, 141, 131, 176, 219, 240, 192, 110, 61, 221, 222, 81, 114, 204, 101, 109, 69, 34, 126,
-    93, 121, 131, 28, 102, 190, 245, 210, 66, 149, 93, 83, 226, 27, 51, 238, 241, 57, 163, 141, 64, 214, 191, 194, 189,
-    181, 152, 87, 98, 89, 173, 143, 39, 140, 105, 140, 223, 13, 15, 201, 146, 131, 41, 27, 20, 198, 125, 18, 92, 192,
-    31, 164, 255, 154, 43, 244, 95, 201, 232, 220, 9, 190, 71, 38, 178, 145, 154, 103, 214, 48, 45, 81, 101, 130, 121,
-    0, 35, 198, 85, 113, 83, 166, 230, 186, 63, 98, 54, 239, 210, 40, 180, 100, 198, 232, 68, 214, 54, 200, 130, 143,
-    233, 81, 113, 39, 168, 169, 111, 54, 120, 172, 170, 67, 255, 21, 45, 46, 224, 215, 253, 208, 42, 38, 184, 215, 9,
-    113, 56, 115, 179, 118, 215, 106, 125, 54, 65, 22, 247, 57, 38, 127, 203, 82, 34, 218, 126, 126, 16, 222, 133, 204,
-    170, 88, 71, 41, 135, 61, 117, 54, 25, 161, 73, 174, 231, 253, 69, 221, 190, 67, 40, 111, 107, 158, 229, 194, 100,
-    107, 166, 227, 23, 248, 239, 33, 202, 252, 169, 177, 113, 94, 43, 167, 16, 60, 215, 23, 25, 111, 163, 152, 242, 223,
-    225, 171, 34, 32, 216, 220, 30, 112, 192, 98, 210, 84, 230, 16, 55, 202, 158, 174, 223, 103, 42, 168, 55, 182, 218,
-    191, 205, 18, 236, 157, 222, 160, 177, 176, 136, 7, 97, 127, 247, 208, 242, 30, 179, 227, 123, 39, 72, 86, 84, 190,
-    1, 241, 16, 109, 151, 207, 246, 185, 90, 5, 97, 243, 19, 7, 235, 170, 213, 41, 213, 42, 195, 209, 58, 187, 104, 51,
-    147, 107, 163, 134, 79, 218, 221, 17, 134, 182, 170, 10, 38, 127, 241, 159, 125, 192, 185, 133, 55, 142, 114, 145,
-    43, 84, 193, 242, 138, 13, 255, 232, 192, 178, 173, 170, 52, 43, 163, 84, 160, 106, 7, 214, 97, 194, 206, 109, 230,
-    32, 149, 201, 29, 245, 77, 227, 99, 212, 16, 195, 28, 240, 209, 224, 41, 245, 58, 26, 244, 196, 74, 166, 72, 58, 68,
-    42, 107, 25, 161, 68, 65, 38, 79, 25, 91, 75, 160, 117, 29, 227, 191, 81, 231, 6, 182, 34, 154, 115, 134, 100, 18,
-    195, 229, 229, 77, 171, 19, 244, 25, 189, 151, 33, 129, 112, 61, 240, 65, 190, 217, 230, 40, 233, 136, 87, 253, 89,
-    77, 76, 162, 59, 217, 207, 103, 220, 34, 8, 221, 0, 89, 139, 172, 112, 142, 78, 222, 243, 93, 117, 17, 12, 114, 163,
-    229, 4, 221, 201, 137, 203, 135, 30, 10, 249, 98, 127, 224, 165, 240, 29, 25, 148, 11, 51, 236, 106, 9, 109, 108,
-    142, 252, 132, 70, 64, 23, 180, 231, 173, 193, 25, 86, 147, 99, 245, 35, 75, 165, 134, 153, 50, 115, 142, 97, 4,
-    100, 226, 166, 189, 198, 54, 255, 13, 243, 26, 88, 24, 168, 155, 143, 237, 235, 120, 186, 187, 247, 4, 206, 109,
-    162, 104, 109, 169, 113, 87, 55, 30, 225, 214, 71, 21, 164, 61, 244, 241, 176, 129, 150, 141, 253, 5, 56, 252, 230,
-    136, 128, 113, 143, 17, 171, 13, 19, 41, 167, 192, 21, 255, 26, 235, 181, 152, 173, 26, 6, 254, 147, 172, 132, 0,
-    254, 163, 72, 84, 126, 0, 248, 121, 177, 239, 157, 189, 64, 210, 120, 192, 184, 21, 148, 40, 15, 201, 192, 253, 52,
-    180, 109, 28, 104, 18, 71, 242, 97, 193, 140, 41, 17, 201, 223, 72, 116, 188, 152, 141, 200, 152, 183, 193, 200,
-    132, 143, 17, 61, 245, 37, 86, 203, 206, 202, 163, 189, 121, 172, 130, 0, 131, 222, 149, 110, 2, 212, 5, 101, 54,
-    65, 64, 51, 31, 246, 56, 65, 20, 63, 118, 236, 151, 48, 195, 129, 11, 120, 187, 130, 6, 124, 110, 57, 53, 85, 255,
-    96, 13, 58, 100, 88, 116, 64, 247, 31, 192, 145, 249, 226, 250, 69, 188, 49, 83, 252, 237, 116, 118, 50, 102, 237,
-    146, 210, 58, 23, 144, 249, 150, 123, 177, 19, 173, 47, 79, 202, 85, 92, 66, 64, 226, 14, 126, 242, 77, 34, 73, 200,
-    94, 224, 78, 172, 21, 38, 250, 186, 52, 59, 34, 128, 119, 43, 224, 10, 202, 7, 40, 139, 90, 97, 175, 29, 64, 62,
-    139, 249, 1, 157, 106, 44, 84, 191, 166, 82, 178, 25, 193, 232, 72, 215, 231, 241, 106, 75, 38, 119, 252, 128, 31,
-    57, 231, 168, 96, 5, 39, 208, 48, 60, 164, 193, 115, 32, 128, 253, 163, 92, 84, 110, 50, 145, 204, 152, 119, 175,
-    131, 177, 175, 126, 211, 135, 182, 56, 136, 128, 57, 44, 243, 96, 150, 72, 114, 48, 181, 118, 79, 189, 240, 66, 233,
-    248, 177, 103, 120, 12, 128, 227, 23, 18, 168, 138, 8, 116, 244, 92, 31, 149, 127, 124, 235, 42, 76, 253, 224, 229,
-    88, 175, 120, 213, 5, 112, 233, 231, 232, 192, 168, 18, 92, 217, 204, 144, 115, 184, 60, 92, 15, 208, 161, 215, 184,
-    117, 4, 27, 186, 32, 193, 123, 32, 7, 139, 155, 99, 199, 183, 69, 99, 51, 136, 78, 186, 3, 86, 255, 242, 41, 202,
-    157, 180, 123, 250, 198, 205, 150, 158, 28, 31, 4, 13, 186, 172, 213, 84, 146, 61, 24, 246, 60, 77, 50, 138, 250,
-    230, 231, 155, 96, 144, 213, 112, 239, 95, 100, 17, 123, 110, 239, 27, 120, 67, 131, 249, 71, 212, 91, 69, 115, 233,
-    87, 182, 235, 63, 55, 72, 76, 243, 26, 34, 171, 241, 142, 24, 96, 79, 153, 225, 6, 27, 94, 185, 37, 161, 52, 152,
-    110, 49, 163, 139, 50, 101, 11, 102, 7, 168, 245, 116, 162, 162, 172, 179, 173, 233, 156, 113, 159, 97, 185, 159,
-    120, 33, 142, 240, 235, 125, 101, 246, 81, 178, 204, 73, 194, 226, 123, 2, 31, 119, 234, 179, 123, 24, 60, 235, 167,
-    255, 209, 119, 22, 203, 6, 65, 1, 1, 2, 204, 75, 159, 146, 122, 30, 212, 177, 58, 163, 19, 201, 16, 137, 159, 14,
-    164, 180, 29, 207, 6, 218, 93, 202, 105, 116, 210, 195, 174, 138, 242, 151, 220, 115, 78, 51, 62, 197, 30, 25, 136,
-    19, 72, 207, 209, 83, 232, 9, 140, 60, 91, 143, 45, 222, 131, 149, 174, 211, 242, 245, 181, 232, 188, 175, 142, 92,
-    177, 63, 158, 162, 110, 74, 243, 14, 117, 239, 166, 145, 41, 85, 126, 11, 208, 189, 136, 103, 158, 223, 174, 116, 3,
-    127, 163, 90, 185, 44, 20, 99, 51, 76, 169, 240, 149, 189, 54, 91, 139, 134, 22, 244, 90, 72, 173, 95, 202, 211,
-    130, 167, 162, 45, 221, 255, 153, 111, 249, 224, 131, 246, 106, 205, 100, 17, 84, 81, 8, 190, 223, 155, 133, 23, 16,
-    116, 189, 51, 70, 199, 13, 19, 11, 171, 33, 51, 112, 178, 33, 201, 220, 251, 166, 166, 60, 214, 153, 170, 20, 173,
-    100, 7, 144, 241, 197, 127, 81, 174, 92, 100, 106, 163, 188, 71, 81, 215, 25, 134, 234, 157, 70, 48, 110, 189, 101,
-    185, 175, 85, 173, 211, 225, 151, 148, 147, 215, 221, 22, 152, 61, 89, 44, 90, 75, 172, 132, 238, 143, 157, 23, 225,
-    251, 32, 168, 116, 105, 42, 67, 132, 10, 158, 154, 95, 223, 232, 232, 76, 72, 102, 226, 191, 48, 193, 143, 113, 74,
-    39, 127, 140, 80, 238, 55, 118, 140, 111, 25, 157, 116, 199, 128, 45, 120, 117, 157, 243, 51, 194, 43, 30, 51, 72,
-    44, 64, 174, 59, 156, 173, 26, 2, 233, 223, 114, 68, 109, 105, 43, 102, 13, 76, 212, 34, 88, 123, 37, 108, 6, 97,
-    211, 208, 45, 237, 67, 212, 198, 248, 13, 146, 62, 54, 54, 154, 226, 170, 98, 148, 220, 60, 136, 219, 71, 77, 125,
-    121, 107, 239, 241, 192, 212, 163, 47, 56, 9, 136, 36, 184, 10, 205, 168, 45, 203, 136, 213, 52, 187, 43, 15, 132,
-    20, 138, 67, 162, 175, 235, 15, 128, 155, 169, 94, 208, 229, 250, 174, 168, 250, 152, 103, 91, 173, 135, 24, 60,
-    138, 94, 215, 14, 85, 86, 217, 219, 43, 54, 98, 103, 140, 37, 219, 14, 205, 15, 219, 34, 113, 37, 181, 159, 72, 166,
-    146, 183, 141, 74, 27, 122, 215, 180, 231, 243, 58, 136, 234, 15, 197, 131, 149, 39, 114, 209, 153, 157, 45, 52, 34,
-    177, 184, 18, 97, 99, 146, 39, 30, 18, 49, 85, 196, 158, 247, 109, 1, 167, 16, 76, 161, 175, 200, 55, 179, 177, 113,
-    124, 67, 110, 35, 225, 162, 112, 193, 124, 85, 235, 85, 225, 35, 80, 146, 36, 135, 231, 119, 208, 61, 49, 145, 129,
-    173, 16, 92, 36, 5, 250, 102, 189, 189, 214, 238, 7, 222, 191, 188, 91, 125, 190, 247, 227, 139, 54, 8, 67, 81, 123,
-    49, 229, 117, 181, 12, 36, 84, 59, 52, 177, 142, 58, 180, 251, 102, 43, 135, 81, 1, 246, 50, 45, 172, 6, 169, 36,
-    158, 153, 123, 122, 237, 65, 132, 150, 255, 79, 193, 205, 250, 145, 180, 149, 178, 172, 26, 151, 176, 132, 19, 187,
-    10, 105, 218, 93, 32, 133, 106, 66, 23, 64, 73, 154, 52, 200, 54, 219, 124, 142, 240, 113, 33, 129, 192, 52, 118,
-    205, 255, 64, 3, 149, 159, 46, 247, 84, 59, 182, 146, 150, 6, 37, 167, 205, 5, 168, 13, 51, 137, 224, 252, 218, 89,
-    51, 43, 183, 75, 206, 50, 133, 106, 177, 245, 20, 167, 171, 68, 78, 101, 57, 200, 112, 25, 231, 222, 64, 14, 55,
-    115, 98, 164, 20, 172, 181, 237, 221, 227, 210, 134, 33, 213, 108, 241, 27, 189, 75, 204, 82, 24, 163, 15, 40, 27,
-    89, 189, 184, 195, 89, 57, 44, 111, 7, 41, 178, 131, 202, 171, 8, 86, 181, 127, 19, 20, 226, 28, 7, 101, 229, 12,
-    90, 186, 225, 138, 190, 249, 105, 25, 98, 60, 25, 39, 4, 220, 165, 75, 140, 109, 123, 143, 68, 124, 23, 10, 60, 101,
-    41, 59, 148, 86, 160, 126, 121, 89, 159, 229, 229, 255, 202, 253, 201, 142, 232, 125, 88, 222, 90, 180, 40, 52, 96,
-    162, 140, 122, 137, 239, 61, 254, 185, 157, 186, 136, 88, 238, 47, 74, 241, 146, 118, 234, 205, 84, 50, 231, 30, 37,
-    48, 60, 144, 207, 91, 200, 17, 35, 20, 166, 236, 88, 2, 126, 27, 136, 138, 166, 76, 179, 192, 135, 215, 91, 198,
-    252, 39, 39, 57, 108, 246, 165, 132, 179, 103, 78, 23, 127, 14, 120, 79, 199, 175, 68, 150, 39, 83, 146, 183, 191,
-    222, 117, 80, 248, 101, 137, 103, 215, 123, 74, 149, 67, 82, 44, 185, 66, 191, 167, 186, 210, 203, 204, 236, 34, 88,
-    54, 199, 240, 162, 39, 14, 44, 138, 30, 81, 62, 104, 158, 228, 48, 169, 1, 196, 237, 116, 80, 78, 66, 154, 64, 42,
-    240, 45, 130, 227, 171, 226, 80, 84, 186, 207, 51, 81, 164, 208, 12, 172, 151, 135, 27, 232, 36, 86, 151, 3, 75,
-    242, 174, 224, 132, 245, 13, 83, 237, 8, 73, 10, 153, 77, 183, 93, 192, 35, 168, 18, 61, 74, 151, 50, 45, 211, 225,
-    114, 46, 76, 147, 18, 70, 5, 197, 121, 8, 112, 148, 115, 180, 244, 255, 233, 42, 214, 234, 41, 72, 166, 91, 194, 20,
-    221, 226, 184, 104, 249, 39, 216, 53, 144, 102, 41, 45, 173, 199, 169, 94, 58, 0, 206, 54, 157, 230, 55, 80, 123,
-    10, 196, 71, 197, 55, 9, 75, 26, 186, 29, 128, 135, 186, 36, 244, 30, 147, 213, 108, 80, 30, 243, 78, 109, 72, 53,
-    77, 162, 63, 203, 211, 83, 252, 111, 39, 195, 25, 96, 73, 150, 146, 97, 117, 95, 181, 55, 179, 110, 163, 227, 197,
-    141, 123, 123, 83, 240, 228, 212, 254, 79, 38, 252, 97, 237, 74, 218, 197, 184, 14, 9, 139, 204, 148, 199, 237, 89,
-    66, 215, 57, 164, 95, 165, 185, 85, 255, 97, 230, 12, 232, 75, 202, 127, 178, 39, 118, 98, 243, 239, 139, 100, 158,
-    230, 64, 192, 40, 97, 154, 166, 25, 233, 214, 168, 191, 141, 242, 194, 168, 178, 178, 159, 243, 18, 175, 131, 4, 1,
-    38, 67, 45, 76, 219, 73, 61, 19, 27, 253, 20, 164, 179, 17, 229, 115, 64, 119, 248, 107, 155, 36, 164, 231, 140, 46,
-    142, 138, 132, 254, 208, 141, 254, 205, 223, 31, 121, 10, 228, 95, 94, 114, 34, 118, 166, 239, 124, 241, 220, 145,
-    39, 120, 248, 94, 230, 188, 146, 13, 21, 89, 50, 13, 117, 239, 251, 42, 121, 223, 238, 224, 128, 219, 229, 97, 69,
-    101, 186, 67, 77, 41, 142, 12, 109, 142, 92, 161, 49, 146, 99, 17, 169, 172, 87, 39, 249, 21, 156, 253, 147, 241,
-    19, 116, 188, 179, 39, 48, 122, 227, 237, 108, 187, 32, 72, 147, 45, 227, 163, 150, 32, 71, 68, 68, 225, 209, 73, 6,
-    240, 203, 180, 8, 135, 232, 57, 226, 148, 152, 242, 162, 115, 208, 129, 163, 202, 191, 157, 248, 213, 32, 94, 202,
-    158, 37, 179, 53, 137, 250, 11, 202, 102, 64, 116, 210, 199, 191, 32, 67, 251, 167, 7, 186, 163, 57, 77, 6, 165, 84,
-    68, 158, 183, 13, 95, 161, 138, 7, 99, 243, 85, 215, 236, 133, 58, 196, 15, 25, 54, 100, 87, 67, 163, 125, 34, 160,
-    184, 116, 88, 101, 220, 255, 69, 232, 143, 201, 14, 210, 28, 40, 36, 245, 234, 29, 24, 168, 37, 237, 252, 83, 187,
-    149, 97, 233, 46, 119, 241, 188, 70, 27, 50, 65, 201, 220, 137, 235, 112, 249, 72, 173, 6, 171, 19, 102, 241, 65,
-    191, 36, 107, 157, 212, 62, 83, 125, 153, 163, 158, 110, 234, 250, 236, 13, 115, 239, 153, 252, 125, 255, 111, 34,
-    240, 90, 54, 242, 39, 198, 117, 130, 101, 205, 26, 208, 218, 221, 170, 224, 24, 222, 142, 185, 106, 211, 190, 1,
-    195, 47, 39, 17, 218, 235, 124, 45, 163, 124, 87, 65, 117, 231, 150, 143, 55, 179, 153, 5, 164, 18, 88, 61, 6, 188,
-    193, 214, 83, 5, 110, 41, 94, 168, 12, 121, 245, 103, 29, 158, 238, 212, 95, 15, 70, 23, 130, 206, 228, 182, 169,
-    190, 156, 100, 105, 37, 42, 63, 173, 36, 135, 68, 31, 124, 185, 35, 224, 170, 98, 53, 156, 93, 164, 29, 33, 110, 78,
-    223, 43, 188, 78, 200, 165, 222, 219, 37, 96, 193, 60, 244, 139, 13, 96, 139, 39, 157, 164, 59, 64, 61, 212, 138,
-    33, 19, 110, 164, 112, 225, 228, 227, 8, 229, 228, 48, 90, 120, 16, 42, 103, 191, 24, 0, 26, 71, 46, 132, 236, 250,
-    0, 148, 26, 68, 133, 203, 186, 25, 209, 31, 70, 19, 246, 244, 130, 67, 200, 34, 95, 120, 80, 243, 33, 87, 72, 200,
-    241, 195, 226, 64, 76, 65, 184, 171, 56, 200, 13, 98, 6, 82, 65, 53, 85, 78, 52, 244, 184, 121, 254, 129, 103, 56,
-    166, 122, 122, 55, 105, 79, 89, 215, 38, 98, 122, 77, 92, 215, 92, 67, 222, 209, 202, 62, 61, 102, 164, 99, 147,
-    103, 51, 203, 124, 53, 253, 148, 95, 148, 144, 37, 200, 152, 52, 60, 59, 149, 144, 117, 137, 67, 189, 66, 190, 237,
-    52, 177, 131, 86, 163, 197, 178, 119, 233, 44, 235, 103, 172, 172, 215, 64, 12, 205, 103, 176, 111, 113, 195, 165,
-    195, 104, 41, 186, 170, 181, 52, 220, 167, 206, 153, 27, 201, 73, 108, 75, 84, 123, 177, 167, 133, 157, 159, 30,
-    149, 193, 241, 78, 10, 37, 126, 140, 41, 2, 6, 206, 239, 49, 8, 150, 163, 167, 93, 186, 111, 201, 58, 158, 77, 193,
-    35, 2, 100, 2, 158, 224, 68, 120, 253, 160, 138, 120, 193, 147, 222, 103, 157, 214, 235, 138, 76, 138, 227, 158, 77,
-    131, 67, 41, 127, 59, 106, 189, 112, 96, 55, 161, 235, 166, 220, 136, 172, 88, 196, 109, 172, 26, 159, 134, 155, 39,
-    215, 237, 239, 135, 139, 145, 82, 127, 235, 212, 154, 247, 138, 13, 139, 46, 192, 192, 59, 89, 68, 109, 18, 219, 27,
-    22, 220, 217, 43, 125, 217, 88, 28, 168, 193, 122, 80, 249, 61, 246, 30, 201, 225, 147, 73, 88, 64, 162, 231, 150,
-    229, 133, 164, 221, 36, 79, 182, 137, 27, 231, 251, 31, 226, 70, 159, 168, 27, 138, 65, 200, 67, 105, 230, 58, 193,
-    187, 194, 250, 20, 118, 186, 134, 147, 79, 112, 84, 250, 185, 241, 12, 181, 9, 84, 15, 229, 249, 70, 96, 213, 90,
-    164, 58, 150, 235, 181, 171, 156, 238, 151, 153, 66, 12, 35, 163, 41, 20, 56, 143, 22, 92, 47, 43, 73, 218, 100,
-    183, 28, 59, 180, 89, 45, 165, 158, 104, 185, 1, 220, 216, 220, 60, 113, 120, 30, 84, 0, 156, 58, 99, 223, 93, 207,
-    28, 205, 151, 120, 96, 8, 184, 240, 177, 57, 223, 225, 136, 18, 223, 56, 72, 195, 43, 141, 206, 153, 136, 28, 155,
-    69, 15, 74, 232, 143, 22, 64, 200, 96, 57, 207, 227, 2, 56, 64, 30, 162, 73, 166, 207, 239, 39, 197, 132, 63, 101,
-    200, 161, 13, 236, 54, 34, 229, 108, 33, 172, 252, 165, 105, 103, 245, 91, 29, 30, 144, 80, 114, 104, 114, 217, 92,
-    104, 222, 139, 3, 190, 121, 207, 15, 56, 212, 26, 46, 185, 126, 108, 13, 7, 12, 18, 78, 174, 140, 92, 47, 5, 219,
-    118, 44, 252, 158, 51, 43, 90, 239, 11, 244, 225, 120, 216, 31, 179, 91, 178, 167, 212, 52, 128, 198, 11, 23, 225,
-    16, 17, 90, 204, 132, 88, 121, 48, 165, 212, 1, 51, 134, 175, 176, 110, 54, 233, 212, 185, 26, 230, 235, 116, 152,
-    42, 40, 180, 179, 180, 144, 224, 220, 82, 32, 167, 83, 187, 40, 233, 251, 135, 115, 127, 201, 12, 27, 81, 115, 77,
-    98, 92, 241, 163, 96, 169, 157, 216, 169, 179, 154, 77, 142, 84, 194, 237, 4, 189, 142, 97, 199, 102, 133, 22, 186,
-    156, 238, 163, 52, 199, 188, 16, 237, 89, 122, 29, 27, 225, 148, 105, 18, 246, 120, 3, 208, 148, 143, 89, 41, 155,
-    183, 155, 22, 76, 212, 226, 197, 209, 196, 16, 59, 91, 63, 144, 166, 155, 61, 9, 23, 138, 36, 65, 71, 233, 30, 44,
-    68, 146, 119, 133, 100, 107, 105, 63, 208, 51, 83, 58, 205, 156, 156, 190, 19, 13, 250, 46, 118, 67, 169, 207, 45,
-    22, 73, 9, 43, 26, 227, 157, 243, 109, 77, 41, 231, 253, 62, 160, 123, 164, 23, 163, 95, 123, 33, 237, 151, 170,
-    149, 79, 209, 244, 3, 226, 117, 117, 104, 168, 245, 102, 253, 226, 108, 106, 251, 180, 82, 190, 170, 160, 202, 134,
-    59, 243, 138, 226, 202, 77, 12, 219, 173, 162, 156, 62, 139, 24, 205, 24, 93, 25, 17, 209, 166, 145, 173, 17, 83,
-    47, 45, 104, 42, 115, 67, 167, 106, 254, 252, 91, 3, 255, 190, 11, 221, 229, 3, 161, 243, 116, 205, 255, 230, 174,
-    218, 152, 71, 232, 115, 55, 173, 148, 108, 71, 177, 62, 250, 195, 176, 110, 103, 103, 164, 19, 194, 202, 242, 220,
-    192, 116, 99, 82, 123, 221, 23, 171, 97, 16, 0, 101, 76, 82, 171, 43, 229, 99, 192, 75, 10, 54, 88, 189, 51, 215,
-    153, 128, 114, 35, 255, 237, 203, 224, 32, 42, 237, 198, 149, 24, 59, 200, 52, 153, 160, 2, 222, 26, 21, 147, 180,
-    204, 211, 190, 112, 135, 190, 121, 100, 18, 173, 51, 213, 80, 163, 195, 27, 112, 74, 139, 139, 140, 86, 110, 11, 58,
-    233, 240, 120, 31, 249, 94, 64, 137, 185, 0, 246, 174, 21, 148, 128, 16, 189, 161, 55, 182, 97, 79, 96, 121, 19, 45,
-    255, 94, 6, 136, 105, 30, 60, 117, 147, 49, 128, 222, 196, 169, 33, 254, 131, 248, 205, 90, 121, 199, 190, 53, 244,
-    58, 29, 10, 124, 119, 220, 75, 36, 165, 243, 29, 112, 209, 20, 253, 4, 209, 255, 32, 17, 107, 59, 118, 100, 158, 49,
-    201, 106, 37, 189, 218, 215, 252, 229, 161, 191, 53, 62, 210, 148, 0, 106, 193, 134, 61, 153, 250, 3, 32, 37, 35,
-    177, 244, 0, 30, 29, 81, 200, 7, 9, 74, 252, 238, 106, 214, 199, 74, 76, 29, 202, 191, 242, 120, 19, 174, 221, 70,
-    203, 216, 235, 159, 223, 190, 130, 103, 193, 182, 111, 160, 207, 118, 175, 92, 40, 32, 242, 31, 109, 212, 66, 21,
-    73, 75, 190, 223, 130, 7, 29, 185, 81, 35, 170, 75, 36, 115, 186, 69, 184, 232, 31, 159, 22, 54, 78, 189, 142, 41,
-    174, 63, 187, 200, 103, 192, 254, 88, 167, 166, 94, 186, 42, 14, 251, 124, 245, 106, 181, 153, 96, 229, 53, 202, 37,
-    220, 247, 15, 132, 96, 49, 10, 123, 215, 187, 50, 167, 202, 170, 92, 11, 160, 136, 186, 226, 253, 195, 200, 167, 94,
-    152, 64, 77, 255, 17, 243, 66, 153, 24, 192, 149, 114, 239, 126, 14, 110, 218, 47, 190, 72, 20, 36, 241, 245, 234,
-    126, 204, 140, 14, 31, 245, 176, 111, 215, 19, 247, 135, 45, 226, 134, 8, 81, 245, 247, 196, 182, 50, 157, 101, 242,
-    110, 157, 136, 218, 120, 104, 219, 61, 240, 67, 220, 230, 89, 20, 233, 205, 53, 236, 221, 53, 148, 24, 154, 177, 61,
-    181, 168, 190, 4, 245, 232, 236, 189, 55, 192, 201, 200, 37, 228, 183, 186, 115, 83, 254, 90, 28, 25, 255, 206, 36,
-    19, 46, 158, 21, 19, 236, 18, 199, 136, 120, 62, 247, 205, 232, 67, 55, 69, 158, 109, 193, 25, 222, 118, 77, 224,
-    85, 52, 37, 16, 251, 157, 108, 167, 68, 234, 169, 40, 179, 55, 149, 25, 88, 106, 233, 23, 103, 61, 193, 49, 246, 41,
-    132, 3, 167, 164, 38, 186, 33, 99, 226, 101, 251, 107, 244, 205, 119, 96, 112, 166, 189, 129, 41, 152, 26, 49, 247,
-    165, 56, 60, 77, 253, 250, 34, 68, 236, 162, 38, 193, 181, 20, 133, 211, 48, 3, 251, 162, 224, 50, 229, 219, 41,
-    145, 247, 52, 250, 127, 99, 117, 107, 95, 218, 66, 108, 131, 108, 112, 51, 221, 35, 104, 213, 50, 64, 214, 254, 134,
-    1, 120, 78, 162, 203, 25, 85, 107, 44, 123, 140, 88, 191, 100, 122, 64, 156, 137, 218, 176, 172, 141, 201, 145, 1,
-    33, 112, 62, 193, 72, 42, 181, 113, 122, 149, 206, 236, 73, 94, 230, 107, 26, 162, 37, 77, 202, 229, 117, 205, 35,
-    92, 121, 234, 81, 207, 116, 178, 149, 77, 177, 124, 88, 84, 183, 47, 76, 68, 192, 38, 88, 145, 224, 181, 230, 55,
-    148, 161, 228, 84, 158, 225, 223, 154, 15, 120, 33, 88, 56, 241, 96, 33, 209, 23, 180, 66, 83, 5, 226, 204, 252,
-    122, 98, 33, 188, 11, 86, 85, 172, 13, 89, 63, 240, 21, 2, 219, 162, 243, 44, 106, 184, 2, 168, 248, 234, 250, 239,
-    33, 68, 64, 145, 151, 155, 130, 188, 51, 240, 230, 48, 14, 198, 137, 234, 158, 209, 98, 149, 90, 222, 6, 116, 5,
-    212, 103, 103, 154, 16, 15, 133, 70, 187, 141, 11, 253, 172, 174, 238, 205, 254, 159, 69, 48, 159, 169, 70, 182,
-    248, 19, 169, 188, 25, 223, 93, 217, 131, 132, 227, 81, 48, 55, 101, 14, 142, 185, 235, 56, 156, 83, 38, 66, 86, 35,
-    106, 58, 90, 19, 160, 245, 110, 41, 79, 154, 90, 48, 37, 104, 50, 62, 62, 8, 20, 98, 218, 10, 8, 117, 212, 87, 86,
-    55, 117, 241, 98, 15, 138, 224, 3, 131, 178, 224, 141, 168, 186, 247, 36, 230, 70, 131, 205, 214, 66, 56, 89, 70,
-    79, 12, 222, 121, 27, 69, 249, 199, 67, 42, 134, 255, 147, 212, 37, 61, 80, 137, 184, 57, 159, 94, 73, 118, 183,
-    186, 43, 192, 45, 58, 201, 21, 202, 138, 225, 249, 68, 33, 179, 65, 62, 250, 189, 58, 174, 33, 137, 125, 62, 221,
-    47, 9, 18, 133, 86, 231, 242, 217, 148, 125, 52, 197, 46, 15, 91, 242, 241, 240, 211, 213, 113, 137, 53, 162, 153,
-    209, 21, 189, 201, 65, 157, 180, 75, 32, 208, 21, 252, 144, 186, 143, 254, 75, 100, 116, 155, 175, 88, 153, 142, 36,
-    120, 101, 127, 52, 9, 246, 27, 245, 228, 221, 185, 108, 81, 163, 48, 247, 114, 236, 175, 254, 96, 26, 50, 134, 194,
-    240, 120, 109, 50, 252, 72, 10, 18, 90, 115, 140, 103, 160, 225, 70, 60, 18, 121, 189, 159, 219, 244, 6, 155, 198,
-    136, 121, 208, 73, 197, 73, 158, 113, 23, 219, 63, 231, 209, 166, 38, 87, 236, 111, 62, 129, 56, 92, 115, 19, 170,
-    73, 11, 113, 150, 251, 88, 211, 86, 201, 116, 225, 96, 88, 139, 3, 196, 103, 18, 123, 122, 213, 187, 57, 164, 255,
-    66, 11, 24, 67, 30, 15, 220, 106, 96, 137, 210, 32, 147, 16, 89, 58, 155, 130, 116, 56, 199, 82, 223, 115, 218, 204,
-    198, 233, 93, 40, 45, 89, 175, 190, 50, 141, 162, 42, 150, 11, 26, 102, 239, 118, 194, 196, 183, 186, 253, 152, 50,
-    61, 189, 221, 130, 11, 170, 109, 190, 78, 31, 107, 88, 88, 65, 243, 79, 133, 70, 233, 46, 247, 159, 10, 65, 9, 186,
-    219, 159, 114, 154, 27, 44, 35, 57, 10, 221, 80, 212, 211, 62, 54, 53, 176, 7, 62, 246, 151, 11, 244, 157, 250, 0,
-    223, 36, 125, 60, 151, 70, 84, 57, 13, 48, 126, 255, 201, 77, 168, 62, 231, 155, 120, 163, 31, 171, 231, 164, 226,
-    156, 122, 90, 34, 155, 78, 29, 160, 48, 69, 118, 104, 178, 194, 82, 214, 89, 235, 31, 90, 65, 21, 227, 18, 108, 105,
-    192, 116, 28, 127, 47, 150, 15, 108, 113, 166, 64, 179, 211, 117, 36, 134, 59, 210, 236, 174, 85, 48, 77, 213, 23,
-    59, 123, 88, 225, 115, 123, 3, 250, 15, 28, 193, 127, 193, 52, 71, 197, 130, 50, 110, 18, 88, 91, 48, 200, 24, 33,
-    72, 4, 239, 216, 125, 250, 120, 61, 113, 71, 21, 224, 157, 33, 85, 150, 223, 115, 117, 239, 204, 146, 60, 90, 66,
-    148, 242, 121, 50, 223, 134, 32, 14, 45, 63, 193, 30, 52, 82, 15, 42, 144, 126, 156, 229, 149, 87, 15, 88, 8, 173,
-    159, 123, 244, 52, 108, 27, 230, 130, 244, 118, 94, 1, 180, 224, 73, 33, 26, 134, 23, 252, 43, 144, 49, 255, 231,
-    42, 166, 138, 51, 111, 116, 6, 111, 62, 20, 67, 16, 43, 240, 69, 142, 228, 105, 109, 17, 155, 250, 209, 128, 164,
-    101, 80, 239, 252, 94, 76, 51, 79, 71, 180, 236, 131, 1, 135, 124, 22, 63, 18, 82, 77, 247, 80, 140, 142, 186, 121,
-    33, 66, 245, 79, 46, 13, 205, 173, 49, 118, 236, 49, 22, 28, 140, 4, 8, 210, 210, 218, 242, 57, 61, 218, 254, 37,
-    21, 225, 153, 218, 176, 188, 80, 16, 241, 133, 13, 149, 176, 252, 101, 139, 52, 30, 4, 15, 156, 201, 167, 115, 128,
-    128, 86, 184, 15, 103, 26, 248, 77, 198, 183, 215, 142, 229, 2, 102, 199, 233, 215, 241, 223, 127, 43, 56, 193, 202,
-    79, 193, 216, 187, 162, 119, 247, 129, 162, 180, 70, 196, 153, 191, 230, 48, 169, 67, 193, 61, 30, 234, 171, 57, 34,
-    88, 73, 52, 49, 103, 164, 127, 106, 131, 88, 15, 49, 196, 233, 96, 50, 104, 131, 87, 235, 150, 61, 11, 8, 121, 218,
-    117, 65, 9, 97, 255, 181, 197, 107, 154, 37, 233, 213, 195, 252, 192, 102, 20, 10, 240, 38, 231, 244, 160, 106, 156,
-    17, 96, 63, 197, 11, 83, 159, 22, 129, 74, 213, 127, 176, 189, 236, 20, 192, 248, 113, 191, 231, 38, 35, 117, 115,
-    34, 115, 35, 27, 117, 177, 236, 252, 172, 65, 57, 102, 37, 37, 60, 61, 99, 91, 112, 80, 186, 73, 16, 200, 11, 227,
-    211, 121, 171, 18, 156, 199, 239, 248, 182, 121, 13, 147, 152, 150, 255, 222, 218, 111, 241, 243, 53, 99, 45, 215,
-    18, 104, 140, 4, 160, 42, 238, 155, 22, 208, 55, 192, 207, 144, 169, 90, 164, 233, 31, 109, 186, 87, 214, 34, 168,
-    175, 143, 99, 31, 75, 246, 158, 28, 204, 174, 245, 89, 179, 145, 233, 141, 206, 42, 168, 94, 51, 104, 56, 105, 108,
-    222, 49, 101, 121, 95, 16, 144, 63, 35, 167, 52, 91, 24, 205, 116, 201, 33, 253, 244, 120, 125, 57, 201, 55, 221,
-    189, 23, 3, 189, 236, 157, 154, 237, 172, 23, 23, 61, 17, 111, 39, 71, 179, 65, 226, 59, 76, 34, 138, 16, 83, 103,
-    148, 213, 110, 125, 193, 222, 75, 120, 210, 141, 43, 120, 150, 215, 139, 168, 171, 71, 164, 205, 85, 117, 122, 194,
-    70, 86, 148, 156, 246, 18, 219, 224, 113, 209, 250, 122, 200, 98, 219, 62, 190, 50, 73, 118, 199, 55, 142, 129, 7,
-    32, 167, 54, 153, 71, 113, 73, 121, 159, 132, 233, 2, 104, 27, 125, 218, 167, 24, 157, 64, 160, 77, 215, 69, 211,
-    153, 40, 189, 156, 147, 128, 49, 30, 182, 198, 99, 179, 205, 23, 172, 48, 247, 92, 243, 66, 251, 111, 200, 58, 78,
-    224, 110, 68, 241, 121, 93, 91, 245, 95, 27, 58, 162, 39, 52, 77, 214, 101, 248, 10, 181, 189, 125, 43, 14, 12, 122,
-    158, 236, 252, 43, 117, 148, 181, 220, 235, 85, 199, 22, 52, 101, 226, 97, 47, 130, 189, 117, 161, 11, 67, 138, 181,
-    205, 221, 42, 232, 160, 28, 3, 159, 72, 82, 184, 143, 199, 32, 15, 43, 167, 113, 173, 16, 166, 22, 51, 55, 120, 56,
-    51, 186, 151, 121, 176, 92, 162, 202, 144, 16, 8, 117, 7, 92, 151, 23, 248, 215, 13, 199, 6, 27, 23, 67, 72, 93,
-    206, 129, 215, 48, 56, 163, 119, 182, 144, 184, 179, 127, 245, 73, 148, 218, 6, 38, 64, 208, 28, 213, 79, 129, 175,
-    134, 114, 11, 138, 226, 51, 122, 225, 216, 34, 68, 180, 145, 84, 64, 99, 83, 116, 253, 155, 251, 125, 193, 127, 162,
-    155, 174, 254, 250, 78, 192, 169, 21, 140, 63, 56, 156, 154, 163, 133, 84, 54, 139, 104, 174, 83, 186, 13, 43, 13,
-    29, 30, 122, 31, 166, 18, 4, 187, 172, 29, 111, 50, 139, 6, 198, 205, 72, 189, 199, 214, 117, 123, 167, 3, 173, 198,
-    120, 234, 107, 54, 213, 78, 157, 243, 118, 78, 242, 196, 202, 219, 8, 238, 5, 111, 177, 7, 116, 74, 194, 224, 252,
-    213, 78, 208, 216, 237, 243, 187, 151, 67, 102, 81, 27, 44, 133, 163, 186, 254, 66, 200, 179, 225, 210, 81, 149,
-    159, 129, 217, 15, 10, 147, 233, 94, 47, 166, 216, 215, 92, 124, 108, 2, 18, 174, 111, 197, 216, 247, 180, 40, 122,
-    122, 206, 132, 52, 128, 120, 172, 39, 243, 135, 241, 90, 161, 124, 121, 104, 243, 145, 208, 142, 183, 225, 231, 12,
-    194, 37, 22, 160, 6, 48, 140, 161, 130, 116, 213, 59, 235, 159, 162, 194, 249, 105, 63, 228, 206, 175, 19, 251, 201,
-    253, 238, 131, 66, 174, 138, 131, 111, 2, 246, 243, 81, 173, 40, 85, 210, 3, 48, 60, 126, 234, 23, 82, 50, 49, 119,
-    128, 172, 116, 84, 3, 165, 177, 4, 213, 33, 130, 79, 249, 136, 53, 89, 122, 20, 81, 70, 65, 31, 160, 152, 93, 103,
-    141, 235, 208, 10, 49, 158, 50, 190, 224, 22, 192, 182, 67, 82, 203, 114, 147, 134, 49, 8, 248, 144, 52, 80, 83,
-    255, 223, 67, 176, 240, 69, 155, 88, 102, 36, 94, 109, 169, 247, 113, 97, 232, 198, 223, 178, 24, 180, 149, 239, 63,
-    24, 206, 152, 69, 152, 42, 228, 90, 208, 117, 2, 66, 211, 85, 79, 110, 78, 168, 74, 152, 204, 242, 39, 202, 51, 116,
-    40, 34, 126, 128, 127, 43, 126, 19, 225, 134, 147, 115, 62, 55, 78, 176, 14, 167, 48, 42, 3, 203, 220, 19, 82, 188,
-    120, 133, 23, 50, 48, 108, 181, 181, 97, 20, 97, 58, 72, 179, 110, 168, 135, 66, 7, 176, 55, 10, 118, 239, 6, 207,
-    167, 143, 167, 8, 45, 18, 82, 62, 219, 166, 50, 79, 186, 62, 0, 120, 67, 39, 112, 150, 59, 240, 76, 117, 12, 147,
-    79, 103, 214, 234, 113, 161, 82, 217, 253, 221, 96, 252, 210, 23, 162, 45, 8, 170, 43, 197, 170, 126, 200, 57, 203,
-    40, 41, 45, 186, 113, 35, 126, 45, 49, 250, 215, 2, 44, 124, 23, 247, 169, 67, 255, 0, 88, 84, 132, 255, 29, 105,
-    227, 169, 221, 139, 121, 86, 234, 232, 14, 19, 15, 64, 170, 244, 193, 83, 251, 138, 179, 100, 158, 20, 246, 219,
-    108, 252, 31, 56, 92, 3, 243, 201, 123, 12, 11, 79, 220, 210, 28, 195, 71, 60, 82, 7, 225, 88, 69, 47, 90, 136, 165,
-    101, 7, 118, 21, 149, 8, 135, 70, 242, 7, 80, 191, 33, 21, 51, 45, 122, 46, 74, 78, 223, 198, 204, 245, 147, 242,
-    220, 11, 182, 124, 204, 222, 110, 34, 31, 200, 162, 113, 30, 130, 22, 93, 178, 134, 29, 2, 93, 161, 186, 6, 207,
-    204, 172, 163, 82, 144, 151, 206, 162, 154, 117, 165, 175, 33, 163, 120, 14, 207, 82, 120, 234, 64, 18, 149, 238,
-    169, 235, 255, 93, 109, 167, 208, 226, 177, 52, 236, 128, 86, 186, 224, 218, 192, 39, 32, 143, 58, 2, 17, 255, 165,
-    137, 190, 183, 147, 240, 1, 52, 103, 74, 38, 13, 11, 71, 32, 253, 103, 168, 244, 31, 250, 159, 229, 62, 34, 135,
-    213, 98, 105, 58, 14, 39, 228, 174, 84, 231, 75, 173, 95, 68, 76, 178, 166, 45, 180, 129, 170, 152, 178, 134, 252,
-    92, 248, 160, 19, 132, 103, 239, 136, 181, 198, 129, 156, 129, 229, 223, 86, 245, 75, 221, 183, 154, 135, 86, 232,
-    153, 76, 74, 13, 92, 133, 51, 189, 65, 254, 128, 216, 18, 42, 253, 17, 240, 126, 190, 22, 9, 234, 107, 44, 62, 223,
-    45, 210, 185, 219, 113, 113, 102, 211, 79, 164, 236, 169, 11, 195, 138, 97, 88, 213, 65, 147, 155, 131, 105, 125,
-    66, 159, 103, 131, 6, 69, 154, 28, 32, 194, 14, 134, 162, 108, 84, 254, 121, 177, 104, 17, 246, 129, 177, 84, 214,
-    211, 245, 97, 207, 150, 158, 14, 50, 150, 57, 255, 190, 18, 243, 116, 197, 109, 10, 12, 189, 208, 157, 66, 248, 72,
-    218, 156, 81, 70, 207, 108, 91, 51, 151, 177, 69, 54, 199, 186, 117, 68, 42, 188, 13, 234, 181, 90, 218, 106, 131,
-    79, 132, 163, 34, 2, 55, 11, 202, 127, 43, 220, 201, 201, 49, 207, 154, 35, 19, 105, 243, 216, 231, 232, 174, 22,
-    248, 162, 197, 21, 56, 186, 242, 208, 216, 236, 127, 92, 75, 1, 82, 67, 155, 138, 45, 95, 16, 138, 6, 66, 230, 143,
-    130, 234, 93, 213, 100, 32, 10, 129, 7, 204, 116, 101, 170, 185, 105, 148, 64, 105, 239, 55, 157, 220, 93, 227, 247,
-    176, 148, 148, 243, 141, 41, 103, 125, 206, 56, 0, 147, 17, 115, 255, 35, 111, 38, 11, 167, 92, 39, 159, 219, 108,
-    109, 77, 95, 29, 58, 94, 233, 1, 98, 67, 26, 195, 190, 38, 157, 11, 53, 140, 126, 223, 218, 69, 199, 205, 245, 208,
-    211, 150, 87, 122, 68, 75, 7, 69, 85, 235, 4, 156, 251, 205, 18, 224, 10, 18, 99, 207, 44, 39, 67, 46, 58, 213, 143,
-    192, 136, 8, 181, 231, 221, 86, 59, 203, 37, 75, 64, 81, 53, 203, 3, 134, 181, 116, 68, 233, 14, 18, 241, 80, 140,
-    55, 226, 90, 228, 60, 232, 27, 56, 132, 147, 98, 230, 136, 235, 244, 84, 133, 76, 44, 241, 113, 61, 59, 49, 199,
-    201, 94, 170, 218, 25, 242, 95, 207, 95, 7, 171, 112, 193, 109, 175, 147, 241, 143, 150, 214, 239, 19, 246, 7, 109,
-    117, 131, 240, 4, 90, 218, 6, 68, 95, 94, 103, 85, 43, 84, 94, 38, 22, 119, 222, 212, 124, 32, 80, 50, 202, 74, 24,
-    249, 205, 181, 91, 35, 145, 27, 112, 58, 86, 133, 90, 231, 97, 33, 19, 75, 127, 113, 181, 6, 124, 251, 104, 20, 25,
-    88, 19, 52, 63, 41, 78, 4, 14, 86, 56, 37, 199, 27, 126, 170, 240, 41, 108, 71, 84, 229, 85, 225, 96, 20, 31, 110,
-    35, 39, 31, 213, 160, 247, 241, 80, 154, 118, 140, 99, 61, 236, 0, 246, 24, 73, 37, 58, 140, 80, 95, 49, 6, 203, 93,
-    208, 213, 167, 110, 63, 93, 0, 181, 76, 225, 142, 69, 29, 235, 185, 39, 136, 129, 182, 63, 253, 252, 222, 236, 118,
-    7, 74, 97, 222, 165, 78, 221, 144, 210, 143, 24, 209, 168, 121, 72, 196, 238, 153, 102, 140, 203, 171, 253, 2, 108,
-    15, 242, 16, 43, 175, 211, 192, 22, 69, 41, 195, 189, 174, 188, 0, 46, 32, 141, 125, 78, 122, 188, 231, 80, 3, 66,
-    120, 179, 198, 111, 249, 10, 62, 9, 215, 223, 77, 47, 153, 42, 204, 90, 56, 65, 108, 114, 190, 180, 123, 217, 63,
-    251, 68, 125, 55, 235, 72, 200, 237, 39, 130, 234, 203, 119, 72, 13, 65, 48, 32, 142, 145, 255, 178, 131, 143, 39,
-    179, 199, 218, 35, 17, 125, 245, 16, 105, 218, 122, 201, 182, 126, 5, 102, 70, 163, 241, 93, 186, 168, 69, 205, 233,
-    124, 237, 110, 49, 0, 19, 227, 115, 163, 255, 190, 25, 78, 105, 222, 75, 190, 244, 170, 179, 248, 190, 186, 149, 33,
-    78, 144, 171, 6, 160, 11, 129, 135, 72, 151, 130, 51, 103, 77, 58, 182, 78, 95, 135, 56, 246, 144, 135, 236, 96,
-    119, 225, 154, 43, 119, 92, 33, 64, 2, 247, 14, 18, 76, 136, 23, 235, 112, 213, 23, 176, 27, 231, 64, 111, 80, 66,
-    92, 153, 94, 66, 19, 151, 159, 103, 190, 6, 247, 212, 207, 245, 95, 5, 251, 133, 202, 80, 95, 93, 191, 29, 136, 45,
-    148, 58, 32, 152, 9, 174, 54, 87, 203, 21, 230, 26, 97, 135, 178, 110, 59, 248, 31, 31, 225, 230, 221, 157, 67, 229,
-    240, 241, 139, 219, 1, 110, 220, 30, 27, 177, 178, 23, 223, 11, 77, 78, 216, 182, 169, 67, 113, 79, 41, 225, 45, 45,
-    158, 226, 97, 197, 182, 111, 101, 11, 246, 24, 96, 146, 111, 136, 89, 145, 55, 234, 252, 50, 239, 187, 8, 236, 189,
-    101, 9, 44, 7, 140, 28, 112, 240, 226, 199, 128, 196, 94, 167, 224, 216, 177, 166, 48, 144, 123, 207, 44, 56, 244,
-    22, 161, 61, 73, 68, 203, 240, 243, 236, 243, 128, 34, 39, 153, 174, 129, 119, 47, 171, 145, 196, 199, 197, 146,
-    106, 206, 215, 139, 3, 112, 47, 71, 110, 171, 105, 100, 246, 122, 165, 176, 226, 38, 251, 234, 137, 27, 243, 34, 81,
-    241, 92, 176, 42, 183, 116, 44, 46, 77, 35, 158, 211, 237, 86, 69, 15, 178, 189, 246, 211, 83, 54, 207, 15, 41, 27,
-    112, 122, 163, 95, 238, 53, 41, 84, 246, 50, 225, 12, 125, 173, 194, 105, 22, 162, 208, 101, 20, 81, 251, 254, 227,
-    99, 240, 127, 238, 134, 49, 54, 245, 119, 198, 227, 135, 53, 102, 55, 12, 82, 121, 219, 97, 241, 172, 161, 63, 183,
-    3, 72, 166, 213, 191, 47, 78, 17, 97, 141, 202, 130, 62, 63, 187, 11, 108, 15, 83, 220, 50, 236, 73, 182, 120, 160,
-    60, 102, 150, 231, 191, 68, 198, 231, 139, 139, 230, 100, 25, 21, 218, 100, 203, 150, 212, 140, 79, 89, 114, 83, 96,
-    27, 255, 64, 120, 67, 183, 223, 31, 17, 238, 172, 173, 177, 149, 245, 134, 225, 99, 166, 37, 192, 173, 255, 55, 96,
-    227, 237, 152, 123, 184, 158, 45, 182, 240, 91, 67, 43, 244, 206, 72, 74, 253, 179, 79, 78, 247, 178, 91, 4, 66,
-    109, 112, 37, 125, 155, 244, 204, 196, 144, 113, 74, 239, 206, 14, 178, 69, 234, 21, 243, 78, 202, 9, 112, 0, 131,
-    20, 191, 69, 109, 24, 0, 247, 70, 73, 85, 229, 40, 175, 24, 83, 77, 108, 99, 89, 138, 46, 26, 173, 209, 212, 204,
-    121, 31, 136, 148, 135, 19, 25, 216, 168, 193, 252, 40, 147, 98, 252, 195, 95, 60, 201, 170, 47, 46, 13, 101, 79,
-    150, 99, 196, 67, 143, 125, 143, 100, 33, 245, 244, 48, 206, 26, 235, 66, 160, 206, 222, 3, 241, 157, 146, 12, 8,
-    244, 189, 189, 105, 111, 161, 69, 65, 212, 104, 69, 159, 215, 18, 48, 80, 207, 122, 185, 213, 193, 129, 91, 157, 95,
-    33, 102, 81, 190, 99, 184, 242, 30, 33, 38, 29, 76, 68, 6, 220, 229, 11, 74, 123, 37, 123, 67, 150, 14, 148, 10,
-    138, 95, 163, 129, 167, 78, 218, 106, 108, 20, 139, 157, 145, 208, 113, 16, 82, 52, 92, 222, 139, 37, 133, 51, 220,
-    170, 54, 4, 75, 123, 114, 16, 223, 173, 88, 231, 134, 41, 135, 23, 35, 100, 68, 191, 89, 61, 20, 137, 67, 64, 194,
-    98, 106, 230, 237, 100, 230, 202, 37, 248, 59, 139, 103, 214, 78, 233, 215, 139, 212, 223, 227, 245, 163, 172, 156,
-    31, 245, 231, 192, 113, 228, 227, 223, 31, 38, 246, 112, 91, 152, 22, 148, 63, 5, 136, 175, 119, 220, 63, 8, 189,
-    197, 56, 182, 68, 147, 9, 163, 90, 22, 74, 134, 252, 14, 211, 86, 128, 245, 200, 252, 67, 65, 130, 118, 230, 57,
-    150, 53, 242, 251, 191, 223, 99, 49, 223, 214, 52, 57, 47, 232, 76, 25, 80, 229, 51, 77, 139, 116, 119, 237, 61,
-    115, 32, 169, 241, 134, 99, 3, 179, 75, 77, 183, 224, 64, 137, 45, 60, 2, 197, 219, 232, 92, 91, 214, 164, 99, 127,
-    84, 170, 205, 77, 141, 112, 149, 20, 7, 28, 166, 203, 123, 69, 110, 112, 84, 12, 125, 95, 75, 189, 38, 46, 47, 13,
-    23, 212, 226, 27, 136, 111, 109, 39, 68, 106, 125, 127, 228, 171, 96, 129, 59, 150, 148, 172, 99, 31, 52, 8, 30,
-    182, 1, 31, 11, 219, 98, 212, 182, 123, 151, 171, 130, 137, 189, 55, 134, 186, 183, 151, 219, 52, 44, 131, 72, 208,
-    222, 187, 108, 5, 58, 127, 132, 149, 224, 10, 171, 98, 59, 222, 189, 188, 62, 6, 14, 169, 138, 179, 118, 93, 198,
-    198, 245, 30, 133, 145, 142, 89, 28, 4, 69, 27, 227, 13, 102, 99, 193, 119, 217, 82, 221, 26, 60, 96, 151, 81, 43,
-    215, 80, 5, 215, 15, 97, 106, 213, 9, 69, 160, 51, 215, 20, 120, 7, 39, 232, 27, 20, 223, 61, 128, 144, 113, 89, 86,
-    216, 210, 100, 99, 202, 128, 92, 185, 213, 237, 211, 49, 240, 197, 210, 192, 22, 28, 205, 194, 254, 6, 173, 211,
-    220, 137, 237, 42, 34, 27, 179, 152, 131, 253, 165, 87, 196, 215, 22, 175, 107, 172, 42, 104, 206, 240, 174, 211,
-    131, 63, 97, 10, 83, 162, 136, 205, 85, 67, 239, 175, 147, 5, 177, 11, 16, 251, 5, 53, 235, 115, 124, 130, 18, 107,
-    56, 236, 228, 39, 97, 180, 194, 65, 191, 208, 215, 227, 154, 127, 143, 218, 243, 139, 225, 227, 195, 88, 178, 26,
-    37, 25, 67, 209, 92, 204, 10, 143, 95, 137, 18, 120, 215, 170, 45, 116, 153, 126, 200, 196, 243, 50, 175, 222, 172,
-    87, 239, 214, 220, 51, 115, 133, 19, 216, 122, 60, 191, 7, 233, 199, 48, 3, 156, 173, 42, 243, 53, 160, 0, 191, 152,
-    147, 99, 92, 206, 91, 5, 9, 124, 107, 140, 199, 109, 191, 198, 112, 199, 70, 67, 81, 223, 67, 71, 57, 42, 36, 168,
-    70, 50, 252, 158, 243, 255, 65, 19, 61, 47, 203, 121, 166, 135, 60, 214, 58, 177, 126, 221, 81, 242, 191, 224, 186,
-    191, 182, 26, 107, 73, 97, 80, 109, 122, 200, 71, 113, 116, 248, 235, 113, 13, 218, 64, 183, 253, 2, 234, 50, 209,
-    206, 118, 145, 110, 89, 5, 145, 209, 117, 99, 118, 199, 78, 166, 11, 179, 10, 232, 223, 141, 231, 87, 95, 32, 197,
-    217, 251, 164, 71, 141, 110, 243, 175, 48, 185, 19, 222, 42, 192, 218, 138, 40, 84, 77, 245, 120, 196, 210, 0, 223,
-    106, 26, 39, 155, 74, 99, 111, 246, 113, 213, 226, 55, 19, 140, 151, 74, 51, 171, 67, 236, 32, 93, 19, 92, 65, 44,
-    134, 181, 81, 80, 87, 173, 12, 254, 168, 182, 204, 236, 146, 196, 191, 195, 154, 175, 29, 212, 250, 195, 212, 157,
-    39, 87, 100, 48, 146, 243, 57, 222, 255, 247, 146, 19, 243, 123, 164, 209, 118, 34, 154, 85, 218, 221, 150, 46, 179,
-    134, 208, 40, 249, 222, 29, 131, 131, 26, 111, 108, 173, 173, 33, 130, 88, 155, 46, 103, 109, 176, 92, 70, 20, 168,
-    116, 157, 250, 239, 205, 147, 230, 17, 188, 254, 189, 160, 29, 62, 127, 161, 149, 130, 202, 49, 50, 174, 126, 213,
-    168, 48, 72, 16, 103, 108, 110, 163, 252, 218, 56, 190, 17, 118, 18, 104, 4, 184, 97, 126, 250, 13, 244, 189, 211,
-    219, 108, 58, 167, 1, 177, 123, 159, 14, 1, 177, 48, 0, 30, 7, 93, 107, 105, 102, 64, 46, 249, 119, 149, 113, 147,
-    118, 69, 35, 77, 45, 65, 198, 92, 230, 155, 230, 245, 197, 225, 175, 247, 79, 105, 159, 30, 235, 89, 164, 108, 191,
-    98, 233, 122, 114, 206, 223, 17, 129, 66, 100, 208, 161, 154, 241, 78, 48, 44, 86, 84, 87, 165, 178, 199, 149, 184,
-    58, 113, 64, 94, 151, 206, 151, 117, 97, 118, 218, 158, 17, 173, 122, 46, 17, 163, 246, 120, 3, 188, 3, 78, 23, 75,
-    229, 175, 132, 176, 82, 37, 67, 209, 185, 232, 63, 94, 111, 15, 120, 19, 64, 59, 13, 180, 53, 204, 190, 72, 166,
-    200, 199, 156, 105, 151, 239, 41, 31, 191, 184, 8, 3, 233, 218, 100, 36, 238, 166, 75, 94, 111, 208, 60, 154, 66,
-    52, 68, 252, 46, 229, 166, 101, 130, 63, 86, 127, 40, 55, 23, 219, 178, 69, 185, 7, 99, 215, 244, 192, 16, 96, 130,
-    132, 196, 86, 134, 180, 208, 21, 232, 40, 192, 248, 203, 89, 192, 16, 96, 53, 40, 110, 201, 242, 26, 126, 104, 194,
-    84, 150, 80, 37, 244, 238, 57, 97, 19, 23, 95, 241, 131, 46, 230, 198, 243, 167, 4, 244, 57, 8, 119, 189, 40, 191,
-    152, 190, 111, 226, 32, 15, 166, 26, 165, 145, 250, 8, 87, 245, 74, 228, 42, 210, 137, 230, 167, 72, 95, 144, 95,
-    148, 44, 25, 212, 56, 30, 109, 179, 151, 199, 134, 237, 127, 27, 174, 102, 92, 192, 188, 168, 37, 245, 220, 163, 87,
-    144, 97, 144, 99, 165, 17, 192, 113, 253, 84, 108, 37, 138, 165, 226, 17, 58, 195, 200, 221, 190, 191, 0, 134, 7,
-    214, 165, 16, 40, 105, 98, 229, 204, 125, 29, 19, 22, 217, 42, 157, 185, 214, 92, 235, 197, 35, 137, 55, 234, 232,
-    17, 50, 156, 31, 166, 101, 162, 110, 67, 62, 82, 73, 124, 18, 198, 242, 38, 219, 154, 79, 246, 39, 168, 148, 109,
-    119, 1, 253, 78, 233, 57, 168, 210, 147, 248, 152, 9, 36, 63, 65, 106, 196, 74, 145, 81, 99, 83, 124, 31, 254, 67,
-    11, 16, 102, 157, 239, 179, 191, 222, 65, 139, 167, 215, 240, 115, 52, 49, 85, 70, 183, 85, 40, 191, 145, 196, 27,
-    206, 186, 122, 11, 121, 145, 203, 179, 93, 9, 177, 79, 53, 18, 94, 72, 149, 243, 48, 99, 75, 215, 66, 211, 142, 119,
-    2, 133, 244, 123, 253, 216, 28, 25, 170, 37, 254, 82, 254, 126, 196, 168, 27, 203, 79, 225, 46, 21, 53, 38, 253,
-    105, 248, 36, 127, 201, 169, 101, 222, 246, 90, 116, 11, 27, 162, 81, 176, 90, 29, 118, 90, 176, 105, 86, 245, 176,
-    47, 55, 161, 14, 158, 34, 98, 119, 163, 173, 205, 181, 238, 98, 229, 221, 245, 173, 157, 56, 103, 253, 40, 52, 228,
-    138, 166, 24, 151, 72, 74, 16, 17, 88, 25, 72, 76, 35, 67, 57, 216, 63, 211, 7, 87, 10, 132, 107, 130, 5, 24, 143,
-    129, 63, 107, 108, 255, 62, 1, 155, 231, 187, 85, 214, 24, 16, 164, 16, 16, 139, 20, 180, 238, 26, 151, 168, 44, 42,
-    130, 83, 88, 105, 201, 128, 132, 171, 58, 252, 55, 75, 90, 123, 46, 158, 91, 61, 172, 81, 81, 0, 161, 2, 22, 224,
-    247, 136, 190, 222, 115, 221, 242, 183, 138, 196, 66, 82, 192, 105, 75, 243, 127, 213, 212, 0, 108, 170, 20, 24,
-    158, 110, 145, 134, 170, 193, 244, 220, 101, 186, 201, 125, 180, 20, 20, 205, 150, 109, 212, 161, 163, 196, 101,
-    131, 1, 185, 51, 73, 147, 187, 23, 44, 176, 126, 195, 76, 135, 86, 105, 255, 229, 138, 108, 179, 234, 178, 28, 62,
-    121, 208, 33, 111, 47, 102, 208, 69, 182, 28, 166, 245, 175, 196, 245, 197, 20, 76, 65, 130, 149, 182, 165, 191,
-    146, 207, 146, 228, 196, 169, 159, 48, 8, 90, 187, 121, 27, 128, 137, 185, 65, 125, 161, 199, 18, 91, 173, 109, 153,
-    46, 143, 205, 123, 169, 224, 171, 181, 244, 159, 201, 18, 181, 12, 252, 219, 183, 58, 71, 241, 7, 177, 24, 104, 87,
-    163, 248, 231, 66, 9, 107, 246, 152, 67, 41, 95, 238, 156, 183, 235, 252, 190, 39, 250, 45, 83, 97, 98, 63, 248,
-    203, 231, 40, 120, 234, 21, 87, 99, 150, 116, 139, 13, 174, 38, 82, 35, 170, 145, 43, 82, 49, 101, 3, 70, 218, 205,
-    212, 116, 233, 173, 181, 43, 52, 254, 175, 255, 205, 188, 243, 180, 187, 27, 0, 193, 54, 38, 45, 253, 31, 198, 190,
-    95, 143, 183, 187, 49, 165, 160, 206, 189, 164, 247, 92, 244, 130, 45, 241, 87, 94, 138, 119, 81, 159, 88, 26, 197,
-    152, 37, 220, 202, 3, 249, 164, 212, 196, 13, 169, 0, 151, 227, 96, 8, 11, 171, 206, 61, 144, 17, 54, 26, 69, 8, 12,
-    203, 170, 199, 101, 157, 147, 209, 34, 113, 156, 214, 75, 227, 181, 195, 96, 169, 168, 32, 147, 232, 81, 110, 227,
-    33, 245, 194, 20, 132, 183, 218, 210, 227, 81, 166, 18, 186, 74, 225, 1, 106, 213, 192, 254, 66, 138, 11, 133, 41,
-    194, 46, 8, 110, 47, 153, 241, 138, 212, 163, 52, 78, 17, 231, 31, 164, 114, 126, 173, 46, 207, 21, 196, 226, 147,
-    134, 114, 86, 76, 86, 50, 202, 248, 68, 208, 3, 218, 47, 223, 189, 247, 141, 193, 191, 252, 89, 99, 2, 25, 99, 94,
-    167, 119, 25, 148, 165, 78, 115, 22, 172, 75, 96, 30, 117, 33, 14, 162, 9, 99, 155, 89, 44, 59, 27, 199, 102, 89,
-    145, 97, 234, 64, 133, 214, 35, 253, 246, 228, 248, 126, 27, 110, 122, 203, 108, 223, 139, 196, 129, 164, 47, 35,
-    61, 94, 219, 34, 71, 250, 105, 232, 244, 239, 122, 33, 139, 154, 238, 123, 55, 38, 5, 196, 96, 94, 231, 101, 203,
-    168, 144, 51, 127, 131, 106, 233, 2, 22, 153, 164, 223, 41, 55, 164, 170, 93, 108, 227, 25, 107, 201, 66, 202, 149,
-    49, 125, 126, 68, 1, 11, 23, 249, 190, 137, 109, 65, 19, 192, 231, 39, 54, 200, 112, 62, 80, 115, 40, 218, 218, 52,
-    174, 129, 51, 17, 153, 127, 49, 142, 133, 10, 142, 203, 88, 121, 98, 57, 26, 224, 197, 180, 107, 137, 144, 45, 119,
-    95, 70, 34, 14, 81, 147, 178, 125, 177, 186, 190, 220, 117, 78, 20, 169, 73, 140, 236, 177, 224, 78, 183, 57, 65,
-    14, 233, 182, 29, 160, 46, 254, 189, 235, 41, 238, 169, 43, 250, 96, 228, 7, 247, 252, 247, 33, 76, 46, 56, 140, 41,
-    20, 29, 172, 155, 154, 110, 151, 131, 128, 136, 41, 99, 184, 11, 233, 28, 249, 105, 142, 6, 134, 158, 25, 37, 143,
-    105, 183, 110, 232, 56, 44, 70, 104, 235, 167, 241, 21, 201, 77, 208, 196, 144, 11, 17, 160, 182, 93, 230, 139, 37,
-    192, 220, 49, 75, 196, 176, 212, 77, 247, 167, 215, 5, 66, 49, 119, 218, 144, 67, 53, 116, 250, 169, 176, 74, 224,
-    145, 144, 140, 14, 240, 95, 112, 178, 245, 142, 171, 49, 189, 77, 230, 189, 242, 8, 179, 206, 168, 95, 134, 231,
-    216, 180, 246, 175, 180, 251, 241, 78, 36, 94, 253, 92, 103, 146, 6, 170, 46, 211, 171, 123, 117, 142, 218, 121,
-    226, 200, 200, 63, 57, 247, 118, 244, 232, 151, 103, 116, 102, 210, 45, 67, 31, 175, 201, 18, 114, 36, 202, 69, 136,
-    206, 165, 10, 112, 87, 216, 79, 211, 213, 240, 63, 154, 20, 233, 199, 2, 205, 247, 226, 74, 70, 63, 157, 233, 162,
-    158, 250, 134, 249, 240, 134, 96, 234, 62, 215, 53, 240, 20, 224, 171, 60, 209, 126, 136, 49, 81, 14, 38, 93, 196,
-    245, 0, 172, 9, 128, 4, 150, 124, 141, 195, 117, 229, 243, 201, 163, 183, 153, 231, 254, 174, 237, 41, 60, 66, 249,
-    234, 27, 185, 88, 69, 181, 173, 172, 122, 71, 157, 225, 113, 97, 131, 47, 251, 177, 151, 21, 95, 71, 110, 5, 233, 5,
-    32, 163, 4, 20, 82, 215, 52, 231, 102, 176, 75, 94, 19, 214, 77, 9, 229, 9, 216, 226, 212, 79, 89, 160, 12, 127, 87,
-    4, 165, 35, 207, 64, 219, 43, 122, 221, 187, 176, 136, 25, 79, 144, 96, 113, 117, 81, 82, 222, 69, 135, 229, 98, 46,
-    215, 134, 1, 18, 147, 201, 122, 204, 117, 128, 4, 137, 237, 89, 113, 29, 33, 220, 62, 183, 226, 123, 176, 77, 159,
-    33, 134, 17, 250, 94, 31, 227, 217, 252, 177, 222, 106, 91, 206, 46, 129, 61, 119, 74, 75, 139, 40, 133, 251, 114,
-    144, 129, 249, 201, 112, 50, 20, 121, 53, 201, 121, 126, 29, 47, 208, 94, 194, 166, 113, 8, 232, 183, 227, 182, 229,
-    129, 120, 142, 47, 128, 134, 6, 222, 168, 91, 132, 8, 201, 86, 152, 121, 156, 25, 156, 169, 12, 82, 136, 92, 4, 33,
-    251, 84, 181, 21, 63, 8, 193, 185, 203, 48, 205, 168, 110, 131, 105, 17, 189, 60, 237, 134, 92, 185, 101, 42, 78,
-    161, 194, 61, 104, 244, 44, 230, 20, 48, 20, 48, 24, 40, 202, 83, 186, 238, 233, 219, 245, 126, 125, 141, 12, 54,
-    106, 62, 17, 100, 242, 159, 48, 233, 165, 12, 190, 36, 242, 62, 229, 27, 50, 20, 14, 203, 253, 212, 130, 134, 123,
-    167, 198, 133, 62, 95, 113, 69, 142, 12, 249, 19, 232, 111, 25, 223, 5, 232, 220, 174, 198, 51, 170, 37, 136, 7,
-    188, 145, 81, 96, 221, 109, 146, 110, 136, 159, 81, 81, 171, 198, 117, 204, 16, 207, 179, 28, 35, 152, 116, 134,
-    102, 161, 123, 36, 116, 152, 203, 217, 212, 62, 170, 231, 213, 201, 201, 99, 254, 71, 154, 32, 53, 2, 27, 141, 24,
-    196, 250, 118, 16, 176, 18, 252, 7, 95, 92, 231, 251, 80, 84, 167, 145, 84, 138, 39, 87, 230, 72, 255, 94, 69, 76,
-    108, 150, 221, 127, 30, 30, 58, 109, 183, 92, 158, 89, 191, 254, 208, 18, 149, 7, 130, 121, 59, 159, 183, 104, 137,
-    114, 153, 65, 75, 128, 17, 223, 38, 87, 156, 25, 239, 124, 146, 32, 39, 131, 185, 20, 121, 44, 221, 108, 248, 150,
-    228, 23, 161, 4, 47, 248, 255, 223, 54, 170, 119, 143, 133, 172, 70, 31, 134, 94, 216, 61, 166, 60, 73, 204, 195,
-    147, 51, 54, 44, 186, 52, 47, 73, 89, 213, 202, 22, 229, 218, 159, 82, 105, 187, 128, 193, 46, 194, 5, 185, 200, 80,
-    21, 241, 21, 135, 60, 98, 22, 131, 66, 84, 223, 196, 225, 171, 240, 240, 252, 126, 170, 234, 85, 129, 56, 178, 154,
-    36, 81, 112, 2, 189, 51, 16, 239, 222, 111, 234, 86, 98, 71, 125, 80, 249, 193, 153, 131, 65, 19, 188, 35, 180, 78,
-    115, 95, 88, 21, 217, 4, 223, 56, 192, 114, 22, 123, 183, 255, 161, 145, 223, 208, 12, 152, 21, 62, 82, 92, 225, 76,
-    152, 213, 90, 30, 198, 160, 125, 183, 66, 114, 212, 97, 142, 85, 251, 187, 8, 252, 180, 20, 229, 194, 254, 157, 255,
-    122, 200, 176, 83, 255, 5, 224, 76, 123, 254, 144, 133, 137, 156, 86, 249, 154, 159, 156, 229, 116, 202, 199, 65,
-    221, 7, 49, 116, 199, 91, 73, 243, 206, 46, 227, 186, 42, 157, 152, 154, 202, 120, 91, 245, 153, 31, 127, 176, 144,
-    255, 49, 72, 82, 148, 108, 95, 240, 41, 111, 50, 16, 83, 89, 111, 224, 223, 80, 22, 230, 234, 67, 203, 30, 254, 204,
-    177, 214, 235, 127, 12, 224, 165, 212, 215, 79, 225, 229, 40, 159, 112, 130, 56, 45, 78, 99, 78, 169, 209, 226, 216,
-    87, 116, 207, 153, 73, 2, 53, 7, 185, 236, 208, 175, 116, 204, 157, 175, 125, 7, 31, 35, 12, 102, 13, 63, 75, 37,
-    119, 92, 174, 174, 150, 5, 59, 77, 57, 150, 217, 161, 137, 130, 54, 25, 23, 79, 113, 65, 63, 18, 183, 166, 228, 51,
-    3, 171, 54, 235, 57, 78, 122, 231, 185, 125, 255, 48, 142, 158, 151, 148, 15, 169, 185, 207, 176, 171, 36, 114, 213,
-    7, 117, 95, 239, 98, 215, 214, 194, 215, 146, 235, 67, 27, 124, 146, 213, 53, 95, 202, 76, 90, 85, 164, 242, 64,
-    174, 250, 113, 69, 56, 112, 238, 150, 5, 91, 111, 72, 13, 51, 153, 5, 148, 165, 176, 144, 41, 189, 242, 100, 126,
-    198, 35, 245, 182, 17, 47, 51, 102, 175, 26, 78, 217, 28, 201, 193, 61, 176, 75, 102, 146, 189, 168, 0, 175, 63,
-    103, 84, 151, 19, 198, 74, 125, 242, 141, 172, 42, 225, 253, 185, 61, 76, 33, 91, 13, 235, 126, 139, 86, 44, 231,
-    169, 225, 54, 233, 156, 58, 137, 25, 166, 245, 234, 75, 238, 244, 240, 59, 82, 102, 252, 5, 129, 37, 103, 71, 233,
-    2, 11, 191, 181, 66, 29, 120, 161, 89, 23, 209, 24, 233, 133, 217, 161, 2, 19, 239, 158, 237, 130, 31, 101, 30, 22,
-    234, 145, 238, 48, 247, 42, 146, 208, 137, 53, 98, 219, 60, 42, 37, 22, 138, 214, 37, 32, 59, 181, 2, 133, 162, 65,
-    100, 36, 253, 50, 106, 109, 9, 17, 133, 89, 204, 96, 151, 10, 209, 198, 198, 82, 240, 135, 83, 181, 221, 253, 150,
-    44, 219, 245, 186, 111, 169, 33, 125, 210, 7, 47, 115, 162, 126, 208, 219, 184, 14, 91, 127, 231, 152, 15, 202, 81,
-    154, 159, 183, 134, 10, 63, 195, 102, 199, 97, 113, 117, 16, 179, 96, 152, 27, 62, 33, 127, 158, 137, 182, 174, 154,
-    234, 226, 207, 126, 45, 168, 147, 61, 255, 250, 8, 141, 215, 32, 108, 182, 244, 149, 83, 43, 178, 143, 167, 50, 9,
-    4, 121, 33, 131, 48, 126, 90, 162, 207, 42, 228, 202, 249, 135, 54, 38, 244, 126, 29, 58, 152, 107, 197, 80, 100,
-    239, 13, 174, 29, 153, 1, 85, 226, 26, 246, 191, 230, 240, 192, 49, 72, 97, 208, 198, 201, 210, 142, 135, 32, 20,
-    37, 237, 51, 80, 108, 191, 49, 24, 145, 195, 64, 178, 248, 60, 20, 94, 254, 179, 136, 23, 121, 19, 108, 161, 76,
-    141, 25, 52, 228, 209, 203, 249, 206, 2, 137, 139, 122, 154, 63, 196, 147, 18, 63, 137, 212, 156, 103, 253, 90, 25,
-    119, 34, 176, 233, 119, 223, 182, 52, 83, 45, 247, 153, 1, 163, 161, 158, 232, 183, 132, 120, 15, 131, 116, 237,
-    237, 78, 18, 142, 30, 14, 30, 27, 47, 193, 77, 97, 4, 226, 55, 248, 250, 47, 12, 220, 63, 247, 186, 174, 33, 190,
-    57, 168, 48, 128, 118, 22, 178, 99, 25, 233, 213, 147, 105, 36, 228, 178, 180, 127, 31, 94, 224, 250, 50, 71, 236,
-    176, 124, 96, 37, 199, 243, 72, 63, 71, 9, 9, 165, 171, 155, 55, 153, 63, 5, 247, 22, 235, 181, 186, 111, 142, 157,
-    203, 188, 8, 47, 163, 60, 4, 219, 152, 47, 237, 204, 166, 182, 42, 128, 140, 99, 163, 8, 150, 159, 59, 212, 125,
-    156, 5, 45, 58, 32, 42, 155, 3, 236, 225, 131, 119, 226, 75, 144, 130, 77, 158, 207, 134, 241, 79, 66, 224, 253,
-    140, 109, 189, 110, 131, 254, 222, 49, 111, 49, 191, 42, 226, 84, 31, 147, 33, 0, 8, 26, 92, 255, 255, 234, 74, 213,
-    79, 188, 7, 29, 240, 77, 244, 195, 15, 220, 79, 64, 58, 28, 160, 132, 254, 127, 38, 206, 38, 124, 129, 34, 110, 92,
-    113, 75, 3, 151, 110, 191, 6, 130, 116, 86, 61, 158, 159, 65, 212, 147, 28, 155, 146, 60, 102, 21, 181, 90, 62, 45,
-    228, 170, 144, 30, 181, 173, 193, 155, 23, 154, 8, 159, 183, 150, 125, 45, 20, 212, 204, 236, 209, 249, 217, 100,
-    82, 178, 142, 167, 6, 218, 69, 42, 134, 250, 74, 208, 22, 69, 3, 34, 203, 134, 245, 88, 150, 208, 78, 151, 117, 243,
-    107, 217, 49, 154, 178, 181, 207, 89, 117, 65, 211, 73, 238, 244, 183, 157, 170, 236, 93, 129, 45, 12, 239, 38, 117,
-    90, 202, 118, 43, 15, 37, 114, 2, 93, 193, 137, 170, 85, 165, 76, 62, 172, 106, 82, 162, 125, 203, 163, 46, 27, 101,
-    154, 82, 228, 7, 41, 163, 253, 68, 10, 120, 44, 21, 174, 161, 66, 18, 7, 89, 110, 52, 97, 64, 164, 34, 180, 33, 33,
-    101, 248, 25, 87, 158, 66, 96, 91, 90, 46, 235, 205, 35, 54, 58, 99, 34, 234, 52, 143, 150, 91, 203, 60, 60, 218,
-    168, 170, 25, 74, 159, 117, 109, 64, 235, 188, 32, 15, 185, 209, 182, 224, 35, 74, 57, 11, 216, 73, 176, 56, 156,
-    248, 51, 59, 213, 118, 173, 44, 115, 129, 200, 139, 24, 203, 112, 176, 195, 158, 231, 218, 252, 154, 82, 184, 221,
-    171, 101, 46, 117, 149, 44, 210, 192, 173, 32, 106, 49, 67, 66, 218, 183, 17, 129, 16, 52, 186, 170, 3, 136, 12,
-    135, 246, 69, 138, 212, 190, 158, 125, 153, 187, 56, 143, 99, 206, 35, 177, 113, 151, 223, 26, 136, 236, 204, 249,
-    250, 118, 98, 177, 139, 69, 201, 138, 168, 162, 38, 217, 136, 240, 196, 158, 148, 114, 165, 231, 127, 115, 195, 6,
-    97, 56, 63, 248, 128, 250, 41, 33, 25, 62, 44, 34, 153, 90, 222, 153, 201, 222, 74, 91, 17, 74, 244, 19, 207, 122,
-    201, 107, 197, 132, 95, 156, 33, 39, 110, 1, 127, 41, 163, 135, 241, 181, 227, 79, 242, 131, 209, 14, 190, 174, 218,
-    191, 100, 1, 54, 58, 152, 183, 14, 16, 94, 61, 159, 150, 139, 53, 102, 16, 250, 58, 237, 120, 26, 159, 164, 27, 27,
-    80, 251, 167, 139, 14, 50, 183, 150, 216, 164, 51, 112, 151, 190, 231, 159, 12, 72, 192, 165, 202, 31, 231, 100,
-    210, 237, 185, 228, 199, 86, 175, 148, 131, 163, 67, 162, 225, 6, 240, 143, 41, 215, 128, 167, 52, 242, 211, 34,
-    190, 112, 84, 109, 26, 163, 199, 5, 212, 33, 64, 74, 23, 88, 140, 147, 160, 177, 250, 95, 28, 56, 5, 217, 81, 78,
-    190, 140, 239, 75, 19, 92, 79, 150, 40, 180, 107, 7, 63, 52, 45, 66, 7, 80, 19, 25, 158, 125, 96, 167, 231, 117,
-    132, 145, 111, 152, 125, 12, 85, 173, 214, 127, 41, 117, 125, 201, 169, 203, 41, 242, 27, 138, 40, 103, 126, 214,
-    57, 50, 94, 186, 6, 172, 136, 79, 144, 79, 150, 100, 67, 196, 202, 215, 162, 56, 214, 10, 43, 44, 182, 191, 192,
-    196, 84, 134, 65, 64, 215, 78, 232, 42, 205, 124, 183, 173, 227, 233, 227, 57, 206, 182, 70, 235, 14, 59, 104, 129,
-    137, 234, 2, 186, 153, 92, 99, 43, 254, 52, 6, 128, 222, 69, 134, 84, 185, 57, 125, 48, 164, 139, 160, 24, 15, 227,
-    246, 219, 153, 154, 228, 78, 236, 197, 120, 254, 109, 207, 1, 14, 219, 228, 63, 107, 57, 245, 89, 247, 144, 226,
-    211, 229, 33, 90, 225, 212, 40, 141, 129, 86, 124, 16, 60, 251, 49, 193, 59, 232, 9, 231, 159, 172, 48, 129, 66,
-    209, 18, 252, 123, 145, 168, 215, 83, 148, 188, 134, 76, 108, 2, 152, 74, 144, 116, 233, 2, 185, 72, 180, 163, 122,
-    90, 147, 47, 159, 193, 128, 200, 26, 188, 66, 30, 235, 3, 144, 26, 26, 33, 93, 91, 17, 228, 173, 193, 174, 210, 221,
-    70, 241, 211, 231, 204, 196, 4, 69, 0, 71, 111, 79, 110, 201, 201, 229, 108, 127, 176, 175, 97, 196, 246, 159, 131,
-    34, 111, 202, 229, 14, 222, 60, 125, 57, 48, 15, 77, 182, 21, 240, 172, 177, 139, 123, 152, 153, 17, 77, 249, 254,
-    99, 89, 202, 172, 78, 102, 252, 109, 116, 52, 30, 185, 82, 71, 122, 110, 118, 65, 183, 185, 126, 125, 146, 243, 3,
-    220, 184, 188, 11, 151, 210, 13, 82, 129, 207, 145, 98, 98, 245, 227, 83, 12, 196, 7, 188, 215, 163, 230, 75, 111,
-    24, 73, 192, 85, 72, 92, 42, 206, 153, 239, 130, 246, 18, 91, 203, 58, 90, 157, 87, 70, 147, 10, 99, 156, 108, 30,
-    105, 120, 134, 255, 131, 41, 176, 234, 1, 166, 216, 131, 8, 6, 21, 178, 45, 234, 202, 96, 34, 221, 82, 149, 3, 215,
-    193, 163, 220, 213, 68, 96, 209, 209, 29, 103, 53, 159, 230, 208, 62, 46, 106, 228, 9, 231, 156, 17, 136, 20, 217,
-    218, 245, 190, 18, 190, 37, 26, 235, 130, 152, 252, 50, 114, 153, 16, 40, 65, 157, 162, 5, 220, 221, 192, 93, 54,
-    206, 195, 235, 32, 77, 224, 195, 210, 236, 244, 66, 66, 40, 216, 6, 93, 188, 138, 151, 123, 73, 134, 31, 166, 59,
-    77, 152, 140, 100, 223, 194, 72, 17, 208, 90, 41, 160, 13, 244, 20, 158, 10, 88, 183, 195, 185, 187, 249, 201, 189,
-    15, 58, 168, 146, 21, 221, 106, 37, 159, 79, 97, 245, 242, 239, 86, 158, 53, 145, 32, 42, 230, 25, 190, 210, 147, 9,
-    75, 175, 92, 164, 83, 97, 170, 60, 46, 151, 149, 203, 170, 40, 248, 234, 235, 228, 124, 10, 181, 29, 48, 147, 9,
-    211, 65, 229, 237, 19, 67, 37, 134, 47, 117, 27, 129, 203, 51, 200, 161, 3, 8, 210, 31, 0, 235, 32, 229, 173, 138,
-    96, 238, 150, 123, 144, 25, 173, 50, 216, 150, 249, 8, 143, 169, 112, 34, 125, 0, 221, 239, 157, 155, 234, 233, 53,
-    176, 55, 162, 34, 205, 62, 181, 14, 229, 240, 236, 199, 130, 116, 174, 72, 3, 64, 26, 206, 16, 223, 6, 251, 63, 83,
-    27, 25, 213, 97, 54, 157, 50, 197, 57, 22, 139, 223, 189, 20, 207, 184, 172, 159, 131, 156, 170, 250, 170, 59, 153,
-    112, 17, 131, 73, 198, 164, 142, 86, 198, 22, 101, 208, 36, 201, 164, 90, 234, 71, 236, 191, 154, 97, 230, 122, 188,
-    103, 30, 83, 88, 128, 252, 58, 132, 103, 108, 51, 80, 49, 9, 89, 140, 206, 80, 15, 181, 143, 91, 9, 177, 81, 84,
-    207, 60, 39, 190, 186, 254, 70, 178, 165, 147, 119, 236, 189, 33, 3, 48, 221, 142, 108, 246, 131, 157, 101, 17, 61,
-    40, 157, 219, 186, 71, 132, 97, 73, 169, 211, 56, 196, 153, 195, 119, 64, 16, 232, 44, 233, 248, 208, 6, 216, 245,
-    198, 235, 114, 27, 95, 1, 63, 40, 131, 250, 237, 48, 164, 170, 174, 247, 123, 219, 14, 224, 182, 114, 24, 77, 145,
-    186, 35, 196, 22, 219, 224, 172, 228, 189, 5, 46, 152, 224, 252, 184, 142, 176, 65, 91, 251, 142, 139, 13, 228, 64,
-    225, 87, 131, 159, 37, 76, 26, 15, 16, 159, 243, 149, 131, 172, 175, 105, 124, 107, 44, 110, 70, 107, 162, 28, 131,
-    71, 38, 239, 234, 94, 240, 81, 173, 183, 230, 64, 5, 64, 140, 77, 235, 240, 138, 18, 34, 209, 104, 21, 183, 144,
-    226, 158, 143, 238, 31, 143, 134, 155, 54, 176, 106, 17, 59, 179, 98, 69, 42, 190, 47, 176, 6, 44, 21, 97, 94, 11,
-    75, 66, 26, 198, 48, 20, 243, 49, 133, 140, 243, 211, 129, 240, 11, 118, 66, 75, 201, 246, 97, 64, 94, 199, 63, 94,
-    121, 114, 61, 252, 210, 204, 170, 100, 9, 13, 64, 23, 141, 69, 104, 104, 24, 166, 172, 143, 157, 112, 151, 152, 217,
-    172, 37, 69, 90, 212, 220, 119, 211, 144, 5, 178, 43, 89, 249, 115, 166, 23, 186, 224, 161, 33, 202, 31, 23, 202,
-    241, 162, 13, 73, 164, 217, 84, 195, 48, 1, 4, 239, 236, 20, 171, 63, 82, 247, 38, 150, 190, 44, 157, 65, 131, 198,
-    160, 221, 243, 67, 141, 161, 29, 108, 67, 239, 249, 46, 87, 211, 66, 156, 165, 15, 129, 165, 70, 187, 62, 165, 112,
-    253, 217, 191, 104, 98, 26, 124, 93, 180, 133, 45, 226, 98, 203, 93, 239, 129, 57, 14, 125, 143, 6, 219, 163, 40,
-    15, 248, 158, 150, 213, 108, 178, 235, 180, 105, 179, 218, 126, 54, 41, 80, 131, 47, 1, 43, 224, 9, 246, 83, 163,
-    92, 202, 167, 179, 2, 45, 44, 67, 255, 250, 138, 81, 92, 65, 80, 144, 162, 163, 248, 204, 115, 44, 69, 250, 239,
-    186, 147, 6, 140, 18, 136, 25, 132, 178, 75, 114, 43, 172, 212, 159, 206, 47, 223, 67, 49, 22, 213, 42, 85, 83, 165,
-    94, 114, 104, 38, 98, 38, 197, 125, 91, 111, 168, 75, 158, 213, 57, 119, 53, 56, 245, 131, 221, 40, 11, 172, 166,
-    48, 136, 162, 28, 92, 138, 88, 198, 121, 97, 214, 242, 18, 11, 141, 115, 249, 125, 171, 160, 5, 72, 5, 41, 145, 161,
-    69, 212, 107, 109, 5, 107, 161, 12, 8, 142, 252, 203, 51, 131, 145, 12, 12, 205, 96, 222, 153, 125, 12, 104, 217,
-    41, 92, 194, 155, 34, 154, 209, 165, 155, 188, 97, 4, 88, 218, 119, 202, 157, 243, 37, 85, 104, 12, 189, 113, 64,
-    24, 96, 92, 44, 230, 128, 139, 209, 185, 77, 228, 149, 94, 226, 4, 246, 95, 254, 144, 163, 189, 130, 228, 165, 143,
-    204, 165, 12, 180, 28, 39, 183, 27, 127, 169, 0, 108, 205, 213, 63, 130, 117, 73, 195, 89, 51, 34, 12, 78, 221, 67,
-    134, 194, 236, 182, 123, 136, 86, 175, 27, 11, 176, 33, 225, 47, 43, 86, 69, 155, 169, 44, 119, 0, 209, 42, 236,
-    163, 101, 241, 25, 249, 84, 14, 39, 226, 215, 142, 247, 161, 106, 200, 72, 203, 241, 172, 67, 172, 99, 24, 186, 252,
-    205, 201, 160, 25, 18, 235, 84, 149, 178, 98, 229, 184, 73, 7, 101, 189, 205, 203, 180, 189, 67, 237, 186, 248, 235,
-    113, 12, 33, 63, 214, 40, 201, 38, 240, 164, 178, 67, 33, 102, 147, 192, 12, 85, 135, 253, 153, 15, 43, 245, 57,
-    115, 216, 113, 136, 197, 23, 249, 239, 55, 122, 231, 75, 50, 29, 194, 242, 226, 0, 251, 147, 90, 85, 117, 28, 239,
-    79, 129, 7, 136, 59, 104, 58, 48, 17, 0, 7, 78, 2, 230, 176, 254, 111, 15, 101, 159, 251, 111, 125, 46, 188, 232,
-    151, 104, 138, 143, 98, 22, 203, 7, 118, 44, 234, 17, 42, 136, 108, 221, 221, 231, 70, 236, 238, 239, 97, 210, 78,
-    210, 179, 185, 202, 11, 129, 179, 191, 236, 102, 130, 181, 175, 254, 197, 213, 163, 179, 252, 179, 229, 59, 210,
-    170, 226, 216, 151, 9, 255, 9, 108, 181, 162, 128, 211, 223, 92, 230, 100, 210, 110, 10, 72, 84, 19, 224, 248, 242,
-    204, 190, 39, 70, 125, 17, 60, 86, 211, 250, 232, 103, 47, 65, 216, 110, 35, 159, 109, 153, 20, 151, 151, 138, 227,
-    144, 12, 191, 231, 57, 223, 97, 43, 18, 24, 160, 187, 252, 103, 132, 11, 1, 49, 21, 131, 115, 246, 233, 39, 194,
-    137, 52, 163, 222, 65, 255, 61, 56, 9, 122, 34, 29, 222, 117, 6, 33, 56, 125, 14, 237, 156, 246, 155, 101, 229, 13,
-    109, 104, 251, 59, 38, 79, 223, 149, 27, 92, 1, 193, 154, 179, 250, 146, 74, 125, 129, 53, 156, 94, 93, 180, 242,
-    150, 192, 107, 192, 32, 97, 119, 126, 78, 109, 83, 97, 168, 45, 124, 6, 56, 71, 132, 51, 85, 76, 82, 242, 183, 232,
-    120, 6, 127, 22, 7, 53, 18, 102, 142, 144, 201, 67, 243, 125, 169, 84, 241, 185, 84, 0, 43, 242, 20, 220, 250, 102,
-    153, 53, 208, 92, 60, 116, 248, 194, 89, 137, 151, 100, 24, 41, 121, 190, 212, 255, 132, 175, 17, 126, 154, 217,
-    202, 96, 55, 191, 74, 26, 64, 202, 235, 182, 58, 35, 8, 44, 78, 187, 164, 122, 78, 228, 56, 161, 7, 230, 235, 254,
-    223, 50, 233, 101, 119, 189, 124, 25, 134, 123, 94, 149, 37, 81, 21, 1, 164, 18, 235, 139, 173, 163, 211, 74, 125,
-    215, 65, 43, 66, 76, 0, 113, 170, 7, 137, 15, 244, 175, 49, 172, 25, 118, 22, 134, 68, 204, 189, 182, 21, 250, 104,
-    86, 67, 35, 40, 8, 71, 244, 107, 174, 30, 3, 214, 138, 96, 134, 111, 153, 116, 42, 110, 70, 117, 9, 24, 11, 68, 184,
-    47, 144, 246, 113, 233, 75, 163, 227, 235, 20, 179, 30, 126, 0, 24, 144, 12, 220, 71, 74, 101, 63, 251, 187, 120,
-    142, 100, 76, 249, 98, 6, 205, 125, 101, 23, 99, 10, 145, 123, 181, 187, 220, 132, 154, 136, 118, 247, 129, 220,
-    181, 91, 240, 86, 162, 3, 244, 225, 103, 125, 176, 172, 204, 176, 163, 15, 26, 220, 80, 96, 169, 58, 120, 151, 142,
-    200, 132, 27, 145, 52, 71, 214, 253, 226, 59, 219, 211, 99, 54, 199, 19, 203, 237, 89, 231, 180, 105, 77, 227, 18,
-    235, 98, 184, 120, 149, 74, 255, 148, 36, 134, 21, 239, 237, 57, 114, 251, 7, 250, 180, 114, 27, 39, 18, 0, 136, 62,
-    95, 9, 207, 152, 99, 22, 158, 207, 13, 172, 161, 54, 59, 245, 118, 136, 40, 65, 45, 234, 80, 68, 21, 92, 57, 243,
-    205, 77, 188, 254, 53, 165, 51, 19, 198, 188, 52, 121, 228, 165, 100, 122, 113, 154, 242, 193, 101, 163, 65, 210,
-    94, 178, 21, 212, 135, 41, 153, 86, 151, 141, 68, 56, 121, 84, 81, 90, 28, 238, 70, 149, 179, 112, 72, 53, 213, 238,
-    235, 109, 28, 121, 138, 71, 122, 54, 185, 17, 124, 124, 226, 244, 248, 176, 97, 120, 86, 93, 46, 122, 103, 96, 3,
-    138, 94, 124, 9, 84, 166, 117, 242, 127, 76, 216, 222, 248, 253, 17, 203, 237, 238, 34, 191, 163, 165, 173, 178,
-    203, 186, 80, 80, 50, 16, 152, 182, 103, 230, 128, 46, 44, 179, 241, 98, 58, 176, 106, 246, 65, 89, 197, 191, 71,
-    54, 226, 185, 28, 54, 248, 181, 107, 82, 229, 227, 130, 248, 164, 104, 53, 77, 62, 59, 180, 109, 194, 190, 130, 177,
-    22, 121, 189, 106, 162, 248, 43, 108, 124, 79, 204, 210, 8, 30, 207, 220, 179, 7, 146, 105, 216, 255, 79, 231, 116,
-    149, 162, 0, 224, 223, 66, 138, 104, 81, 161, 24, 91, 33, 166, 81, 16, 14, 137, 189, 83, 114, 135, 145, 44, 10, 57,
-    201, 88, 77, 222, 184, 245, 39, 234, 41, 7, 98, 153, 157, 160, 129, 70, 79, 207, 31, 9, 132, 200, 36, 151, 87, 164,
-    77, 88, 187, 214, 65, 192, 47, 28, 228, 123, 201, 73, 86, 253, 57, 240, 170, 60, 250, 149, 21, 48, 121, 48, 202,
-    198, 113, 157, 21, 48, 242, 240, 139, 108, 26, 200, 4, 240, 207, 11, 146, 115, 132, 127, 250, 94, 231, 225, 202, 55,
-    196, 234, 94, 19, 236, 107, 205, 241, 118, 56, 64, 190, 37, 58, 226, 58, 86, 171, 13, 5, 46, 113, 249, 120, 67, 128,
-    40, 73, 184, 212, 143, 53, 37, 144, 65, 68, 97, 129, 141, 252, 160, 159, 54, 53, 107, 117, 23, 118, 202, 106, 192,
-    77, 128, 150, 52, 49, 25, 182, 219, 96, 38, 114, 206, 151, 119, 201, 209, 229, 229, 43, 4, 33, 118, 216, 181, 137,
-    53, 203, 159, 10, 171, 32, 51, 152, 84, 54, 168, 50, 118, 178, 183, 177, 46, 131, 174, 187, 103, 23, 157, 62, 198,
-    38, 9, 182, 189, 88, 68, 119, 188, 190, 29, 80, 85, 251, 239, 34, 129, 238, 92, 41, 104, 162, 56, 191, 86, 92, 63,
-    119, 93, 78, 184, 72, 135, 60, 60, 86, 2, 147, 173, 108, 98, 171, 61, 237, 40, 122, 187, 22, 203, 197, 28, 224, 69,
-    137, 127, 233, 114, 171, 211, 255, 174, 44, 126, 70, 85, 136, 208, 196, 122, 14, 161, 21, 112, 111, 106, 252, 251,
-    13, 14, 64, 33, 12, 0, 145, 35, 169, 206, 129, 176, 223, 151, 253, 83, 132, 255, 57, 79, 102, 186, 214, 103, 53, 64,
-    137, 6, 70, 216, 80, 91, 74, 45, 15, 50, 31, 112, 110, 58, 8, 234, 230, 99, 29, 104, 151, 151, 1, 46, 196, 199, 200,
-    195, 76, 88, 62, 134, 133, 25, 162, 48, 127, 234, 83, 218, 247, 57, 91, 111, 109, 85, 30, 1, 162, 125, 13, 123, 17,
-    180, 226, 167, 136, 157, 125, 225, 135, 152, 97, 220, 62, 234, 212, 16, 158, 246, 208, 134, 187, 197, 132, 92, 195,
-    183, 252, 140, 24, 205, 113, 37, 169, 234, 201, 175, 201, 72, 186, 84, 222, 109, 6, 173, 82, 174, 17, 237, 94, 9,
-    182, 118, 202, 102, 72, 163, 136, 35, 93, 241, 109, 82, 141, 180, 248, 211, 169, 210, 93, 125, 92, 51, 211, 97, 179,
-    127, 98, 48, 216, 84, 32, 4, 20, 137, 252, 130, 87, 58, 66, 249, 202, 94, 40, 103, 137, 151, 226, 176, 211, 95, 203,
-    36, 104, 239, 138, 102, 216, 211, 242, 173, 76, 204, 128, 128, 133, 202, 118, 142, 65, 171, 90, 101, 68, 75, 186,
-    78, 47, 66, 17, 239, 60, 60, 243, 9, 122, 30, 79, 162, 103, 178, 16, 102, 254, 249, 221, 63, 152, 187, 198, 160,
-    139, 117, 147, 213, 187, 156, 124, 197, 126, 117, 51, 60, 168, 188, 254, 200, 248, 133, 61, 99, 207, 76, 75, 172,
-    22, 114, 99, 173, 177, 19, 152, 54, 4, 144, 185, 87, 236, 69, 85, 234, 117, 175, 236, 168, 78, 83, 202, 210, 194,
-    207, 1, 150, 49, 187, 162, 218, 9, 249, 229, 40, 90, 113, 132, 41, 112, 133, 72, 33, 123, 112, 34, 26, 18, 34, 255,
-    149, 117, 138, 71, 55, 99, 177, 165, 69, 69, 54, 170, 196, 175, 244, 86, 167, 129, 199, 206, 187, 60, 75, 185, 255,
-    238, 90, 58, 87, 24, 76, 89, 185, 7, 133, 109, 101, 180, 10, 191, 183, 99, 105, 6, 41, 145, 69, 255, 196, 171, 148,
-    236, 230, 156, 20, 242, 67, 36, 217, 198, 31, 51, 37, 204, 228, 170, 149, 184, 205, 4, 160, 44, 169, 166, 236, 2,
-    72, 147, 128, 80, 241, 18, 134, 87, 136, 81, 193, 72, 35, 147, 79, 246, 104, 242, 135, 102, 115, 152, 25, 8, 66,
-    130, 28, 166, 133, 44, 114, 35, 180, 218, 193, 98, 79, 151, 243, 31, 76, 31, 248, 26, 105, 28, 40, 43, 133, 147, 88,
-    145, 163, 47, 217, 23, 6, 171, 246, 36, 30, 209, 71, 18, 205, 59, 52, 208, 139, 69, 158, 11, 208, 116, 94, 73, 50,
-    128, 100, 170, 13, 50, 38, 49, 103, 88, 210, 27, 71, 195, 195, 233, 204, 171, 244, 69, 189, 126, 51, 24, 115, 106,
-    134, 146, 113, 7, 129, 199, 29, 225, 16, 56, 32, 89, 198, 87, 169, 63, 153, 158, 71, 142, 20, 255, 177, 15, 3, 107,
-    80, 223, 87, 251, 107, 85, 181, 213, 51, 147, 187, 185, 82, 111, 24, 42, 177, 156, 55, 205, 33, 252, 223, 201, 219,
-    228, 182, 155, 129, 162, 164, 222, 97, 3, 87, 122, 115, 141, 234, 182, 110, 66, 97, 157, 0, 157, 141, 179, 229, 63,
-    163, 220, 164, 173, 210, 236, 15, 168, 53, 143, 97, 6, 231, 172, 163, 95, 160, 127, 114, 253, 193, 111, 167, 59, 23,
-    22, 209, 162, 235, 67, 2, 135, 79, 144, 107, 239, 246, 246, 173, 108, 251, 107, 134, 234, 220, 24, 15, 157, 66, 138,
-    143, 226, 100, 252, 147, 159, 224, 162, 208, 211, 13, 6, 38, 227, 142, 183, 91, 231, 253, 121, 184, 71, 240, 25,
-    243, 140, 43, 76, 154, 18, 255, 69, 146, 173, 225, 9, 19, 232, 190, 53, 19, 193, 10, 55, 235, 33, 144, 37, 197, 98,
-    59, 226, 105, 201, 199, 73, 180, 244, 126, 136, 243, 231, 141, 122, 158, 130, 90, 71, 45, 110, 192, 95, 21, 204,
-    233, 70, 180, 121, 245, 9, 224, 119, 65, 36, 178, 191, 231, 29, 130, 169, 211, 197, 93, 76, 123, 163, 140, 100, 133,
-    123, 98, 39, 14, 225, 7, 71, 217, 198, 112, 250, 181, 205, 22, 184, 196, 245, 63, 42, 255, 56, 220, 247, 60, 123,
-    224, 161, 209, 7, 99, 203, 127, 169, 48, 187, 252, 134, 248, 174, 45, 48, 146, 212, 116, 100, 16, 234, 218, 183,
-    171, 143, 85, 248, 25, 222, 127, 83, 213, 57, 100, 129, 177, 143, 163, 53, 226, 59, 84, 212, 25, 200, 112, 231, 11,
-    5, 254, 70, 98, 185, 96, 57, 216, 88, 202, 110, 22, 160, 180, 56, 31, 50, 84, 194, 12, 233, 249, 222, 224, 162, 17,
-    218, 214, 252, 116, 252, 254, 163, 223, 114, 155, 138, 149, 49, 83, 19, 17, 69, 168, 112, 208, 179, 189, 146, 90,
-    116, 39, 111, 115, 161, 42, 150, 172, 97, 166, 140, 109, 177, 249, 25, 84, 190, 113, 245, 251, 27, 136, 36, 125,
-    119, 81, 150, 112, 228, 52, 50, 140, 121, 155, 41, 32, 223, 107, 129, 246, 120, 68, 133, 238, 197, 159, 5, 28, 20,
-    50, 66, 140, 69, 67, 147, 163, 103, 211, 77, 205, 144, 106, 106, 53, 82, 185, 100, 205, 197, 50, 140, 78, 41, 176,
-    54, 232, 232, 212, 200, 204, 23, 13, 231, 81, 234, 142, 206, 192, 176, 194, 79, 120, 139, 131, 44, 34, 175, 115,
-    141, 9, 28, 86, 206, 84, 1, 184, 255, 41, 139, 254, 252, 145, 131, 255, 240, 201, 207, 157, 226, 143, 0, 164, 240,
-    194, 243, 215, 231, 15, 17, 28, 129, 37, 17, 23, 181, 66, 13, 163, 30, 79, 167, 111, 220, 77, 179, 252, 113, 66,
-    186, 161, 26, 60, 144, 5, 74, 117, 236, 5, 12, 203, 94, 213, 29, 251, 135, 32, 185, 47, 157, 172, 29, 59, 157, 170,
-    160, 42, 53, 173, 52, 238, 107, 184, 202, 14, 202, 59, 10, 62, 97, 29, 163, 107, 51, 111, 149, 181, 243, 10, 234,
-    63, 5, 116, 63, 5, 110, 250, 9, 91, 49, 22, 112, 191, 101, 73, 202, 134, 183, 216, 40, 194, 41, 197, 245, 27, 66,
-    155, 198, 228, 189, 30, 113, 58, 109, 168, 41, 21, 35, 148, 180, 88, 168, 15, 209, 180, 77, 251, 73, 58, 4, 33, 209,
-    149, 59, 158, 81, 37, 189, 189, 105, 241, 38, 96, 115, 239, 155, 191, 73, 172, 239, 63, 208, 88, 134, 95, 187, 179,
-    6, 157, 79, 124, 41, 251, 40, 66, 212, 196, 106, 125, 53, 150, 168, 3, 254, 148, 139, 56, 234, 202, 121, 132, 1, 5,
-    75, 52, 83, 248, 245, 32, 207, 206, 207, 165, 87, 127, 2, 167, 23, 225, 146, 66, 21, 64, 28, 58, 91, 248, 73, 187,
-    231, 43, 77, 64, 111, 45, 104, 195, 216, 63, 73, 93, 255, 68, 81, 4, 194, 247, 49, 202, 152, 233, 229, 32, 218, 246,
-    141, 224, 160, 108, 61, 50, 14, 194, 12, 226, 184, 115, 118, 7, 17, 53, 179, 6, 200, 127, 7, 34, 219, 125, 7, 103,
-    127, 42, 216, 184, 79, 252, 99, 7, 64, 0, 216, 147, 162, 209, 24, 50, 146, 28, 38, 155, 193, 71, 43, 7, 131, 25, 65,
-    46, 5, 174, 45, 82, 199, 160, 158, 238, 247, 193, 183, 125, 60, 7, 1, 157, 152, 9, 227, 159, 22, 155, 181, 92, 98,
-    148, 226, 202, 16, 141, 244, 83, 4, 231, 187, 239, 8, 210, 81, 251, 219, 65, 40, 132, 120, 173, 176, 4, 59, 168, 25,
-    252, 16, 28, 146, 197, 24, 131, 15, 255, 84, 47, 126, 153, 186, 132, 35, 254, 230, 216, 57, 207, 13, 60, 130, 247,
-    46, 179, 44, 22, 63, 206, 201, 131, 132, 72, 221, 65, 15, 170, 148, 141, 115, 1, 248, 207, 252, 183, 209, 9, 70, 87,
-    119, 222, 255, 200, 145, 148, 171, 228, 25, 209, 10, 194, 70, 213, 115, 248, 107, 179, 195, 222, 171, 180, 84, 37,
-    50, 138, 234, 98, 115, 19, 42, 183, 177, 197, 139, 226, 60, 75, 5, 14, 195, 108, 218, 124, 89, 155, 164, 158, 243,
-    163, 75, 229, 251, 183, 42, 213, 25, 137, 98, 65, 138, 60, 206, 106, 64, 134, 206, 82, 77, 191, 242, 252, 201, 70,
-    65, 188, 123, 130, 231, 132, 246, 60, 244, 181, 79, 112, 96, 97, 250, 90, 199, 210, 80, 211, 226, 59, 81, 30, 130,
-    249, 63, 69, 219, 146, 39, 101, 0, 189, 241, 146, 60, 176, 186, 118, 174, 11, 168, 46, 210, 3, 178, 124, 93, 55, 90,
-    88, 243, 152, 123, 184, 24, 21, 64, 121, 31, 218, 35, 175, 188, 95, 129, 142, 227, 61, 218, 67, 58, 27, 216, 177,
-    27, 224, 246, 140, 48, 16, 85, 1, 115, 244, 195, 215, 131, 191, 197, 184, 39, 91, 145, 169, 95, 48, 66, 1, 58, 59,
-    230, 13, 77, 11, 132, 25, 170, 140, 88, 231, 224, 209, 167, 1, 109, 231, 0, 179, 137, 47, 143, 199, 114, 210, 198,
-    113, 69, 33, 64, 55, 149, 61, 63, 125, 137, 176, 130, 83, 37, 229, 71, 144, 57, 52, 74, 173, 217, 192, 57, 243, 59,
-    50, 207, 20, 108, 28, 249, 184, 183, 217, 85, 65, 130, 37, 200, 63, 77, 135, 172, 49, 230, 48, 81, 252, 86, 37, 136,
-    52, 237, 34, 150, 85, 95, 15, 234, 222, 66, 50, 250, 173, 60, 183, 125, 190, 173, 129, 74, 62, 239, 108, 208, 236,
-    222, 211, 228, 90, 53, 120, 58, 137, 67, 96, 238, 123, 231, 100, 83, 16, 248, 41, 111, 62, 121, 145, 174, 130, 31,
-    32, 169, 72, 233, 191, 57, 195, 134, 242, 44, 105, 0, 175, 223, 122, 168, 225, 139, 154, 18, 214, 56, 169, 239, 154,
-    165, 179, 200, 184, 24, 29, 112, 192, 96, 185, 232, 121, 17, 4, 65, 219, 53, 89, 136, 248, 124, 154, 64, 253, 168,
-    234, 2, 159, 204, 222, 79, 94, 157, 123, 86, 5, 25, 46, 201, 1, 226, 150, 55, 127, 136, 46, 44, 233, 11, 77, 44,
-    184, 142, 240, 215, 219, 46, 190, 77, 73, 185, 195, 146, 228, 52, 221, 227, 51, 224, 178, 253, 122, 181, 58, 102,
-    166, 235, 233, 24, 176, 108, 151, 165, 135, 248, 17, 3, 213, 163, 204, 205, 24, 114, 163, 93, 87, 200, 69, 8, 176,
-    147, 82, 130, 235, 130, 99, 240, 149, 84, 21, 9, 178, 17, 35, 209, 178, 212, 45, 94, 73, 97, 72, 147, 88, 125, 154,
-    45, 25, 238, 186, 219, 25, 210, 216, 88, 212, 89, 31, 244, 203, 169, 16, 71, 216, 68, 186, 47, 105, 124, 214, 180,
-    164, 80, 151, 211, 124, 193, 103, 219, 40, 229, 48, 174, 79, 32, 55, 96, 231, 169, 139, 49, 4, 99, 15, 158, 69, 234,
-    150, 130, 204, 222, 71, 99, 233, 123, 83, 8, 199, 18, 196, 113, 46, 90, 134, 187, 178, 59, 23, 149, 204, 150, 35,
-    187, 66, 238, 11, 33, 46, 13, 119, 47, 0, 167, 13, 225, 111, 200, 48, 4, 255, 113, 196, 11, 93, 184, 96, 103, 221,
-    220, 44, 35, 87, 163, 190, 9, 234, 187, 63, 6, 209, 3, 50, 84, 32, 91, 147, 155, 184, 243, 249, 75, 168, 223, 202,
-    243, 200, 160, 177, 5, 204, 217, 200, 140, 117, 125, 229, 13, 223, 198, 132, 173, 152, 224, 210, 26, 49, 58, 117,
-    118, 66, 115, 117, 159, 32, 8, 157, 23, 96, 128, 126, 124, 41, 164, 36, 88, 170, 162, 42, 136, 82, 21, 39, 167, 188,
-    91, 233, 231, 222, 165, 155, 77, 123, 117, 83, 5, 34, 73, 35, 197, 219, 147, 207, 159, 148, 17, 44, 82, 17, 168,
-    139, 39, 240, 219, 165, 118, 122, 61, 128, 230, 74, 3, 215, 19, 145, 192, 93, 43, 81, 85, 192, 120, 90, 32, 127,
-    245, 7, 38, 117, 13, 30, 80, 67, 58, 163, 185, 239, 28, 223, 247, 31, 59, 221, 200, 39, 6, 219, 193, 126, 247, 245,
-    138, 121, 141, 29, 159, 254, 8, 249, 52, 32, 82, 30, 58, 67, 18, 245, 80, 140, 105, 255, 203, 36, 202, 66, 242, 48,
-    124, 87, 186, 130, 89, 17, 176, 3, 21, 9, 125, 121, 165, 48, 252, 133, 13, 222, 221, 237, 135, 162, 128, 12, 110,
-    64, 147, 193, 69, 218, 53, 168, 139, 56, 125, 154, 69, 61, 193, 170, 162, 198, 16, 160, 77, 153, 171, 178, 80, 5,
-    228, 106, 218, 69, 110, 196, 200, 244, 116, 139, 145, 53, 164, 25, 63, 241, 68, 171, 122, 239, 133, 53, 235, 110,
-    148, 214, 190, 237, 59, 151, 15, 57, 172, 4, 17, 78, 94, 229, 224, 168, 39, 241, 249, 218, 19, 102, 127, 104, 244,
-    82, 233, 140, 69, 43, 196, 139, 251, 75, 86, 108, 84, 160, 124, 128, 97, 86, 182, 162, 87, 244, 9, 93, 208, 132, 83,
-    156, 169, 119, 174, 66, 78, 237, 183, 240, 120, 187, 132, 62, 219, 204, 129, 65, 103, 88, 158, 98, 155, 104, 82,
-    244, 229, 62, 39, 91, 73, 161, 90, 10, 150, 226, 127, 249, 163, 161, 45, 31, 96, 212, 91, 182, 205, 239, 157, 25,
-    142, 36, 255, 136, 210, 2, 203, 249, 5, 134, 27, 72, 203, 162, 119, 39, 3, 138, 152, 245, 93, 211, 57, 149, 190,
-    165, 105, 225, 245, 132, 57, 218, 170, 106, 109, 249, 83, 0, 68, 218, 177, 150, 35, 225, 0, 145, 89, 253, 253, 32,
-    67, 157, 114, 79, 82, 66, 58, 92, 94, 235, 85, 234, 20, 55, 58, 108, 160, 34, 4, 19, 178, 128, 217, 255, 232, 29,
-    123, 83, 141, 207, 130, 63, 133, 150, 70, 118, 5, 236, 51, 36, 202, 96, 0, 46, 114, 117, 123, 46, 76, 38, 67, 89, 4,
-    251, 99, 153, 89, 40, 1, 46, 62, 164, 28, 85, 18, 230, 143, 51, 207, 236, 24, 26, 159, 12, 76, 159, 161, 151, 103,
-    184, 14, 167, 65, 78, 53, 35, 90, 218, 147, 26, 218, 160, 123, 177, 49, 242, 185, 242, 89, 191, 80, 24, 252, 162,
-    137, 159, 202, 157, 30, 197, 226, 33, 52, 26, 81, 68, 175, 72, 150, 53, 158, 209, 159, 209, 22, 145, 60, 106, 66,
-    52, 149, 154, 21, 112, 167, 205, 208, 142, 117, 103, 15, 208, 113, 135, 186, 242, 145, 50, 203, 107, 37, 247, 96,
-    55, 108, 218, 205, 115, 201, 211, 80, 124, 47, 24, 225, 33, 28, 26, 76, 73, 236, 149, 61, 129, 183, 158, 124, 194,
-    20, 255, 146, 149, 244, 145, 77, 67, 24, 65, 75, 121, 253, 107, 147, 212, 8, 240, 224, 245, 17, 56, 200, 68, 121,
-    12, 45, 216, 252, 214, 172, 4, 187, 210, 127, 211, 183, 42, 21, 69, 20, 214, 9, 114, 31, 93, 108, 196, 192, 120,
-    239, 154, 211, 255, 144, 194, 117, 161, 81, 153, 208, 162, 209, 104, 177, 165, 74, 41, 4, 81, 232, 148, 94, 155, 14,
-    13, 121, 254, 86, 158, 97, 20, 21, 250, 3, 248, 82, 232, 249, 193, 235, 17, 194, 39, 115, 110, 240, 67, 31, 14, 32,
-    241, 219, 96, 88, 204, 72, 123, 9, 222, 82, 22, 215, 26, 233, 184, 114, 170, 202, 16, 131, 254, 24, 190, 154, 37,
-    89, 90, 205, 127, 121, 237, 99, 42, 119, 242, 84, 190, 97, 29, 222, 128, 175, 216, 40, 33, 119, 37, 51, 44, 8, 125,
-    97, 99, 244, 102, 20, 92, 178, 210, 12, 101, 147, 93, 67, 68, 35, 202, 123, 169, 192, 46, 72, 54, 103, 200, 42, 148,
-    73, 248, 130, 69, 42, 241, 56, 28, 28, 0, 67, 90, 147, 145, 183, 224, 222, 70, 63, 89, 247, 231, 53, 3, 212, 31,
-    174, 125, 109, 175, 198, 225, 175, 240, 8, 171, 167, 125, 237, 30, 174, 194, 35, 103, 52, 129, 196, 231, 195, 54,
-    79, 255, 31, 76, 165, 69, 134, 7, 155, 124, 0, 49, 240, 184, 13, 58, 222, 228, 100, 208, 28, 246, 167, 153, 4, 36,
-    216, 13, 108, 20, 8, 255, 170, 36, 67, 92, 216, 35, 191, 213, 167, 244, 21, 204, 9, 150, 161, 103, 113, 25, 86, 127,
-    231, 199, 53, 87, 205, 69, 233, 121, 149, 178, 114, 28, 163, 204, 220, 231, 190, 233, 161, 251, 113, 245, 12, 3,
-    124, 63, 16, 243, 41, 20, 237, 8, 47, 104, 135, 84, 192, 110, 10, 12, 65, 206, 220, 6, 82, 249, 227, 152, 5, 253,
-    236, 101, 69, 186, 221, 29, 163, 249, 210, 98, 251, 172, 143, 198, 132, 186, 151, 171, 133, 200, 230, 24, 112, 205,
-    59, 208, 67, 19, 222, 48, 227, 0, 55, 115, 164, 167, 123, 139, 142, 135, 149, 62, 46, 49, 246, 123, 95, 236, 130,
-    78, 167, 9, 85, 192, 217, 53, 26, 221, 123, 38, 245, 83, 81, 58, 114, 251, 140, 3, 253, 16, 13, 53, 18, 86, 150, 37,
-    162, 136, 230, 182, 132, 157, 5, 14, 27, 179, 178, 198, 100, 89, 247, 242, 13, 193, 208, 229, 167, 155, 215, 242,
-    231, 224, 131, 66, 186, 18, 117, 28, 153, 45, 126, 115, 7, 46, 111, 229, 169, 106, 130, 160, 126, 57, 254, 164, 38,
-    93, 164, 50, 245, 190, 251, 42, 197, 56, 89, 236, 161, 166, 250, 164, 2, 74, 60, 34, 3, 33, 99, 84, 195, 106, 169,
-    194, 242, 61, 28, 33, 252, 244, 185, 154, 217, 220, 102, 195, 159, 103, 188, 200, 62, 37, 111, 248, 206, 144, 77,
-    126, 133, 233, 227, 185, 221, 236, 134, 77, 22, 40, 125, 226, 85, 72, 237, 216, 27, 167, 124, 74, 91, 176, 21, 100,
-    215, 211, 173, 17, 3, 253, 223, 190, 191, 149, 214, 208, 93, 186, 145, 50, 177, 81, 185, 222, 53, 16, 26, 185, 246,
-    197, 73, 237, 122, 150, 199, 17, 83, 159, 187, 131, 136, 81, 74, 4, 49, 12, 21, 230, 250, 3, 97, 147, 26, 48, 96,
-    135, 235, 147, 151, 75, 58, 221, 252, 173, 205, 111, 176, 102, 195, 169, 162, 82, 232, 233, 246, 70, 25, 107, 154,
-    161, 144, 183, 67, 182, 183, 150, 58, 154, 190, 199, 125, 169, 108, 188, 90, 141, 232, 105, 211, 25, 86, 233, 27,
-    70, 31, 70, 242, 158, 194, 36, 233, 53, 199, 127, 60, 172, 97, 158, 246, 212, 129, 235, 114, 240, 224, 118, 91, 85,
-    240, 43, 79, 71, 70, 251, 211, 164, 36, 177, 89, 111, 209, 61, 180, 86, 112, 22, 133, 150, 68, 238, 243, 177, 199,
-    92, 216, 166, 97, 58, 47, 225, 84, 249, 176, 209, 177, 190, 153, 221, 51, 161, 143, 82, 8, 36, 188, 157, 206, 251,
-    220, 77, 5, 30, 190, 36, 13, 146, 17, 99, 203, 11, 215, 59, 155, 90, 82, 55, 96, 202, 6, 169, 54, 223, 74, 161, 97,
-    155, 28, 84, 142, 82, 164, 96, 240, 8, 70, 76, 54, 85, 86, 41, 22, 209, 75, 191, 82, 190, 23, 36, 18, 163, 163, 218,
-    95, 48, 180, 200, 133, 213, 203, 125, 225, 143, 136, 57, 105, 3, 43, 4, 120, 129, 62, 200, 125, 250, 107, 140, 180,
-    215, 151, 169, 207, 196, 181, 135, 181, 72, 123, 93, 160, 58, 25, 207, 252, 101, 180, 208, 185, 177, 58, 120, 229,
-    228, 240, 136, 217, 203, 115, 66, 165, 181, 52, 149, 217, 137, 19, 203, 188, 2, 134, 229, 227, 232, 37, 48, 8, 110,
-    39, 141, 161, 72, 5, 59, 108, 64, 105, 53, 15, 175, 200, 133, 247, 220, 187, 80, 188, 123, 95, 129, 71, 104, 248,
-    27, 23, 2, 179, 134, 175, 33, 254, 159, 36, 62, 184, 147, 160, 36, 40, 165, 68, 44, 143, 106, 4, 25, 180, 228, 159,
-    31, 167, 91, 177, 205, 192, 152, 236, 26, 237, 249, 39, 108, 4, 117, 125, 156, 84, 58, 242, 184, 125, 67, 12, 172,
-    251, 253, 214, 241, 86, 89, 48, 206, 110, 6, 189, 77, 161, 220, 141, 77, 87, 57, 190, 216, 57, 211, 111, 43, 249,
-    99, 184, 157, 239, 206, 142, 163, 14, 208, 176, 205, 84, 73, 32, 227, 61, 102, 171, 129, 28, 119, 81, 150, 157, 185,
-    195, 139, 231, 68, 133, 81, 1, 186, 209, 230, 191, 160, 212, 128, 241, 159, 33, 60, 59, 139, 143, 107, 37, 147, 160,
-    7, 145, 232, 199, 155, 178, 223, 100, 148, 213, 167, 34, 82, 110, 27, 103, 235, 84, 184, 122, 100, 28, 139, 210, 77,
-    28, 46, 240, 163, 188, 23, 205, 246, 159, 69, 195, 152, 66, 221, 124, 202, 56, 180, 235, 119, 43, 196, 51, 39, 22,
-    15, 142, 145, 152, 243, 165, 42, 222, 120, 60, 195, 213, 199, 206, 197, 168, 35, 22, 242, 189, 153, 26, 33, 17, 137,
-    188, 160, 109, 145, 88, 230, 209, 133, 53, 141, 13, 43, 160, 25, 80, 141, 64, 6, 42, 252, 17, 200, 225, 170, 152,
-    194, 2, 62, 69, 102, 241, 141, 62, 182, 69, 15, 108, 207, 20, 42, 5, 179, 172, 187, 234, 12, 233, 244, 138, 73, 220,
-    89, 26, 233, 168, 94, 42, 165, 92, 43, 226, 41, 165, 23, 23, 71, 200, 214, 13, 187, 182, 156, 207, 5, 181, 201, 201,
-    179, 250, 53, 93, 190, 49, 127, 142, 110, 50, 78, 68, 107, 65, 160, 101, 11, 128, 21, 114, 28, 101, 84, 237, 46, 1,
-    5, 49, 28, 165, 131, 64, 11, 249, 122, 229, 128, 123, 82, 246, 33, 42, 52, 107, 118, 172, 130, 204, 17, 63, 42, 189,
-    64, 56, 195, 160, 196, 21, 27, 199, 38, 9, 101, 220, 149, 223, 207, 181, 152, 203, 36, 116, 225, 157, 214, 22, 130,
-    175, 130, 208, 208, 120, 249, 77, 119, 218, 191, 168, 67, 174, 38, 120, 246, 86, 173, 0, 12, 162, 22, 180, 137, 146,
-    115, 26, 238, 91, 192, 173, 202, 226, 239, 186, 11, 44, 222, 41, 233, 100, 148, 23, 17, 1, 52, 174, 152, 30, 142,
-    233, 84, 79, 104, 224, 205, 15, 176, 195, 19, 52, 38, 244, 132, 204, 199, 189, 86, 75, 56, 69, 41, 8, 7, 90, 95, 91,
-    180, 11, 50, 129, 54, 21, 73, 17, 163, 210, 243, 108, 5, 47, 190, 204, 89, 114, 193, 193, 247, 108, 73, 139, 61, 70,
-    254, 21, 194, 195, 185, 143, 145, 176, 114, 167, 29, 69, 71, 186, 181, 194, 30, 79, 91, 43, 42, 73, 192, 51, 173,
-    132, 208, 93, 182, 87, 33, 186, 208, 8, 160, 143, 123, 11, 112, 76, 97, 96, 81, 200, 152, 102, 66, 4, 62, 113, 11,
-    80, 165, 122, 54, 147, 5, 103, 171, 51, 62, 152, 254, 220, 74, 141, 114, 51, 176, 97, 250, 153, 184, 31, 7, 61, 80,
-    238, 253, 89, 93, 70, 17, 216, 95, 158, 80, 220, 18, 228, 77, 42, 252, 216, 134, 28, 35, 55, 154, 250, 61, 33, 124,
-    141, 95, 20, 211, 20, 161, 142, 24, 123, 253, 215, 181, 134, 55, 140, 170, 24, 107, 213, 35, 175, 111, 108, 85, 32,
-    198, 51, 145, 46, 203, 154, 182, 205, 169, 29, 129, 21, 21, 108, 207, 4, 0, 187, 233, 11, 148, 95, 125, 127, 200, 5,
-    227, 29, 157, 125, 237, 121, 27, 33, 42, 38, 104, 234, 159, 48, 226, 179, 82, 110, 80, 51, 29, 130, 148, 26, 206,
-    26, 19, 210, 57, 102, 69, 127, 39, 0, 0, 176, 122, 68, 62, 251, 136, 13, 162, 163, 213, 163, 240, 251, 194, 214,
-    133, 200, 223, 98, 44, 225, 183, 111, 110, 143, 252, 23, 173, 56, 179, 6, 200, 88, 155, 15, 112, 96, 39, 215, 30,
-    208, 84, 142, 214, 227, 56, 5, 231, 249, 226, 155, 90, 240, 235, 76, 239, 236, 15, 176, 244, 175, 44, 138, 174, 195,
-    65, 166, 36, 224, 6, 46, 32, 230, 15, 196, 135, 124, 238, 120, 174, 130, 124, 127, 50, 101, 88, 145, 83, 146, 10,
-    252, 233, 171, 68, 92, 33, 1, 157, 134, 232, 166, 179, 135, 223, 186, 166, 232, 186, 9, 206, 160, 177, 247, 84, 79,
-    109, 30, 58, 46, 207, 215, 13, 190, 198, 83, 103, 107, 94, 80, 146, 124, 29, 52, 246, 0, 213, 206, 95, 188, 37, 252,
-    212, 126, 60, 200, 225, 177, 238, 122, 205, 229, 172, 20, 209, 60, 32, 249, 13, 60, 207, 49, 132, 41, 186, 68, 79,
-    142, 192, 167, 238, 209, 77, 3, 251, 98, 89, 183, 2, 185, 89, 17, 46, 115, 230, 246, 255, 164, 74, 120, 240, 48, 59,
-    44, 1, 240, 48, 76, 55, 38, 32, 111, 191, 34, 115, 169, 187, 154, 107, 130, 202, 75, 197, 206, 20, 47, 230, 71, 108,
-    105, 23, 11, 48, 61, 61, 2, 209, 214, 129, 86, 39, 145, 5, 27, 68, 223, 38, 75, 152, 36, 203, 73, 168, 236, 86, 151,
-    116, 29, 116, 94, 88, 65, 81, 47, 85, 120, 186, 108, 151, 126, 196, 60, 10, 228, 174, 104, 138, 204, 116, 71, 213,
-    24, 171, 71, 35, 11, 247, 216, 46, 121, 89, 119, 236, 7, 1, 202, 40, 99, 81, 147, 19, 131, 250, 189, 9, 147, 124, 4,
-    21, 193, 60, 75, 165, 215, 117, 84, 42, 204, 110, 71, 198, 46, 197, 29, 77, 35, 104, 66, 112, 34, 40, 43, 250, 99,
-    186, 190, 163, 89, 255, 78, 93, 49, 248, 143, 89, 114, 10, 61, 252, 105, 14, 55, 30, 2, 151, 131, 75, 16, 38, 97,
-    180, 99, 159, 9, 192, 59, 92, 149, 160, 154, 70, 158, 71, 60, 205, 78, 191, 228, 235, 155, 76, 195, 56, 52, 91, 242,
-    229, 40, 14, 169, 84, 148, 118, 152, 1, 91, 39, 53, 93, 69, 154, 118, 102, 96, 164, 12, 10, 64, 157, 13, 254, 157,
-    8, 112, 15, 233, 29, 153, 68, 211, 98, 127, 12, 206, 244, 30, 149, 198, 143, 231, 181, 181, 107, 90, 61, 207, 179,
-    201, 251, 193, 73, 223, 19, 237, 7, 24, 171, 12, 215, 19, 42, 26, 36, 147, 56, 219, 158, 61, 62, 50, 232, 81, 146,
-    163, 88, 20, 208, 107, 52, 226, 88, 251, 114, 136, 70, 213, 150, 169, 228, 26, 104, 182, 151, 5, 188, 216, 134, 167,
-    120, 179, 9, 158, 242, 113, 63, 244, 142, 42, 157, 13, 147, 157, 45, 177, 255, 95, 176, 254, 45, 246, 128, 68, 204,
-    82, 55, 166, 120, 89, 20, 155, 8, 241, 112, 211, 122, 246, 214, 212, 230, 114, 250, 86, 181, 33, 77, 175, 139, 253,
-    247, 102, 18, 248, 213, 190, 63, 116, 102, 133, 91, 157, 247, 31, 6, 158, 128, 26, 55, 148, 234, 23, 163, 109, 229,
-    92, 238, 231, 102, 40, 140, 250, 13, 164, 141, 144, 112, 169, 120, 163, 186, 26, 119, 131, 77, 30, 41, 229, 228,
-    182, 211, 14, 102, 36, 110, 109, 161, 189, 65, 28, 37, 38, 54, 254, 216, 213, 233, 70, 119, 117, 109, 221, 54, 187,
-    244, 45, 57, 136, 161, 218, 226, 81, 19, 213, 23, 124, 159, 233, 15, 70, 10, 151, 43, 232, 150, 135, 122, 187, 182,
-    106, 146, 84, 38, 152, 40, 230, 156, 56, 241, 189, 6, 184, 206, 32, 80, 11, 19, 19, 146, 172, 187, 47, 23, 77, 65,
-    229, 159, 207, 142, 121, 17, 235, 69, 79, 206, 176, 181, 252, 110, 151, 151, 125, 186, 214, 102, 109, 9, 194, 20,
-    157, 216, 182, 70, 166, 175, 79, 80, 27, 177, 98, 182, 55, 66, 255, 20, 122, 231, 82, 207, 3, 98, 50, 244, 219, 248,
-    83, 173, 178, 137, 81, 179, 121, 162, 199, 147, 203, 58, 62, 184, 45, 16, 246, 103, 165, 122, 137, 252, 218, 234,
-    61, 197, 28, 249, 72, 211, 81, 127, 145, 242, 191, 55, 61, 7, 151, 200, 79, 229, 79, 58, 189, 159, 2, 76, 164, 179,
-    254, 63, 119, 57, 48, 127, 41, 123, 207, 241, 176, 80, 160, 219, 73, 25, 158, 96, 198, 210, 101, 124, 231, 32, 87,
-    42, 96, 81, 250, 249, 56, 53, 66, 8, 181, 245, 80, 64, 138, 130, 254, 166, 204, 22, 124, 98, 225, 27, 63, 91, 208,
-    146, 253, 31, 139, 44, 145, 29, 159, 153, 98, 151, 88, 148, 234, 21, 208, 87, 77, 217, 209, 107, 139, 9, 177, 231,
-    49, 238, 21, 141, 224, 210, 79, 119, 227, 236, 241, 246, 249, 28, 44, 76, 193, 9, 68, 48, 249, 238, 103, 201, 24,
-    12, 249, 74, 65, 253, 56, 166, 65, 214, 236, 122, 142, 236, 30, 251, 86, 6, 7, 170, 66, 181, 21, 120, 94, 96, 168,
-    247, 146, 28, 177, 101, 188, 78, 84, 112, 15, 164, 57, 239, 233, 59, 187, 184, 246, 47, 145, 21, 102, 211, 61, 151,
-    199, 22, 145, 49, 41, 101, 96, 38, 232, 92, 192, 207, 201, 89, 83, 161, 221, 105, 174, 20, 233, 155, 35, 237, 99,
-    190, 175, 93, 149, 103, 39, 152, 245, 54, 202, 19, 62, 9, 137, 44, 96, 53, 198, 93, 238, 5, 54, 157, 169, 108, 252,
-    200, 239, 28, 8, 97, 80, 181, 134, 254, 117, 133, 145, 86, 163, 120, 65, 198, 198, 70, 48, 226, 198, 143, 86, 39,
-    145, 232, 190, 246, 253, 71, 167, 252, 56, 150, 134, 236, 223, 67, 114, 32, 163, 163, 164, 217, 157, 132, 131, 175,
-    127, 150, 203, 16, 216, 44, 101, 246, 26, 147, 194, 57, 124, 150, 62, 216, 94, 203, 85, 186, 35, 108, 56, 134, 28,
-    251, 55, 45, 202, 247, 183, 163, 254, 184, 160, 53, 241, 54, 150, 36, 49, 252, 38, 10, 62, 36, 85, 175, 122, 197,
-    191, 85, 12, 36, 192, 154, 53, 219, 91, 229, 89, 156, 88, 129, 185, 129, 39, 209, 200, 18, 117, 11, 75, 240, 42,
-    182, 84, 233, 181, 61, 53, 96, 255, 193, 153, 32, 225, 110, 0, 246, 184, 29, 124, 82, 238, 57, 49, 245, 171, 29,
-    141, 71, 163, 15, 97, 139, 249, 253, 177, 247, 207, 76, 229, 55, 135, 215, 168, 147, 137, 222, 223, 79, 49, 123,
-    172, 194, 43, 78, 198, 27, 147, 216, 228, 206, 189, 126, 95, 255, 65, 241, 33, 106, 174, 205, 210, 114, 22, 0, 95,
-    80, 86, 77, 123, 162, 138, 35, 168, 87, 94, 72, 179, 196, 102, 159, 98, 237, 218, 5, 236, 20, 158, 207, 244, 226,
-    101, 57, 140, 191, 246, 111, 104, 163, 195, 22, 14, 39, 111, 255, 150, 42, 126, 132, 105, 255, 132, 119, 137, 61,
-    93, 2, 26, 71, 71, 227, 12, 34, 2, 203, 18, 50, 62, 196, 188, 65, 207, 74, 88, 63, 252, 52, 43, 24, 217, 255, 25,
-    231, 223, 208, 3, 29, 82, 25, 70, 166, 167, 35, 192, 233, 166, 129, 238, 31, 80, 167, 4, 42, 73, 238, 90, 178, 156,
-    1, 181, 187, 80, 181, 0, 113, 237, 80, 79, 211, 48, 51, 197, 55, 74, 144, 76, 98, 36, 243, 126, 11, 18, 44, 155,
-    146, 147, 18, 91, 230, 203, 99, 230, 12, 187, 241, 68, 42, 176, 196, 228, 85, 71, 182, 251, 74, 54, 232, 73, 191,
-    18, 55, 225, 248, 111, 216, 170, 234, 94, 80, 235, 239, 42, 45, 145, 175, 210, 67, 12, 121, 4, 190, 131, 221, 204,
-    104, 15, 122, 217, 69, 142, 202, 200, 77, 168, 244, 26, 5, 153, 126, 225, 214, 232, 45, 101, 168, 59, 67, 58, 167,
-    204, 83, 63, 68, 112, 30, 57, 17, 17, 113, 204, 185, 231, 155, 79, 63, 135, 109, 65, 54, 207, 104, 185, 5, 34, 125,
-    123, 188, 233, 133, 187, 15, 150, 239, 196, 182, 169, 74, 57, 34, 147, 36, 84, 144, 218, 16, 233, 35, 24, 249, 13,
-    32, 196, 205, 159, 122, 24, 182, 110, 95, 36, 56, 27, 239, 151, 118, 165, 105, 23, 115, 21, 225, 194, 62, 197, 24,
-    5, 180, 142, 122, 30, 186, 24, 183, 219, 249, 225, 112, 90, 153, 86, 231, 205, 166, 108, 207, 242, 121, 113, 119,
-    135, 247, 195, 215, 144, 244, 193, 95, 24, 196, 209, 72, 231, 92, 208, 136, 65, 197, 245, 69, 12, 94, 75, 51, 17,
-    108, 7, 179, 84, 218, 54, 34, 73, 185, 242, 249, 230, 239, 231, 58, 172, 66, 126, 211, 64, 29, 25, 222, 247, 21,
-    199, 198, 173, 94, 70, 149, 226, 240, 27, 200, 101, 121, 155, 153, 68, 82, 185, 23, 99, 252, 27, 94, 146, 79, 109,
-    188, 141, 66, 138, 66, 215, 26, 67, 148, 181, 69, 58, 180, 91, 222, 40, 62, 181, 157, 253, 240, 16, 73, 130, 180,
-    150, 253, 102, 179, 185, 205, 206, 122, 146, 241, 252, 232, 97, 222, 63, 182, 30, 85, 76, 106, 198, 75, 215, 103,
-    166, 28, 212, 155, 220, 103, 123, 113, 31, 147, 188, 134, 214, 29, 122, 195, 38, 177, 16, 23, 34, 28, 51, 36, 119,
-    226, 83, 165, 109, 92, 71, 210, 94, 64, 156, 173, 201, 45, 229, 205, 163, 92, 70, 181, 29, 35, 10, 231, 68, 54, 191,
-    164, 198, 159, 26, 81, 145, 201, 169, 236, 139, 72, 115, 90, 122, 53, 57, 0, 100, 244, 40, 38, 55, 128, 138, 240,
-    68, 84, 24, 21, 20, 240, 197, 167, 172, 69, 205, 7, 55, 82, 136, 144, 200, 189, 84, 219, 133, 70, 252, 90, 39, 244,
-    29, 228, 196, 153, 216, 62, 181, 124, 32, 232, 182, 147, 182, 98, 115, 121, 7, 54, 92, 143, 1, 27, 117, 178, 122,
-    239, 186, 120, 220, 72, 105, 84, 125, 145, 192, 49, 188, 165, 99, 37, 61, 95, 238, 215, 154, 39, 86, 22, 175, 58,
-    10, 10, 18, 92, 112, 25, 111, 176, 182, 132, 191, 50, 199, 114, 120, 156, 216, 114, 206, 208, 94, 27, 111, 10, 36,
-    46, 133, 97, 175, 239, 96, 124, 145, 25, 63, 196, 188, 61, 171, 83, 72, 109, 159, 162, 2, 66, 156, 77, 35, 22, 112,
-    167, 216, 232, 251, 140, 242, 129, 137, 143, 125, 0, 226, 19, 80, 142, 222, 193, 162, 102, 181, 206, 141, 94, 60,
-    77, 226, 212, 200, 186, 94, 43, 94, 228, 109, 26, 84, 53, 154, 39, 61, 245, 229, 223, 32, 175, 192, 49, 33, 146,
-    116, 21, 80, 135, 27, 112, 181, 213, 57, 84, 142, 14, 81, 214, 169, 200, 90, 63, 111, 155, 251, 174, 115, 17, 10,
-    232, 242, 92, 132, 167, 42, 201, 120, 111, 199, 207, 233, 95, 138, 162, 52, 185, 34, 140, 189, 43, 80, 206, 22, 41,
-    136, 143, 85, 133, 95, 115, 87, 83, 162, 191, 99, 123, 31, 109, 118, 129, 196, 12, 145, 119, 142, 99, 5, 149, 235,
-    134, 122, 83, 83, 168, 162, 250, 51, 145, 77, 42, 67, 223, 125, 46, 144, 117, 115, 88, 212, 245, 7, 157, 104, 157,
-    241, 205, 192, 142, 73, 46, 170, 189, 25, 29, 196, 254, 230, 46, 51, 253, 177, 169, 102, 242, 34, 16, 168, 210, 83,
-    109, 178, 208, 180, 151, 100, 166, 93, 9, 118, 229, 100, 198, 239, 206, 87, 206, 233, 238, 104, 167, 172, 86, 76,
-    83, 255, 243, 98, 137, 54, 238, 151, 62, 46, 215, 84, 205, 28, 86, 177, 119, 7, 153, 34, 249, 181, 124, 115, 208,
-    238, 75, 225, 27, 129, 182, 117, 253, 90, 108, 9, 1, 9, 254, 231, 52, 90, 64, 77, 60, 138, 191, 158, 57, 231, 246,
-    47, 10, 52, 168, 180, 88, 41, 230, 115, 128, 193, 121, 61, 177, 23, 19, 59, 187, 25, 126, 44, 154, 240, 111, 122,
-    206, 68, 56, 30, 3, 60, 210, 121, 214, 164, 207, 170, 106, 142, 170, 12, 8, 182, 167, 252, 35, 36, 241, 179, 2, 36,
-    72, 42, 126, 159, 8, 20, 194, 48, 237, 126, 220, 89, 219, 43, 42, 0, 241, 228, 122, 103, 83, 51, 221, 131, 255, 17,
-    56, 145, 11, 103, 145, 131, 27, 18, 180, 252, 191, 16, 194, 146, 234, 160, 117, 165, 77, 211, 190, 107, 110, 14, 57,
-    49, 102, 54, 31, 112, 131, 148, 193, 192, 255, 121, 75, 120, 115, 15, 55, 104, 49, 236, 99, 207, 40, 228, 106, 95,
-    104, 185, 237, 59, 180, 5, 200, 195, 226, 19, 133, 37, 51, 44, 72, 149, 225, 192, 69, 239, 12, 9, 32, 207, 23, 88,
-    73, 125, 17, 128, 125, 164, 173, 153, 100, 232, 35, 223, 219, 1, 178, 52, 84, 90, 88, 4, 45, 179, 143, 215, 251,
-    253, 53, 109, 184, 87, 84, 249, 120, 243, 82, 45, 78, 163, 177, 4, 246, 26, 44, 64, 4, 242, 162, 49, 154, 162, 26,
-    9, 62, 174, 47, 159, 151, 100, 152, 231, 38, 13, 144, 118, 61, 66, 115, 46, 14, 172, 220, 32, 209, 116, 236, 207,
-    53, 191, 104, 198, 80, 25, 48, 170, 221, 80, 6, 106, 103, 215, 21, 221, 160, 249, 8, 231, 174, 211, 225, 241, 11,
-    101, 42, 186, 208, 177, 155, 210, 28, 169, 84, 216, 207, 240, 10, 67, 30, 129, 111, 160, 151, 18, 147, 212, 140,
-    130, 96, 172, 220, 58, 76, 44, 145, 219, 4, 123, 96, 25, 168, 76, 100, 142, 39, 21, 90, 247, 252, 151, 255, 212,
-    148, 8, 226, 202, 33, 225, 68, 234, 87, 126, 151, 133, 30, 123, 237, 64, 62, 182, 201, 212, 153, 38, 76, 94, 74,
-    209, 163, 62, 221, 53, 192, 22, 5, 134, 163, 218, 52, 214, 94, 234, 197, 195, 212, 72, 7, 104, 105, 44, 16, 115, 7,
-    170, 141, 213, 147, 104, 102, 34, 15, 180, 244, 58, 11, 105, 103, 93, 201, 182, 155, 89, 25, 191, 96, 111, 175, 178,
-    65, 88, 222, 129, 171, 158, 179, 53, 150, 227, 95, 164, 41, 158, 96, 158, 137, 248, 77, 101, 159, 46, 2, 171, 221,
-    177, 134, 158, 75, 105, 192, 130, 126, 111, 164, 13, 166, 114, 143, 199, 186, 177, 0, 96, 250, 208, 97, 155, 118,
-    34, 143, 211, 237, 132, 181, 250, 7, 1, 207, 66, 98, 191, 3, 203, 115, 178, 57, 161, 21, 60, 164, 159, 193, 173,
-    107, 245, 22, 113, 242, 72, 119, 141, 145, 101, 220, 50, 8, 49, 231, 17, 124, 83, 185, 94, 38, 240, 219, 29, 98,
-    133, 18, 148, 18, 119, 131, 7, 237, 231, 103, 162, 241, 19, 32, 191, 252, 58, 107, 99, 20, 54, 75, 81, 41, 174, 201,
-    20, 142, 216, 3, 51, 7, 142, 119, 129, 58, 55, 82, 243, 204, 183, 71, 63, 248, 227, 23, 112, 203, 6, 53, 90, 55, 47,
-    65, 81, 73, 61, 42, 254, 5, 152, 68, 162, 49, 88, 251, 135, 59, 51, 70, 106, 56, 24, 101, 146, 105, 24, 199, 15, 34,
-    113, 168, 233, 238, 190, 40, 24, 67, 23, 137, 239, 162, 9, 11, 217, 90, 103, 255, 62, 158, 13, 206, 224, 89, 212,
-    217, 143, 179, 79, 43, 255, 30, 87, 20, 171, 101, 9, 121, 171, 85, 5, 31, 195, 22, 89, 131, 57, 220, 128, 64, 236,
-    64, 79, 8, 150, 204, 115, 122, 116, 216, 92, 78, 26, 208, 54, 239, 65, 109, 157, 76, 143, 149, 55, 124, 153, 109,
-    167, 18, 189, 116, 181, 178, 89, 28, 49, 118, 252, 215, 117, 55, 11, 56, 65, 195, 63, 100, 19, 172, 236, 91, 120,
-    244, 182, 56, 231, 64, 70, 46, 17, 157, 155, 17, 153, 188, 130, 184, 192, 159, 47, 23, 34, 54, 135, 148, 235, 99,
-    51, 89, 48, 95, 133, 45, 176, 173, 151, 26, 46, 243, 245, 95, 31, 187, 84, 108, 193, 62, 208, 4, 202, 84, 200, 25,
-    118, 225, 99, 76, 4, 241, 28, 172, 6, 45, 49, 164, 210, 119, 167, 253, 246, 193, 127, 70, 240, 250, 81, 49, 89, 14,
-    215, 253, 16, 82, 181, 63, 204, 13, 52, 251, 165, 152, 126, 96, 50, 212, 85, 76, 42, 4, 185, 124, 255, 168, 29, 113,
-    134, 37, 221, 130, 204, 77, 148, 178, 77, 20, 228, 255, 100, 158, 191, 43, 213, 174, 132, 186, 80, 59, 63, 120, 127,
-    172, 11, 147, 117, 172, 91, 18, 104, 123, 20, 243, 108, 207, 250, 255, 41, 152, 222, 78, 237, 105, 105, 11, 21, 210,
-    151, 149, 226, 66, 55, 223, 205, 30, 160, 19, 25, 181, 230, 1, 225, 66, 252, 28, 35, 138, 165, 159, 194, 169, 199,
-    240, 171, 193, 186, 66, 155, 225, 74, 50, 19, 202, 204, 198, 42, 59, 31, 124, 39, 123, 170, 85, 59, 110, 181, 34, 6,
-    67, 77, 63, 17, 114, 206, 188, 64, 122, 14, 88, 14, 239, 209, 214, 192, 195, 75, 207, 93, 36, 16, 103, 184, 214,
-    173, 210, 251, 55, 237, 188, 8, 130, 109, 153, 85, 73, 93, 154, 42, 45, 154, 67, 24, 156, 177, 161, 36, 247, 240,
-    161, 193, 144, 172, 148, 1, 19, 137, 181, 3, 242, 5, 138, 184, 244, 58, 57, 127, 59, 233, 140, 27, 19, 10, 136, 234,
-    208, 181, 166, 86, 117, 139, 150, 159, 15, 30, 149, 181, 69, 16, 127, 184, 130, 38, 173, 4, 47, 3, 3, 145, 185, 56,
-    128, 21, 122, 30, 176, 215, 142, 97, 163, 215, 109, 87, 64, 93, 224, 42, 220, 174, 37, 230, 119, 241, 148, 217, 172,
-    178, 7, 73, 44, 107, 247, 50, 34, 3, 128, 165, 139, 24, 1, 17, 103, 105, 67, 189, 226, 245, 136, 120, 86, 179, 187,
-    130, 7, 111, 150, 101, 120, 165, 14, 95, 230, 232, 21, 15, 165, 82, 85, 187, 48, 199, 116, 229, 108, 219, 235, 250,
-    192, 206, 114, 105, 70, 230, 135, 239, 85, 30, 180, 91, 151, 74, 19, 93, 79, 128, 33, 94, 54, 162, 75, 245, 125, 14,
-    152, 141, 238, 244, 174, 11, 198, 195, 171, 240, 51, 31, 73, 246, 249, 148, 74, 253, 220, 43, 50, 192, 239, 176,
-    226, 190, 142, 96, 106, 125, 191, 61, 223, 199, 226, 233, 142, 179, 26, 205, 158, 129, 108, 88, 151, 111, 226, 137,
-    37, 211, 116, 22, 233, 99, 233, 2, 138, 9, 137, 200, 138, 248, 169, 140, 98, 164, 125, 30, 0, 97, 40, 16, 183, 147,
-    157, 68, 106, 44, 118, 131, 3, 52, 4, 79, 249, 190, 114, 180, 117, 81, 245, 14, 107, 136, 167, 251, 193, 242, 95,
-    24, 138, 8, 142, 195, 44, 192, 2, 5, 55, 146, 142, 89, 251, 178, 36, 28, 123, 51, 177, 175, 92, 221, 229, 103, 145,
-    140, 223, 186, 204, 149, 224, 137, 205, 184, 133, 226, 75, 145, 173, 86, 22, 201, 173, 172, 168, 178, 230, 145, 52,
-    135, 26, 220, 19, 174, 234, 212, 227, 243, 82, 144, 169, 197, 138, 184, 112, 187, 84, 135, 135, 38, 67, 200, 151,
-    227, 8, 206, 129, 51, 244, 17, 187, 69, 108, 251, 70, 132, 173, 150, 80, 90, 165, 0, 134, 170, 117, 84, 145, 124,
-    173, 85, 235, 148, 164, 221, 154, 250, 113, 172, 43, 23, 61, 170, 253, 121, 234, 182, 223, 8, 156, 87, 75, 117, 112,
-    197, 71, 174, 233, 123, 129, 103, 169, 187, 154, 44, 77, 196, 54, 0, 19, 224, 119, 178, 238, 184, 176, 70, 233, 243,
-    217, 161, 28, 238, 51, 190, 38, 127, 230, 200, 59, 54, 82, 112, 120, 154, 76, 172, 91, 165, 83, 238, 68, 143, 106,
-    98, 145, 86, 220, 131, 100, 44, 92, 113, 57, 202, 34, 103, 216, 191, 88, 108, 7, 85, 101, 41, 111, 243, 55, 93, 254,
-    18, 153, 198, 216, 104, 196, 181, 150, 112, 62, 52, 52, 26, 34, 254, 213, 136, 57, 107, 29, 8, 230, 205, 129, 99,
-    79, 46, 222, 184, 0, 117, 69, 235, 27, 240, 100, 42, 44, 188, 84, 181, 13, 242, 29, 230, 246, 139, 225, 201, 155,
-    200, 88, 221, 29, 70, 169, 170, 248, 5, 127, 17, 180, 114, 196, 115, 8, 165, 208, 38, 80, 4, 136, 138, 216, 206,
-    105, 160, 43, 80, 34, 47, 183, 38, 214, 160, 211, 235, 7, 248, 246, 249, 20, 5, 194, 216, 99, 169, 154, 102, 230,
-    162, 187, 166, 248, 66, 170, 42, 247, 178, 239, 234, 166, 135, 227, 141, 204, 46, 206, 162, 32, 111, 186, 232, 189,
-    177, 177, 158, 201, 223, 8, 35, 4, 128, 209, 37, 64, 182, 168, 24, 86, 161, 252, 63, 153, 40, 191, 70, 34, 46, 55,
-    167, 2, 230, 243, 218, 11, 49, 29, 14, 49, 180, 209, 67, 25, 39, 126, 12, 148, 11, 153, 147, 117, 1, 185, 69, 121,
-    208, 151, 108, 7, 103, 220, 244, 133, 142, 73, 45, 145, 37, 238, 49, 105, 195, 151, 165, 40, 203, 170, 188, 116,
-    209, 197, 101, 184, 25, 73, 2, 229, 68, 11, 245, 210, 206, 200, 183, 206, 223, 214, 153, 228, 240, 213, 77, 199,
-    192, 120, 167, 0, 36, 112, 123, 166, 114, 155, 140, 197, 72, 209, 152, 136, 196, 127, 219, 16, 224, 82, 234, 69,
-    192, 92, 243, 26, 23, 171, 85, 198, 162, 205, 8, 161, 247, 12, 131, 238, 47, 145, 210, 106, 142, 232, 73, 249, 209,
-    22, 177, 211, 237, 122, 237, 201, 67, 74, 32, 80, 181, 158, 193, 141, 120, 81, 252, 183, 138, 202, 3, 150, 247, 247,
-    139, 174, 78, 198, 226, 220, 179, 172, 49, 114, 189, 136, 177, 238, 37, 220, 195, 179, 98, 238, 209, 251, 166, 57,
-    62, 140, 244, 52, 164, 24, 118, 95, 200, 174, 63, 220, 91, 144, 123, 210, 38, 125, 23, 66, 34, 158, 25, 0, 230, 225,
-    66, 174, 12, 128, 66, 217, 158, 77, 223, 203, 140, 153, 188, 205, 9, 139, 236, 229, 162, 251, 95, 167, 5, 217, 203,
-    1, 110, 242, 62, 255, 132, 59, 12, 77, 73, 89, 76, 151, 186, 117, 138, 157, 123, 129, 127, 246, 66, 246, 89, 192,
-    52, 3, 193, 189, 95, 196, 166, 245, 71, 29, 128, 52, 41, 254, 7, 185, 202, 42, 37, 89, 221, 48, 212, 26, 197, 133,
-    107, 1, 227, 119, 36, 55, 156, 156, 79, 83, 110, 113, 240, 39, 67, 69, 140, 177, 168, 130, 60, 46, 14, 4, 163, 185,
-    202, 1, 249, 29, 56, 4, 114, 150, 233, 76, 36, 50, 184, 224, 177, 238, 9, 104, 54, 219, 175, 5, 134, 2, 102, 52,
-    192, 70, 61, 206, 55, 127, 44, 106, 135, 39, 76, 232, 242, 254, 220, 172, 98, 181, 100, 134, 172, 141, 143, 65, 143,
-    22, 138, 114, 83, 66, 233, 89, 202, 146, 251, 52, 101, 206, 225, 240, 50, 191, 121, 55, 52, 58, 198, 252, 89, 98,
-    176, 175, 216, 241, 212, 237, 75, 104, 131, 228, 38, 76, 193, 167, 98, 82, 9, 77, 174, 200, 10, 52, 138, 212, 184,
-    140, 102, 154, 180, 49, 204, 118, 228, 68, 43, 155, 109, 139, 209, 139, 218, 214, 65, 180, 218, 71, 5, 111, 169, 38,
-    10, 208, 28, 126, 207, 221, 32, 180, 176, 207, 186, 165, 68, 131, 24, 154, 62, 17, 191, 254, 209, 14, 221, 67, 106,
-    24, 238, 153, 150, 155, 114, 169, 132, 167, 205, 0, 109, 75, 0, 245, 173, 232, 36, 188, 66, 250, 242, 213, 199, 192,
-    223, 238, 165, 88, 119, 57, 135, 11, 150, 178, 153, 189, 249, 50, 192, 109, 244, 214, 58, 214, 21, 83, 180, 3, 116,
-    90, 255, 44, 245, 142, 18, 255, 203, 27, 145, 125, 227, 196, 219, 62, 60, 30, 95, 56, 241, 191, 30, 63, 60, 11, 131,
-    146, 149, 136, 21, 83, 198, 156, 69, 183, 13, 170, 147, 191, 121, 3, 181, 86, 41, 164, 217, 148, 220, 207, 5, 194,
-    147, 147, 95, 58, 189, 127, 147, 124, 108, 14, 73, 80, 207, 80, 251, 113, 66, 111, 78, 49, 135, 195, 152, 248, 7,
-    191, 108, 21, 71, 49, 31, 173, 12, 58, 173, 24, 202, 166, 221, 131, 97, 253, 73, 84, 118, 210, 53, 242, 178, 226,
-    247, 182, 26, 252, 85, 186, 95, 158, 59, 215, 41, 172, 179, 205, 143, 0, 231, 77, 10, 182, 158, 14, 40, 210, 82,
-    117, 106, 217, 69, 120, 131, 60, 63, 107, 232, 114, 66, 253, 85, 45, 111, 218, 2, 103, 68, 232, 21, 202, 182, 253,
-    153, 51, 212, 199, 102, 80, 124, 16, 31, 15, 108, 20, 116, 72, 118, 59, 75, 233, 215, 158, 48, 219, 56, 131, 20, 78,
-    138, 43, 148, 135, 108, 246, 122, 164, 45, 99, 151, 214, 31, 0, 72, 12, 178, 42, 237, 133, 175, 22, 149, 58, 222,
-    163, 37, 168, 84, 156, 81, 109, 8, 205, 145, 18, 251, 132, 231, 43, 188, 236, 151, 99, 215, 208, 111, 64, 39, 69,
-    90, 226, 3, 172, 61, 100, 38, 59, 135, 111, 7, 221, 66, 120, 131, 114, 86, 186, 39, 161, 84, 133, 64, 149, 163, 176,
-    65, 249, 220, 48, 174, 134, 19, 206, 152, 55, 63, 126, 172, 143, 24, 54, 8, 92, 190, 143, 201, 169, 77, 50, 51, 0,
-    201, 120, 178, 254, 0, 7, 33, 138, 176, 108, 113, 89, 181, 219, 187, 104, 124, 25, 245, 215, 232, 83, 167, 110, 241,
-    7, 211, 32, 219, 120, 234, 61, 194, 246, 136, 55, 52, 28, 115, 107, 55, 244, 62, 14, 225, 62, 1, 199, 18, 49, 121,
-    168, 118, 236, 144, 249, 37, 168, 9, 212, 218, 29, 246, 93, 56, 10, 101, 223, 146, 190, 154, 47, 17, 123, 150, 234,
-    46, 205, 250, 74, 219, 201, 161, 226, 119, 138, 7, 146, 55, 132, 139, 5, 102, 26, 133, 37, 198, 92, 161, 75, 117,
-    102, 150, 99, 122, 240, 251, 180, 172, 58, 13, 103, 12, 25, 250, 67, 89, 101, 232, 131, 212, 20, 33, 16, 0, 210,
-    111, 194, 34, 164, 103, 173, 186, 209, 46, 42, 47, 226, 214, 140, 197, 246, 109, 150, 79, 56, 100, 116, 23, 54, 169,
-    138, 238, 204, 102, 112, 134, 242, 235, 189, 178, 15, 31, 110, 215, 205, 78, 84, 194, 199, 109, 150, 255, 90, 243,
-    217, 241, 246, 14, 156, 20, 92, 198, 157, 148, 14, 189, 159, 139, 211, 17, 139, 159, 151, 197, 248, 218, 12, 67, 98,
-    58, 75, 248, 208, 65, 45, 112, 44, 236, 136, 172, 128, 104, 240, 39, 32, 192, 130, 212, 194, 236, 187, 55, 121, 90,
-    64, 174, 60, 32, 54, 242, 46, 227, 135, 62, 3, 40, 78, 255, 108, 7, 86, 55, 233, 197, 51, 66, 162, 128, 120, 73,
-    238, 11, 150, 164, 70, 195, 229, 182, 33, 3, 200, 7, 186, 119, 248, 131, 2, 216, 2, 111, 111, 134, 237, 235, 118,
-    26, 61, 117, 251, 123, 164, 89, 147, 181, 66, 6, 202, 25, 86, 128, 84, 232, 2, 5, 240, 196, 130, 150, 47, 200, 151,
-    128, 12, 14, 57, 173, 141, 16, 229, 150, 99, 191, 169, 201, 45, 230, 73, 61, 110, 44, 182, 245, 154, 231, 187, 38,
-    134, 24, 236, 85, 113, 153, 35, 240, 90, 32, 39, 131, 181, 202, 234, 36, 84, 232, 151, 19, 234, 236, 170, 146, 229,
-    88, 79, 124, 119, 142, 2, 142, 218, 57, 23, 130, 66, 121, 165, 209, 229, 173, 191, 221, 228, 147, 22, 41, 54, 103,
-    122, 17, 90, 90, 24, 73, 1, 204, 63, 142, 155, 19, 169, 13, 20, 48, 43, 247, 184, 56, 142, 175, 205, 43, 209, 117,
-    7, 14, 205, 22, 165, 87, 97, 205, 249, 133, 195, 181, 54, 171, 142, 241, 220, 250, 231, 124, 92, 227, 47, 102, 49,
-    60, 154, 157, 43, 44, 255, 97, 60, 220, 55, 82, 86, 32, 47, 87, 132, 88, 89, 17, 116, 72, 87, 118, 141, 14, 129,
-    149, 167, 117, 140, 46, 219, 95, 215, 190, 137, 25, 75, 181, 168, 238, 249, 229, 100, 38, 48, 143, 70, 248, 103,
-    104, 90, 183, 190, 37, 182, 221, 4, 86, 15, 18, 116, 13, 113, 14, 231, 75, 153, 182, 229, 39, 164, 74, 48, 74, 66,
-    87, 248, 230, 139, 243, 100, 64, 204, 0, 61, 72, 47, 150, 114, 189, 212, 9, 33, 163, 232, 234, 95, 59, 20, 220, 152,
-    190, 152, 2, 61, 113, 78, 143, 238, 46, 126, 90, 17, 48, 116, 82, 204, 104, 90, 235, 234, 215, 156, 247, 8, 14, 168,
-    81, 230, 142, 196, 255, 20, 208, 38, 57, 198, 65, 136, 7, 197, 92, 75, 5, 6, 215, 214, 79, 232, 134, 116, 39, 120,
-    74, 54, 98, 85, 157, 230, 48, 11, 44, 186, 61, 103, 174, 72, 250, 16, 253, 207, 178, 118, 221, 31, 252, 60, 251,
-    198, 40, 183, 209, 254, 6, 82, 236, 252, 108, 83, 120, 6, 132, 14, 104, 109, 149, 162, 57, 63, 255, 29, 5, 142, 166,
-    212, 213, 3, 233, 51, 101, 100, 238, 86, 192, 90, 8, 38, 73, 11, 186, 74, 28, 151, 168, 216, 69, 34, 153, 222, 59,
-    83, 22, 161, 86, 64, 76, 109, 46, 254, 22, 165, 68, 176, 30, 102, 165, 70, 161, 24, 199, 148, 135, 29, 59, 54, 179,
-    111, 52, 58, 175, 3, 143, 65, 75, 162, 90, 134, 168, 142, 198, 221, 7, 100, 107, 48, 79, 77, 218, 149, 183, 227,
-    246, 101, 175, 1, 158, 113, 38, 134, 34, 198, 175, 86, 88, 70, 208, 132, 30, 124, 49, 255, 105, 255, 41, 97, 245,
-    161, 25, 168, 61, 177, 143, 124, 108, 232, 209, 65, 3, 202, 181, 107, 57, 144, 255, 246, 89, 96, 129, 23, 53, 151,
-    62, 80, 159, 96, 21, 100, 146, 194, 70, 88, 219, 227, 246, 186, 112, 193, 70, 196, 61, 154, 58, 59, 192, 79, 223,
-    55, 193, 78, 92, 253, 162, 84, 150, 18, 49, 91, 89, 103, 85, 247, 85, 34, 29, 209, 139, 55, 146, 72, 98, 2, 138,
-    165, 225, 204, 156, 116, 14, 5, 183, 7, 215, 149, 97, 48, 33, 2, 188, 139, 61, 223, 179, 206, 223, 84, 148, 158,
-    190, 237, 6, 140, 206, 252, 58, 27, 227, 79, 238, 236, 176, 236, 75, 47, 188, 11, 247, 228, 58, 228, 208, 42, 246,
-    230, 146, 42, 7, 68, 236, 0, 254, 63, 175, 43, 44, 228, 210, 132, 232, 110, 20, 136, 152, 31, 160, 81, 84, 36, 131,
-    109, 226, 96, 190, 25, 228, 87, 46, 108, 228, 198, 205, 218, 101, 10, 221, 204, 187, 194, 154, 173, 6, 223, 86, 211,
-    250, 66, 213, 174, 80, 13, 172, 181, 181, 169, 16, 86, 114, 75, 25, 176, 228, 105, 97, 64, 176, 49, 133, 240, 35,
-    171, 33, 249, 143, 76, 78, 80, 101, 221, 21, 63, 44, 147, 101, 226, 30, 162, 160, 179, 244, 139, 190, 30, 26, 63,
-    163, 48, 120, 162, 255, 245, 107, 216, 227, 5, 72, 244, 184, 103, 136, 247, 81, 41, 2, 128, 91, 129, 21, 29, 186,
-    239, 125, 16, 30, 127, 87, 82, 36, 26, 246, 208, 19, 96, 24, 64, 22, 164, 4, 66, 112, 156, 130, 105, 228, 246, 213,
-    56, 216, 194, 66, 209, 228, 242, 47, 87, 246, 253, 49, 128, 23, 35, 186, 220, 7, 125, 146, 98, 42, 42, 109, 167, 21,
-    240, 48, 107, 155, 241, 217, 63, 214, 214, 3, 133, 108, 82, 86, 25, 17, 17, 87, 136, 53, 116, 95, 252, 215, 30, 121,
-    231, 173, 225, 135, 25, 113, 122, 180, 92, 28, 207, 70, 191, 193, 66, 195, 211, 224, 33, 69, 26, 131, 40, 119, 152,
-    79, 145, 110, 8, 88, 129, 175, 222, 219, 68, 31, 166, 33, 222, 114, 164, 61, 16, 62, 134, 140, 189, 160, 139, 24,
-    12, 187, 9, 173, 240, 236, 68, 121, 218, 22, 177, 126, 25, 29, 182, 14, 70, 145, 93, 191, 143, 215, 2, 114, 121,
-    140, 58, 202, 116, 78, 148, 38, 52, 8, 175, 9, 44, 149, 25, 245, 108, 231, 31, 97, 32, 53, 135, 67, 214, 225, 254,
-    143, 244, 93, 94, 194, 23, 200, 87, 94, 65, 93, 165, 226, 166, 70, 194, 7, 174, 32, 205, 14, 96, 121, 144, 117, 251,
-    194, 181, 90, 150, 162, 252, 143, 235, 250, 105, 181, 164, 17, 213, 16, 23, 37, 58, 194, 188, 91, 217, 25, 168, 210,
-    237, 114, 207, 28, 106, 250, 179, 223, 200, 198, 174, 18, 123, 87, 55, 231, 135, 82, 246, 132, 57, 105, 150, 241,
-    15, 210, 38, 77, 53, 18, 86, 245, 132, 87, 38, 23, 222, 122, 197, 107, 140, 68, 250, 64, 86, 208, 225, 62, 35, 47,
-    61, 99, 27, 88, 3, 104, 73, 126, 101, 175, 251, 157, 88, 159, 41, 238, 69, 100, 41, 52, 215, 249, 23, 132, 73, 66,
-    15, 42, 179, 232, 194, 88, 209, 75, 72, 77, 117, 243, 54, 158, 198, 43, 160, 239, 72, 61, 190, 49, 254, 166, 157,
-    251, 91, 214, 239, 176, 74, 36, 169, 238, 126, 113, 194, 164, 30, 14, 192, 31, 174, 28, 90, 230, 60, 125, 220, 93,
-    207, 93, 135, 101, 66, 1, 195, 247, 193, 44, 175, 11, 31, 168, 222, 6, 148, 210, 223, 222, 172, 81, 55, 230, 178,
-    51, 143, 215, 153, 41, 169, 231, 159, 145, 41, 226, 233, 174, 31, 119, 233, 25, 74, 56, 97, 205, 12, 107, 150, 150,
-    73, 14, 59, 251, 218, 63, 199, 3, 52, 146, 161, 98, 242, 17, 136, 201, 84, 59, 226, 46, 217, 125, 140, 63, 50, 151,
-    250, 112, 93, 190, 209, 49, 19, 239, 135, 126, 60, 206, 219, 238, 42, 41, 123, 200, 213, 218, 204, 25, 144, 164,
-    140, 100, 33, 26, 53, 159, 98, 128, 176, 179, 189, 130, 181, 111, 203, 33, 136, 46, 122, 91, 106, 151, 245, 193,
-    151, 163, 150, 249, 93, 83, 52, 65, 142, 200, 224, 48, 34, 167, 29, 113, 246, 208, 86, 58, 125, 218, 4, 16, 170,
-    227, 58, 23, 30, 5, 142, 32, 48, 202, 50, 16, 105, 25, 90, 114, 183, 4, 145, 140, 192, 222, 105, 171, 195, 75, 230,
-    56, 201, 114, 176, 101, 176, 57, 196, 68, 136, 48, 254, 172, 144, 40, 55, 166, 58, 167, 111, 177, 154, 152, 57, 46,
-    121, 41, 84, 228, 93, 178, 160, 115, 217, 132, 143, 238, 61, 145, 57, 115, 192, 215, 128, 130, 20, 218, 35, 101, 56,
-    123, 229, 112, 145, 59, 37, 231, 17, 40, 64, 200, 208, 99, 92, 88, 65, 192, 61, 74, 162, 148, 231, 191, 223, 135,
-    110, 226, 112, 161, 4, 66, 202, 2, 241, 127, 81, 33, 59, 116, 129, 15, 170, 101, 23, 209, 126, 145, 253, 82, 125,
-    90, 199, 201, 252, 235, 143, 64, 55, 139, 177, 224, 8, 220, 121, 60, 24, 113, 33, 146, 87, 217, 244, 240, 8, 211,
-    120, 1, 85, 121, 78, 180, 22, 196, 29, 23, 98, 11, 221, 174, 252, 111, 130, 206, 234, 168, 159, 103, 64, 205, 208,
-    4, 251, 116, 12, 7, 242, 140, 126, 119, 248, 175, 49, 24, 183, 238, 210, 113, 168, 132, 193, 30, 204, 173, 150, 136,
-    104, 135, 196, 152, 187, 94, 49, 156, 204, 236, 137, 145, 229, 96, 24, 118, 213, 120, 134, 237, 188, 221, 223, 176,
-    134, 47, 152, 31, 156, 213, 123, 99, 200, 112, 195, 108, 167, 227, 194, 249, 250, 79, 78, 251, 97, 164, 239, 141,
-    177, 214, 174, 152, 29, 84, 99, 56, 24, 65, 14, 188, 3, 213, 9, 149, 89, 210, 157, 153, 33, 166, 218, 162, 17, 162,
-    104, 21, 183, 186, 221, 97, 209, 52, 221, 31, 69, 137, 229, 111, 45, 106, 125, 156, 59, 228, 112, 162, 117, 101,
-    223, 105, 208, 254, 65, 240, 209, 231, 197, 188, 4, 98, 26, 89, 104, 74, 104, 216, 216, 177, 174, 30, 33, 190, 43,
-    70, 197, 65, 113, 54, 243, 35, 24, 101, 137, 28, 235, 241, 219, 224, 49, 245, 240, 28, 59, 154, 7, 87, 160, 66, 185,
-    40, 69, 231, 247, 99, 214, 159, 57, 34, 123, 235, 216, 87, 78, 252, 197, 173, 201, 127, 57, 161, 139, 119, 231, 195,
-    141, 235, 103, 30, 80, 139, 195, 106, 254, 177, 167, 114, 134, 131, 68, 112, 53, 94, 95, 139, 129, 216, 197, 43,
-    101, 199, 56, 18, 236, 138, 175, 214, 152, 20, 234, 54, 135, 104, 164, 158, 173, 68, 83, 174, 118, 199, 138, 200,
-    52, 219, 147, 155, 49, 100, 251, 177, 15, 64, 67, 0, 130, 100, 168, 166, 67, 121, 249, 45, 219, 203, 124, 43, 167,
-    202, 104, 167, 22, 234, 55, 178, 84, 216, 16, 7, 80, 62, 55, 105, 44, 185, 38, 79, 190, 15, 235, 154, 79, 188, 50,
-    55, 230, 36, 174, 249, 16, 38, 153, 123, 194, 52, 38, 248, 239, 211, 180, 94, 46, 24, 252, 163, 168, 94, 239, 177,
-    117, 33, 23, 212, 250, 86, 6, 46, 162, 82, 64, 76, 132, 15, 129, 103, 200, 208, 195, 121, 220, 166, 19, 146, 136, 2,
-    235, 105, 195, 41, 232, 74, 1, 208, 207, 181, 54, 160, 77, 38, 88, 174, 102, 223, 207, 196, 87, 143, 171, 248, 224,
-    156, 73, 216, 135, 212, 102, 252, 19, 157, 203, 14, 193, 28, 150, 78, 89, 13, 245, 102, 77, 183, 124, 152, 214, 209,
-    115, 224, 142, 145, 195, 156, 77, 223, 141, 23, 164, 46, 225, 204, 62, 44, 23, 9, 158, 13, 115, 187, 192, 144, 177,
-    28, 231, 117, 68, 177, 187, 52, 192, 147, 103, 185, 235, 193, 228, 35, 169, 104, 81, 154, 196, 118, 231, 232, 85,
-    249, 79, 81, 180, 81, 243, 14, 179, 18, 98, 38, 204, 140, 64, 51, 136, 6, 122, 220, 67, 25, 7, 75, 97, 21, 41, 110,
-    53, 42, 133, 246, 66, 87, 91, 218, 187, 90, 189, 81, 108, 99, 223, 38, 119, 219, 119, 154, 99, 234, 56, 229, 164,
-    216, 40, 166, 162, 200, 174, 177, 191, 198, 67, 87, 242, 167, 106, 47, 39, 131, 4, 150, 2, 14, 207, 165, 15, 247,
-    48, 205, 6, 59, 65, 152, 232, 139, 186, 88, 66, 102, 84, 249, 199, 4, 206, 159, 125, 144, 153, 98, 119, 72, 153,
-    189, 41, 178, 140, 195, 253, 243, 126, 118, 229, 31, 191, 43, 245, 181, 43, 101, 90, 5, 23, 82, 178, 11, 2, 234, 21,
-    225, 123, 59, 66, 111, 129, 106, 9, 24, 232, 205, 191, 88, 113, 234, 38, 0, 96, 99, 165, 70, 239, 198, 249, 66, 30,
-    126, 234, 213, 105, 145, 86, 139, 231, 243, 206, 202, 108, 197, 96, 218, 235, 0, 193, 233, 64, 111, 208, 183, 231,
-    120, 51, 187, 70, 107, 147, 179, 13, 252, 4, 97, 206, 224, 28, 195, 40, 157, 165, 181, 106, 87, 230, 13, 244, 47,
-    221, 158, 105, 82, 250, 193, 166, 143, 85, 12, 252, 172, 0, 241, 82, 188, 153, 20, 47, 191, 157, 122, 99, 178, 75,
-    140, 210, 210, 88, 75, 26, 219, 246, 16, 190, 237, 214, 58, 111, 167, 222, 150, 93, 143, 30, 255, 242, 164, 53, 100,
-    98, 89, 238, 138, 20, 208, 17, 178, 88, 40, 74, 113, 200, 230, 142, 79, 145, 55, 253, 50, 50, 63, 155, 97, 157, 193,
-    52, 223, 176, 185, 187, 183, 17, 60, 114, 81, 229, 87, 120, 127, 16, 253, 137, 246, 87, 253, 234, 162, 110, 8, 82,
-    182, 93, 120, 36, 157, 135, 181, 203, 149, 148, 143, 19, 34, 236, 23, 57, 203, 156, 143, 133, 135, 226, 200, 79, 70,
-    186, 203, 51, 54, 34, 235, 107, 203, 204, 184, 165, 112, 41, 20, 82, 113, 124, 164, 62, 40, 69, 103, 100, 192, 98,
-    29, 231, 96, 182, 215, 39, 223, 236, 189, 197, 244, 185, 162, 166, 159, 34, 28, 87, 255, 109, 107, 155, 28, 162,
-    161, 248, 198, 48, 65, 139, 100, 48, 87, 50, 245, 208, 125, 31, 180, 69, 33, 134, 255, 6, 60, 96, 149, 65, 79, 86,
-    119, 182, 167, 147, 247, 205, 243, 209, 58, 249, 214, 114, 123, 48, 122, 9, 120, 248, 76, 183, 74, 43, 165, 249, 23,
-    163, 14, 241, 118, 168, 110, 122, 125, 99, 28, 142, 125, 153, 195, 36, 204, 249, 241, 69, 181, 184, 102, 32, 33,
-    151, 87, 29, 12, 241, 76, 221, 224, 51, 10, 244, 183, 4, 230, 253, 210, 1, 245, 65, 111, 44, 169, 46, 46, 21, 79,
-    151, 138, 249, 1, 248, 43, 115, 40, 8, 70, 179, 100, 246, 61, 187, 141, 38, 80, 91, 73, 22, 9, 158, 104, 53, 240,
-    125, 218, 148, 104, 123, 208, 220, 25, 83, 203, 134, 28, 219, 140, 250, 10, 122, 172, 189, 109, 91, 139, 104, 243,
-    38, 129, 113, 66, 83, 136, 146, 169, 180, 249, 153, 62, 138, 97, 130, 37, 113, 7, 190, 98, 92, 226, 51, 102, 138,
-    38, 96, 84, 116, 72, 148, 173, 1, 98, 197, 172, 108, 241, 253, 156, 224, 21, 34, 205, 93, 118, 112, 105, 133, 173,
-    166, 247, 11, 45, 46, 108, 18, 194, 29, 47, 136, 136, 13, 93, 88, 47, 53, 125, 235, 11, 95, 221, 215, 2, 176, 167,
-    71, 73, 136, 120, 162, 93, 205, 83, 149, 88, 49, 208, 179, 42, 248, 157, 38, 135, 211, 165, 75, 58, 181, 157, 249,
-    120, 122, 165, 55, 32, 64, 33, 224, 188, 14, 166, 57, 134, 138, 176, 236, 43, 249, 13, 169, 56, 118, 192, 25, 230,
-    252, 10, 117, 128, 119, 6, 31, 151, 213, 118, 230, 207, 253, 109, 74, 190, 144, 168, 140, 112, 169, 248, 157, 124,
-    141, 231, 199, 81, 108, 46, 139, 181, 9, 144, 8, 25, 89, 160, 36, 61, 148, 104, 246, 125, 10, 160, 40, 33, 82, 76,
-    168, 112, 37, 182, 43, 94, 62, 255, 94, 242, 222, 66, 102, 160, 37, 148, 47, 198, 218, 0, 13, 43, 28, 160, 218, 53,
-    133, 246, 42, 61, 221, 243, 159, 130, 197, 67, 54, 148, 83, 48, 88, 173, 84, 185, 87, 42, 230, 29, 117, 120, 35,
-    211, 155, 149, 45, 69, 22, 70, 32, 209, 240, 156, 247, 198, 195, 92, 250, 216, 46, 9, 126, 76, 19, 183, 212, 126,
-    205, 107, 61, 83, 126, 161, 242, 21, 241, 154, 164, 32, 225, 198, 193, 163, 155, 204, 249, 164, 225, 13, 36, 19, 40,
-    7, 34, 134, 213, 30, 198, 229, 26, 165, 185, 175, 5, 148, 26, 60, 201, 128, 124, 21, 39, 43, 199, 154, 30, 115, 179,
-    96, 135, 157, 67, 128, 242, 36, 36, 45, 67, 153, 252, 50, 130, 180, 187, 117, 136, 165, 41, 76, 3, 170, 68, 155,
-    121, 24, 242, 134, 210, 49, 249, 222, 90, 167, 166, 67, 173, 74, 94, 224, 109, 250, 163, 230, 176, 6, 207, 56, 199,
-    185, 58, 236, 44, 158, 109, 218, 105, 248, 99, 238, 36, 99, 105, 212, 102, 184, 147, 46, 110, 255, 100, 67, 80, 90,
-    139, 140, 162, 243, 61, 146, 211, 19, 64, 194, 121, 241, 61, 76, 175, 150, 213, 34, 32, 5, 111, 0, 146, 28, 130, 17,
-    4, 158, 107, 117, 242, 172, 1, 252, 42, 193, 8, 47, 112, 185, 164, 90, 135, 147, 80, 174, 185, 20, 54, 178, 225,
-    208, 142, 198, 44, 41, 104, 251, 107, 34, 38, 17, 91, 138, 218, 222, 100, 38, 150, 109, 92, 2, 191, 87, 28, 118,
-    186, 112, 162, 204, 205, 221, 178, 66, 1, 9, 72, 13, 109, 77, 231, 87, 195, 68, 215, 181, 56, 69, 159, 216, 155, 93,
-    8, 118, 140, 250, 179, 78, 165, 89, 228, 92, 153, 20, 47, 202, 144, 60, 143, 59, 196, 212, 94, 30, 105, 35, 252,
-    136, 23, 212, 192, 50, 177, 232, 21, 175, 39, 220, 87, 147, 34, 234, 229, 79, 174, 75, 111, 211, 88, 8, 39, 160, 27,
-    51, 132, 70, 201, 36, 142, 42, 76, 238, 44, 97, 79, 158, 47, 122, 166, 98, 142, 248, 60, 97, 167, 212, 237, 95, 48,
-    181, 36, 248, 93, 143, 169, 56, 161, 226, 84, 53, 95, 11, 255, 112, 183, 185, 120, 11, 44, 66, 198, 137, 235, 90,
-    239, 34, 243, 236, 157, 102, 35, 61, 11, 253, 222, 37, 253, 15, 251, 189, 123, 17, 74, 8, 190, 58, 146, 103, 136,
-    102, 184, 83, 72, 201, 234, 119, 37, 188, 24, 234, 219, 26, 184, 169, 121, 86, 248, 45, 31, 172, 122, 85, 252, 80,
-    7, 249, 191, 202, 251, 142, 79, 146, 82, 17, 118, 129, 12, 142, 99, 207, 29, 81, 44, 231, 64, 26, 0, 253, 153, 40,
-    102, 174, 196, 196, 130, 218, 15, 123, 65, 135, 116, 212, 229, 208, 154, 180, 178, 193, 53, 141, 71, 138, 138, 234,
-    184, 119, 130, 33, 110, 232, 222, 54, 160, 131, 213, 6, 189, 123, 46, 128, 139, 251, 135, 171, 79, 137, 205, 150,
-    91, 245, 107, 96, 67, 119, 252, 171, 115, 68, 115, 172, 247, 141, 82, 205, 159, 126, 120, 141, 187, 188, 29, 22, 4,
-    141, 59, 217, 74, 196, 92, 195, 89, 69, 84, 19, 27, 208, 102, 240, 121, 47, 245, 144, 226, 206, 94, 221, 76, 59,
-    100, 52, 25, 204, 31, 108, 128, 12, 176, 218, 0, 225, 5, 205, 186, 102, 17, 214, 194, 244, 97, 20, 14, 124, 107,
-    202, 128, 99, 252, 155, 82, 169, 26, 70, 116, 169, 44, 164, 103, 120, 225, 48, 42, 89, 109, 61, 239, 119, 55, 167,
-    65, 239, 49, 180, 120, 69, 248, 62, 178, 16, 48, 53, 78, 179, 106, 44, 20, 191, 160, 82, 27, 224, 184, 88, 178, 251,
-    12, 46, 156, 105, 250, 38, 222, 155, 30, 143, 183, 45, 135, 224, 46, 175, 57, 52, 70, 181, 65, 185, 177, 32, 161,
-    65, 245, 152, 192, 248, 33, 2, 66, 26, 163, 112, 65, 63, 131, 31, 193, 0, 39, 142, 237, 2, 125, 119, 159, 81, 62,
-    174, 125, 199, 238, 124, 5, 135, 66, 34, 65, 143, 245, 181, 58, 226, 238, 152, 169, 210, 136, 123, 133, 80, 212, 28,
-    182, 174, 10, 34, 242, 116, 235, 159, 59, 9, 31, 203, 153, 177, 89, 121, 14, 94, 234, 127, 128, 102, 49, 130, 171,
-    93, 166, 194, 212, 82, 200, 254, 214, 182, 33, 92, 19, 95, 214, 199, 252, 126, 86, 172, 104, 97, 212, 204, 115, 109,
-    94, 142, 188, 62, 252, 236, 221, 67, 139, 255, 15, 195, 9, 250, 226, 45, 111, 207, 53, 244, 146, 182, 84, 25, 206,
-    75, 220, 62, 1, 98, 22, 199, 151, 173, 253, 207, 192, 25, 172, 118, 193, 225, 193, 181, 177, 74, 127, 100, 119, 226,
-    56, 173, 69, 118, 1, 124, 65, 28, 131, 80, 134, 34, 255, 62, 74, 78, 221, 96, 25, 160, 82, 92, 241, 157, 3, 89, 247,
-    65, 17, 209, 161, 195, 234, 241, 14, 1, 228, 146, 194, 253, 201, 183, 129, 138, 127, 0, 1, 70, 191, 210, 35, 5, 250,
-    68, 227, 13, 80, 5, 159, 177, 15, 37, 211, 151, 85, 42, 20, 178, 245, 23, 117, 85, 99, 207, 34, 75, 123, 186, 77,
-    191, 188, 45, 193, 101, 221, 255, 29, 218, 224, 93, 72, 138, 102, 20, 113, 94, 29, 15, 157, 113, 86, 70, 151, 145,
-    172, 185, 123, 118, 22, 239, 109, 247, 41, 97, 100, 242, 168, 14, 62, 64, 120, 80, 50, 249, 39, 217, 165, 143, 35,
-    51, 56, 74, 130, 160, 213, 53, 239, 9, 158, 2, 149, 118, 244, 175, 33, 139, 161, 37, 195, 154, 18, 2, 170, 223, 4,
-    69, 42, 15, 140, 232, 110, 39, 95, 165, 240, 241, 173, 255, 20, 105, 37, 108, 11, 33, 17, 180, 192, 254, 59, 235,
-    169, 168, 98, 101, 37, 136, 144, 30, 119, 135, 202, 47, 131, 113, 8, 151, 22, 68, 28, 71, 87, 110, 250, 167, 72,
-    139, 171, 255, 17, 79, 78, 25, 72, 132, 37, 188, 227, 25, 237, 235, 236, 233, 247, 37, 145, 173, 198, 238, 162, 163,
-    188, 249, 158, 204, 143, 176, 95, 61, 12, 5, 49, 252, 203, 39, 221, 85, 28, 101, 43, 29, 199, 43, 75, 129, 7, 242,
-    151, 127, 48, 59, 135, 29, 122, 120, 206, 243, 218, 117, 28, 175, 71, 146, 226, 30, 104, 134, 7, 149, 61, 149, 65,
-    5, 167, 116, 7, 173, 181, 129, 30, 244, 12, 183, 195, 220, 8, 38, 224, 37, 29, 58, 98, 194, 214, 204, 111, 150, 3,
-    199, 254, 4, 29, 194, 47, 89, 167, 154, 242, 230, 213, 180, 69, 52, 195, 3, 0, 251, 189, 74, 95, 66, 230, 209, 6,
-    63, 185, 7, 91, 240, 137, 187, 18, 66, 49, 121, 210, 236, 197, 60, 162, 207, 153, 123, 61, 160, 244, 246, 146, 43,
-    137, 199, 161, 112, 205, 62, 67, 221, 247, 133, 186, 104, 141, 251, 206, 224, 142, 0, 189, 166, 105, 202, 178, 30,
-    139, 205, 166, 185, 29, 30, 140, 93, 133, 63, 100, 173, 71, 222, 108, 118, 123, 168, 210, 109, 146, 129, 20, 58,
-    159, 116, 119, 36, 8, 93, 28, 90, 190, 146, 88, 65, 74, 129, 169, 251, 213, 110, 158, 160, 169, 33, 207, 70, 125,
-    84, 165, 65, 127, 177, 247, 191, 230, 217, 120, 160, 198, 51, 186, 222, 151, 50, 219, 187, 206, 153, 78, 2, 172, 55,
-    248, 164, 82, 92, 20, 238, 27, 210, 211, 40, 5, 48, 89, 144, 167, 33, 199, 254, 117, 103, 158, 27, 223, 207, 64, 4,
-    42, 130, 1, 83, 188, 98, 139, 37, 202, 155, 31, 103, 7, 112, 208, 25, 27, 124, 170, 125, 6, 132, 67, 155, 181, 94,
-    13, 70, 179, 193, 9, 95, 51, 154, 79, 27, 95, 49, 238, 123, 213, 218, 182, 45, 134, 205, 187, 61, 106, 174, 77, 76,
-    109, 70, 123, 87, 8, 108, 131, 8, 172, 198, 16, 67, 110, 238, 237, 226, 8, 121, 115, 63, 196, 188, 223, 51, 180, 87,
-    146, 121, 141, 80, 119, 19, 237, 164, 231, 33, 167, 165, 243, 15, 232, 220, 217, 242, 52, 173, 40, 11, 14, 229, 14,
-    210, 242, 212, 69, 212, 110, 113, 53, 137, 44, 126, 27, 176, 14, 70, 83, 97, 246, 44, 112, 6, 132, 186, 128, 226,
-    153, 152, 10, 94, 230, 213, 152, 133, 157, 140, 77, 175, 109, 144, 57, 52, 147, 31, 203, 190, 92, 125, 82, 236, 118,
-    25, 243, 167, 99, 132, 240, 141, 100, 198, 152, 92, 128, 27, 106, 125, 222, 167, 236, 21, 190, 141, 247, 46, 132,
-    105, 164, 228, 168, 69, 90, 62, 217, 229, 226, 197, 141, 127, 49, 160, 210, 64, 23, 143, 176, 114, 198, 156, 124,
-    135, 115, 83, 255, 178, 159, 89, 65, 146, 185, 165, 170, 36, 141, 37, 249, 198, 125, 206, 125, 247, 16, 211, 162,
-    64, 92, 197, 75, 181, 155, 131, 31, 110, 224, 248, 218, 129, 230, 3, 7, 253, 174, 208, 162, 151, 233, 221, 182, 13,
-    25, 97, 70, 135, 228, 16, 250, 170, 60, 19, 237, 137, 140, 141, 75, 103, 1, 217, 72, 72, 136, 67, 126, 165, 23, 162,
-    73, 53, 59, 249, 76, 163, 254, 97, 198, 252, 77, 161, 161, 173, 177, 117, 253, 124, 54, 248, 193, 187, 173, 243,
-    122, 194, 235, 248, 238, 21, 138, 41, 239, 132, 24, 216, 177, 174, 152, 194, 210, 104, 230, 44, 248, 195, 159, 148,
-    176, 31, 253, 234, 177, 71, 118, 176, 144, 168, 22, 99, 53, 110, 164, 219, 25, 147, 211, 47, 52, 195, 55, 190, 19,
-    193, 67, 251, 174, 50, 147, 135, 123, 199, 11, 131, 201, 216, 49, 171, 223, 212, 63, 208, 247, 42, 26, 52, 197, 35,
-    17, 71, 47, 15, 113, 120, 105, 141, 198, 240, 84, 68, 255, 10, 76, 211, 209, 155, 49, 174, 151, 114, 244, 241, 217,
-    172, 124, 133, 77, 6, 38, 135, 242, 58, 113, 108, 149, 205, 134, 116, 239, 73, 140, 66, 228, 242, 182, 146, 184, 68,
-    116, 145, 227, 230, 168, 11, 230, 67, 140, 234, 63, 46, 114, 37, 29, 179, 6, 56, 199, 187, 97, 59, 7, 45, 187, 136,
-    174, 46, 49, 66, 104, 160, 126, 122, 44, 235, 249, 122, 143, 206, 151, 130, 226, 18, 28, 45, 72, 94, 190, 113, 125,
-    43, 231, 57, 84, 190, 117, 174, 4, 180, 124, 120, 8, 12, 241, 202, 64, 189, 56, 216, 9, 131, 120, 33, 162, 103, 142,
-    165, 153, 238, 40, 14, 34, 76, 189, 10, 187, 70, 179, 16, 82, 235, 40, 230, 211, 101, 100, 229, 176, 138, 228, 53,
-    117, 19, 23, 174, 19, 141, 225, 87, 10, 118, 232, 158, 235, 203, 43, 229, 60, 41, 42, 210, 170, 244, 190, 121, 11,
-    171, 20, 143, 120, 26, 123, 255, 176, 33, 160, 127, 82, 108, 185, 10, 54, 159, 95, 162, 41, 109, 101, 248, 80, 217,
-    121, 67, 182, 93, 222, 184, 135, 170, 216, 26, 245, 122, 128, 110, 167, 7, 211, 128, 124, 101, 224, 127, 36, 171,
-    23, 221, 149, 25, 208, 235, 207, 143, 1, 211, 21, 162, 218, 74, 38, 232, 139, 57, 217, 172, 77, 68, 140, 231, 146,
-    231, 200, 24, 228, 141, 220, 117, 36, 134, 45, 83, 133, 7, 192, 122, 129, 28, 50, 32, 15, 35, 140, 63, 126, 49, 168,
-    97, 249, 229, 22, 139, 141, 52, 59, 158, 240, 143, 230, 159, 207, 10, 159, 224, 154, 75, 186, 161, 145, 103, 25, 80,
-    254, 43, 168, 164, 251, 53, 164, 207, 58, 55, 235, 111, 116, 190, 249, 110, 190, 28, 162, 189, 136, 238, 34, 25, 75,
-    169, 56, 190, 114, 24, 228, 234, 144, 12, 106, 45, 213, 179, 206, 179, 134, 158, 74, 142, 68, 1, 201, 45, 10, 189,
-    152, 0, 179, 225, 33, 23, 207, 232, 128, 230, 245, 154, 19, 60, 135, 181, 35, 56, 245, 77, 92, 79, 36, 167, 36, 35,
-    255, 5, 21, 108, 148, 172, 199, 165, 233, 170, 80, 98, 32, 224, 27, 150, 84, 172, 107, 170, 148, 150, 15, 77, 29,
-    232, 68, 239, 21, 0, 117, 6, 177, 62, 50, 66, 16, 240, 15, 245, 238, 195, 183, 133, 7, 90, 248, 115, 128, 125, 22,
-    226, 136, 52, 177, 89, 174, 209, 10, 66, 125, 83, 99, 61, 82, 133, 45, 43, 134, 130, 169, 237, 164, 62, 64, 93, 57,
-    10, 201, 166, 104, 206, 125, 228, 228, 7, 225, 171, 2, 50, 37, 8, 46, 76, 8, 202, 114, 10, 119, 165, 99, 80, 101,
-    50, 159, 154, 135, 19, 107, 148, 205, 72, 38, 49, 17, 140, 98, 86, 41, 151, 10, 28, 29, 55, 84, 189, 197, 223, 110,
-    232, 78, 241, 115, 162, 69, 43, 161, 108, 193, 35, 56, 204, 1, 72, 235, 56, 206, 185, 207, 240, 82, 220, 253, 6,
-    178, 133, 237, 14, 132, 255, 36, 76, 219, 220, 218, 153, 172, 225, 225, 168, 251, 244, 79, 102, 31, 178, 112, 225,
-    58, 110, 105, 182, 201, 139, 255, 199, 182, 12, 111, 156, 61, 137, 100, 166, 48, 7, 26, 117, 178, 191, 128, 174, 49,
-    16, 42, 64, 113, 226, 63, 189, 215, 36, 204, 77, 235, 68, 231, 75, 172, 12, 254, 1, 251, 197, 10, 35, 228, 5, 102,
-    41, 22, 39, 10, 148, 120, 12, 55, 105, 175, 193, 100, 206, 82, 166, 186, 153, 98, 22, 95, 218, 96, 209, 143, 63,
-    254, 192, 194, 126, 73, 240, 61, 61, 193, 25, 104, 107, 79, 141, 180, 253, 34, 250, 235, 10, 66, 90, 66, 86, 92,
-    184, 214, 250, 74, 230, 96, 180, 211, 235, 184, 80, 22, 195, 86, 88, 172, 135, 70, 219, 109, 244, 172, 9, 155, 35,
-    127, 131, 37, 93, 84, 134, 102, 252, 216, 208, 211, 85, 139, 34, 245, 56, 45, 77, 138, 68, 171, 201, 16, 187, 186,
-    241, 132, 165, 223, 85, 174, 207, 170, 86, 185, 55, 99, 125, 86, 1, 137, 135, 48, 153, 228, 218, 196, 177, 201, 206,
-    86, 164, 128, 172, 203, 157, 211, 149, 104, 150, 22, 48, 252, 249, 77, 106, 25, 103, 6, 194, 107, 136, 57, 9, 72,
-    230, 253, 161, 206, 191, 119, 70, 83, 90, 120, 142, 111, 120, 141, 166, 20, 210, 120, 199, 129, 100, 216, 69, 161,
-    178, 176, 72, 147, 127, 24, 104, 201, 132, 213, 44, 120, 220, 124, 37, 211, 115, 247, 108, 79, 208, 155, 169, 206,
-    239, 69, 117, 138, 50, 223, 21, 21, 225, 199, 64, 9, 8, 156, 146, 244, 45, 160, 55, 174, 20, 55, 19, 129, 53, 7,
-    111, 187, 140, 238, 48, 113, 27, 238, 187, 228, 223, 86, 172, 229, 234, 70, 120, 95, 226, 251, 224, 81, 163, 68, 28,
-    234, 229, 2, 250, 203, 204, 144, 6, 125, 1, 254, 171, 126, 156, 101, 255, 169, 62, 76, 175, 56, 77, 226, 247, 72, 4,
-    87, 122, 73, 76, 208, 54, 201, 166, 216, 169, 79, 241, 141, 0, 120, 60, 61, 36, 123, 231, 244, 209, 99, 27, 88, 63,
-    113, 250, 160, 254, 157, 26, 78, 132, 236, 159, 125, 137, 57, 205, 172, 66, 67, 79, 215, 204, 160, 189, 54, 50, 254,
-    148, 187, 3, 33, 99, 136, 104, 141, 118, 89, 85, 187, 239, 221, 45, 219, 228, 95, 252, 104, 95, 251, 230, 149, 126,
-    179, 102, 198, 241, 237, 54, 113, 117, 6, 36, 164, 253, 114, 39, 113, 37, 137, 218, 83, 140, 19, 142, 107, 136, 239,
-    101, 23, 166, 187, 52, 127, 226, 30, 220, 249, 17, 66, 3, 87, 168, 44, 197, 94, 77, 56, 236, 211, 63, 153, 26, 127,
-    74, 43, 220, 94, 119, 108, 67, 254, 94, 189, 186, 141, 165, 124, 178, 86, 91, 98, 209, 105, 10, 111, 184, 135, 63,
-    101, 247, 8, 186, 113, 225, 161, 248, 132, 176, 4, 142, 151, 101, 24, 1, 173, 177, 3, 41, 145, 230, 192, 60, 123,
-    12, 24, 129, 186, 77, 95, 25, 84, 28, 233, 4, 128, 107, 114, 152, 164, 97, 191, 208, 62, 225, 5, 172, 132, 13, 103,
-    143, 86, 222, 125, 126, 194, 14, 132, 158, 234, 101, 74, 102, 77, 30, 216, 104, 248, 93, 175, 196, 254, 180, 255,
-    108, 222, 166, 195, 125, 137, 2, 12, 52, 101, 222, 75, 125, 129, 254, 67, 205, 54, 16, 83, 42, 161, 65, 230, 65, 24,
-    4, 157, 227, 7, 28, 110, 164, 119, 110, 26, 143, 123, 238, 88, 231, 70, 120, 160, 102, 215, 182, 227, 150, 49, 119,
-    230, 199, 105, 165, 185, 166, 114, 157, 55, 155, 191, 24, 120, 102, 162, 136, 243, 16, 190, 95, 223, 254, 54, 96,
-    104, 175, 208, 41, 18, 115, 237, 238, 83, 254, 99, 67, 18, 59, 239, 152, 1, 124, 99, 171, 249, 190, 171, 234, 108,
-    61, 200, 61, 223, 213, 217, 67, 71, 24, 207, 165, 198, 4, 253, 199, 12, 108, 211, 93, 187, 158, 196, 72, 55, 91, 5,
-    59, 188, 134, 18, 238, 73, 146, 145, 31, 41, 140, 71, 96, 62, 12, 22, 178, 196, 136, 181, 130, 198, 125, 224, 240,
-    116, 167, 139, 213, 220, 238, 145, 247, 77, 176, 188, 218, 62, 201, 151, 92, 218, 106, 166, 189, 54, 236, 228, 101,
-    57, 116, 243, 93, 62, 119, 84, 122, 11, 69, 204, 28, 136, 139, 134, 104, 37, 65, 184, 126, 218, 170, 60, 254, 248,
-    204, 207, 20, 6, 79, 249, 11, 175, 38, 139, 182, 188, 193, 214, 199, 255, 18, 60, 183, 88, 234, 71, 170, 63, 25,
-    217, 106, 72, 137, 169, 218, 63, 48, 231, 217, 84, 221, 27, 220, 77, 234, 139, 239, 187, 186, 48, 244, 162, 23, 162,
-    184, 85, 100, 0, 47, 54, 44, 26, 218, 136, 61, 84, 78, 129, 63, 133, 189, 80, 167, 134, 5, 67, 213, 233, 140, 179,
-    203, 200, 9, 205, 140, 192, 158, 251, 231, 88, 43, 112, 206, 189, 217, 239, 247, 78, 176, 96, 132, 245, 198, 157,
-    195, 195, 194, 147, 10, 192, 197, 187, 248, 47, 85, 34, 77, 176, 129, 73, 27, 58, 93, 125, 101, 74, 132, 64, 20,
-    150, 60, 47, 190, 7, 248, 176, 155, 52, 216, 181, 146, 157, 190, 254, 68, 112, 197, 197, 57, 171, 166, 244, 15, 242,
-    230, 130, 133, 215, 171, 180, 43, 43, 80, 50, 249, 134, 217, 151, 93, 180, 163, 250, 77, 110, 216, 123, 228, 96, 44,
-    128, 253, 160, 144, 15, 43, 72, 149, 245, 72, 102, 48, 65, 207, 248, 163, 71, 71, 207, 154, 49, 22, 37, 179, 111,
-    62, 74, 30, 255, 118, 152, 255, 2, 98, 161, 13, 179, 53, 170, 163, 134, 237, 30, 54, 124, 48, 27, 73, 98, 78, 245,
-    84, 120, 109, 116, 216, 204, 87, 0, 123, 209, 128, 82, 45, 235, 157, 100, 248, 33, 218, 195, 127, 168, 237, 44, 111,
-    182, 255, 155, 208, 169, 35, 12, 40, 166, 70, 115, 143, 38, 62, 180, 160, 44, 73, 34, 87, 29, 114, 120, 31, 93, 178,
-    165, 169, 10, 71, 89, 137, 68, 192, 36, 126, 185, 62, 1, 4, 105, 48, 188, 242, 197, 59, 24, 254, 66, 139, 93, 177,
-    216, 187, 68, 99, 192, 153, 52, 99, 124, 45, 95, 92, 179, 101, 162, 65, 140, 210, 11, 195, 40, 179, 177, 162, 201,
-    201, 24, 170, 66, 174, 122, 222, 19, 188, 77, 138, 159, 0, 59, 194, 167, 240, 205, 238, 244, 243, 135, 76, 61, 65,
-    230, 236, 115, 1, 217, 194, 199, 114, 189, 13, 90, 187, 228, 48, 172, 150, 59, 70, 176, 18, 132, 68, 196, 243, 102,
-    35, 126, 206, 108, 171, 211, 197, 168, 64, 71, 38, 120, 111, 8, 236, 165, 65, 246, 208, 86, 87, 211, 206, 3, 76, 99,
-    118, 14, 227, 26, 33, 239, 75, 178, 182, 4, 47, 94, 157, 74, 234, 51, 38, 133, 134, 108, 143, 109, 207, 125, 186,
-    63, 126, 122, 70, 154, 154, 227, 43, 132, 122, 85, 230, 231, 230, 95, 33, 233, 196, 244, 95, 207, 93, 149, 64, 251,
-    102, 182, 221, 231, 64, 73, 121, 241, 88, 109, 77, 78, 234, 153, 205, 111, 31, 192, 99, 150, 186, 89, 195, 29, 240,
-    220, 138, 128, 92, 176, 60, 248, 51, 146, 35, 196, 136, 226, 209, 88, 64, 251, 248, 35, 157, 248, 119, 25, 180, 53,
-    218, 61, 4, 115, 60, 37, 7, 154, 185, 162, 13, 184, 125, 221, 139, 129, 63, 203, 128, 246, 164, 208, 191, 107, 209,
-    196, 183, 22, 200, 24, 78, 196, 76, 226, 242, 21, 78, 58, 33, 84, 173, 67, 28, 234, 107, 39, 137, 192, 33, 229, 144,
-    252, 239, 49, 51, 252, 130, 41, 165, 64, 41, 1, 41, 196, 165, 191, 213, 142, 76, 160, 166, 123, 200, 2, 205, 155,
-    191, 245, 126, 248, 75, 124, 243, 159, 243, 63, 204, 132, 8, 118, 52, 41, 115, 187, 225, 237, 52, 8, 218, 12, 97,
-    87, 226, 10, 170, 65, 118, 145, 248, 160, 211, 132, 241, 199, 154, 118, 9, 74, 192, 31, 187, 211, 146, 71, 184, 132,
-    138, 209, 77, 239, 139, 108, 208, 10, 135, 214, 190, 144, 249, 246, 180, 229, 46, 52, 89, 46, 215, 40, 118, 11, 213,
-    15, 174, 125, 75, 143, 5, 106, 43, 33, 170, 252, 184, 160, 196, 114, 124, 118, 21, 249, 169, 187, 84, 28, 253, 183,
-    23, 35, 127, 132, 120, 5, 148, 10, 72, 137, 95, 151, 154, 82, 170, 96, 5, 18, 154, 249, 221, 123, 30, 201, 172, 118,
-    165, 83, 5, 181, 147, 85, 96, 87, 21, 15, 253, 24, 24, 225, 253, 198, 138, 83, 9, 126, 228, 76, 129, 29, 215, 43,
-    42, 158, 204, 200, 112, 25, 149, 255, 226, 101, 214, 97, 26, 6, 11, 61, 20, 59, 212, 230, 234, 111, 56, 166, 210,
-    99, 140, 55, 233, 104, 182, 187, 176, 240, 88, 147, 62, 254, 174, 114, 216, 33, 136, 119, 228, 45, 155, 229, 165,
-    217, 190, 122, 172, 70, 142, 153, 92, 157, 184, 111, 141, 13, 234, 166, 77, 236, 120, 255, 163, 46, 86, 250, 44, 54,
-    57, 185, 34, 251, 247, 139, 124, 50, 175, 254, 152, 20, 118, 211, 103, 108, 125, 147, 222, 219, 27, 253, 147, 215,
-    229, 7, 195, 51, 123, 201, 108, 158, 187, 167, 51, 191, 254, 211, 128, 174, 197, 37, 219, 207, 211, 98, 46, 205, 58,
-    240, 132, 95, 230, 73, 159, 61, 16, 178, 29, 129, 96, 233, 246, 111, 241, 225, 45, 27, 142, 63, 112, 218, 6, 41,
-    168, 90, 90, 49, 77, 178, 226, 221, 209, 141, 231, 250, 150, 16, 22, 38, 143, 77, 140, 226, 35, 23, 166, 10, 24, 24,
-    192, 44, 223, 245, 97, 251, 110, 146, 144, 7, 152, 68, 36, 226, 173, 110, 130, 100, 196, 137, 166, 34, 104, 80, 18,
-    131, 193, 218, 241, 117, 208, 153, 2, 244, 18, 2, 23, 140, 222, 162, 20, 235, 255, 240, 170, 161, 63, 150, 65, 75,
-    151, 47, 94, 208, 130, 232, 13, 24, 95, 118, 13, 126, 136, 242, 83, 189, 52, 101, 225, 254, 67, 218, 71, 28, 171,
-    167, 240, 129, 42, 34, 68, 187, 109, 36, 235, 76, 54, 31, 199, 140, 86, 121, 202, 170, 92, 251, 190, 120, 97, 148,
-    28, 34, 208, 102, 109, 216, 240, 149, 64, 125, 228, 201, 0, 114, 2, 205, 60, 249, 103, 11, 235, 129, 195, 220, 3,
-    82, 68, 88, 93, 41, 110, 84, 250, 118, 122, 85, 200, 46, 4, 226, 89, 53, 218, 29, 74, 193, 13, 223, 51, 3, 75, 40,
-    10, 90, 4, 154, 15, 144, 47, 188, 131, 23, 127, 91, 58, 154, 131, 83, 153, 144, 255, 141, 214, 144, 84, 38, 227,
-    103, 22, 158, 173, 55, 196, 156, 190, 120, 148, 204, 189, 80, 33, 202, 67, 58, 83, 166, 197, 10, 120, 155, 146, 203,
-    19, 10, 117, 141, 65, 148, 165, 131, 133, 27, 239, 86, 187, 5, 191, 93, 143, 201, 189, 136, 8, 237, 91, 141, 30,
-    152, 95, 114, 184, 160, 20, 194, 193, 135, 0, 117, 113, 157, 39, 48, 209, 91, 45, 191, 150, 238, 199, 120, 60, 208,
-    147, 131, 215, 40, 93, 25, 232, 31, 67, 181, 204, 21, 139, 12, 92, 114, 9, 180, 35, 40, 34, 43, 176, 92, 246, 169,
-    154, 91, 8, 102, 147, 11, 206, 14, 239, 242, 29, 114, 251, 80, 4, 153, 127, 153, 4, 100, 162, 237, 176, 182, 52,
-    227, 217, 133, 70, 252, 186, 25, 132, 193, 132, 172, 205, 214, 62, 166, 197, 148, 196, 187, 69, 99, 214, 184, 201,
-    155, 254, 251, 112, 176, 87, 205, 29, 95, 16, 70, 192, 148, 196, 40, 51, 121, 244, 184, 22, 4, 239, 229, 231, 197,
-    218, 150, 6, 7, 108, 219, 121, 6, 89, 88, 252, 76, 44, 216, 39, 224, 204, 34, 152, 248, 99, 101, 12, 101, 137, 64,
-    181, 253, 113, 63, 191, 216, 42, 90, 114, 13, 195, 191, 111, 40, 45, 164, 204, 67, 133, 111, 133, 240, 75, 118, 117,
-    117, 209, 163, 166, 35, 206, 213, 2, 130, 190, 227, 27, 106, 162, 170, 35, 163, 113, 206, 119, 89, 22, 182, 49, 224,
-    100, 94, 195, 243, 166, 68, 113, 222, 214, 7, 156, 157, 93, 27, 37, 44, 221, 76, 57, 84, 195, 129, 61, 52, 174, 192,
-    165, 246, 210, 129, 142, 118, 210, 194, 225, 185, 77, 56, 120, 229, 58, 146, 37, 133, 193, 234, 38, 23, 2, 50, 149,
-    166, 80, 145, 201, 167, 62, 182, 146, 90, 209, 58, 183, 145, 202, 108, 148, 38, 64, 98, 7, 92, 42, 11, 109, 159, 18,
-    84, 169, 215, 115, 137, 12, 49, 180, 156, 101, 42, 217, 190, 132, 215, 36, 131, 184, 91, 230, 46, 68, 226, 0, 122,
-    30, 172, 2, 197, 123, 180, 201, 207, 203, 13, 224, 1, 8, 102, 229, 221, 5, 105, 16, 114, 193, 36, 128, 204, 218,
-    156, 79, 115, 117, 152, 224, 89, 123, 147, 147, 33, 233, 77, 200, 17, 70, 127, 215, 68, 200, 160, 165, 4, 175, 143,
-    124, 227, 68, 234, 26, 173, 97, 99, 39, 221, 189, 113, 223, 186, 133, 251, 203, 4, 91, 116, 101, 125, 170, 193, 237,
-    5, 197, 135, 86, 72, 168, 15, 34, 31, 8, 198, 48, 149, 34, 246, 142, 202, 195, 144, 252, 231, 210, 94, 38, 76, 43,
-    145, 232, 112, 36, 183, 251, 26, 101, 81, 96, 105, 145, 8, 127, 65, 177, 35, 211, 28, 131, 237, 182, 201, 225, 197,
-    148, 83, 57, 9, 32, 255, 238, 210, 127, 95, 198, 183, 241, 188, 113, 48, 132, 123, 118, 183, 116, 8, 81, 174, 34,
-    78, 116, 85, 13, 127, 22, 233, 42, 19, 152, 146, 75, 243, 101, 179, 70, 38, 85, 92, 117, 88, 220, 22, 3, 62, 38,
-    240, 166, 104, 225, 68, 122, 140, 64, 112, 207, 53, 103, 224, 103, 155, 139, 221, 199, 190, 48, 75, 89, 84, 16, 242,
-    148, 116, 226, 36, 41, 52, 181, 131, 214, 82, 149, 21, 147, 90, 79, 133, 231, 224, 102, 22, 208, 90, 28, 126, 251,
-    158, 212, 246, 198, 107, 68, 178, 50, 203, 234, 193, 14, 219, 95, 199, 153, 17, 135, 110, 176, 254, 188, 133, 156,
-    52, 152, 237, 34, 146, 172, 134, 119, 66, 160, 69, 33, 16, 190, 248, 202, 122, 59, 95, 175, 112, 26, 252, 156, 64,
-    36, 22, 68, 184, 112, 102, 77, 38, 9, 190, 219, 31, 234, 118, 242, 88, 37, 219, 160, 159, 133, 91, 174, 185, 154,
-    26, 223, 196, 164, 221, 98, 216, 64, 252, 233, 175, 60, 230, 124, 161, 139, 178, 148, 83, 130, 232, 214, 196, 207,
-    157, 219, 101, 32, 114, 186, 203, 45, 173, 73, 242, 159, 66, 102, 210, 178, 128, 118, 181, 205, 52, 37, 159, 177,
-    44, 250, 203, 97, 40, 101, 214, 79, 189, 35, 102, 252, 168, 46, 149, 102, 126, 196, 2, 140, 0, 51, 41, 248, 160,
-    197, 125, 145, 236, 3, 44, 48, 102, 204, 85, 114, 239, 185, 50, 18, 161, 148, 191, 171, 28, 4, 82, 223, 23, 203, 95,
-    62, 118, 149, 207, 242, 162, 34, 82, 214, 134, 252, 21, 150, 91, 255, 0, 20, 189, 231, 222, 33, 118, 54, 242, 95,
-    186, 238, 224, 82, 217, 210, 254, 67, 237, 239, 98, 7, 110, 148, 165, 249, 24, 228, 24, 56, 76, 236, 103, 90, 74, 5,
-    71, 85, 16, 162, 46, 156, 115, 166, 126, 40, 104, 111, 185, 68, 43, 29, 122, 41, 200, 225, 78, 202, 21, 192, 26, 76,
-    108, 162, 37, 146, 214, 25, 169, 200, 0, 28, 55, 127, 30, 17, 64, 161, 184, 188, 8, 93, 88, 144, 249, 18, 113, 32,
-    164, 122, 225, 149, 95, 100, 13, 188, 63, 128, 12, 55, 18, 19, 154, 236, 56, 133, 42, 8, 200, 32, 242, 62, 23, 29,
-    232, 219, 44, 205, 47, 227, 122, 231, 104, 196, 89, 98, 25, 64, 186, 127, 22, 129, 172, 36, 4, 218, 117, 102, 228,
-    244, 207, 167, 25, 210, 234, 93, 165, 255, 19, 12, 167, 22, 30, 27, 240, 192, 107, 128, 206, 172, 166, 155, 157, 94,
-    16, 157, 118, 16, 117, 132, 153, 244, 133, 150, 184, 227, 237, 228, 183, 44, 169, 109, 119, 100, 99, 209, 146, 33,
-    150, 240, 239, 160, 205, 104, 58, 113, 168, 234, 210, 7, 188, 245, 115, 212, 248, 92, 203, 120, 145, 54, 123, 213,
-    201, 80, 122, 224, 13, 15, 232, 212, 57, 125, 67, 36, 52, 48, 232, 42, 73, 194, 92, 27, 91, 141, 191, 208, 187, 222,
-    140, 125, 72, 45, 77, 4, 138, 240, 154, 45, 35, 192, 55, 9, 237, 120, 134, 218, 65, 5, 224, 57, 151, 10, 186, 152,
-    0, 60, 165, 67, 135, 102, 117, 64, 161, 236, 69, 147, 80, 233, 132, 16, 14, 182, 176, 203, 197, 83, 145, 4, 59, 215,
-    242, 156, 166, 13, 35, 183, 3, 137, 27, 132, 177, 166, 127, 23, 163, 39, 243, 195, 90, 47, 250, 82, 252, 120, 61,
-    59, 164, 141, 98, 241, 68, 160, 217, 24, 205, 243, 240, 169, 89, 104, 13, 177, 68, 126, 124, 214, 26, 55, 6, 66,
-    100, 186, 176, 199, 222, 175, 32, 104, 7, 58, 146, 125, 86, 37, 181, 191, 140, 172, 99, 35, 183, 133, 45, 221, 22,
-    187, 87, 51, 84, 75, 145, 99, 132, 152, 67, 77, 18, 169, 62, 119, 105, 34, 253, 198, 63, 141, 56, 38, 218, 22, 87,
-    201, 11, 46, 100, 114, 58, 54, 165, 102, 82, 233, 40, 129, 83, 247, 165, 205, 106, 98, 119, 78, 122, 99, 12, 34, 16,
-    194, 0, 12, 47, 25, 53, 74, 118, 19, 228, 37, 100, 128, 103, 5, 166, 22, 73, 101, 170, 249, 41, 47, 157, 148, 254,
-    52, 125, 98, 169, 69, 43, 50, 158, 122, 64, 121, 37, 194, 24, 152, 41, 40, 134, 118, 44, 102, 222, 140, 110, 151,
-    159, 10, 201, 101, 110, 12, 113, 211, 197, 190, 33, 154, 195, 95, 227, 247, 151, 10, 119, 86, 21, 82, 249, 48, 135,
-    99, 162, 229, 187, 133, 106, 108, 57, 174, 239, 239, 77, 132, 74, 119, 155, 32, 69, 147, 59, 237, 245, 246, 59, 187,
-    222, 97, 179, 178, 212, 237, 95, 29, 99, 154, 31, 222, 155, 198, 77, 17, 141, 253, 230, 219, 191, 70, 229, 235, 218,
-    111, 140, 223, 4, 190, 4, 21, 73, 226, 185, 165, 243, 185, 245, 125, 51, 73, 30, 200, 239, 255, 220, 4, 100, 218,
-    249, 30, 213, 134, 227, 135, 217, 77, 149, 61, 194, 198, 37, 26, 93, 67, 254, 219, 214, 79, 124, 43, 99, 52, 35,
-    143, 143, 242, 199, 113, 94, 175, 81, 162, 119, 188, 81, 164, 31, 29, 108, 194, 118, 52, 253, 214, 175, 156, 166,
-    76, 143, 85, 25, 246, 114, 114, 11, 35, 147, 147, 167, 186, 180, 232, 141, 229, 230, 143, 41, 36, 204, 149, 27, 247,
-    64, 47, 60, 201, 123, 100, 24, 144, 252, 59, 16, 116, 216, 132, 45, 166, 215, 191, 138, 108, 58, 136, 212, 106, 77,
-    247, 234, 234, 156, 119, 117, 204, 156, 43, 103, 214, 80, 181, 47, 237, 153, 222, 52, 23, 1, 69, 248, 198, 226, 200,
-    195, 244, 230, 122, 68, 51, 29, 160, 130, 127, 219, 206, 86, 72, 193, 85, 241, 93, 191, 78, 120, 106, 60, 196, 230,
-    52, 15, 13, 97, 214, 24, 97, 16, 145, 161, 104, 86, 30, 34, 85, 225, 108, 120, 64, 109, 153, 134, 46, 51, 76, 174,
-    219, 138, 206, 131, 88, 21, 136, 251, 51, 231, 213, 83, 3, 7, 233, 104, 145, 71, 127, 67, 88, 207, 123, 192, 231,
-    192, 233, 11, 154, 39, 103, 242, 72, 110, 10, 200, 219, 18, 54, 62, 159, 13, 217, 33, 1, 178, 139, 48, 28, 224, 102,
-    247, 18, 118, 56, 209, 253, 219, 82, 198, 201, 49, 120, 245, 179, 5, 212, 100, 123, 172, 100, 109, 83, 216, 12, 86,
-    69, 77, 190, 105, 6, 77, 94, 155, 128, 170, 246, 55, 210, 57, 2, 209, 24, 8, 63, 9, 203, 242, 170, 95, 129, 44, 35,
-    87, 230, 81, 51, 16, 28, 240, 104, 225, 156, 51, 178, 240, 211, 189, 249, 220, 83, 168, 240, 249, 27, 113, 205, 228,
-    57, 16, 182, 37, 185, 190, 136, 171, 158, 40, 105, 116, 234, 51, 12, 192, 118, 250, 52, 226, 15, 42, 217, 21, 95,
-    96, 74, 208, 68, 213, 117, 133, 127, 112, 90, 169, 187, 65, 139, 201, 208, 45, 139, 106, 224, 248, 125, 107, 88,
-    239, 230, 7, 45, 154, 150, 17, 176, 136, 165, 145, 37, 78, 131, 61, 194, 26, 171, 32, 181, 20, 50, 73, 253, 219,
-    129, 96, 164, 152, 39, 169, 246, 161, 84, 49, 45, 241, 133, 105, 188, 95, 157, 98, 44, 46, 173, 30, 240, 193, 18,
-    37, 213, 254, 173, 225, 96, 142, 234, 136, 175, 211, 147, 252, 185, 38, 178, 192, 35, 56, 9, 235, 193, 156, 132, 92,
-    219, 29, 42, 196, 177, 47, 113, 179, 110, 176, 108, 14, 3, 190, 79, 249, 191, 171, 222, 202, 158, 23, 62, 101, 146,
-    129, 229, 206, 169, 61, 224, 135, 227, 128, 182, 230, 173, 13, 155, 207, 218, 80, 36, 28, 88, 59, 57, 73, 118, 234,
-    136, 106, 89, 242, 246, 183, 215, 49, 216, 97, 110, 247, 102, 250, 92, 141, 56, 223, 137, 86, 173, 49, 243, 224, 41,
-    128, 8, 18, 252, 50, 75, 146, 61, 108, 237, 186, 211, 83, 113, 133, 243, 108, 53, 31, 224, 74, 17, 13, 202, 159, 69,
-    189, 152, 53, 218, 195, 70, 215, 1, 203, 255, 199, 190, 219, 146, 106, 10, 47, 82, 162, 228, 77, 221, 73, 170, 59,
-    219, 111, 17, 167, 170, 91, 247, 39, 120, 19, 204, 3, 246, 124, 51, 148, 187, 146, 11, 211, 118, 148, 8, 113, 215,
-    191, 157, 161, 91, 89, 20, 187, 95, 69, 196, 215, 181, 252, 149, 123, 60, 222, 7, 238, 181, 17, 187, 192, 203, 36,
-    250, 109, 200, 212, 241, 60, 43, 134, 11, 31, 66, 96, 99, 10, 7, 173, 57, 230, 158, 127, 189, 165, 53, 20, 1, 157,
-    19, 194, 12, 228, 210, 182, 245, 94, 127, 233, 60, 95, 5, 243, 152, 155, 255, 242, 49, 85, 126, 96, 62, 196, 145,
-    219, 128, 73, 60, 33, 205, 254, 189, 202, 19, 135, 88, 222, 201, 77, 33, 74, 134, 27, 220, 202, 212, 87, 87, 74,
-    246, 207, 246, 23, 183, 185, 143, 200, 66, 227, 45, 65, 63, 166, 209, 28, 185, 217, 245, 183, 241, 248, 246, 61,
-    207, 21, 67, 100, 160, 249, 141, 60, 232, 81, 66, 88, 200, 78, 68, 79, 6, 45, 124, 225, 136, 177, 129, 192, 214, 93,
-    145, 55, 157, 53, 102, 157, 254, 242, 162, 105, 168, 50, 146, 141, 80, 9, 226, 104, 194, 177, 251, 104, 149, 64, 15,
-    14, 158, 48, 221, 97, 118, 139, 177, 104, 53, 92, 105, 222, 163, 191, 126, 203, 103, 54, 39, 124, 222, 18, 183, 186,
-    72, 114, 211, 246, 115, 40, 53, 198, 156, 118, 248, 153, 132, 119, 5, 209, 111, 194, 147, 115, 224, 54, 208, 87, 20,
-    228, 92, 161, 84, 179, 225, 70, 168, 4, 114, 212, 123, 176, 129, 35, 117, 90, 223, 252, 223, 13, 138, 22, 137, 94,
-    135, 222, 6, 212, 7, 168, 198, 210, 153, 174, 166, 25, 79, 168, 30, 26, 94, 99, 172, 145, 106, 134, 90, 132, 96,
-    100, 180, 2, 225, 82, 54, 25, 131, 208, 38, 233, 83, 40, 83, 144, 214, 161, 65, 17, 90, 152, 30, 95, 44, 138, 225,
-    181, 178, 137, 28, 86, 154, 163, 167, 32, 254, 182, 20, 12, 234, 100, 91, 178, 124, 132, 190, 236, 157, 25, 169,
-    242, 241, 7, 5, 52, 208, 211, 208, 136, 184, 212, 121, 38, 124, 140, 56, 80, 97, 7, 44, 96, 180, 114, 123, 131, 204,
-    174, 199, 68, 10, 98, 169, 82, 134, 27, 93, 67, 0, 129, 39, 38, 67, 185, 71, 91, 182, 158, 84, 201, 197, 196, 223,
-    106, 153, 230, 214, 191, 52, 3, 4, 199, 225, 205, 147, 196, 109, 8, 25, 197, 240, 217, 89, 52, 205, 80, 108, 107,
-    34, 58, 150, 84, 70, 85, 103, 161, 165, 164, 169, 28, 122, 62, 191, 130, 192, 210, 89, 108, 4, 43, 67, 96, 86, 221,
-    71, 144, 26, 126, 239, 75, 204, 1, 61, 117, 127, 124, 56, 87, 150, 157, 242, 129, 204, 168, 66, 37, 44, 26, 231,
-    161, 181, 46, 10, 94, 161, 202, 174, 174, 217, 35, 126, 244, 120, 227, 123, 250, 230, 168, 120, 238, 179, 236, 236,
-    174, 49, 113, 61, 98, 72, 229, 15, 83, 169, 37, 197, 203, 24, 48, 17, 251, 198, 13, 10, 3, 148, 61, 145, 223, 240,
-    145, 33, 227, 2, 151, 218, 81, 217, 21, 91, 219, 36, 201, 52, 131, 183, 69, 88, 139, 113, 44, 4, 135, 94, 207, 45,
-    150, 120, 140, 243, 225, 184, 179, 91, 212, 73, 44, 7, 21, 71, 147, 235, 53, 175, 126, 91, 251, 27, 176, 72, 51,
-    207, 25, 111, 232, 234, 152, 52, 243, 236, 101, 76, 63, 75, 148, 218, 101, 47, 109, 248, 50, 31, 174, 91, 51, 17,
-    18, 6, 69, 213, 185, 139, 56, 21, 14, 204, 247, 139, 146, 93, 7, 236, 132, 69, 202, 195, 193, 244, 164, 137, 10,
-    159, 150, 153, 8, 60, 82, 129, 29, 21, 88, 181, 42, 76, 43, 26, 196, 86, 134, 73, 49, 107, 164, 95, 103, 206, 214,
-    117, 62, 23, 42, 161, 150, 184, 24, 216, 45, 128, 177, 170, 88, 36, 198, 235, 173, 6, 88, 94, 250, 143, 101, 168,
-    64, 81, 199, 89, 100, 41, 156, 191, 179, 185, 228, 180, 110, 154, 44, 99, 164, 178, 109, 97, 212, 66, 23, 25, 42,
-    203, 152, 39, 162, 60, 222, 43, 87, 20, 211, 238, 197, 125, 27, 5, 227, 4, 207, 221, 221, 9, 166, 41, 190, 63, 214,
-    79, 200, 134, 242, 153, 124, 81, 39, 205, 248, 185, 244, 25, 27, 132, 136, 122, 92, 235, 216, 230, 217, 135, 48,
-    211, 181, 61, 158, 193, 143, 116, 195, 231, 176, 166, 118, 243, 170, 180, 51, 152, 34, 158, 92, 223, 33, 226, 107,
-    157, 239, 41, 86, 137, 100, 229, 188, 204, 98, 85, 73, 103, 6, 97, 252, 161, 106, 91, 223, 216, 136, 182, 152, 254,
-    133, 204, 254, 177, 141, 233, 44, 221, 195, 192, 116, 98, 40, 199, 138, 135, 185, 53, 154, 100, 239, 11, 88, 183,
-    239, 34, 46, 159, 239, 177, 187, 218, 180, 126, 213, 105, 143, 14, 199, 60, 73, 74, 78, 70, 44, 176, 186, 177, 213,
-    126, 153, 103, 85, 128, 234, 22, 106, 74, 192, 51, 21, 243, 230, 55, 18, 25, 120, 228, 191, 92, 150, 23, 207, 23,
-    120, 0, 232, 81, 188, 111, 83, 233, 46, 84, 67, 18, 0, 145, 231, 233, 76, 151, 110, 217, 6, 94, 176, 249, 204, 166,
-    165, 197, 32, 149, 54, 90, 140, 240, 45, 20, 144, 28, 72, 122, 36, 158, 183, 169, 134, 108, 80, 159, 120, 145, 179,
-    62, 133, 167, 84, 243, 20, 58, 222, 20, 105, 82, 199, 28, 196, 194, 43, 54, 231, 247, 37, 92, 180, 179, 150, 224,
-    253, 184, 122, 26, 19, 138, 173, 160, 104, 81, 60, 81, 237, 79, 233, 157, 121, 83, 26, 113, 62, 112, 156, 226, 82,
-    222, 236, 164, 171, 120, 37, 11, 178, 35, 230, 10, 129, 229, 209, 244, 62, 31, 242, 155, 205, 204, 141, 34, 163,
-    219, 105, 160, 187, 30, 2, 132, 54, 94, 57, 72, 83, 175, 194, 56, 86, 30, 216, 156, 83, 54, 164, 223, 121, 92, 32,
-    139, 179, 157, 214, 46, 5, 141, 95, 151, 156, 244, 51, 138, 221, 184, 183, 202, 224, 147, 52, 42, 38, 144, 40, 97,
-    235, 28, 144, 225, 190, 209, 58, 86, 185, 38, 61, 54, 185, 185, 150, 249, 57, 178, 45, 180, 216, 101, 44, 102, 26,
-    118, 199, 213, 18, 39, 217, 48, 181, 15, 225, 33, 228, 63, 249, 0, 3, 150, 250, 228, 220, 234, 254, 21, 133, 114,
-    213, 175, 90, 217, 99, 11, 103, 33, 203, 206, 55, 176, 160, 49, 183, 251, 232, 156, 246, 152, 44, 243, 167, 120, 86,
-    31, 111, 190, 6, 95, 163, 237, 231, 70, 112, 160, 230, 219, 80, 184, 19, 57, 153, 237, 0, 198, 67, 223, 233, 70, 96,
-    210, 19, 44, 241, 3, 106, 67, 28, 76, 139, 19, 35, 19, 85, 217, 158, 18, 36, 171, 244, 12, 84, 239, 136, 148, 67,
-    168, 97, 233, 185, 107, 159, 183, 226, 129, 138, 76, 92, 70, 84, 92, 180, 117, 21, 201, 43, 250, 215, 94, 228, 30,
-    227, 249, 105, 31, 210, 3, 127, 164, 165, 165, 234, 247, 245, 242, 164, 226, 251, 231, 104, 201, 48, 71, 41, 47,
-    228, 82, 32, 6, 45, 136, 139, 68, 134, 214, 83, 115, 144, 59, 75, 240, 191, 94, 163, 116, 150, 110, 234, 157, 131,
-    91, 62, 43, 8, 168, 116, 123, 15, 106, 167, 214, 99, 129, 125, 114, 55, 143, 243, 170, 109, 19, 28, 84, 21, 35, 66,
-    251, 18, 16, 9, 1, 88, 170, 211, 54, 202, 18, 192, 6, 83, 74, 171, 18, 56, 2, 188, 113, 143, 156, 157, 175, 107, 28,
-    217, 170, 106, 212, 135, 81, 72, 47, 10, 116, 218, 206, 123, 175, 235, 181, 197, 198, 69, 251, 210, 156, 9, 50, 54,
-    147, 116, 40, 211, 1, 176, 58, 173, 156, 24, 171, 11, 159, 129, 180, 234, 249, 204, 119, 31, 53, 43, 173, 61, 70,
-    131, 101, 100, 131, 66, 113, 134, 199, 141, 238, 211, 192, 212, 234, 7, 89, 84, 118, 86, 61, 136, 108, 228, 109,
-    122, 252, 72, 165, 210, 25, 90, 182, 113, 58, 116, 189, 118, 58, 197, 173, 169, 234, 164, 114, 124, 31, 33, 187,
-    137, 199, 7, 153, 170, 92, 30, 149, 244, 66, 177, 164, 216, 129, 45, 106, 83, 51, 43, 249, 13, 6, 69, 59, 152, 194,
-    244, 195, 224, 155, 13, 80, 176, 212, 139, 100, 96, 114, 83, 180, 250, 11, 193, 121, 116, 13, 143, 198, 84, 80, 47,
-    30, 140, 211, 137, 162, 235, 19, 216, 220, 165, 21, 103, 201, 154, 119, 245, 212, 128, 137, 161, 85, 192, 189, 31,
-    21, 38, 138, 202, 107, 113, 1, 172, 149, 62, 45, 169, 177, 24, 194, 178, 212, 197, 139, 116, 0, 52, 35, 71, 46, 249,
-    241, 126, 144, 122, 209, 29, 124, 102, 169, 214, 132, 4, 15, 187, 232, 68, 104, 89, 90, 116, 108, 140, 100, 10, 248,
-    186, 221, 133, 98, 175, 30, 89, 184, 237, 214, 58, 121, 165, 224, 222, 226, 30, 196, 10, 72, 74, 120, 76, 101, 131,
-    70, 198, 249, 154, 246, 171, 48, 166, 150, 170, 117, 32, 204, 187, 112, 23, 169, 203, 221, 109, 52, 54, 132, 228,
-    19, 86, 183, 217, 66, 161, 124, 116, 71, 177, 55, 181, 26, 88, 172, 235, 39, 79, 103, 180, 108, 39, 85, 119, 75,
-    138, 61, 24, 82, 44, 201, 197, 159, 210, 151, 44, 187, 150, 146, 167, 203, 163, 17, 207, 196, 216, 169, 182, 245,
-    81, 143, 34, 18, 18, 236, 189, 14, 48, 127, 14, 120, 239, 122, 41, 157, 64, 126, 212, 100, 152, 41, 115, 33, 0, 150,
-    71, 114, 116, 14, 254, 187, 208, 96, 43, 96, 37, 230, 68, 112, 99, 187, 17, 184, 108, 41, 65, 165, 157, 221, 197,
-    130, 131, 202, 130, 124, 157, 8, 36, 115, 171, 152, 184, 40, 72, 236, 221, 174, 148, 202, 245, 107, 158, 178, 47,
-    20, 166, 5, 125, 213, 219, 130, 45, 146, 65, 81, 232, 198, 231, 103, 51, 86, 124, 92, 207, 72, 33, 111, 86, 148,
-    171, 144, 1, 130, 1, 98, 135, 242, 141, 184, 124, 185, 118, 205, 54, 188, 246, 24, 244, 245, 67, 79, 101, 248, 241,
-    253, 46, 81, 99, 175, 0, 131, 180, 159, 228, 25, 70, 252, 71, 72, 219, 94, 7, 37, 12, 61, 104, 13, 60, 94, 73, 175,
-    247, 223, 176, 58, 194, 62, 158, 233, 190, 162, 208, 76, 125, 28, 9, 71, 201, 73, 101, 155, 0, 213, 254, 138, 221,
-    133, 197, 241, 16, 162, 249, 199, 249, 36, 66, 123, 240, 68, 77, 47, 15, 234, 33, 119, 45, 158, 238, 227, 53, 184,
-    165, 37, 99, 114, 76, 227, 141, 142, 18, 43, 92, 26, 150, 11, 180, 219, 93, 122, 250, 155, 30, 40, 17, 72, 74, 37,
-    48, 33, 151, 163, 88, 74, 221, 100, 1, 64, 219, 42, 198, 35, 183, 196, 105, 135, 173, 29, 84, 123, 78, 126, 254,
-    162, 136, 244, 32, 242, 175, 170, 60, 213, 176, 240, 204, 40, 235, 119, 82, 78, 96, 38, 153, 93, 207, 130, 13, 18,
-    225, 254, 250, 168, 248, 94, 215, 176, 105, 94, 201, 56, 80, 59, 185, 161, 221, 168, 34, 172, 107, 139, 197, 177,
-    230, 223, 44, 156, 114, 29, 118, 191, 196, 116, 84, 37, 75, 244, 252, 190, 88, 208, 201, 78, 60, 167, 123, 66, 69,
-    29, 32, 158, 65, 29, 77, 218, 253, 111, 19, 168, 246, 244, 155, 89, 50, 172, 170, 240, 224, 128, 4, 51, 108, 60,
-    237, 173, 229, 162, 222, 99, 152, 248, 183, 160, 120, 187, 128, 83, 39, 227, 20, 102, 239, 140, 250, 152, 191, 75,
-    80, 126, 219, 141, 192, 133, 4, 73, 24, 32, 17, 73, 59, 103, 109, 28, 34, 57, 193, 222, 23, 177, 145, 90, 215, 1,
-    58, 188, 210, 36, 103, 133, 25, 45, 4, 248, 83, 140, 230, 162, 202, 43, 47, 80, 45, 131, 88, 138, 129, 213, 71, 166,
-    87, 191, 44, 115, 15, 36, 216, 222, 243, 38, 50, 52, 23, 153, 149, 94, 47, 72, 208, 92, 1, 195, 7, 66, 89, 170, 192,
-    131, 76, 116, 143, 167, 26, 183, 62, 245, 96, 235, 126, 180, 163, 220, 192, 112, 113, 132, 9, 89, 5, 67, 206, 123,
-    30, 33, 20, 201, 186, 180, 211, 40, 255, 215, 122, 67, 107, 183, 131, 197, 128, 45, 63, 65, 134, 14, 42, 17, 196,
-    124, 14, 217, 51, 128, 177, 183, 230, 162, 64, 235, 126, 157, 81, 159, 155, 86, 219, 228, 203, 80, 173, 132, 163,
-    14, 244, 141, 242, 7, 112, 154, 192, 47, 10, 250, 72, 128, 18, 161, 65, 144, 238, 10, 178, 241, 51, 236, 10, 158,
-    192, 244, 223, 109, 10, 40, 29, 174, 116, 99, 91, 14, 179, 250, 209, 199, 29, 58, 47, 134, 94, 187, 26, 64, 84, 19,
-    119, 117, 112, 137, 74, 12, 116, 49, 165, 82, 201, 155, 108, 208, 210, 106, 252, 227, 100, 24, 129, 99, 172, 239,
-    181, 220, 203, 4, 247, 231, 145, 87, 138, 84, 163, 70, 152, 248, 255, 117, 25, 143, 61, 204, 245, 63, 173, 2, 122,
-    249, 68, 102, 140, 232, 49, 163, 55, 186, 119, 27, 226, 128, 238, 42, 211, 103, 176, 5, 202, 245, 216, 202, 38, 89,
-    112, 68, 220, 154, 178, 7, 179, 199, 81, 206, 28, 148, 179, 23, 140, 237, 191, 75, 55, 95, 80, 229, 201, 38, 178,
-    235, 209, 142, 49, 4, 185, 6, 155, 38, 130, 185, 174, 0, 66, 28, 111, 33, 114, 98, 180, 241, 139, 187, 99, 97, 125,
-    52, 37, 82, 64, 163, 100, 88, 196, 122, 16, 96, 50, 130, 92, 155, 90, 61, 147, 133, 143, 43, 250, 11, 193, 81, 242,
-    227, 164, 51, 77, 199, 89, 143, 80, 149, 24, 56, 26, 127, 175, 227, 190, 27, 46, 211, 85, 15, 106, 14, 163, 139,
-    206, 99, 240, 30, 187, 198, 59, 41, 83, 121, 120, 175, 113, 88, 111, 10, 94, 100, 172, 96, 165, 173, 216, 1, 183,
-    111, 25, 181, 250, 98, 166, 88, 21, 225, 21, 137, 112, 18, 189, 57, 51, 220, 31, 190, 18, 166, 112, 192, 142, 60,
-    59, 242, 36, 51, 89, 182, 227, 115, 236, 211, 177, 38, 29, 56, 239, 5, 9, 250, 113, 39, 24, 153, 92, 242, 228, 217,
-    48, 157, 132, 42, 126, 124, 18, 152, 135, 113, 148, 103, 222, 94, 212, 184, 95, 44, 194, 223, 70, 217, 115, 35, 190,
-    241, 242, 10, 180, 205, 224, 134, 234, 121, 125, 170, 42, 15, 233, 114, 41, 50, 29, 58, 193, 61, 3, 144, 33, 100,
-    96, 246, 8, 186, 226, 249, 253, 69, 149, 93, 5, 96, 74, 57, 33, 78, 65, 79, 123, 20, 76, 183, 120, 116, 122, 23, 24,
-    251, 190, 98, 223, 6, 63, 158, 166, 235, 180, 103, 110, 239, 215, 54, 14, 40, 44, 138, 97, 19, 224, 10, 242, 226,
-    112, 123, 199, 11, 250, 37, 100, 165, 215, 129, 159, 140, 63, 57, 230, 160, 45, 236, 167, 143, 226, 210, 40, 9, 51,
-    10, 41, 241, 210, 101, 187, 158, 112, 243, 130, 14, 190, 193, 20, 200, 205, 64, 157, 220, 227, 6, 46, 187, 87, 92,
-    85, 165, 85, 182, 123, 111, 98, 217, 86, 1, 23, 140, 57, 53, 55, 138, 177, 30, 226, 110, 117, 112, 70, 132, 6, 16,
-    222, 34, 12, 24, 122, 205, 179, 42, 132, 159, 131, 5, 124, 13, 127, 209, 227, 28, 86, 26, 4, 193, 76, 51, 140, 119,
-    184, 122, 15, 173, 99, 251, 139, 241, 125, 63, 190, 118, 3, 255, 123, 26, 166, 191, 53, 176, 181, 176, 180, 203, 39,
-    153, 82, 27, 130, 149, 95, 185, 133, 21, 111, 170, 32, 160, 48, 138, 82, 40, 196, 40, 59, 239, 254, 132, 194, 69,
-    37, 33, 197, 236, 249, 48, 225, 10, 68, 90, 165, 140, 83, 240, 71, 32, 67, 116, 80, 241, 249, 151, 103, 248, 65,
-    213, 116, 248, 173, 66, 253, 155, 216, 175, 82, 211, 69, 243, 200, 232, 224, 221, 139, 132, 66, 146, 14, 177, 93,
-    81, 133, 134, 122, 146, 67, 50, 194, 81, 197, 0, 132, 42, 100, 77, 185, 71, 195, 137, 211, 59, 119, 83, 230, 188,
-    155, 163, 82, 210, 79, 93, 157, 226, 180, 179, 231, 201, 226, 131, 131, 123, 225, 214, 102, 67, 224, 83, 124, 79,
-    228, 73, 49, 241, 194, 65, 101, 153, 217, 145, 45, 56, 107, 121, 115, 2, 169, 255, 40, 204, 79, 237, 163, 150, 138,
-    253, 84, 252, 18, 106, 117, 8, 127, 219, 205, 19, 47, 90, 47, 126, 212, 100, 65, 142, 224, 97, 34, 102, 230, 117,
-    31, 175, 167, 169, 115, 223, 170, 216, 99, 116, 26, 178, 227, 86, 179, 39, 234, 135, 3, 112, 147, 161, 107, 233,
-    144, 233, 167, 154, 115, 144, 239, 208, 25, 141, 131, 244, 34, 86, 54, 25, 59, 93, 182, 91, 18, 62, 159, 53, 231,
-    221, 112, 149, 221, 212, 28, 2, 130, 113, 252, 231, 140, 182, 6, 44, 220, 227, 229, 225, 206, 243, 132, 234, 123,
-    97, 169, 223, 179, 12, 178, 194, 189, 186, 14, 120, 110, 129, 142, 100, 90, 17, 238, 187, 86, 74, 229, 63, 45, 250,
-    228, 222, 70, 242, 5, 163, 229, 181, 215, 23, 83, 173, 147, 129, 140, 247, 225, 162, 95, 75, 104, 215, 167, 0, 55,
-    239, 181, 199, 218, 255, 146, 214, 76, 52, 205, 248, 79, 198, 95, 243, 46, 208, 12, 35, 161, 105, 151, 166, 18, 22,
-    52, 185, 165, 31, 135, 213, 191, 249, 34, 45, 188, 44, 7, 51, 70, 75, 238, 209, 239, 186, 169, 252, 157, 10, 70,
-    100, 177, 36, 64, 233, 124, 3, 84, 71, 120, 116, 189, 163, 163, 204, 171, 90, 169, 47, 184, 235, 151, 37, 196, 232,
-    147, 196, 150, 237, 192, 68, 212, 154, 28, 116, 41, 81, 20, 42, 224, 233, 107, 62, 132, 237, 27, 17, 34, 63, 75, 2,
-    118, 21, 207, 168, 90, 193, 100, 143, 105, 50, 208, 252, 248, 106, 202, 211, 142, 102, 234, 132, 240, 230, 245, 23,
-    44, 143, 187, 63, 62, 162, 38, 205, 23, 126, 211, 29, 100, 92, 172, 154, 29, 200, 51, 197, 33, 113, 105, 80, 131,
-    229, 48, 86, 52, 100, 25, 58, 248, 88, 28, 163, 188, 135, 83, 184, 1, 55, 224, 152, 22, 245, 134, 189, 104, 2, 7,
-    227, 126, 169, 147, 99, 90, 157, 102, 85, 246, 46, 93, 20, 188, 119, 185, 210, 156, 208, 245, 157, 217, 144, 168,
-    239, 97, 188, 63, 230, 106, 136, 100, 31, 27, 127, 169, 134, 195, 135, 102, 62, 135, 161, 85, 64, 30, 238, 115, 97,
-    47, 109, 242, 134, 242, 50, 54, 19, 138, 56, 48, 134, 248, 198, 225, 140, 25, 89, 129, 201, 216, 130, 56, 3, 180,
-    129, 8, 182, 8, 200, 58, 216, 112, 242, 111, 161, 227, 0, 19, 208, 49, 64, 183, 249, 204, 94, 179, 162, 19, 119, 2,
-    202, 45, 23, 75, 164, 248, 25, 112, 93, 223, 92, 254, 168, 31, 41, 55, 102, 239, 89, 176, 137, 162, 131, 234, 198,
-    83, 25, 117, 188, 109, 199, 1, 248, 48, 172, 154, 86, 77, 118, 40, 163, 217, 16, 230, 114, 153, 68, 192, 126, 102,
-    189, 157, 193, 107, 79, 102, 223, 245, 212, 241, 22, 183, 221, 189, 186, 87, 74, 197, 116, 63, 198, 95, 105, 221,
-    214, 79, 248, 92, 178, 241, 127, 76, 177, 184, 80, 129, 61, 219, 211, 14, 180, 23, 141, 227, 145, 252, 64, 204, 10,
-    7, 178, 208, 70, 213, 150, 95, 247, 53, 65, 19, 194, 255, 190, 79, 194, 11, 57, 39, 178, 25, 74, 207, 175, 93, 151,
-    131, 52, 8, 102, 89, 55, 16, 82, 163, 99, 165, 224, 207, 124, 24, 79, 178, 132, 4, 45, 179, 146, 197, 165, 39, 43,
-    32, 74, 202, 232, 181, 242, 200, 239, 83, 213, 3, 152, 233, 218, 2, 121, 236, 23, 78, 147, 169, 230, 2, 141, 232,
-    159, 129, 143, 74, 69, 29, 224, 192, 171, 88, 189, 224, 220, 143, 166, 3, 148, 229, 138, 20, 88, 42, 140, 70, 255,
-    55, 190, 92, 30, 18, 156, 154, 214, 223, 179, 95, 214, 105, 196, 16, 72, 206, 228, 121, 187, 138, 242, 181, 128,
-    190, 204, 254, 72, 58, 93, 176, 237, 116, 150, 18, 90, 130, 153, 184, 144, 201, 213, 13, 37, 38, 214, 98, 173, 85,
-    141, 182, 246, 61, 109, 12, 204, 56, 175, 186, 113, 34, 142, 225, 213, 150, 8, 35, 116, 254, 173, 144, 252, 252,
-    145, 179, 116, 33, 96, 199, 140, 233, 89, 131, 69, 246, 99, 116, 249, 24, 249, 249, 30, 236, 197, 182, 217, 45, 180,
-    218, 194, 71, 132, 40, 58, 105, 3, 185, 133, 236, 85, 41, 215, 139, 150, 243, 36, 251, 46, 55, 228, 167, 218, 164,
-    172, 61, 242, 165, 235, 43, 151, 109, 113, 191, 108, 197, 95, 208, 8, 203, 175, 198, 220, 62, 52, 132, 221, 116,
-    239, 209, 211, 182, 243, 247, 72, 201, 139, 9, 176, 38, 34, 28, 217, 184, 57, 87, 140, 129, 240, 193, 242, 217, 84,
-    26, 62, 254, 201, 137, 145, 163, 40, 86, 73, 34, 72, 165, 173, 240, 15, 111, 45, 10, 83, 131, 116, 59, 23, 1, 122,
-    12, 109, 166, 121, 122, 239, 177, 1, 1, 227, 131, 77, 121, 159, 226, 27, 27, 72, 252, 99, 24, 56, 10, 59, 246, 104,
-    50, 204, 20, 111, 141, 95, 162, 35, 192, 250, 186, 111, 36, 90, 243, 242, 206, 87, 14, 16, 119, 243, 5, 168, 26,
-    253, 181, 181, 56, 6, 28, 222, 230, 26, 138, 65, 221, 214, 225, 218, 95, 116, 220, 28, 78, 223, 109, 98, 168, 75,
-    244, 134, 85, 51, 0, 41, 65, 187, 23, 9, 237, 10, 128, 81, 232, 116, 76, 72, 155, 55, 236, 200, 154, 46, 211, 168,
-    146, 28, 136, 130, 105, 124, 13, 48, 10, 208, 103, 75, 70, 7, 24, 245, 74, 112, 205, 156, 24, 29, 242, 226, 68, 89,
-    230, 223, 22, 44, 23, 101, 103, 84, 194, 35, 71, 54, 112, 105, 111, 141, 147, 159, 116, 120, 176, 151, 185, 132, 43,
-    53, 170, 20, 73, 189, 133, 130, 193, 146, 182, 32, 211, 175, 181, 93, 3, 85, 77, 29, 39, 17, 141, 181, 180, 228,
-    149, 3, 82, 20, 118, 59, 75, 21, 5, 33, 60, 197, 163, 232, 179, 244, 60, 169, 240, 26, 190, 139, 96, 90, 51, 166,
-    44, 147, 210, 149, 32, 132, 181, 217, 224, 235, 221, 170, 83, 130, 105, 81, 60, 51, 187, 47, 12, 26, 121, 177, 172,
-    135, 103, 223, 183, 155, 29, 164, 103, 234, 96, 100, 212, 72, 202, 39, 228, 127, 252, 135, 202, 22, 103, 50, 150,
-    183, 13, 131, 177, 188, 105, 143, 191, 195, 89, 117, 233, 0, 207, 70, 245, 108, 250, 214, 122, 255, 32, 100, 217,
-    68, 83, 212, 253, 94, 142, 4, 122, 69, 240, 204, 156, 12, 37, 179, 238, 38, 169, 105, 73, 10, 152, 191, 163, 138,
-    53, 157, 235, 254, 109, 187, 219, 37, 47, 250, 119, 235, 221, 167, 172, 29, 236, 189, 34, 229, 106, 250, 41, 105,
-    180, 171, 180, 124, 231, 56, 206, 6, 22, 146, 87, 5, 42, 148, 123, 194, 25, 246, 52, 240, 58, 243, 105, 102, 12, 76,
-    197, 135, 190, 25, 85, 171, 108, 8, 117, 19, 181, 125, 158, 57, 137, 218, 125, 114, 13, 59, 249, 163, 80, 215, 188,
-    41, 185, 6, 117, 65, 65, 96, 246, 97, 24, 218, 12, 220, 164, 127, 125, 174, 61, 196, 138, 38, 5, 15, 160, 2, 105,
-    11, 207, 83, 119, 204, 128, 53, 30, 39, 253, 88, 130, 68, 236, 10, 249, 55, 91, 158, 69, 111, 14, 179, 236, 174, 28,
-    125, 251, 88, 104, 60, 64, 28, 152, 211, 47, 172, 106, 29, 217, 76, 85, 109, 145, 210, 30, 141, 126, 168, 50, 171,
-    70, 73, 106, 178, 3, 25, 140, 211, 231, 41, 252, 124, 115, 95, 141, 140, 95, 185, 74, 59, 49, 122, 61, 242, 235, 9,
-    89, 12, 233, 131, 155, 173, 151, 164, 105, 169, 57, 111, 204, 110, 11, 173, 56, 82, 5, 235, 108, 239, 107, 65, 27,
-    221, 55, 169, 194, 69, 171, 161, 249, 188, 126, 213, 238, 19, 108, 111, 22, 216, 228, 144, 136, 46, 196, 33, 189, 5,
-    78, 40, 28, 222, 226, 185, 228, 85, 127, 71, 157, 74, 240, 41, 147, 18, 171, 16, 22, 212, 54, 31, 160, 137, 214,
-    127, 51, 166, 32, 167, 147, 137, 184, 20, 119, 153, 42, 214, 219, 52, 254, 219, 230, 72, 82, 15, 28, 204, 176, 186,
-    173, 135, 177, 44, 226, 99, 183, 61, 43, 66, 164, 207, 123, 210, 249, 236, 226, 113, 53, 1, 170, 180, 155, 138, 163,
-    7, 194, 108, 112, 59, 120, 69, 70, 131, 65, 112, 119, 98, 0, 84, 253, 139, 71, 0, 145, 19, 141, 244, 2, 8, 113, 126,
-    221, 19, 195, 62, 79, 161, 209, 102, 145, 221, 91, 7, 77, 166, 163, 30, 215, 152, 254, 22, 204, 199, 247, 19, 21,
-    62, 161, 197, 195, 11, 21, 161, 212, 219, 240, 197, 230, 201, 29, 27, 164, 89, 20, 85, 54, 33, 44, 36, 48, 107, 129,
-    147, 66, 62, 7, 178, 191, 174, 189, 220, 38, 249, 243, 145, 129, 205, 119, 109, 85, 73, 175, 233, 9, 247, 42, 115,
-    216, 189, 70, 116, 153, 220, 40, 37, 53, 47, 229, 247, 184, 19, 182, 179, 250, 116, 73, 201, 208, 147, 237, 255,
-    118, 76, 248, 97, 252, 153, 12, 129, 224, 137, 201, 154, 115, 37, 94, 3, 30, 178, 91, 20, 246, 159, 82, 245, 52,
-    203, 179, 224, 223, 16, 208, 24, 174, 17, 161, 240, 56, 121, 223, 122, 58, 134, 168, 122, 176, 112, 25, 133, 22,
-    118, 196, 178, 81, 36, 47, 56, 220, 52, 226, 226, 201, 87, 225, 4, 16, 167, 133, 180, 164, 194, 233, 22, 128, 219,
-    168, 70, 15, 119, 35, 44, 16, 219, 85, 96, 146, 231, 139, 75, 65, 136, 157, 154, 48, 135, 146, 18, 123, 249, 77, 90,
-    47, 58, 125, 196, 175, 14, 237, 203, 6, 220, 64, 172, 12, 123, 25, 80, 191, 7, 164, 185, 172, 212, 184, 245, 118,
-    216, 210, 47, 214, 219, 233, 68, 248, 249, 31, 107, 55, 152, 113, 233, 3, 30, 12, 78, 151, 76, 222, 219, 129, 123,
-    8, 131, 83, 188, 7, 135, 214, 32, 188, 183, 17, 188, 165, 134, 243, 23, 155, 16, 92, 107, 203, 239, 118, 85, 150,
-    80, 119, 128, 129, 41, 199, 38, 244, 253, 185, 245, 137, 110, 207, 251, 79, 179, 236, 21, 61, 42, 102, 123, 132,
-    208, 62, 219, 204, 142, 179, 153, 95, 166, 1, 174, 164, 36, 186, 196, 100, 63, 246, 127, 232, 6, 212, 6, 25, 90,
-    215, 17, 219, 39, 140, 139, 8, 182, 6, 214, 91, 158, 53, 75, 216, 182, 66, 120, 26, 52, 249, 68, 114, 208, 191, 141,
-    58, 112, 246, 107, 144, 230, 254, 194, 89, 119, 54, 68, 171, 195, 201, 238, 213, 45, 241, 59, 187, 227, 52, 105,
-    249, 215, 249, 226, 163, 125, 130, 175, 183, 108, 21, 180, 193, 128, 14, 213, 250, 228, 138, 1, 156, 16, 87, 65,
-    173, 225, 147, 136, 124, 65, 204, 34, 59, 28, 39, 86, 193, 8, 117, 93, 187, 25, 47, 160, 213, 43, 243, 224, 219,
-    185, 97, 47, 247, 137, 120, 27, 246, 176, 129, 13, 221, 230, 98, 49, 68, 216, 59, 249, 229, 236, 44, 107, 27, 65,
-    56, 188, 209, 183, 98, 37, 68, 141, 80, 162, 7, 18, 176, 11, 195, 73, 176, 3, 145, 248, 216, 176, 202, 91, 66, 118,
-    210, 37, 149, 22, 26, 197, 190, 32, 145, 179, 155, 30, 1, 224, 96, 81, 135, 35, 93, 234, 38, 94, 124, 233, 42, 159,
-    245, 26, 41, 82, 71, 129, 38, 251, 167, 81, 197, 190, 237, 238, 218, 103, 120, 46, 210, 77, 124, 185, 217, 136, 60,
-    184, 2, 57, 154, 193, 171, 12, 29, 235, 45, 85, 162, 152, 75, 50, 153, 128, 105, 255, 15, 216, 182, 101, 66, 28,
-    124, 229, 140, 192, 17, 33, 226, 9, 16, 208, 203, 53, 3, 240, 56, 41, 244, 167, 83, 103, 38, 156, 50, 48, 16, 204,
-    247, 30, 178, 85, 233, 85, 233, 200, 66, 50, 86, 193, 35, 141, 155, 184, 14, 47, 136, 83, 48, 14, 196, 137, 49, 22,
-    133, 91, 83, 132, 172, 151, 220, 233, 78, 81, 66, 81, 2, 253, 146, 209, 250, 176, 65, 71, 206, 144, 43, 216, 238, 3,
-    205, 124, 21, 161, 99, 198, 176, 181, 23, 159, 107, 144, 17, 143, 109, 115, 26, 123, 222, 69, 129, 129, 134, 128,
-    93, 98, 203, 53, 212, 203, 31, 170, 52, 241, 89, 186, 114, 66, 246, 75, 95, 153, 35, 9, 226, 4, 199, 75, 232, 227,
-    222, 138, 176, 78, 201, 132, 194, 77, 228, 230, 187, 158, 92, 68, 131, 225, 254, 55, 188, 213, 215, 48, 143, 67,
-    114, 7, 140, 102, 229, 223, 7, 94, 125, 239, 97, 17, 134, 251, 113, 135, 193, 234, 226, 24, 29, 154, 187, 176, 146,
-    231, 131, 21, 223, 9, 175, 22, 95, 14, 129, 239, 101, 43, 47, 85, 68, 14, 76, 62, 210, 88, 106, 99, 208, 125, 85, 9,
-    166, 128, 246, 84, 140, 197, 120, 156, 253, 14, 194, 253, 62, 89, 220, 74, 226, 33, 108, 236, 176, 208, 191, 66, 50,
-    197, 26, 18, 7, 119, 176, 177, 203, 40, 164, 86, 9, 224, 10, 57, 155, 140, 189, 137, 239, 215, 224, 239, 36, 107,
-    139, 154, 229, 180, 199, 247, 66, 48, 198, 40, 49, 44, 11, 246, 130, 33, 33, 221, 180, 118, 42, 109, 133, 14, 3,
-    217, 195, 64, 87, 7, 110, 23, 244, 79, 176, 0, 106, 163, 185, 138, 176, 125, 25, 63, 155, 41, 57, 77, 57, 162, 1,
-    98, 64, 66, 34, 212, 40, 82, 188, 77, 18, 52, 132, 214, 111, 198, 190, 93, 207, 48, 58, 255, 45, 44, 207, 207, 137,
-    52, 228, 243, 8, 47, 250, 157, 107, 137, 120, 57, 159, 175, 248, 245, 50, 201, 7, 145, 142, 208, 132, 25, 100, 242,
-    104, 175, 239, 6, 123, 141, 52, 89, 65, 124, 41, 72, 98, 15, 163, 234, 83, 19, 197, 247, 71, 228, 222, 214, 254,
-    173, 18, 124, 90, 238, 80, 128, 6, 243, 211, 103, 67, 229, 233, 237, 245, 117, 180, 187, 147, 162, 24, 15, 10, 5,
-    130, 137, 133, 189, 208, 16, 45, 231, 231, 200, 75, 3, 61, 239, 21, 100, 205, 250, 217, 42, 85, 133, 8, 196, 46, 0,
-    73, 11, 245, 124, 164, 136, 253, 145, 88, 205, 53, 224, 91, 100, 185, 197, 58, 230, 63, 210, 37, 22, 155, 105, 187,
-    122, 134, 226, 69, 104, 51, 68, 25, 153, 147, 28, 28, 169, 153, 87, 40, 47, 221, 113, 141, 179, 113, 20, 125, 198,
-    36, 20, 101, 182, 128, 157, 87, 148, 125, 89, 9, 175, 200, 170, 56, 171, 123, 24, 165, 73, 119, 129, 88, 150, 38,
-    190, 163, 178, 16, 174, 29, 145, 44, 210, 81, 81, 65, 199, 193, 237, 64, 242, 35, 22, 202, 9, 2, 13, 133, 250, 162,
-    183, 163, 4, 155, 128, 245, 249, 58, 13, 177, 223, 215, 239, 169, 87, 101, 199, 247, 42, 53, 185, 0, 41, 87, 130, 6,
-    228, 118, 14, 238, 90, 88, 192, 88, 23, 112, 117, 83, 47, 39, 22, 255, 59, 40, 254, 123, 231, 139, 235, 57, 99, 101,
-    0, 93, 176, 7, 225, 208, 87, 53, 224, 52, 3, 89, 139, 187, 29, 54, 161, 156, 51, 226, 58, 127, 23, 143, 215, 87,
-    191, 253, 211, 208, 88, 7, 203, 87, 137, 231, 82, 56, 6, 38, 220, 68, 226, 179, 201, 247, 194, 186, 208, 161, 125,
-    45, 141, 220, 81, 61, 189, 88, 92, 129, 184, 105, 220, 35, 63, 129, 72, 62, 71, 158, 245, 189, 142, 190, 222, 202,
-    165, 254, 215, 139, 167, 187, 121, 88, 99, 1, 177, 217, 227, 120, 125, 51, 210, 57, 198, 62, 93, 64, 106, 209, 36,
-    84, 51, 147, 34, 255, 132, 236, 101, 116, 171, 98, 199, 174, 156, 218, 154, 132, 1, 129, 70, 199, 230, 3, 38, 243,
-    99, 246, 174, 7, 181, 245, 253, 65, 224, 48, 84, 213, 255, 62, 103, 79, 48, 222, 7, 49, 39, 21, 80, 182, 22, 148,
-    135, 241, 157, 115, 24, 65, 3, 1, 52, 53, 130, 208, 161, 27, 97, 47, 71, 5, 182, 128, 76, 45, 76, 64, 231, 101, 178,
-    17, 13, 190, 190, 50, 89, 167, 212, 134, 133, 51, 58, 122, 156, 180, 120, 59, 2, 23, 10, 137, 113, 88, 35, 188, 158,
-    98, 95, 61, 172, 94, 69, 55, 130, 31, 56, 187, 158, 79, 17, 255, 26, 233, 249, 159, 2, 60, 171, 186, 54, 117, 248,
-    23, 213, 134, 117, 3, 35, 236, 104, 176, 208, 246, 39, 76, 235, 198, 174, 98, 12, 58, 6, 25, 64, 251, 175, 88, 177,
-    5, 230, 171, 18, 82, 34, 188, 106, 61, 197, 81, 152, 210, 73, 125, 125, 217, 149, 211, 127, 87, 161, 202, 207, 4,
-    252, 137, 67, 139, 255, 123, 187, 157, 251, 238, 133, 44, 197, 72, 23, 60, 95, 141, 236, 62, 82, 165, 111, 53, 160,
-    36, 98, 217, 55, 23, 77, 32, 36, 145, 52, 72, 58, 223, 238, 83, 55, 1, 232, 118, 192, 13, 98, 217, 221, 157, 155,
-    53, 248, 166, 209, 36, 76, 11, 28, 149, 153, 49, 58, 206, 112, 88, 24, 119, 140, 41, 154, 121, 57, 135, 110, 205,
-    215, 158, 109, 11, 63, 11, 66, 153, 214, 75, 122, 184, 24, 251, 133, 217, 191, 246, 159, 254, 19, 63, 186, 168, 48,
-    189, 251, 164, 98, 33, 32, 130, 115, 46, 17, 3, 2, 86, 227, 115, 52, 51, 22, 91, 112, 186, 78, 144, 187, 235, 198,
-    57, 239, 89, 157, 214, 180, 147, 238, 145, 81, 253, 51, 152, 171, 115, 252, 87, 90, 81, 7, 221, 60, 159, 237, 98,
-    96, 246, 242, 126, 148, 97, 158, 1, 39, 79, 214, 221, 83, 25, 10, 52, 121, 45, 125, 81, 32, 197, 215, 91, 54, 87,
-    30, 133, 126, 121, 45, 34, 217, 169, 180, 15, 83, 205, 167, 105, 34, 63, 181, 103, 87, 212, 21, 112, 30, 176, 194,
-    28, 159, 69, 80, 158, 167, 121, 245, 224, 76, 123, 143, 241, 138, 183, 230, 231, 251, 250, 183, 185, 25, 92, 160,
-    244, 165, 171, 253, 26, 44, 26, 128, 124, 136, 151, 56, 45, 93, 137, 22, 60, 133, 212, 134, 166, 119, 175, 200, 121,
-    3, 145, 154, 225, 39, 104, 219, 216, 188, 173, 139, 71, 35, 67, 63, 183, 179, 148, 70, 196, 37, 150, 63, 240, 29,
-    192, 63, 137, 229, 209, 197, 97, 215, 214, 174, 60, 196, 35, 68, 156, 122, 182, 61, 106, 0, 65, 210, 189, 62, 88,
-    179, 77, 199, 189, 15, 198, 79, 171, 111, 187, 7, 193, 145, 247, 215, 72, 101, 96, 188, 254, 184, 144, 21, 112, 104,
-    60, 147, 240, 93, 56, 153, 190, 94, 207, 157, 34, 187, 68, 16, 178, 117, 214, 104, 54, 197, 6, 54, 233, 103, 111,
-    156, 39, 16, 135, 13, 33, 127, 40, 160, 192, 71, 140, 82, 240, 188, 88, 111, 249, 65, 253, 221, 246, 92, 157, 236,
-    94, 193, 20, 106, 116, 152, 113, 60, 100, 10, 44, 117, 62, 178, 251, 74, 253, 232, 56, 46, 25, 137, 97, 234, 21, 92,
-    112, 134, 106, 98, 170, 204, 250, 3, 131, 207, 245, 21, 31, 141, 108, 23, 121, 198, 201, 149, 112, 147, 96, 229, 13,
-    221, 253, 113, 155, 7, 16, 50, 167, 191, 161, 163, 116, 166, 159, 189, 240, 42, 247, 101, 45, 44, 195, 2, 232, 124,
-    208, 148, 179, 56, 59, 236, 33, 36, 246, 222, 25, 225, 219, 118, 242, 5, 236, 178, 118, 57, 14, 4, 168, 86, 159,
-    119, 125, 254, 121, 194, 116, 97, 213, 121, 132, 167, 238, 63, 193, 30, 138, 119, 234, 159, 10, 97, 181, 179, 120,
-    188, 202, 172, 151, 63, 132, 252, 178, 21, 116, 246, 91, 59, 161, 12, 68, 105, 153, 23, 177, 191, 23, 111, 231, 133,
-    1, 37, 1, 138, 149, 247, 172, 188, 135, 227, 243, 204, 245, 229, 15, 149, 102, 19, 86, 185, 59, 182, 6, 170, 216,
-    101, 128, 86, 38, 98, 144, 100, 189, 69, 32, 206, 90, 231, 86, 209, 220, 39, 89, 200, 237, 235, 178, 37, 215, 245,
-    80, 38, 50, 64, 183, 201, 105, 240, 54, 199, 176, 235, 147, 180, 200, 230, 149, 41, 56, 18, 94, 141, 87, 191, 192,
-    252, 235, 74, 127, 184, 138, 194, 218, 24, 199, 200, 166, 135, 211, 160, 67, 116, 44, 220, 33, 75, 14, 97, 172, 156,
-    129, 146, 198, 155, 98, 242, 137, 117, 83, 198, 197, 211, 61, 235, 13, 66, 29, 39, 18, 225, 193, 24, 164, 138, 170,
-    187, 72, 255, 117, 205, 241, 216, 180, 149, 88, 227, 124, 41, 236, 144, 205, 246, 219, 217, 107, 112, 170, 229, 144,
-    161, 142, 172, 202, 249, 65, 231, 105, 90, 159, 135, 245, 44, 182, 43, 126, 141, 76, 87, 249, 232, 219, 226, 219,
-    86, 242, 21, 59, 137, 129, 168, 78, 95, 208, 6, 126, 182, 133, 159, 121, 111, 48, 211, 98, 23, 7, 249, 192, 150,
-    162, 117, 224, 254, 49, 175, 66, 107, 167, 77, 123, 148, 239, 45, 93, 154, 218, 162, 139, 96, 246, 4, 101, 26, 46,
-    104, 192, 252, 117, 131, 220, 215, 252, 12, 134, 30, 66, 232, 83, 72, 219, 236, 3, 22, 131, 172, 168, 59, 60, 52,
-    227, 138, 12, 25, 252, 253, 40, 206, 108, 75, 121, 44, 193, 235, 170, 126, 187, 165, 250, 20, 112, 156, 146, 229,
-    33, 180, 94, 232, 156, 216, 203, 127, 168, 91, 199, 45, 218, 253, 158, 45, 239, 156, 33, 124, 201, 190, 136, 39, 59,
-    237, 29, 76, 97, 215, 137, 26, 47, 106, 185, 242, 174, 49, 78, 220, 62, 14, 55, 37, 44, 27, 218, 228, 57, 20, 50,
-    92, 216, 194, 62, 124, 246, 81, 227, 216, 199, 14, 65, 0, 54, 130, 92, 5, 189, 12, 127, 8, 64, 244, 9, 151, 136, 7,
-    135, 80, 174, 248, 1, 141, 115, 1, 165, 59, 178, 112, 19, 50, 137, 21, 74, 73, 190, 68, 208, 214, 54, 27, 214, 86,
-    77, 252, 123, 145, 152, 97, 228, 202, 59, 7, 89, 134, 230, 212, 44, 80, 100, 131, 178, 78, 99, 164, 38, 223, 76,
-    159, 31, 0, 43, 175, 146, 101, 76, 132, 85, 45, 41, 174, 252, 104, 210, 154, 165, 129, 195, 146, 187, 1, 54, 228,
-    144, 239, 0, 77, 75, 57, 116, 9, 37, 239, 28, 158, 147, 170, 206, 226, 236, 140, 49, 169, 52, 211, 231, 51, 29, 4,
-    12, 160, 180, 52, 100, 65, 255, 93, 9, 81, 217, 240, 42, 24, 237, 165, 101, 149, 186, 92, 82, 140, 79, 144, 5, 218,
-    241, 14, 225, 142, 229, 145, 71, 212, 143, 222, 160, 140, 37, 91, 228, 37, 69, 179, 203, 120, 33, 106, 92, 154, 36,
-    10, 171, 111, 17, 109, 162, 79, 219, 208, 94, 162, 23, 208, 230, 44, 48, 19, 230, 2, 170, 220, 16, 118, 155, 228,
-    183, 22, 207, 18, 36, 195, 116, 173, 170, 225, 201, 194, 74, 182, 148, 162, 207, 232, 146, 9, 240, 236, 55, 40, 240,
-    225, 175, 143, 20, 226, 28, 146, 201, 253, 54, 32, 241, 34, 246, 69, 46, 213, 9, 93, 163, 146, 140, 146, 121, 133,
-    181, 178, 113, 30, 215, 71, 60, 224, 21, 245, 89, 241, 4, 27, 228, 32, 86, 94, 105, 75, 113, 224, 129, 105, 20, 233,
-    203, 252, 154, 102, 141, 87, 87, 162, 159, 136, 141, 176, 208, 255, 195, 48, 107, 159, 169, 145, 227, 93, 103
+    123, 34, 67, 111, 109, 112, 111, 110, 101, 110, 116, 78, 97, 109, 101, 34, 58, 32, 34, 80, 97, 108, 34, 44, 32, 34,
+    68, 114, 105, 118, 101, 114, 83, 116, 97, 116, 101, 34, 58, 32, 91, 34, 72, 97, 108, 116, 101, 100, 79, 110, 68,
+    101, 118, 105, 99, 101, 73, 110, 105, 116, 34, 93, 44, 32, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32,
+    91, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 70, 81, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80,
+    117, 98, 108, 105, 99, 32, 67, 67, 67, 32, 79, 112, 116, 105, 111, 110, 115, 34, 93, 44, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 125, 44, 32, 34, 83, 99,
+    111, 112, 101, 34, 58, 32, 34, 80, 117, 98, 108, 105, 99, 67, 97, 116, 97, 108, 121, 115, 116, 75, 101, 121, 34, 44,
+    32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98,
+    108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 116, 101, 120, 116, 117, 114, 101, 79, 112, 116, 76, 101, 118, 101, 108,
+    34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111,
+    108, 115, 32, 116, 101, 120, 116, 117, 114, 101, 32, 102, 105, 108, 116, 101, 114, 105, 110, 103, 32, 111, 112, 116,
+    105, 109, 105, 122, 97, 116, 105, 111, 110, 115, 32, 101, 120, 112, 111, 115, 101, 100, 32, 98, 121, 32, 67, 67, 67,
+    46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 50, 54, 53, 50, 52, 48, 52, 53, 56, 125, 44,
+    32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 97, 116, 97, 108, 121, 115, 116, 65, 73, 34, 44, 32, 34, 84, 97,
+    103, 115, 34, 58, 32, 91, 34, 80, 117, 98, 108, 105, 99, 32, 67, 67, 67, 32, 79, 112, 116, 105, 111, 110, 115, 34,
+    93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58,
+    32, 49, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 117, 98, 108, 105, 99, 67, 97, 116, 97, 108,
+    121, 115, 116, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44,
+    32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 97, 116, 97, 108, 121, 115, 116,
+    65, 73, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114,
+    111, 108, 115, 32, 97, 112, 112, 32, 100, 101, 116, 101, 99, 116, 32, 97, 110, 100, 32, 105, 109, 97, 103, 101, 32,
+    113, 117, 97, 108, 105, 116, 121, 32, 97, 108, 116, 101, 114, 105, 110, 103, 32, 111, 112, 116, 105, 109, 105, 122,
+    97, 116, 105, 111, 110, 115, 32, 101, 120, 112, 111, 115, 101, 100, 32, 98, 121, 32, 67, 67, 67, 46, 34, 44, 32, 34,
+    72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 57, 48, 49, 57, 56, 54, 51, 52, 56, 125, 44, 32, 123, 34, 86,
+    97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 73, 115, 69, 120, 99, 108, 117, 115, 105, 118,
+    101, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 65, 108, 119, 97, 121, 115, 32, 114, 117, 110, 32, 116, 104,
+    101, 32, 112, 114, 101, 97, 109, 98, 108, 101, 32, 99, 109, 100, 32, 115, 116, 114, 101, 97, 109, 34, 44, 32, 34,
+    86, 97, 108, 117, 101, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 79, 110, 108, 121, 32, 114, 117, 110, 32, 116, 104, 101, 32, 112, 114, 101, 97, 109,
+    98, 108, 101, 32, 99, 109, 100, 32, 115, 116, 114, 101, 97, 109, 32, 119, 104, 101, 110, 32, 110, 101, 99, 101, 115,
+    115, 97, 114, 121, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 102, 97, 108, 115, 101, 125, 93, 125, 44, 32,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 70, 111, 114, 99, 101, 80, 114, 101, 97, 109, 98, 108, 101, 67, 109, 100, 83,
+    116, 114, 101, 97, 109, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101, 114, 97, 108, 34,
+    44, 32, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99,
+    111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121,
+    112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101,
+    34, 58, 32, 34, 102, 111, 114, 99, 101, 80, 114, 101, 97, 109, 98, 108, 101, 67, 109, 100, 83, 116, 114, 101, 97,
+    109, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114,
+    111, 108, 115, 32, 119, 104, 101, 116, 104, 101, 114, 32, 116, 104, 101, 32, 112, 114, 101, 97, 109, 98, 108, 101,
+    32, 99, 111, 109, 109, 97, 110, 100, 32, 115, 116, 114, 101, 97, 109, 32, 102, 111, 114, 32, 97, 32, 81, 117, 101,
+    117, 101, 32, 105, 115, 32, 97, 108, 119, 97, 121, 115, 32, 115, 117, 98, 109, 105, 116, 116, 101, 100, 32, 111,
+    114, 32, 115, 107, 105, 112, 112, 101, 100, 32, 119, 104, 101, 110, 32, 116, 104, 101, 32, 115, 97, 109, 101, 32,
+    115, 99, 104, 101, 100, 117, 108, 101, 114, 32, 99, 111, 110, 116, 101, 120, 116, 32, 114, 117, 110, 115, 32, 98,
+    97, 99, 107, 45, 116, 111, 45, 98, 97, 99, 107, 32, 111, 110, 32, 116, 104, 101, 32, 67, 80, 32, 114, 105, 110, 103,
+    46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 57, 56, 55, 57, 52, 55, 52, 57, 54, 125, 44,
+    32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 115, 121, 110, 99, 83, 117, 98, 109, 105, 116, 81, 117, 101, 117,
+    101, 84, 121, 112, 101, 77, 97, 115, 107, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101,
+    114, 97, 108, 34, 44, 32, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 93, 44, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 83,
+    99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84,
+    121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78,
+    97, 109, 101, 34, 58, 32, 34, 97, 115, 121, 110, 99, 83, 117, 98, 109, 105, 116, 81, 117, 101, 117, 101, 84, 121,
+    112, 101, 77, 97, 115, 107, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 66,
+    105, 116, 109, 97, 115, 107, 32, 111, 102, 32, 81, 117, 101, 117, 101, 84, 121, 112, 101, 32, 118, 97, 108, 117,
+    101, 115, 32, 40, 49, 32, 60, 60, 32, 81, 117, 101, 117, 101, 84, 121, 112, 101, 41, 32, 119, 104, 111, 115, 101,
+    32, 81, 117, 101, 117, 101, 115, 32, 104, 97, 110, 100, 32, 79, 83, 32, 115, 117, 98, 109, 105, 115, 115, 105, 111,
+    110, 32, 111, 102, 102, 32, 116, 111, 32, 97, 32, 112, 101, 114, 45, 81, 117, 101, 117, 101, 32, 119, 111, 114, 107,
+    101, 114, 32, 116, 104, 114, 101, 97, 100, 46, 32, 83, 117, 98, 109, 105, 116, 115, 44, 32, 115, 101, 109, 97, 112,
+    104, 111, 114, 101, 32, 111, 112, 101, 114, 97, 116, 105, 111, 110, 115, 44, 32, 112, 114, 101, 115, 101, 110, 116,
+    115, 32, 97, 110, 100, 32, 102, 101, 110, 99, 101, 32, 97, 115, 115, 111, 99, 105, 97, 116, 105, 111, 110, 115, 32,
+    111, 110, 32, 116, 104, 111, 115, 101, 32, 81, 117, 101, 117, 101, 115, 32, 97, 114, 101, 32, 98, 97, 116, 99, 104,
+    101, 100, 32, 105, 110, 32, 111, 114, 100, 101, 114, 32, 97, 110, 100, 32, 101, 120, 101, 99, 117, 116, 101, 100,
+    32, 97, 115, 121, 110, 99, 104, 114, 111, 110, 111, 117, 115, 108, 121, 46, 32, 84, 105, 109, 101, 114, 32, 81, 117,
+    101, 117, 101, 115, 32, 97, 114, 101, 32, 110, 101, 118, 101, 114, 32, 97, 115, 121, 110, 99, 104, 114, 111, 110,
+    111, 117, 115, 46, 32, 48, 32, 100, 105, 115, 97, 98, 108, 101, 115, 32, 116, 104, 101, 32, 102, 101, 97, 116, 117,
+    114, 101, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 50, 52, 48, 53, 54, 57, 50, 51,
+    48, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 115, 121, 110, 99, 83, 117, 98, 109, 105, 116, 81,
+    117, 101, 117, 101, 68, 101, 112, 116, 104, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101,
+    114, 97, 108, 34, 44, 32, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 93, 44, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 56, 125, 44, 32, 34, 83,
+    99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84,
+    121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78,
+    97, 109, 101, 34, 58, 32, 34, 97, 115, 121, 110, 99, 83, 117, 98, 109, 105, 116, 81, 117, 101, 117, 101, 68, 101,
+    112, 116, 104, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97, 120,
+    105, 109, 117, 109, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 115, 117, 98, 109, 105, 115, 115, 105, 111,
+    110, 115, 32, 119, 104, 105, 99, 104, 32, 109, 97, 121, 32, 98, 101, 32, 112, 101, 110, 100, 105, 110, 103, 32, 111,
+    110, 32, 97, 110, 32, 97, 115, 121, 110, 99, 104, 114, 111, 110, 111, 117, 115, 32, 115, 117, 98, 109, 105, 115,
+    115, 105, 111, 110, 32, 119, 111, 114, 107, 101, 114, 32, 98, 101, 102, 111, 114, 101, 32, 83, 117, 98, 109, 105,
+    116, 40, 41, 32, 98, 108, 111, 99, 107, 115, 32, 116, 104, 101, 32, 99, 97, 108, 108, 105, 110, 103, 32, 116, 104,
+    114, 101, 97, 100, 46, 32, 73, 103, 110, 111, 114, 101, 100, 32, 119, 104, 105, 108, 101, 32, 116, 104, 101, 32, 81,
+    117, 101, 117, 101, 32, 105, 115, 32, 115, 116, 97, 108, 108, 101, 100, 32, 111, 110, 32, 97, 32, 115, 101, 109, 97,
+    112, 104, 111, 114, 101, 32, 119, 97, 105, 116, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32,
+    49, 51, 53, 55, 51, 51, 48, 49, 57, 57, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 97, 120, 78,
+    117, 109, 67, 109, 100, 83, 116, 114, 101, 97, 109, 115, 80, 101, 114, 83, 117, 98, 109, 105, 116, 34, 44, 32, 34,
+    84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101, 114, 97, 108, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 83, 99, 111,
+    112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112,
+    101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109,
+    101, 34, 58, 32, 34, 109, 97, 120, 78, 117, 109, 67, 109, 100, 83, 116, 114, 101, 97, 109, 115, 80, 101, 114, 83,
+    117, 98, 109, 105, 116, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67,
+    111, 110, 116, 114, 111, 108, 115, 32, 116, 104, 101, 32, 109, 97, 120, 105, 109, 117, 109, 32, 110, 117, 109, 98,
+    101, 114, 32, 111, 102, 32, 99, 111, 109, 109, 97, 110, 100, 32, 115, 116, 114, 101, 97, 109, 115, 32, 116, 104, 97,
+    116, 32, 99, 97, 110, 32, 98, 101, 32, 115, 117, 98, 109, 105, 116, 116, 101, 100, 32, 97, 116, 32, 111, 110, 99,
+    101, 32, 116, 111, 32, 116, 104, 101, 32, 107, 101, 114, 110, 101, 108, 46, 32, 79, 118, 101, 114, 114, 105, 100,
+    101, 115, 32, 116, 104, 101, 32, 107, 101, 114, 110, 101, 108, 32, 109, 97, 120, 105, 109, 117, 109, 32, 118, 97,
+    108, 117, 101, 32, 105, 102, 32, 115, 101, 116, 32, 116, 111, 32, 97, 32, 118, 97, 108, 117, 101, 32, 62, 32, 48,
+    46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 52, 54, 55, 48, 52, 53, 56, 52, 57, 125, 44,
+    32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 82, 101, 113, 117, 101, 115, 116, 72, 105, 103, 104, 80, 114, 105,
+    111, 114, 105, 116, 121, 86, 109, 105, 100, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101,
+    114, 97, 108, 34, 44, 32, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 93, 44, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101,
+    125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121,
+    34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 114, 101, 113, 117, 101, 115, 116, 72, 105, 103, 104, 80, 114, 105, 111, 114,
+    105, 116, 121, 86, 109, 105, 100, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 82, 101, 113, 117, 101, 115, 116, 115, 32, 116, 104, 97, 116, 32, 99, 111, 110, 116, 101, 120, 116, 115, 32, 98,
+    101, 32, 99, 114, 101, 97, 116, 101, 100, 32, 119, 105, 116, 104, 32, 104, 105, 103, 104, 32, 112, 114, 105, 111,
+    114, 105, 116, 121, 32, 86, 77, 73, 68, 32, 116, 111, 32, 114, 101, 100, 117, 99, 101, 32, 112, 97, 103, 101, 32,
+    116, 97, 98, 108, 101, 32, 105, 110, 118, 97, 108, 105, 100, 97, 116, 105, 111, 110, 32, 112, 101, 110, 97, 108,
+    116, 105, 101, 115, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 53, 56, 48, 55, 51, 57,
+    50, 48, 50, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 82, 101, 113, 117, 101, 115, 116, 68, 101, 98,
+    117, 103, 86, 109, 105, 100, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101, 114, 97, 108,
+    34, 44, 32, 34, 68, 101, 98, 117, 103, 34, 44, 32, 34, 80, 114, 111, 102, 105, 108, 105, 110, 103, 34, 93, 44, 32,
+    34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97,
+    108, 115, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108,
+    75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114,
+    105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 114, 101, 113, 117, 101, 115, 116, 68, 101, 98, 117, 103,
+    86, 109, 105, 100, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 82, 101,
+    113, 117, 101, 115, 116, 115, 32, 116, 104, 97, 116, 32, 99, 111, 110, 116, 101, 120, 116, 115, 32, 98, 101, 32, 99,
+    114, 101, 97, 116, 101, 100, 32, 119, 105, 116, 104, 32, 97, 32, 100, 101, 98, 117, 103, 32, 86, 77, 73, 68, 46, 32,
+    84, 104, 105, 115, 32, 97, 108, 108, 111, 119, 115, 32, 102, 111, 114, 32, 98, 101, 116, 116, 101, 114, 32, 115,
+    104, 97, 100, 101, 114, 32, 100, 101, 98, 117, 103, 103, 105, 110, 103, 32, 98, 121, 32, 107, 101, 101, 112, 105,
+    110, 103, 32, 116, 104, 101, 32, 112, 97, 103, 101, 32, 116, 97, 98, 108, 101, 115, 32, 118, 97, 108, 105, 100, 32,
+    97, 102, 116, 101, 114, 32, 116, 104, 101, 32, 99, 111, 110, 116, 101, 120, 116, 32, 104, 97, 115, 32, 98, 101, 101,
+    110, 32, 115, 119, 105, 116, 99, 104, 101, 100, 32, 111, 117, 116, 46, 32, 32, 84, 104, 105, 115, 32, 105, 115, 32,
+    97, 108, 115, 111, 32, 117, 115, 101, 102, 117, 108, 32, 102, 111, 114, 32, 83, 81, 84, 84, 32, 112, 114, 111, 102,
+    105, 108, 105, 110, 103, 32, 97, 115, 32, 105, 116, 32, 101, 110, 115, 117, 114, 101, 115, 32, 98, 111, 116, 104,
+    32, 99, 111, 109, 112, 117, 116, 101, 32, 97, 110, 100, 32, 103, 114, 97, 112, 104, 105, 99, 115, 32, 113, 117, 101,
+    117, 101, 32, 119, 111, 114, 107, 32, 119, 105, 108, 108, 32, 115, 104, 97, 114, 101, 32, 116, 104, 101, 32, 115,
+    97, 109, 101, 32, 86, 77, 73, 68, 32, 97, 108, 108, 111, 119, 105, 110, 103, 32, 116, 104, 101, 32, 116, 104, 114,
+    101, 97, 100, 32, 116, 114, 97, 99, 101, 32, 116, 111, 32, 98, 101, 32, 102, 105, 108, 116, 101, 114, 101, 100, 32,
+    116, 111, 32, 97, 32, 115, 105, 110, 103, 108, 101, 32, 86, 77, 73, 68, 32, 40, 116, 111, 32, 97, 118, 111, 105,
+    100, 32, 99, 97, 112, 116, 117, 114, 105, 110, 103, 32, 111, 116, 104, 101, 114, 32, 112, 114, 111, 99, 101, 115,
+    115, 101, 115, 32, 119, 111, 114, 107, 41, 32, 119, 104, 105, 108, 101, 32, 115, 116, 105, 108, 108, 32, 99, 97,
+    112, 116, 117, 114, 105, 110, 103, 32, 97, 108, 108, 32, 119, 111, 114, 107, 32, 98, 121, 32, 116, 104, 101, 32,
+    116, 97, 114, 103, 101, 116, 32, 112, 114, 111, 99, 101, 115, 115, 46, 32, 78, 79, 84, 69, 58, 32, 82, 71, 80, 32,
+    116, 114, 97, 99, 105, 110, 103, 32, 97, 117, 116, 111, 109, 97, 116, 105, 99, 97, 108, 108, 121, 32, 114, 101, 113,
+    117, 101, 115, 116, 115, 32, 116, 104, 101, 32, 68, 101, 98, 117, 103, 32, 86, 77, 73, 68, 32, 100, 117, 114, 105,
+    110, 103, 32, 115, 101, 116, 117, 112, 32, 115, 111, 32, 116, 104, 101, 114, 101, 32, 105, 115, 32, 110, 111, 32,
+    110, 101, 101, 100, 32, 116, 111, 32, 99, 104, 97, 110, 103, 101, 32, 116, 104, 105, 115, 32, 115, 101, 116, 116,
+    105, 110, 103, 32, 119, 104, 101, 110, 32, 99, 97, 112, 116, 117, 114, 105, 110, 103, 32, 82, 71, 80, 32, 116, 114,
+    97, 99, 101, 115, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 53, 57, 55, 57, 50, 49,
+    52, 53, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 78, 101, 118, 101, 114, 67, 104, 97, 110, 103, 101,
+    67, 108, 111, 99, 107, 77, 111, 100, 101, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101,
+    114, 97, 108, 34, 44, 32, 34, 68, 101, 98, 117, 103, 34, 44, 32, 34, 80, 114, 111, 102, 105, 108, 105, 110, 103, 34,
+    93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58,
+    32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101,
+    80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86,
+    97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 110, 101, 118, 101, 114, 67, 104, 97, 110, 103,
+    101, 67, 108, 111, 99, 107, 77, 111, 100, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 115, 32, 115, 101, 116, 116, 105, 110, 103, 32, 71, 80, 85, 32, 99,
+    108, 111, 99, 107, 115, 32, 105, 110, 32, 116, 104, 101, 32, 100, 114, 105, 118, 101, 114, 32, 40, 101, 103, 46, 32,
+    100, 117, 114, 105, 110, 103, 32, 112, 114, 111, 102, 105, 108, 105, 110, 103, 41, 46, 32, 69, 110, 97, 98, 108,
+    101, 32, 116, 104, 105, 115, 32, 105, 102, 32, 117, 115, 105, 110, 103, 32, 65, 71, 77, 32, 116, 111, 32, 102, 111,
+    114, 99, 101, 32, 99, 108, 111, 99, 107, 32, 118, 97, 108, 117, 101, 115, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 50, 57, 51, 54, 49, 48, 54, 54, 55, 56, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97,
+    108, 117, 101, 115, 34, 58, 32, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 110, 115, 116, 114, 117, 99, 116, 115, 32, 116, 104, 101, 32, 100,
+    114, 105, 118, 101, 114, 32, 116, 111, 32, 117, 115, 101, 32, 97, 108, 108, 32, 82, 66, 115, 34, 44, 32, 34, 86, 97,
+    108, 117, 101, 34, 58, 32, 45, 49, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 68, 114, 105, 118, 101, 114, 32, 119, 105, 108, 108, 32, 99, 104, 111, 111, 115, 101, 32, 97, 110, 32,
+    111, 112, 116, 105, 109, 97, 108, 32, 118, 97, 108, 117, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48,
+    125, 44, 32, 123, 34, 76, 111, 103, 105, 99, 79, 112, 34, 58, 32, 34, 71, 114, 101, 97, 116, 101, 114, 84, 104, 97,
+    110, 79, 114, 69, 113, 117, 97, 108, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 73, 110, 115, 116, 114, 117, 99, 116, 115, 32, 116, 104, 101, 32, 100, 114, 105, 118, 101, 114, 32, 116,
+    111, 32, 117, 115, 101, 32, 116, 104, 105, 115, 32, 101, 120, 97, 99, 116, 32, 110, 117, 109, 98, 101, 114, 32, 111,
+    102, 32, 82, 66, 115, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 125, 93, 125, 44, 32, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 78, 111, 110, 108, 111, 99, 97, 108, 68, 101, 115, 116, 71, 114, 97, 112, 104, 105, 99, 115,
+    67, 111, 112, 121, 82, 98, 115, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101, 114, 97,
+    108, 34, 44, 32, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 83, 99, 111,
+    112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112,
+    101, 34, 58, 32, 34, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101,
+    34, 58, 32, 34, 110, 111, 110, 108, 111, 99, 97, 108, 68, 101, 115, 116, 71, 114, 97, 112, 104, 105, 99, 115, 67,
+    111, 112, 121, 82, 98, 115, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 83,
+    112, 101, 99, 105, 102, 105, 101, 115, 32, 116, 104, 101, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 82, 66,
+    115, 32, 117, 115, 101, 100, 32, 105, 110, 32, 97, 32, 103, 114, 97, 112, 104, 105, 99, 115, 32, 99, 111, 112, 121,
+    32, 116, 111, 32, 110, 111, 110, 108, 111, 99, 97, 108, 32, 100, 101, 115, 116, 105, 110, 97, 116, 105, 111, 110,
+    115, 46, 32, 32, 82, 101, 100, 117, 99, 105, 110, 103, 32, 116, 104, 101, 32, 110, 117, 109, 98, 101, 114, 32, 111,
+    102, 32, 82, 66, 115, 32, 99, 97, 110, 32, 105, 110, 99, 114, 101, 97, 115, 101, 32, 80, 67, 73, 101, 32, 116, 104,
+    114, 111, 117, 103, 104, 112, 117, 116, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 53, 48,
+    49, 57, 48, 49, 48, 48, 48, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32,
+    123, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 73, 115, 69, 120, 99, 108, 117,
+    115, 105, 118, 101, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 73, 102, 104, 77, 111, 100, 101, 68, 105, 115, 97, 98, 108, 101, 100, 34, 44, 32,
+    34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 73, 70, 72, 32, 105, 115, 32, 100, 105, 115, 97, 98, 108, 101, 100, 34, 125, 44, 32, 123, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 73, 102, 104, 77, 111, 100, 101, 80, 97, 108, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58,
+    32, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 70, 72, 32, 105, 115,
+    32, 105, 109, 112, 108, 101, 109, 101, 110, 116, 101, 100, 32, 105, 110, 32, 80, 65, 76, 32, 40, 107, 101, 114, 110,
+    101, 108, 32, 105, 115, 32, 110, 111, 116, 32, 99, 97, 108, 108, 101, 100, 41, 34, 125, 44, 32, 123, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 73, 102, 104, 77, 111, 100, 101, 75, 109, 100, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34,
+    58, 32, 50, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 70, 72, 32, 105,
+    115, 32, 105, 109, 112, 108, 101, 109, 101, 110, 116, 101, 100, 32, 105, 110, 32, 116, 104, 101, 32, 107, 101, 114,
+    110, 101, 108, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 73, 102, 104, 77, 111, 100, 101, 34, 44,
+    32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 70, 72, 32, 77, 111, 100, 101, 32,
+    115, 101, 116, 116, 105, 110, 103, 32, 118, 97, 108, 117, 101, 115, 46, 34, 125, 44, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 73, 70, 72, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101, 114, 97, 108, 34,
+    44, 32, 34, 68, 101, 98, 117, 103, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34,
+    68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 73, 102, 104, 77, 111, 100, 101, 68, 105, 115, 97, 98, 108, 101,
+    100, 34, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75,
+    101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 32, 34, 86, 97, 114, 105,
+    97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 105, 102, 104, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 73, 110, 102, 105, 110, 105, 116,
+    101, 108, 121, 32, 70, 97, 115, 116, 32, 72, 97, 114, 100, 119, 97, 114, 101, 32, 40, 73, 70, 72, 41, 32, 109, 111,
+    100, 101, 46, 32, 83, 101, 101, 32, 73, 102, 104, 71, 112, 117, 77, 97, 115, 107, 32, 102, 111, 114, 32, 119, 104,
+    105, 99, 104, 32, 65, 83, 73, 67, 115, 32, 97, 114, 101, 32, 97, 102, 102, 101, 99, 116, 101, 100, 32, 40, 100, 101,
+    102, 97, 117, 108, 116, 32, 97, 108, 108, 41, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51,
+    50, 57, 57, 56, 54, 52, 49, 51, 56, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 73, 100, 108, 101, 65,
+    102, 116, 101, 114, 83, 117, 98, 109, 105, 116, 71, 112, 117, 77, 97, 115, 107, 34, 44, 32, 34, 84, 97, 103, 115,
+    34, 58, 32, 91, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34, 68, 101, 98, 117, 103, 34, 44, 32, 34, 83, 97,
+    102, 101, 83, 101, 116, 116, 105, 110, 103, 34, 93, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115,
+    72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32,
+    123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79,
+    110, 34, 58, 32, 123, 34, 79, 83, 34, 58, 32, 91, 34, 87, 105, 110, 100, 111, 119, 115, 34, 93, 125, 44, 32, 34, 83,
+    99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84,
+    121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78,
+    97, 109, 101, 34, 58, 32, 34, 105, 100, 108, 101, 65, 102, 116, 101, 114, 83, 117, 98, 109, 105, 116, 71, 112, 117,
+    77, 97, 115, 107, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 100, 108,
+    101, 115, 32, 97, 102, 116, 101, 114, 32, 101, 97, 99, 104, 32, 99, 97, 108, 108, 32, 116, 111, 32, 83, 117, 98,
+    109, 105, 116, 32, 102, 111, 114, 32, 116, 104, 101, 32, 71, 80, 85, 39, 115, 32, 115, 112, 101, 99, 105, 102, 105,
+    101, 100, 32, 98, 121, 32, 116, 104, 101, 32, 98, 105, 116, 109, 97, 115, 107, 46, 32, 71, 80, 85, 39, 115, 32, 97,
+    114, 101, 32, 115, 112, 101, 99, 105, 102, 105, 101, 100, 32, 98, 121, 32, 116, 104, 101, 32, 112, 111, 115, 105,
+    116, 105, 111, 110, 32, 105, 110, 32, 116, 104, 101, 32, 98, 105, 116, 102, 105, 101, 108, 100, 32, 97, 110, 100,
+    32, 109, 97, 112, 32, 116, 111, 32, 116, 104, 101, 32, 76, 68, 65, 32, 99, 104, 97, 105, 110, 32, 97, 114, 114, 97,
+    121, 46, 32, 32, 69, 120, 97, 109, 112, 108, 101, 58, 32, 48, 120, 50, 32, 119, 111, 117, 108, 100, 32, 99, 97, 117,
+    115, 101, 32, 116, 104, 101, 32, 71, 80, 85, 32, 99, 111, 114, 114, 101, 115, 112, 111, 110, 100, 105, 110, 103, 32,
+    116, 111, 32, 116, 104, 101, 32, 50, 110, 100, 32, 76, 68, 65, 32, 99, 104, 97, 105, 110, 32, 105, 110, 32, 116,
+    104, 101, 32, 97, 114, 114, 97, 121, 32, 40, 97, 114, 114, 97, 121, 32, 112, 111, 115, 105, 116, 105, 111, 110, 32,
+    49, 41, 32, 116, 111, 32, 105, 100, 108, 101, 32, 97, 102, 116, 101, 114, 32, 101, 97, 99, 104, 32, 115, 117, 98,
+    109, 105, 116, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 54, 54, 53, 55, 57, 52, 48,
+    55, 57, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 73, 115, 69,
+    110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 73, 115, 69, 120, 99, 108, 117, 115, 105, 118, 101, 34,
+    58, 32, 116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 84, 111, 115, 115, 80, 111, 105, 110, 116, 78, 111, 110, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34,
+    58, 32, 48, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 78, 111, 114, 109, 97,
+    108, 32, 111, 112, 101, 114, 97, 116, 105, 111, 110, 44, 32, 116, 111, 115, 115, 32, 112, 111, 105, 110, 116, 32,
+    105, 115, 32, 100, 105, 115, 97, 98, 108, 101, 100, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84,
+    111, 115, 115, 80, 111, 105, 110, 116, 65, 102, 116, 101, 114, 82, 97, 115, 116, 101, 114, 34, 44, 32, 34, 86, 97,
+    108, 117, 101, 34, 58, 32, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 75,
+    105, 108, 108, 32, 82, 97, 115, 116, 101, 114, 105, 122, 101, 114, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 84, 111, 115, 115, 80, 111, 105, 110, 116, 87, 105, 114, 101, 102, 114, 97, 109, 101, 34, 44, 32, 34,
+    86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 70, 111, 114, 99, 101, 32, 87, 105, 114, 101, 102, 114, 97, 109, 101, 32, 102, 105, 108, 108, 32, 109, 111, 100,
+    101, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 111, 115, 115, 80, 111, 105, 110, 116, 66, 97,
+    99, 107, 70, 114, 111, 110, 116, 70, 97, 99, 101, 67, 117, 108, 108, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58,
+    32, 51, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 111, 114, 99, 101, 32,
+    98, 97, 99, 107, 32, 97, 110, 100, 32, 102, 114, 111, 110, 116, 32, 102, 97, 99, 101, 32, 99, 117, 108, 108, 105,
+    110, 103, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 111, 115, 115, 80, 111, 105, 110, 116, 65,
+    102, 116, 101, 114, 83, 101, 116, 117, 112, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 44, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 83, 99, 105, 115, 115, 111, 114, 45, 111, 117, 116,
+    32, 97, 108, 108, 32, 103, 101, 111, 109, 101, 116, 114, 121, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 84, 111, 115, 115, 80, 111, 105, 110, 116, 68, 101, 112, 116, 104, 67, 108, 105, 112, 68, 105, 115, 97, 98,
+    108, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 53, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 70, 111, 114, 99, 101, 32, 68, 101, 112, 116, 104, 45, 99, 108, 105, 112, 112, 105,
+    110, 103, 32, 100, 105, 115, 97, 98, 108, 101, 100, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84,
+    111, 115, 115, 80, 111, 105, 110, 116, 65, 102, 116, 101, 114, 80, 115, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34,
+    58, 32, 54, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98,
+    108, 101, 32, 67, 111, 108, 111, 114, 32, 66, 117, 102, 102, 101, 114, 32, 119, 114, 105, 116, 101, 115, 34, 125,
+    44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 111, 115, 115, 80, 111, 105, 110, 116, 83, 105, 109, 112,
+    108, 101, 80, 115, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 55, 44, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 85, 115, 101, 32, 97, 32, 116, 114, 105, 118, 105, 97, 108, 32, 80, 105,
+    120, 101, 108, 32, 83, 104, 97, 100, 101, 114, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 111,
+    115, 115, 80, 111, 105, 110, 116, 77, 111, 100, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 84, 111, 115, 115, 32, 80, 111, 105, 110, 116, 32, 77, 111, 100, 101, 115, 34, 125, 44, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 84, 111, 115, 115, 80, 111, 105, 110, 116, 77, 111, 100, 101, 34, 44, 32, 34, 84,
+    97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34, 80, 101, 114, 102, 111, 114, 109,
+    97, 110, 99, 101, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 34, 84, 111, 115, 115, 80, 111, 105, 110, 116, 78, 111, 110, 101, 34, 125, 44, 32, 34,
+    83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34,
+    84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97,
+    109, 101, 34, 58, 32, 34, 116, 111, 115, 115, 80, 111, 105, 110, 116, 77, 111, 100, 101, 34, 44, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 111, 115, 115, 32, 112, 111, 105, 110, 116, 115, 32,
+    101, 110, 97, 98, 108, 101, 115, 32, 115, 116, 114, 105, 112, 112, 105, 110, 103, 32, 111, 117, 116, 32, 111, 102,
+    32, 71, 80, 85, 32, 119, 111, 114, 107, 32, 102, 111, 114, 32, 109, 111, 114, 101, 32, 102, 111, 99, 117, 115, 101,
+    100, 32, 112, 101, 114, 102, 111, 114, 109, 97, 99, 101, 32, 97, 110, 97, 108, 121, 115, 105, 115, 46, 32, 84, 104,
+    105, 115, 32, 115, 101, 116, 116, 105, 110, 103, 32, 99, 111, 110, 116, 114, 111, 108, 115, 32, 119, 104, 105, 99,
+    104, 32, 119, 111, 114, 107, 32, 119, 105, 108, 108, 32, 98, 101, 32, 116, 111, 115, 115, 101, 100, 46, 34, 44, 32,
+    34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 52, 48, 49, 51, 54, 57, 57, 57, 125, 44, 32, 123, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 87, 100, 100, 109, 49, 70, 114, 101, 101, 86, 105, 114, 116, 117, 97, 108, 71, 112,
+    117, 77, 101, 109, 86, 65, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101, 114, 97, 108,
+    34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34,
+    58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116,
+    101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32,
+    34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 100, 100, 109, 49, 70, 114, 101, 101,
+    86, 105, 114, 116, 117, 97, 108, 71, 112, 117, 77, 101, 109, 86, 65, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 87, 104, 101, 116, 104, 101, 114, 32, 86, 65, 32, 111, 102, 32, 118, 105,
+    114, 116, 117, 97, 108, 32, 103, 112, 117, 32, 109, 101, 109, 111, 114, 121, 32, 119, 105, 108, 108, 32, 98, 101,
+    32, 102, 114, 101, 101, 100, 32, 97, 110, 100, 32, 114, 101, 116, 117, 114, 110, 101, 100, 32, 116, 111, 32, 86, 65,
+    77, 32, 97, 116, 32, 109, 101, 109, 111, 114, 121, 32, 100, 101, 115, 116, 114, 111, 121, 32, 116, 105, 109, 101,
+    32, 117, 110, 100, 101, 114, 32, 119, 100, 100, 109, 49, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34,
+    58, 32, 49, 50, 49, 50, 54, 56, 52, 51, 51, 57, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 70, 111,
+    114, 99, 101, 70, 105, 120, 101, 100, 70, 117, 110, 99, 67, 111, 108, 111, 114, 82, 101, 115, 111, 108, 118, 101,
+    34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34, 68, 101, 98,
+    117, 103, 34, 44, 32, 34, 82, 101, 115, 111, 117, 114, 99, 101, 32, 83, 101, 116, 116, 105, 110, 103, 115, 34, 93,
+    44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32,
+    102, 97, 108, 115, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80,
+    97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97,
+    114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 102, 111, 114, 99, 101, 70, 105, 120, 101, 100, 70,
+    117, 110, 99, 67, 111, 108, 111, 114, 82, 101, 115, 111, 108, 118, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 104, 105, 115, 32, 115, 101, 116, 116, 105, 110, 103, 32, 102, 111,
+    114, 99, 101, 115, 32, 77, 83, 65, 65, 32, 99, 111, 108, 111, 114, 32, 105, 109, 97, 103, 101, 115, 32, 116, 111,
+    32, 97, 108, 119, 97, 121, 115, 32, 112, 114, 101, 102, 101, 114, 32, 102, 105, 120, 101, 100, 32, 102, 117, 110,
+    99, 116, 105, 111, 110, 32, 114, 101, 115, 111, 108, 118, 101, 115, 32, 111, 118, 101, 114, 32, 97, 110, 121, 32,
+    111, 116, 104, 101, 114, 32, 114, 101, 115, 111, 108, 118, 101, 32, 109, 101, 116, 104, 111, 100, 32, 40, 105, 102,
+    32, 70, 105, 120, 101, 100, 70, 117, 110, 99, 32, 114, 101, 115, 111, 108, 118, 101, 115, 32, 97, 114, 101, 32, 115,
+    117, 112, 112, 111, 114, 116, 101, 100, 32, 98, 121, 32, 116, 104, 101, 32, 105, 109, 97, 103, 101, 41, 46, 32, 84,
+    104, 105, 115, 32, 119, 105, 108, 108, 32, 111, 118, 101, 114, 114, 105, 100, 101, 32, 116, 104, 101, 32, 99, 108,
+    105, 101, 110, 116, 39, 115, 32, 112, 114, 101, 102, 101, 114, 114, 101, 100, 32, 114, 101, 115, 111, 108, 118, 101,
+    32, 109, 101, 116, 104, 111, 100, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 50, 51, 57,
+    49, 54, 55, 50, 55, 51, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    54, 52, 45, 98, 105, 116, 32, 97, 100, 100, 114, 101, 115, 115, 32, 116, 111, 32, 117, 115, 101, 32, 102, 111, 114,
+    32, 117, 110, 98, 111, 117, 110, 100, 32, 100, 101, 115, 99, 114, 105, 112, 116, 111, 114, 115, 46, 32, 84, 104,
+    105, 115, 32, 119, 105, 108, 108, 32, 115, 104, 111, 119, 32, 117, 112, 32, 105, 110, 32, 116, 104, 101, 32, 102,
+    97, 117, 108, 116, 105, 110, 103, 32, 97, 100, 100, 114, 101, 115, 115, 32, 105, 102, 32, 97, 32, 112, 97, 103, 101,
+    32, 102, 97, 117, 108, 116, 32, 105, 115, 32, 116, 114, 105, 103, 103, 101, 114, 101, 100, 32, 100, 117, 101, 32,
+    116, 111, 32, 97, 110, 32, 117, 110, 98, 111, 117, 110, 100, 32, 100, 101, 115, 99, 114, 105, 112, 116, 111, 114,
+    32, 105, 110, 32, 97, 110, 32, 97, 112, 112, 108, 105, 99, 97, 116, 105, 111, 110, 46, 34, 44, 32, 34, 84, 97, 103,
+    115, 34, 58, 32, 91, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34, 83, 97, 102, 101, 83, 101, 116, 116, 105,
+    110, 103, 34, 93, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116,
+    114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117,
+    108, 116, 34, 58, 32, 49, 54, 48, 52, 53, 54, 57, 48, 57, 56, 52, 56, 51, 51, 51, 51, 53, 48, 50, 51, 125, 44, 32,
+    34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32,
+    34, 84, 121, 112, 101, 34, 58, 32, 34, 103, 112, 117, 115, 105, 122, 101, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98,
+    108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 117, 110, 98, 111, 117, 110, 100, 68, 101, 115, 99, 114, 105, 112, 116,
+    111, 114, 65, 100, 100, 114, 101, 115, 115, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 85, 110, 98, 111, 117,
+    110, 100, 68, 101, 115, 99, 114, 105, 112, 116, 111, 114, 65, 100, 100, 114, 101, 115, 115, 34, 44, 32, 34, 72, 97,
+    115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 57, 55, 50, 57, 49, 57, 53, 49, 55, 125, 44, 32, 123, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 67, 108, 101, 97, 114, 65, 108, 108, 111, 99, 97, 116, 101, 100, 76, 102, 98, 34, 44, 32, 34,
+    84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34, 68, 101, 98, 117, 103, 34,
+    44, 32, 34, 83, 97, 102, 101, 83, 101, 116, 116, 105, 110, 103, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 68,
+    101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 34, 79, 83, 34, 58, 32, 91, 34, 76, 105, 110, 117, 120, 34,
+    93, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101,
+    121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98,
+    108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 108, 101, 97, 114, 65, 108, 108, 111, 99, 97, 116, 101, 100, 76,
+    102, 98, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 108, 101, 97, 114,
+    115, 32, 108, 111, 99, 97, 108, 32, 102, 114, 97, 109, 101, 32, 98, 117, 102, 102, 101, 114, 32, 116, 111, 32, 122,
+    101, 114, 111, 46, 32, 84, 104, 101, 32, 97, 108, 108, 111, 99, 97, 116, 101, 100, 32, 108, 111, 99, 97, 108, 32,
+    102, 114, 97, 109, 101, 32, 98, 117, 102, 102, 101, 114, 32, 105, 115, 32, 110, 111, 116, 32, 99, 108, 101, 97, 114,
+    101, 100, 32, 116, 111, 32, 122, 101, 114, 111, 32, 111, 110, 32, 76, 105, 110, 117, 120, 46, 32, 32, 65, 112, 112,
+    108, 105, 99, 97, 116, 105, 111, 110, 115, 32, 115, 111, 109, 101, 116, 105, 109, 101, 115, 32, 97, 115, 115, 117,
+    109, 101, 32, 116, 104, 97, 116, 32, 116, 104, 101, 32, 100, 114, 105, 118, 101, 114, 32, 119, 105, 108, 108, 32,
+    99, 108, 101, 97, 114, 32, 116, 104, 101, 32, 102, 114, 97, 109, 101, 98, 117, 102, 102, 101, 114, 32, 111, 110, 32,
+    76, 105, 110, 117, 120, 32, 40, 119, 104, 105, 99, 104, 32, 119, 111, 117, 108, 100, 32, 109, 97, 116, 99, 104, 32,
+    87, 105, 110, 100, 111, 119, 115, 32, 98, 101, 104, 97, 118, 105, 111, 114, 41, 46, 34, 44, 32, 34, 72, 97, 115,
+    104, 78, 97, 109, 101, 34, 58, 32, 50, 54, 53, 55, 52, 50, 48, 53, 54, 53, 125, 44, 32, 123, 34, 86, 97, 108, 105,
+    100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101,
+    44, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 100, 100,
+    114, 50, 68, 105, 115, 97, 98, 108, 101, 52, 107, 66, 83, 119, 105, 122, 122, 108, 101, 68, 101, 112, 116, 104, 34,
+    44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 68, 101, 112, 116, 104, 32, 105, 109, 97, 103, 101, 115, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 65, 100, 100, 114, 50, 68, 105, 115, 97, 98, 108, 101, 52, 107, 66, 83, 119, 105, 122, 122, 108,
+    101, 67, 111, 108, 111, 114, 49, 68, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 49, 68, 32, 67, 111, 108, 111, 114, 32, 105, 109, 97,
+    103, 101, 115, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 100, 100, 114, 50, 68, 105, 115, 97,
+    98, 108, 101, 52, 107, 66, 83, 119, 105, 122, 122, 108, 101, 67, 111, 108, 111, 114, 50, 68, 34, 44, 32, 34, 86, 97,
+    108, 117, 101, 34, 58, 32, 52, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 50,
+    68, 32, 67, 111, 108, 111, 114, 32, 105, 109, 97, 103, 101, 115, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 65, 100, 100, 114, 50, 68, 105, 115, 97, 98, 108, 101, 52, 107, 66, 83, 119, 105, 122, 122, 108, 101, 67,
+    111, 108, 111, 114, 51, 68, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 56, 44, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 51, 68, 32, 67, 111, 108, 111, 114, 32, 105, 109, 97, 103, 101,
+    115, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 100, 100, 114, 50, 68, 105, 115, 97, 98, 108,
+    101, 52, 107, 66, 83, 119, 105, 122, 122, 108, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 66, 105, 116, 109, 97, 115, 107, 32, 118, 97, 108, 117, 101, 115, 32, 116, 104, 97, 116, 32,
+    99, 111, 114, 114, 101, 115, 112, 111, 110, 100, 32, 116, 111, 32, 105, 109, 97, 103, 101, 32, 116, 121, 112, 101,
+    115, 32, 102, 111, 114, 32, 99, 111, 110, 116, 114, 111, 108, 108, 105, 110, 103, 32, 52, 107, 66, 32, 115, 119,
+    105, 122, 122, 108, 101, 32, 109, 111, 100, 101, 115, 46, 34, 125, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65,
+    100, 100, 114, 50, 68, 105, 115, 97, 98, 108, 101, 52, 75, 98, 83, 119, 105, 122, 122, 108, 101, 77, 111, 100, 101,
+    34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34, 82, 101, 115,
+    111, 117, 114, 99, 101, 32, 83, 101, 116, 116, 105, 110, 103, 115, 34, 93, 44, 32, 34, 70, 108, 97, 103, 115, 34,
+    58, 32, 123, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 73, 115, 66, 105, 116, 109, 97,
+    115, 107, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123,
+    34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80,
+    114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105,
+    110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 97, 100,
+    100, 114, 50, 68, 105, 115, 97, 98, 108, 101, 52, 107, 66, 83, 119, 105, 122, 122, 108, 101, 77, 111, 100, 101, 34,
+    44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 66, 105, 116, 109, 97, 115, 107,
+    32, 111, 102, 32, 115, 117, 114, 102, 97, 99, 101, 32, 116, 121, 112, 101, 115, 32, 119, 104, 105, 99, 104, 32, 115,
+    104, 111, 117, 108, 100, 32, 110, 111, 116, 32, 97, 108, 108, 111, 119, 32, 52, 107, 66, 32, 115, 119, 105, 122,
+    122, 108, 101, 32, 109, 111, 100, 101, 115, 32, 102, 111, 114, 32, 99, 104, 105, 112, 115, 32, 119, 104, 105, 99,
+    104, 32, 117, 115, 101, 32, 65, 100, 100, 114, 77, 103, 114, 50, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 50, 50, 53, 50, 54, 55, 54, 56, 52, 50, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 87, 104, 101, 116, 104, 101, 114, 32, 116, 111, 32, 100, 105, 115, 97, 98, 108, 101,
+    32, 88, 79, 82, 32, 116, 105, 108, 101, 32, 109, 111, 100, 101, 115, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58,
+    32, 91, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34, 82, 101, 115, 111, 117, 114, 99, 101, 32, 83, 101, 116,
+    116, 105, 110, 103, 115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101,
+    102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34,
+    80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98,
+    111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 97, 100, 100,
+    114, 50, 68, 105, 115, 97, 98, 108, 101, 88, 111, 114, 84, 105, 108, 101, 77, 111, 100, 101, 34, 44, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 65, 100, 100, 114, 50, 68, 105, 115, 97, 98, 108, 101, 88, 111, 114, 84, 105, 108, 101,
+    77, 111, 100, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 53, 55, 54, 48, 53, 50, 52, 50,
+    54, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98,
+    108, 101, 115, 32, 83, 32, 115, 119, 105, 122, 122, 108, 101, 32, 109, 111, 100, 101, 115, 32, 102, 111, 114, 32,
+    56, 98, 112, 112, 32, 99, 111, 108, 111, 114, 32, 116, 97, 114, 103, 101, 116, 115, 46, 34, 44, 32, 34, 84, 97, 103,
+    115, 34, 58, 32, 91, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34, 82, 101, 115, 111, 117, 114, 99, 101, 32,
+    83, 101, 116, 116, 105, 110, 103, 115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123,
+    34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34,
+    58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58,
+    32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 97,
+    100, 100, 114, 50, 68, 105, 115, 97, 98, 108, 101, 83, 77, 111, 100, 101, 115, 56, 66, 112, 112, 67, 111, 108, 111,
+    114, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 100, 100, 114, 50, 68, 105, 115, 97, 98, 108, 101, 83,
+    77, 111, 100, 101, 115, 56, 66, 112, 112, 67, 111, 108, 111, 114, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 51, 51, 55, 57, 49, 52, 50, 56, 54, 48, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 79,
+    118, 101, 114, 108, 97, 121, 82, 101, 112, 111, 114, 116, 72, 68, 82, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32,
+    91, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34, 68, 101, 118, 77, 111, 100, 101, 34, 44, 32, 34, 72, 68,
+    82, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116,
+    34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116,
+    101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32,
+    34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 111, 118, 101, 114, 108, 97, 121, 82, 101,
+    112, 111, 114, 116, 72, 68, 82, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    68, 101, 116, 101, 114, 109, 105, 110, 101, 115, 32, 105, 102, 32, 116, 104, 101, 32, 100, 101, 118, 101, 108, 111,
+    112, 101, 114, 32, 109, 111, 100, 101, 32, 111, 118, 101, 114, 108, 97, 121, 32, 119, 105, 108, 108, 32, 114, 101,
+    112, 111, 114, 116, 32, 105, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 97, 98, 111, 117, 116, 32, 72, 68,
+    82, 32, 109, 111, 100, 101, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 51, 53, 52, 55,
+    49, 49, 54, 52, 49, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34,
+    73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 73, 115, 69, 120, 99, 108, 117, 115, 105,
+    118, 101, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 80, 105, 112, 101, 108, 105, 110, 101, 72, 101, 97, 112, 76, 111, 99, 97, 108, 34, 44, 32,
+    34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 76, 111, 99, 97, 108, 32, 67, 80, 85, 32, 118, 105, 115, 105, 98, 108, 101, 32, 104, 101, 97, 112, 46, 34,
+    125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 105, 112, 101, 108, 105, 110, 101, 72, 101, 97, 112, 73,
+    110, 118, 105, 115, 105, 98, 108, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 76, 111, 99, 97, 108, 32, 67, 80, 85, 32, 105, 110, 118,
+    105, 115, 105, 98, 108, 101, 32, 104, 101, 97, 112, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    80, 105, 112, 101, 108, 105, 110, 101, 72, 101, 97, 112, 71, 97, 114, 116, 85, 115, 119, 99, 34, 44, 32, 34, 86, 97,
+    108, 117, 101, 34, 58, 32, 50, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 71,
+    80, 85, 45, 97, 99, 99, 101, 115, 115, 105, 98, 108, 101, 32, 117, 110, 99, 97, 99, 104, 101, 100, 32, 115, 121,
+    115, 116, 101, 109, 32, 109, 101, 109, 111, 114, 121, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 80, 105, 112, 101, 108, 105, 110, 101, 72, 101, 97, 112, 71, 97, 114, 116, 67, 97, 99, 104, 101, 97, 98, 108,
+    101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 51, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 71, 80, 85, 45, 97, 99, 99, 101, 115, 115, 105, 98, 108, 101, 32, 99, 97, 99, 104, 101,
+    100, 32, 115, 121, 115, 116, 101, 109, 32, 109, 101, 109, 111, 114, 121, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 80, 105, 112, 101, 108, 105, 110, 101, 72, 101, 97, 112, 68, 101, 102, 101, 114, 84, 111, 67,
+    108, 105, 101, 110, 116, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 44, 32, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 72, 101, 97, 112, 32, 116, 121, 112, 101, 32, 115, 112, 101, 99, 105,
+    102, 105, 101, 100, 32, 98, 121, 32, 99, 108, 105, 101, 110, 116, 32, 105, 110, 32, 112, 105, 112, 101, 108, 105,
+    110, 101, 32, 99, 114, 101, 97, 116, 101, 73, 110, 102, 111, 46, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 80, 114, 101, 102, 101, 114, 114, 101, 100, 80, 105, 112, 101, 108, 105, 110, 101, 85, 112, 108, 111, 97,
+    100, 72, 101, 97, 112, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 72, 101,
+    97, 112, 32, 112, 114, 101, 102, 101, 114, 101, 110, 99, 101, 32, 102, 111, 114, 32, 112, 105, 112, 101, 108, 105,
+    110, 101, 115, 46, 34, 125, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 114, 101, 102, 101, 114, 114, 101,
+    100, 80, 105, 112, 101, 108, 105, 110, 101, 85, 112, 108, 111, 97, 100, 72, 101, 97, 112, 34, 44, 32, 34, 84, 97,
+    103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34, 80, 101, 114, 102, 111, 114, 109, 97,
+    110, 99, 101, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117,
+    108, 116, 34, 58, 32, 34, 80, 105, 112, 101, 108, 105, 110, 101, 72, 101, 97, 112, 68, 101, 102, 101, 114, 84, 111,
+    67, 108, 105, 101, 110, 116, 34, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116,
+    101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 32,
+    34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 112, 114, 101, 102, 101, 114, 114, 101,
+    100, 80, 105, 112, 101, 108, 105, 110, 101, 85, 112, 108, 111, 97, 100, 72, 101, 97, 112, 34, 44, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 80, 105, 112, 101, 108, 105, 110, 101, 115, 32, 97, 114,
+    101, 32, 117, 112, 108, 111, 97, 100, 101, 100, 32, 102, 111, 114, 32, 71, 80, 85, 32, 97, 99, 99, 101, 115, 115,
+    32, 116, 111, 32, 116, 104, 101, 32, 104, 101, 97, 112, 32, 116, 121, 112, 101, 32, 112, 114, 101, 102, 101, 114,
+    114, 101, 100, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 49, 55, 48, 54, 51, 56, 50,
+    57, 57, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 80, 105, 112, 101, 108,
+    105, 110, 101, 67, 111, 100, 101, 68, 101, 100, 117, 112, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80,
+    101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58,
+    32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112,
+    101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101,
+    34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32,
+    34, 101, 110, 97, 98, 108, 101, 80, 105, 112, 101, 108, 105, 110, 101, 67, 111, 100, 101, 68, 101, 100, 117, 112,
+    34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 115, 101, 116, 44,
+    32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 32, 119, 104, 111, 115, 101, 32, 99, 111, 100, 101, 32, 97, 110,
+    100, 32, 100, 97, 116, 97, 32, 105, 109, 97, 103, 101, 115, 32, 97, 114, 101, 32, 98, 121, 116, 101, 45, 105, 100,
+    101, 110, 116, 105, 99, 97, 108, 32, 115, 104, 97, 114, 101, 32, 97, 32, 115, 105, 110, 103, 108, 101, 32, 71, 80,
+    85, 32, 97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 32, 105, 110, 115, 116, 101, 97, 100, 32, 111, 102, 32, 101,
+    97, 99, 104, 32, 117, 112, 108, 111, 97, 100, 105, 110, 103, 32, 97, 32, 112, 114, 105, 118, 97, 116, 101, 32, 99,
+    111, 112, 121, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 57, 55, 55, 51, 50, 50, 48,
+    55, 49, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 73, 115, 69,
+    110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 73, 115, 69, 120, 99, 108, 117, 115, 105, 118, 101, 34,
+    58, 32, 116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 82, 112, 109, 80, 105, 112, 101, 108, 105, 110, 101, 67, 114, 101, 97, 116, 101, 69, 97, 103, 101, 114,
+    34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 65, 108, 108, 32, 82, 80, 77, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 32, 97, 114,
+    101, 32, 99, 114, 101, 97, 116, 101, 100, 32, 100, 117, 114, 105, 110, 103, 32, 100, 101, 118, 105, 99, 101, 32,
+    105, 110, 105, 116, 105, 97, 108, 105, 122, 97, 116, 105, 111, 110, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 82, 112, 109, 80, 105, 112, 101, 108, 105, 110, 101, 67, 114, 101, 97, 116, 101, 76, 97, 122, 121,
+    34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 82, 80, 77, 32, 99, 111, 109, 112, 117, 116, 101, 32, 112, 105, 112, 101, 108, 105, 110, 101,
+    115, 32, 97, 114, 101, 32, 99, 114, 101, 97, 116, 101, 100, 32, 116, 104, 101, 32, 102, 105, 114, 115, 116, 32, 116,
+    105, 109, 101, 32, 116, 104, 101, 121, 32, 97, 114, 101, 32, 117, 115, 101, 100, 46, 34, 125, 44, 32, 123, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 82, 112, 109, 80, 105, 112, 101, 108, 105, 110, 101, 67, 114, 101, 97, 116, 101, 80,
+    114, 101, 119, 97, 114, 109, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 82, 80, 77, 32, 99, 111, 109, 112, 117, 116, 101, 32, 112, 105,
+    112, 101, 108, 105, 110, 101, 115, 32, 97, 114, 101, 32, 99, 114, 101, 97, 116, 101, 100, 32, 111, 110, 32, 102,
+    105, 114, 115, 116, 32, 117, 115, 101, 44, 32, 97, 110, 100, 32, 116, 104, 101, 32, 99, 111, 109, 109, 111, 110,
+    108, 121, 32, 117, 115, 101, 100, 32, 111, 110, 101, 115, 32, 97, 114, 101, 32, 97, 108, 115, 111, 32, 98, 117, 105,
+    108, 116, 32, 111, 110, 32, 119, 111, 114, 107, 101, 114, 32, 116, 104, 114, 101, 97, 100, 115, 32, 100, 117, 114,
+    105, 110, 103, 32, 100, 101, 118, 105, 99, 101, 32, 105, 110, 105, 116, 105, 97, 108, 105, 122, 97, 116, 105, 111,
+    110, 46, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 82, 112, 109, 80, 105, 112, 101, 108, 105, 110,
+    101, 67, 114, 101, 97, 116, 101, 77, 111, 100, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 67, 114, 101, 97, 116, 105, 111, 110, 32, 112, 111, 108, 105, 99, 121, 32, 102, 111, 114, 32,
+    105, 110, 116, 101, 114, 110, 97, 108, 32, 82, 80, 77, 32, 99, 111, 109, 112, 117, 116, 101, 32, 112, 105, 112, 101,
+    108, 105, 110, 101, 115, 46, 34, 125, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 82, 112, 109, 80, 105, 112, 101,
+    108, 105, 110, 101, 67, 114, 101, 97, 116, 101, 77, 111, 100, 101, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91,
+    34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115,
+    34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 82, 112, 109, 80, 105, 112, 101, 108, 105,
+    110, 101, 67, 114, 101, 97, 116, 101, 76, 97, 122, 121, 34, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34,
+    80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101,
+    110, 117, 109, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 114, 112, 109,
+    80, 105, 112, 101, 108, 105, 110, 101, 67, 114, 101, 97, 116, 101, 77, 111, 100, 101, 34, 44, 32, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 119, 104, 101,
+    110, 32, 116, 104, 101, 32, 114, 101, 115, 111, 117, 114, 99, 101, 32, 112, 114, 111, 99, 101, 115, 115, 105, 110,
+    103, 32, 109, 97, 110, 97, 103, 101, 114, 32, 99, 114, 101, 97, 116, 101, 115, 32, 105, 116, 115, 32, 105, 110, 116,
+    101, 114, 110, 97, 108, 32, 99, 111, 109, 112, 117, 116, 101, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 46,
+    34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 50, 55, 57, 52, 57, 50, 57, 54, 55, 125, 44, 32,
+    123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 70, 111, 114, 99, 101, 72, 101, 97, 112, 80, 101, 114, 102, 84, 111, 70,
+    105, 120, 101, 100, 86, 97, 108, 117, 101, 115, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 101, 114,
+    102, 111, 114, 109, 97, 110, 99, 101, 34, 44, 32, 34, 66, 114, 105, 110, 103, 117, 112, 34, 44, 32, 34, 72, 101, 97,
+    112, 80, 101, 114, 102, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102,
+    97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80,
+    114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111,
+    111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 102, 111, 114, 99,
+    101, 72, 101, 97, 112, 80, 101, 114, 102, 84, 111, 70, 105, 120, 101, 100, 86, 97, 108, 117, 101, 115, 34, 44, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 115, 101, 116, 32, 119, 101,
+    32, 119, 105, 108, 108, 32, 117, 115, 101, 32, 97, 32, 115, 101, 116, 32, 111, 102, 32, 104, 97, 114, 100, 45, 99,
+    111, 100, 101, 100, 32, 104, 101, 97, 112, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 118, 97,
+    108, 117, 101, 115, 32, 105, 110, 115, 116, 101, 97, 100, 32, 111, 102, 32, 116, 104, 101, 32, 117, 115, 117, 97,
+    108, 32, 65, 83, 73, 67, 45, 115, 112, 101, 99, 105, 102, 105, 99, 32, 118, 97, 108, 117, 101, 115, 46, 32, 32, 84,
+    104, 105, 115, 32, 115, 101, 116, 116, 105, 110, 103, 32, 105, 115, 32, 105, 110, 116, 101, 110, 100, 101, 100, 32,
+    102, 111, 114, 32, 98, 114, 105, 110, 103, 45, 117, 112, 32, 116, 101, 115, 116, 105, 110, 103, 32, 97, 115, 32,
+    119, 101, 32, 119, 105, 108, 108, 32, 114, 101, 116, 117, 114, 110, 32, 122, 101, 114, 111, 115, 32, 102, 111, 114,
+    32, 97, 108, 108, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 100, 97, 116, 97, 32, 111, 110, 32,
+    117, 110, 107, 110, 111, 119, 110, 32, 71, 80, 85, 115, 46, 32, 32, 84, 104, 105, 115, 32, 99, 97, 110, 32, 99, 97,
+    117, 115, 101, 32, 115, 116, 114, 97, 110, 103, 101, 32, 98, 101, 104, 97, 118, 105, 111, 114, 32, 40, 101, 46, 103,
+    46, 44, 32, 112, 111, 111, 114, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 41, 32, 105, 110, 32, 115,
+    111, 109, 101, 32, 97, 112, 112, 108, 105, 99, 97, 116, 105, 111, 110, 115, 46, 34, 44, 32, 34, 72, 97, 115, 104,
+    78, 97, 109, 101, 34, 58, 32, 50, 52, 49, 53, 55, 48, 51, 49, 50, 52, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 80, 85, 32, 114, 101, 97, 100, 32, 112, 101, 114, 102, 111, 114,
+    109, 97, 110, 99, 101, 32, 102, 111, 114, 32, 108, 111, 99, 97, 108, 32, 109, 101, 109, 111, 114, 121, 34, 44, 32,
+    34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 44, 32, 34, 72,
+    101, 97, 112, 80, 101, 114, 102, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 102, 108, 111, 97,
+    116, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 112, 117, 82, 101,
+    97, 100, 80, 101, 114, 102, 70, 111, 114, 76, 111, 99, 97, 108, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    67, 112, 117, 82, 101, 97, 100, 80, 101, 114, 102, 70, 111, 114, 76, 111, 99, 97, 108, 34, 44, 32, 34, 72, 97, 115,
+    104, 78, 97, 109, 101, 34, 58, 32, 49, 48, 54, 55, 55, 49, 49, 48, 51, 54, 125, 44, 32, 123, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 80, 85, 32, 119, 114, 105, 116, 101, 32, 112, 101, 114, 102,
+    111, 114, 109, 97, 110, 99, 101, 32, 102, 111, 114, 32, 108, 111, 99, 97, 108, 32, 109, 101, 109, 111, 114, 121, 34,
+    44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 44, 32,
+    34, 72, 101, 97, 112, 80, 101, 114, 102, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123,
+    34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 102, 108,
+    111, 97, 116, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 112, 117,
+    87, 114, 105, 116, 101, 80, 101, 114, 102, 70, 111, 114, 76, 111, 99, 97, 108, 34, 44, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 67, 112, 117, 87, 114, 105, 116, 101, 80, 101, 114, 102, 70, 111, 114, 76, 111, 99, 97, 108, 34, 44, 32,
+    34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 55, 51, 48, 53, 55, 48, 49, 53, 55, 125, 44, 32, 123, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 71, 80, 85, 32, 114, 101, 97, 100, 32, 112,
+    101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 102, 111, 114, 32, 108, 111, 99, 97, 108, 32, 109, 101, 109,
+    111, 114, 121, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99,
+    101, 34, 44, 32, 34, 72, 101, 97, 112, 80, 101, 114, 102, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115,
+    34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58,
+    32, 34, 102, 108, 111, 97, 116, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32,
+    34, 103, 112, 117, 82, 101, 97, 100, 80, 101, 114, 102, 70, 111, 114, 76, 111, 99, 97, 108, 34, 44, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 71, 112, 117, 82, 101, 97, 100, 80, 101, 114, 102, 70, 111, 114, 76, 111, 99, 97, 108, 34,
+    44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 54, 51, 56, 54, 49, 48, 55, 51, 54, 125, 44, 32,
+    123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 71, 80, 85, 32, 119, 114, 105, 116,
+    101, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 102, 111, 114, 32, 108, 111, 99, 97, 108, 32, 109,
+    101, 109, 111, 114, 121, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 101, 114, 102, 111, 114, 109, 97,
+    110, 99, 101, 34, 44, 32, 34, 72, 101, 97, 112, 80, 101, 114, 102, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 125, 44, 32, 34, 84, 121, 112, 101,
+    34, 58, 32, 34, 102, 108, 111, 97, 116, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 103, 112, 117, 87, 114, 105, 116, 101, 80, 101, 114, 102, 70, 111, 114, 76, 111, 99, 97, 108, 34, 44,
+    32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 87, 114, 105, 116, 101, 80, 101, 114, 102, 70, 111, 114, 76,
+    111, 99, 97, 108, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 48, 49, 51, 50, 56, 55, 56,
+    55, 51, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 71, 80, 85, 32,
+    114, 101, 97, 100, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 102, 111, 114, 32, 105, 110, 118,
+    105, 115, 105, 98, 108, 101, 32, 109, 101, 109, 111, 114, 121, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34,
+    80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 44, 32, 34, 72, 101, 97, 112, 80, 101, 114, 102, 34, 93, 44,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49,
+    125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 102, 108, 111, 97, 116, 34, 44, 32, 34, 86, 97, 114, 105, 97,
+    98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 112, 117, 82, 101, 97, 100, 80, 101, 114, 102, 70, 111, 114,
+    73, 110, 118, 105, 115, 105, 98, 108, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 82, 101,
+    97, 100, 80, 101, 114, 102, 70, 111, 114, 73, 110, 118, 105, 115, 105, 98, 108, 101, 34, 44, 32, 34, 72, 97, 115,
+    104, 78, 97, 109, 101, 34, 58, 32, 51, 51, 56, 54, 48, 52, 51, 50, 50, 52, 125, 44, 32, 123, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 71, 80, 85, 32, 119, 114, 105, 116, 101, 32, 112, 101, 114, 102,
+    111, 114, 109, 97, 110, 99, 101, 32, 102, 111, 114, 32, 105, 110, 118, 105, 115, 105, 98, 108, 101, 32, 109, 101,
+    109, 111, 114, 121, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110,
+    99, 101, 34, 44, 32, 34, 72, 101, 97, 112, 80, 101, 114, 102, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 125, 44, 32, 34, 84, 121, 112, 101, 34,
+    58, 32, 34, 102, 108, 111, 97, 116, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58,
+    32, 34, 103, 112, 117, 87, 114, 105, 116, 101, 80, 101, 114, 102, 70, 111, 114, 73, 110, 118, 105, 115, 105, 98,
+    108, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 87, 114, 105, 116, 101, 80, 101, 114, 102,
+    70, 111, 114, 73, 110, 118, 105, 115, 105, 98, 108, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58,
+    32, 50, 53, 57, 53, 50, 57, 49, 54, 48, 49, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 67, 80, 85, 32, 119, 114, 105, 116, 101, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99,
+    101, 32, 102, 111, 114, 32, 71, 97, 114, 116, 85, 115, 119, 99, 32, 109, 101, 109, 111, 114, 121, 34, 44, 32, 34,
+    84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 44, 32, 34, 72, 101,
+    97, 112, 80, 101, 114, 102, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101,
+    102, 97, 117, 108, 116, 34, 58, 32, 49, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 102, 108, 111, 97, 116,
+    34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 112, 117, 87, 114, 105,
+    116, 101, 80, 101, 114, 102, 70, 111, 114, 71, 97, 114, 116, 85, 115, 119, 99, 34, 44, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 67, 112, 117, 87, 114, 105, 116, 101, 80, 101, 114, 102, 70, 111, 114, 71, 97, 114, 116, 85, 115, 119,
+    99, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 48, 57, 53, 49, 51, 49, 50, 56, 54, 125, 44,
+    32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 80, 85, 32, 114, 101, 97, 100,
+    32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 102, 111, 114, 32, 71, 97, 114, 116, 85, 115, 119, 99,
+    32, 109, 101, 109, 111, 114, 121, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 101, 114, 102, 111, 114,
+    109, 97, 110, 99, 101, 34, 44, 32, 34, 72, 101, 97, 112, 80, 101, 114, 102, 34, 93, 44, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 125, 44, 32, 34, 84, 121,
+    112, 101, 34, 58, 32, 34, 102, 108, 111, 97, 116, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109,
+    101, 34, 58, 32, 34, 99, 112, 117, 82, 101, 97, 100, 80, 101, 114, 102, 70, 111, 114, 71, 97, 114, 116, 85, 115,
+    119, 99, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 112, 117, 82, 101, 97, 100, 80, 101, 114, 102, 70,
+    111, 114, 71, 97, 114, 116, 85, 115, 119, 99, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 54,
+    54, 52, 50, 51, 54, 56, 52, 57, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 71, 80, 85, 32, 114, 101, 97, 100, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 102, 111,
+    114, 32, 71, 97, 114, 116, 85, 115, 119, 99, 32, 109, 101, 109, 111, 114, 121, 34, 44, 32, 34, 84, 97, 103, 115, 34,
+    58, 32, 91, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 44, 32, 34, 72, 101, 97, 112, 80, 101, 114,
+    102, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116,
+    34, 58, 32, 49, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 102, 108, 111, 97, 116, 34, 44, 32, 34, 86, 97,
+    114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 112, 117, 82, 101, 97, 100, 80, 101, 114, 102,
+    70, 111, 114, 71, 97, 114, 116, 85, 115, 119, 99, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117,
+    82, 101, 97, 100, 80, 101, 114, 102, 70, 111, 114, 71, 97, 114, 116, 85, 115, 119, 99, 34, 44, 32, 34, 72, 97, 115,
+    104, 78, 97, 109, 101, 34, 58, 32, 51, 55, 54, 49, 55, 48, 48, 56, 54, 57, 125, 44, 32, 123, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 71, 80, 85, 32, 119, 114, 105, 116, 101, 32, 112, 101, 114, 102,
+    111, 114, 109, 97, 110, 99, 101, 32, 102, 111, 114, 32, 71, 97, 114, 116, 85, 115, 119, 99, 32, 109, 101, 109, 111,
+    114, 121, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101,
+    34, 44, 32, 34, 72, 101, 97, 112, 80, 101, 114, 102, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34,
+    58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32,
+    34, 102, 108, 111, 97, 116, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    103, 112, 117, 87, 114, 105, 116, 101, 80, 101, 114, 102, 70, 111, 114, 71, 97, 114, 116, 85, 115, 119, 99, 34, 44,
+    32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 87, 114, 105, 116, 101, 80, 101, 114, 102, 70, 111, 114, 71,
+    97, 114, 116, 85, 115, 119, 99, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 53, 55, 52, 49,
+    53, 57, 56, 48, 50, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67,
+    80, 85, 32, 114, 101, 97, 100, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 102, 111, 114, 32, 71,
+    97, 114, 116, 67, 97, 99, 104, 101, 97, 98, 108, 101, 32, 109, 101, 109, 111, 114, 121, 34, 44, 32, 34, 84, 97, 103,
+    115, 34, 58, 32, 91, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 44, 32, 34, 72, 101, 97, 112, 80,
+    101, 114, 102, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117,
+    108, 116, 34, 58, 32, 49, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 102, 108, 111, 97, 116, 34, 44, 32,
+    34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 112, 117, 82, 101, 97, 100, 80, 101,
+    114, 102, 70, 111, 114, 71, 97, 114, 116, 67, 97, 99, 104, 101, 97, 98, 108, 101, 34, 44, 32, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 67, 112, 117, 82, 101, 97, 100, 80, 101, 114, 102, 70, 111, 114, 71, 97, 114, 116, 67, 97, 99, 104,
+    101, 97, 98, 108, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 56, 54, 57, 49, 55, 50,
+    51, 55, 53, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 80, 85,
+    32, 119, 114, 105, 116, 101, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 102, 111, 114, 32, 71, 97,
+    114, 116, 67, 97, 99, 104, 101, 97, 98, 108, 101, 32, 109, 101, 109, 111, 114, 121, 34, 44, 32, 34, 84, 97, 103,
+    115, 34, 58, 32, 91, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 44, 32, 34, 72, 101, 97, 112, 80,
+    101, 114, 102, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117,
+    108, 116, 34, 58, 32, 49, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 102, 108, 111, 97, 116, 34, 44, 32,
+    34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 112, 117, 87, 114, 105, 116, 101, 80,
+    101, 114, 102, 70, 111, 114, 71, 97, 114, 116, 67, 97, 99, 104, 101, 97, 98, 108, 101, 34, 44, 32, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 67, 112, 117, 87, 114, 105, 116, 101, 80, 101, 114, 102, 70, 111, 114, 71, 97, 114, 116, 67,
+    97, 99, 104, 101, 97, 98, 108, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 57, 53, 57, 55,
+    48, 56, 49, 49, 56, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 71,
+    80, 85, 32, 114, 101, 97, 100, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 102, 111, 114, 32, 71,
+    97, 114, 116, 67, 97, 99, 104, 101, 97, 98, 108, 101, 32, 109, 101, 109, 111, 114, 121, 34, 44, 32, 34, 84, 97, 103,
+    115, 34, 58, 32, 91, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 44, 32, 34, 72, 101, 97, 112, 80,
+    101, 114, 102, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117,
+    108, 116, 34, 58, 32, 49, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 102, 108, 111, 97, 116, 34, 44, 32,
+    34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 112, 117, 82, 101, 97, 100, 80, 101,
+    114, 102, 70, 111, 114, 71, 97, 114, 116, 67, 97, 99, 104, 101, 97, 98, 108, 101, 34, 44, 32, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 71, 112, 117, 82, 101, 97, 100, 80, 101, 114, 102, 70, 111, 114, 71, 97, 114, 116, 67, 97, 99, 104,
+    101, 97, 98, 108, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 48, 54, 50, 55, 53, 48,
+    51, 57, 53, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 71, 80, 85,
+    32, 119, 114, 105, 116, 101, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 102, 111, 114, 32, 71, 97,
+    114, 116, 67, 97, 99, 104, 101, 97, 98, 108, 101, 32, 109, 101, 109, 111, 114, 121, 34, 44, 32, 34, 84, 97, 103,
+    115, 34, 58, 32, 91, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 44, 32, 34, 72, 101, 97, 112, 80,
+    101, 114, 102, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117,
+    108, 116, 34, 58, 32, 49, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 102, 108, 111, 97, 116, 34, 44, 32,
+    34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 112, 117, 87, 114, 105, 116, 101, 80,
+    101, 114, 102, 70, 111, 114, 71, 97, 114, 116, 67, 97, 99, 104, 101, 97, 98, 108, 101, 34, 44, 32, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 71, 112, 117, 87, 114, 105, 116, 101, 80, 101, 114, 102, 70, 111, 114, 71, 97, 114, 116, 67,
+    97, 99, 104, 101, 97, 98, 108, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 54, 50, 49,
+    48, 50, 57, 55, 51, 56, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 108, 108, 111, 99, 97, 116, 105,
+    111, 110, 76, 105, 115, 116, 82, 101, 117, 115, 97, 98, 108, 101, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91,
+    34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115,
+    34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 112,
+    101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 34, 79, 83, 34, 58, 32, 91, 34, 76, 105, 110, 117, 120, 34, 93, 125,
+    44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34,
+    44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 76, 105, 115, 116, 82, 101,
+    117, 115, 97, 98, 108, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 82,
+    101, 45, 117, 115, 101, 32, 97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 32, 108, 105, 115, 116, 32, 97, 99, 114,
+    111, 115, 115, 32, 115, 117, 98, 109, 105, 115, 115, 105, 111, 110, 115, 32, 105, 110, 32, 76, 105, 110, 117, 120,
+    46, 32, 84, 104, 105, 115, 32, 119, 105, 108, 108, 32, 105, 109, 112, 114, 111, 118, 101, 32, 67, 80, 85, 32, 112,
+    101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 111, 102, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102,
+    102, 101, 114, 32, 115, 117, 98, 109, 105, 115, 115, 105, 111, 110, 44, 32, 98, 117, 116, 32, 119, 105, 108, 108,
+    32, 112, 111, 116, 101, 110, 116, 105, 97, 108, 108, 121, 32, 99, 97, 117, 115, 101, 32, 71, 80, 85, 32, 109, 101,
+    109, 111, 114, 121, 32, 100, 101, 45, 97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 32, 116, 111, 32, 98, 101, 32,
+    100, 101, 108, 97, 121, 101, 100, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 55, 50,
+    55, 48, 51, 54, 57, 57, 52, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 83, 116, 114, 101,
+    97, 109, 82, 101, 97, 100, 79, 110, 108, 121, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 67, 111, 109,
+    109, 97, 110, 100, 32, 66, 117, 102, 102, 101, 114, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34,
+    58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 68, 101, 112,
+    101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 34, 79, 83, 34, 58, 32, 91, 34, 87, 105, 110, 100, 111, 119, 115, 34,
+    93, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101,
+    121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98,
+    108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 109, 100, 83, 116, 114, 101, 97, 109, 82, 101, 97, 100, 79, 110,
+    108, 121, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 65, 108, 119, 97,
+    121, 115, 32, 109, 97, 107, 101, 32, 99, 111, 109, 109, 97, 110, 100, 32, 115, 116, 114, 101, 97, 109, 32, 109, 101,
+    109, 111, 114, 121, 32, 114, 101, 97, 100, 45, 111, 110, 108, 121, 32, 111, 110, 32, 116, 104, 101, 32, 71, 80, 85,
+    46, 32, 78, 111, 114, 109, 97, 108, 108, 121, 44, 32, 98, 117, 115, 121, 45, 116, 114, 97, 99, 107, 101, 100, 32,
+    97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 115, 32, 97, 114, 101, 32, 82, 87, 44, 32, 116, 104, 105, 115, 32,
+    102, 111, 114, 99, 101, 115, 32, 116, 104, 101, 32, 98, 117, 115, 121, 32, 116, 114, 97, 99, 107, 101, 114, 32, 100,
+    97, 116, 97, 32, 105, 110, 116, 111, 32, 97, 32, 115, 101, 112, 97, 114, 97, 116, 101, 32, 82, 87, 32, 112, 97, 103,
+    101, 46, 32, 67, 117, 114, 114, 101, 110, 116, 108, 121, 32, 111, 110, 108, 121, 32, 119, 111, 114, 107, 115, 32,
+    111, 110, 32, 87, 68, 68, 77, 50, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 53, 49, 57,
+    49, 49, 55, 55, 56, 53, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 70, 101, 110, 99, 101, 84, 105, 109,
+    101, 111, 117, 116, 79, 118, 101, 114, 114, 105, 100, 101, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80,
+    101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 44, 32, 34, 69, 109, 117, 108, 97, 116, 105, 111, 110, 34, 93,
+    44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32,
+    48, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101,
+    121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114,
+    105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 102, 101, 110, 99, 101, 84, 105, 109, 101, 111, 117, 116,
+    79, 118, 101, 114, 114, 105, 100, 101, 73, 110, 83, 101, 99, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 84, 105, 109, 101, 111, 117, 116, 32, 118, 97, 108, 117, 101, 32, 116, 111, 32, 111,
+    118, 101, 114, 114, 105, 100, 101, 32, 97, 112, 112, 45, 115, 112, 101, 99, 105, 102, 105, 101, 100, 32, 118, 97,
+    108, 117, 101, 32, 102, 111, 114, 32, 102, 101, 110, 99, 101, 32, 116, 105, 109, 101, 111, 117, 116, 115, 46, 32,
+    32, 84, 104, 105, 115, 32, 115, 101, 116, 116, 105, 110, 103, 32, 105, 115, 32, 109, 101, 97, 110, 105, 110, 103,
+    108, 101, 115, 115, 32, 105, 102, 32, 116, 104, 101, 32, 97, 112, 112, 32, 115, 112, 101, 99, 105, 102, 105, 101,
+    100, 32, 122, 101, 114, 111, 32, 115, 101, 99, 111, 110, 100, 115, 46, 32, 32, 65, 32, 118, 97, 108, 117, 101, 32,
+    111, 102, 32, 122, 101, 114, 111, 32, 104, 101, 114, 101, 32, 109, 101, 97, 110, 115, 32, 116, 111, 32, 117, 115,
+    101, 32, 116, 104, 101, 32, 97, 112, 112, 45, 115, 112, 101, 99, 105, 102, 105, 101, 100, 32, 116, 105, 109, 101,
+    111, 117, 116, 32, 118, 97, 108, 117, 101, 46, 32, 32, 85, 115, 101, 102, 117, 108, 32, 111, 110, 32, 72, 87, 32,
+    115, 105, 109, 117, 108, 97, 116, 105, 111, 110, 32, 119, 104, 101, 114, 101, 32, 119, 111, 114, 107, 105, 110, 103,
+    32, 99, 97, 115, 101, 115, 32, 99, 97, 110, 32, 114, 101, 115, 117, 108, 116, 32, 105, 110, 32, 102, 97, 108, 115,
+    101, 32, 116, 105, 109, 101, 111, 117, 116, 115, 46, 32, 32, 86, 97, 108, 117, 101, 32, 115, 112, 101, 99, 105, 102,
+    105, 101, 100, 32, 105, 110, 32, 115, 101, 99, 111, 110, 100, 115, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 57, 55, 48, 49, 55, 50, 56, 49, 55, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 70,
+    111, 114, 99, 101, 54, 52, 107, 80, 97, 103, 101, 71, 114, 97, 110, 117, 108, 97, 114, 105, 116, 121, 34, 44, 32,
+    34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 93, 44, 32, 34,
+    68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97,
+    108, 115, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108,
+    75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114,
+    105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 102, 111, 114, 99, 101, 54, 52, 107, 80, 97, 103, 101, 71,
+    114, 97, 110, 117, 108, 97, 114, 105, 116, 121, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 73, 102, 32, 115, 101, 116, 44, 32, 102, 111, 114, 99, 101, 32, 97, 108, 108, 32, 103, 112, 117, 32,
+    97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 115, 32, 116, 111, 32, 98, 101, 32, 97, 108, 105, 103, 110, 101, 100,
+    47, 115, 105, 122, 101, 100, 32, 105, 110, 32, 54, 52, 107, 32, 105, 110, 99, 114, 101, 109, 101, 110, 116, 115, 46,
+    32, 83, 104, 111, 117, 108, 100, 32, 105, 109, 112, 114, 111, 118, 101, 32, 112, 101, 114, 102, 111, 114, 109, 97,
+    110, 99, 101, 44, 32, 98, 117, 116, 32, 119, 105, 108, 108, 32, 119, 97, 115, 116, 101, 32, 97, 32, 108, 111, 116,
+    32, 111, 102, 32, 109, 101, 109, 111, 114, 121, 32, 105, 110, 32, 97, 108, 105, 103, 110, 109, 101, 110, 116, 32,
+    97, 110, 100, 32, 112, 97, 100, 100, 105, 110, 103, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58,
+    32, 49, 56, 51, 51, 52, 51, 50, 52, 57, 54, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 85, 112, 100,
+    97, 116, 101, 79, 110, 101, 71, 112, 117, 86, 105, 114, 116, 117, 97, 108, 65, 100, 100, 114, 101, 115, 115, 34, 44,
+    32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 44, 32, 34,
+    83, 97, 102, 101, 83, 101, 116, 116, 105, 110, 103, 34, 44, 32, 34, 68, 101, 98, 117, 103, 34, 93, 44, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108,
+    115, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75,
+    101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105,
+    97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 117, 112, 100, 97, 116, 101, 79, 110, 101, 71, 112, 117, 86,
+    105, 114, 116, 117, 97, 108, 65, 100, 100, 114, 101, 115, 115, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 115, 101, 116, 44, 32, 119, 104, 101, 110, 32, 99, 97, 108, 108, 105,
+    110, 103, 32, 82, 101, 109, 97, 112, 86, 105, 114, 116, 117, 97, 108, 77, 101, 109, 111, 114, 121, 80, 97, 103, 101,
+    115, 40, 41, 44, 32, 80, 65, 76, 32, 119, 105, 108, 108, 32, 111, 110, 108, 121, 32, 100, 111, 32, 111, 110, 101,
+    32, 117, 110, 109, 97, 112, 47, 109, 97, 112, 32, 112, 114, 111, 116, 101, 99, 116, 32, 111, 112, 101, 114, 97, 116,
+    105, 111, 110, 32, 97, 116, 32, 97, 32, 116, 105, 109, 101, 44, 32, 105, 110, 115, 116, 101, 97, 100, 32, 111, 102,
+    32, 116, 114, 121, 105, 110, 103, 32, 116, 111, 32, 103, 114, 111, 117, 112, 32, 116, 104, 101, 32, 111, 112, 101,
+    114, 97, 116, 105, 111, 110, 115, 32, 98, 121, 32, 66, 97, 115, 101, 65, 100, 100, 114, 101, 115, 115, 46, 32, 32,
+    84, 104, 105, 115, 32, 97, 102, 102, 101, 99, 116, 115, 32, 87, 68, 68, 77, 50, 32, 111, 110, 108, 121, 46, 34, 44,
+    32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 49, 55, 56, 51, 56, 51, 53, 55, 49, 125, 44, 32, 123,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 108, 119, 97, 121, 115, 82, 101, 115, 105, 100, 101, 110, 116, 34, 44, 32,
+    34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 93, 44, 32, 34,
+    68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97,
+    108, 115, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108,
+    75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114,
+    105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 97, 108, 119, 97, 121, 115, 82, 101, 115, 105, 100, 101,
+    110, 116, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 65, 108, 108, 32, 97,
+    108, 108, 111, 99, 97, 116, 105, 111, 110, 115, 32, 119, 105, 108, 108, 32, 98, 101, 32, 112, 101, 114, 109, 97,
+    110, 101, 110, 116, 108, 121, 32, 107, 101, 112, 116, 32, 114, 101, 115, 105, 100, 101, 110, 116, 32, 119, 105, 116,
+    104, 111, 117, 116, 32, 109, 97, 110, 97, 103, 101, 109, 101, 110, 116, 32, 98, 121, 32, 116, 104, 101, 32, 99, 108,
+    105, 101, 110, 116, 32, 119, 105, 116, 104, 32, 65, 100, 100, 71, 112, 117, 77, 101, 109, 111, 114, 121, 82, 101,
+    102, 101, 114, 101, 110, 99, 101, 115, 46, 32, 32, 84, 104, 105, 115, 32, 109, 97, 121, 32, 114, 101, 100, 117, 99,
+    101, 32, 116, 104, 101, 32, 114, 117, 110, 116, 105, 109, 101, 32, 111, 118, 101, 114, 104, 101, 97, 100, 32, 111,
+    102, 32, 115, 117, 98, 109, 105, 115, 115, 105, 111, 110, 32, 111, 110, 32, 76, 105, 110, 117, 120, 44, 32, 98, 117,
+    116, 32, 119, 111, 110, 39, 116, 32, 119, 111, 114, 107, 32, 112, 114, 111, 112, 101, 114, 108, 121, 32, 105, 102,
+    32, 116, 104, 101, 32, 97, 112, 112, 108, 105, 99, 97, 116, 105, 111, 110, 32, 111, 118, 101, 114, 99, 111, 109,
+    109, 105, 116, 115, 32, 116, 104, 101, 32, 97, 118, 97, 105, 108, 97, 98, 108, 101, 32, 71, 80, 85, 32, 109, 101,
+    109, 111, 114, 121, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 57, 56, 57, 49, 51, 48,
+    54, 56, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 83, 121, 110, 99,
+    111, 98, 106, 70, 101, 110, 99, 101, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 101, 114, 102, 111,
+    114, 109, 97, 110, 99, 101, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101,
+    102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34,
+    80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98,
+    111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 105, 115,
+    97, 98, 108, 101, 83, 121, 110, 99, 111, 98, 106, 70, 101, 110, 99, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 32, 70, 101, 110, 99, 101, 32, 98, 97, 115,
+    101, 100, 32, 111, 110, 32, 83, 121, 110, 99, 32, 79, 98, 106, 101, 99, 116, 46, 32, 70, 111, 114, 99, 101, 32, 117,
+    115, 101, 32, 84, 105, 109, 101, 115, 116, 97, 109, 112, 32, 70, 101, 110, 99, 101, 46, 32, 66, 121, 32, 100, 101,
+    102, 97, 117, 108, 116, 32, 70, 101, 110, 99, 101, 32, 116, 121, 112, 101, 32, 105, 115, 32, 115, 101, 108, 101, 99,
+    116, 101, 100, 32, 97, 99, 99, 111, 114, 100, 105, 110, 103, 32, 116, 111, 32, 116, 104, 101, 32, 115, 121, 115,
+    116, 101, 109, 32, 99, 111, 110, 102, 105, 103, 117, 114, 97, 116, 105, 111, 110, 46, 34, 44, 32, 34, 72, 97, 115,
+    104, 78, 97, 109, 101, 34, 58, 32, 49, 50, 56, 55, 55, 49, 53, 56, 53, 56, 125, 44, 32, 123, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 83, 100, 109, 97, 69, 110, 103, 105, 110, 101, 34, 44, 32, 34, 84,
+    97, 103, 115, 34, 58, 32, 91, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 93, 44, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115,
+    101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101,
+    121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98,
+    108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 105, 115, 97, 98, 108, 101, 83, 100, 109, 97, 69, 110, 103, 105,
+    110, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98,
+    108, 101, 32, 83, 68, 77, 65, 32, 101, 110, 103, 105, 110, 101, 32, 105, 110, 32, 85, 77, 68, 32, 100, 114, 105,
+    118, 101, 114, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 50, 53, 52, 54, 49, 55, 57,
+    52, 48, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 73, 115, 69,
+    110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 73, 115, 69, 120, 99, 108, 117, 115, 105, 118, 101, 34,
+    58, 32, 116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 86, 109, 65, 108, 119, 97, 121, 115, 86, 97, 108, 105, 100, 70, 111, 114, 99, 101, 68, 105, 115, 97, 98,
+    108, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 70, 111, 114, 99, 101, 32, 116, 104, 101, 32, 111, 112, 116, 105, 109, 105, 122, 97,
+    116, 105, 111, 110, 32, 97, 108, 119, 97, 121, 115, 32, 100, 105, 115, 97, 98, 108, 101, 100, 34, 125, 44, 32, 123,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 86, 109, 65, 108, 119, 97, 121, 115, 86, 97, 108, 105, 100, 68, 101, 102, 97,
+    117, 108, 116, 69, 110, 97, 98, 108, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 79, 110, 108, 121, 32, 101, 110, 97, 98, 108, 101,
+    32, 116, 104, 101, 32, 111, 112, 116, 105, 109, 105, 122, 97, 116, 105, 111, 110, 32, 119, 104, 101, 110, 32, 107,
+    101, 114, 110, 101, 108, 32, 100, 114, 105, 118, 101, 114, 32, 99, 97, 110, 32, 115, 117, 112, 112, 111, 114, 116,
+    34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 86, 109, 65, 108, 119, 97, 121, 115, 86, 97, 108, 105,
+    100, 70, 111, 114, 99, 101, 69, 110, 97, 98, 108, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44,
+    32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 111, 114, 99, 101, 32, 116, 104,
+    101, 32, 111, 112, 116, 105, 109, 105, 122, 97, 116, 105, 111, 110, 32, 97, 108, 119, 97, 121, 115, 32, 101, 110,
+    97, 98, 108, 101, 100, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 86, 109, 65, 108, 119, 97, 121,
+    115, 86, 97, 108, 105, 100, 69, 110, 97, 98, 108, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 68, 101, 102, 105, 110, 101, 115, 32, 116, 104, 101, 32, 115, 117, 112, 112, 111, 114,
+    116, 101, 100, 32, 86, 77, 32, 97, 108, 119, 97, 121, 115, 32, 118, 97, 108, 105, 100, 32, 109, 111, 100, 101, 115,
+    46, 34, 125, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 86, 109, 65, 108, 119, 97,
+    121, 115, 86, 97, 108, 105, 100, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 101, 114, 102, 111, 114,
+    109, 97, 110, 99, 101, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102,
+    97, 117, 108, 116, 34, 58, 32, 34, 86, 109, 65, 108, 119, 97, 121, 115, 86, 97, 108, 105, 100, 68, 101, 102, 97,
+    117, 108, 116, 69, 110, 97, 98, 108, 101, 34, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105,
+    118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109,
+    34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 101, 110, 97, 98, 108, 101,
+    86, 109, 65, 108, 119, 97, 121, 115, 86, 97, 108, 105, 100, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 87, 105, 116, 104, 32, 116, 104, 105, 115, 32, 102, 101, 97, 116, 117, 114, 101, 32,
+    101, 110, 97, 98, 108, 101, 100, 32, 86, 77, 32, 97, 100, 100, 114, 101, 115, 115, 101, 115, 32, 97, 114, 101, 32,
+    97, 108, 119, 97, 121, 115, 32, 118, 97, 108, 105, 100, 32, 119, 105, 116, 104, 105, 110, 32, 116, 104, 101, 32,
+    108, 111, 99, 97, 108, 32, 86, 77, 32, 99, 111, 110, 116, 101, 120, 116, 46, 32, 32, 84, 104, 105, 115, 32, 101,
+    108, 105, 109, 105, 110, 97, 116, 101, 115, 32, 116, 104, 101, 32, 110, 101, 101, 100, 32, 116, 111, 32, 97, 100,
+    100, 32, 112, 114, 105, 118, 97, 116, 101, 32, 109, 101, 109, 111, 114, 121, 32, 105, 110, 116, 111, 32, 116, 104,
+    101, 32, 114, 101, 115, 111, 117, 114, 99, 101, 32, 108, 105, 115, 116, 46, 32, 84, 104, 105, 115, 32, 109, 97, 121,
+    32, 114, 101, 100, 117, 99, 101, 32, 116, 104, 101, 32, 114, 117, 110, 116, 105, 109, 101, 32, 111, 118, 101, 114,
+    104, 101, 97, 100, 32, 111, 102, 32, 115, 117, 98, 109, 105, 115, 115, 105, 111, 110, 32, 111, 110, 32, 76, 105,
+    110, 117, 120, 44, 32, 98, 117, 116, 32, 119, 111, 110, 39, 116, 32, 119, 111, 114, 107, 32, 102, 111, 114, 32, 109,
+    101, 109, 111, 114, 121, 32, 115, 104, 97, 114, 101, 100, 32, 98, 121, 32, 109, 117, 108, 116, 105, 112, 108, 101,
+    32, 112, 114, 111, 99, 101, 115, 115, 101, 115, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32,
+    49, 55, 49, 56, 50, 54, 52, 48, 57, 54, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 105, 115, 97,
+    98, 108, 101, 83, 121, 110, 99, 79, 98, 106, 101, 99, 116, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80,
+    101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58,
+    32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 68, 101, 112,
+    101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 34, 79, 83, 34, 58, 32, 91, 34, 76, 105, 110, 117, 120, 34, 93, 125,
+    44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34,
+    44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 105, 115, 97, 98, 108, 101, 83, 121, 110, 99, 79, 98, 106, 101, 99, 116,
+    34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101,
+    115, 32, 83, 121, 110, 99, 79, 98, 106, 101, 99, 116, 32, 115, 117, 112, 112, 111, 114, 116, 32, 102, 111, 114, 32,
+    115, 101, 109, 97, 112, 104, 111, 114, 101, 115, 32, 119, 104, 105, 99, 104, 32, 109, 101, 97, 110, 115, 32, 115,
+    101, 109, 97, 112, 104, 111, 114, 101, 115, 32, 119, 105, 108, 108, 32, 98, 101, 32, 98, 97, 115, 101, 100, 32, 111,
+    110, 32, 80, 114, 111, 79, 110, 108, 121, 32, 111, 114, 32, 76, 101, 103, 97, 99, 121, 32, 105, 110, 116, 101, 114,
+    102, 97, 99, 101, 115, 32, 97, 99, 99, 111, 114, 100, 105, 110, 103, 32, 116, 111, 32, 116, 104, 101, 32, 115, 121,
+    115, 116, 101, 109, 32, 99, 111, 110, 102, 105, 103, 117, 114, 97, 116, 105, 111, 110, 46, 34, 44, 32, 34, 72, 97,
+    115, 104, 78, 97, 109, 101, 34, 58, 32, 56, 51, 48, 57, 51, 51, 56, 53, 57, 125, 44, 32, 123, 34, 86, 97, 108, 105,
+    100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101,
+    44, 32, 34, 73, 115, 69, 120, 99, 108, 117, 115, 105, 118, 101, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 86, 97,
+    108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117,
+    109, 112, 77, 111, 100, 101, 68, 105, 115, 97, 98, 108, 101, 100, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32,
+    48, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 109, 109, 97, 110,
+    100, 32, 98, 117, 102, 102, 101, 114, 32, 100, 117, 109, 112, 105, 110, 103, 32, 105, 115, 32, 100, 105, 115, 97,
+    98, 108, 101, 100, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117,
+    109, 112, 77, 111, 100, 101, 82, 101, 99, 111, 114, 100, 84, 105, 109, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101,
+    34, 58, 32, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 117, 109, 112,
+    105, 110, 103, 32, 105, 115, 32, 101, 110, 97, 98, 108, 101, 100, 32, 97, 116, 32, 99, 111, 109, 109, 97, 110, 100,
+    32, 98, 117, 102, 102, 101, 114, 32, 114, 101, 99, 111, 114, 100, 32, 116, 105, 109, 101, 34, 125, 44, 32, 123, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 77, 111, 100, 101, 83, 117, 98,
+    109, 105, 116, 84, 105, 109, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 32, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 117, 109, 112, 105, 110, 103, 32, 105, 115, 32, 101, 110,
+    97, 98, 108, 101, 100, 32, 97, 116, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 32, 115,
+    117, 98, 109, 105, 116, 32, 116, 105, 109, 101, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109,
+    100, 66, 117, 102, 68, 117, 109, 112, 77, 111, 100, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 68, 101, 102, 105, 110, 101, 115, 32, 116, 104, 101, 32, 115, 117, 112, 112, 111, 114,
+    116, 101, 100, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 32, 100, 117, 109, 112, 32,
+    109, 111, 100, 101, 115, 46, 34, 125, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68,
+    117, 109, 112, 77, 111, 100, 101, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 114, 105, 110, 116, 105,
+    110, 103, 32, 97, 110, 100, 32, 76, 111, 103, 103, 105, 110, 103, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117,
+    109, 112, 77, 111, 100, 101, 68, 105, 115, 97, 98, 108, 101, 100, 34, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34,
+    58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58,
+    32, 34, 101, 110, 117, 109, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    99, 109, 100, 66, 117, 102, 68, 117, 109, 112, 77, 111, 100, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 68, 101, 116, 101, 114, 109, 105, 110, 101, 115, 32, 105, 102, 32, 100, 117,
+    109, 112, 105, 110, 103, 32, 105, 115, 32, 101, 110, 97, 98, 108, 101, 100, 44, 32, 97, 110, 100, 32, 119, 104, 101,
+    116, 104, 101, 114, 32, 105, 116, 32, 105, 115, 32, 97, 116, 32, 114, 101, 99, 111, 114, 100, 32, 111, 114, 32, 115,
+    117, 98, 109, 105, 116, 32, 116, 105, 109, 101, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32,
+    51, 54, 48, 55, 57, 57, 49, 48, 51, 51, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34,
+    58, 32, 123, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 73, 115, 69, 120, 99, 108,
+    117, 115, 105, 118, 101, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91,
+    123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 70, 111, 114, 109, 97,
+    116, 84, 101, 120, 116, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 32, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 115,
+    32, 97, 114, 101, 32, 100, 117, 109, 112, 101, 100, 32, 105, 110, 32, 112, 108, 97, 105, 110, 32, 116, 101, 120,
+    116, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112,
+    70, 111, 114, 109, 97, 116, 66, 105, 110, 97, 114, 121, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44,
+    32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 109, 109, 97, 110, 100, 32,
+    98, 117, 102, 102, 101, 114, 115, 32, 97, 114, 101, 32, 100, 117, 109, 112, 101, 100, 32, 105, 110, 32, 114, 97,
+    119, 32, 98, 105, 110, 97, 114, 121, 32, 109, 111, 100, 101, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 70, 111, 114, 109, 97, 116, 66, 105, 110, 97, 114, 121, 72,
+    101, 97, 100, 101, 114, 115, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114,
+    115, 32, 97, 114, 101, 32, 100, 117, 109, 112, 101, 100, 32, 105, 110, 32, 98, 105, 110, 97, 114, 121, 32, 109, 111,
+    100, 101, 32, 119, 105, 116, 104, 32, 80, 77, 52, 32, 104, 101, 97, 100, 101, 114, 115, 46, 34, 125, 93, 44, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 70, 111, 114, 109, 97, 116, 34, 44,
+    32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 101, 102, 105, 110, 101, 115, 32,
+    116, 104, 101, 32, 115, 117, 112, 112, 111, 114, 116, 101, 100, 32, 102, 111, 114, 109, 97, 116, 115, 32, 102, 111,
+    114, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 32, 100, 117, 109, 112, 105, 110, 103,
+    46, 34, 125, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 70, 111,
+    114, 109, 97, 116, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 114, 105, 110, 116, 105, 110, 103, 32,
+    97, 110, 100, 32, 76, 111, 103, 103, 105, 110, 103, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34,
+    58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 70,
+    111, 114, 109, 97, 116, 84, 101, 120, 116, 34, 125, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58,
+    32, 123, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32,
+    91, 48, 93, 44, 32, 34, 76, 111, 103, 105, 99, 79, 112, 34, 58, 32, 34, 71, 114, 101, 97, 116, 101, 114, 84, 104,
+    97, 110, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 77, 111,
+    100, 101, 34, 125, 93, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80,
+    97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 32, 34, 86,
+    97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 109, 100, 66, 117, 102, 68, 117, 109, 112, 70,
+    111, 114, 109, 97, 116, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67,
+    111, 110, 116, 114, 111, 108, 115, 32, 116, 104, 101, 32, 102, 111, 114, 109, 97, 116, 32, 111, 102, 32, 99, 111,
+    109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 32, 100, 117, 109, 112, 115, 46, 34, 44, 32, 34, 72, 97,
+    115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 57, 48, 53, 49, 54, 52, 57, 55, 55, 125, 44, 32, 123, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 67, 111, 109, 112, 114, 101, 115, 115, 101, 100,
+    34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 114, 105, 110, 116, 105, 110, 103, 32, 97, 110, 100, 32,
+    76, 111, 103, 103, 105, 110, 103, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32,
+    34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34,
+    98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 109,
+    100, 66, 117, 102, 68, 117, 109, 112, 67, 111, 109, 112, 114, 101, 115, 115, 101, 100, 34, 44, 32, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 115, 117, 98, 109,
+    105, 116, 45, 116, 105, 109, 101, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 32, 100,
+    117, 109, 112, 115, 32, 97, 114, 101, 32, 115, 110, 97, 112, 115, 104, 111, 116, 116, 101, 100, 32, 97, 110, 100,
+    32, 76, 90, 52, 45, 99, 111, 109, 112, 114, 101, 115, 115, 101, 100, 32, 111, 110, 32, 97, 32, 98, 97, 99, 107, 103,
+    114, 111, 117, 110, 100, 32, 116, 104, 114, 101, 97, 100, 32, 105, 110, 116, 111, 32, 97, 32, 115, 105, 110, 103,
+    108, 101, 32, 99, 111, 110, 116, 97, 105, 110, 101, 114, 32, 102, 105, 108, 101, 32, 112, 101, 114, 32, 100, 101,
+    118, 105, 99, 101, 32, 105, 110, 115, 116, 101, 97, 100, 32, 111, 102, 32, 111, 110, 101, 32, 102, 105, 108, 101,
+    32, 112, 101, 114, 32, 115, 117, 98, 109, 105, 115, 115, 105, 111, 110, 46, 32, 85, 115, 101, 32, 116, 111, 111,
+    108, 115, 47, 99, 109, 100, 66, 117, 102, 68, 117, 109, 112, 84, 111, 111, 108, 115, 47, 100, 101, 99, 111, 100,
+    101, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 46, 112, 121, 32, 116, 111, 32, 99, 111, 110, 118, 101, 114,
+    116, 32, 116, 104, 101, 32, 99, 111, 110, 116, 97, 105, 110, 101, 114, 32, 98, 97, 99, 107, 32, 105, 110, 116, 111,
+    32, 116, 104, 101, 32, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 70, 111, 114, 109, 97, 116, 32, 102, 105, 108,
+    101, 115, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 53, 56, 54, 50, 52, 55, 48, 49, 49,
+    125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 82, 101, 108, 97, 116,
+    105, 118, 101, 32, 100, 105, 114, 101, 99, 116, 111, 114, 121, 32, 119, 104, 101, 114, 101, 32, 99, 111, 109, 109,
+    97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 32, 100, 117, 109, 112, 115, 32, 97, 114, 101, 32, 112, 108, 97, 99,
+    101, 100, 46, 32, 82, 101, 108, 97, 116, 105, 118, 101, 32, 116, 111, 32, 116, 104, 101, 32, 112, 97, 116, 104, 32,
+    105, 110, 32, 116, 104, 101, 32, 65, 77, 68, 95, 68, 69, 66, 85, 71, 95, 68, 73, 82, 32, 101, 110, 118, 105, 114,
+    111, 110, 109, 101, 110, 116, 32, 118, 97, 114, 105, 97, 98, 108, 101, 46, 32, 73, 102, 32, 116, 104, 97, 116, 32,
+    101, 110, 118, 32, 118, 97, 114, 32, 105, 115, 110, 39, 116, 32, 115, 101, 116, 44, 32, 116, 104, 101, 32, 108, 111,
+    99, 97, 116, 105, 111, 110, 32, 105, 115, 32, 112, 108, 97, 116, 102, 111, 114, 109, 32, 100, 101, 112, 101, 110,
+    100, 101, 110, 116, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 114, 105, 110, 116, 105, 110, 103,
+    32, 97, 110, 100, 32, 76, 111, 103, 103, 105, 110, 103, 34, 93, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123,
+    34, 73, 115, 80, 97, 116, 104, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 97, 109, 100, 112, 97, 108, 47, 34, 44,
+    32, 34, 87, 105, 110, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 80, 97, 108, 67, 109, 100, 66, 117, 102, 102,
+    101, 114, 115, 92, 92, 34, 44, 32, 34, 76, 110, 120, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 97, 109, 100,
+    112, 97, 108, 47, 34, 125, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 34, 83, 101, 116,
+    116, 105, 110, 103, 115, 34, 58, 32, 91, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 48, 93, 44, 32, 34,
+    76, 111, 103, 105, 99, 79, 112, 34, 58, 32, 34, 71, 114, 101, 97, 116, 101, 114, 84, 104, 97, 110, 34, 44, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 77, 111, 100, 101, 34, 125, 93,
+    125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121,
+    34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 68, 105, 114, 101,
+    99, 116, 111, 114, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114, 105, 110, 103, 34, 44, 32,
+    34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 109, 100, 66, 117, 102, 68, 117, 109,
+    112, 68, 105, 114, 101, 99, 116, 111, 114, 121, 34, 44, 32, 34, 83, 105, 122, 101, 34, 58, 32, 34, 77, 97, 120, 80,
+    97, 116, 104, 83, 116, 114, 76, 101, 110, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 50,
+    57, 51, 50, 57, 53, 48, 50, 53, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 117, 98, 109, 105, 116,
+    84, 105, 109, 101, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 83, 116, 97, 114, 116, 70, 114, 97, 109, 101, 34,
+    44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 114, 105, 110, 116, 105, 110, 103, 32, 97, 110, 100, 32, 76,
+    111, 103, 103, 105, 110, 103, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32,
+    123, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91,
+    48, 93, 44, 32, 34, 76, 111, 103, 105, 99, 79, 112, 34, 58, 32, 34, 71, 114, 101, 97, 116, 101, 114, 84, 104, 97,
+    110, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 77, 111, 100,
+    101, 34, 125, 93, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97,
+    108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34,
+    86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 115, 117, 98, 109, 105, 116, 84, 105, 109,
+    101, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 83, 116, 97, 114, 116, 70, 114, 97, 109, 101, 34, 44, 32, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 104, 101, 32, 115, 116, 97, 114, 116, 105,
+    110, 103, 32, 102, 114, 97, 109, 101, 32, 116, 111, 32, 115, 116, 97, 114, 116, 32, 100, 117, 109, 112, 105, 110,
+    103, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 115, 46, 34, 44, 32, 34, 72, 97, 115,
+    104, 78, 97, 109, 101, 34, 58, 32, 49, 54, 51, 57, 51, 48, 53, 52, 53, 56, 125, 44, 32, 123, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 83, 117, 98, 109, 105, 116, 84, 105, 109, 101, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 69,
+    110, 100, 70, 114, 97, 109, 101, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 114, 105, 110, 116, 105,
+    110, 103, 32, 97, 110, 100, 32, 76, 111, 103, 103, 105, 110, 103, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 68, 101, 112, 101,
+    110, 100, 115, 79, 110, 34, 58, 32, 123, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 123, 34, 86, 97,
+    108, 117, 101, 115, 34, 58, 32, 91, 48, 93, 44, 32, 34, 76, 111, 103, 105, 99, 79, 112, 34, 58, 32, 34, 71, 114,
+    101, 97, 116, 101, 114, 84, 104, 97, 110, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117,
+    102, 68, 117, 109, 112, 77, 111, 100, 101, 34, 125, 44, 32, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 48,
+    93, 44, 32, 34, 76, 111, 103, 105, 99, 79, 112, 34, 58, 32, 34, 71, 114, 101, 97, 116, 101, 114, 84, 104, 97, 110,
+    34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 117, 98, 109, 105, 116, 84, 105, 109, 101, 67, 109, 100, 66,
+    117, 102, 68, 117, 109, 112, 83, 116, 97, 114, 116, 70, 114, 97, 109, 101, 34, 125, 93, 125, 44, 32, 34, 83, 99,
+    111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121,
+    112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97,
+    109, 101, 34, 58, 32, 34, 115, 117, 98, 109, 105, 116, 84, 105, 109, 101, 67, 109, 100, 66, 117, 102, 68, 117, 109,
+    112, 69, 110, 100, 70, 114, 97, 109, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 84, 104, 101, 32, 101, 110, 100, 105, 110, 103, 32, 102, 114, 97, 109, 101, 32, 116, 111, 32, 115, 116,
+    111, 112, 32, 100, 117, 109, 112, 105, 110, 103, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101,
+    114, 115, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 50, 50, 49, 57, 54, 49, 50, 57,
+    51, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 76, 111, 103, 67, 109, 100, 66, 117, 102, 67, 111, 109,
+    109, 105, 116, 83, 105, 122, 101, 115, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 114, 105, 110, 116,
+    105, 110, 103, 32, 97, 110, 100, 32, 76, 111, 103, 103, 105, 110, 103, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44,
+    32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 34, 66, 117, 105, 108, 100, 84, 121, 112, 101,
+    34, 58, 32, 91, 34, 100, 98, 103, 34, 93, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118,
+    97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34,
+    44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 108, 111, 103, 67, 109, 100, 66,
+    117, 102, 67, 111, 109, 109, 105, 116, 83, 105, 122, 101, 115, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 119, 104, 101, 116, 104, 101, 114, 32, 99,
+    111, 109, 109, 97, 110, 100, 32, 115, 116, 114, 101, 97, 109, 32, 99, 111, 109, 109, 105, 116, 32, 115, 105, 122,
+    101, 115, 32, 97, 114, 101, 32, 108, 111, 103, 103, 101, 100, 32, 116, 111, 32, 97, 32, 102, 105, 108, 101, 46, 34,
+    44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 50, 50, 50, 48, 48, 50, 53, 49, 55, 125, 44, 32,
+    123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 76, 111, 103, 80, 105, 112, 101, 108, 105, 110, 101, 73, 110, 102, 111,
+    34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 114, 105, 110, 116, 105, 110, 103, 32, 97, 110, 100, 32,
+    76, 111, 103, 103, 105, 110, 103, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115,
+    79, 110, 34, 58, 32, 123, 34, 66, 117, 105, 108, 100, 84, 121, 112, 101, 34, 58, 32, 91, 34, 100, 98, 103, 34, 93,
+    125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121,
+    34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 108, 111, 103, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 115, 32, 80, 105,
+    112, 101, 108, 105, 110, 101, 32, 76, 111, 103, 103, 105, 110, 103, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 56, 51, 53, 55, 57, 49, 53, 54, 51, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 80, 105, 112, 101, 108, 105, 110, 101, 32, 76, 111, 103, 103, 105, 110, 103, 32, 99,
+    111, 110, 102, 105, 103, 117, 114, 97, 116, 105, 111, 110, 32, 111, 112, 116, 105, 111, 110, 115, 34, 44, 32, 34,
+    84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 114, 105, 110, 116, 105, 110, 103, 32, 97, 110, 100, 32, 76, 111, 103,
+    103, 105, 110, 103, 34, 93, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 34, 66, 117,
+    105, 108, 100, 84, 121, 112, 101, 34, 58, 32, 91, 34, 100, 98, 103, 34, 93, 44, 32, 34, 83, 101, 116, 116, 105, 110,
+    103, 115, 34, 58, 32, 91, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 116, 114, 117, 101, 93, 44, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 76, 111, 103, 80, 105, 112, 101, 108, 105, 110, 101, 73, 110, 102, 111, 34, 125,
+    93, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101,
+    121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114, 117, 99, 116, 34, 44, 32, 34, 86, 97, 114,
+    105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 112, 105, 112, 101, 108, 105, 110, 101, 76, 111, 103, 67,
+    111, 110, 102, 105, 103, 34, 44, 32, 34, 83, 116, 114, 117, 99, 116, 117, 114, 101, 34, 58, 32, 91, 123, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 111, 108, 115, 32, 108, 111,
+    103, 103, 105, 110, 103, 32, 111, 102, 32, 105, 110, 116, 101, 114, 110, 97, 108, 108, 121, 32, 103, 101, 110, 101,
+    114, 97, 116, 101, 100, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 32, 40, 105, 46, 101, 46, 32, 82, 80, 77,
+    32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 44, 32, 101, 116, 99, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34,
+    84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97,
+    109, 101, 34, 58, 32, 34, 108, 111, 103, 73, 110, 116, 101, 114, 110, 97, 108, 34, 44, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 76, 111, 103, 73, 110, 116, 101, 114, 110, 97, 108, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101,
+    34, 58, 32, 50, 49, 54, 54, 52, 52, 55, 49, 51, 50, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 111, 108, 115, 32, 108, 111, 103, 103, 105, 110, 103, 32, 111, 102, 32,
+    101, 120, 116, 101, 114, 110, 97, 108, 108, 121, 32, 103, 101, 110, 101, 114, 97, 116, 101, 100, 32, 112, 105, 112,
+    101, 108, 105, 110, 101, 115, 32, 40, 105, 46, 101, 46, 32, 116, 104, 101, 32, 97, 112, 112, 108, 105, 99, 97, 116,
+    105, 111, 110, 39, 115, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34,
+    84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97,
+    109, 101, 34, 58, 32, 34, 108, 111, 103, 69, 120, 116, 101, 114, 110, 97, 108, 34, 44, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 76, 111, 103, 69, 120, 116, 101, 114, 110, 97, 108, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101,
+    34, 58, 32, 57, 51, 56, 52, 49, 53, 48, 51, 48, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 101, 97, 99, 104, 32, 115, 104, 97, 100, 101,
+    114, 32, 105, 110, 32, 97, 32, 112, 105, 112, 101, 108, 105, 110, 101, 32, 119, 105, 108, 108, 32, 98, 101, 32, 108,
+    111, 103, 103, 101, 100, 32, 116, 111, 32, 97, 32, 115, 101, 112, 97, 114, 97, 116, 101, 32, 102, 105, 108, 101, 32,
+    111, 110, 32, 100, 105, 115, 107, 46, 32, 79, 116, 104, 101, 114, 119, 105, 115, 101, 32, 116, 104, 101, 32, 119,
+    104, 111, 108, 101, 32, 112, 105, 112, 101, 108, 105, 110, 101, 32, 105, 115, 32, 112, 108, 97, 99, 101, 100, 32,
+    105, 110, 32, 97, 32, 115, 105, 110, 103, 108, 101, 32, 102, 105, 108, 101, 34, 44, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44,
+    32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101,
+    78, 97, 109, 101, 34, 58, 32, 34, 108, 111, 103, 83, 104, 97, 100, 101, 114, 115, 83, 101, 112, 97, 114, 97, 116,
+    101, 108, 121, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 76, 111, 103, 83, 104, 97, 100, 101, 114, 115, 83,
+    101, 112, 97, 114, 97, 116, 101, 108, 121, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 57,
+    53, 51, 55, 51, 52, 49, 54, 55, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 100, 117, 112, 108, 105, 99, 97, 116, 101, 32, 112, 105, 112, 101,
+    108, 105, 110, 101, 115, 32, 119, 105, 108, 108, 32, 98, 101, 32, 100, 117, 109, 112, 101, 100, 32, 116, 111, 32,
+    97, 32, 102, 105, 108, 101, 32, 119, 105, 116, 104, 32, 97, 32, 110, 117, 109, 101, 114, 105, 99, 32, 115, 117, 102,
+    102, 105, 120, 32, 97, 116, 116, 97, 99, 104, 101, 100, 32, 116, 111, 32, 116, 104, 101, 32, 102, 105, 108, 101,
+    110, 97, 109, 101, 32, 116, 111, 32, 100, 105, 115, 116, 105, 110, 103, 117, 105, 115, 104, 32, 101, 97, 99, 104,
+    32, 99, 111, 112, 121, 32, 111, 102, 32, 116, 104, 101, 32, 112, 105, 112, 101, 108, 105, 110, 101, 46, 34, 44, 32,
+    34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116,
+    114, 117, 101, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114,
+    105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 108, 111, 103, 68, 117, 112, 108, 105, 99, 97, 116, 101,
+    80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 76, 111, 103, 68, 117,
+    112, 108, 105, 99, 97, 116, 101, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34, 72, 97, 115, 104, 78,
+    97, 109, 101, 34, 58, 32, 51, 51, 52, 55, 50, 49, 55, 54, 56, 53, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 100, 105, 115, 97, 115, 115, 101,
+    109, 98, 108, 121, 32, 105, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 119, 105, 108, 108, 32, 98, 101,
+    32, 101, 109, 98, 101, 100, 100, 101, 100, 32, 105, 110, 116, 111, 32, 99, 111, 109, 112, 105, 108, 101, 100, 32,
+    69, 76, 70, 32, 98, 105, 110, 97, 114, 105, 101, 115, 46, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34,
+    58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 84, 121, 112,
+    101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 101, 109, 98, 101, 100, 80, 105, 112, 101, 108, 105, 110, 101, 68, 105, 115, 97, 115, 115, 101, 109, 98,
+    108, 121, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 69, 109, 98, 101, 100, 80, 105, 112, 101, 108, 105, 110,
+    101, 68, 105, 115, 97, 115, 115, 101, 109, 98, 108, 121, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58,
+    32, 51, 49, 55, 49, 51, 57, 57, 55, 55, 54, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115,
+    34, 58, 32, 123, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101,
+    115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 105, 112, 101, 108, 105, 110, 101, 76, 111, 103,
+    70, 105, 108, 116, 101, 114, 78, 111, 110, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 32, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 111, 32, 110, 111, 116, 32, 100, 105, 115,
+    97, 98, 108, 101, 32, 108, 111, 103, 103, 105, 110, 103, 32, 98, 97, 115, 101, 100, 32, 111, 110, 32, 112, 105, 112,
+    101, 108, 105, 110, 101, 32, 116, 121, 112, 101, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80,
+    105, 112, 101, 108, 105, 110, 101, 76, 111, 103, 70, 105, 108, 116, 101, 114, 67, 115, 34, 44, 32, 34, 86, 97, 108,
+    117, 101, 34, 58, 32, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105,
+    115, 97, 98, 108, 101, 32, 108, 111, 103, 103, 105, 110, 103, 32, 102, 111, 114, 32, 67, 115, 32, 112, 105, 112,
+    101, 108, 105, 110, 101, 115, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 105, 112, 101, 108,
+    105, 110, 101, 76, 111, 103, 70, 105, 108, 116, 101, 114, 78, 103, 103, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34,
+    58, 32, 50, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98,
+    108, 101, 32, 108, 111, 103, 103, 105, 110, 103, 32, 102, 111, 114, 32, 78, 71, 71, 32, 112, 105, 112, 101, 108,
+    105, 110, 101, 115, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 105, 112, 101, 108, 105, 110,
+    101, 76, 111, 103, 70, 105, 108, 116, 101, 114, 71, 115, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 44,
+    32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 32,
+    108, 111, 103, 103, 105, 110, 103, 32, 102, 111, 114, 32, 71, 115, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115,
+    34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 105, 112, 101, 108, 105, 110, 101, 76, 111, 103, 70,
+    105, 108, 116, 101, 114, 84, 101, 115, 115, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 56, 44, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 32, 108, 111, 103,
+    103, 105, 110, 103, 32, 102, 111, 114, 32, 84, 101, 115, 115, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 34,
+    125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 105, 112, 101, 108, 105, 110, 101, 76, 111, 103, 70,
+    105, 108, 116, 101, 114, 86, 115, 80, 115, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 54, 44, 32, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 32, 108, 111,
+    103, 103, 105, 110, 103, 32, 102, 111, 114, 32, 86, 115, 80, 115, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115,
+    34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 105, 112, 101, 108, 105, 110, 101, 76, 111, 103, 70,
+    105, 108, 116, 101, 114, 115, 34, 125, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 105, 112, 101, 108, 105,
+    110, 101, 84, 121, 112, 101, 70, 105, 108, 116, 101, 114, 34, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123,
+    34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 73, 115, 66, 105, 116, 109, 97, 115, 107, 34,
+    58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101,
+    102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51,
+    50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 112, 105, 112, 101, 108,
+    105, 110, 101, 84, 121, 112, 101, 70, 105, 108, 116, 101, 114, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 66, 105, 116, 102, 105, 101, 108, 100, 32, 119, 104, 105, 99, 104, 32, 97, 108, 108,
+    111, 119, 115, 32, 102, 111, 114, 32, 102, 105, 108, 116, 101, 114, 105, 110, 103, 32, 112, 105, 112, 101, 108, 105,
+    110, 101, 32, 108, 111, 103, 103, 105, 110, 103, 32, 116, 111, 32, 101, 120, 99, 108, 117, 100, 101, 32, 115, 112,
+    101, 99, 105, 102, 105, 99, 32, 112, 105, 112, 101, 108, 105, 110, 101, 32, 116, 121, 112, 101, 115, 46, 32, 32, 73,
+    102, 32, 97, 32, 98, 105, 116, 32, 105, 115, 32, 115, 101, 116, 32, 116, 104, 101, 110, 32, 116, 104, 97, 116, 32,
+    112, 105, 112, 101, 108, 105, 110, 101, 32, 116, 121, 112, 101, 32, 119, 105, 108, 108, 32, 78, 79, 84, 32, 98, 101,
+    32, 108, 111, 103, 103, 101, 100, 46, 32, 32, 84, 104, 101, 32, 98, 105, 116, 115, 32, 97, 114, 101, 32, 100, 101,
+    102, 105, 110, 101, 100, 32, 105, 110, 32, 116, 104, 101, 32, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 32,
+    97, 114, 114, 97, 121, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 55, 51, 55, 51, 48,
+    52, 56, 52, 53, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 76, 111, 103, 80, 105, 112, 101, 108, 105,
+    110, 101, 72, 97, 115, 104, 34, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34,
+    58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101,
+    102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 54,
+    52, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 108, 111, 103, 80, 105,
+    112, 101, 108, 105, 110, 101, 72, 97, 115, 104, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 83, 112, 101, 99, 105, 102, 105, 99, 32, 112, 105, 112, 101, 108, 105, 110, 101, 32, 104, 97, 115,
+    104, 32, 116, 111, 32, 108, 111, 103, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 51,
+    53, 55, 55, 56, 50, 52, 56, 55, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 82, 101, 108, 97, 116, 105, 118, 101, 32, 100, 105, 114, 101, 99, 116, 111, 114, 121, 32, 119, 104, 101,
+    114, 101, 32, 112, 105, 112, 101, 108, 105, 110, 101, 32, 105, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32,
+    108, 111, 103, 115, 32, 97, 114, 101, 32, 112, 108, 97, 99, 101, 100, 46, 32, 82, 101, 108, 97, 116, 105, 118, 101,
+    32, 116, 111, 32, 116, 104, 101, 32, 112, 97, 116, 104, 32, 105, 110, 32, 116, 104, 101, 32, 65, 77, 68, 95, 68, 69,
+    66, 85, 71, 95, 68, 73, 82, 32, 101, 110, 118, 105, 114, 111, 110, 109, 101, 110, 116, 32, 118, 97, 114, 105, 97,
+    98, 108, 101, 46, 32, 73, 102, 32, 116, 104, 97, 116, 32, 101, 110, 118, 32, 118, 97, 114, 32, 105, 115, 110, 39,
+    116, 32, 115, 101, 116, 44, 32, 116, 104, 101, 32, 108, 111, 99, 97, 116, 105, 111, 110, 32, 105, 115, 32, 112, 108,
+    97, 116, 102, 111, 114, 109, 32, 100, 101, 112, 101, 110, 100, 101, 110, 116, 46, 32, 69, 97, 99, 104, 32, 117, 110,
+    105, 113, 117, 101, 32, 112, 105, 112, 101, 108, 105, 110, 101, 32, 105, 115, 32, 105, 110, 32, 97, 32, 115, 101,
+    112, 97, 114, 97, 116, 101, 32, 102, 105, 108, 101, 32, 119, 105, 116, 104, 105, 110, 32, 116, 104, 97, 116, 32,
+    100, 105, 114, 101, 99, 116, 111, 114, 121, 46, 32, 84, 104, 101, 32, 108, 111, 103, 32, 110, 97, 109, 101, 32, 105,
+    115, 32, 98, 97, 115, 101, 100, 32, 111, 110, 32, 97, 32, 104, 97, 115, 104, 32, 111, 102, 32, 116, 104, 101, 32,
+    112, 105, 112, 101, 108, 105, 110, 101, 39, 115, 32, 99, 114, 101, 97, 116, 101, 32, 105, 110, 102, 111, 32, 97,
+    110, 100, 32, 119, 104, 105, 99, 104, 32, 115, 104, 97, 100, 101, 114, 32, 115, 116, 97, 103, 101, 115, 32, 97, 114,
+    101, 32, 97, 99, 116, 105, 118, 101, 46, 34, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 80,
+    97, 116, 104, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32,
+    123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 97, 109, 100, 112, 97, 108, 47, 34, 44, 32, 34, 87, 105,
+    110, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 80, 97, 108, 80, 105, 112, 101, 108, 105, 110, 101, 115, 92,
+    92, 34, 44, 32, 34, 76, 110, 120, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 97, 109, 100, 112, 97, 108, 47,
+    34, 125, 44, 32, 34, 83, 105, 122, 101, 34, 58, 32, 34, 77, 97, 120, 80, 97, 116, 104, 83, 116, 114, 76, 101, 110,
+    34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114, 105, 110, 103, 34, 44, 32, 34, 86, 97, 114, 105,
+    97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 112, 105, 112, 101, 108, 105, 110, 101, 76, 111, 103, 68, 105,
+    114, 101, 99, 116, 111, 114, 121, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 105, 112, 101, 108, 105,
+    110, 101, 76, 111, 103, 68, 105, 114, 101, 99, 116, 111, 114, 121, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 49, 54, 50, 53, 56, 51, 57, 52, 54, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 105,
+    112, 101, 108, 105, 110, 101, 76, 111, 103, 67, 111, 110, 102, 105, 103, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 50, 53, 56, 55, 56, 52, 53, 56, 50, 53, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 67, 109, 100, 83, 116, 114, 101, 97, 109, 82, 101, 115, 101, 114, 118, 101, 76, 105, 109, 105, 116, 34, 44, 32,
+    34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 67, 111, 109, 109, 97, 110, 100, 32, 66, 117, 102, 102, 101, 114, 34, 93,
+    44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32,
+    50, 53, 54, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108,
+    75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97,
+    114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 109, 100, 83, 116, 114, 101, 97, 109, 82, 101,
+    115, 101, 114, 118, 101, 76, 105, 109, 105, 116, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 83, 112, 101, 99, 105, 102, 105, 101, 115, 32, 104, 111, 119, 32, 109, 97, 110, 121, 32, 68,
+    87, 79, 82, 68, 115, 32, 111, 102, 32, 99, 111, 109, 109, 97, 110, 100, 32, 115, 112, 97, 99, 101, 32, 105, 115, 32,
+    114, 101, 115, 101, 114, 118, 101, 100, 32, 98, 121, 32, 82, 101, 115, 101, 114, 118, 101, 67, 111, 109, 109, 97,
+    110, 100, 115, 40, 41, 46, 32, 84, 104, 105, 115, 32, 119, 105, 108, 108, 32, 98, 101, 32, 99, 108, 97, 109, 112,
+    101, 100, 32, 98, 121, 32, 101, 97, 99, 104, 32, 67, 109, 100, 83, 116, 114, 101, 97, 109, 32, 116, 111, 32, 116,
+    104, 101, 105, 114, 32, 67, 109, 100, 65, 108, 108, 111, 99, 97, 116, 111, 114, 39, 115, 32, 99, 104, 117, 110, 107,
+    32, 115, 105, 122, 101, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 56, 52, 51, 57, 49,
+    51, 54, 48, 52, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 83, 116, 114, 101, 97, 109,
+    69, 110, 97, 98, 108, 101, 77, 101, 109, 115, 101, 116, 79, 110, 82, 101, 115, 101, 114, 118, 101, 34, 44, 32, 34,
+    84, 97, 103, 115, 34, 58, 32, 91, 34, 67, 111, 109, 109, 97, 110, 100, 32, 66, 117, 102, 102, 101, 114, 34, 93, 44,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102,
+    97, 108, 115, 101, 125, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 34, 66, 117, 105,
+    108, 100, 84, 121, 112, 101, 34, 58, 32, 91, 34, 100, 98, 103, 34, 93, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34,
+    58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58,
+    32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99,
+    109, 100, 83, 116, 114, 101, 97, 109, 69, 110, 97, 98, 108, 101, 77, 101, 109, 115, 101, 116, 79, 110, 82, 101, 115,
+    101, 114, 118, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102,
+    32, 116, 114, 117, 101, 44, 32, 116, 104, 101, 32, 99, 111, 109, 109, 97, 110, 100, 32, 115, 116, 114, 101, 97, 109,
+    32, 119, 105, 108, 108, 32, 109, 101, 109, 115, 101, 116, 32, 97, 108, 108, 32, 99, 111, 109, 109, 97, 110, 100, 32,
+    115, 112, 97, 99, 101, 32, 116, 111, 32, 67, 109, 100, 83, 116, 114, 101, 97, 109, 77, 101, 109, 115, 101, 116, 86,
+    97, 108, 117, 101, 46, 32, 84, 104, 105, 115, 32, 119, 105, 108, 108, 32, 111, 110, 108, 121, 32, 102, 117, 110, 99,
+    116, 105, 111, 110, 32, 111, 110, 32, 100, 101, 98, 117, 103, 32, 98, 117, 105, 108, 100, 115, 46, 34, 44, 32, 34,
+    72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 57, 50, 55, 53, 50, 49, 50, 55, 52, 125, 44, 32, 123, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 83, 116, 114, 101, 97, 109, 77, 101, 109, 115, 101, 116, 86, 97, 108,
+    117, 101, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 67, 111, 109, 109, 97, 110, 100, 32, 66, 117, 102,
+    102, 101, 114, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117,
+    108, 116, 34, 58, 32, 52, 50, 57, 52, 57, 54, 55, 50, 57, 53, 125, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79,
+    110, 34, 58, 32, 123, 34, 66, 117, 105, 108, 100, 84, 121, 112, 101, 34, 58, 32, 91, 34, 100, 98, 103, 34, 93, 44,
+    32, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109,
+    100, 83, 116, 114, 101, 97, 109, 69, 110, 97, 98, 108, 101, 77, 101, 109, 115, 101, 116, 79, 110, 82, 101, 115, 101,
+    114, 118, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 116, 114, 117, 101, 125, 93, 125, 44, 32, 34, 83,
+    99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84,
+    121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78,
+    97, 109, 101, 34, 58, 32, 34, 99, 109, 100, 83, 116, 114, 101, 97, 109, 77, 101, 109, 115, 101, 116, 86, 97, 108,
+    117, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 67, 109,
+    100, 83, 116, 114, 101, 97, 109, 69, 110, 97, 98, 108, 101, 77, 101, 109, 115, 101, 116, 79, 110, 82, 101, 115, 101,
+    114, 118, 101, 32, 105, 115, 32, 116, 114, 117, 101, 32, 97, 108, 108, 32, 99, 111, 109, 109, 97, 110, 100, 32, 115,
+    112, 97, 99, 101, 32, 119, 105, 108, 108, 32, 98, 101, 32, 109, 101, 109, 115, 101, 116, 32, 116, 111, 32, 116, 104,
+    105, 115, 32, 118, 97, 108, 117, 101, 46, 32, 84, 104, 105, 115, 32, 119, 105, 108, 108, 32, 111, 110, 108, 121, 32,
+    102, 117, 110, 99, 116, 105, 111, 110, 32, 111, 110, 32, 100, 101, 98, 117, 103, 32, 98, 117, 105, 108, 100, 115,
+    46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 54, 54, 49, 52, 53, 53, 52, 52, 49, 125, 44,
+    32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 67, 104, 117, 110, 107, 69, 110, 97, 98,
+    108, 101, 83, 116, 97, 103, 105, 110, 103, 66, 117, 102, 102, 101, 114, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58,
+    32, 91, 34, 67, 111, 109, 109, 97, 110, 100, 32, 66, 117, 102, 102, 101, 114, 34, 93, 44, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125,
+    44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34,
+    44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 109, 100, 66, 117, 102, 67, 104, 117, 110, 107, 69, 110, 97, 98, 108,
+    101, 83, 116, 97, 103, 105, 110, 103, 66, 117, 102, 102, 101, 114, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 101, 97, 99, 104, 32, 99, 111, 109,
+    109, 97, 110, 100, 32, 99, 104, 117, 110, 107, 32, 119, 105, 108, 108, 32, 97, 108, 108, 111, 99, 97, 116, 101, 32,
+    97, 32, 115, 121, 115, 116, 101, 109, 32, 109, 101, 109, 111, 114, 121, 32, 115, 116, 97, 103, 105, 110, 103, 32,
+    98, 117, 102, 102, 101, 114, 46, 32, 67, 111, 109, 109, 97, 110, 100, 115, 32, 119, 105, 108, 108, 32, 98, 101, 32,
+    115, 116, 111, 114, 101, 100, 32, 105, 110, 32, 116, 104, 105, 115, 32, 98, 117, 102, 102, 101, 114, 32, 117, 110,
+    116, 105, 108, 32, 116, 104, 101, 32, 99, 104, 117, 110, 107, 32, 105, 115, 32, 102, 105, 110, 97, 108, 105, 122,
+    101, 100, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 54, 57, 49, 54, 49, 54, 56, 53,
+    125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 65, 108, 108, 111, 99, 97, 116, 111, 114, 70,
+    114, 101, 101, 79, 110, 82, 101, 115, 101, 116, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 67, 111, 109,
+    109, 97, 110, 100, 32, 66, 117, 102, 102, 101, 114, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34,
+    58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 83, 99, 111,
+    112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112,
+    101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 99, 109, 100, 65, 108, 108, 111, 99, 97, 116, 111, 114, 70, 114, 101, 101, 79, 110, 82, 101, 115, 101,
+    116, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114,
+    117, 101, 44, 32, 101, 97, 99, 104, 32, 99, 111, 109, 109, 97, 110, 100, 32, 97, 108, 108, 111, 99, 97, 116, 111,
+    114, 32, 119, 105, 108, 108, 32, 102, 114, 101, 101, 32, 105, 116, 115, 32, 99, 111, 109, 109, 97, 110, 100, 32, 99,
+    104, 117, 110, 107, 32, 97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 115, 32, 119, 104, 101, 110, 32, 116, 104,
+    101, 32, 99, 108, 105, 101, 110, 116, 32, 99, 97, 108, 108, 115, 32, 73, 67, 109, 100, 65, 108, 108, 111, 99, 97,
+    116, 111, 114, 58, 58, 82, 101, 115, 101, 116, 40, 41, 32, 101, 118, 101, 110, 32, 116, 104, 111, 117, 103, 104, 32,
+    116, 104, 105, 115, 32, 98, 101, 104, 97, 118, 105, 111, 114, 32, 105, 115, 32, 97, 103, 97, 105, 110, 115, 116, 32,
+    116, 104, 101, 32, 114, 117, 108, 101, 115, 32, 111, 102, 32, 116, 104, 101, 32, 68, 88, 49, 50, 32, 115, 112, 101,
+    99, 105, 102, 105, 99, 97, 116, 105, 111, 110, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32,
+    49, 52, 54, 49, 49, 54, 52, 55, 48, 54, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 65,
+    108, 108, 111, 99, 97, 116, 111, 114, 76, 105, 110, 101, 97, 114, 65, 108, 108, 111, 99, 67, 111, 109, 109, 105,
+    116, 65, 104, 101, 97, 100, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 67, 111, 109, 109, 97, 110, 100,
+    32, 66, 117, 102, 102, 101, 114, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 54, 51, 56, 52, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34,
+    80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117,
+    105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99,
+    109, 100, 65, 108, 108, 111, 99, 97, 116, 111, 114, 76, 105, 110, 101, 97, 114, 65, 108, 108, 111, 99, 67, 111, 109,
+    109, 105, 116, 65, 104, 101, 97, 100, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 77, 97, 120, 105, 109, 117, 109, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 98, 121, 116, 101, 115,
+    32, 116, 104, 101, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 32, 108, 105, 110, 101, 97,
+    114, 32, 97, 108, 108, 111, 99, 97, 116, 111, 114, 115, 32, 99, 111, 109, 109, 105, 116, 32, 97, 104, 101, 97, 100,
+    32, 111, 102, 32, 116, 104, 101, 32, 99, 117, 114, 114, 101, 110, 116, 32, 97, 108, 108, 111, 99, 97, 116, 105, 111,
+    110, 46, 32, 84, 104, 101, 32, 99, 111, 109, 109, 105, 116, 45, 97, 104, 101, 97, 100, 32, 115, 105, 122, 101, 32,
+    115, 116, 97, 114, 116, 115, 32, 97, 116, 32, 111, 110, 101, 32, 112, 97, 103, 101, 32, 97, 110, 100, 32, 100, 111,
+    117, 98, 108, 101, 115, 32, 111, 110, 32, 101, 118, 101, 114, 121, 32, 99, 111, 109, 109, 105, 116, 32, 117, 110,
+    116, 105, 108, 32, 105, 116, 32, 114, 101, 97, 99, 104, 101, 115, 32, 116, 104, 105, 115, 32, 115, 105, 122, 101,
+    46, 32, 90, 101, 114, 111, 32, 99, 111, 109, 109, 105, 116, 115, 32, 111, 110, 108, 121, 32, 116, 104, 101, 32, 112,
+    97, 103, 101, 115, 32, 101, 97, 99, 104, 32, 97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 32, 110, 101, 101, 100,
+    115, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 49, 54, 49, 56, 57, 48, 54, 53, 54,
+    125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 73, 115, 69, 110, 117,
+    109, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 80, 109, 52, 79, 112, 116, 68, 101, 102, 97, 117, 108, 116, 69, 110, 97, 98, 108, 101, 34, 44,
+    32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 79, 110, 108, 121, 32, 101, 110, 97, 98, 108, 101, 32, 111, 112, 116, 105, 109, 105, 122, 97, 116, 105,
+    111, 110, 115, 32, 119, 104, 101, 110, 32, 116, 104, 101, 32, 97, 112, 112, 32, 115, 112, 101, 99, 105, 102, 105,
+    101, 115, 32, 116, 104, 101, 32, 67, 77, 68, 95, 66, 85, 70, 70, 69, 82, 95, 79, 80, 84, 73, 77, 73, 90, 69, 95, 71,
+    80, 85, 95, 83, 77, 65, 76, 76, 95, 66, 65, 84, 67, 72, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102,
+    101, 114, 32, 98, 117, 105, 108, 100, 32, 102, 108, 97, 103, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 80, 109, 52, 79, 112, 116, 70, 111, 114, 99, 101, 69, 110, 97, 98, 108, 101, 34, 44, 32, 34, 86, 97, 108,
+    117, 101, 34, 58, 32, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 111,
+    114, 99, 101, 32, 111, 112, 116, 105, 109, 105, 122, 97, 116, 105, 111, 110, 115, 32, 97, 108, 119, 97, 121, 115,
+    32, 101, 110, 97, 98, 108, 101, 100, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 109, 52,
+    79, 112, 116, 70, 111, 114, 99, 101, 68, 105, 115, 97, 98, 108, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58,
+    32, 50, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 111, 114, 99, 101, 32,
+    111, 112, 116, 105, 109, 105, 122, 97, 116, 105, 111, 110, 115, 32, 97, 108, 119, 97, 121, 115, 32, 100, 105, 115,
+    97, 98, 108, 101, 100, 46, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 109, 52, 79, 112, 116, 69,
+    110, 97, 98, 108, 101, 34, 44, 32, 34, 73, 115, 69, 120, 108, 117, 115, 105, 118, 101, 34, 58, 32, 116, 114, 117,
+    101, 125, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 79, 112, 116, 105, 109, 105,
+    122, 101, 80, 109, 52, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 67, 111, 109, 109, 97, 110, 100, 32,
+    66, 117, 102, 102, 101, 114, 34, 44, 32, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 93, 44, 32, 34,
+    68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 80, 109,
+    52, 79, 112, 116, 68, 101, 102, 97, 117, 108, 116, 69, 110, 97, 98, 108, 101, 34, 125, 44, 32, 34, 83, 99, 111, 112,
+    101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101,
+    34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58,
+    32, 34, 99, 109, 100, 66, 117, 102, 79, 112, 116, 105, 109, 105, 122, 101, 80, 109, 52, 34, 44, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 102, 105,
+    110, 101, 45, 103, 114, 97, 105, 110, 101, 100, 32, 111, 112, 116, 105, 109, 105, 122, 97, 116, 105, 111, 110, 32,
+    111, 102, 32, 101, 97, 99, 104, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 39, 115, 32,
+    80, 77, 52, 32, 115, 116, 114, 101, 97, 109, 46, 32, 67, 97, 110, 32, 105, 109, 112, 114, 111, 118, 101, 32, 112,
+    101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 111, 102, 32, 67, 80, 45, 98, 111, 117, 110, 100, 32, 97, 112,
+    112, 108, 105, 99, 97, 116, 105, 111, 110, 115, 32, 116, 104, 97, 116, 32, 104, 97, 118, 101, 32, 67, 80, 85, 32,
+    99, 121, 99, 108, 101, 115, 32, 116, 111, 32, 115, 112, 97, 114, 101, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 49, 48, 49, 56, 56, 57, 53, 50, 56, 56, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97,
+    108, 117, 101, 115, 34, 58, 32, 123, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 86,
+    97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 70,
+    111, 114, 99, 101, 67, 112, 117, 85, 112, 100, 97, 116, 101, 80, 97, 116, 104, 68, 101, 102, 97, 117, 108, 116, 34,
+    44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 78, 111, 32, 111, 118, 101, 114, 114, 105, 100, 101, 44, 32, 117, 115, 101, 32, 99, 108, 105, 101,
+    110, 116, 39, 115, 32, 112, 114, 101, 102, 101, 114, 101, 110, 99, 101, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 70, 111, 114, 99, 101, 67, 112, 117, 85, 112, 100, 97, 116, 101,
+    80, 97, 116, 104, 79, 110, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 32, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 111, 114, 99, 101, 32, 80, 65, 76, 32, 116, 111, 32, 117, 115,
+    101, 32, 116, 104, 101, 32, 67, 80, 85, 32, 117, 112, 100, 97, 116, 101, 32, 112, 97, 116, 104, 32, 102, 111, 114,
+    32, 118, 101, 114, 116, 101, 120, 32, 98, 117, 102, 102, 101, 114, 44, 32, 115, 116, 114, 101, 97, 109, 45, 111,
+    117, 116, 32, 97, 110, 100, 32, 115, 112, 105, 108, 108, 32, 116, 97, 98, 108, 101, 115, 46, 34, 125, 44, 32, 123,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 70, 111, 114, 99, 101, 67, 112, 117, 85, 112, 100,
+    97, 116, 101, 80, 97, 116, 104, 79, 102, 102, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 111, 114, 99, 101, 32, 80, 65, 76, 32, 116,
+    111, 32, 117, 115, 101, 32, 116, 104, 101, 32, 67, 69, 32, 82, 65, 77, 32, 112, 97, 116, 104, 32, 102, 111, 114, 32,
+    118, 101, 114, 116, 101, 120, 32, 98, 117, 102, 102, 101, 114, 44, 32, 115, 116, 114, 101, 97, 109, 45, 111, 117,
+    116, 32, 97, 110, 100, 32, 115, 112, 105, 108, 108, 32, 116, 97, 98, 108, 101, 115, 46, 34, 125, 93, 44, 32, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 70, 111, 114, 99, 101, 67, 112, 117, 85, 112, 100, 97,
+    116, 101, 80, 97, 116, 104, 34, 44, 32, 34, 73, 115, 69, 120, 99, 108, 117, 115, 105, 118, 101, 34, 58, 32, 116,
+    114, 117, 101, 125, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 70, 111, 114, 99, 101,
+    67, 112, 117, 85, 112, 100, 97, 116, 101, 80, 97, 116, 104, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34,
+    67, 111, 109, 109, 97, 110, 100, 32, 66, 117, 102, 102, 101, 114, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 70, 111,
+    114, 99, 101, 67, 112, 117, 85, 112, 100, 97, 116, 101, 80, 97, 116, 104, 79, 110, 34, 125, 44, 32, 34, 83, 99, 111,
+    112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112,
+    101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 99, 109, 100, 66, 117, 102, 70, 111, 114, 99, 101, 67, 112, 117, 85, 112, 100, 97, 116, 101, 80, 97,
+    116, 104, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 71, 108, 111, 98, 97,
+    108, 108, 121, 32, 111, 118, 101, 114, 114, 105, 100, 101, 115, 32, 116, 104, 101, 32, 118, 97, 108, 117, 101, 32,
+    111, 102, 32, 67, 109, 100, 66, 117, 102, 102, 101, 114, 66, 117, 105, 108, 100, 70, 108, 97, 103, 115, 58, 58, 117,
+    115, 101, 67, 112, 117, 80, 97, 116, 104, 70, 111, 114, 84, 97, 98, 108, 101, 85, 112, 100, 97, 116, 101, 115, 32,
+    112, 97, 115, 115, 101, 100, 32, 105, 110, 32, 98, 121, 32, 116, 104, 101, 32, 99, 108, 105, 101, 110, 116, 46, 34,
+    44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 50, 56, 50, 57, 49, 49, 50, 56, 49, 125, 44, 32,
+    123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 73, 115, 69, 110, 117, 109, 34, 58,
+    32, 116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 67, 109, 100, 66, 117, 102, 70, 111, 114, 99, 101, 79, 110, 101, 84, 105, 109, 101, 83, 117, 98, 109, 105,
+    116, 68, 101, 102, 97, 117, 108, 116, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 78, 111, 32, 111, 118, 101, 114, 114, 105, 100, 101, 44,
+    32, 117, 115, 101, 32, 97, 112, 112, 39, 115, 32, 112, 114, 101, 102, 101, 114, 101, 110, 99, 101, 46, 34, 125, 44,
+    32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 70, 111, 114, 99, 101, 79, 110, 101, 84,
+    105, 109, 101, 83, 117, 98, 109, 105, 116, 79, 110, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 111, 114, 99, 101, 32, 67, 77, 68, 95,
+    66, 85, 70, 70, 69, 82, 95, 79, 78, 69, 95, 84, 73, 77, 69, 95, 83, 85, 66, 77, 73, 84, 32, 97, 108, 119, 97, 121,
+    115, 32, 111, 110, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 70,
+    111, 114, 99, 101, 79, 110, 101, 84, 105, 109, 101, 83, 117, 98, 109, 105, 116, 79, 102, 102, 34, 44, 32, 34, 86,
+    97, 108, 117, 101, 34, 58, 32, 50, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    70, 111, 114, 99, 101, 32, 67, 77, 68, 95, 66, 85, 70, 70, 69, 82, 95, 79, 78, 69, 95, 84, 73, 77, 69, 95, 83, 85,
+    66, 77, 73, 84, 32, 97, 108, 119, 97, 121, 115, 32, 111, 102, 102, 46, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 70, 111, 114, 99, 101, 79, 110, 101, 84, 105, 109, 101, 83, 117, 98,
+    109, 105, 116, 34, 44, 32, 34, 73, 115, 69, 120, 108, 117, 115, 105, 118, 101, 34, 58, 32, 116, 114, 117, 101, 125,
+    44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 70, 111, 114, 99, 101, 79, 110, 101, 84,
+    105, 109, 101, 83, 117, 98, 109, 105, 116, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 67, 111, 109, 109,
+    97, 110, 100, 32, 66, 117, 102, 102, 101, 114, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32,
+    123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 70, 111, 114, 99, 101, 79,
+    110, 101, 84, 105, 109, 101, 83, 117, 98, 109, 105, 116, 68, 101, 102, 97, 117, 108, 116, 34, 125, 44, 32, 34, 83,
+    99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84,
+    121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109,
+    101, 34, 58, 32, 34, 99, 109, 100, 66, 117, 102, 70, 111, 114, 99, 101, 79, 110, 101, 84, 105, 109, 101, 83, 117,
+    98, 109, 105, 116, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 71, 108,
+    111, 98, 97, 108, 108, 121, 32, 111, 118, 101, 114, 114, 105, 100, 101, 115, 32, 116, 104, 101, 32, 67, 77, 68, 95,
+    66, 85, 70, 70, 69, 82, 95, 79, 78, 69, 95, 84, 73, 77, 69, 95, 83, 85, 66, 77, 73, 84, 32, 99, 111, 109, 109, 97,
+    110, 100, 32, 98, 117, 102, 102, 101, 114, 32, 98, 117, 105, 108, 100, 105, 110, 103, 32, 102, 108, 97, 103, 46, 34,
+    44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 57, 48, 57, 57, 51, 52, 54, 55, 54, 125, 44, 32, 123,
+    34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32,
+    116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 67, 109, 100, 66, 117, 102, 80, 114, 101, 101, 109, 112, 116, 77, 111, 100, 101, 68, 105, 115, 97, 98, 108, 101,
+    34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 67, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 115, 32, 119, 105, 108, 108,
+    32, 110, 111, 116, 32, 98, 101, 32, 112, 114, 101, 101, 109, 112, 116, 101, 100, 32, 98, 117, 116, 32, 111, 117,
+    114, 32, 113, 117, 101, 117, 101, 115, 32, 115, 117, 112, 112, 111, 114, 116, 32, 112, 114, 101, 101, 109, 112, 116,
+    105, 111, 110, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 80, 114,
+    101, 101, 109, 112, 116, 77, 111, 100, 101, 69, 110, 97, 98, 108, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34,
+    58, 32, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 109, 109, 97,
+    110, 100, 32, 98, 117, 102, 102, 101, 114, 115, 32, 109, 97, 121, 32, 98, 101, 32, 112, 114, 101, 101, 109, 112,
+    116, 101, 100, 32, 105, 102, 32, 75, 77, 68, 32, 114, 101, 112, 111, 114, 116, 115, 32, 115, 117, 112, 112, 111,
+    114, 116, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 80, 114, 101,
+    101, 109, 112, 116, 77, 111, 100, 101, 70, 117, 108, 108, 68, 105, 115, 97, 98, 108, 101, 85, 110, 115, 97, 102,
+    101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 80, 65, 76, 32, 112, 114, 101, 116, 101, 110, 100, 115, 32, 75, 77, 68, 32, 100, 111, 101,
+    115, 110, 39, 116, 32, 115, 117, 112, 112, 111, 114, 116, 32, 109, 105, 100, 45, 99, 111, 109, 109, 97, 110, 100,
+    32, 98, 117, 102, 102, 101, 114, 32, 112, 114, 101, 101, 109, 112, 116, 105, 111, 110, 46, 32, 84, 104, 105, 115,
+    32, 99, 97, 110, 32, 104, 97, 110, 103, 32, 111, 114, 32, 99, 111, 114, 114, 117, 112, 116, 32, 111, 116, 104, 101,
+    114, 32, 100, 114, 105, 118, 101, 114, 115, 46, 32, 73, 116, 32, 109, 117, 115, 116, 32, 111, 110, 108, 121, 32, 98,
+    101, 32, 117, 115, 101, 100, 32, 102, 111, 114, 32, 100, 101, 98, 117, 103, 46, 34, 125, 93, 44, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 80, 114, 101, 101, 109, 112, 116, 77, 111, 100, 101, 34, 125,
+    44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 80, 114, 101, 101, 109, 112, 116, 105,
+    111, 110, 77, 111, 100, 101, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 67, 111, 109, 109, 97, 110, 100,
+    32, 66, 117, 102, 102, 101, 114, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 80, 114, 101, 101, 109, 112, 116, 77, 111,
+    100, 101, 69, 110, 97, 98, 108, 101, 34, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118,
+    97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34,
+    44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 109, 100, 66, 117, 102, 80,
+    114, 101, 101, 109, 112, 116, 105, 111, 110, 77, 111, 100, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 116, 111, 32, 119, 104, 97, 116, 32,
+    100, 101, 103, 114, 101, 101, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 115, 32, 115,
+    117, 112, 112, 111, 114, 116, 32, 109, 105, 100, 45, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101,
+    114, 32, 112, 114, 101, 101, 109, 112, 116, 105, 111, 110, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101,
+    34, 58, 32, 51, 54, 52, 48, 53, 50, 55, 50, 48, 56, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117,
+    101, 115, 34, 58, 32, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 80, 65, 76, 32, 119, 105, 108, 108, 32, 100, 117, 109, 112, 32, 67, 69, 32, 82,
+    65, 77, 32, 117, 115, 105, 110, 103, 32, 97, 32, 112, 111, 115, 116, 97, 109, 98, 108, 101, 32, 99, 111, 109, 109,
+    97, 110, 100, 32, 115, 116, 114, 101, 97, 109, 32, 119, 104, 101, 110, 101, 118, 101, 114, 32, 101, 105, 116, 104,
+    101, 114, 32, 77, 67, 66, 80, 32, 105, 115, 32, 101, 110, 97, 98, 108, 101, 100, 32, 111, 114, 32, 116, 104, 101,
+    32, 99, 108, 105, 101, 110, 116, 32, 101, 110, 97, 98, 108, 101, 115, 32, 116, 104, 101, 32, 39, 112, 101, 114, 115,
+    105, 115, 116, 101, 110, 116, 32, 67, 69, 32, 82, 65, 77, 39, 32, 102, 101, 97, 116, 117, 114, 101, 46, 34, 44, 32,
+    34, 86, 97, 108, 117, 101, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 80, 65, 76, 32, 119, 105, 108, 108, 32, 100, 117, 109, 112, 32, 67, 69, 32, 82,
+    65, 77, 32, 117, 115, 105, 110, 103, 32, 97, 32, 112, 111, 115, 116, 97, 109, 98, 108, 101, 32, 99, 111, 109, 109,
+    97, 110, 100, 32, 115, 116, 114, 101, 97, 109, 32, 119, 104, 101, 110, 101, 118, 101, 114, 32, 116, 104, 101, 32,
+    99, 108, 105, 101, 110, 116, 32, 101, 110, 97, 98, 108, 101, 115, 32, 80, 65, 76, 39, 115, 32, 39, 112, 101, 114,
+    115, 105, 115, 116, 101, 110, 116, 32, 67, 69, 32, 82, 65, 77, 39, 32, 102, 101, 97, 116, 117, 114, 101, 46, 32, 40,
+    84, 121, 112, 105, 99, 97, 108, 108, 121, 32, 111, 110, 108, 121, 32, 68, 88, 57, 80, 32, 119, 105, 108, 108, 32,
+    100, 111, 32, 116, 104, 105, 115, 41, 46, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 102, 97, 108, 115, 101,
+    125, 93, 125, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 111, 109, 109, 97, 110, 100, 66, 117, 102, 102, 101,
+    114, 70, 111, 114, 99, 101, 67, 101, 82, 97, 109, 68, 117, 109, 112, 73, 110, 80, 111, 115, 116, 97, 109, 98, 108,
+    101, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 67, 111, 109, 109, 97, 110, 100, 32, 66, 117, 102, 102,
+    101, 114, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108,
+    116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118,
+    97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34,
+    44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 111, 109, 109, 97, 110, 100,
+    66, 117, 102, 102, 101, 114, 70, 111, 114, 99, 101, 67, 101, 82, 97, 109, 68, 117, 109, 112, 73, 110, 80, 111, 115,
+    116, 97, 109, 98, 108, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84,
+    111, 103, 103, 108, 101, 115, 32, 119, 104, 101, 116, 104, 101, 114, 32, 111, 114, 32, 110, 111, 116, 32, 80, 65,
+    76, 32, 115, 104, 111, 117, 108, 100, 32, 97, 100, 100, 32, 97, 32, 112, 111, 115, 116, 97, 109, 98, 108, 101, 32,
+    116, 111, 32, 117, 110, 105, 118, 101, 114, 115, 97, 108, 32, 81, 117, 101, 117, 101, 32, 115, 117, 98, 109, 105,
+    115, 115, 105, 111, 110, 115, 32, 116, 111, 32, 100, 117, 109, 112, 32, 67, 69, 32, 82, 65, 77, 32, 119, 104, 101,
+    110, 101, 118, 101, 114, 32, 77, 67, 66, 80, 32, 105, 115, 32, 101, 110, 97, 98, 108, 101, 100, 46, 34, 44, 32, 34,
+    72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 52, 49, 51, 57, 49, 49, 55, 56, 49, 125, 44, 32, 123, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 67, 111, 109, 109, 97, 110, 100, 66, 117, 102, 102, 101, 114, 67, 111, 109, 98, 105,
+    110, 101, 68, 101, 80, 114, 101, 97, 109, 98, 108, 101, 115, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34,
+    67, 111, 109, 109, 97, 110, 100, 32, 66, 117, 102, 102, 101, 114, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34,
+    83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34,
+    84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97,
+    109, 101, 34, 58, 32, 34, 99, 111, 109, 109, 97, 110, 100, 66, 117, 102, 102, 101, 114, 67, 111, 109, 98, 105, 110,
+    101, 68, 101, 80, 114, 101, 97, 109, 98, 108, 101, 115, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 67, 111, 109, 98, 105, 110, 101, 115, 32, 116, 104, 101, 32, 68, 69, 32, 112, 101, 114,
+    45, 115, 117, 98, 109, 105, 116, 32, 97, 110, 100, 32, 112, 101, 114, 45, 99, 111, 110, 116, 101, 120, 116, 32, 112,
+    114, 101, 97, 109, 98, 108, 101, 115, 32, 105, 110, 116, 111, 32, 111, 110, 101, 32, 112, 101, 114, 45, 115, 117,
+    98, 109, 105, 116, 32, 112, 114, 101, 97, 109, 98, 108, 101, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101,
+    34, 58, 32, 49, 52, 56, 52, 49, 50, 51, 49, 49, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109,
+    100, 85, 116, 105, 108, 86, 101, 114, 105, 102, 121, 83, 104, 97, 100, 111, 119, 101, 100, 82, 101, 103, 82, 97,
+    110, 103, 101, 115, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 67, 111, 109, 109, 97, 110, 100, 32, 66,
+    117, 102, 102, 101, 114, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101,
+    102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110,
+    34, 58, 32, 123, 34, 66, 117, 105, 108, 100, 84, 121, 112, 101, 34, 58, 32, 91, 34, 100, 98, 103, 34, 44, 32, 34,
+    100, 101, 118, 34, 93, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80,
+    97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97,
+    114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 109, 100, 85, 116, 105, 108, 86, 101, 114, 105,
+    102, 121, 83, 104, 97, 100, 111, 119, 101, 100, 82, 101, 103, 82, 97, 110, 103, 101, 115, 34, 44, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 80, 65, 76, 32,
+    119, 105, 108, 108, 32, 118, 101, 114, 105, 102, 121, 32, 116, 104, 97, 116, 32, 97, 108, 108, 32, 114, 101, 103,
+    105, 115, 116, 101, 114, 32, 119, 114, 105, 116, 101, 115, 32, 105, 110, 32, 99, 111, 109, 109, 97, 110, 100, 32,
+    98, 117, 102, 102, 101, 114, 115, 32, 97, 114, 101, 32, 112, 114, 111, 112, 101, 114, 108, 121, 32, 115, 104, 97,
+    100, 111, 119, 101, 100, 32, 119, 104, 101, 110, 32, 109, 105, 100, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98,
+    117, 102, 102, 101, 114, 32, 112, 114, 101, 101, 109, 112, 116, 105, 111, 110, 32, 105, 115, 32, 101, 110, 97, 98,
+    108, 101, 100, 46, 32, 84, 104, 105, 115, 32, 99, 97, 110, 32, 104, 97, 118, 101, 32, 97, 32, 110, 111, 116, 105,
+    99, 97, 98, 108, 101, 32, 105, 109, 112, 97, 99, 116, 32, 111, 110, 32, 67, 80, 85, 32, 112, 101, 114, 102, 111,
+    114, 109, 97, 110, 99, 101, 46, 32, 84, 104, 105, 115, 32, 115, 101, 116, 116, 105, 110, 103, 32, 105, 115, 32, 105,
+    103, 110, 111, 114, 101, 100, 32, 105, 110, 32, 114, 101, 108, 101, 97, 115, 101, 32, 98, 117, 105, 108, 100, 115,
+    46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 56, 57, 48, 55, 48, 52, 48, 52, 53, 125, 44,
+    32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 86, 97, 108, 117, 101, 115, 34,
+    58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 44, 32, 34, 86, 97, 108,
+    117, 101, 34, 58, 32, 48, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 80, 65,
+    76, 32, 119, 105, 108, 108, 32, 101, 110, 97, 98, 108, 101, 32, 111, 112, 116, 105, 109, 105, 122, 97, 116, 105,
+    111, 110, 115, 32, 119, 104, 101, 110, 32, 103, 101, 110, 101, 114, 97, 108, 108, 121, 32, 101, 102, 102, 105, 99,
+    105, 101, 110, 116, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101,
+    100, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 32, 97, 108, 108, 32, 111, 112, 116, 105, 109, 105, 122,
+    97, 116, 105, 111, 110, 115, 32, 116, 104, 97, 116, 32, 99, 111, 117, 108, 100, 32, 98, 101, 32, 100, 101, 116, 114,
+    105, 109, 101, 110, 116, 97, 108, 32, 105, 110, 32, 115, 112, 101, 99, 105, 97, 108, 32, 99, 97, 115, 101, 115, 46,
+    34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 105, 110, 75, 101, 114, 110, 101, 108, 83, 117, 98,
+    109, 105, 116, 115, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 105, 110, 105, 109, 105, 122, 101, 32, 116, 104, 101, 32, 111, 118,
+    101, 114, 104, 101, 97, 100, 32, 111, 102, 32, 108, 97, 117, 110, 99, 104, 105, 110, 103, 32, 99, 111, 109, 109, 97,
+    110, 100, 32, 98, 117, 102, 102, 101, 114, 115, 32, 111, 110, 32, 116, 104, 101, 32, 67, 80, 85, 32, 97, 110, 100,
+    32, 71, 80, 85, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 105, 110, 71, 112, 117, 67, 109,
+    100, 79, 118, 101, 114, 104, 101, 97, 100, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 51, 44, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 105, 110, 105, 109, 105, 122, 101, 32, 116,
+    104, 101, 32, 111, 118, 101, 114, 104, 101, 97, 100, 32, 111, 102, 32, 114, 101, 97, 100, 105, 110, 103, 32, 99,
+    111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 32, 99, 111, 109, 109, 97, 110, 100, 115, 32, 111,
+    110, 32, 116, 104, 101, 32, 71, 80, 85, 46, 34, 125, 93, 125, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 117,
+    98, 109, 105, 116, 79, 112, 116, 77, 111, 100, 101, 79, 118, 101, 114, 114, 105, 100, 101, 34, 44, 32, 34, 84, 97,
+    103, 115, 34, 58, 32, 91, 34, 67, 111, 109, 109, 97, 110, 100, 32, 66, 117, 102, 102, 101, 114, 34, 93, 44, 32, 34,
+    68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44,
+    32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44,
+    32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98,
+    108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 115, 117, 98, 109, 105, 116, 79, 112, 116, 77, 111, 100, 101, 79, 118,
+    101, 114, 114, 105, 100, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    73, 102, 32, 110, 111, 110, 45, 122, 101, 114, 111, 44, 32, 105, 116, 32, 102, 111, 114, 99, 101, 115, 32, 97, 108,
+    108, 32, 83, 117, 98, 109, 105, 116, 79, 112, 116, 77, 111, 100, 101, 115, 32, 116, 111, 32, 97, 32, 115, 112, 101,
+    99, 105, 102, 105, 99, 32, 118, 97, 108, 117, 101, 46, 32, 48, 58, 32, 78, 111, 32, 79, 118, 101, 114, 114, 105,
+    100, 101, 32, 49, 58, 32, 83, 117, 98, 109, 105, 116, 79, 112, 116, 77, 111, 100, 101, 58, 58, 68, 101, 102, 97,
+    117, 108, 116, 32, 50, 58, 32, 83, 117, 98, 109, 105, 116, 79, 112, 116, 77, 111, 100, 101, 58, 58, 68, 105, 115,
+    97, 98, 108, 101, 100, 32, 51, 58, 32, 83, 117, 98, 109, 105, 116, 79, 112, 116, 77, 111, 100, 101, 58, 58, 77, 105,
+    110, 75, 101, 114, 110, 101, 108, 83, 117, 98, 109, 105, 116, 115, 32, 52, 58, 32, 83, 117, 98, 109, 105, 116, 79,
+    112, 116, 77, 111, 100, 101, 58, 58, 77, 105, 110, 71, 112, 117, 67, 109, 100, 79, 118, 101, 114, 104, 101, 97, 100,
+    32, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 48, 53, 52, 56, 49, 48, 54, 48, 57, 125, 44,
+    32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 73, 115, 69, 110, 117, 109, 34,
+    58, 32, 116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 84, 105, 108, 101, 83, 119, 105, 122, 122, 108, 101, 78, 111, 110, 101, 34, 44, 32, 34, 86, 97, 108,
+    117, 101, 34, 58, 32, 48, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105,
+    115, 97, 98, 108, 101, 32, 116, 105, 108, 101, 32, 115, 119, 105, 122, 122, 108, 101, 32, 102, 111, 114, 32, 97,
+    108, 108, 32, 115, 117, 114, 102, 97, 99, 101, 115, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    84, 105, 108, 101, 83, 119, 105, 122, 122, 108, 101, 67, 111, 108, 111, 114, 34, 44, 32, 34, 86, 97, 108, 117, 101,
+    34, 58, 32, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98,
+    108, 101, 32, 116, 105, 108, 101, 32, 115, 119, 105, 122, 122, 108, 101, 32, 102, 111, 114, 32, 114, 101, 110, 100,
+    101, 114, 97, 98, 108, 101, 32, 99, 111, 108, 111, 114, 32, 116, 97, 114, 103, 101, 116, 115, 46, 34, 125, 44, 32,
+    123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 105, 108, 101, 83, 119, 105, 122, 122, 108, 101, 68, 101, 112, 116,
+    104, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 32, 116, 105, 108, 101, 32, 115, 119, 105, 122, 122, 108, 101,
+    32, 102, 111, 114, 32, 114, 101, 110, 100, 101, 114, 97, 98, 108, 101, 32, 100, 101, 112, 116, 104, 45, 115, 116,
+    101, 110, 99, 105, 108, 32, 116, 97, 114, 103, 101, 116, 115, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 84, 105, 108, 101, 83, 119, 105, 122, 122, 108, 101, 83, 104, 97, 100, 101, 114, 82, 101, 115, 34, 44,
+    32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 69, 110, 97, 98, 108, 101, 32, 116, 105, 108, 101, 32, 115, 119, 105, 122, 122, 108, 101, 32, 102, 111,
+    114, 32, 115, 104, 97, 100, 101, 114, 32, 114, 101, 115, 111, 117, 114, 99, 101, 115, 46, 34, 125, 44, 32, 123, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 84, 105, 108, 101, 83, 119, 105, 122, 122, 108, 101, 65, 108, 108, 66, 105, 116,
+    115, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 55, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 32, 116, 105, 108, 101, 32, 115, 119, 105, 122, 122, 108, 101,
+    32, 102, 111, 114, 32, 97, 108, 108, 32, 115, 117, 114, 102, 97, 99, 101, 115, 46, 34, 125, 93, 44, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 84, 105, 108, 101, 83, 119, 105, 122, 122, 108, 101, 66, 105, 116, 115, 34, 125, 44, 32,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 105, 108, 101, 83, 119, 105, 122, 122, 108, 101, 77, 111, 100, 101, 34,
+    44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 82, 101, 115, 111, 117, 114, 99, 101, 32, 83, 101, 116, 116, 105,
+    110, 103, 115, 34, 93, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34, 58, 32,
+    116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 55, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116,
+    101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34,
+    44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 116, 105, 108, 101, 83, 119, 105,
+    122, 122, 108, 101, 77, 111, 100, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 66, 105, 116, 109, 97, 115, 107, 32, 119, 104, 105, 99, 104, 32, 101, 110, 97, 98, 108, 101, 115, 32, 98,
+    97, 110, 107, 32, 38, 32, 112, 105, 112, 101, 32, 116, 105, 108, 101, 32, 115, 119, 105, 122, 122, 108, 105, 110,
+    103, 32, 102, 111, 114, 32, 115, 117, 114, 102, 97, 99, 101, 115, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 49, 49, 52, 54, 56, 55, 55, 48, 49, 48, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 69,
+    110, 97, 98, 108, 101, 86, 105, 100, 77, 109, 71, 112, 117, 86, 97, 77, 97, 112, 112, 105, 110, 103, 86, 97, 108,
+    105, 100, 97, 116, 105, 111, 110, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 82, 101, 115, 111, 117, 114,
+    99, 101, 32, 83, 101, 116, 116, 105, 110, 103, 115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34,
+    58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 68, 101, 112,
+    101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 34, 79, 83, 34, 58, 32, 91, 34, 87, 105, 110, 56, 34, 44, 32, 34, 87,
+    105, 110, 49, 48, 34, 93, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101,
+    80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86,
+    97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 101, 110, 97, 98, 108, 101, 86, 105, 100, 77, 109,
+    71, 112, 117, 86, 97, 77, 97, 112, 112, 105, 110, 103, 86, 97, 108, 105, 100, 97, 116, 105, 111, 110, 34, 44, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 79, 110, 32, 87, 68, 68, 77, 50, 32, 112,
+    108, 97, 116, 102, 111, 114, 109, 115, 44, 32, 80, 65, 76, 32, 105, 115, 32, 97, 98, 108, 101, 32, 116, 111, 32,
+    115, 101, 110, 100, 32, 97, 32, 115, 101, 116, 32, 111, 102, 32, 102, 108, 97, 103, 115, 32, 116, 104, 114, 111,
+    117, 103, 104, 32, 116, 111, 32, 116, 104, 101, 32, 107, 101, 114, 110, 101, 108, 32, 119, 104, 105, 99, 104, 32,
+    99, 97, 110, 32, 99, 111, 110, 116, 114, 111, 108, 32, 104, 111, 119, 32, 116, 104, 101, 32, 75, 77, 68, 32, 104,
+    97, 110, 100, 108, 101, 115, 32, 101, 97, 99, 104, 32, 71, 80, 85, 32, 86, 65, 32, 109, 97, 112, 112, 105, 110, 103,
+    32, 119, 104, 101, 110, 32, 114, 101, 115, 101, 114, 118, 105, 110, 103, 32, 86, 65, 32, 115, 112, 97, 99, 101, 44,
+    32, 109, 97, 112, 112, 105, 110, 103, 32, 86, 65, 32, 115, 112, 97, 99, 101, 32, 111, 114, 32, 117, 112, 100, 97,
+    116, 105, 110, 103, 32, 116, 104, 101, 32, 71, 80, 85, 32, 112, 97, 103, 101, 32, 109, 97, 112, 112, 105, 110, 103,
+    115, 46, 32, 73, 102, 32, 116, 104, 105, 115, 32, 115, 101, 116, 116, 105, 110, 103, 32, 105, 115, 32, 116, 114,
+    117, 101, 32, 116, 104, 101, 110, 32, 80, 65, 76, 32, 119, 105, 108, 108, 32, 114, 101, 113, 117, 101, 115, 116, 32,
+    116, 104, 97, 116, 32, 101, 120, 116, 114, 97, 32, 118, 97, 108, 105, 100, 97, 116, 105, 111, 110, 32, 105, 115, 32,
+    112, 101, 114, 102, 111, 114, 109, 101, 100, 32, 116, 111, 32, 101, 110, 115, 117, 114, 101, 32, 116, 104, 97, 116,
+    32, 101, 118, 101, 114, 121, 32, 71, 80, 85, 32, 118, 105, 114, 116, 117, 97, 108, 32, 97, 100, 100, 114, 101, 115,
+    115, 32, 109, 97, 112, 112, 105, 110, 103, 32, 116, 111, 32, 97, 32, 115, 112, 101, 99, 105, 102, 105, 99, 32, 112,
+    104, 121, 115, 105, 99, 97, 108, 32, 97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 32, 115, 112, 101, 99, 105, 102,
+    105, 101, 115, 32, 97, 32, 109, 97, 116, 99, 104, 105, 110, 103, 32, 115, 101, 116, 32, 111, 102, 32, 116, 104, 101,
+    115, 101, 32, 75, 77, 68, 32, 102, 108, 97, 103, 115, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34,
+    58, 32, 50, 55, 53, 49, 55, 56, 53, 48, 53, 49, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 69, 110, 97,
+    98, 108, 101, 85, 115, 119, 99, 72, 101, 97, 112, 65, 108, 108, 65, 108, 108, 111, 99, 97, 116, 105, 111, 110, 115,
+    34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 82, 101, 115, 111, 117, 114, 99, 101, 32, 83, 101, 116, 116,
+    105, 110, 103, 115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34,
+    58, 32, 123, 34, 79, 83, 34, 58, 32, 91, 34, 87, 105, 110, 49, 48, 34, 93, 125, 44, 32, 34, 83, 99, 111, 112, 101,
+    34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34,
+    58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    101, 110, 97, 98, 108, 101, 85, 115, 119, 99, 72, 101, 97, 112, 65, 108, 108, 65, 108, 108, 111, 99, 97, 116, 105,
+    111, 110, 115, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32,
+    116, 114, 117, 101, 44, 32, 116, 104, 101, 110, 32, 116, 104, 105, 115, 32, 99, 104, 97, 110, 103, 101, 32, 99, 97,
+    117, 115, 101, 115, 32, 80, 65, 76, 32, 116, 111, 32, 97, 117, 116, 111, 109, 97, 116, 105, 99, 97, 108, 108, 121,
+    32, 99, 111, 110, 115, 105, 100, 101, 114, 32, 71, 65, 82, 84, 32, 116, 111, 32, 98, 101, 32, 97, 32, 118, 97, 108,
+    105, 100, 32, 104, 101, 97, 112, 32, 102, 111, 114, 32, 109, 97, 110, 121, 32, 97, 108, 108, 111, 99, 97, 116, 105,
+    111, 110, 115, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 52, 48, 56, 51, 51, 51, 49,
+    54, 52, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 73, 115, 69,
+    110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 65, 100, 100, 114, 50, 80, 114, 101, 102, 101, 114, 114, 101, 100, 78, 111, 110, 101,
+    34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 65, 100, 100, 114, 108, 105, 98, 32, 115, 101, 108, 101, 99, 116, 115, 32, 105, 116, 115, 32,
+    111, 119, 110, 32, 100, 101, 102, 97, 117, 108, 116, 32, 115, 119, 105, 122, 122, 108, 101, 32, 115, 101, 116, 44,
+    32, 116, 104, 105, 115, 32, 100, 105, 115, 97, 98, 108, 101, 115, 32, 80, 65, 76, 39, 115, 32, 112, 101, 114, 102,
+    32, 116, 117, 110, 105, 110, 103, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 100, 100, 114,
+    50, 80, 114, 101, 102, 101, 114, 114, 101, 100, 83, 87, 95, 90, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32,
+    49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 80, 114, 101, 102, 101, 114,
+    32, 90, 79, 114, 100, 101, 114, 32, 115, 119, 105, 122, 122, 108, 101, 32, 40, 65, 68, 68, 82, 95, 83, 87, 95, 90,
+    41, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 100, 100, 114, 50, 80, 114, 101, 102, 101,
+    114, 114, 101, 100, 83, 87, 95, 83, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 32, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 80, 114, 101, 102, 101, 114, 32, 83, 116, 97, 110, 100, 97,
+    114, 100, 32, 115, 119, 105, 122, 122, 108, 101, 32, 40, 65, 68, 68, 82, 95, 83, 87, 95, 83, 41, 46, 34, 125, 44,
+    32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 100, 100, 114, 50, 80, 114, 101, 102, 101, 114, 114, 101, 100,
+    83, 87, 95, 68, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 80, 114, 101, 102, 101, 114, 32, 68, 105, 115, 112, 108, 97, 121, 32, 115, 119,
+    105, 122, 122, 108, 101, 32, 40, 65, 68, 68, 82, 95, 83, 87, 95, 68, 41, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 65, 100, 100, 114, 50, 80, 114, 101, 102, 101, 114, 114, 101, 100, 83, 87, 95, 82, 34, 44, 32,
+    34, 86, 97, 108, 117, 101, 34, 58, 32, 56, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 80, 114, 101, 102, 101, 114, 32, 82, 111, 116, 97, 116, 101, 100, 32, 115, 119, 105, 122, 122, 108, 101, 32,
+    40, 65, 68, 68, 82, 95, 83, 87, 95, 82, 41, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 100,
+    100, 114, 50, 80, 114, 101, 102, 101, 114, 114, 101, 100, 68, 101, 102, 97, 117, 108, 116, 34, 44, 32, 34, 86, 97,
+    108, 117, 101, 34, 58, 32, 49, 53, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    80, 114, 101, 102, 101, 114, 32, 97, 108, 108, 32, 115, 119, 105, 122, 122, 108, 101, 32, 109, 111, 100, 101, 115,
+    44, 32, 80, 65, 76, 32, 119, 105, 108, 108, 32, 115, 101, 108, 101, 99, 116, 105, 118, 101, 108, 121, 32, 100, 105,
+    115, 97, 98, 108, 101, 32, 115, 111, 109, 101, 32, 109, 111, 100, 101, 115, 32, 102, 111, 114, 32, 112, 101, 114,
+    102, 111, 114, 109, 97, 110, 99, 101, 46, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 100, 100,
+    114, 50, 80, 114, 101, 102, 101, 114, 114, 101, 100, 83, 119, 105, 122, 122, 108, 101, 84, 121, 112, 101, 83, 101,
+    116, 34, 125, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 100, 100, 114, 50, 80, 114, 101, 102, 101, 114, 114,
+    101, 100, 83, 119, 105, 122, 122, 108, 101, 84, 121, 112, 101, 83, 101, 116, 34, 44, 32, 34, 84, 97, 103, 115, 34,
+    58, 32, 91, 34, 82, 101, 115, 111, 117, 114, 99, 101, 32, 83, 101, 116, 116, 105, 110, 103, 115, 34, 93, 44, 32, 34,
+    70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 73,
+    115, 66, 105, 116, 109, 97, 115, 107, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 65, 100, 100, 114, 50, 80, 114, 101,
+    102, 101, 114, 114, 101, 100, 68, 101, 102, 97, 117, 108, 116, 34, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58,
+    32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32,
+    34, 101, 110, 117, 109, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 97,
+    100, 100, 114, 50, 80, 114, 101, 102, 101, 114, 114, 101, 100, 83, 119, 105, 122, 122, 108, 101, 84, 121, 112, 101,
+    83, 101, 116, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 80, 65, 76, 39,
+    115, 32, 100, 101, 102, 97, 117, 108, 116, 32, 115, 119, 105, 122, 122, 108, 101, 32, 116, 121, 112, 101, 32, 115,
+    101, 116, 32, 119, 104, 101, 110, 32, 117, 115, 105, 110, 103, 32, 65, 100, 100, 114, 76, 105, 98, 50, 46, 34, 44,
+    32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 56, 51, 54, 53, 53, 55, 49, 54, 55, 125, 44, 32, 123,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 105, 112, 101, 108, 105, 110, 101, 80, 114, 101, 102, 101, 116, 99, 104,
+    69, 110, 97, 98, 108, 101, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 114, 101, 102, 101, 116, 99,
+    104, 105, 110, 103, 32, 40, 76, 50, 32, 67, 97, 99, 104, 101, 32, 87, 97, 114, 109, 105, 110, 103, 41, 34, 93, 44,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116,
+    114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108,
+    75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114,
+    105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 112, 105, 112, 101, 108, 105, 110, 101, 80, 114, 101, 102,
+    101, 116, 99, 104, 69, 110, 97, 98, 108, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 97, 116, 116, 101, 109, 112, 116, 32, 116, 111, 32, 112,
+    114, 101, 102, 101, 116, 99, 104, 32, 112, 105, 112, 101, 108, 105, 110, 101, 32, 115, 104, 97, 100, 101, 114, 32,
+    99, 111, 100, 101, 32, 97, 110, 100, 32, 100, 97, 116, 97, 32, 105, 110, 116, 111, 32, 76, 50, 32, 98, 101, 102,
+    111, 114, 101, 32, 101, 120, 101, 99, 117, 116, 105, 110, 103, 32, 116, 104, 101, 32, 112, 105, 112, 101, 108, 105,
+    110, 101, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 56, 48, 48, 57, 56, 53, 57, 50,
+    51, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 104, 97, 100, 101, 114, 80, 114, 101, 102, 101, 116,
+    99, 104, 67, 108, 97, 109, 112, 83, 105, 122, 101, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 114,
+    101, 102, 101, 116, 99, 104, 105, 110, 103, 32, 40, 76, 50, 32, 67, 97, 99, 104, 101, 32, 87, 97, 114, 109, 105,
+    110, 103, 41, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117,
+    108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101,
+    80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44,
+    32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 115, 104, 97, 100, 101, 114, 80, 114,
+    101, 102, 101, 116, 99, 104, 67, 108, 97, 109, 112, 83, 105, 122, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 87, 104, 101, 110, 32, 116, 104, 105, 115, 32, 115, 101, 116, 116, 105,
+    110, 103, 32, 105, 115, 32, 110, 111, 110, 45, 122, 101, 114, 111, 44, 32, 99, 108, 97, 109, 112, 32, 115, 104, 97,
+    100, 101, 114, 32, 112, 114, 101, 102, 101, 116, 99, 104, 105, 110, 103, 32, 116, 111, 32, 116, 104, 105, 115, 32,
+    109, 97, 110, 121, 32, 98, 121, 116, 101, 115, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32,
+    50, 52, 48, 54, 50, 57, 48, 48, 51, 57, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 97, 120, 65,
+    118, 97, 105, 108, 97, 98, 108, 101, 83, 103, 112, 114, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 83,
+    104, 97, 100, 101, 114, 32, 79, 112, 116, 105, 111, 110, 115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 83, 99, 111, 112, 101,
+    34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34,
+    58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 109, 97, 120, 65, 118, 97, 105, 108, 97, 98, 108, 101, 83, 103, 112, 114, 34, 44, 32, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 65, 114, 116, 105, 102, 105, 99, 105, 97, 108, 108, 121, 32,
+    108, 105, 109, 105, 116, 115, 32, 116, 104, 101, 32, 109, 97, 120, 105, 109, 117, 109, 32, 110, 117, 109, 98, 101,
+    114, 32, 111, 102, 32, 83, 71, 80, 82, 115, 32, 97, 118, 97, 105, 108, 97, 98, 108, 101, 32, 102, 111, 114, 32, 115,
+    104, 97, 100, 101, 114, 32, 99, 111, 109, 112, 105, 108, 97, 116, 105, 111, 110, 46, 32, 65, 32, 118, 97, 108, 117,
+    101, 32, 111, 102, 32, 122, 101, 114, 111, 32, 100, 105, 115, 97, 98, 108, 101, 115, 32, 116, 104, 101, 32, 108,
+    105, 109, 105, 116, 32, 97, 110, 100, 32, 72, 87, 32, 100, 101, 102, 97, 117, 108, 116, 115, 32, 97, 114, 101, 32,
+    117, 115, 101, 100, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 48, 48, 56, 52, 51, 57,
+    55, 55, 54, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 97, 120, 65, 118, 97, 105, 108, 97, 98, 108,
+    101, 86, 103, 112, 114, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 83, 104, 97, 100, 101, 114, 32, 79,
+    112, 116, 105, 111, 110, 115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105,
+    118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116,
+    51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 109, 97, 120, 65, 118,
+    97, 105, 108, 97, 98, 108, 101, 86, 103, 112, 114, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 65, 114, 116, 105, 102, 105, 99, 105, 97, 108, 108, 121, 32, 108, 105, 109, 105, 116, 115, 32,
+    116, 104, 101, 32, 109, 97, 120, 105, 109, 117, 109, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 86, 71, 80,
+    82, 115, 32, 97, 118, 97, 105, 108, 97, 98, 108, 101, 32, 102, 111, 114, 32, 115, 104, 97, 100, 101, 114, 32, 99,
+    111, 109, 112, 105, 108, 97, 116, 105, 111, 110, 46, 32, 65, 32, 118, 97, 108, 117, 101, 32, 111, 102, 32, 122, 101,
+    114, 111, 32, 100, 105, 115, 97, 98, 108, 101, 115, 32, 116, 104, 101, 32, 108, 105, 109, 105, 116, 32, 97, 110,
+    100, 32, 72, 87, 32, 100, 101, 102, 97, 117, 108, 116, 115, 32, 97, 114, 101, 32, 117, 115, 101, 100, 46, 34, 44,
+    32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 49, 49, 54, 53, 52, 54, 51, 48, 53, 125, 44, 32, 123,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 97, 120, 84, 104, 114, 101, 97, 100, 71, 114, 111, 117, 112, 115, 80, 101,
+    114, 67, 111, 109, 112, 117, 116, 101, 85, 110, 105, 116, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 83,
+    104, 97, 100, 101, 114, 32, 79, 112, 116, 105, 111, 110, 115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 83, 99, 111, 112, 101,
+    34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34,
+    58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 109, 97, 120, 84, 104, 114, 101, 97, 100, 71, 114, 111, 117, 112, 115, 80, 101, 114, 67, 111, 109, 112,
+    117, 116, 101, 85, 110, 105, 116, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 104, 111, 119, 32, 109, 97, 110, 121, 32, 67, 83, 32, 116, 104, 114,
+    101, 97, 100, 45, 103, 114, 111, 117, 112, 115, 32, 97, 114, 101, 32, 97, 108, 108, 111, 119, 101, 100, 32, 116,
+    111, 32, 108, 97, 117, 110, 99, 104, 32, 112, 101, 114, 32, 99, 111, 109, 112, 117, 116, 101, 32, 117, 110, 105,
+    116, 46, 32, 32, 84, 104, 105, 115, 32, 116, 104, 114, 111, 116, 116, 108, 101, 115, 32, 116, 104, 101, 32, 115,
+    104, 97, 100, 101, 114, 44, 32, 119, 104, 105, 99, 104, 32, 99, 97, 110, 32, 115, 111, 109, 101, 116, 105, 109, 101,
+    115, 32, 101, 110, 97, 98, 108, 101, 32, 109, 111, 114, 101, 32, 103, 114, 97, 112, 104, 105, 99, 115, 32, 115, 104,
+    97, 100, 101, 114, 32, 119, 111, 114, 107, 32, 116, 111, 32, 99, 111, 109, 112, 108, 101, 116, 101, 32, 105, 110,
+    32, 112, 97, 114, 97, 108, 108, 101, 108, 46, 32, 65, 32, 118, 97, 108, 117, 101, 32, 111, 102, 32, 122, 101, 114,
+    111, 32, 100, 105, 115, 97, 98, 108, 101, 115, 32, 108, 105, 109, 105, 116, 105, 110, 103, 32, 116, 104, 101, 32,
+    110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 116, 104, 114, 101, 97, 100, 45, 103, 114, 111, 117, 112, 115, 32,
+    116, 111, 32, 108, 97, 117, 110, 99, 104, 46, 32, 32, 84, 104, 105, 115, 32, 102, 105, 101, 108, 100, 32, 105, 115,
+    32, 32, 105, 103, 110, 111, 114, 101, 100, 32, 102, 111, 114, 32, 103, 114, 97, 112, 104, 105, 99, 115, 32, 115,
+    104, 97, 100, 101, 114, 115, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 50, 56, 52, 53,
+    49, 55, 57, 57, 57, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 97, 120, 83, 99, 114, 97, 116, 99,
+    104, 82, 105, 110, 103, 83, 105, 122, 101, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 83, 99, 114, 97,
+    116, 99, 104, 34, 44, 32, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 93, 44, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 50, 54, 56, 52, 51, 53,
+    52, 53, 54, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108,
+    75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 103, 112, 117, 115, 105, 122, 101, 34, 44, 32, 34,
+    86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 109, 97, 120, 83, 99, 114, 97, 116, 99, 104,
+    82, 105, 110, 103, 83, 105, 122, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 116, 104, 101, 32, 109, 97, 120, 105, 109, 117, 109, 32, 115,
+    105, 122, 101, 32, 111, 102, 32, 116, 104, 101, 32, 115, 99, 114, 97, 116, 99, 104, 32, 114, 105, 110, 103, 32, 97,
+    108, 108, 111, 99, 97, 116, 105, 111, 110, 46, 32, 73, 102, 32, 116, 104, 101, 32, 97, 112, 112, 108, 105, 99, 97,
+    116, 105, 111, 110, 32, 114, 101, 113, 117, 101, 115, 116, 115, 32, 109, 111, 114, 101, 32, 115, 99, 114, 97, 116,
+    99, 104, 32, 109, 101, 109, 111, 114, 121, 32, 116, 104, 97, 110, 32, 116, 104, 105, 115, 44, 32, 116, 104, 101, 32,
+    100, 114, 105, 118, 101, 114, 32, 119, 105, 108, 108, 32, 108, 105, 109, 105, 116, 32, 116, 104, 101, 32, 110, 117,
+    109, 98, 101, 114, 32, 111, 102, 32, 119, 97, 118, 101, 115, 32, 105, 110, 32, 102, 108, 105, 103, 104, 116, 32,
+    116, 111, 32, 99, 111, 109, 112, 108, 121, 32, 119, 105, 116, 104, 32, 116, 104, 101, 32, 109, 101, 109, 111, 114,
+    121, 32, 114, 101, 115, 116, 114, 105, 99, 116, 105, 111, 110, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 55, 56, 52, 53, 50, 56, 55, 53, 56, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 73,
+    102, 104, 71, 112, 117, 77, 97, 115, 107, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 77, 71, 80, 85, 34,
+    44, 32, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34, 68, 101, 98, 117, 103, 34, 93, 44, 32, 34, 70, 108, 97,
+    103, 115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 53, 125, 44, 32, 34,
+    68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32,
+    91, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 48, 93, 44, 32, 34, 76, 111, 103, 105, 99, 79, 112, 34, 58,
+    32, 34, 71, 114, 101, 97, 116, 101, 114, 84, 104, 97, 110, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 73,
+    102, 104, 77, 111, 100, 101, 34, 125, 93, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118,
+    97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51,
+    50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 105, 102, 104, 71, 112,
+    117, 77, 97, 115, 107, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97,
+    115, 107, 32, 111, 102, 32, 116, 104, 101, 32, 71, 80, 85, 115, 32, 116, 111, 32, 104, 97, 118, 101, 32, 97, 108,
+    108, 32, 115, 117, 98, 109, 105, 116, 115, 32, 100, 114, 111, 112, 112, 101, 100, 46, 32, 83, 101, 101, 32, 73, 70,
+    72, 32, 115, 101, 116, 116, 105, 110, 103, 32, 102, 111, 114, 32, 73, 70, 72, 32, 109, 111, 100, 101, 32, 116, 104,
+    97, 116, 32, 119, 105, 108, 108, 32, 98, 101, 32, 97, 112, 112, 108, 105, 101, 100, 46, 32, 73, 102, 32, 116, 104,
+    101, 32, 98, 105, 116, 32, 105, 115, 32, 115, 101, 116, 44, 32, 116, 104, 101, 32, 71, 80, 85, 32, 119, 105, 108,
+    108, 32, 104, 97, 118, 101, 32, 105, 116, 115, 32, 115, 117, 98, 109, 105, 116, 115, 32, 100, 114, 111, 112, 112,
+    101, 100, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 53, 49, 55, 54, 50, 54, 54, 54,
+    52, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 72, 119, 67, 111, 109, 112, 111, 115, 105, 116, 105,
+    110, 103, 69, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 77, 71, 80, 85, 34,
+    93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58,
+    32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80,
+    97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97,
+    114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 104, 119, 67, 111, 109, 112, 111, 115, 105, 116, 105,
+    110, 103, 69, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 69, 110, 97, 98, 108, 101, 115, 32, 115, 117, 112, 112, 111, 114, 116, 32, 102, 111, 114, 32, 116, 104,
+    101, 32, 72, 87, 32, 99, 111, 109, 112, 111, 115, 105, 116, 111, 114, 32, 40, 99, 114, 111, 115, 115, 68, 105, 115,
+    112, 108, 97, 121, 80, 114, 101, 115, 101, 110, 116, 41, 32, 105, 102, 32, 116, 104, 101, 32, 104, 97, 114, 100,
+    119, 97, 114, 101, 32, 115, 117, 112, 112, 111, 114, 116, 115, 32, 72, 87, 32, 99, 111, 109, 112, 111, 115, 105,
+    116, 105, 110, 103, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 56, 55, 50, 49, 54, 57,
+    55, 49, 55, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 103, 112, 117, 67, 111, 109, 112, 97, 116,
+    105, 98, 105, 108, 105, 116, 121, 69, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91,
+    34, 77, 71, 80, 85, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105,
+    118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108,
+    34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 109, 103, 112, 117, 67, 111,
+    109, 112, 97, 116, 105, 98, 105, 108, 105, 116, 121, 69, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 115, 32, 115, 117, 112, 112, 111,
+    114, 116, 32, 102, 111, 114, 32, 77, 71, 80, 85, 32, 105, 110, 32, 80, 65, 76, 46, 32, 73, 102, 32, 77, 71, 80, 85,
+    32, 67, 111, 109, 112, 97, 116, 105, 98, 105, 108, 105, 116, 121, 32, 105, 115, 32, 100, 105, 115, 97, 98, 108, 101,
+    100, 44, 32, 97, 108, 108, 32, 71, 80, 85, 115, 32, 119, 105, 108, 108, 32, 115, 116, 105, 108, 108, 32, 98, 101,
+    32, 101, 120, 112, 111, 115, 101, 100, 32, 116, 111, 32, 116, 104, 101, 32, 97, 112, 112, 108, 105, 99, 97, 116,
+    105, 111, 110, 44, 32, 98, 117, 116, 32, 110, 111, 32, 77, 71, 80, 85, 45, 115, 112, 101, 99, 105, 102, 105, 99, 32,
+    99, 111, 109, 112, 97, 116, 105, 98, 105, 108, 105, 116, 121, 32, 102, 108, 97, 103, 115, 32, 119, 105, 108, 108,
+    32, 98, 101, 32, 114, 101, 116, 117, 114, 110, 101, 100, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34,
+    58, 32, 49, 49, 55, 55, 57, 51, 55, 50, 57, 57, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 101,
+    101, 114, 77, 101, 109, 111, 114, 121, 69, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32,
+    91, 34, 77, 71, 80, 85, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102,
+    97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114,
+    105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111,
+    108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 112, 101, 101, 114, 77,
+    101, 109, 111, 114, 121, 69, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 115, 32, 115, 117, 112, 112, 111, 114, 116, 32, 102, 111, 114,
+    32, 112, 101, 101, 114, 32, 109, 101, 109, 111, 114, 121, 32, 97, 110, 100, 32, 112, 101, 101, 114, 32, 109, 101,
+    109, 111, 114, 121, 32, 116, 114, 97, 110, 115, 102, 101, 114, 115, 32, 105, 102, 32, 116, 104, 101, 32, 104, 97,
+    114, 100, 119, 97, 114, 101, 32, 105, 115, 32, 99, 97, 112, 97, 98, 108, 101, 46, 34, 44, 32, 34, 72, 97, 115, 104,
+    78, 97, 109, 101, 34, 58, 32, 50, 53, 57, 51, 54, 50, 53, 49, 49, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 70, 111, 114, 99, 101, 80, 114, 101, 115, 101, 110, 116, 86, 105, 97, 71, 100, 105, 34, 44, 32, 34, 84, 97,
+    103, 115, 34, 58, 32, 91, 34, 87, 83, 73, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123,
+    34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 68, 101, 112, 101, 110,
+    100, 115, 79, 110, 34, 58, 32, 123, 34, 79, 83, 34, 58, 32, 91, 34, 87, 105, 110, 100, 111, 119, 115, 34, 93, 125,
+    44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34,
+    44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 102, 111, 114, 99, 101, 80, 114, 101, 115, 101, 110, 116, 86, 105, 97, 71,
+    100, 105, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 111, 114, 99,
+    101, 115, 32, 116, 104, 101, 32, 112, 114, 101, 115, 101, 110, 116, 32, 116, 101, 99, 104, 110, 105, 113, 117, 101,
+    32, 116, 111, 32, 117, 115, 101, 32, 116, 104, 101, 32, 71, 68, 73, 32, 66, 76, 84, 32, 112, 97, 116, 104, 46, 34,
+    44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 54, 48, 55, 56, 55, 49, 54, 53, 51, 125, 44, 32,
+    123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 114, 101, 115, 101, 110, 116, 86, 105, 97, 79, 103, 108, 82, 117,
+    110, 116, 105, 109, 101, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 87, 83, 73, 34, 93, 44, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117,
+    101, 125, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 34, 79, 83, 34, 58, 32, 91, 34,
+    87, 105, 110, 100, 111, 119, 115, 34, 93, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118,
+    97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34,
+    44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 112, 114, 101, 115, 101, 110, 116,
+    86, 105, 97, 79, 103, 108, 82, 117, 110, 116, 105, 109, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 87, 104, 101, 110, 32, 116, 114, 117, 101, 32, 119, 105, 110, 100, 111, 119, 32, 109,
+    111, 100, 101, 32, 112, 114, 101, 115, 101, 110, 116, 32, 112, 97, 116, 104, 32, 119, 105, 108, 108, 32, 103, 111,
+    32, 116, 104, 114, 111, 117, 103, 104, 32, 79, 112, 101, 110, 71, 76, 32, 114, 117, 110, 116, 105, 109, 101, 46, 32,
+    87, 104, 101, 110, 32, 102, 97, 108, 115, 101, 32, 119, 105, 110, 100, 111, 119, 32, 109, 111, 100, 101, 32, 112,
+    114, 101, 115, 101, 110, 116, 32, 112, 97, 116, 104, 32, 115, 116, 105, 108, 108, 32, 103, 111, 32, 108, 101, 103,
+    97, 99, 121, 32, 68, 87, 77, 32, 65, 80, 73, 32, 112, 97, 116, 104, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 50, 52, 54, 54, 51, 54, 51, 55, 55, 48, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 68, 101, 98, 117, 103, 70, 111, 114, 99, 101, 82, 101, 115, 111, 117, 114, 99, 101, 65, 108, 105, 103, 110, 109,
+    101, 110, 116, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 68, 101, 98, 117, 103, 34, 44, 32, 34, 82, 101,
+    115, 111, 117, 114, 99, 101, 32, 83, 101, 116, 116, 105, 110, 103, 115, 34, 44, 32, 34, 66, 114, 105, 110, 103, 117,
+    112, 34, 44, 32, 34, 69, 109, 117, 108, 97, 116, 105, 111, 110, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 83, 99, 111, 112, 101,
+    34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34,
+    58, 32, 34, 103, 112, 117, 115, 105, 122, 101, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101,
+    34, 58, 32, 34, 100, 101, 98, 117, 103, 70, 111, 114, 99, 101, 83, 117, 114, 102, 97, 99, 101, 65, 108, 105, 103,
+    110, 109, 101, 110, 116, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 65,
+    108, 105, 103, 110, 32, 97, 108, 108, 32, 114, 101, 115, 111, 117, 114, 99, 101, 115, 32, 116, 111, 32, 116, 104,
+    101, 32, 109, 97, 120, 40, 111, 114, 105, 103, 105, 110, 97, 108, 65, 108, 105, 103, 110, 109, 101, 110, 116, 44,
+    32, 115, 112, 101, 99, 105, 102, 105, 101, 100, 65, 108, 105, 103, 110, 109, 101, 110, 116, 41, 46, 32, 84, 104,
+    105, 115, 32, 115, 101, 116, 116, 105, 110, 103, 32, 105, 115, 32, 105, 110, 32, 117, 110, 105, 116, 115, 32, 111,
+    102, 32, 98, 121, 116, 101, 115, 46, 32, 84, 104, 105, 115, 32, 105, 115, 32, 97, 32, 100, 101, 98, 117, 103, 32,
+    115, 101, 116, 116, 105, 110, 103, 32, 97, 110, 100, 32, 115, 116, 114, 97, 110, 103, 101, 32, 98, 101, 104, 97,
+    118, 105, 111, 114, 32, 40, 101, 46, 103, 46, 32, 112, 111, 111, 114, 32, 112, 101, 114, 102, 111, 114, 109, 97,
+    110, 99, 101, 44, 32, 111, 117, 116, 32, 111, 102, 32, 109, 101, 109, 111, 114, 121, 41, 32, 109, 97, 121, 32, 111,
+    99, 99, 117, 114, 32, 105, 110, 32, 115, 111, 109, 101, 32, 97, 112, 112, 108, 105, 99, 97, 116, 105, 111, 110, 115,
+    46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 57, 55, 48, 56, 57, 57, 48, 52, 125, 44, 32,
+    123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 101, 98, 117, 103, 70, 111, 114, 99, 101, 82, 101, 115, 111, 117,
+    114, 99, 101, 65, 100, 100, 105, 116, 105, 111, 110, 97, 108, 80, 97, 100, 100, 105, 110, 103, 34, 44, 32, 34, 84,
+    97, 103, 115, 34, 58, 32, 91, 34, 68, 101, 98, 117, 103, 34, 44, 32, 34, 82, 101, 115, 111, 117, 114, 99, 101, 32,
+    83, 101, 116, 116, 105, 110, 103, 115, 34, 44, 32, 34, 66, 114, 105, 110, 103, 117, 112, 34, 44, 32, 34, 69, 109,
+    117, 108, 97, 116, 105, 111, 110, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105,
+    118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 103, 112, 117, 115,
+    105, 122, 101, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 101, 98,
+    117, 103, 70, 111, 114, 99, 101, 82, 101, 115, 111, 117, 114, 99, 101, 65, 100, 100, 105, 116, 105, 111, 110, 97,
+    108, 80, 97, 100, 100, 105, 110, 103, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 65, 100, 100, 32, 116, 104, 101, 32, 97, 100, 100, 105, 116, 105, 111, 110, 97, 108, 32, 112, 97, 100, 100,
+    105, 110, 103, 32, 116, 111, 32, 114, 101, 115, 111, 117, 114, 99, 101, 115, 39, 32, 109, 101, 109, 111, 114, 121,
+    32, 114, 101, 113, 117, 105, 114, 101, 109, 101, 110, 116, 115, 46, 32, 84, 104, 105, 115, 32, 115, 101, 116, 116,
+    105, 110, 103, 32, 105, 115, 32, 105, 110, 32, 117, 110, 105, 116, 115, 32, 111, 102, 32, 98, 121, 116, 101, 115,
+    46, 32, 84, 104, 105, 115, 32, 105, 115, 32, 97, 32, 100, 101, 98, 117, 103, 32, 115, 101, 116, 116, 105, 110, 103,
+    32, 97, 110, 100, 32, 115, 116, 114, 97, 110, 103, 101, 32, 98, 101, 104, 97, 118, 105, 111, 114, 32, 40, 101, 46,
+    103, 46, 32, 112, 111, 111, 114, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 44, 32, 111, 117, 116, 32,
+    111, 102, 32, 109, 101, 109, 111, 114, 121, 41, 32, 109, 97, 121, 32, 111, 99, 99, 117, 114, 32, 105, 110, 32, 115,
+    111, 109, 101, 32, 97, 112, 112, 108, 105, 99, 97, 116, 105, 111, 110, 115, 46, 34, 44, 32, 34, 72, 97, 115, 104,
+    78, 97, 109, 101, 34, 58, 32, 51, 54, 48, 49, 48, 56, 48, 57, 49, 57, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 79, 118, 101, 114, 108, 97, 121, 82, 101, 112, 111, 114, 116, 77, 101, 115, 34, 44, 32, 34, 84, 97, 103,
+    115, 34, 58, 32, 91, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34, 68, 101, 118, 77, 111, 100, 101, 34, 93,
+    44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32,
+    116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97,
+    108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97,
+    114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 111, 118, 101, 114, 108, 97, 121, 82, 101, 112, 111,
+    114, 116, 77, 101, 115, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68,
+    101, 116, 101, 114, 109, 105, 110, 101, 115, 32, 105, 102, 32, 116, 104, 101, 32, 100, 101, 118, 101, 108, 111, 112,
+    101, 114, 32, 109, 111, 100, 101, 32, 111, 118, 101, 114, 108, 97, 121, 32, 119, 105, 108, 108, 32, 114, 101, 112,
+    111, 114, 116, 32, 105, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 97, 98, 111, 117, 116, 32, 77, 69, 83,
+    32, 72, 87, 83, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 54, 56, 53, 56, 48, 51, 56,
+    54, 48, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 105, 112, 71, 101, 110, 85, 115, 101, 70, 97,
+    115, 116, 80, 97, 116, 104, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101, 114, 97, 108,
+    34, 44, 32, 34, 82, 101, 115, 111, 117, 114, 99, 101, 32, 83, 101, 116, 116, 105, 110, 103, 115, 34, 44, 32, 34, 80,
+    101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58,
+    32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 83, 99, 111, 112,
+    101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101,
+    34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32,
+    34, 109, 105, 112, 71, 101, 110, 85, 115, 101, 70, 97, 115, 116, 80, 97, 116, 104, 34, 44, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 120, 112, 101, 114, 105, 109, 101, 110, 116, 97, 108, 44, 32,
+    110, 111, 116, 32, 121, 101, 116, 32, 112, 114, 111, 100, 117, 99, 116, 105, 111, 110, 32, 114, 101, 97, 100, 121,
+    46, 32, 73, 102, 32, 115, 101, 116, 44, 32, 117, 115, 101, 32, 97, 32, 115, 105, 110, 103, 108, 101, 45, 112, 97,
+    115, 115, 32, 40, 102, 111, 114, 32, 117, 112, 32, 116, 111, 32, 49, 50, 32, 109, 105, 112, 32, 108, 101, 118, 101,
+    108, 115, 41, 32, 99, 111, 109, 112, 117, 116, 101, 32, 115, 104, 97, 100, 101, 114, 45, 98, 97, 115, 101, 100, 32,
+    112, 97, 116, 104, 32, 102, 111, 114, 32, 67, 109, 100, 71, 101, 110, 101, 114, 97, 116, 101, 77, 105, 112, 109, 97,
+    112, 115, 46, 32, 79, 116, 104, 101, 114, 119, 105, 115, 101, 44, 32, 117, 115, 101, 32, 97, 32, 109, 117, 108, 116,
+    105, 45, 112, 97, 115, 115, 32, 112, 97, 116, 104, 32, 98, 97, 115, 101, 100, 32, 111, 110, 32, 83, 99, 97, 108,
+    101, 100, 67, 111, 112, 121, 73, 109, 97, 103, 101, 32, 40, 109, 97, 121, 32, 98, 101, 32, 103, 114, 97, 112, 104,
+    105, 99, 115, 32, 111, 114, 32, 99, 111, 109, 112, 117, 116, 101, 41, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 51, 51, 53, 51, 50, 50, 55, 48, 52, 53, 125, 93, 44, 32, 34, 68, 101, 102, 105, 110, 101, 100,
+    67, 111, 110, 115, 116, 97, 110, 116, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 97, 120,
+    80, 97, 116, 104, 83, 116, 114, 76, 101, 110, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 53, 49, 50, 44, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97, 120, 105, 109, 117, 109, 32, 115,
+    116, 114, 105, 110, 103, 32, 108, 101, 110, 103, 116, 104, 32, 102, 111, 114, 32, 97, 32, 100, 105, 114, 101, 99,
+    116, 111, 114, 121, 47, 112, 97, 116, 104, 32, 115, 101, 116, 116, 105, 110, 103, 34, 125, 44, 32, 123, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 77, 97, 120, 70, 105, 108, 101, 78, 97, 109, 101, 83, 116, 114, 76, 101, 110, 34, 44, 32,
+    34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 53, 54, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 77, 97, 120, 105, 109, 117, 109, 32, 115, 116, 114, 105, 110, 103, 32, 108, 101, 110, 103, 116, 104,
+    32, 102, 111, 114, 32, 97, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 115, 101, 116, 116, 105, 110, 103, 34,
+    125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 97, 120, 77, 105, 115, 99, 83, 116, 114, 76, 101, 110,
+    34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 54, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 77, 97, 120, 105, 109, 117, 109, 32, 115, 116, 114, 105, 110, 103, 32, 108, 101, 110, 103,
+    116, 104, 32, 102, 111, 114, 32, 97, 32, 109, 105, 115, 99, 101, 108, 108, 97, 110, 101, 111, 117, 115, 32, 115,
+    116, 114, 105, 110, 103, 32, 115, 101, 116, 116, 105, 110, 103, 34, 125, 93, 44, 32, 34, 84, 97, 103, 115, 34, 58,
+    32, 91, 34, 80, 117, 98, 108, 105, 99, 32, 67, 67, 67, 32, 79, 112, 116, 105, 111, 110, 115, 34, 44, 32, 34, 71,
+    101, 110, 101, 114, 97, 108, 34, 44, 32, 34, 71, 80, 85, 32, 73, 110, 102, 111, 34, 44, 32, 34, 80, 101, 114, 102,
+    111, 114, 109, 97, 110, 99, 101, 34, 44, 32, 34, 80, 114, 105, 110, 116, 105, 110, 103, 32, 97, 110, 100, 32, 76,
+    111, 103, 103, 105, 110, 103, 34, 44, 32, 34, 67, 111, 109, 109, 97, 110, 100, 32, 66, 117, 102, 102, 101, 114, 34,
+    44, 32, 34, 82, 101, 115, 111, 117, 114, 99, 101, 32, 83, 101, 116, 116, 105, 110, 103, 115, 34, 44, 32, 34, 80,
+    114, 101, 102, 101, 116, 99, 104, 105, 110, 103, 32, 40, 76, 50, 32, 67, 97, 99, 104, 101, 32, 87, 97, 114, 109,
+    105, 110, 103, 41, 34, 44, 32, 34, 83, 104, 97, 100, 101, 114, 32, 79, 112, 116, 105, 111, 110, 115, 34, 44, 32, 34,
+    77, 71, 80, 85, 34, 44, 32, 34, 87, 83, 73, 34, 44, 32, 34, 68, 101, 98, 117, 103, 32, 79, 118, 101, 114, 108, 97,
+    121, 34, 44, 32, 34, 71, 80, 85, 32, 80, 114, 111, 102, 105, 108, 101, 114, 34, 44, 32, 34, 67, 109, 100, 66, 117,
+    102, 102, 101, 114, 32, 76, 111, 103, 103, 101, 114, 34, 44, 32, 34, 73, 110, 116, 101, 114, 102, 97, 99, 101, 32,
+    76, 111, 103, 103, 101, 114, 34, 44, 32, 34, 68, 101, 98, 117, 103, 34, 44, 32, 34, 83, 97, 102, 101, 83, 101, 116,
+    116, 105, 110, 103, 34, 44, 32, 34, 68, 101, 118, 77, 111, 100, 101, 34, 44, 32, 34, 72, 68, 82, 34, 44, 32, 34, 80,
+    114, 111, 102, 105, 108, 105, 110, 103, 34, 44, 32, 34, 66, 114, 105, 110, 103, 117, 112, 34, 44, 32, 34, 72, 101,
+    97, 112, 80, 101, 114, 102, 34, 44, 32, 34, 69, 109, 117, 108, 97, 116, 105, 111, 110, 34, 44, 32, 34, 82, 73, 83,
+    34, 93, 125
 };  // g_palJsonData[]
 
 } // Pal
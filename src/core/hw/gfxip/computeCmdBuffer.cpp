@@ -213,6 +213,8 @@ void ComputeCmdBuffer::CmdBindPipeline(
 {
     PAL_ASSERT(params.pipelineBindPoint == PipelineBindPoint::Compute);
 
+    CheckInternalComputePipeline(params.pPipeline);
+
     m_computeState.pipelineState.pPipeline  = static_cast<const Pipeline*>(params.pPipeline);
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 471
     m_computeState.pipelineState.apiPsoHash = params.apiPsoHash;
@@ -107,7 +107,7 @@ Result ComputePipeline::InitFromPipelineBinary(
     PAL_ASSERT((m_pPipelineBinary != nullptr) && (m_pipelineBinaryLen != 0));
 
     AbiProcessor abiProcessor(m_pDevice->GetPlatform());
-    Result result = abiProcessor.LoadFromBuffer(m_pPipelineBinary, m_pipelineBinaryLen);
+    Result result = abiProcessor.LoadFromBufferView(m_pPipelineBinary, m_pipelineBinaryLen);
 
     MsgPackReader      metadataReader;
     CodeObjectMetadata metadata;
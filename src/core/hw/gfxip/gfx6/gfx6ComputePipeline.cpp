@@ -248,7 +248,7 @@ Result ComputePipeline::HwlInit(
             uploader.AddShReg(mmCOMPUTE_NUM_THREAD_Y, m_regs.computeNumThreadY);
             uploader.AddShReg(mmCOMPUTE_NUM_THREAD_Z, m_regs.computeNumThreadZ);
         }
-        result = uploader.End();
+        result = uploader.End(&m_uploadBatchId);
 
         if (result == Result::Success)
         {
@@ -329,6 +329,15 @@ Result ComputePipeline::HwlInit(
         bindData.requiredGpuMemSize = m_gpuMemSize;
         bindData.offset = m_gpuMem.Offset();
         m_pDevice->GetPlatform()->GetEventProvider()->LogGpuMemoryResourceBindEvent(bindData);
+
+        if (m_regGpuMem.IsBound())
+        {
+            // The registers live in their own allocation when this pipeline reuses another pipeline's code.
+            bindData.pGpuMemory = m_regGpuMem.Memory();
+            bindData.requiredGpuMemSize = m_regGpuMemSize;
+            bindData.offset = m_regGpuMem.Offset();
+            m_pDevice->GetPlatform()->GetEventProvider()->LogGpuMemoryResourceBindEvent(bindData);
+        }
     }
 
     return result;
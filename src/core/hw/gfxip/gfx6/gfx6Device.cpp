@@ -2793,10 +2793,7 @@ void InitializeGpuChipProperties(
     pInfo->srdSizes.fmaskView  = sizeof(ImageSrd);
     pInfo->srdSizes.sampler    = sizeof(SamplerSrd);
 
-    pInfo->nullSrds.pNullBufferView = &NullBufferView;
-    pInfo->nullSrds.pNullImageView  = &NullImageView;
-    pInfo->nullSrds.pNullFmaskView  = &NullImageView;
-    pInfo->nullSrds.pNullSampler    = &NullSampler;
+    InitializeNullSrds(pInfo);
 
     // All GFXIP 6-8 hardware cannot support 2-bit signed values.
     pInfo->gfx6.supports2BitSignedValues = 0;
@@ -3313,6 +3310,18 @@ void FinalizeGpuChipProperties(
     InitPerfCtrInfo(device, pInfo);
 }
 
+// =====================================================================================================================
+// Points the chip properties at the static null SRDs shared by all GFXIP 6/7/8 hardware. Their addresses are specific
+// to this process, so this must also be called when the chip properties are restored from a saved snapshot.
+void InitializeNullSrds(
+    GpuChipProperties* pInfo)
+{
+    pInfo->nullSrds.pNullBufferView = &NullBufferView;
+    pInfo->nullSrds.pNullImageView  = &NullImageView;
+    pInfo->nullSrds.pNullFmaskView  = &NullImageView;
+    pInfo->nullSrds.pNullSampler    = &NullSampler;
+}
+
 // =====================================================================================================================
 // Initializes the performance experiment properties for this GPU.
 void InitializePerfExperimentProperties(
@@ -374,7 +374,7 @@ Result GraphicsPipeline::HwlInit(
                 m_loadPath.countSh        = uploader.ShRegisterCount();
             }
 
-            result = uploader.End();
+            result = uploader.End(&m_uploadBatchId);
 
             if (result == Result::Success)
             {
@@ -406,6 +406,15 @@ Result GraphicsPipeline::HwlInit(
         bindData.requiredGpuMemSize = m_gpuMemSize;
         bindData.offset = m_gpuMem.Offset();
         m_pDevice->GetPlatform()->GetEventProvider()->LogGpuMemoryResourceBindEvent(bindData);
+
+        if (m_regGpuMem.IsBound())
+        {
+            // The registers live in their own allocation when this pipeline reuses another pipeline's code.
+            bindData.pGpuMemory = m_regGpuMem.Memory();
+            bindData.requiredGpuMemSize = m_regGpuMemSize;
+            bindData.offset = m_regGpuMem.Offset();
+            m_pDevice->GetPlatform()->GetEventProvider()->LogGpuMemoryResourceBindEvent(bindData);
+        }
     }
 
     return result;
@@ -64,6 +64,7 @@ void SettingsLoader::SetupDefaults()
     m_settings.allowBigPage = 0x3f;
     m_settings.disableBorderColorPaletteBinds = false;
     m_settings.drainPsOnOverlap = false;
+    m_settings.enableBarrierCoalescing = false;
     m_settings.printMetaEquationInfo = 0x0;
     m_settings.processMetaEquationViaCpu = false;
     m_settings.optimizedFastClear = 0x7;
@@ -243,6 +244,11 @@ void SettingsLoader::ReadSettings()
                            &m_settings.drainPsOnOverlap,
                            InternalSettingScope::PrivatePalGfx9Key);
 
+    static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pEnableBarrierCoalescingStr,
+                           Util::ValueType::Boolean,
+                           &m_settings.enableBarrierCoalescing,
+                           InternalSettingScope::PrivatePalGfx9Key);
+
     static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pPrintMetaEquationInfoStr,
                            Util::ValueType::Uint,
                            &m_settings.printMetaEquationInfo,
@@ -1215,6 +1221,11 @@ void SettingsLoader::InitSettingsInfo()
     info.valueSize = sizeof(m_settings.drainPsOnOverlap);
     m_settingsInfoMap.Insert(2630919068, info);
 
+    info.type      = SettingType::Boolean;
+    info.pValuePtr = &m_settings.enableBarrierCoalescing;
+    info.valueSize = sizeof(m_settings.enableBarrierCoalescing);
+    m_settingsInfoMap.Insert(1340295277, info);
+
     info.type      = SettingType::Uint;
     info.pValuePtr = &m_settings.printMetaEquationInfo;
     info.valueSize = sizeof(m_settings.printMetaEquationInfo);
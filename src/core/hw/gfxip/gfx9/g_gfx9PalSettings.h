@@ -185,6 +185,7 @@ struct Gfx9PalSettings : public Pal::DriverSettings
     uint32                                      allowBigPage;
     bool                                        disableBorderColorPaletteBinds;
     bool                                        drainPsOnOverlap;
+    bool                                        enableBarrierCoalescing;
     uint32                                      printMetaEquationInfo;
     bool                                        processMetaEquationViaCpu;
     uint32                                      optimizedFastClear;
@@ -340,6 +341,7 @@ static const char* pCopyDstIsCompressedStr = "#3919048798";
 static const char* pAllowBigPageStr = "#1926167631";
 static const char* pDisableBorderColorPaletteBindsStr = "#3825276041";
 static const char* pDrainPsOnOverlapStr = "#2630919068";
+static const char* pEnableBarrierCoalescingStr = "#1340295277";
 static const char* pPrintMetaEquationInfoStr = "#2137175839";
 static const char* pProcessMetaEquationViaCpuStr = "#3623936311";
 static const char* pOptimizedFastClearStr = "#1875719625";
@@ -487,7 +489,7 @@ static const char* pDepthStencilFastClearComputeThresholdSingleSampledStr = "#26
 static const char* pDepthStencilFastClearComputeThresholdMultiSampledStr = "#2782857680";
 static const char* pDisableAceCsPartialFlushStr = "#4181362005";
 
-static const uint32 g_gfx9PalNumSettings = 156;
+static const uint32 g_gfx9PalNumSettings = 157;
 static const SettingNameHash g_gfx9PalSettingHashList[] = {
 2416072074,
 3919048798,
@@ -495,6 +497,7 @@ static const SettingNameHash g_gfx9PalSettingHashList[] = {
 1926167631,
 3825276041,
 2630919068,
+1340295277,
 2137175839,
 3623936311,
 1875719625,
@@ -23,6 +23,7 @@
  *
  **********************************************************************************************************************/
 
+#include "core/platform.h"
 #include "core/hw/gfxip/gfx9/gfx9UniversalCmdBuffer.h"
 #include "core/hw/gfxip/gfx9/gfx9Device.h"
 #include "core/hw/gfxip/gfx9/gfx9Image.h"
@@ -782,21 +783,26 @@ void Device::FillCacheOperations(
 }
 
 // =====================================================================================================================
-// Examines the specified sync reqs, and the corresponding hardware commands to satisfy the requirements.
-void Device::IssueSyncs(
-    GfxCmdBuffer*                 pCmdBuf,
-    CmdStream*                    pCmdStream,
-    SyncReqs                      syncReqs,
+// Builds the hardware commands which satisfy the specified sync reqs into pCmdSpace without touching any command buffer
+// state. The sync reqs are updated to reflect the operations which were actually performed. Returns the size of the
+// commands in DWORDs.
+size_t Device::BuildSyncs(
+    const GfxCmdBuffer*           pCmdBuf,
+    SyncReqs*                     pSyncReqs,
     HwPipePoint                   waitPoint,
     gpusize                       rangeStartAddr,
     gpusize                       rangeSize,
+    bool*                         pIssuedAcquireMem,
+    uint32*                       pCmdSpace,
     Developer::BarrierOperations* pOperations
     ) const
 {
     const EngineType engineType     = pCmdBuf->GetEngineType();
     const bool       isGfxSupported = pCmdBuf->IsGraphicsSupported();
-    const uint32     origCacheFlags = syncReqs.cacheFlags;
-    uint32*          pCmdSpace      = pCmdStream->ReserveCommands();
+    SyncReqs&        syncReqs       = *pSyncReqs;
+    uint32*const     pCmdSpaceStart = pCmdSpace;
+
+    *pIssuedAcquireMem = false;
 
     FillCacheOperations(syncReqs, pOperations);
 
@@ -849,7 +855,6 @@ void Device::IssueSyncs(
                                                           SelectTcCacheOp(&syncReqs.cacheFlags),
                                                           pCmdBuf->TimestampGpuVirtAddr(),
                                                           pCmdSpace);
-        pCmdBuf->SetPrevCmdBufInactive();
 
         // WriteWaitOnEopEvent waits in the ME, if the waitPoint needs to stall at the PFP request a PFP/ME sync.
         syncReqs.pfpSyncMe = (waitPoint == HwPipeTop);
@@ -922,10 +927,7 @@ void Device::IssueSyncs(
         }
         while (syncReqs.cacheFlags != 0);
 
-        if (isGfxSupported)
-        {
-            pCmdStream->SetContextRollDetected<false>();
-        }
+        *pIssuedAcquireMem = true;
     }
 
     if (syncReqs.pfpSyncMe && isGfxSupported)
@@ -937,7 +939,46 @@ void Device::IssueSyncs(
         pOperations->pipelineStalls.pfpSyncMe = 1;
     }
 
-    pCmdStream->CommitCommands(pCmdSpace);
+    return static_cast<size_t>(pCmdSpace - pCmdSpaceStart);
+}
+
+// =====================================================================================================================
+// Examines the specified sync reqs, and the corresponding hardware commands to satisfy the requirements. Returns the
+// size of the issued commands in DWORDs.
+size_t Device::IssueSyncs(
+    GfxCmdBuffer*                 pCmdBuf,
+    CmdStream*                    pCmdStream,
+    SyncReqs                      syncReqs,
+    HwPipePoint                   waitPoint,
+    gpusize                       rangeStartAddr,
+    gpusize                       rangeSize,
+    Developer::BarrierOperations* pOperations
+    ) const
+{
+    const uint32 origCacheFlags   = syncReqs.cacheFlags;
+    bool         issuedAcquireMem = false;
+    uint32*      pCmdSpace        = pCmdStream->ReserveCommands();
+
+    const size_t dwordsWritten = BuildSyncs(pCmdBuf,
+                                            &syncReqs,
+                                            waitPoint,
+                                            rangeStartAddr,
+                                            rangeSize,
+                                            &issuedAcquireMem,
+                                            pCmdSpace,
+                                            pOperations);
+
+    pCmdStream->CommitCommands(pCmdSpace + dwordsWritten);
+
+    if (syncReqs.waitOnEopTs)
+    {
+        pCmdBuf->SetPrevCmdBufInactive();
+    }
+
+    if (issuedAcquireMem && pCmdBuf->IsGraphicsSupported())
+    {
+        pCmdStream->SetContextRollDetected<false>();
+    }
 
     // Clear up xxxBltActive flags
     if (syncReqs.waitOnEopTs || TestAnyFlagSet(syncReqs.cpMeCoherCntl.u32All, CpMeCoherCntlStallMask))
@@ -975,92 +1016,20 @@ void Device::IssueSyncs(
             pCmdBuf->SetGfxCmdBufCpMemoryWriteL2CacheStaleState(false);
         }
     }
+
+    return dwordsWritten;
 }
 
 // =====================================================================================================================
-// Inserts a barrier in the current command stream that can stall GPU execution, flush/invalidate caches, or decompress
-// images before further, dependent work can continue in this command buffer.
-//
-// The barrier implementation is executed in 3 phases:
-//
-//     1. Early image layout transitions: Perform any layout transition (i.e., decompress BLT) that is pipelined with
-//        previous work such that it can be executed before the stall phase.  For example, on a transition from
-//        rendering to a depth target to reading from that image as a texture, a stall may not be necessary since both
-//        the old usage and decompress are executed by the DB and pipelined.
-//     2. Stalls and global cache flush management:
-//            - Examine wait point and stall points to determine globally require operations (graphics idle,
-//              ps_partial_flush, etc.).
-//            - Examine all cache transitions to determine which global cache flush/invalidate commands are required.
-//              Note that this includes all caches but DB, the only GPU cache with some range checking ability.
-//            - Issue any requested range-checked target stalls or GPU event stalls.
-//            - Issue the formulated "global" sync commands.
-//     3. Late image transitions:
-//            - Issue metadata initialization BLTs.
-//            - Issue range-checked DB cache flushes.
-//            - Issue any decompress BLTs that couldn't be performed in phase 1.
-void Device::Barrier(
-    GfxCmdBuffer*      pCmdBuf,
-    CmdStream*         pCmdStream,
-    const BarrierInfo& barrier
+// Examines the barrier's pipe point waits and cache transitions to determine which global stalls and cache operations
+// must be performed.
+void Device::GetGlobalSyncReqs(
+    GfxCmdBuffer*            pCmdBuf,
+    const GfxCmdBufferState& cmdBufState,
+    const BarrierInfo&       barrier,
+    SyncReqs*                pSyncReqs
     ) const
 {
-    SyncReqs globalSyncReqs = {};
-    Developer::BarrierOperations barrierOps = {};
-    GfxCmdBufferState cmdBufState = pCmdBuf->GetGfxCmdBufState();
-
-    // -----------------------------------------------------------------------------------------------------------------
-    // -- Early image layout transitions.
-    // -----------------------------------------------------------------------------------------------------------------
-    if (barrier.flags.splitBarrierLatePhase == 0)
-    {
-        DescribeBarrierStart(pCmdBuf, barrier.reason, Developer::BarrierType::Full);
-
-        for (uint32 i = 0; i < barrier.transitionCount; i++)
-        {
-            const auto& imageInfo = barrier.pTransitions[i].imageInfo;
-
-            if (imageInfo.pImage != nullptr)
-            {
-
-                // At least one usage must be specified for the old and new layouts.
-                PAL_ASSERT((imageInfo.oldLayout.usages != 0) && (imageInfo.newLayout.usages != 0));
-
-                // With the exception of a transition out of the uninitialized state, at least one queue type must be
-                // valid for every layout.
-
-                PAL_ASSERT(((imageInfo.oldLayout.usages == LayoutUninitializedTarget) ||
-                            (imageInfo.oldLayout.engines != 0)) &&
-                           (imageInfo.newLayout.engines != 0));
-
-                if ((TestAnyFlagSet(imageInfo.oldLayout.usages, LayoutUninitializedTarget) == false) &&
-                    (TestAnyFlagSet(imageInfo.newLayout.usages, LayoutUninitializedTarget) == false))
-                {
-                    const auto& image = static_cast<const Pal::Image&>(*imageInfo.pImage);
-
-                    if (image.IsDepthStencil())
-                    {
-                        TransitionDepthStencil(pCmdBuf,
-                                               pCmdStream,
-                                               cmdBufState,
-                                               barrier,
-                                               i,
-                                               true,
-                                               &globalSyncReqs,
-                                               &barrierOps);
-                    }
-                    else
-                    {
-                        ExpandColor(pCmdBuf, pCmdStream, barrier, i, true, &globalSyncReqs, &barrierOps);
-                    }
-                }
-            }
-        }
-    }
-
-    // -----------------------------------------------------------------------------------------------------------------
-    // -- Stalls and global cache management.
-    // -----------------------------------------------------------------------------------------------------------------
-
     // Determine sync requirements for global pipeline waits.
     for (uint32 i = 0; i < barrier.pipePointWaitCount; i++)
     {
@@ -1072,7 +1041,7 @@ void Device::Barrier(
         // or later.
         if (cmdBufState.flags.cpBltActive && (pipePoint >= HwPipePostBlt))
         {
-            globalSyncReqs.syncCpDma = 1;
+            pSyncReqs->syncCpDma = 1;
         }
 
         if (pipePoint == HwPipePostBlt)
@@ -1087,23 +1056,23 @@ void Device::Barrier(
             {
             case HwPipePostIndexFetch:
                 PAL_ASSERT(barrier.waitPoint == HwPipeTop);
-                globalSyncReqs.pfpSyncMe      = 1;
+                pSyncReqs->pfpSyncMe      = 1;
                 break;
             case HwPipePreRasterization:
-                globalSyncReqs.vsPartialFlush = 1;
-                globalSyncReqs.pfpSyncMe      = (barrier.waitPoint == HwPipeTop);
+                pSyncReqs->vsPartialFlush = 1;
+                pSyncReqs->pfpSyncMe      = (barrier.waitPoint == HwPipeTop);
                 break;
             case HwPipePostPs:
-                globalSyncReqs.vsPartialFlush = 1;
-                globalSyncReqs.psPartialFlush = 1;
-                globalSyncReqs.pfpSyncMe      = (barrier.waitPoint == HwPipeTop);
+                pSyncReqs->vsPartialFlush = 1;
+                pSyncReqs->psPartialFlush = 1;
+                pSyncReqs->pfpSyncMe      = (barrier.waitPoint == HwPipeTop);
                 break;
             case HwPipePostCs:
-                globalSyncReqs.csPartialFlush = 1;
-                globalSyncReqs.pfpSyncMe      = (barrier.waitPoint == HwPipeTop);
+                pSyncReqs->csPartialFlush = 1;
+                pSyncReqs->pfpSyncMe      = (barrier.waitPoint == HwPipeTop);
                 break;
             case HwPipeBottom:
-                globalSyncReqs.waitOnEopTs    = 1;
+                pSyncReqs->waitOnEopTs    = 1;
                 break;
             case HwPipeTop:
             default:
@@ -1164,13 +1133,13 @@ void Device::Barrier(
         // Flush L2 if prior output might have been through L2 and upcoming reads/writes might not be through L2.
         if (TestAnyFlagSet(srcCacheMask, MaybeL2Mask) && TestAnyFlagSet(dstCacheMask, ~AlwaysL2Mask))
         {
-            globalSyncReqs.cacheFlags |= CacheSyncFlushTcc;
+            pSyncReqs->cacheFlags |= CacheSyncFlushTcc;
         }
 
         // Invalidate L2 if prior output might not have been through L2 and upcoming reads/writes might be through L2.
         if (TestAnyFlagSet(srcCacheMask, ~AlwaysL2Mask) && TestAnyFlagSet(dstCacheMask, MaybeL2Mask))
         {
-            globalSyncReqs.cacheFlags |= CacheSyncInvTcc;
+            pSyncReqs->cacheFlags |= CacheSyncInvTcc;
         }
 
         constexpr uint32 MaybeL1ShaderMask = CoherShader | CoherStreamOut | CoherCopy | CoherResolve | CoherClear;
@@ -1180,8 +1149,8 @@ void Device::Barrier(
         // (scalar cache) if this barrier is forcing shader read coherency.
         if (TestAnyFlagSet(srcCacheMask, MaybeL1ShaderMask) || TestAnyFlagSet(dstCacheMask, MaybeL1ShaderMask))
         {
-            globalSyncReqs.cacheFlags |= CacheSyncInvTcp;
-            globalSyncReqs.cacheFlags |= CacheSyncInvSqK$;
+            pSyncReqs->cacheFlags |= CacheSyncInvTcp;
+            pSyncReqs->cacheFlags |= CacheSyncInvSqK$;
         }
 
         if (TestAnyFlagSet(srcCacheMask, CoherColorTarget) &&
@@ -1191,8 +1160,8 @@ void Device::Barrier(
             // ensure the cache flush finishes before continuing, we must wait on a timestamp.  Catch those cases early
             // here so that we can perform it along with the rest of the stalls so that we might hide the bubble this
             // will introduce.
-            globalSyncReqs.waitOnEopTs = 1;
-            globalSyncReqs.cacheFlags |= CacheSyncFlushAndInvRb;
+            pSyncReqs->waitOnEopTs = 1;
+            pSyncReqs->cacheFlags |= CacheSyncFlushAndInvRb;
         }
 
         constexpr uint32 MaybeTccMdShaderMask = CoherShader | CoherCopy | CoherResolve | CoherClear;
@@ -1203,9 +1172,98 @@ void Device::Barrier(
         if (((pImage == nullptr) || (pImage->GetMemoryLayout().metadataSize > 0)) &&
             (TestAnyFlagSet(srcCacheMask, MaybeTccMdShaderMask) || TestAnyFlagSet(dstCacheMask, MaybeTccMdShaderMask)))
         {
-            globalSyncReqs.cacheFlags |= CacheSyncInvTccMd;
+            pSyncReqs->cacheFlags |= CacheSyncInvTccMd;
         }
     } // For each transition
+}
+
+// =====================================================================================================================
+// Inserts a barrier in the current command stream that can stall GPU execution, flush/invalidate caches, or decompress
+// images before further, dependent work can continue in this command buffer.
+//
+// The barrier implementation is executed in 3 phases:
+//
+//     1. Early image layout transitions: Perform any layout transition (i.e., decompress BLT) that is pipelined with
+//        previous work such that it can be executed before the stall phase.  For example, on a transition from
+//        rendering to a depth target to reading from that image as a texture, a stall may not be necessary since both
+//        the old usage and decompress are executed by the DB and pipelined.
+//     2. Stalls and global cache flush management:
+//            - Examine wait point and stall points to determine globally require operations (graphics idle,
+//              ps_partial_flush, etc.).
+//            - Examine all cache transitions to determine which global cache flush/invalidate commands are required.
+//              Note that this includes all caches but DB, the only GPU cache with some range checking ability.
+//            - Issue any requested range-checked target stalls or GPU event stalls.
+//            - Issue the formulated "global" sync commands.
+//     3. Late image transitions:
+//            - Issue metadata initialization BLTs.
+//            - Issue range-checked DB cache flushes.
+//            - Issue any decompress BLTs that couldn't be performed in phase 1.
+void Device::Barrier(
+    GfxCmdBuffer*      pCmdBuf,
+    CmdStream*         pCmdStream,
+    const BarrierInfo& barrier
+    ) const
+{
+    PAL_CPU_TRACE_ZONE(GetPlatform(), "Gfx9::Device::Barrier");
+
+    SyncReqs globalSyncReqs = {};
+    Developer::BarrierOperations barrierOps = {};
+    GfxCmdBufferState cmdBufState = pCmdBuf->GetGfxCmdBufState();
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // -- Early image layout transitions.
+    // -----------------------------------------------------------------------------------------------------------------
+    if (barrier.flags.splitBarrierLatePhase == 0)
+    {
+        DescribeBarrierStart(pCmdBuf, barrier.reason, Developer::BarrierType::Full);
+
+        for (uint32 i = 0; i < barrier.transitionCount; i++)
+        {
+            const auto& imageInfo = barrier.pTransitions[i].imageInfo;
+
+            if (imageInfo.pImage != nullptr)
+            {
+
+                // At least one usage must be specified for the old and new layouts.
+                PAL_ASSERT((imageInfo.oldLayout.usages != 0) && (imageInfo.newLayout.usages != 0));
+
+                // With the exception of a transition out of the uninitialized state, at least one queue type must be
+                // valid for every layout.
+
+                PAL_ASSERT(((imageInfo.oldLayout.usages == LayoutUninitializedTarget) ||
+                            (imageInfo.oldLayout.engines != 0)) &&
+                           (imageInfo.newLayout.engines != 0));
+
+                if ((TestAnyFlagSet(imageInfo.oldLayout.usages, LayoutUninitializedTarget) == false) &&
+                    (TestAnyFlagSet(imageInfo.newLayout.usages, LayoutUninitializedTarget) == false))
+                {
+                    const auto& image = static_cast<const Pal::Image&>(*imageInfo.pImage);
+
+                    if (image.IsDepthStencil())
+                    {
+                        TransitionDepthStencil(pCmdBuf,
+                                               pCmdStream,
+                                               cmdBufState,
+                                               barrier,
+                                               i,
+                                               true,
+                                               &globalSyncReqs,
+                                               &barrierOps);
+                    }
+                    else
+                    {
+                        ExpandColor(pCmdBuf, pCmdStream, barrier, i, true, &globalSyncReqs, &barrierOps);
+                    }
+                }
+            }
+        }
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // -- Stalls and global cache management.
+    // -----------------------------------------------------------------------------------------------------------------
+
+    GetGlobalSyncReqs(pCmdBuf, cmdBufState, barrier, &globalSyncReqs);
 
     // Check conditions that end up requiring a stall for all GPU work to complete.  The cases are:
     //     - A pipelined wait has been requested.
@@ -1536,6 +1594,148 @@ void Device::Barrier(
     }
 }
 
+// =====================================================================================================================
+// Returns true if the given barrier only requires global stalls and cache operations. Such barriers can be deferred by
+// DeferBarrier() and merged with neighboring barriers.
+bool Device::CanDeferBarrier(
+    const BarrierInfo& barrier
+    ) const
+{
+    bool canDefer = ((barrier.flags.splitBarrierEarlyPhase == 0)       &&
+                     (barrier.flags.splitBarrierLatePhase  == 0)       &&
+                     (barrier.pSplitBarrierGpuEvent        == nullptr) &&
+                     (barrier.gpuEventWaitCount            == 0)       &&
+                     (barrier.rangeCheckedTargetWaitCount  == 0));
+
+    // Image transitions may require decompress BLTs, which must see the results of the barrier's syncs.
+    for (uint32 i = 0; canDefer && (i < barrier.transitionCount); i++)
+    {
+        canDefer = (barrier.pTransitions[i].imageInfo.pImage == nullptr);
+    }
+
+    return canDefer;
+}
+
+// =====================================================================================================================
+// Accumulates the global syncs of the given barrier into pDeferred instead of issuing them. The caller must issue the
+// accumulated syncs by calling IssueDeferredSyncs() before any operation which could depend on them.
+void Device::DeferBarrier(
+    GfxCmdBuffer*         pCmdBuf,
+    const BarrierInfo&    barrier,
+    DeferredBarrierSyncs* pDeferred
+    ) const
+{
+    PAL_ASSERT(CanDeferBarrier(barrier));
+
+    // Nothing is executed here, so this barrier isn't described to the above layers.  Its syncs are reported as part of
+    // the barrier which IssueDeferredSyncs() describes.
+    SyncReqs syncReqs = {};
+    GetGlobalSyncReqs(pCmdBuf, pCmdBuf->GetGfxCmdBufState(), barrier, &syncReqs);
+
+    SyncReqs*const pMerged = &pDeferred->syncReqs;
+
+    pMerged->cacheFlags           |= syncReqs.cacheFlags;
+    pMerged->cpMeCoherCntl.u32All |= syncReqs.cpMeCoherCntl.u32All;
+    pMerged->waitOnEopTs          |= syncReqs.waitOnEopTs;
+    pMerged->vsPartialFlush       |= syncReqs.vsPartialFlush;
+    pMerged->psPartialFlush       |= syncReqs.psPartialFlush;
+    pMerged->csPartialFlush       |= syncReqs.csPartialFlush;
+    pMerged->pfpSyncMe            |= syncReqs.pfpSyncMe;
+    pMerged->syncCpDma            |= syncReqs.syncCpDma;
+
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 573
+    // Size the syncs this barrier would have issued on its own so that IssueDeferredSyncs() can report how many bytes
+    // merging actually saved.  BuildSyncs() doesn't touch any command buffer state, so it can write to scratch space.
+    constexpr uint32 MaxSyncDwords = 128;
+
+    uint32                       scratch[MaxSyncDwords];
+    Developer::BarrierOperations scratchOps       = {};
+    bool                         issuedAcquireMem = false;
+
+    const size_t barrierDwords = BuildSyncs(pCmdBuf,
+                                            &syncReqs,
+                                            barrier.waitPoint,
+                                            FullSyncBaseAddr,
+                                            FullSyncSize,
+                                            &issuedAcquireMem,
+                                            &scratch[0],
+                                            &scratchOps);
+    PAL_ASSERT(barrierDwords <= MaxSyncDwords);
+
+    pDeferred->unmergedDwords += barrierDwords;
+#endif
+
+    if (pDeferred->barrierCount == 0)
+    {
+        pDeferred->waitPoint   = barrier.waitPoint;
+        pDeferred->firstReason = barrier.reason;
+    }
+    else
+    {
+        pDeferred->waitPoint = Min(pDeferred->waitPoint, barrier.waitPoint);
+    }
+
+    pDeferred->barrierCount++;
+}
+
+// =====================================================================================================================
+// Issues the merged global syncs of all barriers deferred by DeferBarrier() and resets the deferred state.
+void Device::IssueDeferredSyncs(
+    GfxCmdBuffer*         pCmdBuf,
+    CmdStream*            pCmdStream,
+    DeferredBarrierSyncs* pDeferred
+    ) const
+{
+    // Reset the deferred state before calling back to the above layers; they may record commands into this command
+    // buffer, which must not see these syncs as still pending.
+    const DeferredBarrierSyncs deferred = *pDeferred;
+    memset(pDeferred, 0, sizeof(*pDeferred));
+
+    if (deferred.barrierCount > 0)
+    {
+        Developer::BarrierOperations barrierOps = {};
+
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 573
+        // Report the client's reason for the first merged barrier so that the merge doesn't hide it.
+        const uint32 reason = (deferred.firstReason != Developer::BarrierReasonInvalid)
+                                  ? deferred.firstReason
+                                  : static_cast<uint32>(Developer::BarrierReasonDeferredSyncs);
+        DescribeBarrierStart(pCmdBuf, reason, Developer::BarrierType::Full);
+
+        const size_t mergedDwords = IssueSyncs(pCmdBuf,
+                                               pCmdStream,
+                                               deferred.syncReqs,
+                                               deferred.waitPoint,
+                                               FullSyncBaseAddr,
+                                               FullSyncSize,
+                                               &barrierOps);
+
+        // Merging should never produce more commands than issuing each barrier separately, but don't let a sizing
+        // mismatch underflow.
+        const size_t savedDwords = (deferred.unmergedDwords > mergedDwords) ? (deferred.unmergedDwords - mergedDwords)
+                                                                             : 0;
+
+        barrierOps.coalescing.barriersMerged = deferred.barrierCount;
+        barrierOps.coalescing.pm4BytesSaved  = static_cast<uint32>(savedDwords * sizeof(uint32));
+#else
+        const uint32 reason = (deferred.firstReason != Developer::BarrierReasonInvalid)
+                                  ? deferred.firstReason
+                                  : static_cast<uint32>(Developer::BarrierReasonUnknown);
+        DescribeBarrierStart(pCmdBuf, reason, Developer::BarrierType::Full);
+
+        IssueSyncs(pCmdBuf,
+                   pCmdStream,
+                   deferred.syncReqs,
+                   deferred.waitPoint,
+                   FullSyncBaseAddr,
+                   FullSyncSize,
+                   &barrierOps);
+#endif
+
+        DescribeBarrierEnd(pCmdBuf, &barrierOps);
+    }
+}
+
 // =====================================================================================================================
 // Call back to above layers before starting the barrier execution.
 void Device::DescribeBarrierStart(
@@ -563,10 +563,10 @@ uint32* ComputeCmdBuffer::ValidateUserData(
             || m_spillTableCs.dirty)
         {
             const uint32 sizeInDwords = (userDataLimit - spillThreshold);
-            UpdateUserDataTableCpu(&m_spillTableCs,
-                                   sizeInDwords,
-                                   spillThreshold,
-                                   &m_computeState.csUserDataEntries.entries[0]);
+            UpdateSpillTableCpu(&m_spillTableCs,
+                                sizeInDwords,
+                                spillThreshold,
+                                &m_computeState.csUserDataEntries.entries[0]);
             relocated = true;
         }
 
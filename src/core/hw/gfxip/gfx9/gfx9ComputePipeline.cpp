@@ -51,6 +51,36 @@ const ComputePipelineSignature NullCsSignature =
 };
 static_assert(UserDataNotMapped == 0, "Unexpected value for indicating unmapped user-data entries!");
 
+// Bump this whenever the layout of ComputeRegisterCacheEntry or the way its contents are derived changes, so that stale
+// entries in a client's persistent pipeline register cache are never matched.
+constexpr uint32 ComputeRegisterCacheVersion = 2;
+
+// Register state derived from a compute pipeline ELF which is stored in the device's pipeline register cache.
+struct ComputeRegisterCacheEntry
+{
+    HwRegInfo                 regs;
+    ComputePipelineSignature  signature;
+    uint32                    perfDataRegOffset;
+};
+
+// Everything other than the ELF and platform key which affects the contents of a ComputeRegisterCacheEntry.
+struct ComputeRegisterCacheSalt
+{
+    uint32  version;
+    uint32  entrySize;
+    uint32  csLockThreshold;
+    uint32  csSimdDestCntl;
+    uint32  enableLoadIndexForObjectBinds;
+    uint32  legacyHwsTrapHandlerPresent;
+    uint32  gfxLevel;
+    uint32  numShaderArrays;  // The SE/SH/CU layout selects FORCE_SIMD_DIST and scales WAVES_PER_SH.
+    uint32  numCuPerSh;
+    uint32  numSimdPerCu;
+    uint32  numWavesPerSimd;
+    uint32  supportSpp;
+    uint32  supportSpiPrefPriority;
+};
+
 // =====================================================================================================================
 ComputePipeline::ComputePipeline(
     Device* pDevice,
@@ -79,8 +109,35 @@ Result ComputePipeline::HwlInit(
     const auto&              regInfo   = cmdUtil.GetRegInfo();
     const GpuChipProperties& chipProps = m_pDevice->Parent()->ChipProperties();
 
+    // If the register state derived from this ELF is already in the device's pipeline register cache, we can skip
+    // unpacking the register metadata and deriving the register state from it.
+    MetroHash::Hash           cacheKey   = {};
+    ComputeRegisterCacheEntry cacheEntry = {};
+    bool                      cacheHit   = false;
+
+    if (UseRegisterCache())
+    {
+        ComputeRegisterCacheSalt salt = {};
+        salt.version                       = ComputeRegisterCacheVersion;
+        salt.entrySize                     = sizeof(ComputeRegisterCacheEntry);
+        salt.csLockThreshold               = settings.csLockThreshold;
+        salt.csSimdDestCntl                = settings.csSimdDestCntl;
+        salt.enableLoadIndexForObjectBinds = settings.enableLoadIndexForObjectBinds;
+        salt.legacyHwsTrapHandlerPresent   = m_pDevice->Parent()->LegacyHwsTrapHandlerPresent();
+        salt.gfxLevel                      = static_cast<uint32>(chipProps.gfxLevel);
+        salt.numShaderArrays               = chipProps.gfx9.numShaderArrays;
+        salt.numCuPerSh                    = chipProps.gfx9.numCuPerSh;
+        salt.numSimdPerCu                  = chipProps.gfx9.numSimdPerCu;
+        salt.numWavesPerSimd               = chipProps.gfx9.numWavesPerSimd;
+        salt.supportSpp                    = chipProps.gfx9.supportSpp;
+        salt.supportSpiPrefPriority        = chipProps.gfx9.supportSpiPrefPriority;
+
+        cacheKey = ComputeRegisterCacheKey(&salt, sizeof(salt));
+        cacheHit = LoadRegisterCacheEntry(cacheKey, &cacheEntry, sizeof(cacheEntry));
+    }
+
     RegisterVector registers(m_pDevice->GetPlatform());
-    Result result = pMetadataReader->Unpack(&registers);
+    Result result = cacheHit ? Result::Success : pMetadataReader->Unpack(&registers);
 
     const uint32 loadedShRegCount = m_chunkCs.EarlyInit();
     ComputePipelineUploader uploader(m_pDevice, loadedShRegCount);
@@ -107,26 +164,60 @@ Result ComputePipeline::HwlInit(
     {
         UpdateRingSizes(metadata);
 
-        // Update the pipeline signature with user-mapping data contained in the ELF:
-        m_chunkCs.SetupSignatureFromElf(&m_signature, metadata, registers);
+        PerfDataInfo*const pCsPerfDataInfo = &m_perfDataInfo[static_cast<uint32>(Abi::HardwareStage::Cs)];
 
-        const uint32 wavefrontSize = IsWave32() ? 32 : 64;
+        if (cacheHit)
+        {
+            m_signature                = cacheEntry.signature;
+            pCsPerfDataInfo->regOffset = cacheEntry.perfDataRegOffset;
+
+            m_chunkCs.LateInitFromCache<ComputePipelineUploader>(abiProcessor,
+                                                                 cacheEntry.regs,
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION < 556
+                                                                 createInfo.pIndirectFuncList,
+                                                                 createInfo.indirectFuncCount,
+#else
+                                                                 nullptr,
+                                                                 0,
+#endif
+                                                                 &m_threadsPerTgX,
+                                                                 &m_threadsPerTgY,
+                                                                 &m_threadsPerTgZ,
+                                                                 &uploader);
+        }
+        else
+        {
+            // Update the pipeline signature with user-mapping data contained in the ELF:
+            m_chunkCs.SetupSignatureFromElf(&m_signature, metadata, registers);
+
+            const uint32 wavefrontSize = IsWave32() ? 32 : 64;
 
-        m_chunkCs.LateInit<ComputePipelineUploader>(abiProcessor,
-                                                    registers,
-                                                    wavefrontSize,
- #if PAL_CLIENT_INTERFACE_MAJOR_VERSION < 556
-                                                    createInfo.pIndirectFuncList,
-                                                    createInfo.indirectFuncCount,
+            m_chunkCs.LateInit<ComputePipelineUploader>(abiProcessor,
+                                                        registers,
+                                                        wavefrontSize,
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION < 556
+                                                        createInfo.pIndirectFuncList,
+                                                        createInfo.indirectFuncCount,
 #else
-                                                    nullptr,
-                                                    0,
+                                                        nullptr,
+                                                        0,
 #endif
-                                                    &m_threadsPerTgX,
-                                                    &m_threadsPerTgY,
-                                                    &m_threadsPerTgZ,
-                                                    &uploader);
-        result = uploader.End();
+                                                        &m_threadsPerTgX,
+                                                        &m_threadsPerTgY,
+                                                        &m_threadsPerTgZ,
+                                                        &uploader);
+
+            if (UseRegisterCache())
+            {
+                cacheEntry.regs              = m_chunkCs.HWInfo();
+                cacheEntry.signature         = m_signature;
+                cacheEntry.perfDataRegOffset = pCsPerfDataInfo->regOffset;
+
+                StoreRegisterCacheEntry(cacheKey, &cacheEntry, sizeof(cacheEntry));
+            }
+        }
+
+        result = uploader.End(&m_uploadBatchId);
     }
 
     if (result == Result::Success)
@@ -147,6 +238,15 @@ Result ComputePipeline::HwlInit(
         bindData.requiredGpuMemSize = m_gpuMemSize;
         bindData.offset = m_gpuMem.Offset();
         m_pDevice->GetPlatform()->GetEventProvider()->LogGpuMemoryResourceBindEvent(bindData);
+
+        if (m_regGpuMem.IsBound())
+        {
+            // The registers live in their own allocation when this pipeline reuses another pipeline's code.
+            bindData.pGpuMemory = m_regGpuMem.Memory();
+            bindData.requiredGpuMemSize = m_regGpuMemSize;
+            bindData.offset = m_regGpuMem.Offset();
+            m_pDevice->GetPlatform()->GetEventProvider()->LogGpuMemoryResourceBindEvent(bindData);
+        }
     }
 
     return result;
@@ -24,6 +24,7 @@
  **********************************************************************************************************************/
 
 #include "core/device.h"
+#include "core/platform.h"
 #include "core/queue.h"
 #include "core/hw/gfxip/gfx9/g_gfx9MergedDataFormats.h"
 #include "core/hw/gfxip/gfx9/gfx9BorderColorPalette.h"
@@ -843,6 +844,8 @@ Result Device::CreateComputePipeline(
     bool                             isInternal,
     IPipeline**                      ppPipeline)
 {
+    PAL_CPU_TRACE_ZONE(GetPlatform(), "Gfx9::Device::CreateComputePipeline");
+
     auto* pPipeline = PAL_PLACEMENT_NEW(pPlacementAddr) ComputePipeline(this, isInternal);
 
     Result result = pPipeline->Init(createInfo);
@@ -923,6 +926,8 @@ Result Device::CreateGraphicsPipeline(
     bool                                      isInternal,
     IPipeline**                               ppPipeline)
 {
+    PAL_CPU_TRACE_ZONE(GetPlatform(), "Gfx9::Device::CreateGraphicsPipeline");
+
     auto* pPipeline = PAL_PLACEMENT_NEW(pPlacementAddr) GraphicsPipeline(this, isInternal);
 
     Result result = pPipeline->Init(createInfo, internalInfo);
@@ -2256,6 +2261,50 @@ bool Device::IsImageFormatOverrideNeeded(
         IsGfx9ImageFormatWorkaroundNeeded(imageCreateInfo, pFormat, pPixelsPerBlock);
 }
 
+// =====================================================================================================================
+// Returns the texture filtering performance modulation requested by an image view.
+static TexPerfModulation GetImageViewPerfMod(
+    const Pal::Device&   device,
+    const ImageViewInfo& viewInfo)
+{
+    // Setup CCC filtering optimizations: GCN uses a simple scheme which relies solely on the optimization
+    // setting from the CCC rather than checking the render target resolution.
+    static_assert(TextureFilterOptimizationsDisabled   == 0, "TextureOptLevel lookup table mismatch");
+    static_assert(TextureFilterOptimizationsEnabled    == 1, "TextureOptLevel lookup table mismatch");
+    static_assert(TextureFilterOptimizationsAggressive == 2, "TextureOptLevel lookup table mismatch");
+
+    constexpr TexPerfModulation PanelToTexPerfMod[] =
+    {
+        TexPerfModulation::None,     // TextureFilterOptimizationsDisabled
+        TexPerfModulation::Default,  // TextureFilterOptimizationsEnabled
+        TexPerfModulation::Max       // TextureFilterOptimizationsAggressive
+    };
+
+    PAL_ASSERT(viewInfo.texOptLevel < ImageTexOptLevel::Count);
+
+    uint32 texOptLevel;
+    switch (viewInfo.texOptLevel)
+    {
+    case ImageTexOptLevel::Disabled:
+        texOptLevel = TextureFilterOptimizationsDisabled;
+        break;
+    case ImageTexOptLevel::Enabled:
+        texOptLevel = TextureFilterOptimizationsEnabled;
+        break;
+    case ImageTexOptLevel::Maximum:
+        texOptLevel = TextureFilterOptimizationsAggressive;
+        break;
+    case ImageTexOptLevel::Default:
+    default:
+        texOptLevel = device.Settings().textureOptLevel;
+        break;
+    }
+
+    PAL_ASSERT(texOptLevel < ArrayLen(PanelToTexPerfMod));
+
+    return PanelToTexPerfMod[texOptLevel];
+}
+
 // =====================================================================================================================
 static void GetSliceAddressOffsets(
     const Image& image,
@@ -2293,6 +2342,179 @@ static void GetSliceAddressOffsets(
     *pSliceOffset = pAddrOutput->sliceSize * arraySlice;
 }
 
+// =====================================================================================================================
+// Returns the SQ_IMG_RSRC_WORD3.TYPE value for a GFX9 image view.
+static uint32 Gfx9GetImageViewSrdType(
+    const ImageViewInfo& viewInfo,
+    bool                 isMultiSampled)
+{
+    uint32 type = 0;
+
+    // NOTE: Where possible, we always assume an array view type because we don't know how the shader will
+    // attempt to access the resource.
+    switch (GetViewType(viewInfo))
+    {
+    case ImageViewType::Tex1d:
+        type = SQ_RSRC_IMG_1D_ARRAY;
+        break;
+    case ImageViewType::Tex2d:
+#if (PAL_CLIENT_INTERFACE_MAJOR_VERSION < 546)
+    case ImageViewType::TexQuilt: // quilted textures must be 2D
+#endif
+        type = (isMultiSampled) ? SQ_RSRC_IMG_2D_MSAA_ARRAY : SQ_RSRC_IMG_2D_ARRAY;
+        break;
+    case ImageViewType::Tex3d:
+        type = SQ_RSRC_IMG_3D;
+        break;
+    case ImageViewType::TexCube:
+        type = SQ_RSRC_IMG_CUBE;
+        break;
+    default:
+        PAL_ASSERT_ALWAYS();
+        break;
+    }
+
+    return type;
+}
+
+// =====================================================================================================================
+// Returns true if the given image can share one SRD template between its color views. This rules out every image
+// whose views may need extent, address or format overrides (depth/stencil, YUV and macro-pixel-packed formats).
+static bool CanUseColorViewSrdTemplate(
+    const Pal::Image& image)
+{
+    const ImageCreateInfo& createInfo = image.GetImageCreateInfo();
+    const ChNumFormat      format     = createInfo.swizzledFormat.format;
+
+    return ((image.IsDepthStencil() == false)              &&
+            (Formats::IsYuv(format) == false)              &&
+            (Formats::IsMacroPixelPacked(format) == false) &&
+#if (PAL_CLIENT_INTERFACE_MAJOR_VERSION < 446)
+            (createInfo.flags.view3dAs2dArray == 0)        &&
+#endif
+            (createInfo.usageFlags.depthAsZ24 == 0)        &&
+            image.GetBoundGpuMemory().IsBound());
+}
+
+// =====================================================================================================================
+// Returns true if an image view can be built by patching its image's color view SRD template: the view must address
+// whole color texels of the image, without any padding.
+static bool CanPatchColorViewSrdTemplate(
+    const ImageViewInfo& viewInfo)
+{
+    const auto*const       pParent     = static_cast<const Pal::Image*>(viewInfo.pImage);
+    const ChNumFormat      viewFormat  = viewInfo.swizzledFormat.format;
+    const ChNumFormat      imageFormat = pParent->GetImageCreateInfo().swizzledFormat.format;
+    const SubresId         baseSubres  = { ImageAspect::Color, 0, 0 };
+
+    return ((viewInfo.flags.includePadding == 0)                                                  &&
+            (viewInfo.subresRange.startSubres.aspect == ImageAspect::Color)                       &&
+#if (PAL_CLIENT_INTERFACE_MAJOR_VERSION < 546)
+            (viewInfo.viewType != ImageViewType::TexQuilt)                                        &&
+#endif
+            (Formats::IsBlockCompressed(viewFormat) == Formats::IsBlockCompressed(imageFormat)) &&
+            (Formats::BitsPerPixel(viewFormat) == pParent->SubresourceInfo(baseSubres)->bitsPerTexel));
+}
+
+// =====================================================================================================================
+// Fills out the image-invariant fields of a GFX9 color view SRD.
+static void Gfx9BuildColorViewSrdTemplate(
+    const Image&  image,
+    Gfx9ImageSrd* pSrd)
+{
+    const Pal::Image*const      pParent      = image.Parent();
+    const ImageCreateInfo&      createInfo   = pParent->GetImageCreateInfo();
+    const SubresId              baseSubResId = { ImageAspect::Color, 0, 0 };
+    const SubResourceInfo*const pSubResInfo  = pParent->SubresourceInfo(baseSubResId);
+    const auto&                 surfSetting  = image.GetAddrSettings(pSubResInfo);
+
+    memset(pSrd, 0, sizeof(*pSrd));
+
+    pSrd->word0.bits.BASE_ADDRESS      = image.GetSubresource256BAddrSwizzled(baseSubResId);
+    pSrd->word1.bits.BASE_ADDRESS_HI   = image.GetSubresource256BAddrSwizzledHi(baseSubResId);
+    pSrd->word2.bits.WIDTH             = (pSubResInfo->extentTexels.width  - 1);
+    pSrd->word2.bits.HEIGHT            = (pSubResInfo->extentTexels.height - 1);
+    pSrd->word3.bits.SW_MODE           = AddrMgr2::GetHwSwizzleMode(surfSetting.swizzleMode);
+    pSrd->word4.bits.PITCH             = AddrMgr2::CalcEpitch(image.GetAddrOutput(pSubResInfo));
+    pSrd->word5.bits.MAX_MIP           = (createInfo.samples > 1) ? Log2(createInfo.fragments)
+                                                                  : (createInfo.mipLevels - 1);
+    pSrd->word5.bits.META_PIPE_ALIGNED = Gfx9MaskRam::IsPipeAligned(&image);
+    pSrd->word5.bits.META_RB_ALIGNED   = Gfx9MaskRam::IsRbAligned(&image);
+
+    if (pSubResInfo->flags.supportMetaDataTexFetch)
+    {
+        // Compressed fetches are disabled again for writable views when the template is patched.
+        pSrd->word6.bits.COMPRESSION_EN    = 1;
+        pSrd->word7.bits.META_DATA_ADDRESS = image.GetDcc256BAddr();
+    }
+}
+
+// =====================================================================================================================
+// Builds a GFX9 color view SRD by patching the view-specific fields into its image's SRD template.
+static void Gfx9PatchColorViewSrd(
+    const Pal::Device&   device,
+    const MergedFmtInfo* pFmtInfo,
+    const ImageViewInfo& viewInfo,
+    const Gfx9ImageSrd&  srdTemplate,
+    Gfx9ImageSrd*        pSrd)
+{
+    constexpr uint32 Gfx9MinLodIntBits  = 4;
+    constexpr uint32 Gfx9MinLodFracBits = 8;
+
+    const auto*const       pParent        = static_cast<const Pal::Image*>(viewInfo.pImage);
+    const ImageCreateInfo& createInfo     = pParent->GetImageCreateInfo();
+    const SubresId         baseSubResId   = { ImageAspect::Color, 0, 0 };
+    const ChNumFormat      format         = viewInfo.swizzledFormat.format;
+    const bool             isMultiSampled = (createInfo.samples > 1);
+    const uint32           firstMipLevel  = viewInfo.subresRange.startSubres.mipLevel;
+
+    Gfx9ImageSrd srd = srdTemplate;
+
+    srd.word1.bits.MIN_LOD     = Math::FloatToUFixed(viewInfo.minLod, Gfx9MinLodIntBits, Gfx9MinLodFracBits, true);
+    srd.word1.bits.DATA_FORMAT = Formats::Gfx9::HwImgDataFmt(pFmtInfo, format);
+    srd.word1.bits.NUM_FORMAT  = Formats::Gfx9::HwImgNumFmt(pFmtInfo, format);
+    srd.word2.bits.PERF_MOD    = static_cast<uint32>(GetImageViewPerfMod(device, viewInfo));
+    srd.word3.bits.DST_SEL_X   = Formats::Gfx9::HwSwizzle(viewInfo.swizzledFormat.swizzle.r);
+    srd.word3.bits.DST_SEL_Y   = Formats::Gfx9::HwSwizzle(viewInfo.swizzledFormat.swizzle.g);
+    srd.word3.bits.DST_SEL_Z   = Formats::Gfx9::HwSwizzle(viewInfo.swizzledFormat.swizzle.b);
+    srd.word3.bits.DST_SEL_W   = Formats::Gfx9::HwSwizzle(viewInfo.swizzledFormat.swizzle.a);
+    srd.word3.bits.TYPE        = Gfx9GetImageViewSrdType(viewInfo, isMultiSampled);
+    srd.word3.bits.BASE_LEVEL  = isMultiSampled ? 0 : firstMipLevel;
+    srd.word3.bits.LAST_LEVEL  = isMultiSampled ? Log2(createInfo.fragments)
+                                                : (firstMipLevel + viewInfo.subresRange.numMips - 1);
+    srd.word4.bits.DEPTH       = ComputeImageViewDepth(viewInfo,
+                                                       pParent->GetImageInfo(),
+                                                       *pParent->SubresourceInfo(baseSubResId));
+    srd.word4.bits.BC_SWIZZLE  = GetBcSwizzle(viewInfo);
+    srd.word5.bits.BASE_ARRAY  = ((viewInfo.flags.zRangeValid == 1) && (createInfo.imageType == ImageType::Tex3d))
+                                 ? viewInfo.zRange.offset
+                                 : viewInfo.subresRange.startSubres.arraySlice;
+
+    if (srdTemplate.word6.bits.COMPRESSION_EN != 0)
+    {
+        const SurfaceSwap surfSwap = Formats::Gfx9::ColorCompSwap(viewInfo.swizzledFormat);
+
+        if ((surfSwap != SWAP_STD_REV) && (surfSwap != SWAP_ALT_REV))
+        {
+            srd.word6.bits.ALPHA_IS_ON_MSB = 1;
+        }
+
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 478
+        if (TestAnyFlagSet(viewInfo.possibleLayouts.usages, LayoutShaderWrite | LayoutCopyDst))
+#else
+        if (viewInfo.flags.shaderWritable)
+#endif
+        {
+            srd.word6.bits.COMPRESSION_EN    = 0;
+            srd.word7.bits.META_DATA_ADDRESS = 0;
+        }
+    }
+
+    SetImageViewSamplePatternIdx(&srd, viewInfo.samplePatternIdx);
+
+    memcpy(pSrd, &srd, sizeof(srd));
+}
+
 // =====================================================================================================================
 // Gfx9+ specific function for creating image view SRDs. Installed in the function pointer table of the parent device
 // during initialization.
@@ -2314,6 +2536,15 @@ void PAL_STDCALL Device::Gfx9CreateImageViewSrds(
     {
         const ImageViewInfo&   viewInfo        = pImgViewInfo[i];
         const Image&           image           = *GetGfx9Image(viewInfo.pImage);
+        const ImageSrd*const   pSrdTemplate    = image.GetColorViewSrdTemplate();
+
+        if ((pSrdTemplate != nullptr) && CanPatchColorViewSrdTemplate(viewInfo))
+        {
+            // Most views of ordinary color images only differ in their format, swizzle and subresource range.
+            Gfx9PatchColorViewSrd(*pGfxDevice->Parent(), pFmtInfo, viewInfo, pSrdTemplate->gfx9, &pSrds[i].gfx9);
+            continue;
+        }
+
         const auto*const       pParent         = static_cast<const Pal::Image*>(viewInfo.pImage);
         const ImageInfo&       imageInfo       = pParent->GetImageInfo();
         const ImageCreateInfo& imageCreateInfo = pParent->GetImageCreateInfo();
@@ -2612,42 +2843,7 @@ void PAL_STDCALL Device::Gfx9CreateImageViewSrds(
         srd.word2.bits.WIDTH  = (programmedExtent.width - 1);
         srd.word2.bits.HEIGHT = (programmedExtent.height - 1);
 
-        // Setup CCC filtering optimizations: GCN uses a simple scheme which relies solely on the optimization
-        // setting from the CCC rather than checking the render target resolution.
-        static_assert(TextureFilterOptimizationsDisabled   == 0, "TextureOptLevel lookup table mismatch");
-        static_assert(TextureFilterOptimizationsEnabled    == 1, "TextureOptLevel lookup table mismatch");
-        static_assert(TextureFilterOptimizationsAggressive == 2, "TextureOptLevel lookup table mismatch");
-
-        constexpr TexPerfModulation PanelToTexPerfMod[] =
-        {
-            TexPerfModulation::None,     // TextureFilterOptimizationsDisabled
-            TexPerfModulation::Default,  // TextureFilterOptimizationsEnabled
-            TexPerfModulation::Max       // TextureFilterOptimizationsAggressive
-        };
-
-        PAL_ASSERT(viewInfo.texOptLevel < ImageTexOptLevel::Count);
-
-        uint32 texOptLevel;
-        switch (viewInfo.texOptLevel)
-        {
-        case ImageTexOptLevel::Disabled:
-            texOptLevel = TextureFilterOptimizationsDisabled;
-            break;
-        case ImageTexOptLevel::Enabled:
-            texOptLevel = TextureFilterOptimizationsEnabled;
-            break;
-        case ImageTexOptLevel::Maximum:
-            texOptLevel = TextureFilterOptimizationsAggressive;
-            break;
-        case ImageTexOptLevel::Default:
-        default:
-            texOptLevel = static_cast<const Pal::Device*>(pDevice)->Settings().textureOptLevel;
-            break;
-        }
-
-        PAL_ASSERT(texOptLevel < ArrayLen(PanelToTexPerfMod));
-
-        TexPerfModulation perfMod = PanelToTexPerfMod[texOptLevel];
+        const TexPerfModulation perfMod = GetImageViewPerfMod(*static_cast<const Pal::Device*>(pDevice), viewInfo);
 
         srd.word2.bits.PERF_MOD = static_cast<uint32>(perfMod);
 
@@ -2675,30 +2871,7 @@ void PAL_STDCALL Device::Gfx9CreateImageViewSrds(
 
         const bool isMultiSampled = (imageCreateInfo.samples > 1);
 
-        // NOTE: Where possible, we always assume an array view type because we don't know how the shader will
-        // attempt to access the resource.
-        const ImageViewType  viewType = GetViewType(viewInfo);
-        switch (viewType)
-        {
-        case ImageViewType::Tex1d:
-            srd.word3.bits.TYPE = SQ_RSRC_IMG_1D_ARRAY;
-            break;
-        case ImageViewType::Tex2d:
-#if (PAL_CLIENT_INTERFACE_MAJOR_VERSION < 546)
-        case ImageViewType::TexQuilt: // quilted textures must be 2D
-#endif
-            srd.word3.bits.TYPE = (isMultiSampled) ? SQ_RSRC_IMG_2D_MSAA_ARRAY : SQ_RSRC_IMG_2D_ARRAY;
-            break;
-        case ImageViewType::Tex3d:
-            srd.word3.bits.TYPE = SQ_RSRC_IMG_3D;
-            break;
-        case ImageViewType::TexCube:
-            srd.word3.bits.TYPE = SQ_RSRC_IMG_CUBE;
-            break;
-        default:
-            PAL_ASSERT_ALWAYS();
-            break;
-        }
+        srd.word3.bits.TYPE = Gfx9GetImageViewSrdType(viewInfo, isMultiSampled);
 
         if (isMultiSampled)
         {
@@ -2854,6 +3027,154 @@ static void Gfx10SetImageSrdWidth(
     pSrd->width_hi = (width - 1) >> WidthLowSize;
 }
 
+// =====================================================================================================================
+// Returns the SQ_IMG_RSRC_WORD3.TYPE value for a GFX10 image view.
+static uint32 Gfx10GetImageViewSrdType(
+    const ImageViewInfo&   viewInfo,
+    const ImageCreateInfo& imageCreateInfo)
+{
+    const bool isMultiSampled = (imageCreateInfo.samples > 1);
+    uint32     type           = 0;
+
+    // NOTE: Where possible, we always assume an array view type because we don't know how the shader will
+    // attempt to access the resource.
+    switch (GetViewType(viewInfo))
+    {
+    case ImageViewType::Tex1d:
+        type = ((imageCreateInfo.arraySize == 1) ? SQ_RSRC_IMG_1D : SQ_RSRC_IMG_1D_ARRAY);
+        break;
+    case ImageViewType::Tex2d:
+#if (PAL_CLIENT_INTERFACE_MAJOR_VERSION < 546)
+    case ImageViewType::TexQuilt: // quilted textures must be 2D
+#endif
+        type = ((imageCreateInfo.arraySize == 1)
+                ? (isMultiSampled ? SQ_RSRC_IMG_2D_MSAA       : SQ_RSRC_IMG_2D)
+                : (isMultiSampled ? SQ_RSRC_IMG_2D_MSAA_ARRAY : SQ_RSRC_IMG_2D_ARRAY));
+        break;
+    case ImageViewType::Tex3d:
+        type = SQ_RSRC_IMG_3D;
+        break;
+    case ImageViewType::TexCube:
+        type = SQ_RSRC_IMG_CUBE;
+        break;
+    default:
+        PAL_ASSERT_ALWAYS();
+        break;
+    }
+
+    return type;
+}
+
+// =====================================================================================================================
+// Fills out the image-invariant fields of a GFX10 color view SRD.
+static void Gfx10BuildColorViewSrdTemplate(
+    const Image&   image,
+    sq_img_rsrc_t* pSrd)
+{
+    const Pal::Image*const      pParent      = image.Parent();
+    const ImageCreateInfo&      createInfo   = pParent->GetImageCreateInfo();
+    const SubresId              baseSubResId = { ImageAspect::Color, 0, 0 };
+    const SubResourceInfo*const pSubResInfo  = pParent->SubresourceInfo(baseSubResId);
+    const auto&                 surfSetting  = image.GetAddrSettings(pSubResInfo);
+    const Gfx10AllowBigPage     bigPageUsage = createInfo.usageFlags.shaderWrite ? Gfx10AllowBigPageShaderWrite
+                                                                                 : Gfx10AllowBigPageShaderRead;
+
+    memset(pSrd, 0, sizeof(*pSrd));
+
+    Gfx10SetImageSrdWidth(pSrd, pSubResInfo->extentTexels.width);
+    pSrd->height              = (pSubResInfo->extentTexels.height - 1);
+    pSrd->sw_mode             = AddrMgr2::GetHwSwizzleMode(surfSetting.swizzleMode);
+    pSrd->most.max_mip        = (createInfo.samples > 1) ? Log2(createInfo.fragments) : (createInfo.mipLevels - 1);
+    pSrd->meta_pipe_aligned   = Gfx9MaskRam::IsPipeAligned(&image);
+    pSrd->iterate_256         = image.GetIterate256(pSubResInfo);
+    pSrd->corner_samples      = createInfo.usageFlags.cornerSampling;
+    pSrd->most.big_page       = IsImageBigPageCompatible(image, bigPageUsage);
+    pSrd->base_address        = image.GetSubresource256BAddrSwizzled(baseSubResId);
+    pSrd->most.resource_level = 1;
+
+    if (pSubResInfo->flags.supportMetaDataTexFetch)
+    {
+        const auto& dccControl = image.GetDcc()->GetControlReg();
+
+        pSrd->compression_en              = 1;
+        pSrd->meta_data_address           = image.GetDcc256BAddr();
+        pSrd->max_compressed_block_size   = dccControl.bits.MAX_COMPRESSED_BLOCK_SIZE;
+        pSrd->max_uncompressed_block_size = dccControl.bits.MAX_UNCOMPRESSED_BLOCK_SIZE;
+    }
+}
+
+// =====================================================================================================================
+// Builds a GFX10 color view SRD by patching the view-specific fields into its image's SRD template.
+static void Gfx10PatchColorViewSrd(
+    const Pal::Device&       device,
+    const MergedFlatFmtInfo* pFmtInfo,
+    const ImageViewInfo&     viewInfo,
+    const Image&             image,
+    const sq_img_rsrc_t&     srdTemplate,
+    sq_img_rsrc_t*           pSrd)
+{
+    constexpr uint32 Gfx9MinLodIntBits  = 4;
+    constexpr uint32 Gfx9MinLodFracBits = 8;
+
+    const auto*const       pParent        = image.Parent();
+    const ImageCreateInfo& createInfo     = pParent->GetImageCreateInfo();
+    const SubresId         baseSubResId   = { ImageAspect::Color, 0, 0 };
+    const bool             isMultiSampled = (createInfo.samples > 1);
+    const uint32           firstMipLevel  = viewInfo.subresRange.startSubres.mipLevel;
+
+    sq_img_rsrc_t srd = srdTemplate;
+
+    srd.most.min_lod  = Math::FloatToUFixed(viewInfo.minLod, Gfx9MinLodIntBits, Gfx9MinLodFracBits, true);
+    srd.most.format   = Formats::Gfx9::HwImgFmt(pFmtInfo, viewInfo.swizzledFormat.format);
+    srd.perf_mod      = static_cast<uint32>(GetImageViewPerfMod(device, viewInfo));
+    srd.dst_sel_x     = Formats::Gfx9::HwSwizzle(viewInfo.swizzledFormat.swizzle.r);
+    srd.dst_sel_y     = Formats::Gfx9::HwSwizzle(viewInfo.swizzledFormat.swizzle.g);
+    srd.dst_sel_z     = Formats::Gfx9::HwSwizzle(viewInfo.swizzledFormat.swizzle.b);
+    srd.dst_sel_w     = Formats::Gfx9::HwSwizzle(viewInfo.swizzledFormat.swizzle.a);
+    srd.type          = Gfx10GetImageViewSrdType(viewInfo, createInfo);
+    srd.base_level    = isMultiSampled ? 0 : firstMipLevel;
+    srd.last_level    = isMultiSampled ? Log2(createInfo.fragments)
+                                       : (firstMipLevel + viewInfo.subresRange.numMips - 1);
+    srd.depth         = ComputeImageViewDepth(viewInfo,
+                                              pParent->GetImageInfo(),
+                                              *pParent->SubresourceInfo(baseSubResId));
+    srd.bc_swizzle    = GetBcSwizzle(viewInfo);
+    srd.base_array    = ((viewInfo.flags.zRangeValid == 1) && (createInfo.imageType == ImageType::Tex3d))
+                        ? viewInfo.zRange.offset
+                        : viewInfo.subresRange.startSubres.arraySlice;
+
+    // Fill the unused 4 bits of word6 with sample pattern index
+    srd._reserved_206_203 = viewInfo.samplePatternIdx;
+
+    if (srdTemplate.compression_en != 0)
+    {
+        const SurfaceSwap surfSwap = Formats::Gfx9::ColorCompSwap(viewInfo.swizzledFormat);
+
+        if (Formats::NumComponents(viewInfo.swizzledFormat.format) == 1)
+        {
+            srd.alpha_is_on_msb = ((surfSwap == SWAP_ALT_REV) ? 1 : 0);
+        }
+        else if ((surfSwap != SWAP_STD_REV) && (surfSwap != SWAP_ALT_REV))
+        {
+            srd.alpha_is_on_msb = 1;
+        }
+
+        // See Gfx10CreateImageViewSrds for why compressed writes require the view and image formats to match.
+        if (Formats::IsSameFormat(viewInfo.swizzledFormat, createInfo.swizzledFormat) &&
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 478
+            ImageLayoutCanCompressColorData(image.LayoutToColorCompressionState(), viewInfo.possibleLayouts))
+#else
+            (viewInfo.flags.shaderWritable != 0))
+#endif
+        {
+            srd.color_transform       = image.GetDcc()->GetControlReg().bits.COLOR_TRANSFORM;
+            srd.write_compress_enable = 1;
+        }
+    }
+
+    memcpy(pSrd, &srd, sizeof(srd));
+}
+
 // =====================================================================================================================
 void PAL_STDCALL Device::Gfx10CreateImageViewSrds(
     const IDevice*       pDevice,
@@ -2876,6 +3197,15 @@ void PAL_STDCALL Device::Gfx10CreateImageViewSrds(
 
         const auto*const       pParent         = static_cast<const Pal::Image*>(viewInfo.pImage);
         const Image&           image           = static_cast<const Image&>(*(pParent->GetGfxImage()));
+        const ImageSrd*const   pSrdTemplate    = image.GetColorViewSrdTemplate();
+
+        if ((pSrdTemplate != nullptr) && CanPatchColorViewSrdTemplate(viewInfo))
+        {
+            // Most views of ordinary color images only differ in their format, swizzle and subresource range.
+            Gfx10PatchColorViewSrd(*pPalDevice, pFmtInfo, viewInfo, image, pSrdTemplate->gfx10, &pSrds[i].gfx10);
+            continue;
+        }
+
         const ImageInfo&       imageInfo       = pParent->GetImageInfo();
         const ImageCreateInfo& imageCreateInfo = pParent->GetImageCreateInfo();
         const bool             imgIsBc         = Formats::IsBlockCompressed(imageCreateInfo.swizzledFormat.format);
@@ -3108,42 +3438,7 @@ void PAL_STDCALL Device::Gfx10CreateImageViewSrds(
         Gfx10SetImageSrdWidth(&srd, programmedExtent.width);
         srd.height   = (programmedExtent.height - 1);
 
-        // Setup CCC filtering optimizations: GCN uses a simple scheme which relies solely on the optimization
-        // setting from the CCC rather than checking the render target resolution.
-        static_assert(TextureFilterOptimizationsDisabled   == 0, "TextureOptLevel lookup table mismatch");
-        static_assert(TextureFilterOptimizationsEnabled    == 1, "TextureOptLevel lookup table mismatch");
-        static_assert(TextureFilterOptimizationsAggressive == 2, "TextureOptLevel lookup table mismatch");
-
-        constexpr TexPerfModulation PanelToTexPerfMod[] =
-        {
-            TexPerfModulation::None,     // TextureFilterOptimizationsDisabled
-            TexPerfModulation::Default,  // TextureFilterOptimizationsEnabled
-            TexPerfModulation::Max       // TextureFilterOptimizationsAggressive
-        };
-
-        PAL_ASSERT(viewInfo.texOptLevel < ImageTexOptLevel::Count);
-
-        uint32 texOptLevel;
-        switch (viewInfo.texOptLevel)
-        {
-        case ImageTexOptLevel::Disabled:
-            texOptLevel = TextureFilterOptimizationsDisabled;
-            break;
-        case ImageTexOptLevel::Enabled:
-            texOptLevel = TextureFilterOptimizationsEnabled;
-            break;
-        case ImageTexOptLevel::Maximum:
-            texOptLevel = TextureFilterOptimizationsAggressive;
-            break;
-        case ImageTexOptLevel::Default:
-        default:
-            texOptLevel = static_cast<const Pal::Device*>(pDevice)->Settings().textureOptLevel;
-            break;
-        }
-
-        PAL_ASSERT(texOptLevel < ArrayLen(PanelToTexPerfMod));
-
-        TexPerfModulation perfMod = PanelToTexPerfMod[texOptLevel];
+        const TexPerfModulation perfMod = GetImageViewPerfMod(*static_cast<const Pal::Device*>(pDevice), viewInfo);
 
         srd.perf_mod = static_cast<uint32>(perfMod);
 
@@ -3156,32 +3451,7 @@ void PAL_STDCALL Device::Gfx10CreateImageViewSrds(
 
         const bool isMultiSampled = (imageCreateInfo.samples > 1);
 
-        // NOTE: Where possible, we always assume an array view type because we don't know how the shader will
-        // attempt to access the resource.
-        const ImageViewType  viewType = GetViewType(viewInfo);
-        switch (viewType)
-        {
-        case ImageViewType::Tex1d:
-            srd.type = ((imageCreateInfo.arraySize == 1) ? SQ_RSRC_IMG_1D : SQ_RSRC_IMG_1D_ARRAY);
-            break;
-        case ImageViewType::Tex2d:
-#if (PAL_CLIENT_INTERFACE_MAJOR_VERSION < 546)
-        case ImageViewType::TexQuilt: // quilted textures must be 2D
-#endif
-            srd.type = ((imageCreateInfo.arraySize == 1)
-                        ? (isMultiSampled ? SQ_RSRC_IMG_2D_MSAA       : SQ_RSRC_IMG_2D)
-                        : (isMultiSampled ? SQ_RSRC_IMG_2D_MSAA_ARRAY : SQ_RSRC_IMG_2D_ARRAY));
-            break;
-        case ImageViewType::Tex3d:
-            srd.type = SQ_RSRC_IMG_3D;
-            break;
-        case ImageViewType::TexCube:
-            srd.type = SQ_RSRC_IMG_CUBE;
-            break;
-        default:
-            PAL_ASSERT_ALWAYS();
-            break;
-        }
+        srd.type = Gfx10GetImageViewSrdType(viewInfo, imageCreateInfo);
 
         if (isMultiSampled)
         {
@@ -3344,6 +3614,31 @@ void PAL_STDCALL Device::Gfx10CreateImageViewSrds(
     }
 }
 
+// =====================================================================================================================
+// Fills out the SRD template shared by the color views of the given image, which must be bound to GPU memory. Returns
+// false if the image's views must always be built from scratch.
+bool Device::BuildColorViewSrdTemplate(
+    const Image& image,
+    ImageSrd*    pSrdTemplate
+    ) const
+{
+    const bool canUseTemplate = CanUseColorViewSrdTemplate(*image.Parent());
+
+    if (canUseTemplate)
+    {
+        if (IsGfx10(m_gfxIpLevel))
+        {
+            Gfx10BuildColorViewSrdTemplate(image, &pSrdTemplate->gfx10);
+        }
+        else
+        {
+            Gfx9BuildColorViewSrdTemplate(image, &pSrdTemplate->gfx9);
+        }
+    }
+
+    return canUseTemplate;
+}
+
 // =====================================================================================================================
 // Gfx9+ specific function for creating fmask view SRDs. Installed in the function pointer table of the parent device
 // during initialization.
@@ -4283,19 +4578,12 @@ void InitializeGpuChipProperties(
     // Setup anything specific to a given GFXIP level here
     if (pInfo->gfxLevel == GfxIpLevel::GfxIp9)
     {
-        nullBufferView.gfx9.word3.bits.TYPE = SQ_RSRC_BUF;
-        nullImageView.gfx9.word3.bits.TYPE  = SQ_RSRC_IMG_2D_ARRAY;
-
         pInfo->imageProperties.maxImageArraySize = Gfx9MaxImageArraySlices;
 
         pInfo->gfx9.supportOutOfOrderPrimitives = 1;
     }
     else if (IsGfx10(pInfo->gfxLevel))
     {
-
-        nullBufferView.gfx10.type = SQ_RSRC_BUF;
-        nullImageView.gfx10.type  = SQ_RSRC_IMG_2D_ARRAY;
-
         pInfo->imageProperties.maxImageArraySize  = Gfx10MaxImageArraySlices;
 
         // Programming of the various wave-size parameters started with GFX10 parts
@@ -4305,10 +4593,7 @@ void InitializeGpuChipProperties(
         pInfo->gfx9.supportSpiPrefPriority        = 1;
     }
 
-    pInfo->nullSrds.pNullBufferView = &nullBufferView;
-    pInfo->nullSrds.pNullImageView  = &nullImageView;
-    pInfo->nullSrds.pNullFmaskView  = &nullImageView;
-    pInfo->nullSrds.pNullSampler    = &NullSampler;
+    InitializeNullSrds(pInfo);
 
     pInfo->gfxip.numSlotsPerEvent = 1;
 
@@ -4320,6 +4605,29 @@ void InitializeGpuChipProperties(
 #endif
 }
 
+// =====================================================================================================================
+// Fills out this GFXIP level's null SRDs and points the chip properties at them. The SRDs live in this module's static
+// storage, so this must also be called when the rest of the chip properties are restored from a saved snapshot.
+void InitializeNullSrds(
+    GpuChipProperties* pInfo)
+{
+    if (pInfo->gfxLevel == GfxIpLevel::GfxIp9)
+    {
+        nullBufferView.gfx9.word3.bits.TYPE = SQ_RSRC_BUF;
+        nullImageView.gfx9.word3.bits.TYPE  = SQ_RSRC_IMG_2D_ARRAY;
+    }
+    else if (IsGfx10(pInfo->gfxLevel))
+    {
+        nullBufferView.gfx10.type = SQ_RSRC_BUF;
+        nullImageView.gfx10.type  = SQ_RSRC_IMG_2D_ARRAY;
+    }
+
+    pInfo->nullSrds.pNullBufferView = &nullBufferView;
+    pInfo->nullSrds.pNullImageView  = &nullImageView;
+    pInfo->nullSrds.pNullFmaskView  = &nullImageView;
+    pInfo->nullSrds.pNullSampler    = &NullSampler;
+}
+
 // =====================================================================================================================
 // Finalizes the GPU chip properties for a Device object, specifically for the GFX9 hardware layer. Intended to be
 // called after InitializeGpuChipProperties().
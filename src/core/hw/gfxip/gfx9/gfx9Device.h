@@ -112,6 +112,17 @@ struct SyncReqs
     };
 };
 
+// Tracks the global syncs of barriers that a command buffer has deferred so that they can be merged and issued together
+// before the next operation that depends on them.
+struct DeferredBarrierSyncs
+{
+    SyncReqs    syncReqs;       // Union of the sync reqs of every deferred barrier.
+    HwPipePoint waitPoint;      // Earliest wait point of every deferred barrier.
+    uint32      barrierCount;   // Number of barriers which have been deferred.
+    uint32      firstReason;    // Reason of the first deferred barrier.
+    size_t      unmergedDwords; // Total size of the syncs which each deferred barrier would have issued on its own.
+};
+
 enum HwLayoutTransition : uint32
 {
     None                         = 0x0,
@@ -388,6 +399,8 @@ public:
         ChNumFormat*           pFormat,
         uint32*                pPixelsPerBlock) const override;
 
+    bool BuildColorViewSrdTemplate(const Image& image, ImageSrd* pSrdTemplate) const;
+
     virtual DccFormatEncoding ComputeDccFormatEncoding(const ImageCreateInfo& imageCreateInfo) const override;
 
     // Function definition for creating typed buffer view SRDs.
@@ -469,6 +482,10 @@ public:
 
     void Barrier(GfxCmdBuffer* pCmdBuf, CmdStream* pCmdStream, const BarrierInfo& barrier) const;
 
+    bool CanDeferBarrier(const BarrierInfo& barrier) const;
+    void DeferBarrier(GfxCmdBuffer* pCmdBuf, const BarrierInfo& barrier, DeferredBarrierSyncs* pDeferred) const;
+    void IssueDeferredSyncs(GfxCmdBuffer* pCmdBuf, CmdStream* pCmdStream, DeferredBarrierSyncs* pDeferred) const;
+
     void BarrierRelease(
         GfxCmdBuffer*                 pCmdBuf,
         CmdStream*                    pCmdStream,
@@ -494,7 +511,16 @@ public:
 
     void FillCacheOperations(const SyncReqs& syncReqs, Developer::BarrierOperations* pOperations) const;
 
-    void IssueSyncs(
+    size_t BuildSyncs(
+        const GfxCmdBuffer*           pCmdBuf,
+        SyncReqs*                     pSyncReqs,
+        HwPipePoint                   waitPoint,
+        gpusize                       rangeStartAddr,
+        gpusize                       rangeSize,
+        bool*                         pIssuedAcquireMem,
+        uint32*                       pCmdSpace,
+        Developer::BarrierOperations* pOperations) const;
+    size_t IssueSyncs(
         GfxCmdBuffer*                 pCmdBuf,
         CmdStream*                    pCmdStream,
         SyncReqs                      syncReqs,
@@ -502,6 +528,11 @@ public:
         gpusize                       rangeStartAddr,
         gpusize                       rangeSize,
         Developer::BarrierOperations* pOperations) const;
+    void GetGlobalSyncReqs(
+        GfxCmdBuffer*                 pCmdBuf,
+        const GfxCmdBufferState&      cmdBufState,
+        const BarrierInfo&            barrier,
+        SyncReqs*                     pSyncReqs) const;
     void FlushAndInvL2IfNeeded(
         GfxCmdBuffer*                 pCmdBuf,
         CmdStream*                    pCmdStream,
@@ -70,9 +70,11 @@ Image::Image(
     m_fastClearEliminateMetaDataSize(0),
     m_waTcCompatZRangeMetaDataOffset(0),
     m_waTcCompatZRangeMetaDataSizePerMip(0),
-    m_useCompToSingleForFastClears(false)
+    m_useCompToSingleForFastClears(false),
+    m_colorViewSrdTemplateValid(false)
 {
     memset(&m_layoutToState,      0, sizeof(m_layoutToState));
+    memset(&m_colorViewSrdTemplate, 0, sizeof(m_colorViewSrdTemplate));
     memset(&m_defaultGfxLayout,   0, sizeof(m_defaultGfxLayout));
     memset(m_addrSurfOutput,      0, sizeof(m_addrSurfOutput));
     memset(m_addrMipOutput,       0, sizeof(m_addrMipOutput));
@@ -1933,6 +1935,13 @@ uint32 Image::GetSubresource256BAddrSwizzledHi(
     return Get256BAddrHi(imageBaseAddr);
 }
 
+// =====================================================================================================================
+// The color view SRD template bakes in the image and meta-data addresses, so it's rebuilt on every bind.
+void Image::OnGpuMemoryBound()
+{
+    m_colorViewSrdTemplateValid = m_gfxDevice.BuildColorViewSrdTemplate(*this, &m_colorViewSrdTemplate);
+}
+
 // =====================================================================================================================
 // Determines the GPU virtual address of the DCC state meta-data. Returns the GPU address of the meta-data, zero if this
 // image doesn't have the DCC state meta-data.
@@ -214,6 +214,13 @@ public:
     uint32 GetSubresource256BAddrSwizzled(SubresId subresource) const;
     uint32 GetSubresource256BAddrSwizzledHi(SubresId subresource) const;
 
+    virtual void OnGpuMemoryBound() override;
+
+    // Returns the SRD template shared by color views of this image which need no extent or address overrides, or
+    // null if every view must be built from scratch.
+    const ImageSrd* GetColorViewSrdTemplate() const
+        { return (m_colorViewSrdTemplateValid ? &m_colorViewSrdTemplate : nullptr); }
+
     virtual bool IsFastColorClearSupported(GfxCmdBuffer*      pCmdBuffer,
                                            ImageLayout        colorLayout,
                                            const uint32*      pColor,
@@ -453,6 +460,10 @@ private:
 
     bool m_useCompToSingleForFastClears;
 
+    // Image-invariant fields of a color view SRD, rebuilt each time the image is bound to GPU memory.
+    ImageSrd  m_colorViewSrdTemplate;
+    bool      m_colorViewSrdTemplateValid;
+
     // Tracks the first mip level which needs an L2 flush & invalidation under certain circumstances due to metadata
     // not being pipe-aligned all the time in hardware.  A value of UINT_MAX means no mip levels require this
     // workaround, a value of zero means all mips require it.  See InitPipeMisalignedMetadataFirstMip() for details.
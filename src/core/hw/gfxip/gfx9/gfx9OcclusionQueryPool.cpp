@@ -32,6 +32,7 @@
 #include "core/hw/gfxip/gfx9/gfx9UniversalCmdBuffer.h"
 #include "palCmdBuffer.h"
 #include "palIntervalTreeImpl.h"
+#include <atomic>
 
 using namespace Util;
 
@@ -408,43 +409,56 @@ static bool ComputeResultsForOneSlot(
     volatile const OcclusionQueryResultPair* pRbCounters,
     ResultUint*                              pOutputBuffer)
 {
-    ResultUint result     = 0;
-    bool       queryReady = true;
-
-    // Loop through all the RBs associated with this ASIC.
-    for (uint32 idx = 0; idx < numTotalRbs; idx++)
+    // The RBs will set the valid bits when they have written their data. We do not need to skip disabled RBs because
+    // they are initialized to valid with zPassData equal to zero. We will loop here for as long as necessary if the
+    // caller has requested it.
+    if (TestAnyFlagSet(flags, QueryResultWait))
     {
-        bool countersReady = false;
-
-        do
+        for (uint32 idx = 0; idx < numTotalRbs; idx++)
         {
-            // The RBs will set the valid bits when they have written their data. We do not need to skip disabled RBs
-            // because they are initialized to valid with zPassData equal to zero. We will loop here for as long as
-            // necessary if the caller has requested it.
-            countersReady = (pRbCounters[idx].begin.bits.valid == 1) && (pRbCounters[idx].end.bits.valid == 1);
+            while ((pRbCounters[idx].begin.bits.valid == 0) || (pRbCounters[idx].end.bits.valid == 0))
+            {
+            }
         }
-        while ((countersReady == false) && TestAnyFlagSet(flags, QueryResultWait));
+    }
 
-        if (countersReady)
-        {
-            result += static_cast<ResultUint>(pRbCounters[idx].end.bits.zPassData -
-                                              pRbCounters[idx].begin.bits.zPassData);
-        }
+    // Reduce the counters of all RBs in one branch-free pass so that the compiler can vectorize it. The valid bit is
+    // the top bit of each counter, so an RB is ready if the top bit of (begin & end) is set. When both valid bits are
+    // set they cancel out in (end - begin), leaving only the zPassData delta. The reads below aren't volatile, so the
+    // fence keeps them from being hoisted above the wait loop or reusing values loaded before it.
+    std::atomic_thread_fence(std::memory_order_acquire);
 
-        // The entire query will only be ready if all of its counters were ready.
-        queryReady = queryReady && countersReady;
+    const auto*const pCounters  = const_cast<const OcclusionQueryResultPair*>(pRbCounters);
+    constexpr uint64 ValidShift = 63;
+
+    uint64 result     = 0;
+    uint64 readyCount = 0;
+
+    for (uint32 idx = 0; idx < numTotalRbs; idx++)
+    {
+        const uint64 begin   = pCounters[idx].begin.data;
+        const uint64 end     = pCounters[idx].end.data;
+        const uint64 isValid = (begin & end) >> ValidShift;
+
+        result     += (end - begin) & (0 - isValid);
+        readyCount += isValid;
     }
 
+    // The entire query will only be ready if all of its counters were ready.
+    bool queryReady = (readyCount == numTotalRbs);
+
     // Store the result in the output buffer if it's legal for us to do so.
     if (queryReady || TestAnyFlagSet(flags, QueryResultPartial))
     {
+        ResultUint value = static_cast<ResultUint>(result);
+
         if (TestAnyFlagSet(flags, QueryResultAccumulate))
         {
             // Accumulate the present data; we do this first so that the if isBinary is set we still get a 0 or 1.
-            result += pOutputBuffer[0];
+            value += pOutputBuffer[0];
         }
 
-        pOutputBuffer[0] = isBinary ? (result != 0) : result;
+        pOutputBuffer[0] = isBinary ? (value != 0) : value;
     }
 
     // The caller also wants us to output whether or not the final query results were available. If we're
@@ -128,27 +128,51 @@ void PipelineChunkCs::LateInit(
     uint32*                          pThreadsPerTgZ,
     CsPipelineUploader*              pUploader)
 {
-    const auto&              cmdUtil   = m_device.CmdUtil();
-    const auto&              regInfo   = cmdUtil.GetRegInfo();
-    const GpuChipProperties& chipProps = m_device.Parent()->ChipProperties();
-
-    Abi::PipelineSymbolEntry csProgram  = { };
-    if (abiProcessor.HasPipelineSymbolEntry(Abi::PipelineSymbolType::CsMainEntry, &csProgram))
-    {
-        m_pStageInfo->codeLength  = static_cast<size_t>(csProgram.size);
-        const gpusize csProgramVa = (csProgram.value + pUploader->CodeGpuVirtAddr());
-        PAL_ASSERT(IsPow2Aligned(csProgramVa, 256u));
+    SetupRegisters(registers, wavefrontSize);
+
+    LateInitCommon(abiProcessor,
+                   pIndirectFuncList,
+                   indirectFuncCount,
+                   pThreadsPerTgX,
+                   pThreadsPerTgY,
+                   pThreadsPerTgZ,
+                   pUploader);
+}
 
-        m_regs.computePgmLo.bits.DATA = Get256BAddrLo(csProgramVa);
-        m_regs.computePgmHi.bits.DATA = Get256BAddrHi(csProgramVa);
-    }
+// =====================================================================================================================
+// Alternative to LateInit() for when the register state derived from this pipeline's ELF was found in the device's
+// pipeline register cache.  Only the state which depends on where the pipeline was uploaded is recomputed.
+template <typename CsPipelineUploader>
+void PipelineChunkCs::LateInitFromCache(
+    const AbiProcessor&              abiProcessor,
+    const HwRegInfo&                 cachedRegs,
+    ComputePipelineIndirectFuncInfo* pIndirectFuncList,
+    uint32                           indirectFuncCount,
+    uint32*                          pThreadsPerTgX,
+    uint32*                          pThreadsPerTgY,
+    uint32*                          pThreadsPerTgZ,
+    CsPipelineUploader*              pUploader)
+{
+    m_regs = cachedRegs;
+
+    LateInitCommon(abiProcessor,
+                   pIndirectFuncList,
+                   indirectFuncCount,
+                   pThreadsPerTgX,
+                   pThreadsPerTgY,
+                   pThreadsPerTgZ,
+                   pUploader);
+}
 
-    Abi::PipelineSymbolEntry csSrdTable = { };
-    if (abiProcessor.HasPipelineSymbolEntry(Abi::PipelineSymbolType::CsShdrIntrlTblPtr, &csSrdTable))
-    {
-        const gpusize csSrdTableVa = (csSrdTable.value + pUploader->DataGpuVirtAddr());
-        m_regs.userDataInternalTable.bits.DATA = LowPart(csSrdTableVa);
-    }
+// =====================================================================================================================
+// Fetches register values from the pipeline binary and determines the values of the other registers which don't depend
+// on where the pipeline is uploaded.  Everything computed here may be stored in the pipeline register cache.
+void PipelineChunkCs::SetupRegisters(
+    const RegisterVector& registers,
+    uint32                wavefrontSize)
+{
+    const auto&              regInfo   = m_device.CmdUtil().GetRegInfo();
+    const GpuChipProperties& chipProps = m_device.Parent()->ChipProperties();
 
     m_regs.computePgmRsrc1.u32All         = registers.At(mmCOMPUTE_PGM_RSRC1);
     m_regs.dynamic.computePgmRsrc2.u32All = registers.At(mmCOMPUTE_PGM_RSRC2);
@@ -176,47 +200,11 @@ void PipelineChunkCs::LateInit(
         registers.HasEntry(regInfo.mmComputeShaderChksum, &m_regs.computeShaderChksum.u32All);
     }
 
-    *pThreadsPerTgX = m_regs.computeNumThreadX.bits.NUM_THREAD_FULL;
-    *pThreadsPerTgY = m_regs.computeNumThreadY.bits.NUM_THREAD_FULL;
-    *pThreadsPerTgZ = m_regs.computeNumThreadZ.bits.NUM_THREAD_FULL;
-
-    if (pUploader->EnableLoadIndexPath())
-    {
-        m_loadPath.gpuVirtAddr = pUploader->ShRegGpuVirtAddr();
-        m_loadPath.count       = pUploader->ShRegisterCount();
-
-        pUploader->AddShReg(mmCOMPUTE_PGM_LO, m_regs.computePgmLo);
-        pUploader->AddShReg(mmCOMPUTE_PGM_HI, m_regs.computePgmHi);
-
-        pUploader->AddShReg((mmCOMPUTE_USER_DATA_0 + ConstBufTblStartReg), m_regs.userDataInternalTable);
-
-        pUploader->AddShReg(mmCOMPUTE_PGM_RSRC1,    m_regs.computePgmRsrc1);
-        pUploader->AddShReg(mmCOMPUTE_NUM_THREAD_X, m_regs.computeNumThreadX);
-        pUploader->AddShReg(mmCOMPUTE_NUM_THREAD_Y, m_regs.computeNumThreadY);
-        pUploader->AddShReg(mmCOMPUTE_NUM_THREAD_Z, m_regs.computeNumThreadZ);
-
-        if (IsGfx10(chipProps.gfxLevel))
-        {
-            pUploader->AddShReg(Gfx10::mmCOMPUTE_PGM_RSRC3, m_regs.computePgmRsrc3);
-
-            if (chipProps.gfx9.supportSpiPrefPriority != 0)
-            {
-                pUploader->AddShReg(Gfx10::mmCOMPUTE_USER_ACCUM_0, m_regs.computeUserAccum0);
-                pUploader->AddShReg(Gfx10::mmCOMPUTE_USER_ACCUM_1, m_regs.computeUserAccum1);
-                pUploader->AddShReg(Gfx10::mmCOMPUTE_USER_ACCUM_2, m_regs.computeUserAccum2);
-                pUploader->AddShReg(Gfx10::mmCOMPUTE_USER_ACCUM_3, m_regs.computeUserAccum3);
-            }
-        }
-
-        if (chipProps.gfx9.supportSpp != 0)
-        {
-            pUploader->AddShReg(regInfo.mmComputeShaderChksum, m_regs.computeShaderChksum);
-        }
-    }
-
     registers.HasEntry(mmCOMPUTE_RESOURCE_LIMITS, &m_regs.dynamic.computeResourceLimits.u32All);
 
-    const uint32 threadsPerGroup = (*pThreadsPerTgX) * (*pThreadsPerTgY) * (*pThreadsPerTgZ);
+    const uint32 threadsPerGroup = (m_regs.computeNumThreadX.bits.NUM_THREAD_FULL *
+                                    m_regs.computeNumThreadY.bits.NUM_THREAD_FULL *
+                                    m_regs.computeNumThreadZ.bits.NUM_THREAD_FULL);
     const uint32 wavesPerGroup   = RoundUpQuotient(threadsPerGroup, wavefrontSize);
 
     // SIMD_DEST_CNTL: Controls which SIMDs thread groups get scheduled on.  If the number of
@@ -265,6 +253,80 @@ void PipelineChunkCs::LateInit(
         PAL_ASSERT(settings.csSimdDestCntl == CsSimdDestCntlDefault);
         break;
     }
+}
+
+// =====================================================================================================================
+// Final stage of late initialization, shared by LateInit() and LateInitFromCache().  Patches the registers which depend
+// on where the pipeline was uploaded and uploads register state into GPU memory.
+template <typename CsPipelineUploader>
+void PipelineChunkCs::LateInitCommon(
+    const AbiProcessor&              abiProcessor,
+    ComputePipelineIndirectFuncInfo* pIndirectFuncList,
+    uint32                           indirectFuncCount,
+    uint32*                          pThreadsPerTgX,
+    uint32*                          pThreadsPerTgY,
+    uint32*                          pThreadsPerTgZ,
+    CsPipelineUploader*              pUploader)
+{
+    const auto&              cmdUtil   = m_device.CmdUtil();
+    const auto&              regInfo   = cmdUtil.GetRegInfo();
+    const GpuChipProperties& chipProps = m_device.Parent()->ChipProperties();
+
+    Abi::PipelineSymbolEntry csProgram  = { };
+    if (abiProcessor.HasPipelineSymbolEntry(Abi::PipelineSymbolType::CsMainEntry, &csProgram))
+    {
+        m_pStageInfo->codeLength  = static_cast<size_t>(csProgram.size);
+        const gpusize csProgramVa = (csProgram.value + pUploader->CodeGpuVirtAddr());
+        PAL_ASSERT(IsPow2Aligned(csProgramVa, 256u));
+
+        m_regs.computePgmLo.bits.DATA = Get256BAddrLo(csProgramVa);
+        m_regs.computePgmHi.bits.DATA = Get256BAddrHi(csProgramVa);
+    }
+
+    Abi::PipelineSymbolEntry csSrdTable = { };
+    if (abiProcessor.HasPipelineSymbolEntry(Abi::PipelineSymbolType::CsShdrIntrlTblPtr, &csSrdTable))
+    {
+        const gpusize csSrdTableVa = (csSrdTable.value + pUploader->DataGpuVirtAddr());
+        m_regs.userDataInternalTable.bits.DATA = LowPart(csSrdTableVa);
+    }
+
+    *pThreadsPerTgX = m_regs.computeNumThreadX.bits.NUM_THREAD_FULL;
+    *pThreadsPerTgY = m_regs.computeNumThreadY.bits.NUM_THREAD_FULL;
+    *pThreadsPerTgZ = m_regs.computeNumThreadZ.bits.NUM_THREAD_FULL;
+
+    if (pUploader->EnableLoadIndexPath())
+    {
+        m_loadPath.gpuVirtAddr = pUploader->ShRegGpuVirtAddr();
+        m_loadPath.count       = pUploader->ShRegisterCount();
+
+        pUploader->AddShReg(mmCOMPUTE_PGM_LO, m_regs.computePgmLo);
+        pUploader->AddShReg(mmCOMPUTE_PGM_HI, m_regs.computePgmHi);
+
+        pUploader->AddShReg((mmCOMPUTE_USER_DATA_0 + ConstBufTblStartReg), m_regs.userDataInternalTable);
+
+        pUploader->AddShReg(mmCOMPUTE_PGM_RSRC1,    m_regs.computePgmRsrc1);
+        pUploader->AddShReg(mmCOMPUTE_NUM_THREAD_X, m_regs.computeNumThreadX);
+        pUploader->AddShReg(mmCOMPUTE_NUM_THREAD_Y, m_regs.computeNumThreadY);
+        pUploader->AddShReg(mmCOMPUTE_NUM_THREAD_Z, m_regs.computeNumThreadZ);
+
+        if (IsGfx10(chipProps.gfxLevel))
+        {
+            pUploader->AddShReg(Gfx10::mmCOMPUTE_PGM_RSRC3, m_regs.computePgmRsrc3);
+
+            if (chipProps.gfx9.supportSpiPrefPriority != 0)
+            {
+                pUploader->AddShReg(Gfx10::mmCOMPUTE_USER_ACCUM_0, m_regs.computeUserAccum0);
+                pUploader->AddShReg(Gfx10::mmCOMPUTE_USER_ACCUM_1, m_regs.computeUserAccum1);
+                pUploader->AddShReg(Gfx10::mmCOMPUTE_USER_ACCUM_2, m_regs.computeUserAccum2);
+                pUploader->AddShReg(Gfx10::mmCOMPUTE_USER_ACCUM_3, m_regs.computeUserAccum3);
+            }
+        }
+
+        if (chipProps.gfx9.supportSpp != 0)
+        {
+            pUploader->AddShReg(regInfo.mmComputeShaderChksum, m_regs.computeShaderChksum);
+        }
+    }
 
     cmdUtil.BuildPipelinePrefetchPm4(*pUploader, &m_prefetch);
 
@@ -400,6 +462,17 @@ void PipelineChunkCs::LateInit<ComputePipelineUploader>(
     uint32*                          pThreadsPerTgZ,
     ComputePipelineUploader*         pUploader);
 
+template
+void PipelineChunkCs::LateInitFromCache<ComputePipelineUploader>(
+    const AbiProcessor&              abiProcessor,
+    const HwRegInfo&                 cachedRegs,
+    ComputePipelineIndirectFuncInfo* pIndirectFuncList,
+    uint32                           indirectFuncCount,
+    uint32*                          pThreadsPerTgX,
+    uint32*                          pThreadsPerTgY,
+    uint32*                          pThreadsPerTgZ,
+    ComputePipelineUploader*         pUploader);
+
 // =====================================================================================================================
 // Copies this pipeline chunk's sh commands into the specified command space. Returns the next unused DWORD in
 // pCmdSpace.
@@ -119,6 +119,17 @@ public:
         uint32*                          pThreadsPerTgZ,
         CsPipelineUploader*              pUploader);
 
+    template <typename CsPipelineUploader>
+    void LateInitFromCache(
+        const AbiProcessor&              abiProcessor,
+        const HwRegInfo&                 cachedRegs,
+        ComputePipelineIndirectFuncInfo* pIndirectFuncList,
+        uint32                           indirectFuncCount,
+        uint32*                          pThreadsPerTgX,
+        uint32*                          pThreadsPerTgY,
+        uint32*                          pThreadsPerTgZ,
+        CsPipelineUploader*              pUploader);
+
     uint32* WriteShCommands(
         CmdStream*                      pCmdStream,
         uint32*                         pCmdSpace,
@@ -136,6 +147,20 @@ public:
         regCOMPUTE_PGM_RSRC3 Rsrc3);
 
 private:
+    void SetupRegisters(
+        const RegisterVector& registers,
+        uint32                wavefrontSize);
+
+    template <typename CsPipelineUploader>
+    void LateInitCommon(
+        const AbiProcessor&              abiProcessor,
+        ComputePipelineIndirectFuncInfo* pIndirectFuncList,
+        uint32                           indirectFuncCount,
+        uint32*                          pThreadsPerTgX,
+        uint32*                          pThreadsPerTgY,
+        uint32*                          pThreadsPerTgZ,
+        CsPipelineUploader*              pUploader);
+
     uint32* WriteShCommandsSetPath(CmdStream* pCmdStream, uint32* pCmdSpace) const;
 
     const Device&  m_device;
@@ -30,6 +30,7 @@
 #include "core/hw/gfxip/gfx9/gfx9Device.h"
 #include "core/hw/gfxip/gfx9/gfx9PipelineStatsQueryPool.h"
 #include "palCmdBuffer.h"
+#include <atomic>
 
 using namespace Util;
 
@@ -104,15 +105,19 @@ PipelineStatsQueryPool::PipelineStatsQueryPool(
     m_device(device),
     m_numEnabledStats(0)
 {
+    static_assert(MaxNumCounters == PipelineStatsMaxNumCounters, "Pipeline stats counter count mismatch!");
+
     PAL_ASSERT(m_createInfo.enabledStats != 0);
 
-    // Compute the number of pipeline stats that are enabled by counting enable bits.
-    constexpr uint32 LastMask = 1 << (PipelineStatsMaxNumCounters - 1);
-    for (uint32 enableMask = 1; enableMask <= LastMask; enableMask <<= 1)
+    // Compute the number of pipeline stats that are enabled and remember where their counters live so that
+    // ComputeResults doesn't need to filter the layout for every slot.
+    memset(m_enabledCounterOffsets, 0, sizeof(m_enabledCounterOffsets));
+
+    for (uint32 layoutIdx = 0; layoutIdx < PipelineStatsMaxNumCounters; ++layoutIdx)
     {
-        if (TestAnyFlagSet(m_createInfo.enabledStats, enableMask))
+        if (TestAnyFlagSet(m_createInfo.enabledStats, PipelineStatsLayout[layoutIdx].statFlag))
         {
-            m_numEnabledStats++;
+            m_enabledCounterOffsets[m_numEnabledStats++] = PipelineStatsLayout[layoutIdx].counterOffset;
         }
     }
 }
@@ -402,47 +407,52 @@ size_t PipelineStatsQueryPool::GetResultSizeForOneSlot(
 template <typename ResultUint>
 static bool ComputeResultsForOneSlot(
     QueryResultFlags       resultFlags,
-    uint32                 enableStatsFlags,
+    uint32                 numStatsEnabled,
+    const uint32*          pCounterOffsets,
     volatile const uint64* pBeginCounters,
     volatile const uint64* pEndCounters,
     ResultUint*            pOutputBuffer)
 {
-    // Unless QueryResultPartial is set, we can't touch the destination buffer if some results aren't ready. We will
-    // store our results in here until we know whether or not it's safe to write to the output buffer.
-    ResultUint results[PipelineStatsMaxNumCounters] = {};
-    uint32     numStatsEnabled = 0;
-    bool       queryReady      = true;
-
-    for (uint32 layoutIdx = 0; layoutIdx < PipelineStatsMaxNumCounters; ++layoutIdx)
+    // If the initial value is still in one of the counters it implies that the query hasn't finished yet. We will loop
+    // here for as long as necessary if the caller has requested it.
+    if (TestAnyFlagSet(resultFlags, QueryResultWait))
     {
-        // Filter out stats that are not enabled for this pool.
-        if (TestAnyFlagSet(enableStatsFlags, PipelineStatsLayout[layoutIdx].statFlag))
+        for (uint32 idx = 0; idx < numStatsEnabled; ++idx)
         {
-            const uint32 counterOffset = PipelineStatsLayout[layoutIdx].counterOffset;
-            bool         countersReady = false;
+            const uint32 counterOffset = pCounterOffsets[idx];
 
-            do
+            while ((pBeginCounters[counterOffset] == PipelineStatsResetMemValue64) ||
+                   (pEndCounters[counterOffset]   == PipelineStatsResetMemValue64))
             {
-                // If the initial value is still in one of the counters it implies that the query hasn't finished yet.
-                // We will loop here for as long as necessary if the caller has requested it.
-                countersReady = ((pBeginCounters[counterOffset] != PipelineStatsResetMemValue64) &&
-                                 (pEndCounters[counterOffset]   != PipelineStatsResetMemValue64));
             }
-            while ((countersReady == false) && TestAnyFlagSet(resultFlags, QueryResultWait));
+        }
+    }
 
-            if (countersReady)
-            {
-                results[numStatsEnabled] = static_cast<ResultUint>(pEndCounters[counterOffset] -
-                                                                   pBeginCounters[counterOffset]);
-            }
+    // Unless QueryResultPartial is set, we can't touch the destination buffer if some results aren't ready. We will
+    // store our results in here until we know whether or not it's safe to write to the output buffer.
+    ResultUint results[PipelineStatsMaxNumCounters] = {};
+    uint32     readyCount = 0;
 
-            // The entire query will only be ready if all of its counters were ready.
-            queryReady = queryReady && countersReady;
+    // Compute the begin/end deltas of all enabled counters in one branch-free pass. The reads below aren't volatile, so
+    // the fence keeps them from being hoisted above the wait loop or reusing values loaded before it.
+    std::atomic_thread_fence(std::memory_order_acquire);
 
-            numStatsEnabled++;
-        }
+    const uint64*const pBegin = const_cast<const uint64*>(pBeginCounters);
+    const uint64*const pEnd   = const_cast<const uint64*>(pEndCounters);
+
+    for (uint32 idx = 0; idx < numStatsEnabled; ++idx)
+    {
+        const uint64 begin         = pBegin[pCounterOffsets[idx]];
+        const uint64 end           = pEnd[pCounterOffsets[idx]];
+        const uint32 countersReady = (begin != PipelineStatsResetMemValue64) & (end != PipelineStatsResetMemValue64);
+
+        results[idx] = static_cast<ResultUint>((end - begin) & (0 - static_cast<uint64>(countersReady)));
+        readyCount  += countersReady;
     }
 
+    // The entire query will only be ready if all of its counters were ready.
+    bool queryReady = (readyCount == numStatsEnabled);
+
     // Store the results in the output buffer if it's legal for us to do so.
     if (queryReady || TestAnyFlagSet(resultFlags, QueryResultPartial))
     {
@@ -494,8 +504,18 @@ bool PipelineStatsQueryPool::ComputeResults(
         const uint64*    pEnd     = reinterpret_cast<const uint64*>(&pGpuPair->end);
 
         const bool queryReady = ((TestAnyFlagSet(flags, QueryResult64Bit))
-            ? ComputeResultsForOneSlot(flags, m_createInfo.enabledStats, pBegin, pEnd, static_cast<uint64*>(pData))
-            : ComputeResultsForOneSlot(flags, m_createInfo.enabledStats, pBegin, pEnd, static_cast<uint32*>(pData)));
+            ? ComputeResultsForOneSlot(flags,
+                                       m_numEnabledStats,
+                                       m_enabledCounterOffsets,
+                                       pBegin,
+                                       pEnd,
+                                       static_cast<uint64*>(pData))
+            : ComputeResultsForOneSlot(flags,
+                                       m_numEnabledStats,
+                                       m_enabledCounterOffsets,
+                                       pBegin,
+                                       pEnd,
+                                       static_cast<uint32*>(pData)));
 
         allQueriesReady = allQueriesReady && queryReady;
         pGpuData        = VoidPtrInc(pGpuData, GetGpuResultSizeInBytes(1));
@@ -88,8 +88,12 @@ protected:
         void*            pData) override;
 
 private:
+    // Number of 64-bit counters the hardware writes for each begin or end sample.
+    static constexpr uint32 MaxNumCounters = 11;
+
     const Device& m_device;
     uint32        m_numEnabledStats;
+    uint32        m_enabledCounterOffsets[MaxNumCounters]; // QWORD offsets of the enabled counters, in client order.
 
     PAL_DISALLOW_COPY_AND_ASSIGN(PipelineStatsQueryPool);
     PAL_DISALLOW_DEFAULT_CTOR(PipelineStatsQueryPool);
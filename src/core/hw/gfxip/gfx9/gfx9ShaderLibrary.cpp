@@ -164,7 +164,7 @@ Result ShaderLibrary::GetShaderFunctionCode(
         // To extract the shader code, we can re-parse the saved ELF binary and lookup the shader's program
         // instructions by examining the symbol table entry for that shader's entrypoint.
         AbiProcessor abiProcessor(m_pDevice->GetPlatform());
-        result = abiProcessor.LoadFromBuffer(m_pCodeObjectBinary, m_codeObjectBinaryLen);
+        result = abiProcessor.LoadFromBufferView(m_pCodeObjectBinary, m_codeObjectBinaryLen);
         if (result == Result::Success)
         {
             Abi::GenericSymbolEntry symbol = { };
@@ -208,7 +208,6 @@ Result ShaderLibrary::GetShaderFunctionStats(
 
     // We can re-parse the saved pipeline ELF binary to extract shader statistics.
     AbiProcessor abiProcessor(m_pDevice->GetPlatform());
-    result = abiProcessor.LoadFromBuffer(m_pCodeObjectBinary, m_codeObjectBinaryLen);
 
     const auto&  gpuInfo       = m_pDevice->Parent()->ChipProperties();
 
@@ -218,7 +217,7 @@ Result ShaderLibrary::GetShaderFunctionStats(
     pShaderStats->palInternalLibraryHash       = m_info.internalLibraryHash;
     pShaderStats->common.ldsSizePerThreadGroup = chipProps.gfxip.ldsSizePerThreadGroup;
 
-    result = abiProcessor.LoadFromBuffer(m_pCodeObjectBinary, m_codeObjectBinaryLen);
+    result = abiProcessor.LoadFromBufferView(m_pCodeObjectBinary, m_codeObjectBinaryLen);
     if (result == Result::Success)
     {
         Abi::GenericSymbolEntry symbol = { };
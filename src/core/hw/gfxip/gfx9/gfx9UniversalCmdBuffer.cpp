@@ -294,6 +294,7 @@ UniversalCmdBuffer::UniversalCmdBuffer(
     memset(&m_drawTimeHwState, 0, sizeof(m_drawTimeHwState));
     memset(&m_nggState,        0, sizeof(m_nggState));
     memset(&m_currentBinSize,  0, sizeof(m_currentBinSize));
+    memset(&m_deferredSyncs,   0, sizeof(m_deferredSyncs));
 
     memset(&m_pipelinePsHash, 0, sizeof(m_pipelinePsHash));
     m_pipelineFlags.u32All = 0;
@@ -334,6 +335,7 @@ UniversalCmdBuffer::UniversalCmdBuffer(
     m_cachedSettings.rbPlusSupported           = m_device.Parent()->ChipProperties().gfx9.rbPlus;
 
     m_cachedSettings.waUtcL0InconsistentBigPage = settings.waUtcL0InconsistentBigPage;
+    m_cachedSettings.barrierCoalescing          = settings.enableBarrierCoalescing;
 
     // Here we pre-calculate constants used in gfx10 PBB bin sizing calculations.
     // The logic is based on formulas that account for the number of RBs and Channels on the ASIC.
@@ -597,6 +599,8 @@ void UniversalCmdBuffer::ResetState()
     SetUserDataValidationFunctions(false, false, false);
     SwitchDrawFunctions(false, false);
 
+    memset(&m_deferredSyncs, 0, sizeof(m_deferredSyncs));
+
     m_vgtDmaIndexType.u32All = 0;
     m_vgtDmaIndexType.bits.SWAP_MODE  = VGT_DMA_SWAP_NONE;
     m_vgtDmaIndexType.bits.INDEX_TYPE = VgtIndexTypeLookup[0];
@@ -1282,11 +1286,35 @@ void UniversalCmdBuffer::CmdBarrier(
 {
     CmdBuffer::CmdBarrier(barrierInfo);
 
+    if (m_cachedSettings.barrierCoalescing && m_device.CanDeferBarrier(barrierInfo))
+    {
+        // This barrier only needs global syncs, so merge them with those of any neighboring barriers. They will be
+        // issued together before the next command which could depend on them.
+        m_device.DeferBarrier(this, barrierInfo, &m_deferredSyncs);
+    }
+    else
+    {
+        FlushDeferredBarriers();
+
+        // Barriers do not honor predication.
+        const uint32 packetPredicate = m_gfxCmdBufState.flags.packetPredicate;
+        m_gfxCmdBufState.flags.packetPredicate = 0;
+
+        m_device.Barrier(this, &m_deCmdStream, barrierInfo);
+
+        m_gfxCmdBufState.flags.packetPredicate = packetPredicate;
+    }
+}
+
+// =====================================================================================================================
+// Issues the merged syncs of all barriers which have been deferred since the last flush.
+void UniversalCmdBuffer::IssueDeferredBarriers()
+{
     // Barriers do not honor predication.
     const uint32 packetPredicate = m_gfxCmdBufState.flags.packetPredicate;
     m_gfxCmdBufState.flags.packetPredicate = 0;
 
-    m_device.Barrier(this, &m_deCmdStream, barrierInfo);
+    m_device.IssueDeferredSyncs(this, &m_deCmdStream, &m_deferredSyncs);
 
     m_gfxCmdBufState.flags.packetPredicate = packetPredicate;
 }
@@ -1296,6 +1324,8 @@ void UniversalCmdBuffer::CmdRelease(
     const AcquireReleaseInfo& releaseInfo,
     const IGpuEvent*          pGpuEvent)
 {
+    FlushDeferredBarriers();
+
     CmdBuffer::CmdRelease(releaseInfo, pGpuEvent);
 
     // Barriers do not honor predication.
@@ -1321,6 +1351,8 @@ void UniversalCmdBuffer::CmdAcquire(
     uint32                    gpuEventCount,
     const IGpuEvent*const*    ppGpuEvents)
 {
+    FlushDeferredBarriers();
+
     CmdBuffer::CmdAcquire(acquireInfo, gpuEventCount, ppGpuEvents);
 
     // Barriers do not honor predication.
@@ -1344,6 +1376,8 @@ void UniversalCmdBuffer::CmdAcquire(
 void UniversalCmdBuffer::CmdReleaseThenAcquire(
     const AcquireReleaseInfo& barrierInfo)
 {
+    FlushDeferredBarriers();
+
     CmdBuffer::CmdReleaseThenAcquire(barrierInfo);
 
     // Barriers do not honor predication.
@@ -2603,6 +2637,8 @@ void PAL_STDCALL UniversalCmdBuffer::CmdDispatch(
 {
     auto* pThis = static_cast<UniversalCmdBuffer*>(pCmdBuffer);
 
+    pThis->FlushDeferredBarriers();
+
     if (DescribeDrawDispatch)
     {
         pThis->m_device.DescribeDispatch(pThis, Developer::DrawDispatchType::CmdDispatch, 0, 0, 0, x, y, z);
@@ -2640,6 +2676,8 @@ void PAL_STDCALL UniversalCmdBuffer::CmdDispatchIndirect(
 {
     auto* pThis = static_cast<UniversalCmdBuffer*>(pCmdBuffer);
 
+    pThis->FlushDeferredBarriers();
+
     if (DescribeDrawDispatch)
     {
         pThis->m_device.DescribeDispatch(pThis, Developer::DrawDispatchType::CmdDispatchIndirect, 0, 0, 0, 0, 0, 0);
@@ -2690,6 +2728,8 @@ void PAL_STDCALL UniversalCmdBuffer::CmdDispatchOffset(
 {
     auto* pThis = static_cast<UniversalCmdBuffer*>(pCmdBuffer);
 
+    pThis->FlushDeferredBarriers();
+
     if (DescribeDrawDispatch)
     {
         pThis->m_device.DescribeDispatch(pThis, Developer::DrawDispatchType::CmdDispatchOffset,
@@ -2735,6 +2775,8 @@ void UniversalCmdBuffer::CmdCloneImageData(
     const IImage& srcImage,
     const IImage& dstImage)
 {
+    FlushDeferredBarriers();
+
     m_device.RsrcProcMgr().CmdCloneImageData(this, GetGfx9Image(srcImage), GetGfx9Image(dstImage));
 }
 
@@ -2745,6 +2787,8 @@ void UniversalCmdBuffer::CmdCopyMemory(
     uint32                  regionCount,
     const MemoryCopyRegion* pRegions)
 {
+    FlushDeferredBarriers();
+
     m_device.RsrcProcMgr().CmdCopyMemory(this,
                                          static_cast<const GpuMemory&>(srcGpuMemory),
                                          static_cast<const GpuMemory&>(dstGpuMemory),
@@ -2759,6 +2803,8 @@ void UniversalCmdBuffer::CmdUpdateMemory(
     gpusize           dataSize,
     const uint32*     pData)
 {
+    FlushDeferredBarriers();
+
     PAL_ASSERT(pData != nullptr);
     m_device.RsrcProcMgr().CmdUpdateMemory(this,
                                            static_cast<const GpuMemory&>(dstGpuMemory),
@@ -2773,6 +2819,8 @@ void UniversalCmdBuffer::CmdUpdateBusAddressableMemoryMarker(
     gpusize           offset,
     uint32            value)
 {
+    FlushDeferredBarriers();
+
     const GpuMemory* pGpuMemory = static_cast<const GpuMemory*>(&dstGpuMemory);
     WriteDataInfo    writeData  = {};
 
@@ -2794,6 +2842,8 @@ void UniversalCmdBuffer::CmdMemoryAtomic(
     uint64            srcData,
     AtomicOp          atomicOp)
 {
+    FlushDeferredBarriers();
+
     const gpusize address = dstGpuMemory.Desc().gpuVirtAddr + dstOffset;
 
     uint32* pDeCmdSpace = m_deCmdStream.ReserveCommands();
@@ -2809,6 +2859,8 @@ void UniversalCmdBuffer::CmdWriteTimestamp(
     const IGpuMemory& dstGpuMemory,
     gpusize           dstOffset)
 {
+    FlushDeferredBarriers();
+
     const gpusize address = dstGpuMemory.Desc().gpuVirtAddr + dstOffset;
 
     uint32* pDeCmdSpace = m_deCmdStream.ReserveCommands();
@@ -2850,6 +2902,8 @@ void UniversalCmdBuffer::CmdWriteImmediate(
     ImmediateDataWidth dataSize,
     gpusize            address)
 {
+    FlushDeferredBarriers();
+
     uint32* pDeCmdSpace = m_deCmdStream.ReserveCommands();
 
     if (pipePoint == HwPipeTop)
@@ -3311,6 +3365,7 @@ Result UniversalCmdBuffer::AddPreamble()
 // Adds a postamble to the end of a new command buffer.
 Result UniversalCmdBuffer::AddPostamble()
 {
+    FlushDeferredBarriers();
 
     uint32* pDeCmdSpace = m_deCmdStream.ReserveCommands();
 
@@ -3412,6 +3467,8 @@ void UniversalCmdBuffer::BeginExecutionMarker(
 // =====================================================================================================================
 uint32 UniversalCmdBuffer::CmdInsertExecutionMarker()
 {
+    FlushDeferredBarriers();
+
     uint32 returnVal = UINT_MAX;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 533
     if (m_buildFlags.enableExecutionMarkerSupport == 1)
@@ -3453,6 +3510,8 @@ void UniversalCmdBuffer::WriteEventCmd(
     HwPipePoint           pipePoint,
     uint32                data)
 {
+    FlushDeferredBarriers();
+
     const EngineType  engineType = GetEngineType();
 
     uint32* pDeCmdSpace = m_deCmdStream.ReserveCommands();
@@ -3548,6 +3607,8 @@ void UniversalCmdBuffer::WriteEventCmd(
 CmdStream* UniversalCmdBuffer::GetCmdStreamByEngine(
     uint32 engineType) // Mask of Engine types as defined in gfxCmdBufer.h
 {
+    FlushDeferredBarriers();
+
     return TestAnyFlagSet(m_engineSupport, engineType) ? &m_deCmdStream : nullptr;
 }
 
@@ -4354,10 +4415,10 @@ uint32* UniversalCmdBuffer::ValidateGraphicsUserDataCpu(
         // Re-upload spill table contents if necessary, and write the new GPU virtual address to the user-SGPR(s).
         if (reUpload)
         {
-            UpdateUserDataTableCpu(&m_spillTable.stateGfx,
-                                   (userDataLimit - spillThreshold),
-                                   spillThreshold,
-                                   &m_graphicsState.gfxUserDataEntries.entries[0]);
+            UpdateSpillTableCpu(&m_spillTable.stateGfx,
+                                (userDataLimit - spillThreshold),
+                                spillThreshold,
+                                &m_graphicsState.gfxUserDataEntries.entries[0]);
         }
 
         // NOTE: If the pipeline is changing, we may need to re-write the spill table address to any shader stage, even
@@ -4537,10 +4598,10 @@ uint32* UniversalCmdBuffer::ValidateComputeUserDataCpu(
         // Re-upload spill table contents if necessary.
         if (reUpload)
         {
-            UpdateUserDataTableCpu(&m_spillTable.stateCs,
-                                   (userDataLimit - spillThreshold),
-                                   spillThreshold,
-                                   &m_computeState.csUserDataEntries.entries[0]);
+            UpdateSpillTableCpu(&m_spillTable.stateCs,
+                                (userDataLimit - spillThreshold),
+                                spillThreshold,
+                                &m_computeState.csUserDataEntries.entries[0]);
         }
 
         // Step #4:
@@ -4572,6 +4633,8 @@ template <bool Indexed, bool Indirect>
 void UniversalCmdBuffer::ValidateDraw(
     const ValidateDrawInfo& drawInfo)      // Draw info
 {
+    FlushDeferredBarriers();
+
     if (m_deCmdStream.Pm4OptimizerEnabled())
     {
         ValidateDraw<Indexed, Indirect, true>(drawInfo);
@@ -6697,6 +6760,8 @@ void UniversalCmdBuffer::RemoveQuery(
 void UniversalCmdBuffer::CmdLoadBufferFilledSizes(
     const gpusize (&gpuVirtAddr)[MaxStreamOutTargets])
 {
+    FlushDeferredBarriers();
+
     uint32* pDeCmdSpace = m_deCmdStream.ReserveCommands();
 
     for (uint32 idx = 0; idx < MaxStreamOutTargets; ++idx)
@@ -6720,6 +6785,8 @@ void UniversalCmdBuffer::CmdLoadBufferFilledSizes(
 void UniversalCmdBuffer::CmdSaveBufferFilledSizes(
     const gpusize (&gpuVirtAddr)[MaxStreamOutTargets])
 {
+    FlushDeferredBarriers();
+
     uint32* pDeCmdSpace = m_deCmdStream.ReserveCommands();
 
     // The VGT's internal stream output state needs to be flushed before writing the buffer filled size counters
@@ -6747,6 +6814,8 @@ void UniversalCmdBuffer::CmdSetBufferFilledSize(
     uint32  bufferId,
     uint32  offset)
 {
+    FlushDeferredBarriers();
+
     uint32* pDeCmdSpace = m_deCmdStream.ReserveCommands();
     PAL_ASSERT(bufferId < MaxStreamOutTargets);
 
@@ -6767,6 +6836,8 @@ void UniversalCmdBuffer::CmdBeginQuery(
     uint32            slot,
     QueryControlFlags flags)
 {
+    FlushDeferredBarriers();
+
     static_cast<const QueryPool&>(queryPool).Begin(this, &m_deCmdStream, queryType, slot, flags);
 }
 
@@ -6776,6 +6847,8 @@ void UniversalCmdBuffer::CmdEndQuery(
     QueryType         queryType,
     uint32            slot)
 {
+    FlushDeferredBarriers();
+
     static_cast<const QueryPool&>(queryPool).End(this, &m_deCmdStream, queryType, slot);
 }
 
@@ -6790,6 +6863,8 @@ void UniversalCmdBuffer::CmdResolveQuery(
     gpusize           dstOffset,
     gpusize           dstStride)
 {
+    FlushDeferredBarriers();
+
     // Resolving a query is not supposed to honor predication.
     const uint32 packetPredicate = m_gfxCmdBufState.flags.packetPredicate;
     m_gfxCmdBufState.flags.packetPredicate = 0;
@@ -6813,6 +6888,8 @@ void UniversalCmdBuffer::CmdResetQueryPool(
     uint32            startQuery,
     uint32            queryCount)
 {
+    FlushDeferredBarriers();
+
     static_cast<const QueryPool&>(queryPool).Reset(this, &m_deCmdStream, startQuery, queryCount);
 }
 
@@ -7257,6 +7334,8 @@ void UniversalCmdBuffer::CmdLoadCeRam(
     uint32            ramOffset,        // CE RAM offset, must be 32-byte aligned
     uint32            dwordSize)        // Number of DWORDs to load, must be a multiple of 8
 {
+    FlushDeferredBarriers();
+
     uint32* pCeCmdSpace = m_ceCmdStream.ReserveCommands();
     pCeCmdSpace += CmdUtil::BuildLoadConstRam(srcGpuMemory.Desc().gpuVirtAddr + memOffset,
                                               (ReservedCeRamBytes + ramOffset),
@@ -7275,6 +7354,8 @@ void UniversalCmdBuffer::CmdDumpCeRam(
     uint32            currRingPos,
     uint32            ringSize)
 {
+    FlushDeferredBarriers();
+
     uint32* pCeCmdSpace = m_ceCmdStream.ReserveCommands();
     HandleCeRinging(&m_state, currRingPos, 1, ringSize);
 
@@ -7303,6 +7384,8 @@ void UniversalCmdBuffer::CmdWriteCeRam(
     uint32      ramOffset,      // CE RAM byte offset, must be 4-byte aligned
     uint32      dwordSize)      // Number of DWORDs to write from pSrcData
 {
+    FlushDeferredBarriers();
+
     uint32* pCeCmdSpace = m_ceCmdStream.ReserveCommands();
     pCeCmdSpace += CmdUtil::BuildWriteConstRam(pSrcData, (ReservedCeRamBytes + ramOffset), dwordSize, pCeCmdSpace);
     m_ceCmdStream.CommitCommands(pCeCmdSpace);
@@ -7316,6 +7399,8 @@ void UniversalCmdBuffer::CmdIf(
     uint64            mask,
     CompareFunc       compareFunc)
 {
+    FlushDeferredBarriers();
+
     // CE and nested command buffers don't support control flow yet.
     PAL_ASSERT(m_ceCmdStream.IsEmpty() && (IsNested() == false));
 
@@ -7325,6 +7410,8 @@ void UniversalCmdBuffer::CmdIf(
 // =====================================================================================================================
 void UniversalCmdBuffer::CmdElse()
 {
+    FlushDeferredBarriers();
+
     // CE and nested command buffers don't support control flow yet.
     PAL_ASSERT(m_ceCmdStream.IsEmpty() && (IsNested() == false));
 
@@ -7334,6 +7421,8 @@ void UniversalCmdBuffer::CmdElse()
 // =====================================================================================================================
 void UniversalCmdBuffer::CmdEndIf()
 {
+    FlushDeferredBarriers();
+
     // CE and nested command buffers don't support control flow yet.
     PAL_ASSERT(m_ceCmdStream.IsEmpty() && (IsNested() == false));
 
@@ -7348,6 +7437,8 @@ void UniversalCmdBuffer::CmdWhile(
     uint64            mask,
     CompareFunc       compareFunc)
 {
+    FlushDeferredBarriers();
+
     // CE and nested command buffers don't support control flow yet.
     PAL_ASSERT(m_ceCmdStream.IsEmpty() && (IsNested() == false));
 
@@ -7357,6 +7448,8 @@ void UniversalCmdBuffer::CmdWhile(
 // =====================================================================================================================
 void UniversalCmdBuffer::CmdEndWhile()
 {
+    FlushDeferredBarriers();
+
     // CE and nested command buffers don't support control flow yet.
     PAL_ASSERT(m_ceCmdStream.IsEmpty() && (IsNested() == false));
 
@@ -7366,18 +7459,24 @@ void UniversalCmdBuffer::CmdEndWhile()
 // =====================================================================================================================
 void UniversalCmdBuffer::CmdFlglEnable()
 {
+    FlushDeferredBarriers();
+
     SendFlglSyncCommands(FlglRegSeqSwapreadyReset);
 }
 
 // =====================================================================================================================
 void UniversalCmdBuffer::CmdFlglDisable()
 {
+    FlushDeferredBarriers();
+
     SendFlglSyncCommands(FlglRegSeqSwapreadySet);
 }
 
 // =====================================================================================================================
 void UniversalCmdBuffer::CmdFlglSync()
 {
+    FlushDeferredBarriers();
+
     // make sure (wait that) the swap req line is low
     SendFlglSyncCommands(FlglRegSeqSwaprequestReadLow);
     // pull the swap grant line low as we are done rendering
@@ -7441,6 +7540,8 @@ void UniversalCmdBuffer::CmdWaitRegisterValue(
     uint32      mask,
     CompareFunc compareFunc)
 {
+    FlushDeferredBarriers();
+
     uint32* pCmdSpace = m_deCmdStream.ReserveCommands();
 
     pCmdSpace += CmdUtil::BuildWaitRegMem(EngineTypeUniversal,
@@ -7463,6 +7564,8 @@ void UniversalCmdBuffer::CmdWaitMemoryValue(
     uint32            mask,
     CompareFunc       compareFunc)
 {
+    FlushDeferredBarriers();
+
     uint32* pCmdSpace = m_deCmdStream.ReserveCommands();
 
     pCmdSpace += CmdUtil::BuildWaitRegMem(EngineTypeUniversal,
@@ -7484,6 +7587,8 @@ void UniversalCmdBuffer::CmdWaitBusAddressableMemoryMarker(
     uint32            mask,
     CompareFunc       compareFunc)
 {
+    FlushDeferredBarriers();
+
     const GpuMemory* pGpuMemory = static_cast<const GpuMemory*>(&gpuMemory);
     uint32* pCmdSpace = m_deCmdStream.ReserveCommands();
 
@@ -7618,6 +7723,8 @@ void UniversalCmdBuffer::CmdSetPredication(
     bool                waitResults,
     bool                accumulateData)
 {
+    FlushDeferredBarriers();
+
     PAL_ASSERT((pQueryPool == nullptr) || (pGpuMemory == nullptr));
     PAL_ASSERT(
         (predType != PredicateType::Boolean32) ||
@@ -7663,6 +7770,8 @@ void UniversalCmdBuffer::CmdCopyRegisterToMemory(
     const IGpuMemory& dstGpuMemory,
     gpusize           dstOffset)
 {
+    FlushDeferredBarriers();
+
     uint32* pCmdSpace = m_deCmdStream.ReserveCommands();
 
     DmaDataInfo dmaData = {};
@@ -7687,6 +7796,8 @@ void UniversalCmdBuffer::CmdExecuteIndirectCmds(
     uint32                       maximumCount,
     gpusize                      countGpuAddr)
 {
+    FlushDeferredBarriers();
+
     // It is only safe to generate indirect commands on a one-time-submit or exclusive-submit command buffer because
     // there is a potential race condition on the memory used to receive the generated commands.
     PAL_ASSERT(IsOneTimeSubmit() || IsExclusiveSubmit());
@@ -8253,6 +8364,8 @@ void UniversalCmdBuffer::CmdSetClipRects(
 // =====================================================================================================================
 void UniversalCmdBuffer::CmdXdmaWaitFlipPending()
 {
+    FlushDeferredBarriers();
+
     // Note that we only have an auto-generated version of this register for Vega 12 but it should exist on all ASICs.
     CmdWaitRegisterValue(Vg12::mmXDMA_SLV_FLIP_PENDING, 0, 0x00000001, CompareFunc::Equal);
 }
@@ -8262,6 +8375,8 @@ void UniversalCmdBuffer::CmdExecuteNestedCmdBuffers(
     uint32            cmdBufferCount,
     ICmdBuffer*const* ppCmdBuffers)
 {
+    FlushDeferredBarriers();
+
     // Need to validate some state as it is valid for root CmdBuf to set state, not issue a draw and expect
     // that state to inherit into the nested CmdBuf. It might be safest to just ValidateDraw here eventually.
     // That would break the assumption that the Pipeline is bound at draw-time.
@@ -8290,6 +8405,13 @@ void UniversalCmdBuffer::CmdExecuteNestedCmdBuffers(
     }
     m_deCmdStream.CommitCommands(pDeCmdSpace);
 
+#if PAL_BUILD_PM4_INSTRUMENTOR
+    uint32 reusedCount   = 0;
+    uint32 copiedCount   = 0;
+    uint32 reusedCmdSize = 0;
+    uint32 copiedCmdSize = 0;
+#endif
+
     for (uint32 buf = 0; buf < cmdBufferCount; ++buf)
     {
         auto*const pCallee = static_cast<Gfx9::UniversalCmdBuffer*>(ppCmdBuffers[buf]);
@@ -8300,7 +8422,13 @@ void UniversalCmdBuffer::CmdExecuteNestedCmdBuffers(
 
         // All user-data entries have been uploaded into CE RAM and GPU memory, so we can safely "call" the nested
         // command buffer's command streams.
-
+        //
+        // The callee's commands already live in GPU memory, so they are launched in place through an IB2 (or chained
+        // to, for exclusive-submit callees) unless something forces us to copy them:
+        //  - The client set disallowNestedLaunchViaIb2 on a callee which isn't exclusive-submit.
+        //  - Before Gfx10, callees which contain indirect draws are never launched through an IB2.
+        //  - waCeDisableIb2 keeps the CE stream from using an IB2; the DE stream can still use one.
+        // Whether the callee depends on any state inherited from this command buffer doesn't change any of these.
         const bool exclusiveSubmit  = pCallee->IsExclusiveSubmit();
         const bool allowIb2Launch   = (pCallee->AllowLaunchViaIb2() &&
                                        ((pCallee->m_state.flags.containsDrawIndirect == 0) ||
@@ -8312,13 +8440,53 @@ void UniversalCmdBuffer::CmdExecuteNestedCmdBuffers(
         m_deCmdStream.TrackNestedCommands(pCallee->m_deCmdStream);
         m_ceCmdStream.TrackNestedCommands(pCallee->m_ceCmdStream);
 
+#if PAL_BUILD_PM4_INSTRUMENTOR
+        const uint32 callerCmdSize = (m_cachedSettings.enablePm4Instrumentation != 0)
+                                     ? (m_deCmdStream.GetUsedCmdMemorySize() + m_ceCmdStream.GetUsedCmdMemorySize())
+                                     : 0;
+#endif
+
         m_deCmdStream.Call(pCallee->m_deCmdStream, exclusiveSubmit, allowIb2Launch);
         m_ceCmdStream.Call(pCallee->m_ceCmdStream, exclusiveSubmit, allowIb2LaunchCe);
 
+#if PAL_BUILD_PM4_INSTRUMENTOR
+        if (m_cachedSettings.enablePm4Instrumentation != 0)
+        {
+            // Anything the callee contains beyond what the call grew our own streams by was launched in-place
+            // (IB2 or chained) instead of being copied.
+            const uint32 calleeCmdSize = (pCallee->m_deCmdStream.GetUsedCmdMemorySize() +
+                                          pCallee->m_ceCmdStream.GetUsedCmdMemorySize());
+            const uint32 callCmdSize   = ((m_deCmdStream.GetUsedCmdMemorySize() +
+                                           m_ceCmdStream.GetUsedCmdMemorySize()) - callerCmdSize);
+
+            if (calleeCmdSize > callCmdSize)
+            {
+                reusedCount++;
+                reusedCmdSize += (calleeCmdSize - callCmdSize);
+            }
+            else
+            {
+                copiedCount++;
+                copiedCmdSize += callCmdSize;
+            }
+        }
+#endif
+
         // Callee command buffers are also able to leak any changes they made to bound user-data entries and any other
         // state back to the caller.
         LeakNestedCmdBufferState(*pCallee);
     }
+
+#if PAL_BUILD_PM4_INSTRUMENTOR
+    if (m_cachedSettings.enablePm4Instrumentation != 0)
+    {
+        m_device.DescribeNestedCmdBufferReuse(this,
+                                              reusedCount,
+                                              reusedCmdSize,
+                                              copiedCount,
+                                              copiedCmdSize);
+    }
+#endif
 }
 
 // =====================================================================================================================
@@ -8558,6 +8726,8 @@ void UniversalCmdBuffer::CpCopyMemory(
     gpusize srcAddr,
     gpusize numBytes)
 {
+    FlushDeferredBarriers();
+
     PAL_ASSERT(numBytes < (1ull << 32));
 
     DmaDataInfo dmaDataInfo = {};
@@ -28,6 +28,7 @@
 #include "core/hw/gfxip/universalCmdBuffer.h"
 #include "core/hw/gfxip/gfx9/gfx9Chip.h"
 #include "core/hw/gfxip/gfx9/gfx9CmdStream.h"
+#include "core/hw/gfxip/gfx9/gfx9Device.h"
 #include "core/hw/gfxip/gfx9/gfx9WorkaroundState.h"
 #include "core/hw/gfxip/gfx9/g_gfx9PalSettings.h"
 #include "palIntervalTree.h"
@@ -896,6 +897,18 @@ private:
 
     BinningMode GetDisableBinningSetting(Extent2d* pBinSize) const;
 
+    // Issues the syncs of any barriers deferred by CmdBarrier(). Must be called before recording any command which
+    // could depend on the results of a previous barrier.
+    void FlushDeferredBarriers()
+    {
+        if (m_deferredSyncs.barrierCount != 0)
+        {
+            IssueDeferredBarriers();
+        }
+    }
+
+    void IssueDeferredBarriers();
+
     const Device&   m_device;
     const CmdUtil&  m_cmdUtil;
     CmdStream       m_deCmdStream;
@@ -1037,7 +1050,7 @@ private:
             uint32 disableVertGrouping        :  1; // Disable VertexGrouping.
             uint32 prefetchIndexBufferForNgg  :  1; // Prefetch index buffers to workaround misses in UTCL2 with NGG
             uint32 waCeDisableIb2             :  1; // Disable IB2's on the constant engine to workaround HW bug
-            uint32 reserved2                  :  1;
+            uint32 barrierCoalescing          :  1; // True if global-sync-only barriers should be deferred and merged.
             uint32 reserved3                  :  1;
             uint32 pbbMoreThanOneCtxState     :  1;
             uint32 waUtcL0InconsistentBigPage :  1;
@@ -1057,6 +1070,8 @@ private:
 
     uint8 m_leakCbColorInfoRtv;   // Sticky per-MRT dirty mask of CB_COLORx_INFO state written due to RTV
 
+    DeferredBarrierSyncs m_deferredSyncs; // Merged syncs of barriers which CmdBarrier() has not issued yet.
+
     PAL_DISALLOW_DEFAULT_CTOR(UniversalCmdBuffer);
     PAL_DISALLOW_COPY_AND_ASSIGN(UniversalCmdBuffer);
 };
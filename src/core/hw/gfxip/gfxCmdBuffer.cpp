@@ -38,6 +38,7 @@
 #include "palHashMapImpl.h"
 #include "palImage.h"
 #include "palIntrusiveListImpl.h"
+#include "palMetroHash.h"
 #include "palQueryPool.h"
 #include "palVectorImpl.h"
 
@@ -63,11 +64,14 @@ GfxCmdBuffer::GfxCmdBuffer(
     m_pInternalEvent(nullptr),
     m_timestampGpuVa(0),
     m_computeStateFlags(0),
+    m_pfnCmdDispatchDiscarded(nullptr),
     m_spmTraceEnabled(false),
     m_fceRefCountVec(device.GetPlatform()),
     m_gfxBltActiveCtr(0),
     m_csBltActiveCtr(0),
-    m_releaseActivityMap(128, device.GetPlatform())
+    m_releaseActivityMap(128, device.GetPlatform()),
+    m_spillTableCacheValid(0),
+    m_spillTableCacheNext(0)
 {
     PAL_ASSERT((createInfo.queueType == QueueTypeUniversal) || (createInfo.queueType == QueueTypeCompute));
 
@@ -240,6 +244,12 @@ void GfxCmdBuffer::ResetState()
 {
     CmdBuffer::ResetState();
 
+    if (m_pfnCmdDispatchDiscarded != nullptr)
+    {
+        m_funcTable.pfnCmdDispatch = m_pfnCmdDispatchDiscarded;
+        m_pfnCmdDispatchDiscarded  = nullptr;
+    }
+
     m_gfxCmdBufState.flags.u32All           = 0;
     m_gfxCmdBufState.flags.prevCmdBufActive = 1;
 
@@ -264,6 +274,9 @@ void GfxCmdBuffer::ResetState()
     m_gfxBltActiveCtr = 0;
     m_csBltActiveCtr  = 0;
 
+    // The embedded data referenced by the spill table cache is released when the command buffer is reset.
+    m_spillTableCacheValid = 0;
+    m_spillTableCacheNext  = 0;
 }
 
 // =====================================================================================================================
@@ -1041,6 +1054,13 @@ void GfxCmdBuffer::CmdRestoreComputeState(
     PAL_ASSERT(TestAllFlagsSet(m_computeStateFlags, stateFlags));
     m_computeStateFlags = 0;
 
+    if (m_pfnCmdDispatchDiscarded != nullptr)
+    {
+        // The internal operation is over, so the client's dispatches must be recorded again.
+        m_funcTable.pfnCmdDispatch = m_pfnCmdDispatchDiscarded;
+        m_pfnCmdDispatchDiscarded  = nullptr;
+    }
+
     // Vulkan does allow blits in nested command buffers, but they do not support inheriting user-data values from
     // the caller. Therefore, simply "setting" the restored-state's user-data is sufficient, just like it is in a
     // root command buffer. (If Vulkan decides to support user-data inheritance in a later API version, we'll need
@@ -1059,6 +1079,26 @@ void GfxCmdBuffer::CmdRestoreComputeState(
     SetGfxCmdBufCsBltWriteCacheState(true);
 }
 
+// =====================================================================================================================
+// Called whenever a compute pipeline is bound.  RPM binds a placeholder pipeline in place of a compute pipeline which
+// it could not create.  The dispatches of that internal operation are discarded until the compute state is restored
+// and the failure is returned when the command buffer is ended.
+void GfxCmdBuffer::CheckInternalComputePipeline(
+    const IPipeline* pPipeline)
+{
+    if (IsComputeStateSaved() &&
+        m_device.RsrcProcMgr().IsPlaceholderPipeline(static_cast<const Pipeline*>(pPipeline)))
+    {
+        NotifyRecordingError(m_device.RsrcProcMgr().ComputePipelineResult());
+
+        if (m_pfnCmdDispatchDiscarded == nullptr)
+        {
+            m_pfnCmdDispatchDiscarded  = m_funcTable.pfnCmdDispatch;
+            m_funcTable.pfnCmdDispatch = CmdDispatchDiscarded;
+        }
+    }
+}
+
 // =====================================================================================================================
 // Set all specified state on this command buffer.
 void GfxCmdBuffer::SetComputeState(
@@ -1155,6 +1195,64 @@ void GfxCmdBuffer::UpdateUserDataTableCpu(
     pTable->dirty = 0;
 }
 
+// =====================================================================================================================
+// Updates a user-data spill table managed by embedded data & CPU updates.  Unlike UpdateUserDataTableCpu(), this will
+// first look for a previously uploaded copy of the table window with identical contents in this command buffer and
+// point the table at that copy instead of allocating and populating new embedded data.
+void GfxCmdBuffer::UpdateSpillTableCpu(
+    UserDataTableState* pTable,
+    uint32              dwordsNeeded,
+    uint32              offsetInDwords,
+    const uint32*       pSrcData)       // In: Data representing the *full* contents of the table.
+{
+    PAL_ASSERT((dwordsNeeded + offsetInDwords) <= pTable->sizeInDwords);
+
+    const uint32* pWindow = (pSrcData + offsetInDwords);
+
+    uint64 hash = 0;
+    MetroHash64::Hash(reinterpret_cast<const uint8*>(pWindow),
+                      (sizeof(uint32) * dwordsNeeded),
+                      reinterpret_cast<uint8* const>(&hash));
+
+    for (uint32 i = 0; i < m_spillTableCacheValid; ++i)
+    {
+        const SpillTableCacheEntry& entry = m_spillTableCache[i];
+
+        // The hash only filters candidates; the contents are compared against the previously uploaded copy to rule
+        // out collisions before the allocation is shared.
+        if ((entry.hash           == hash)           &&
+            (entry.offsetInDwords == offsetInDwords) &&
+            (entry.dwordsNeeded   == dwordsNeeded)   &&
+            (memcmp(entry.pCpuVirtAddr + offsetInDwords, pWindow, (sizeof(uint32) * dwordsNeeded)) == 0))
+        {
+            pTable->pCpuVirtAddr = entry.pCpuVirtAddr;
+            pTable->gpuVirtAddr  = entry.gpuVirtAddr;
+            pTable->dirty        = 0;
+            return;
+        }
+    }
+
+    UpdateUserDataTableCpu(pTable, dwordsNeeded, offsetInDwords, pSrcData);
+
+    uint32 slot = 0;
+    if (m_spillTableCacheValid < SpillTableCacheSize)
+    {
+        slot = m_spillTableCacheValid++;
+    }
+    else
+    {
+        slot                  = m_spillTableCacheNext;
+        m_spillTableCacheNext = ((m_spillTableCacheNext + 1) % SpillTableCacheSize);
+    }
+
+    SpillTableCacheEntry*const pEntry = &m_spillTableCache[slot];
+    pEntry->hash           = hash;
+    pEntry->gpuVirtAddr    = pTable->gpuVirtAddr;
+    pEntry->pCpuVirtAddr   = pTable->pCpuVirtAddr;
+    pEntry->offsetInDwords = offsetInDwords;
+    pEntry->dwordsNeeded   = dwordsNeeded;
+}
+
 // =====================================================================================================================
 // CmdSetUserData callback which updates the tracked user-data entries for the compute state.
 void PAL_STDCALL GfxCmdBuffer::CmdSetUserDataCs(
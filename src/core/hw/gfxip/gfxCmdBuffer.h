@@ -424,6 +424,8 @@ public:
 
     bool IsComputeStateSaved() const { return (m_computeStateFlags != 0); }
 
+    void CheckInternalComputePipeline(const IPipeline* pPipeline);
+
     virtual void CmdOverwriteRbPlusFormatForBlits(
         SwizzledFormat format,
         uint32         targetIndex) = 0;
@@ -498,6 +500,12 @@ protected:
         const uint32*       pSrcData,
         uint32              alignmentInDwords = 1);
 
+    void UpdateSpillTableCpu(
+        UserDataTableState* pTable,
+        uint32              dwordsNeeded,
+        uint32              offsetInDwords,
+        const uint32*       pSrcData);
+
     static void PAL_STDCALL CmdSetUserDataCs(
         ICmdBuffer*   pCmdBuffer,
         uint32        firstEntry,
@@ -538,6 +546,8 @@ private:
     CmdBufferEngineSupport GetPerfExperimentEngine() const;
     void ResetFastClearReferenceCounts();
 
+    static void PAL_STDCALL CmdDispatchDiscarded(ICmdBuffer* pCmdBuffer, uint32 x, uint32 y, uint32 z) { }
+
     const GfxDevice&  m_device;
 
     // False if DeactivateQuery() has been called on a particular query type, true otherwise.
@@ -552,6 +562,11 @@ private:
     gpusize    m_timestampGpuVa;    // GPU virtual address of memory used for cache flush & inv timestamp events.
 
     uint32  m_computeStateFlags;       // The flags that CmdSaveComputeState was called with.
+
+    // The CmdDispatch function which was replaced by CmdDispatchDiscarded() while an internal operation which couldn't
+    // create its compute pipeline is being recorded, or null.
+    CmdDispatchFunc  m_pfnCmdDispatchDiscarded;
+
     bool    m_spmTraceEnabled;         // Used to indicate whether Spm Trace has been enabled through this command
                                        // buffer so that appropriate submit-time operations can be done.
 
@@ -562,6 +577,24 @@ private:
 
     ReleaseActivityMap m_releaseActivityMap; // A hashmap that tracks active releases.
 
+    // Small round-robin cache of recently uploaded spill tables.  Workloads which bounce between a handful of
+    // pipelines or root-constant values tend to re-upload byte-identical spill tables, so UpdateSpillTableCpu() reuses
+    // a previous embedded-data allocation whenever the contents of the table window match one of these entries.
+    struct SpillTableCacheEntry
+    {
+        uint64  hash;           // MetroHash64 of the table window contents.
+        gpusize gpuVirtAddr;    // GPU address of the table (already offset by -offsetInDwords).
+        uint32* pCpuVirtAddr;   // CPU address of the table (already offset by -offsetInDwords).
+        uint32  offsetInDwords; // Offset of the first valid dword of the table window.
+        uint32  dwordsNeeded;   // Size of the table window in dwords.
+    };
+
+    static constexpr uint32 SpillTableCacheSize = 8;
+
+    SpillTableCacheEntry m_spillTableCache[SpillTableCacheSize];
+    uint32               m_spillTableCacheValid; // Number of valid entries in m_spillTableCache.
+    uint32               m_spillTableCacheNext;  // Next entry to be replaced once the cache is full.
+
     PAL_DISALLOW_COPY_AND_ASSIGN(GfxCmdBuffer);
     PAL_DISALLOW_DEFAULT_CTOR(GfxCmdBuffer);
 };
@@ -61,6 +61,9 @@ GfxCmdStream::GfxCmdStream(
     m_condIndirectBufferSize(condIndirectBufferSize),
     m_cmdBlockOffset(0),
     m_pTailChainLocation(nullptr),
+    m_tailChainTargetAddr(0),
+    m_tailChainTargetDwords(0),
+    m_tailChainTargetPreempt(false),
     m_numCntlFlowStatements(0),
     m_numPendingChains(0)
 {
@@ -78,6 +81,7 @@ void GfxCmdStream::Reset(
     m_numCntlFlowStatements = 0;
     m_numPendingChains      = 0;
     m_pTailChainLocation    = nullptr;
+    m_tailChainTargetAddr   = 0;
 
     Pal::CmdStream::Reset(pNewAllocator, returnGpuMemory);
 }
@@ -96,7 +100,8 @@ void GfxCmdStream::UpdateTailChainLocation(
     auto*const   pTailChunk = m_chunkList.Back();
     const size_t tailOffset = pTailChain - pTailChunk->GetRmwWriteAddr();
 
-    m_pTailChainLocation = pTailChunk->GetRmwCpuAddr() + tailOffset;
+    m_pTailChainLocation  = pTailChunk->GetRmwCpuAddr() + tailOffset;
+    m_tailChainTargetAddr = 0;
 }
 
 // =====================================================================================================================
@@ -509,6 +514,9 @@ void GfxCmdStream::Call(
             // NOTE: The callee's End() method was called after it was done being recorded. That call already built
             // us a dummy NOP packet at the tail-chain location, so we don't need to build a new one at this time!
             AddChainPatch(ChainPatchType::IndirectBuffer, gfxStream.m_pTailChainLocation);
+
+            // The callee's tail no longer matches its cached chain target, so make sure PatchTailChain rewrites it.
+            gfxStream.m_tailChainTargetAddr = TailChainTargetUnknown;
         }
         else
         {
@@ -652,6 +660,9 @@ uint32 GfxCmdStream::PrepareChunkForCmdGeneration(
 // This is used at submit time to chain together multiple command buffers that were submitted in a single batch. This
 // will avoid KMD overhead of a submit and GPU overhead of flushing cached between submits, etc. It must be called after
 // End but before Reset/Begin so that m_pTailChainLocation is valid.
+//
+// The tail packet is only rewritten if the requested target differs from what was last written there. This only saves
+// the packet build and the write to command memory; the rest of each submission's work is unchanged.
 void GfxCmdStream::PatchTailChain(
     const CmdStream* pTargetStream
     ) const
@@ -667,17 +678,27 @@ void GfxCmdStream::PatchTailChain(
             // Non-preemptible command streams don't expect to chain to a preemptible command stream!
             PAL_ASSERT(IsPreemptionEnabled() || (pTargetStream->IsPreemptionEnabled() == false));
 
-            const auto*const pFirstChunk = pTargetStream->GetFirstChunk();
+            const auto*const pFirstChunk   = pTargetStream->GetFirstChunk();
+            const gpusize    targetAddr    = pFirstChunk->GpuVirtAddr();
+            const uint32     targetDwords  = pFirstChunk->CmdDwordsToExecute();
+            const bool       targetPreempt = pTargetStream->IsPreemptionEnabled();
 
-            BuildIndirectBuffer(pFirstChunk->GpuVirtAddr(),
-                                pFirstChunk->CmdDwordsToExecute(),
-                                pTargetStream->IsPreemptionEnabled(),
-                                true,
-                                m_pTailChainLocation);
+            if ((m_tailChainTargetAddr    != targetAddr)   ||
+                (m_tailChainTargetDwords  != targetDwords) ||
+                (m_tailChainTargetPreempt != targetPreempt))
+            {
+                BuildIndirectBuffer(targetAddr, targetDwords, targetPreempt, true, m_pTailChainLocation);
+
+                m_tailChainTargetAddr    = targetAddr;
+                m_tailChainTargetDwords  = targetDwords;
+                m_tailChainTargetPreempt = targetPreempt;
+            }
         }
-        else
+        else if (m_tailChainTargetAddr != 0)
         {
             BuildNop(m_chainIbSpaceInDwords, m_pTailChainLocation);
+
+            m_tailChainTargetAddr = 0;
         }
     }
 }
@@ -163,6 +163,14 @@ private:
     uint32         m_cmdBlockOffset;         // The current command block began at this DW offset in the current chunk
     uint32*        m_pTailChainLocation;     // Put a chain packet here to chain this command stream to another.
 
+    // The chain packet currently written at m_pTailChainLocation. Command buffers which are submitted repeatedly
+    // without being re-recorded usually chain to the same target (or to nothing), so PatchTailChain skips writing the
+    // tail when the target hasn't changed. An address of zero means the tail is a NOP.
+    static constexpr gpusize TailChainTargetUnknown = ~static_cast<gpusize>(0);
+    mutable gpusize m_tailChainTargetAddr;
+    mutable uint32  m_tailChainTargetDwords;
+    mutable bool    m_tailChainTargetPreempt;
+
     // We need a stack of control flow frames to manage nested control flow statements.
     CntlFlowFrame  m_cntlFlowStack[CntlFlowNestingLimit];
     uint32         m_numCntlFlowStatements;
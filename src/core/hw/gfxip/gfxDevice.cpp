@@ -56,7 +56,8 @@ GfxDevice::GfxDevice(
     m_waEnableDccCacheFlushAndInvalidate(false),
     m_waTcCompatZRange(false),
     m_degeneratePrimFilter(false),
-    m_pSettingsLoader(nullptr)
+    m_pSettingsLoader(nullptr),
+    m_pipelineCodeStore(pDevice)
 {
     for (uint32 i = 0; i < QueueType::QueueTypeCount; i++)
     {
@@ -190,7 +191,7 @@ void GfxDevice::FinalizeChipProperties(
 // Peforms extra initialization which needs to be done after the parent Device is finalized.
 Result GfxDevice::Finalize()
 {
-    Result result = Result::Success;
+    Result result = m_pipelineCodeStore.Init();
 
 #if DEBUG
     if (result == Result::Success)
@@ -665,6 +666,26 @@ void GfxDevice::DescribeHotRegisters(
 
     m_pParent->DeveloperCb(Developer::CallbackType::OptimizedRegisters, &data);
 }
+
+// =====================================================================================================================
+// Call back to above layers to describe how a batch of nested command buffers was launched by their caller.
+void GfxDevice::DescribeNestedCmdBufferReuse(
+    GfxCmdBuffer* pCmdBuf,
+    uint32        reusedCount,
+    size_t        reusedCmdSize,
+    uint32        copiedCount,
+    size_t        copiedCmdSize
+    ) const
+{
+    Developer::NestedCmdBufferReuseData data = { };
+    data.pCmdBuffer            = pCmdBuf;
+    data.reusedCount           = reusedCount;
+    data.reusedCmdSize         = static_cast<uint32>(reusedCmdSize);
+    data.copiedCount           = copiedCount;
+    data.copiedCmdSize         = static_cast<uint32>(copiedCmdSize);
+
+    m_pParent->DeveloperCb(Developer::CallbackType::NestedCmdBufferReuse, &data);
+}
 #endif
 
 // =====================================================================================================================
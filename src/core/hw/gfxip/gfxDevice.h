@@ -30,6 +30,7 @@
 #include "palSettingsLoader.h"
 #include "core/cmdStream.h"
 #include "core/platform.h"
+#include "core/hw/gfxip/pipelineCodeStore.h"
 #include "palHashMap.h"
 #include "palSysMemory.h"
 
@@ -506,6 +507,7 @@ public:
     virtual uint32 GetMsaaRate() const { return 0; }
 
     Pal::Device* Parent() const { return m_pParent; }
+    PipelineCodeStore* GetPipelineCodeStore() { return &m_pipelineCodeStore; }
     Platform* GetPlatform() const;
 
     const RsrcProcMgr& RsrcProcMgr() const { return *m_pRsrcProcMgr; }
@@ -577,6 +579,13 @@ public:
         const uint32* pCtxRegKeptSets,
         uint32        ctxRegCount,
         uint16        ctxRegBase) const;
+
+    void DescribeNestedCmdBufferReuse(
+        GfxCmdBuffer* pCmdBuf,
+        uint32        reusedCount,
+        size_t        reusedCmdSize,
+        uint32        copiedCount,
+        size_t        copiedCmdSize) const;
 #endif
 
 #if DEBUG
@@ -697,6 +706,9 @@ protected:
     bool    m_degeneratePrimFilter;
     ISettingsLoader*  m_pSettingsLoader;
 
+    // Uploaded pipeline code and data images shared between pipelines with identical contents.
+    PipelineCodeStore  m_pipelineCodeStore;
+
     PAL_ALIGN(32) uint32 m_fastClearImageRefs[MaxNumFastClearImageRefs];
 
 private:
@@ -149,6 +149,9 @@ public:
 
     virtual gpusize GetAspectBaseAddr(ImageAspect  aspect) const { PAL_NEVER_CALLED(); return 0; }
 
+    // Notifies the hardware layer that the parent image was bound to new GPU memory (or unbound).
+    virtual void OnGpuMemoryBound() { }
+
     uint32 TranslateClearCodeOneToNativeFmt(uint32 cmpIdx) const;
 
     // Returns an integer that represents the tiling mode associated with the specified subresource.
@@ -172,7 +172,7 @@ Result GraphicsPipeline::InitFromPipelineBinary(
 #endif
 
     AbiProcessor abiProcessor(m_pDevice->GetPlatform());
-    Result result = abiProcessor.LoadFromBuffer(m_pPipelineBinary, m_pipelineBinaryLen);
+    Result result = abiProcessor.LoadFromBufferView(m_pPipelineBinary, m_pipelineBinaryLen);
 
     MsgPackReader      metadataReader;
     CodeObjectMetadata metadata;
@@ -28,6 +28,7 @@
 #include "core/platform.h"
 #include "core/hw/gfxip/gfxDevice.h"
 #include "core/hw/gfxip/pipeline.h"
+#include "palCacheLayer.h"
 #include "palFile.h"
 #include "palPipelineAbiProcessorImpl.h"
 #include "palEventDefs.h"
@@ -69,6 +70,9 @@ Pipeline::Pipeline(
     m_pDevice(pDevice),
     m_gpuMem(),
     m_gpuMemSize(0),
+    m_regGpuMem(),
+    m_regGpuMemSize(0),
+    m_uploadBatchId(0),
     m_pPipelineBinary(nullptr),
     m_pipelineBinaryLen(0),
     m_apiHwMapping(),
@@ -83,6 +87,7 @@ Pipeline::Pipeline(
     memset(&m_info, 0, sizeof(m_info));
     memset(&m_shaderMetaData, 0, sizeof(m_shaderMetaData));
     memset(&m_perfDataInfo, 0, sizeof(m_perfDataInfo));
+    memset(&m_codeHash, 0, sizeof(m_codeHash));
 }
 
 // =====================================================================================================================
@@ -90,10 +95,30 @@ Pipeline::~Pipeline()
 {
     if (m_gpuMem.IsBound())
     {
-        m_pDevice->MemMgr()->FreeGpuMem(m_gpuMem.Memory(), m_gpuMem.Offset());
+        // If this pipeline was created inside a pipeline upload batch, its upload may still be pending.  Make sure
+        // the DMA copy has landed before the memory is handed back to the internal memory manager.
+        if (m_pDevice->IsPipelineUploadPending(m_uploadBatchId))
+        {
+            m_pDevice->FlushPipelineUploadBatch();
+        }
+
+        if (m_flags.sharedCode != 0)
+        {
+            m_pDevice->GetGfxDevice()->GetPipelineCodeStore()->Release(m_codeHash);
+        }
+        else
+        {
+            m_pDevice->MemMgr()->FreeGpuMem(m_gpuMem.Memory(), m_gpuMem.Offset());
+        }
         m_gpuMem.Update(nullptr, 0);
     }
 
+    if (m_regGpuMem.IsBound())
+    {
+        m_pDevice->MemMgr()->FreeGpuMem(m_regGpuMem.Memory(), m_regGpuMem.Offset());
+        m_regGpuMem.Update(nullptr, 0);
+    }
+
     if (m_perfDataMem.IsBound())
     {
         m_pDevice->MemMgr()->FreeGpuMem(m_perfDataMem.Memory(), m_perfDataMem.Offset());
@@ -199,14 +224,17 @@ Result Pipeline::PerformRelocationsAndUploadToGpuMemory(
 
     if (result == Result::Success)
     {
-        result = pUploader->Begin(abiProcessor, metadata, clientPreferredHeap);
+        result = pUploader->Begin(abiProcessor, metadata, clientPreferredHeap, true);
     }
 
-    if (result == Result::Success)
-    {
-        m_gpuMemSize = pUploader->GpuMemSize();
-        m_gpuMem.Update(pUploader->GpuMem(), pUploader->GpuMemOffset());
-    }
+    // Take ownership of the uploader's allocations even if Begin() failed part way through so that they get released
+    // when this pipeline is destroyed.
+    m_flags.sharedCode = pUploader->SharesCode();
+    m_codeHash         = pUploader->CodeHash();
+    m_gpuMemSize       = pUploader->GpuMemSize();
+    m_regGpuMemSize    = pUploader->RegGpuMemSize();
+    m_gpuMem.Update(pUploader->GpuMem(), pUploader->GpuMemOffset());
+    m_regGpuMem.Update(pUploader->RegGpuMem(), pUploader->RegGpuMemOffset());
 
     return result;
 }
@@ -256,13 +284,20 @@ Result Pipeline::QueryAllocationInfo(
 
     if (pNumEntries != nullptr)
     {
-        (*pNumEntries) = 1;
+        (*pNumEntries) = m_regGpuMem.IsBound() ? 2 : 1;
 
         if (pGpuMemList != nullptr)
         {
             pGpuMemList[0].offset     = m_gpuMem.Offset();
             pGpuMemList[0].pGpuMemory = m_gpuMem.Memory();
             pGpuMemList[0].size       = m_gpuMemSize;
+
+            if (m_regGpuMem.IsBound())
+            {
+                pGpuMemList[1].offset     = m_regGpuMem.Offset();
+                pGpuMemList[1].pGpuMemory = m_regGpuMem.Memory();
+                pGpuMemList[1].size       = m_regGpuMemSize;
+            }
         }
 
         result = Result::Success;
@@ -337,7 +372,7 @@ Result Pipeline::GetShaderCode(
             // To extract the shader code, we can re-parse the saved ELF binary and lookup the shader's program
             // instructions by examining the symbol table entry for that shader's entrypoint.
             AbiProcessor abiProcessor(m_pDevice->GetPlatform());
-            result = abiProcessor.LoadFromBuffer(m_pPipelineBinary, m_pipelineBinaryLen);
+            result = abiProcessor.LoadFromBufferView(m_pPipelineBinary, m_pipelineBinaryLen);
             if (result == Result::Success)
             {
                 const auto& symbol = abiProcessor.GetPipelineSymbolEntry(
@@ -427,7 +462,7 @@ Result Pipeline::GetShaderStatsForStage(
 
     // We can re-parse the saved pipeline ELF binary to extract shader statistics.
     AbiProcessor abiProcessor(m_pDevice->GetPlatform());
-    Result result = abiProcessor.LoadFromBuffer(m_pPipelineBinary, m_pipelineBinaryLen);
+    Result result = abiProcessor.LoadFromBufferView(m_pPipelineBinary, m_pipelineBinaryLen);
 
     MsgPackReader      metadataReader;
     CodeObjectMetadata metadata;
@@ -484,6 +519,69 @@ Result Pipeline::GetShaderStatsForStage(
     return result;
 }
 
+// =====================================================================================================================
+// Computes the key of this pipeline's entry in the device's pipeline register cache.  The key covers the whole pipeline
+// ELF and the client's platform key; the caller's salt must cover any settings or layout version which affects the
+// derived register state stored in the entry.
+MetroHash::Hash Pipeline::ComputeRegisterCacheKey(
+    const void* pSalt,
+    size_t      saltSize
+    ) const
+{
+    PAL_ASSERT((m_pPipelineBinary != nullptr) && (m_pipelineBinaryLen != 0));
+
+    MetroHash::Hash key = {};
+
+    MetroHash128 hasher;
+    hasher.Update(static_cast<const uint8*>(m_pPipelineBinary), m_pipelineBinaryLen);
+    hasher.Update(m_pDevice->PipelineRegisterCacheSalt());
+    hasher.Update(static_cast<const uint8*>(pSalt), saltSize);
+    hasher.Finalize(key.bytes);
+
+    return key;
+}
+
+// =====================================================================================================================
+// Looks up this pipeline's derived register state in the device's pipeline register cache.  Returns true and fills
+// out pEntry if an entry of exactly the expected size was found.
+bool Pipeline::LoadRegisterCacheEntry(
+    const MetroHash::Hash& key,
+    void*                  pEntry,
+    size_t                 entrySize
+    ) const
+{
+    ICacheLayer*const pCache = m_pDevice->PipelineRegisterCache();
+    bool              found  = false;
+
+    if (pCache != nullptr)
+    {
+        QueryResult query = {};
+        if ((pCache->Query(&key, &query) == Result::Success) && (query.dataSize == entrySize))
+        {
+            found = (pCache->Load(&query, pEntry) == Result::Success);
+        }
+    }
+
+    return found;
+}
+
+// =====================================================================================================================
+// Stores this pipeline's derived register state in the device's pipeline register cache.  Failures are ignored since
+// the cache is purely an optimization; AlreadyExists is expected when several threads create the same pipeline.
+void Pipeline::StoreRegisterCacheEntry(
+    const MetroHash::Hash& key,
+    const void*            pEntry,
+    size_t                 entrySize
+    ) const
+{
+    ICacheLayer*const pCache = m_pDevice->PipelineRegisterCache();
+
+    if (pCache != nullptr)
+    {
+        pCache->Store(&key, pEntry, entrySize);
+    }
+}
+
 // =====================================================================================================================
 // Calculates the size, in bytes, of the performance data buffers needed total for the entire pipeline.
 size_t Pipeline::PerformanceDataSize(
@@ -571,24 +669,34 @@ PipelineUploader::PipelineUploader(
     , m_pCtxRegWritePtrStart(nullptr),
     m_pShRegWritePtrStart(nullptr)
 #endif
-    , m_pipelineHeapType(GpuHeap::GpuHeapCount)
+    , m_pipelineHeapType(GpuHeap::GpuHeapCount),
+    m_sharesCode(false),
+    m_ownsCodeReservation(false),
+    m_pRegGpuMemory(nullptr),
+    m_regBaseOffset(0),
+    m_regGpuMemSize(0),
+    m_pRegMappedPtr(nullptr)
 {
+    memset(&m_codeHash, 0, sizeof(m_codeHash));
 }
 
 // =====================================================================================================================
 PipelineUploader::~PipelineUploader()
 {
-    PAL_ASSERT(m_pMappedPtr == nullptr); // If this fires, the caller forgot to call End()!
+    // If this fires, the caller forgot to call End()!
+    PAL_ASSERT((m_pMappedPtr == nullptr) && (m_pRegMappedPtr == nullptr));
 }
 
 // =====================================================================================================================
 // Allocates GPU memory for the current pipeline.  Also, maps the memory for CPU access and uploads the pipeline code
 // and data.  The GPU virtual addresses for the code, data, and register segments are also computed.  The caller is
-// responsible for calling End() which unmaps the GPU memory.
+// responsible for calling End() which unmaps the GPU memory.  If allowCodeSharing is set and another pipeline has
+// already uploaded identical code and data, that image is referenced instead of uploading a new copy.
 Result PipelineUploader::Begin(
     const AbiProcessor&       abiProcessor,
     const CodeObjectMetadata& metadata,
-    const GpuHeap&            clientPreferredHeap)
+    const GpuHeap&            clientPreferredHeap,
+    bool                      allowCodeSharing)
 {
     static_assert(static_cast<uint32>(PreferredPipelineUploadHeap::PipelineHeapLocal)         ==
         static_cast<uint32>(GpuHeap::GpuHeapLocal),         "Pipeline heap enumeration needs to be updated!");
@@ -651,10 +759,17 @@ Result PipelineUploader::Begin(
         createInfo.size = (Pow2Align(createInfo.size, dataAlignment) + dataLength);
     }
 
+    // Registers loaded via LOAD_INDEX are specific to each pipeline.  They follow the code and data in this pipeline's
+    // own allocation; only a pipeline which reuses another pipeline's image needs a separate allocation for them.
+    const bool   shareCode      = (allowCodeSharing && m_pDevice->Settings().enablePipelineCodeDedup);
     const uint32 totalRegisters = (m_ctxRegisterCount + m_shRegisterCount);
+    constexpr uint32 RegisterEntryBytes = (sizeof(uint32) << 1);
+
+    // Size of the code and data image which other pipelines may reuse, excluding this pipeline's registers.
+    const gpusize imageSize = createInfo.size;
+
     if (totalRegisters > 0)
     {
-        constexpr uint32 RegisterEntryBytes = (sizeof(uint32) << 1);
         createInfo.size = (Pow2Align(createInfo.size, sizeof(uint32)) + (RegisterEntryBytes * totalRegisters));
     }
 
@@ -670,10 +785,76 @@ Result PipelineUploader::Begin(
 
     createInfo.size = Max(createInfo.size, minSafeSize);
 
-    m_gpuMemSize  = createInfo.size;
-    Result result = m_pDevice->MemMgr()->AllocateGpuMem(createInfo, internalInfo, false, &m_pGpuMemory, &m_baseOffset);
+    Result            result      = Result::Success;
+    PipelineCodeEntry sharedEntry = { };
+    bool              codeReused  = false;
 
-    if (result == Result::Success)
+    if (shareCode)
+    {
+        // The data section is patched with addresses inside the image, so the image is only reusable within the same
+        // heap.  Identical code and data in the same heap always produce identical patched contents.
+        MetroHash128 hasher;
+        hasher.Update(static_cast<const uint8*>(pCodeBuffer), codeLength);
+        hasher.Update(static_cast<const uint8*>(pDataBuffer), dataLength);
+        hasher.Update(dataAlignment);
+        hasher.Update(m_pipelineHeapType);
+        hasher.Finalize(m_codeHash.bytes);
+
+        codeReused   = m_pDevice->GetGfxDevice()->GetPipelineCodeStore()->Acquire(m_codeHash, &sharedEntry);
+        m_sharesCode = codeReused;
+    }
+
+    if (codeReused)
+    {
+        // Another pipeline already uploaded identical code and data, so there is nothing to copy.
+        m_pGpuMemory = sharedEntry.pGpuMemory;
+        m_baseOffset = sharedEntry.offset;
+        m_gpuMemSize = sharedEntry.size;
+
+        m_codeGpuVirtAddr     = (m_pGpuMemory->Desc().gpuVirtAddr + m_baseOffset);
+        m_prefetchGpuVirtAddr = m_codeGpuVirtAddr;
+        m_prefetchSize        = codeLength;
+
+        if (dataLength > 0)
+        {
+            m_dataGpuVirtAddr = Pow2Align(m_codeGpuVirtAddr + codeLength, dataAlignment);
+            m_prefetchSize    = (m_dataGpuVirtAddr + dataLength) - m_prefetchGpuVirtAddr;
+        }
+
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 573
+        Developer::PipelineCodeReuseData data = { };
+        data.codeHash        = m_codeHash.qwords[0];
+        data.heap            = m_pipelineHeapType;
+        data.bytesSaved      = sharedEntry.size;
+        data.totalBytesSaved = m_pDevice->GetGfxDevice()->GetPipelineCodeStore()->TotalBytesSaved();
+        data.refCount        = sharedEntry.refCount;
+        m_pDevice->DeveloperCb(Developer::CallbackType::PipelineCodeReuse, &data);
+#endif
+    }
+    else
+    {
+        m_gpuMemSize = createInfo.size;
+        result       = m_pDevice->MemMgr()->AllocateGpuMem(createInfo,
+                                                           internalInfo,
+                                                           false,
+                                                           &m_pGpuMemory,
+                                                           &m_baseOffset);
+
+        if ((result == Result::Success) && shareCode)
+        {
+            // If another thread raced us to an identical image, this pipeline simply keeps its private copy.
+            // The registers which follow the image are never read through the shared entry, so it is harmless that
+            // they remain part of this allocation after this pipeline is destroyed.
+            m_ownsCodeReservation = m_pDevice->GetGfxDevice()->GetPipelineCodeStore()->Reserve(
+                                        m_codeHash,
+                                        m_pGpuMemory,
+                                        m_baseOffset,
+                                        Max(imageSize, minSafeSize));
+            m_sharesCode          = m_ownsCodeReservation;
+        }
+    }
+
+    if ((result == Result::Success) && (codeReused == false))
     {
         if (m_pipelineHeapType != GpuHeap::GpuHeapInvisible)
         {
@@ -743,58 +924,106 @@ Result PipelineUploader::Begin(
 
             if (totalRegisters > 0)
             {
-                gpusize regGpuVirtAddr = Pow2Align(gpuVirtAddr, sizeof(uint32));
-                uint32* pRegWritePtr   = static_cast<uint32*>(VoidPtrAlign(pMappedPtr, sizeof(uint32)));
+                SetupRegisterWritePtrs(Pow2Align(gpuVirtAddr, sizeof(uint32)),
+                                       static_cast<uint32*>(VoidPtrAlign(pMappedPtr, sizeof(uint32))));
+            }
+        } // if Map() succeeded
+    } // if the code and data need to be uploaded
 
-                if (m_ctxRegisterCount > 0)
-                {
-                    m_ctxRegGpuVirtAddr = regGpuVirtAddr;
-                    m_pCtxRegWritePtr   = pRegWritePtr;
+    if ((result == Result::Success) && (totalRegisters > 0) && codeReused)
+    {
+        // The reused image belongs to another pipeline, so the registers get their own small allocation which is
+        // always CPU visible so that they can be written directly, regardless of where the shared code lives.
+        GpuMemoryCreateInfo regCreateInfo = { };
+        regCreateInfo.alignment           = sizeof(uint32);
+        regCreateInfo.vaRange             = VaRange::DescriptorTable;
+        regCreateInfo.heaps[0]            = GpuHeapLocal;
+        regCreateInfo.heaps[1]            = GpuHeapGartUswc;
+        regCreateInfo.heapCount           = 2;
+        regCreateInfo.priority            = GpuMemPriority::High;
+        regCreateInfo.size                = (RegisterEntryBytes * totalRegisters);
+
+        m_regGpuMemSize = regCreateInfo.size;
+        result          = m_pDevice->MemMgr()->AllocateGpuMem(regCreateInfo,
+                                                              internalInfo,
+                                                              false,
+                                                              &m_pRegGpuMemory,
+                                                              &m_regBaseOffset);
 
-                    regGpuVirtAddr += (m_ctxRegisterCount * (sizeof(uint32) * 2));
-                    pRegWritePtr   += (m_ctxRegisterCount * 2);
-                }
+        if (result == Result::Success)
+        {
+            result          = m_pRegGpuMemory->Map(&m_pRegMappedPtr);
+            m_pRegMappedPtr = VoidPtrInc(m_pRegMappedPtr, static_cast<size_t>(m_regBaseOffset));
+        }
 
-                if (m_shRegisterCount > 0)
-                {
-                    m_shRegGpuVirtAddr = regGpuVirtAddr;
-                    m_pShRegWritePtr   = pRegWritePtr;
-                }
+        if (result == Result::Success)
+        {
+            SetupRegisterWritePtrs(m_pRegGpuMemory->Desc().gpuVirtAddr + m_regBaseOffset,
+                                   static_cast<uint32*>(m_pRegMappedPtr));
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Assigns the GPU addresses and CPU write pointers for the context and SH registers loaded by this pipeline, which are
+// stored back-to-back starting at the given location.
+void PipelineUploader::SetupRegisterWritePtrs(
+    gpusize regGpuVirtAddr,
+    uint32* pRegWritePtr)
+{
+    if (m_ctxRegisterCount > 0)
+    {
+        m_ctxRegGpuVirtAddr = regGpuVirtAddr;
+        m_pCtxRegWritePtr   = pRegWritePtr;
+
+        regGpuVirtAddr += (m_ctxRegisterCount * (sizeof(uint32) * 2));
+        pRegWritePtr   += (m_ctxRegisterCount * 2);
+    }
+
+    if (m_shRegisterCount > 0)
+    {
+        m_shRegGpuVirtAddr = regGpuVirtAddr;
+        m_pShRegWritePtr   = pRegWritePtr;
+    }
 
 #if PAL_ENABLE_PRINTS_ASSERTS
-                m_pCtxRegWritePtrStart = m_pCtxRegWritePtr;
-                m_pShRegWritePtrStart  = m_pShRegWritePtr;
+    m_pCtxRegWritePtrStart = m_pCtxRegWritePtr;
+    m_pShRegWritePtrStart  = m_pShRegWritePtr;
 #endif
-            }
-        } // if Map() succeeded
-    } // if AllocateGpuMem() succeeded
-
-    return result;
 }
 
 // =====================================================================================================================
 // "Finishes" uploading a pipeline to GPU memory by requesting the device to submit a DMA copy of the pipeline from
-// its initial heap to the local invisible heap. The temporary CPU visible heap is freed.
-Result PipelineUploader::End()
+// its initial heap to the local invisible heap. The temporary CPU visible heap is freed.  If the client has opened a
+// pipeline upload batch, the device only records the copy and submits it along with the rest of the batch; the ID of
+// that batch is returned through pUploadBatchId.
+Result PipelineUploader::End(
+    uint64* pUploadBatchId)
 {
     Result result = Result::Success;
 
-    if ((m_pGpuMemory != nullptr) && (m_pMappedPtr != nullptr))
-    {
-        // Sanity check to make sure we allocated the correct amount of memory for any loaded SH or context registers.
+    // Sanity check to make sure we allocated the correct amount of memory for any loaded SH or context registers.
 #if PAL_ENABLE_PRINTS_ASSERTS
-        PAL_ASSERT(m_pCtxRegWritePtr == (m_pCtxRegWritePtrStart + (m_ctxRegisterCount * 2)));
-        PAL_ASSERT(m_pShRegWritePtr  == (m_pShRegWritePtrStart  + (m_shRegisterCount  * 2)));
+    PAL_ASSERT(m_pCtxRegWritePtr == (m_pCtxRegWritePtrStart + (m_ctxRegisterCount * 2)));
+    PAL_ASSERT(m_pShRegWritePtr  == (m_pShRegWritePtrStart  + (m_shRegisterCount  * 2)));
 
-        m_pCtxRegWritePtrStart = nullptr;
-        m_pShRegWritePtrStart  = nullptr;
+    m_pCtxRegWritePtrStart = nullptr;
+    m_pShRegWritePtrStart  = nullptr;
 #endif
-        m_pCtxRegWritePtr = nullptr;
-        m_pShRegWritePtr  = nullptr;
+    m_pCtxRegWritePtr = nullptr;
+    m_pShRegWritePtr  = nullptr;
 
+    if ((m_pGpuMemory != nullptr) && (m_pMappedPtr != nullptr))
+    {
         if (m_pipelineHeapType == GpuHeap::GpuHeapInvisible)
         {
-            result = m_pDevice->CopyUsingEmbeddedData(m_pMappedPtr, m_gpuMemSize, m_baseOffset, m_pGpuMemory);
+            result = m_pDevice->CopyUsingEmbeddedData(m_pMappedPtr,
+                                                      m_gpuMemSize,
+                                                      m_baseOffset,
+                                                      m_pGpuMemory,
+                                                      pUploadBatchId);
             PAL_SAFE_FREE(m_pMappedPtr, m_pDevice->GetPlatform());
         }
         else
@@ -803,6 +1032,19 @@ Result PipelineUploader::End()
         }
 
         m_pMappedPtr = nullptr;
+
+        // Other pipelines may only start referencing the image once its upload has been submitted (or recorded into
+        // the open upload batch).
+        if ((result == Result::Success) && m_ownsCodeReservation)
+        {
+            m_pDevice->GetGfxDevice()->GetPipelineCodeStore()->MarkReady(m_codeHash);
+        }
+    }
+
+    if ((m_pRegGpuMemory != nullptr) && (m_pRegMappedPtr != nullptr))
+    {
+        m_pRegGpuMemory->Unmap();
+        m_pRegMappedPtr = nullptr;
     }
 
     return result;
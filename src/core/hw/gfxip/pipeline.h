@@ -173,6 +173,22 @@ protected:
     size_t PerformanceDataSize(
         const CodeObjectMetadata& metadata) const;
 
+    bool UseRegisterCache() const { return (m_pDevice->PipelineRegisterCache() != nullptr); }
+
+    Util::MetroHash::Hash ComputeRegisterCacheKey(
+        const void* pSalt,
+        size_t      saltSize) const;
+
+    bool LoadRegisterCacheEntry(
+        const Util::MetroHash::Hash& key,
+        void*                        pEntry,
+        size_t                       entrySize) const;
+
+    void StoreRegisterCacheEntry(
+        const Util::MetroHash::Hash& key,
+        const void*                  pEntry,
+        size_t                       entrySize) const;
+
     Device*const  m_pDevice;
 
     PipelineInfo    m_info;             // Public info structure available to the client.
@@ -180,6 +196,9 @@ protected:
 
     BoundGpuMemory  m_gpuMem;
     gpusize         m_gpuMemSize;
+    BoundGpuMemory  m_regGpuMem;        // LOAD_INDEX registers, when not stored alongside the code and data.
+    gpusize         m_regGpuMemSize;
+    uint64          m_uploadBatchId;    // Device copy batch holding this pipeline's upload, zero if never batched.
 
     void*   m_pPipelineBinary;      // Buffer containing the pipeline binary data (Pipeline ELF ABI).
     size_t  m_pipelineBinaryLen;    // Size of the pipeline binary data, in bytes.
@@ -193,7 +212,8 @@ private:
         struct
         {
             uint32  isInternal       :  1;  // True if this Pipeline object was created internally by PAL.
-            uint32  reserved         : 31;
+            uint32  sharedCode       :  1;  // True if m_gpuMem is owned by the device's PipelineCodeStore.
+            uint32  reserved         : 30;
         };
         uint32  value;  // Flags packed as a uint32.
     } m_flags;
@@ -201,6 +221,8 @@ private:
     BoundGpuMemory m_perfDataMem;
     gpusize        m_perfDataGpuMemSize;
 
+    Util::MetroHash::Hash m_codeHash; // Key of the shared code and data image in the PipelineCodeStore.
+
     PAL_DISALLOW_DEFAULT_CTOR(Pipeline);
     PAL_DISALLOW_COPY_AND_ASSIGN(Pipeline);
 };
@@ -219,9 +241,10 @@ public:
     Result Begin(
         const AbiProcessor&       abiProcessor,
         const CodeObjectMetadata& metadata,
-        const GpuHeap&            preferredHeap);
+        const GpuHeap&            preferredHeap,
+        bool                      allowCodeSharing);
 
-    Result End();
+    Result End(uint64* pUploadBatchId = nullptr);
 
     uint32 ShRegisterCount() const { return m_shRegisterCount; }
     uint32 CtxRegisterCount() const { return m_ctxRegisterCount; }
@@ -232,6 +255,15 @@ public:
     gpusize GpuMemSize() const { return m_gpuMemSize; }
     gpusize GpuMemOffset() const { return m_baseOffset; }
 
+    // The code and data image is owned by the device's PipelineCodeStore when this returns true.
+    bool SharesCode() const { return m_sharesCode; }
+    const Util::MetroHash::Hash& CodeHash() const { return m_codeHash; }
+
+    // Registers are placed in a separate allocation when code sharing is allowed; otherwise these return nullptr/0.
+    GpuMemory* RegGpuMem() const { return m_pRegGpuMemory; }
+    gpusize RegGpuMemSize() const { return m_regGpuMemSize; }
+    gpusize RegGpuMemOffset() const { return m_regBaseOffset; }
+
     gpusize CodeGpuVirtAddr() const { return m_codeGpuVirtAddr; }
     gpusize DataGpuVirtAddr() const { return m_dataGpuVirtAddr; }
     gpusize CtxRegGpuVirtAddr() const { return m_ctxRegGpuVirtAddr; }
@@ -260,6 +292,7 @@ protected:
 private:
 
     Result CreateUploadCmdBuffer();
+    void SetupRegisterWritePtrs(gpusize regGpuVirtAddr, uint32* pRegWritePtr);
 
     Device*const m_pDevice;
 
@@ -294,6 +327,15 @@ private:
                                    // destination type chosen.
     GpuHeap    m_pipelineHeapType; // The heap type where this pipeline is located.
 
+    Util::MetroHash::Hash  m_codeHash;            // Content hash of the code and data image.
+    bool                   m_sharesCode;          // The image is referenced through the PipelineCodeStore.
+    bool                   m_ownsCodeReservation; // This uploader is responsible for uploading the shared image.
+
+    GpuMemory*  m_pRegGpuMemory; // Separate allocation for LOAD_INDEX registers when code sharing is allowed.
+    gpusize     m_regBaseOffset;
+    gpusize     m_regGpuMemSize;
+    void*       m_pRegMappedPtr;
+
     PAL_DISALLOW_DEFAULT_CTOR(PipelineUploader);
     PAL_DISALLOW_COPY_AND_ASSIGN(PipelineUploader);
 };
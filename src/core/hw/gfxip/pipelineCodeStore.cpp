@@ -0,0 +1,174 @@
+
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2014-2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "core/device.h"
+#include "core/gpuMemory.h"
+#include "core/platform.h"
+#include "core/hw/gfxip/pipelineCodeStore.h"
+#include "palHashMapImpl.h"
+
+using namespace Util;
+
+namespace Pal
+{
+
+// =====================================================================================================================
+PipelineCodeStore::PipelineCodeStore(
+    Device* pDevice)
+    :
+    m_pDevice(pDevice),
+    m_entries(NumBuckets, pDevice->GetPlatform()),
+    m_initialized(false),
+    m_totalBytesSaved(0)
+{
+}
+
+// =====================================================================================================================
+PipelineCodeStore::~PipelineCodeStore()
+{
+    // Every pipeline must have released its reference before the device is destroyed.
+    PAL_ASSERT((m_initialized == false) || (m_entries.GetNumEntries() == 0));
+}
+
+// =====================================================================================================================
+Result PipelineCodeStore::Init()
+{
+    Result result = m_lock.Init();
+
+    if ((result == Result::Success) && (m_initialized == false))
+    {
+        result        = m_entries.Init();
+        m_initialized = (result == Result::Success);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Looks up an existing image with the given content hash.  If one is found and its upload has been submitted, a
+// reference is added on behalf of the caller and true is returned.  The caller must call Release() when its pipeline
+// is destroyed.
+bool PipelineCodeStore::Acquire(
+    const MetroHash::Hash& key,
+    PipelineCodeEntry*     pEntry)
+{
+    PAL_ASSERT(pEntry != nullptr);
+
+    MutexAuto lock(&m_lock);
+
+    PipelineCodeEntry*const pExisting = m_entries.FindKey(key);
+    const bool              found     = (pExisting != nullptr) && pExisting->ready;
+
+    if (found)
+    {
+        pExisting->refCount++;
+        m_totalBytesSaved += pExisting->size;
+
+        (*pEntry) = (*pExisting);
+    }
+
+    return found;
+}
+
+// =====================================================================================================================
+// Registers a newly allocated image with the given content hash, holding one reference on behalf of the caller.  The
+// image is not handed out by Acquire() until MarkReady() is called.  Returns false if another thread registered an
+// identical image first, in which case the caller keeps ownership of its allocation and must not call Release().
+bool PipelineCodeStore::Reserve(
+    const MetroHash::Hash& key,
+    GpuMemory*             pGpuMemory,
+    gpusize                offset,
+    gpusize                size)
+{
+    MutexAuto lock(&m_lock);
+
+    bool               existed = true;
+    PipelineCodeEntry* pEntry  = nullptr;
+
+    if ((m_entries.FindAllocate(key, &existed, &pEntry) == Result::Success) && (existed == false))
+    {
+        pEntry->pGpuMemory = pGpuMemory;
+        pEntry->offset     = offset;
+        pEntry->size       = size;
+        pEntry->refCount   = 1;
+        pEntry->ready      = false;
+    }
+
+    return (existed == false);
+}
+
+// =====================================================================================================================
+// Marks a reserved image as uploaded, making it available to other pipelines.
+void PipelineCodeStore::MarkReady(
+    const MetroHash::Hash& key)
+{
+    MutexAuto lock(&m_lock);
+
+    PipelineCodeEntry*const pEntry = m_entries.FindKey(key);
+    PAL_ASSERT(pEntry != nullptr);
+
+    pEntry->ready = true;
+}
+
+// =====================================================================================================================
+// Drops one reference to the image with the given content hash.  The image's GPU memory is freed along with the last
+// reference.
+void PipelineCodeStore::Release(
+    const MetroHash::Hash& key)
+{
+    GpuMemory* pGpuMemory = nullptr;
+    gpusize    offset     = 0;
+
+    {
+        MutexAuto lock(&m_lock);
+
+        PipelineCodeEntry*const pEntry = m_entries.FindKey(key);
+        PAL_ASSERT((pEntry != nullptr) && (pEntry->refCount > 0));
+
+        if ((pEntry != nullptr) && (--pEntry->refCount == 0))
+        {
+            pGpuMemory = pEntry->pGpuMemory;
+            offset     = pEntry->offset;
+            m_entries.Erase(key);
+        }
+    }
+
+    if (pGpuMemory != nullptr)
+    {
+        m_pDevice->MemMgr()->FreeGpuMem(pGpuMemory, offset);
+    }
+}
+
+// =====================================================================================================================
+// Returns the total number of bytes of GPU memory which pipelines have avoided allocating by reusing existing images.
+gpusize PipelineCodeStore::TotalBytesSaved() const
+{
+    MutexAuto lock(&m_lock);
+
+    return m_totalBytesSaved;
+}
+
+} // Pal
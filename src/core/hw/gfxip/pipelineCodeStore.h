@@ -0,0 +1,88 @@
+
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2014-2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#pragma once
+
+#include "palHashMap.h"
+#include "palMetroHash.h"
+#include "palMutex.h"
+#include "palSysMemory.h"
+
+namespace Pal
+{
+
+class  Device;
+class  GpuMemory;
+class  Platform;
+
+// Describes one uploaded pipeline code and data image which may be referenced by several pipelines.
+struct PipelineCodeEntry
+{
+    GpuMemory*  pGpuMemory;  // GPU memory holding the image.
+    gpusize     offset;      // Offset of the image within pGpuMemory.
+    gpusize     size;        // Size of the image, in bytes.
+    uint32      refCount;    // Number of pipelines referencing the image.
+    bool        ready;       // True once the image's upload has been submitted.
+};
+
+// =====================================================================================================================
+// Device-wide store of uploaded pipeline code and data images, keyed by a hash of their contents.  Pipelines which are
+// compiled from identical ELF binaries (or which merely contain identical code and data, such as the same shaders with
+// different register state) reference one GPU copy of the image instead of each uploading their own.
+//
+// All methods are thread-safe.
+class PipelineCodeStore
+{
+public:
+    explicit PipelineCodeStore(Device* pDevice);
+    ~PipelineCodeStore();
+
+    Result Init();
+
+    bool Acquire(const Util::MetroHash::Hash& key, PipelineCodeEntry* pEntry);
+    bool Reserve(const Util::MetroHash::Hash& key, GpuMemory* pGpuMemory, gpusize offset, gpusize size);
+    void MarkReady(const Util::MetroHash::Hash& key);
+    void Release(const Util::MetroHash::Hash& key);
+
+    gpusize TotalBytesSaved() const;
+
+private:
+    typedef Util::HashMap<Util::MetroHash::Hash, PipelineCodeEntry, Platform> EntryMap;
+
+    // The bucket count is arbitrary; applications typically keep at most a few thousand pipelines alive at once.
+    static constexpr uint32 NumBuckets = 256;
+
+    Device*const         m_pDevice;
+    mutable Util::Mutex  m_lock;
+    EntryMap             m_entries;
+    bool                 m_initialized;
+    gpusize              m_totalBytesSaved;
+
+    PAL_DISALLOW_DEFAULT_CTOR(PipelineCodeStore);
+    PAL_DISALLOW_COPY_AND_ASSIGN(PipelineCodeStore);
+};
+
+} // Pal
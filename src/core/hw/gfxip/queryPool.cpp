@@ -47,6 +47,7 @@ QueryPool::QueryPool(
     m_timestampSizePerSlotInBytes(tsSizeInBytes),
     m_boundSizeInBytes((querySizeInBytes + tsSizeInBytes) * createInfo.numSlots),
     m_device(device),
+    m_pPersistentCpuAddr(nullptr),
     m_timestampStartOffset(m_createInfo.numSlots * m_gpuResultSizePerSlotInBytes)
 {
     ResourceDescriptionQueryPool desc = {};
@@ -62,6 +63,12 @@ QueryPool::QueryPool(
 // =====================================================================================================================
 QueryPool::~QueryPool()
 {
+    if (m_pPersistentCpuAddr != nullptr)
+    {
+        const Result result = m_gpuMemory.Unmap();
+        PAL_ASSERT(result == Result::Success);
+    }
+
     ResourceDestroyEventData data = {};
     data.pObj = this;
     m_device.GetPlatform()->GetEventProvider()->LogGpuMemoryResourceDestroyEvent(data);
@@ -133,15 +140,7 @@ Result QueryPool::GetResults(
             void* pGpuData = nullptr;
             if (result == Result::Success)
             {
-                if (pMappedGpuAddr == nullptr)
-                {
-                    result = m_gpuMemory.Map(&pGpuData);
-                }
-                else
-                {
-                    // Use the mapped GPU memory that was supplied.
-                    pGpuData = const_cast<void*>(pMappedGpuAddr);
-                }
+                result = MapForCpuAccess(const_cast<void*>(pMappedGpuAddr), &pGpuData);
             }
 
             if (result == Result::Success)
@@ -155,12 +154,9 @@ Result QueryPool::GetResults(
                     result = Result::NotReady;
                 }
 
-                if (pMappedGpuAddr == nullptr)
-                {
-                    // Don't store the result from this as it will overwrite the result from retrieving the data.
-                    const Result unmapResult = m_gpuMemory.Unmap();
-                    PAL_ASSERT(unmapResult == Result::Success);
-                }
+                // Don't store the result from this as it will overwrite the result from retrieving the data.
+                const Result unmapResult = UnmapForCpuAccess(pMappedGpuAddr);
+                PAL_ASSERT(unmapResult == Result::Success);
             }
         }
         else
@@ -175,6 +171,83 @@ Result QueryPool::GetResults(
     return result;
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 573
+// =====================================================================================================================
+// Waits on the given fence and then computes the results without spinning on the query memory.
+Result QueryPool::GetResultsAfterFence(
+    const IFence&    fence,
+    uint64           timeoutNs,
+    QueryResultFlags flags,
+    QueryType        queryType,
+    uint32           startQuery,
+    uint32           queryCount,
+    size_t*          pDataSize,
+    void*            pData,
+    size_t           stride)
+{
+    Result result = Result::Success;
+
+    // There's no reason to wait if the caller only wants to know the size of the results.
+    if (pData != nullptr)
+    {
+        const IFence* pFence = &fence;
+
+        result = m_device.WaitForFences(1, &pFence, true, timeoutNs);
+    }
+
+    if (result == Result::Success)
+    {
+        // The fence guarantees that the GPU is done writing these slots, so there is no need for the per-counter
+        // spin loops in the hardware layer.
+        const auto resultFlags = static_cast<QueryResultFlags>(flags & ~QueryResultWait);
+
+        result = GetResults(resultFlags, queryType, startQuery, queryCount, nullptr, pDataSize, pData, stride);
+    }
+
+    return result;
+}
+#endif
+
+// =====================================================================================================================
+// Returns a CPU pointer to the start of the bound memory. Uses the client's mapping if there is one, otherwise the
+// persistent mapping if the pool has one, otherwise maps the memory.
+Result QueryPool::MapForCpuAccess(
+    void*  pMappedCpuAddr,
+    void** ppGpuData)
+{
+    Result result = Result::Success;
+
+    if (pMappedCpuAddr != nullptr)
+    {
+        (*ppGpuData) = pMappedCpuAddr;
+    }
+    else if (m_pPersistentCpuAddr != nullptr)
+    {
+        (*ppGpuData) = m_pPersistentCpuAddr;
+    }
+    else
+    {
+        result = m_gpuMemory.Map(ppGpuData);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Releases a CPU pointer returned by MapForCpuAccess.
+Result QueryPool::UnmapForCpuAccess(
+    const void* pMappedCpuAddr)
+{
+    Result result = Result::Success;
+
+    if ((pMappedCpuAddr == nullptr) && (m_pPersistentCpuAddr == nullptr))
+    {
+        result = m_gpuMemory.Unmap();
+    }
+
+    return result;
+}
+
 // =====================================================================================================================
 // Verifies that the specified slot is supported by this query pool.
 Result QueryPool::ValidateSlot(
@@ -210,8 +283,28 @@ Result QueryPool::BindGpuMemory(
 
     if (result == Result::Success)
     {
+        if (m_pPersistentCpuAddr != nullptr)
+        {
+            const Result unmapResult = m_gpuMemory.Unmap();
+            PAL_ASSERT(unmapResult == Result::Success);
+
+            m_pPersistentCpuAddr = nullptr;
+        }
+
         m_gpuMemory.Update(pGpuMemory, offset);
 
+        // Keep the new memory mapped until it's unbound if the client asked for it. If the memory can't be mapped we
+        // silently fall back to mapping it on every CPU access, which will report the error to the caller.
+        if (m_createInfo.flags.persistentlyMapped && m_gpuMemory.IsBound())
+        {
+            void* pCpuAddr = nullptr;
+
+            if (m_gpuMemory.Map(&pCpuAddr) == Result::Success)
+            {
+                m_pPersistentCpuAddr = pCpuAddr;
+            }
+        }
+
         GpuMemoryResourceBindEventData data = {};
         data.pObj = this;
         data.pGpuMemory = pGpuMemory;
@@ -258,12 +351,9 @@ Result QueryPool::DoReset(
 
     if (result == Result::Success)
     {
-        void* pGpuData = pMappedCpuAddr;
+        void* pGpuData = nullptr;
 
-        if (pGpuData == nullptr)
-        {
-            result = m_gpuMemory.Map(&pGpuData);
-        }
+        result = MapForCpuAccess(pMappedCpuAddr, &pGpuData);
 
         if (result == Result::Success)
         {
@@ -286,10 +376,7 @@ Result QueryPool::DoReset(
                 memset(pTimestampData, 0, timestampSize * queryCount);
             }
 
-            if (pMappedCpuAddr == nullptr)
-            {
-                result = m_gpuMemory.Unmap();
-            }
+            result = UnmapForCpuAccess(pMappedCpuAddr);
         }
     }
 
@@ -65,6 +65,21 @@ public:
         size_t           stride
         ) override;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 573
+    // NOTE: Part of the IQueryPool interface.
+    virtual Result GetResultsAfterFence(
+        const IFence&    fence,
+        uint64           timeoutNs,
+        QueryResultFlags flags,
+        QueryType        queryType,
+        uint32           startQuery,
+        uint32           queryCount,
+        size_t*          pDataSize,
+        void*            pData,
+        size_t           stride
+        ) override;
+#endif
+
     virtual Result Reset(
         uint32  startQuery,
         uint32  queryCount,
@@ -132,6 +147,9 @@ protected:
 
     Result ValidateSlot(uint32 slot) const;
 
+    Result MapForCpuAccess(void* pMappedCpuAddr, void** ppGpuData);
+    Result UnmapForCpuAccess(const void* pMappedCpuAddr);
+
     virtual size_t GetResultSizeForOneSlot(QueryResultFlags flags) const = 0;
     virtual bool ComputeResults(
         QueryResultFlags flags,
@@ -158,6 +176,7 @@ protected:
 
 private:
     const Device& m_device;
+    void*         m_pPersistentCpuAddr;          // CPU address of the bound memory if the pool is persistently mapped.
     const gpusize m_timestampStartOffset;        // Start offset of the timestamp. The timestamps are located at the end of
                                                  // all the query slots. QueryTimestampEnd is written to the timestamp
                                                  // address when the End() is called. And in WaitForSlots() we wait for
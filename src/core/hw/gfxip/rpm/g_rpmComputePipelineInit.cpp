@@ -57,15 +57,10 @@ Result CreateRpmComputePipeline(
 }
 
 // =====================================================================================================================
-// Creates all compute pipeline objects required by RsrcProcMgr.
-Result CreateRpmComputePipelines(
-    GfxDevice*        pDevice,
-    ComputePipeline** pPipelineMem)
+// Returns the table of RPM compute pipeline binaries for the device's ASIC, or null if the ASIC is unsupported.
+static const PipelineBinary* GetRpmComputeBinaryTable(
+    const GpuChipProperties& properties)
 {
-    Result result = Result::Success;
-
-    const GpuChipProperties& properties = pDevice->Parent()->ChipProperties();
-
     const PipelineBinary* pTable = nullptr;
 
     switch (properties.revision)
@@ -141,11 +136,55 @@ Result CreateRpmComputePipelines(
         break;
 
     default:
-        result = Result::ErrorUnknown;
         PAL_NOT_IMPLEMENTED();
         break;
     }
 
+    return pTable;
+}
+
+// =====================================================================================================================
+// Creates a single compute pipeline object required by RsrcProcMgr.  This is used to create pipelines on demand rather
+// than all at once during device initialization.
+Result CreateRpmComputePipeline(
+    RpmComputePipeline pipelineType,
+    GfxDevice*         pDevice,
+    ComputePipeline**  ppPipeline)
+{
+    Result result = Result::ErrorUnknown;
+
+    const PipelineBinary*const pTable = GetRpmComputeBinaryTable(pDevice->Parent()->ChipProperties());
+    const uint32               index  = static_cast<uint32>(pipelineType);
+
+    if ((pTable != nullptr) && (pTable[index].pBuffer != nullptr))
+    {
+        ComputePipelineCreateInfo pipeInfo = { };
+        pipeInfo.pPipelineBinary    = pTable[index].pBuffer;
+        pipeInfo.pipelineBinarySize = pTable[index].size;
+
+        result = pDevice->CreateComputePipelineInternal(pipeInfo, ppPipeline, AllocInternal);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Creates all compute pipeline objects required by RsrcProcMgr.
+Result CreateRpmComputePipelines(
+    GfxDevice*        pDevice,
+    ComputePipeline** pPipelineMem)
+{
+    Result result = Result::Success;
+
+    const GpuChipProperties& properties = pDevice->Parent()->ChipProperties();
+
+    const PipelineBinary*const pTable = GetRpmComputeBinaryTable(properties);
+
+    if (pTable == nullptr)
+    {
+        result = Result::ErrorUnknown;
+    }
+
     if (result == Result::Success)
     {
         result = CreateRpmComputePipeline(
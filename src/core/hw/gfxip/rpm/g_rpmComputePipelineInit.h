@@ -156,5 +156,6 @@ enum class RpmComputePipeline : uint32
 };
 
 Result CreateRpmComputePipelines(GfxDevice* pDevice, ComputePipeline** pPipelineMem);
+Result CreateRpmComputePipeline(RpmComputePipeline pipelineType, GfxDevice* pDevice, ComputePipeline** ppPipeline);
 
 } // Pal
@@ -45,6 +45,8 @@
 #include "palFormatInfo.h"
 #include "palMsaaState.h"
 #include "palInlineFuncs.h"
+#include "palJobSystemImpl.h"
+#include "palSysUtil.h"
 
 #include <float.h>
 #include <math.h>
@@ -54,6 +56,24 @@ using namespace Util;
 namespace Pal
 {
 
+// Compute pipelines used by nearly every client, even ones which only copy buffers and images.  In prewarm mode these
+// are created on worker threads during LateInit() so that their first use doesn't stall.
+static constexpr RpmComputePipeline PrewarmComputePipelines[] =
+{
+    RpmComputePipeline::ClearBuffer,
+    RpmComputePipeline::ClearImage2d,
+    RpmComputePipeline::CopyBufferByte,
+    RpmComputePipeline::CopyBufferDword,
+    RpmComputePipeline::CopyImage2d,
+    RpmComputePipeline::CopyImgToMem2d,
+    RpmComputePipeline::CopyMemToImg2d,
+    RpmComputePipeline::CopyTypedBuffer2d,
+    RpmComputePipeline::FillMem4xDword,
+    RpmComputePipeline::FillMemDword,
+    RpmComputePipeline::ResolveOcclusionQuery,
+    RpmComputePipeline::ResolvePipelineStatsQuery,
+};
+
 static void PreComputeColorClearSync(ICmdBuffer* pCmdBuffer);
 static void PostComputeColorClearSync(ICmdBuffer* pCmdBuffer);
 
@@ -74,11 +94,19 @@ RsrcProcMgr::RsrcProcMgr(
     m_pStencilResolveState(nullptr),
     m_pDepthStencilResolveState(nullptr),
     m_pDevice(pDevice),
-    m_srdAlignment(0)
+    m_srdAlignment(0),
+    m_computePipelineResult(Result::Success),
+    m_pPlaceholderPipeline(nullptr),
+    m_prewarmNext(0)
 {
     memset(&m_pMsaaState[0], 0, sizeof(m_pMsaaState));
-    memset(&m_pComputePipelines[0], 0, sizeof(m_pComputePipelines));
     memset(&m_pGraphicsPipelines[0], 0, sizeof(m_pGraphicsPipelines));
+    memset(&m_computePipelineFailed[0], 0, sizeof(m_computePipelineFailed));
+
+    for (uint32 idx = 0; idx < static_cast<uint32>(RpmComputePipeline::Count); ++idx)
+    {
+        m_pComputePipelines[idx].store(nullptr, std::memory_order_relaxed);
+    }
 }
 
 // =====================================================================================================================
@@ -87,9 +115,11 @@ RsrcProcMgr::~RsrcProcMgr()
     // These objects must be destroyed in Cleanup().
     for (uint32 idx = 0; idx < static_cast<uint32>(RpmComputePipeline::Count); ++idx)
     {
-        PAL_ASSERT(m_pComputePipelines[idx] == nullptr);
+        PAL_ASSERT(m_pComputePipelines[idx].load(std::memory_order_relaxed) == nullptr);
     }
 
+    PAL_ASSERT(m_pPlaceholderPipeline == nullptr);
+
     for (uint32 idx = 0; idx < RpmGfxPipelineCount; ++idx)
     {
         PAL_ASSERT(m_pGraphicsPipelines[idx] == nullptr);
@@ -121,16 +151,30 @@ RsrcProcMgr::~RsrcProcMgr()
 // this object.
 void RsrcProcMgr::Cleanup()
 {
+    // The prewarm threads publish into m_pComputePipelines so they must be finished before it is torn down.  They are
+    // normally joined by LateInit(), but LateInit() may not have run to completion.
+    JoinPrewarmThreads();
+
     // Destroy all compute pipeline objects.
     for (uint32 idx = 0; idx < static_cast<uint32>(RpmComputePipeline::Count); ++idx)
     {
-        if (m_pComputePipelines[idx] != nullptr)
+        ComputePipeline*const pPipeline = m_pComputePipelines[idx].exchange(nullptr, std::memory_order_acquire);
+
+        if (pPipeline != nullptr)
         {
-            m_pComputePipelines[idx]->DestroyInternal();
-            m_pComputePipelines[idx] = nullptr;
+            pPipeline->DestroyInternal();
         }
     }
 
+    if (m_pPlaceholderPipeline != nullptr)
+    {
+        m_pPlaceholderPipeline->DestroyInternal();
+        m_pPlaceholderPipeline = nullptr;
+    }
+
+    memset(&m_computePipelineFailed[0], 0, sizeof(m_computePipelineFailed));
+    m_computePipelineResult.store(Result::Success, std::memory_order_relaxed);
+
     // Destroy all graphics pipeline objects.
     for (uint32 idx = 0; idx < RpmGfxPipelineCount; ++idx)
     {
@@ -189,7 +233,7 @@ Result RsrcProcMgr::EarlyInit()
     // Round up to the size of a DWORD.
     m_srdAlignment = Util::NumBytesToNumDwords(m_srdAlignment);
 
-    return Result::Success;
+    return m_computePipelineLock.Init();
 }
 
 // =====================================================================================================================
@@ -200,7 +244,31 @@ Result RsrcProcMgr::LateInit()
 
     if (m_pDevice->Parent()->GetPublicSettings()->disableResourceProcessingManager == false)
     {
-        result = CreateRpmComputePipelines(m_pDevice, m_pComputePipelines);
+        const RpmPipelineCreateMode createMode = m_pDevice->Parent()->Settings().rpmPipelineCreateMode;
+
+        // The graphics pipelines are always created up front; in the other modes the compute pipelines are created by
+        // GetPipeline() the first time each one is needed.
+        if (createMode == RpmPipelineCreateEager)
+        {
+            ComputePipeline* pPipelines[static_cast<size_t>(RpmComputePipeline::Count)] = { };
+
+            result = CreateRpmComputePipelines(m_pDevice, &pPipelines[0]);
+
+            for (uint32 idx = 0; idx < static_cast<uint32>(RpmComputePipeline::Count); ++idx)
+            {
+                m_pComputePipelines[idx].store(pPipelines[idx], std::memory_order_relaxed);
+            }
+        }
+        else
+        {
+            // The placeholder only needs to be a valid compute pipeline; any small RPM pipeline will do.
+            result = CreateRpmComputePipeline(RpmComputePipeline::CopyBufferByte, m_pDevice, &m_pPlaceholderPipeline);
+
+            if ((result == Result::Success) && (createMode == RpmPipelineCreatePrewarm))
+            {
+                StartPrewarmThreads();
+            }
+        }
 
         if (result == Result::Success)
         {
@@ -212,11 +280,159 @@ Result RsrcProcMgr::LateInit()
             result = CreateCommonStateObjects();
         }
 
+        // The prewarm threads overlap with the rest of LateInit(), but they must be finished before the device is
+        // finalized so that a failure to create any of the common pipelines is reported here.
+        JoinPrewarmThreads();
+
+        if (result == Result::Success)
+        {
+            result = ComputePipelineResult();
+        }
+
     }
 
     return result;
 }
 
+// =====================================================================================================================
+// Returns true if the given pipeline is the placeholder which RPM binds in place of a compute pipeline that could not
+// be created.  Command buffers use this to discard the internal operation and report the failure.
+bool RsrcProcMgr::IsPlaceholderPipeline(
+    const Pipeline* pPipeline
+    ) const
+{
+    return ((m_pPlaceholderPipeline != nullptr) && (pPipeline == m_pPlaceholderPipeline));
+}
+
+// =====================================================================================================================
+// Creates an RPM compute pipeline which wasn't created during LateInit().  Concurrent callers may each build a copy of
+// the same pipeline; only the first one to finish is published and the rest are destroyed.  If the pipeline can't be
+// created, the failure is latched and the placeholder pipeline is returned from then on.
+const ComputePipeline* RsrcProcMgr::CreatePipelineOnFirstUse(
+    RpmComputePipeline pipeline
+    ) const
+{
+    const uint32           index     = static_cast<uint32>(pipeline);
+    const ComputePipeline* pResult   = nullptr;
+    ComputePipeline*       pPipeline = nullptr;
+    bool                   failed    = false;
+
+    {
+        MutexAuto lock(&m_computePipelineLock);
+        failed = m_computePipelineFailed[index];
+    }
+
+    Result result = failed ? Result::ErrorUnknown : CreateRpmComputePipeline(pipeline, m_pDevice, &pPipeline);
+
+    if ((failed == false) && (result == Result::Success))
+    {
+        // The caller is about to record a dispatch with this pipeline, so its upload can't wait for the client to
+        // close an open pipeline upload batch.
+        result = m_pDevice->Parent()->FlushPipelineUploadBatch();
+    }
+
+    MutexAuto lock(&m_computePipelineLock);
+
+    if (result == Result::Success)
+    {
+        ComputePipeline* pExisting = nullptr;
+
+        if (m_pComputePipelines[index].compare_exchange_strong(pExisting, pPipeline, std::memory_order_release))
+        {
+            pResult = pPipeline;
+        }
+        else
+        {
+            // Another thread published its copy first.
+            pPipeline->DestroyInternal();
+            pResult = pExisting;
+        }
+    }
+    else
+    {
+        if (pPipeline != nullptr)
+        {
+            pPipeline->DestroyInternal();
+        }
+
+        if (failed == false)
+        {
+            PAL_ALERT_ALWAYS();
+
+            m_computePipelineFailed[index] = true;
+
+            Result expected = Result::Success;
+            m_computePipelineResult.compare_exchange_strong(expected, result, std::memory_order_release);
+        }
+
+        pResult = m_pPlaceholderPipeline;
+    }
+
+    return pResult;
+}
+
+// =====================================================================================================================
+// Starts creating the commonly used compute pipelines in the background.  They are handed to the platform's job system
+// if it has workers; otherwise dedicated threads are launched.  If a thread can't be started, its share of the
+// pipelines is picked up by the other workers or created on first use.
+void RsrcProcMgr::StartPrewarmThreads()
+{
+    m_prewarmNext = 0;
+
+    JobSystem<Platform>*const pJobSystem = m_pDevice->GetPlatform()->GetJobSystem();
+
+    if (pJobSystem->NumWorkers() > 0)
+    {
+        // Each job claims pipelines from the prewarm list until it is exhausted, so one job per worker is enough.
+        const uint32 numJobs = Min(pJobSystem->NumWorkers(), static_cast<uint32>(ArrayLen(PrewarmComputePipelines)));
+
+        for (uint32 idx = 0; idx < numJobs; ++idx)
+        {
+            pJobSystem->Submit(&PrewarmThreadFunc, this, &m_prewarmJobs);
+        }
+    }
+    else
+    {
+        for (uint32 idx = 0; idx < NumPrewarmThreads; ++idx)
+        {
+            if (m_prewarmThreads[idx].Begin(&PrewarmThreadFunc, this) != Result::Success)
+            {
+                break;
+            }
+        }
+    }
+}
+
+// =====================================================================================================================
+// Waits for the prewarm jobs or worker threads to finish.  This is safe to call if prewarming was never started.
+void RsrcProcMgr::JoinPrewarmThreads()
+{
+    // The waiting thread helps with any prewarm jobs which no worker has picked up yet.
+    m_pDevice->GetPlatform()->GetJobSystem()->Wait(&m_prewarmJobs);
+
+    for (uint32 idx = 0; idx < NumPrewarmThreads; ++idx)
+    {
+        m_prewarmThreads[idx].Join();
+    }
+}
+
+// =====================================================================================================================
+// Entry point for the prewarm jobs and worker threads.  Each one claims entries from the prewarm list until it is
+// exhausted.
+void RsrcProcMgr::PrewarmThreadFunc(
+    void* pParam)
+{
+    RsrcProcMgr*const pThis = static_cast<RsrcProcMgr*>(pParam);
+
+    uint32 idx = (AtomicIncrement(&pThis->m_prewarmNext) - 1);
+
+    while (idx < ArrayLen(PrewarmComputePipelines))
+    {
+        pThis->GetPipeline(PrewarmComputePipelines[idx]);
+        idx = (AtomicIncrement(&pThis->m_prewarmNext) - 1);
+    }
+}
+
 // =====================================================================================================================
 // Builds commands to copy one or more regions from one GPU memory location to another with a compute shader.
 void RsrcProcMgr::CopyMemoryCs(
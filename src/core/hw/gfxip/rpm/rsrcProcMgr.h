@@ -28,6 +28,10 @@
 #include "core/hw/gfxip/rpm/g_rpmComputePipelineInit.h"
 #include "core/hw/gfxip/rpm/g_rpmGfxPipelineInit.h"
 #include "palCmdBuffer.h"
+#include "palJobSystem.h"
+#include "palMutex.h"
+#include "palThread.h"
+#include <atomic>
 
 namespace Pal
 {
@@ -67,6 +71,9 @@ public:
     Result LateInit();
     void Cleanup();
 
+    bool IsPlaceholderPipeline(const Pipeline* pPipeline) const;
+    Result ComputePipelineResult() const { return m_computePipelineResult.load(std::memory_order_acquire); }
+
     void CmdCopyImage(
         GfxCmdBuffer*          pCmdBuffer,
         const Image&           srcImage,
@@ -279,8 +286,15 @@ protected:
         const IndirectCmdGenerator& generator,
         const CmdBuffer&            cmdBuffer) const = 0;
 
+    // Compute pipelines may be created on first use, depending on the RpmPipelineCreateMode setting.  Once published,
+    // a pipeline pointer never changes until Cleanup() so the common case is a single load.  If a pipeline could not be
+    // created this returns the placeholder pipeline; see IsPlaceholderPipeline().
     const ComputePipeline* GetPipeline(RpmComputePipeline pipeline) const
-        { return m_pComputePipelines[static_cast<size_t>(pipeline)]; }
+    {
+        const ComputePipeline* pPipeline =
+            m_pComputePipelines[static_cast<size_t>(pipeline)].load(std::memory_order_acquire);
+        return (pPipeline != nullptr) ? pPipeline : CreatePipelineOnFirstUse(pipeline);
+    }
 
     const GraphicsPipeline* GetGfxPipeline(RpmGfxPipeline pipeline) const
         { return m_pGraphicsPipelines[pipeline]; }
@@ -623,9 +637,36 @@ private:
     GfxDevice*const  m_pDevice;
     uint32           m_srdAlignment; // All SRDs must be offset and size aligned to this many DWORDs.
 
-    // All internal RPM pipelines are stored here.
-    ComputePipeline*   m_pComputePipelines[static_cast<size_t>(RpmComputePipeline::Count)];
-    GraphicsPipeline*  m_pGraphicsPipelines[RpmGfxPipelineCount];
+    // All internal RPM pipelines are stored here.  Compute pipelines which are created after LateInit() are published
+    // with release semantics so that GetPipeline() can read the table without taking a lock.
+    mutable std::atomic<ComputePipeline*>  m_pComputePipelines[static_cast<size_t>(RpmComputePipeline::Count)];
+    GraphicsPipeline*                      m_pGraphicsPipelines[RpmGfxPipelineCount];
+
+    const ComputePipeline* CreatePipelineOnFirstUse(RpmComputePipeline pipeline) const;
+    void StartPrewarmThreads();
+    void JoinPrewarmThreads();
+    static void PrewarmThreadFunc(void* pParam);
+
+    // Serializes publication of compute pipelines which are created after LateInit().
+    mutable Util::Mutex  m_computePipelineLock;
+
+    // Compute pipelines which failed to be created on first use.  The failure is latched so that later lookups don't
+    // retry the creation; they return m_pPlaceholderPipeline instead.  Protected by m_computePipelineLock.
+    mutable bool                 m_computePipelineFailed[static_cast<size_t>(RpmComputePipeline::Count)];
+    mutable std::atomic<Result>  m_computePipelineResult; // The first failure of an on-demand pipeline creation.
+
+    // A private copy of one RPM compute pipeline, created in LateInit() when compute pipelines are created on demand.
+    // It stands in for pipelines which could not be created so that RPM never dereferences a null pipeline; command
+    // buffers which bind it skip the internal dispatches and report m_computePipelineResult when recording ends.
+    ComputePipeline*  m_pPlaceholderPipeline;
+
+    // Worker threads which create the commonly used compute pipelines in the background when prewarming is enabled
+    // and the platform's job system has no workers to do it.
+    static constexpr uint32 NumPrewarmThreads = 4;
+
+    Util::Thread     m_prewarmThreads[NumPrewarmThreads];
+    Util::JobGroup   m_prewarmJobs;  // Prewarm jobs submitted to the platform's job system.
+    volatile uint32  m_prewarmNext; // Index of the next entry in the prewarm list to be claimed by a worker.
 
     PAL_DISALLOW_DEFAULT_CTOR(RsrcProcMgr);
     PAL_DISALLOW_COPY_AND_ASSIGN(RsrcProcMgr);
@@ -94,7 +94,7 @@ Result ShaderLibrary::InitFromCodeObjectBinary(
     PAL_ASSERT((m_pCodeObjectBinary != nullptr) && (m_codeObjectBinaryLen != 0));
 
     AbiProcessor abiProcessor(m_pDevice->GetPlatform());
-    Result result = abiProcessor.LoadFromBuffer(m_pCodeObjectBinary, m_codeObjectBinaryLen);
+    Result result = abiProcessor.LoadFromBufferView(m_pCodeObjectBinary, m_codeObjectBinaryLen);
 
     MsgPackReader      metadataReader;
     CodeObjectMetadata metadata;
@@ -146,7 +146,7 @@ Result ShaderLibrary::PerformRelocationsAndUploadToGpuMemory(
     m_perfDataGpuMemSize = performanceDataOffset;
     Result result        = Result::Success;
 
-    result = pUploader->Begin(abiProcessor, metadata, clientPreferredHeap);
+    result = pUploader->Begin(abiProcessor, metadata, clientPreferredHeap, false);
 
     if (result == Result::Success)
     {
@@ -264,6 +264,8 @@ void UniversalCmdBuffer::CmdBindPipeline(
 {
     if (params.pipelineBindPoint == PipelineBindPoint::Compute)
     {
+        CheckInternalComputePipeline(params.pPipeline);
+
         m_computeState.dynamicCsInfo            = params.cs;
         m_computeState.pipelineState.pPipeline  = static_cast<const Pipeline*>(params.pPipeline);
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 471
@@ -1013,6 +1013,11 @@ Result Image::BindGpuMemory(
         data.requiredGpuMemSize = m_gpuMemSize;
         data.offset = offset;
         m_pDevice->GetPlatform()->GetEventProvider()->LogGpuMemoryResourceBindEvent(data);
+
+        if (m_pGfxImage != nullptr)
+        {
+            m_pGfxImage->OnGpuMemoryBound();
+        }
     }
 
     UpdateMetaDataInfo(pGpuMemory);
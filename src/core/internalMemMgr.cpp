@@ -190,9 +190,15 @@ Result InternalMemMgr::AllocateGpuMem(
     GpuMemory**                         ppGpuMemory,
     gpusize*                            pOffset)
 {
-    Util::MutexAuto allocatorLock(&m_allocatorLock); // Ensure thread-safety using the lock
+    // Ensure thread-safety using the lock. This lock is shared by every thread which creates internal objects or
+    // command chunks so it is worth tracking how often it is contended.
+    m_pDevice->LockAndTrackContention(&m_allocatorLock);
 
-    return AllocateGpuMemNoAllocLock(createInfo, internalInfo, readOnly, ppGpuMemory, pOffset);
+    const Result result = AllocateGpuMemNoAllocLock(createInfo, internalInfo, readOnly, ppGpuMemory, pOffset);
+
+    m_allocatorLock.Unlock();
+
+    return result;
 }
 
 // =====================================================================================================================
@@ -551,4 +557,25 @@ uint32 InternalMemMgr::GetReferencesCount()
     return static_cast<uint32>(m_references.NumElements());
 }
 
+// =====================================================================================================================
+// Reports the number of pools, their total size and the number of suballocations made from them.
+void InternalMemMgr::GetPoolUsage(
+    InternalMemPoolUsage* pUsage)
+{
+    PAL_ASSERT(pUsage != nullptr);
+
+    MutexAuto allocatorLock(&m_allocatorLock);
+
+    pUsage->poolCount          = 0;
+    pUsage->poolBytes          = 0;
+    pUsage->suballocationCount = 0;
+
+    for (auto it = m_poolList.Begin(); it.Get() != nullptr; it.Next())
+    {
+        pUsage->poolCount++;
+        pUsage->poolBytes          += PoolAllocationSize;
+        pUsage->suballocationCount += it.Get()->pBuddyAllocator->NumSuballocations();
+    }
+}
+
 } // Pal
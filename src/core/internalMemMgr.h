@@ -57,6 +57,14 @@ struct GpuMemoryPool
     Util::BuddyAllocator<Platform>* pBuddyAllocator;        // Buddy allocator used for the suballocation
 };
 
+// Snapshot of how much of the internal suballocation pools is in use.
+struct InternalMemPoolUsage
+{
+    uint32  poolCount;          // Number of base allocations currently backing the pools
+    gpusize poolBytes;          // Total size of those base allocations
+    uint32  suballocationCount; // Number of live suballocations across all pools
+};
+
 // =====================================================================================================================
 // InternalMemMgr is responsible for managing internal memory allocations (either PAL-internal or
 // client-driver-internal) and tracks the list of the memory objects which need to be referenced by each command buffer
@@ -115,6 +123,9 @@ public:
     // Number of all allocations in the reference list. Note that this function takes the reference list lock.
     uint32 GetReferencesCount();
 
+    // Reports the current pool occupancy. Note that this function takes the allocator lock.
+    void GetPoolUsage(InternalMemPoolUsage* pUsage);
+
 private:
     Result AllocateBaseGpuMem(
         const GpuMemoryCreateInfo&          createInfo,
@@ -1972,6 +1972,11 @@ static const char* BarrierReasonToString(
     case Developer::BarrierReasonFlushL2CachedData:
         pStr = "BarrierReasonFlushL2CachedData";
         break;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 573
+    case Developer::BarrierReasonDeferredSyncs:
+        pStr = "BarrierReasonDeferredSyncs";
+        break;
+#endif
     case Developer::BarrierReasonUnknown:
         pStr = "BarrierReasonUnknown";
         break;
@@ -1980,8 +1985,13 @@ static const char* BarrierReasonToString(
         pStr = nullptr;
         break;
     }
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 573
+    static_assert(Developer::BarrierReasonInternalLastDefined - 1 == Developer::BarrierReasonDeferredSyncs,
+                  "Barrier reason strings need to be updated!");
+#else
     static_assert(Developer::BarrierReasonInternalLastDefined - 1 == Developer::BarrierReasonFlushL2CachedData,
                   "Barrier reason strings need to be updated!");
+#endif
     return pStr;
 }
 
@@ -2462,6 +2472,24 @@ void CmdBuffer::DescribeBarrier(
 
         GetNextLayer()->CmdCommentString("}");
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 573
+        if (pData->operations.coalescing.barriersMerged != 0)
+        {
+            LinearAllocatorAuto<VirtualLinearAllocator> allocator(Allocator(), false);
+
+            char* pString = PAL_NEW_ARRAY(char, StringLength, &allocator, AllocInternalTemp);
+
+            Snprintf(&pString[0], StringLength,
+                "Coalescing = { barriersMerged: %u, pm4BytesSaved: %u }",
+                pData->operations.coalescing.barriersMerged,
+                pData->operations.coalescing.pm4BytesSaved);
+
+            GetNextLayer()->CmdCommentString(pString);
+
+            PAL_SAFE_DELETE_ARRAY(pString, &allocator);
+        }
+#endif
+
         switch (pData->type)
         {
         case Developer::BarrierType::Full:
@@ -242,6 +242,10 @@ void PAL_STDCALL Platform::CmdBufferLoggerCb(
         break;
     }
 #endif
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 573
+    case Developer::CallbackType::PipelineCodeReuse:
+        break;
+#endif
 #if PAL_BUILD_PM4_INSTRUMENTOR
     case Developer::CallbackType::DrawDispatchValidation:
         PAL_ASSERT(pCbData != nullptr);
@@ -251,6 +255,10 @@ void PAL_STDCALL Platform::CmdBufferLoggerCb(
         PAL_ASSERT(pCbData != nullptr);
         TranslateOptimizedRegistersData(pCbData);
         break;
+    case Developer::CallbackType::NestedCmdBufferReuse:
+        PAL_ASSERT(pCbData != nullptr);
+        TranslateNestedCmdBufferReuseData(pCbData);
+        break;
 #endif
     default:
         PAL_ASSERT_ALWAYS();
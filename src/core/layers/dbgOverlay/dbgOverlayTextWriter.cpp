@@ -314,12 +314,19 @@ void TextWriter::WriteVisualConfirm(
         break;
     }
 
-    // Draw each line of text.
+    // Draw all lines of text in one batch.
+    GpuUtil::TextDrawInfo texts[MaxTextLines];
+
     for (uint32 i = 0; i < textLines; i++)
     {
-        m_textWriter.DrawDebugText(dstImage, pCmdBuffer, &overlayText[i][0], x, y);
+        texts[i].pText = &overlayText[i][0];
+        texts[i].x     = x;
+        texts[i].y     = y;
+
         y += GpuUtil::TextWriterFont::LetterHeight;
     }
+
+    m_textWriter.DrawDebugTextBatch(dstImage, pCmdBuffer, textLines, &texts[0]);
 }
 
 } // DbgOverlay
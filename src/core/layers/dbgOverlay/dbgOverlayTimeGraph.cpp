@@ -194,29 +194,31 @@ void TimeGraph::DrawVisualConfirm(
         Util::AutoBuffer<uint32, 100, PlatformDecorator> dataValues(timeCount,
                                                                     static_cast<Platform*>(m_pDevice->GetPlatform()));
 
-        for (uint32 i = 0; i < timeCount; i++)
-        {
-            dataValues[i] = 0;
-        }
+        // The grid is made of a reference line for the x-axis at Y = 0 and reference markers parallel to the x-axis at
+        // Y = 100 and Y = 200.  Draw all of them in one batch.
+        constexpr uint32 GridLineCount = 3;
+        constexpr uint32 GridValues[GridLineCount] = { 0, 100, 200 };
 
-        // Draw reference line for x-axis at Y = 0
-        m_timegraph.DrawGraphLine(dstImage, pCmdBuffer, &dataValues[0], x, y, gridLineColor, timeCount);
-
-        for (uint32 i = 0; i < timeCount; i++)
-        {
-            dataValues[i] = 100;
-        }
+        Util::AutoBuffer<uint32, 300, PlatformDecorator> gridValues(timeCount * GridLineCount,
+                                                                    static_cast<Platform*>(m_pDevice->GetPlatform()));
 
-        // Draw refernce marker parallel to the x-axis at Y = 100
-        m_timegraph.DrawGraphLine(dstImage, pCmdBuffer, &dataValues[0], x, y, gridLineColor, timeCount);
+        GpuUtil::TimeGraphLineInfo gridLines[GridLineCount] = {};
 
-        for (uint32 i = 0; i < timeCount; i++)
+        for (uint32 line = 0; line < GridLineCount; line++)
         {
-            dataValues[i] = 200;
+            for (uint32 i = 0; i < timeCount; i++)
+            {
+                gridValues[(line * timeCount) + i] = GridValues[line];
+            }
+
+            gridLines[line].pTimeData     = &gridValues[line * timeCount];
+            gridLines[line].xPosition     = x;
+            gridLines[line].yPosition     = y;
+            gridLines[line].pLineColor    = gridLineColor;
+            gridLines[line].numDataPoints = timeCount;
         }
 
-        // Draw refernce marker parallel to the x-axis at Y = 200
-        m_timegraph.DrawGraphLine(dstImage, pCmdBuffer, &dataValues[0], x, y, gridLineColor, timeCount);
+        m_timegraph.DrawGraphLines(dstImage, pCmdBuffer, GridLineCount, &gridLines[0]);
 
         // Issue a barrier to ensure the line drawn via CS is complete.
         BarrierInfo gridBarrier = {};
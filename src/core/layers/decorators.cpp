@@ -2394,6 +2394,9 @@ void PAL_STDCALL PlatformDecorator::DefaultDeveloperCb(
     case Developer::CallbackType::CreateImage:
     case Developer::CallbackType::BarrierBegin:
     case Developer::CallbackType::BarrierEnd:
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 573
+    case Developer::CallbackType::PipelineCodeReuse:
+#endif
         break;
 
     default:
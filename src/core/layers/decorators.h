@@ -235,6 +235,20 @@ static bool TranslateOptimizedRegistersData(
 
     return hasValidData;
 }
+
+// =====================================================================================================================
+// Returns true if the PreviousObject was non-null, and thus the pData->pCmdBuffer data is valid for this layer.
+static bool TranslateNestedCmdBufferReuseData(
+    void* pCbData)
+{
+    auto*const pData = static_cast<Developer::NestedCmdBufferReuseData*>(pCbData);
+
+    ICmdBuffer* pPrevCmdBuffer = PreviousObject(pData->pCmdBuffer);
+    const bool  hasValidData   = (pPrevCmdBuffer != nullptr);
+    pData->pCmdBuffer          = (hasValidData) ? pPrevCmdBuffer : pData->pCmdBuffer;
+
+    return hasValidData;
+}
 #endif
 
 // =====================================================================================================================
@@ -838,6 +852,14 @@ public:
         void*                             pPlacementAddr,
         IPipeline**                       ppPipeline) override;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 573
+    virtual Result BeginPipelineUploadBatch() override
+        { return m_pNextLayer->BeginPipelineUploadBatch(); }
+
+    virtual Result EndPipelineUploadBatch() override
+        { return m_pNextLayer->EndPipelineUploadBatch(); }
+#endif
+
     virtual size_t GetMsaaStateSize(
         const MsaaStateCreateInfo& createInfo,
         Result*                    pResult) const override;
@@ -2695,6 +2717,30 @@ public:
                                             stride);
         }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 573
+    virtual Result GetResultsAfterFence(
+        const IFence&    fence,
+        uint64           timeoutNs,
+        QueryResultFlags flags,
+        QueryType        queryType,
+        uint32           startQuery,
+        uint32           queryCount,
+        size_t*          pDataSize,
+        void*            pData,
+        size_t           stride) override
+        {
+            return m_pNextLayer->GetResultsAfterFence(*NextFence(&fence),
+                                                      timeoutNs,
+                                                      flags,
+                                                      queryType,
+                                                      startQuery,
+                                                      queryCount,
+                                                      pDataSize,
+                                                      pData,
+                                                      stride);
+        }
+#endif
+
     virtual Result Reset(
         uint32  startQuery,
         uint32  queryCount,
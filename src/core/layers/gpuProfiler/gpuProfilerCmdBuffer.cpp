@@ -3814,6 +3814,10 @@ void CmdBuffer::ReplayCmdSetViewInstanceMask(
     pTgtCmdBuffer->CmdSetViewInstanceMask(mask);
 }
 
+// The replay allocator holds the recorded tokens of a whole command buffer, so it grows quickly and benefits from
+// committing large blocks backed by huge pages.
+static constexpr VirtualLinearAllocatorPolicy TargetAllocatorPolicy = { 256 * 1024, 0, true };
+
 // =====================================================================================================================
 TargetCmdBuffer::TargetCmdBuffer(
     const CmdBufferCreateInfo& createInfo,
@@ -3822,9 +3826,9 @@ TargetCmdBuffer::TargetCmdBuffer(
     :
     CmdBufferFwdDecorator(pNextCmdBuffer, pNextDevice),
 #if (PAL_COMPILE_TYPE == 32)
-    m_allocator(2 * 1024 * 1024),
+    m_allocator(2 * 1024 * 1024, TargetAllocatorPolicy),
 #else
-    m_allocator(8 * 1024 * 1024),
+    m_allocator(8 * 1024 * 1024, TargetAllocatorPolicy),
 #endif
     m_pAllocatorStream(nullptr),
     m_pCurrentBarrierComment(nullptr),
@@ -269,7 +269,7 @@ Result Pipeline::InitGfx(
     if ((createInfo.pPipelineBinary != nullptr) && (createInfo.pipelineBinarySize > 0))
     {
         PipelineAbiProcessor<PlatformDecorator> abiProcessor(m_pDevice->GetPlatform());
-        result = abiProcessor.LoadFromBuffer(createInfo.pPipelineBinary, createInfo.pipelineBinarySize);
+        result = abiProcessor.LoadFromBufferView(createInfo.pPipelineBinary, createInfo.pipelineBinarySize);
 
         MsgPackReader              metadataReader;
         Abi::PalCodeObjectMetadata metadata;
@@ -322,7 +322,7 @@ Result Pipeline::InitCompute(
     if ((createInfo.pPipelineBinary != nullptr) && (createInfo.pipelineBinarySize > 0))
     {
         PipelineAbiProcessor<PlatformDecorator> abiProcessor(m_pDevice->GetPlatform());
-        result = abiProcessor.LoadFromBuffer(createInfo.pPipelineBinary, createInfo.pipelineBinarySize);
+        result = abiProcessor.LoadFromBufferView(createInfo.pPipelineBinary, createInfo.pipelineBinarySize);
 
         MsgPackReader              metadataReader;
         Abi::PalCodeObjectMetadata metadata;
@@ -233,6 +233,10 @@ void PAL_STDCALL Platform::GpuProfilerCb(
         TranslateBindPipelineData(pCbData);
         break;
 #endif
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 573
+    case Developer::CallbackType::PipelineCodeReuse:
+        break;
+#endif
 #if PAL_BUILD_PM4_INSTRUMENTOR
     case Developer::CallbackType::DrawDispatchValidation:
         PAL_ASSERT(pCbData != nullptr);
@@ -242,6 +246,10 @@ void PAL_STDCALL Platform::GpuProfilerCb(
         PAL_ASSERT(pCbData != nullptr);
         TranslateOptimizedRegistersData(pCbData);
         break;
+    case Developer::CallbackType::NestedCmdBufferReuse:
+        PAL_ASSERT(pCbData != nullptr);
+        TranslateNestedCmdBufferReuseData(pCbData);
+        break;
 #endif
     default:
         PAL_ASSERT_ALWAYS();
@@ -365,35 +365,14 @@ void Queue::OutputRgpFile(
     File file;
     Result result = file.Open(&logFilePath[0], FileAccessBinary | FileAccessWrite);
 
-    void*  pResult  = nullptr;
-    size_t dataSize = 0;
     if (result == Result::Success)
     {
-        result = gpaSession.GetResults(sampleId, &dataSize, pResult);
-        PAL_ASSERT(dataSize != 0);
-    }
-
-    if (result == Result::Success)
-    {
-        pResult = static_cast<void*>(PAL_MALLOC(dataSize, m_pDevice->GetPlatform(), AllocInternal));
-        if (pResult == nullptr)
-        {
-            result = Result::ErrorOutOfMemory;
-        }
-    }
-
-    if (result == Result::Success)
-    {
-        result = gpaSession.GetResults(sampleId, &dataSize, pResult);
-    }
-
-    if (result == Result::Success)
-    {
-        file.Write(pResult, dataSize);
+        // Stream the trace straight into the file rather than staging the whole RGP blob in system memory.
+        size_t dataSize = 0;
+        result = gpaSession.StreamResults(sampleId, &file, &dataSize);
+        PAL_ASSERT((result != Result::Success) || (dataSize != 0));
     }
 
-    PAL_SAFE_FREE(pResult, m_pDevice->GetPlatform());
-
     file.Close();
 }
 
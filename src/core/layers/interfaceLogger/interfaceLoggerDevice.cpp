@@ -1497,6 +1497,58 @@ Result Device::CreateGraphicsPipeline(
     return result;
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 573
+// =====================================================================================================================
+Result Device::BeginPipelineUploadBatch()
+{
+    auto*const  pPlatform = static_cast<Platform*>(m_pPlatform);
+
+    BeginFuncInfo funcInfo;
+    funcInfo.funcId       = InterfaceFunc::DeviceBeginPipelineUploadBatch;
+    funcInfo.objectId     = m_objectId;
+    funcInfo.preCallTime  = pPlatform->GetTime();
+    const Result result   = m_pNextLayer->BeginPipelineUploadBatch();
+    funcInfo.postCallTime = pPlatform->GetTime();
+
+    LogContext* pLogContext = nullptr;
+    if (pPlatform->LogBeginFunc(funcInfo, &pLogContext))
+    {
+        pLogContext->BeginOutput();
+        pLogContext->KeyAndEnum("result", result);
+        pLogContext->EndOutput();
+
+        pPlatform->LogEndFunc(pLogContext);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+Result Device::EndPipelineUploadBatch()
+{
+    auto*const  pPlatform = static_cast<Platform*>(m_pPlatform);
+
+    BeginFuncInfo funcInfo;
+    funcInfo.funcId       = InterfaceFunc::DeviceEndPipelineUploadBatch;
+    funcInfo.objectId     = m_objectId;
+    funcInfo.preCallTime  = pPlatform->GetTime();
+    const Result result   = m_pNextLayer->EndPipelineUploadBatch();
+    funcInfo.postCallTime = pPlatform->GetTime();
+
+    LogContext* pLogContext = nullptr;
+    if (pPlatform->LogBeginFunc(funcInfo, &pLogContext))
+    {
+        pLogContext->BeginOutput();
+        pLogContext->KeyAndEnum("result", result);
+        pLogContext->EndOutput();
+
+        pPlatform->LogEndFunc(pLogContext);
+    }
+
+    return result;
+}
+#endif
+
 // =====================================================================================================================
 size_t Device::GetMsaaStateSize(
     const MsaaStateCreateInfo& createInfo,
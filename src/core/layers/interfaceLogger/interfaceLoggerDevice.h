@@ -206,6 +206,10 @@ public:
         const GraphicsPipelineCreateInfo& createInfo,
         void*                             pPlacementAddr,
         IPipeline**                       ppPipeline) override;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 573
+    virtual Result BeginPipelineUploadBatch() override;
+    virtual Result EndPipelineUploadBatch() override;
+#endif
     virtual size_t GetMsaaStateSize(
         const MsaaStateCreateInfo& createInfo,
         Result*                    pResult) const override;
@@ -253,6 +253,8 @@ static constexpr FuncFormattingEntry FuncFormattingTable[] =
     { InterfaceFunc::DeviceCreateBorderColorPalette,                            InterfaceObject::Device,               "CreateBorderColorPalette"                },
     { InterfaceFunc::DeviceCreateComputePipeline,                               InterfaceObject::Device,               "CreateComputePipeline"                   },
     { InterfaceFunc::DeviceCreateGraphicsPipeline,                              InterfaceObject::Device,               "CreateGraphicsPipeline"                  },
+    { InterfaceFunc::DeviceBeginPipelineUploadBatch,                            InterfaceObject::Device,               "BeginPipelineUploadBatch"                },
+    { InterfaceFunc::DeviceEndPipelineUploadBatch,                              InterfaceObject::Device,               "EndPipelineUploadBatch"                  },
     { InterfaceFunc::DeviceLoadPipeline,                                        InterfaceObject::Device,               "LoadPipeline"                            },
     { InterfaceFunc::DeviceCreateMsaaState,                                     InterfaceObject::Device,               "CreateMsaaState"                         },
     { InterfaceFunc::DeviceCreateColorBlendState,                               InterfaceObject::Device,               "CreateColorBlendState"                   },
@@ -228,6 +228,8 @@ enum class InterfaceFunc : uint32
     DeviceCreateBorderColorPalette,
     DeviceCreateComputePipeline,
     DeviceCreateGraphicsPipeline,
+    DeviceBeginPipelineUploadBatch,
+    DeviceEndPipelineUploadBatch,
     DeviceLoadPipeline,
     DeviceCreateMsaaState,
     DeviceCreateColorBlendState,
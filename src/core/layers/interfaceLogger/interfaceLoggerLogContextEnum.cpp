@@ -105,6 +105,9 @@ void LogContext::Enum(
             "BarrierReasonPostSqttTrace",
             "BarrierReasonPrePerfDataCopy",
             "BarrierReasonFlushL2CachedData",
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 573
+            "BarrierReasonDeferredSyncs",
+#endif
         };
         static_assert((Developer::BarrierReasonInternalLastDefined - Developer::BarrierReasonFirst)
                        == ArrayLen(StringTable),
@@ -919,6 +919,10 @@ void LogContext::Struct(
 
     KeyAndStruct("supportedFullScreenFrameMetadata", value.supportedFullScreenFrameMetadata);
     KeyAndEnum("internalTexOptLevel", value.internalTexOptLevel);
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 573
+    KeyAndValue("pipelineRegisterCache", (value.pPipelineRegisterCache != nullptr));
+    KeyAndValue("platformKey", (value.pPlatformKey != nullptr));
+#endif
     EndMap();
 }
 
@@ -2047,6 +2051,11 @@ void LogContext::Struct(
     KeyAndValue("apiMajorVer", value.apiMajorVer);
     KeyAndValue("apiMinorVer", value.apiMinorVer);
     KeyAndValue("maxSvmSize", value.maxSvmSize);
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 573
+    KeyAndValue("hasDeviceSnapshotKey", (value.pDeviceSnapshotKey != nullptr));
+    KeyAndValue("jobSystemWorkerCount", value.jobSystemWorkerCount);
+    KeyAndValue("jobSystemAffinityMask", value.jobSystemAffinityMask);
+#endif
     EndMap();
 }
 
@@ -2392,6 +2401,19 @@ void LogContext::Struct(
         KeyAndValue("enabledStats", value.enabledStats);
     }
 
+    KeyAndBeginList("flags", true);
+
+    if (value.flags.enableCpuAccess)
+    {
+        Value("enableCpuAccess");
+    }
+
+    if (value.flags.persistentlyMapped)
+    {
+        Value("persistentlyMapped");
+    }
+
+    EndList();
     EndMap();
 }
 
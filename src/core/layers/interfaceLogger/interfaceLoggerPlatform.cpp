@@ -212,6 +212,8 @@ static constexpr FuncLoggingTableEntry FuncLoggingTable[] =
     { InterfaceFunc::DeviceCreateBorderColorPalette,                (CrtDstry)            },
     { InterfaceFunc::DeviceCreateComputePipeline,                   (CrtDstry)            },
     { InterfaceFunc::DeviceCreateGraphicsPipeline,                  (CrtDstry)            },
+    { InterfaceFunc::DeviceBeginPipelineUploadBatch,                (GenCalls)            },
+    { InterfaceFunc::DeviceEndPipelineUploadBatch,                  (GenCalls)            },
     { InterfaceFunc::DeviceLoadPipeline,                            (CrtDstry)            },
     { InterfaceFunc::DeviceCreateMsaaState,                         (CrtDstry)            },
     { InterfaceFunc::DeviceCreateColorBlendState,                   (CrtDstry)            },
@@ -857,6 +859,10 @@ void PAL_STDCALL Platform::InterfaceLoggerCb(
         TranslateBindPipelineData(pCbData);
         break;
 #endif
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 573
+    case Developer::CallbackType::PipelineCodeReuse:
+        break;
+#endif
 #if PAL_BUILD_PM4_INSTRUMENTOR
     case Developer::CallbackType::DrawDispatchValidation:
         PAL_ASSERT(pCbData != nullptr);
@@ -866,6 +872,10 @@ void PAL_STDCALL Platform::InterfaceLoggerCb(
         PAL_ASSERT(pCbData != nullptr);
         TranslateOptimizedRegistersData(pCbData);
         break;
+    case Developer::CallbackType::NestedCmdBufferReuse:
+        PAL_ASSERT(pCbData != nullptr);
+        TranslateNestedCmdBufferReuseData(pCbData);
+        break;
 #endif
     default:
         PAL_ASSERT_ALWAYS();
@@ -27,6 +27,7 @@
 #include "core/layers/pm4Instrumentor/pm4InstrumentorDevice.h"
 #include "core/layers/pm4Instrumentor/pm4InstrumentorPlatform.h"
 #include "core/layers/pm4Instrumentor/pm4InstrumentorQueue.h"
+#include "palSysUtil.h"
 #include "palVectorImpl.h"
 
 using namespace Util;
@@ -44,8 +45,13 @@ CmdBuffer::CmdBuffer(
     :
     CmdBufferFwdDecorator(pNextCmdBuffer, pDevice),
     m_shRegs(static_cast<Platform*>(pDevice->GetPlatform())),
-    m_ctxRegs(static_cast<Platform*>(pDevice->GetPlatform()))
+    m_ctxRegs(static_cast<Platform*>(pDevice->GetPlatform())),
+    m_perfFrequency(static_cast<uint64>(GetPerfFrequency())),
+    m_callStartTime(0),
+    m_pendingEventMask(0)
 {
+    static_assert(NumEventIds <= (sizeof(m_pendingEventMask) * 8), "m_pendingEventMask is too small!");
+
     ResetStatistics();
 
     m_funcTable.pfnCmdSetUserData[static_cast<uint32>(PipelineBindPoint::Compute)]  = &CmdSetUserDataDecoratorCs;
@@ -71,12 +77,15 @@ void CmdBuffer::ResetStatistics()
 
     m_shRegBase  = 0;
     m_ctxRegBase = 0;
+
+    m_pendingEventMask = 0;
 }
 
 // =====================================================================================================================
 void CmdBuffer::PreCall()
 {
     m_stats.commandBufferSize = GetNextLayer()->GetUsedSize(CmdAllocType::CommandDataAlloc);
+    m_callStartTime           = GetPerfCpuTime();
 }
 
 // =====================================================================================================================
@@ -94,20 +103,37 @@ void CmdBuffer::PreDrawCall()
 }
 
 // =====================================================================================================================
-void CmdBuffer::PostCall(
+// Records the PM4 size and CPU time of the call which began with the last PreCall().  Returns the CPU time spent in
+// the call, in nanoseconds.
+uint64 CmdBuffer::PostCall(
     CmdBufCallId callId)
 {
-    const gpusize currentLen = GetNextLayer()->GetUsedSize(CmdAllocType::CommandDataAlloc);
+    const uint64  elapsedTicks = static_cast<uint64>(GetPerfCpuTime() - m_callStartTime);
+    const uint64  elapsedNs    = ((elapsedTicks * 1000000000ull) / m_perfFrequency);
+    const gpusize currentLen   = GetNextLayer()->GetUsedSize(CmdAllocType::CommandDataAlloc);
 
-    ++m_stats.call[static_cast<uint32>(callId)].count;
-    m_stats.call[static_cast<uint32>(callId)].cmdSize += (currentLen - m_stats.commandBufferSize);
+    Pm4CallData*const pCall = &m_stats.call[static_cast<uint32>(callId)];
+    ++pCall->count;
+    pCall->cmdSize += (currentLen - m_stats.commandBufferSize);
+    RecordCpuTime(&pCall->cpuTime, elapsedNs);
+
+    // Any internal events which were reported through developer callbacks during this call are charged with the CPU
+    // time of the whole call.
+    uint32 eventId = 0;
+    while (BitMaskScanForward(&eventId, m_pendingEventMask))
+    {
+        RecordCpuTime(&m_stats.internalEvent[eventId].cpuTime, elapsedNs);
+        m_pendingEventMask &= ~(1u << eventId);
+    }
+
+    return elapsedNs;
 }
 
 // =====================================================================================================================
 void CmdBuffer::PostDispatchCall(
     CmdBufCallId callId)
 {
-    PostCall(callId);
+    const uint64 elapsedNs = PostCall(callId);
 
     if (m_validationData.miscCmdSize > 0)
     {
@@ -115,6 +141,7 @@ void CmdBuffer::PostDispatchCall(
 
         ++m_stats.internalEvent[Id].count;
         m_stats.internalEvent[Id].cmdSize += m_validationData.miscCmdSize;
+        RecordCpuTime(&m_stats.internalEvent[Id].cpuTime, elapsedNs);
     }
 
     if (m_validationData.userDataCmdSize > 0)
@@ -123,6 +150,7 @@ void CmdBuffer::PostDispatchCall(
 
         ++m_stats.internalEvent[Id].count;
         m_stats.internalEvent[Id].cmdSize += m_validationData.userDataCmdSize;
+        RecordCpuTime(&m_stats.internalEvent[Id].cpuTime, elapsedNs);
     }
 
     if (m_validationData.pipelineCmdSize > 0)
@@ -131,6 +159,7 @@ void CmdBuffer::PostDispatchCall(
 
         ++m_stats.internalEvent[Id].count;
         m_stats.internalEvent[Id].cmdSize += m_validationData.pipelineCmdSize;
+        RecordCpuTime(&m_stats.internalEvent[Id].cpuTime, elapsedNs);
     }
 }
 
@@ -138,7 +167,7 @@ void CmdBuffer::PostDispatchCall(
 void CmdBuffer::PostDrawCall(
     CmdBufCallId callId)
 {
-    PostCall(callId);
+    const uint64 elapsedNs = PostCall(callId);
 
     if (m_validationData.miscCmdSize > 0)
     {
@@ -146,6 +175,7 @@ void CmdBuffer::PostDrawCall(
 
         ++m_stats.internalEvent[Id].count;
         m_stats.internalEvent[Id].cmdSize += m_validationData.miscCmdSize;
+        RecordCpuTime(&m_stats.internalEvent[Id].cpuTime, elapsedNs);
     }
 
     if (m_validationData.userDataCmdSize > 0)
@@ -154,6 +184,7 @@ void CmdBuffer::PostDrawCall(
 
         ++m_stats.internalEvent[Id].count;
         m_stats.internalEvent[Id].cmdSize += m_validationData.userDataCmdSize;
+        RecordCpuTime(&m_stats.internalEvent[Id].cpuTime, elapsedNs);
     }
 
     if (m_validationData.pipelineCmdSize > 0)
@@ -162,6 +193,7 @@ void CmdBuffer::PostDrawCall(
 
         ++m_stats.internalEvent[Id].count;
         m_stats.internalEvent[Id].cmdSize += m_validationData.pipelineCmdSize;
+        RecordCpuTime(&m_stats.internalEvent[Id].cpuTime, elapsedNs);
     }
 }
 
@@ -173,6 +205,25 @@ void CmdBuffer::NotifyDrawDispatchValidation(
     m_validationData = data;
 }
 
+// =====================================================================================================================
+void CmdBuffer::NotifyNestedCmdBufferReuse(
+    const Developer::NestedCmdBufferReuseData& data)
+{
+    PAL_ASSERT(this == data.pCmdBuffer);
+
+    constexpr uint32 ReusedId = static_cast<uint32>(InternalEventId::NestedCmdBufferReuse);
+    constexpr uint32 CopiedId = static_cast<uint32>(InternalEventId::NestedCmdBufferCopy);
+
+    m_stats.internalEvent[ReusedId].count   += data.reusedCount;
+    m_stats.internalEvent[ReusedId].cmdSize += data.reusedCmdSize;
+    m_stats.internalEvent[CopiedId].count   += data.copiedCount;
+    m_stats.internalEvent[CopiedId].cmdSize += data.copiedCmdSize;
+
+    // The CPU time of these events is recorded once the enclosing CmdExecuteNestedCmdBuffers() call completes.
+    m_pendingEventMask |= (((data.reusedCount != 0) ? (1u << ReusedId) : 0) |
+                           ((data.copiedCount != 0) ? (1u << CopiedId) : 0));
+}
+
 // =====================================================================================================================
 void CmdBuffer::UpdateOptimizedRegisters(
     const Developer::OptimizedRegistersData& data)
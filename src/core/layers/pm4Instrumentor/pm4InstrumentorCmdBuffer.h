@@ -471,6 +471,8 @@ public:
         const Developer::DrawDispatchValidationData& data);
     void UpdateOptimizedRegisters(
         const Developer::OptimizedRegistersData& data);
+    void NotifyNestedCmdBufferReuse(
+        const Developer::NestedCmdBufferReuseData& data);
 
     const Pm4Statistics& Statistics() const { return m_stats; }
 
@@ -486,7 +488,7 @@ private:
     void ResetStatistics();
 
     void PreCall();
-    void PostCall(CmdBufCallId callId);
+    uint64 PostCall(CmdBufCallId callId);
 
     void PreDispatchCall();
     void PostDispatchCall(CmdBufCallId callId);
@@ -568,6 +570,11 @@ private:
 
     Developer::DrawDispatchValidationData  m_validationData;
 
+    const uint64  m_perfFrequency;      // CPU performance counter frequency, in ticks per second.
+    int64         m_callStartTime;      // CPU performance counter value when the current call started.
+    uint32        m_pendingEventMask;   // Mask of InternalEventIds triggered during the current call whose CPU time
+                                        // has not yet been recorded.
+
     PAL_DISALLOW_DEFAULT_CTOR(CmdBuffer);
     PAL_DISALLOW_COPY_AND_ASSIGN(CmdBuffer);
 };
@@ -71,6 +71,10 @@ static void PAL_STDCALL Pm4InstrumentorCb(
         PAL_ASSERT(pCbData != nullptr);
         TranslateBindPipelineData(pCbData);
         break;
+#endif
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 573
+    case Developer::CallbackType::PipelineCodeReuse:
+        break;
 #endif
     case Developer::CallbackType::DrawDispatchValidation:
         PAL_ASSERT(pCbData != nullptr);
@@ -92,6 +96,16 @@ static void PAL_STDCALL Pm4InstrumentorCb(
             pCmdBuf->UpdateOptimizedRegisters(data);
         }
         break;
+    case Developer::CallbackType::NestedCmdBufferReuse:
+        PAL_ASSERT(pCbData != nullptr);
+        if (TranslateNestedCmdBufferReuseData(pCbData))
+        {
+            const auto& data    = *static_cast<Developer::NestedCmdBufferReuseData*>(pCbData);
+            auto*const  pCmdBuf = static_cast<CmdBuffer*>(data.pCmdBuffer);
+
+            pCmdBuf->NotifyNestedCmdBufferReuse(data);
+        }
+        break;
     default:
         PAL_ASSERT_ALWAYS();
         break;
@@ -72,6 +72,8 @@ static const char* InternalEventIdToString(
         "ValidateGraphicsPipeline",     // PipelineValidationGfx
         "ValidateDispatch()",           // MiscDispatchValidation
         "ValidateDraw()",               // MiscDrawValidation
+        "Nested CmdBuffer IB2/Chain",   // NestedCmdBufferReuse
+        "Nested CmdBuffer Copy",        // NestedCmdBufferCopy
     };
 
     static_assert(ArrayLen(StringTable) == NumEventIds,
@@ -91,6 +93,8 @@ Queue::Queue(
     QueueDecorator(pNextQueue, pDevice),
     m_pDevice(pDevice),
     m_cmdBufCount(0),
+    m_windowCmdBufCount(0),
+    m_windowFirstFrame(0),
     m_shRegs(static_cast<Platform*>(pDevice->GetPlatform())),
     m_ctxRegs(static_cast<Platform*>(pDevice->GetPlatform())),
     m_shRegBase(0),
@@ -99,8 +103,9 @@ Queue::Queue(
     m_dumpInterval(0),
     m_lastCpuPerfCounter(0)
 {
-    memset(&m_stats,    0, sizeof(m_stats));
-    memset(&m_fileName, 0, sizeof(m_fileName));
+    memset(&m_stats,       0, sizeof(m_stats));
+    memset(&m_windowStats, 0, sizeof(m_windowStats));
+    memset(&m_fileName,    0, sizeof(m_fileName));
 }
 
 // =====================================================================================================================
@@ -197,6 +202,45 @@ static void AccumulateRegisterInfo(
     }
 }
 
+// =====================================================================================================================
+// Helper function to accumulate the statistics for a single command buffer call or internal event.
+static void AccumulateCallData(
+    Pm4CallData*       pAccum,
+    const Pm4CallData& source)
+{
+    pAccum->cmdSize += source.cmdSize;
+    pAccum->count   += source.count;
+
+    for (uint32 b = 0; b < NumCpuTimeBuckets; ++b)
+    {
+        pAccum->cpuTime.bucket[b] += source.cpuTime.bucket[b];
+    }
+
+    pAccum->cpuTime.totalNs += source.cpuTime.totalNs;
+    pAccum->cpuTime.maxNs    = Max(pAccum->cpuTime.maxNs, source.cpuTime.maxNs);
+}
+
+// =====================================================================================================================
+// Helper function to accumulate all of the PM4 statistics from one object into another.
+static void AccumulatePm4Statistics(
+    Pm4Statistics*       pAccum,
+    const Pm4Statistics& source)
+{
+    for (uint32 j = 0; j < NumCallIds; ++j)
+    {
+        AccumulateCallData(&pAccum->call[j], source.call[j]);
+    }
+
+    for (uint32 j = 0; j < NumEventIds; ++j)
+    {
+        AccumulateCallData(&pAccum->internalEvent[j], source.internalEvent[j]);
+    }
+
+    pAccum->commandBufferSize += source.commandBufferSize;
+    pAccum->embeddedDataSize  += source.embeddedDataSize;
+    pAccum->gpuScratchMemSize += source.gpuScratchMemSize;
+}
+
 // =====================================================================================================================
 // Accumulates the aggregate PM4 statistics from a group of command buffers.
 void Queue::AccumulateStatistics(
@@ -208,22 +252,13 @@ void Queue::AccumulateStatistics(
         const CmdBuffer*const pCmdBuf = static_cast<const CmdBuffer*>(ppCmdBuffers[i]);
         const Pm4Statistics&  stats   = pCmdBuf->Statistics();
 
-        for (uint32 j = 0; j < NumCallIds; ++j)
-        {
-            m_stats.call[j].cmdSize += stats.call[j].cmdSize;
-            m_stats.call[j].count   += stats.call[j].count;
-        }
+        AccumulatePm4Statistics(&m_stats, stats);
 
-        for (uint32 j = 0; j < NumEventIds; ++j)
+        if (m_dumpMode == Pm4InstrumentorDumpQueueSubmit)
         {
-            m_stats.internalEvent[j].cmdSize += stats.internalEvent[j].cmdSize;
-            m_stats.internalEvent[j].count   += stats.internalEvent[j].count;
+            AccumulatePm4Statistics(&m_windowStats, stats);
         }
 
-        m_stats.commandBufferSize += stats.commandBufferSize;
-        m_stats.embeddedDataSize  += stats.embeddedDataSize;
-        m_stats.gpuScratchMemSize += stats.gpuScratchMemSize;
-
         AccumulateRegisterInfo(&m_shRegs,  pCmdBuf->ShRegs());
         AccumulateRegisterInfo(&m_ctxRegs, pCmdBuf->CtxRegs());
 
@@ -231,7 +266,8 @@ void Queue::AccumulateStatistics(
         m_ctxRegBase = pCmdBuf->CtxRegBase();
     }
 
-    m_cmdBufCount += count;
+    m_cmdBufCount       += count;
+    m_windowCmdBufCount += count;
 }
 
 // =====================================================================================================================
@@ -256,48 +292,106 @@ static void PrintRegisterStats(
 }
 
 // =====================================================================================================================
-// Dumps PM4 statistics to a file.
-void Queue::DumpStatistics()
+// Helper function to estimate a percentile of a CPU time histogram.  Returns the upper bound of the bucket which
+// contains the requested percentile, clamped to the longest sample seen.
+static uint64 CpuTimePercentile(
+    const CpuTimeHistogram& histogram,
+    uint32                  count,
+    uint32                  percentile)
 {
-    File logFile;
-    if (logFile.Open(&m_fileName[0], FileAccessWrite) == Result::Success)
-    {
-        logFile.Printf("Operation,Count,Total Bytes\n\n");
+    const uint64 target = RoundUpQuotient((static_cast<uint64>(count) * percentile), static_cast<uint64>(100));
 
-        const uint32 frameCount = static_cast<Platform*>(m_pDevice->GetPlatform())->FrameCount();
-        if (frameCount != 0)
+    uint64 seen   = 0;
+    uint64 result = histogram.maxNs;
+    for (uint32 b = 0; b < NumCpuTimeBuckets; ++b)
+    {
+        seen += histogram.bucket[b];
+        if (seen >= target)
         {
-            logFile.Printf("Frames,%d\n\n", frameCount);
+            result = Min(((static_cast<uint64>(1) << (b + 1)) - 1), histogram.maxNs);
+            break;
         }
+    }
 
-        for (uint32 i = 0; i < NumCallIds; ++i)
+    return result;
+}
+
+// =====================================================================================================================
+// Helper function to print out a single command buffer call or internal event in .csv format.
+static void PrintCallData(
+    const File&        logFile,
+    const char*        pName,
+    const Pm4CallData& data)
+{
+    logFile.Printf("%s,%d,%llu,%llu,%llu,%llu,%llu\n",
+                   pName,
+                   data.count,
+                   data.cmdSize,
+                   data.cpuTime.totalNs,
+                   CpuTimePercentile(data.cpuTime, data.count, 50),
+                   CpuTimePercentile(data.cpuTime, data.count, 99),
+                   data.cpuTime.maxNs);
+}
+
+// =====================================================================================================================
+// Helper function to print out command buffer call, internal event and footprint statistics in .csv format.
+static void PrintPm4Statistics(
+    const File&          logFile,
+    const Pm4Statistics& stats,
+    uint32               cmdBufCount)
+{
+    for (uint32 i = 0; i < NumCallIds; ++i)
+    {
+        if (stats.call[i].count == 0)
         {
-            const uint32 count = m_stats.call[i].count;
-            if (count == 0)
-            {
-                continue; // Skip calls which were never hit.
-            }
+            continue; // Skip calls which were never hit.
+        }
+
+        PrintCallData(logFile, CmdBufCallIdStrings[i], stats.call[i]);
+    }
+
+    logFile.Printf("\n");
 
-            logFile.Printf("%s,%d,%llu\n", CmdBufCallIdStrings[i], count, m_stats.call[i].cmdSize);
+    for (uint32 i = 0; i < NumEventIds; ++i)
+    {
+        if (stats.internalEvent[i].count == 0)
+        {
+            continue; // Skip events which were never hit.
         }
 
-        logFile.Printf("\n");
+        PrintCallData(logFile, InternalEventIdToString(static_cast<InternalEventId>(i)), stats.internalEvent[i]);
+    }
+
+    logFile.Printf("\nCommand Buffer Footprint,%d,%llu\n", cmdBufCount, stats.commandBufferSize);
+    logFile.Printf("Embedded Data Footprint,%d,%llu\n",    cmdBufCount, stats.embeddedDataSize);
+    logFile.Printf("GPU Scratch Mem Footprint,%d,%llu\n",  cmdBufCount, stats.gpuScratchMemSize);
+}
+
+// =====================================================================================================================
+// Dumps PM4 statistics to a file.  When dumping periodically, the statistics accumulated since the previous dump are
+// written out as a separate section ahead of the totals, then reset.
+void Queue::DumpStatistics()
+{
+    const uint32 frameCount = static_cast<Platform*>(m_pDevice->GetPlatform())->FrameCount();
+
+    File logFile;
+    if (logFile.Open(&m_fileName[0], FileAccessWrite) == Result::Success)
+    {
+        logFile.Printf("Operation,Count,Total Bytes,Total CPU ns,P50 CPU ns,P99 CPU ns,Max CPU ns\n\n");
 
-        for (uint32 i = 0; i < NumEventIds; ++i)
+        if (m_dumpMode == Pm4InstrumentorDumpQueueSubmit)
         {
-            const uint32 count = m_stats.internalEvent[i].count;
-            if (count == 0)
-            {
-                continue; // Skip events which were never hit.
-            }
+            logFile.Printf("Window Frames,%d\n\n", (frameCount - m_windowFirstFrame));
+            PrintPm4Statistics(logFile, m_windowStats, m_windowCmdBufCount);
+            logFile.Printf("\nTotal\n\n");
+        }
 
-            const char*const pEventStr = InternalEventIdToString(static_cast<InternalEventId>(i));
-            logFile.Printf("%s,%d,%llu\n", pEventStr, count, m_stats.internalEvent[i].cmdSize);
+        if (frameCount != 0)
+        {
+            logFile.Printf("Frames,%d\n\n", frameCount);
         }
 
-        logFile.Printf("\nCommand Buffer Footprint,%d,%llu\n", m_cmdBufCount, m_stats.commandBufferSize);
-        logFile.Printf("Embedded Data Footprint,%d,%llu\n",    m_cmdBufCount, m_stats.embeddedDataSize);
-        logFile.Printf("GPU Scratch Mem Footprint,%d,%llu\n",  m_cmdBufCount, m_stats.gpuScratchMemSize);
+        PrintPm4Statistics(logFile, m_stats, m_cmdBufCount);
 
         if (m_shRegs.IsEmpty() == false)
         {
@@ -311,6 +405,10 @@ void Queue::DumpStatistics()
             PrintRegisterStats(logFile, m_ctxRegs, m_ctxRegBase);
         }
     } // If log file was opened
+
+    memset(&m_windowStats, 0, sizeof(m_windowStats));
+    m_windowCmdBufCount = 0;
+    m_windowFirstFrame  = frameCount;
 }
 
 } // Pm4Instrumentor
@@ -28,6 +28,7 @@
 #include "core/g_palPlatformSettings.h"
 #include "core/layers/decorators.h"
 #include "core/layers/functionIds.h"
+#include "palInlineFuncs.h"
 #include "palVector.h"
 
 namespace Pal
@@ -54,17 +55,49 @@ enum class InternalEventId : uint32
     MiscDispatchValidation, // All Dispatch-time validation which doesn't fall into the above buckets
     MiscDrawValidation,     // All Draw-time validation which doesn't fall into the above buckets
 
+    NestedCmdBufferReuse,   // Nested command buffers launched in-place (size is the PM4 which wasn't copied)
+    NestedCmdBufferCopy,    // Nested command buffers copied into their caller (size is the PM4 copied)
+
     Count,
 };
 
 // Number of distinct internal instrumentation events.
 constexpr uint32 NumEventIds = static_cast<uint32>(InternalEventId::Count);
 
+// Number of buckets in a CPU time histogram.  Bucket N counts calls which took [2^N, 2^(N+1)) nanoseconds; the first
+// bucket also counts calls which took under one nanosecond and the last bucket also counts anything longer.
+constexpr uint32 NumCpuTimeBuckets = 32;
+
+// Log-scale histogram of the CPU time spent in a single command buffer call or internal instrumentation event.
+struct CpuTimeHistogram
+{
+    uint32  bucket[NumCpuTimeBuckets];
+    uint64  totalNs;   // Total CPU time spent over the lifetime of the object.
+    uint64  maxNs;     // Longest CPU time spent in a single call.
+};
+
+// =====================================================================================================================
+// Adds a single CPU time sample to a histogram.
+inline void RecordCpuTime(
+    CpuTimeHistogram* pHistogram,
+    uint64            timeNs)
+{
+    const uint32 bucket = Util::Min(Util::Log2(timeNs), NumCpuTimeBuckets - 1);
+
+    ++pHistogram->bucket[bucket];
+    pHistogram->totalNs += timeNs;
+    pHistogram->maxNs    = Util::Max(pHistogram->maxNs, timeNs);
+}
+
 // PM4 statistics for a single command buffer call or internal instrumentation event.
 struct Pm4CallData
 {
     gpusize  cmdSize;  // Total size of PM4 commands written by this entry point over the lifetime of the object.
     uint32   count;    // Number of times the command buffer entry point was called
+
+    // CPU time spent in this entry point.  For internal events, this is the CPU time of the entry point which
+    // triggered the event.
+    CpuTimeHistogram  cpuTime;
 };
 
 // Contains PM4 statistics for a single command buffer, queue, or device.
@@ -114,6 +147,11 @@ private:
     Pm4Statistics  m_stats;
     uint32         m_cmdBufCount;
 
+    // Statistics accumulated since the last periodic dump.  Only tracked in Pm4InstrumentorDumpQueueSubmit mode.
+    Pm4Statistics  m_windowStats;
+    uint32         m_windowCmdBufCount;
+    uint32         m_windowFirstFrame;
+
     RegisterInfoVector  m_shRegs;
     RegisterInfoVector  m_ctxRegs;
 
@@ -39,6 +39,7 @@
 #include "palAutoBuffer.h"
 #include "palHashMapImpl.h"
 #include "palInlineFuncs.h"
+#include "palMetroHash.h"
 #include "palSettingsFileMgrImpl.h"
 #include "palSysMemory.h"
 #include "palSysUtil.h"
@@ -571,12 +572,17 @@ Result Device::Finalize(
 Result Device::EarlyInit(
     const HwIpLevels& ipLevels)
 {
+    const uint64 startTime = GetPerfCpuTime();
+
     m_chipProperties.gfxLevel = ipLevels.gfx;
     m_chipProperties.ossLevel = ipLevels.oss;
     m_chipProperties.vceLevel = ipLevels.vce;
     m_chipProperties.uvdLevel = ipLevels.uvd;
     m_chipProperties.vcnLevel = ipLevels.vcn;
 
+    // Init paths. The cache path must be known before InitGpuProperties() looks for a device property snapshot.
+    InitOutputPaths();
+
     Result result = VamMgrSingleton::Init();
 
     if (result == Result::Success)
@@ -584,11 +590,10 @@ Result Device::EarlyInit(
         result = InitGpuProperties();
     }
 
-    // Init paths
-    InitOutputPaths();
-
     if (result == Result::Success)
     {
+        const uint64 settingsFileStartTime = GetPerfCpuTime();
+
         // Step 1: try default(as well as global) path
         result = m_settingsMgr.Init(m_pSettingsPath);
 
@@ -625,6 +630,8 @@ Result Device::EarlyInit(
             PAL_ALERT_ALWAYS();
             result = Result::Success;
         }
+
+        m_initTimes.settingsFileLoad = GetPerfCpuTime() - settingsFileStartTime;
     }
 
     if (result == Result::Success)
@@ -647,6 +654,8 @@ Result Device::EarlyInit(
     // get the attached screen count
     GetScreens(&m_attachedScreenCount, nullptr, nullptr);
 
+    m_initTimes.earlyInit = GetPerfCpuTime() - startTime;
+
     return result;
 }
 
@@ -774,6 +783,55 @@ Result Device::InitGpuProperties()
                                   &feature);
     m_engineProperties.cpUcodeVersion = feature;
 
+    // The drm version, raw device info and microcode version are everything the derived properties depend on, so
+    // they identify which snapshots this device can reuse.
+    MetroHash64 hasher;
+    hasher.Update(m_drmMajorVer);
+    hasher.Update(m_drmMinorVer);
+    hasher.Update(feature);
+    hasher.Update(m_gpuInfo);
+
+    uint64 snapshotOsKey = 0;
+    hasher.Finalize(reinterpret_cast<uint8*>(&snapshotOsKey));
+
+    const bool loadedSnapshot = LoadPropertySnapshot(snapshotOsKey, true);
+
+    if (loadedSnapshot == false)
+    {
+        InitChipAndEngineProperties();
+    }
+
+    Result result = InitMemQueueInfo();
+
+    if (result == Result::Success)
+    {
+
+        if (m_gpuInfo.ce_ram_size != 0)
+        {
+            PAL_ASSERT(m_gpuInfo.ce_ram_size >= m_engineProperties.perEngine[EngineTypeUniversal].reservedCeRamSize);
+
+            m_engineProperties.perEngine[EngineTypeUniversal].availableCeRamSize =
+                (m_gpuInfo.ce_ram_size - m_engineProperties.perEngine[EngineTypeUniversal].reservedCeRamSize);
+        }
+
+        InitPerformanceRatings();
+        InitMemoryHeapProperties();
+
+        if (loadedSnapshot == false)
+        {
+            SavePropertySnapshot(snapshotOsKey);
+        }
+    }
+
+    return result;
+
+}
+
+// =====================================================================================================================
+// Derives the GPU name and the chip, engine and perf experiment properties which don't depend on memory or queue info.
+// This is skipped when those properties are loaded from a device property snapshot instead.
+void Device::InitChipAndEngineProperties()
+{
     const char* pMarketingName = m_drmProcs.pfnAmdgpuGetMarketingNameisValid() ?
                                  m_drmProcs.pfnAmdgpuGetMarketingName(m_hDevice) : nullptr;
     if (pMarketingName != nullptr)
@@ -869,26 +927,6 @@ Result Device::InitGpuProperties()
     default:
         break;
     }
-
-    Result result = InitMemQueueInfo();
-
-    if (result == Result::Success)
-    {
-
-        if (m_gpuInfo.ce_ram_size != 0)
-        {
-            PAL_ASSERT(m_gpuInfo.ce_ram_size >= m_engineProperties.perEngine[EngineTypeUniversal].reservedCeRamSize);
-
-            m_engineProperties.perEngine[EngineTypeUniversal].availableCeRamSize =
-                (m_gpuInfo.ce_ram_size - m_engineProperties.perEngine[EngineTypeUniversal].reservedCeRamSize);
-        }
-
-        InitPerformanceRatings();
-        InitMemoryHeapProperties();
-    }
-
-    return result;
-
 }
 
 // =====================================================================================================================
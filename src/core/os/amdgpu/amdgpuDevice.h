@@ -869,6 +869,7 @@ private:
     Result InitMemQueueInfo();
 
     Result InitScreen();
+    void InitChipAndEngineProperties();
 #if PAL_BUILD_GFX6
     void InitGfx6ChipProperties();
     void InitGfx6CuMask(
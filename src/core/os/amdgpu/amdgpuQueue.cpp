@@ -327,7 +327,7 @@ Result Queue::Init(
 
 // =====================================================================================================================
 // Adds GPU memory references to the per-queue global list which gets added to the patch/alloc list at submit time.
-Result Queue::AddGpuMemoryReferences(
+Result Queue::OsAddGpuMemoryReferences(
     uint32              gpuMemRefCount,
     const GpuMemoryRef* pGpuMemoryRefs)
 {
@@ -369,7 +369,7 @@ Result Queue::AddGpuMemoryReferences(
 
 // =====================================================================================================================
 // Decrements the GPU memory reference count and if necessary removes it from the per-queue global list.
-void Queue::RemoveGpuMemoryReferences(
+void Queue::OsRemoveGpuMemoryReferences(
     uint32            gpuMemoryCount,
     IGpuMemory*const* ppGpuMemory,
     bool              forceRemove)
@@ -1091,6 +1091,8 @@ Result Queue::UpdateResourceList(
 
         if (reuseResourceList == false)
         {
+            AtomicIncrement64(&m_metrics.residencyListRebuilds);
+
             // Reset the list
             m_numResourcesInList = 0;
             if (m_hResourceList != nullptr)
@@ -152,16 +152,16 @@ public:
 
     void DirtyGlobalReferences();
 
-    Result AddGpuMemoryReferences(
+protected:
+    virtual Result OsAddGpuMemoryReferences(
         uint32              gpuMemRefCount,
-        const GpuMemoryRef* pGpuMemoryRefs);
+        const GpuMemoryRef* pGpuMemoryRefs) override;
 
-    void RemoveGpuMemoryReferences(
+    virtual void OsRemoveGpuMemoryReferences(
         uint32            gpuMemoryCount,
         IGpuMemory*const* ppGpuMemory,
-        bool              forceRemove);
+        bool              forceRemove) override;
 
-protected:
     virtual Result OsDelay(float delay, const IPrivateScreen* pScreen) override;
 
     virtual Result OsWaitIdle() override;
@@ -24,6 +24,7 @@
  **********************************************************************************************************************/
 
 #include "core/os/amdgpu/amdgpuTimestampFence.h"
+#include "palSysUtil.h"
 
 #include <time.h>
 
@@ -79,7 +80,9 @@ Result TimestampFence::GetStatus() const
     else if (m_pContext != nullptr)
     {
         // We must report NotReady if this fence's submission has been batched or is not retired.
-        if (IsBatched() || (m_pContext->IsTimestampRetired(m_timestamp) == false))
+        const uint64 timestamp = Timestamp();
+
+        if ((timestamp == BatchedTimestamp) || (m_pContext->IsTimestampRetired(timestamp) == false))
         {
             result = Result::NotReady;
         }
@@ -110,9 +113,9 @@ void TimestampFence::AssociateWithContext(
     m_pContext = static_cast<Amdgpu::SubmissionContext*>(pContext);
     m_pContext->TakeReference();
 
-    // Note that we don't need to atomically modify m_timestamp here because this function is called during Submit()
-    // and it isn't legal to poll a fence's status until after Submit() returns.
-    m_timestamp = BatchedTimestamp;
+    // Note that we don't need to order this store against other threads because this function is called during
+    // Submit() and it isn't legal to poll a fence's status until after Submit() returns.
+    m_timestamp.store(BatchedTimestamp, std::memory_order_relaxed);
 
     m_fenceState.neverSubmitted = 0;
 }
@@ -123,9 +126,9 @@ Result TimestampFence::AssociateWithLastTimestamp()
 {
     PAL_ASSERT(m_pContext != nullptr);
 
-    // Atomically modify the timestamp because another thread could be polling GetStatus() in the background while
-    // we're unrolling a batched submission or timestamp association.
-    AtomicExchange64(&m_timestamp, m_pContext->LastTimestamp());
+    // Atomically publish the timestamp because another thread could be polling GetStatus() or waiting on this fence in
+    // the background while we're unrolling a batched submission or timestamp association.
+    m_timestamp.store(m_pContext->LastTimestamp(), std::memory_order_release);
 
     return Result::Success;
 }
@@ -144,7 +147,7 @@ Result TimestampFence::Reset()
     }
 
     // The fence is no longer associated with any submissions.
-    m_timestamp = 0;
+    m_timestamp.store(0, std::memory_order_relaxed);
 
     // If this is called before a submission, the private screen present usage flag needs to reset as well.
     m_fenceState.privateScreenPresentUsed = 0;
@@ -155,6 +158,44 @@ Result TimestampFence::Reset()
     return result;
 }
 
+// =====================================================================================================================
+// Returns how much of a timeout which started at startTicks is left, in nanoseconds. Infinite timeouts stay infinite.
+static uint64 RemainingTimeout(
+    int64  startTicks,
+    uint64 timeoutNs)
+{
+    uint64 remainingNs = timeoutNs;
+
+    if (timeoutNs != UINT64_MAX)
+    {
+        const double elapsedNs = static_cast<double>(GetPerfCpuTime() - startTicks) *
+                                 (1000000000.0 / static_cast<double>(GetPerfFrequency()));
+
+        remainingNs = (elapsedNs < static_cast<double>(timeoutNs)) ? (timeoutNs - static_cast<uint64>(elapsedNs)) : 0;
+    }
+
+    return remainingNs;
+}
+
+// =====================================================================================================================
+// Yields until a batched fence's submission has been handed to the OS or the timeout, counted from startTicks, expires.
+// Returns false if the fence is still batched.
+static bool WaitForUnbatchedFence(
+    const TimestampFence& fence,
+    int64                 startTicks,
+    uint64                timeoutNs)
+{
+    bool isBatched = fence.IsBatched();
+
+    while (isBatched && (RemainingTimeout(startTicks, timeoutNs) > 0))
+    {
+        YieldThread();
+        isBatched = fence.IsBatched();
+    }
+
+    return (isBatched == false);
+}
+
 // =====================================================================================================================
 // Waits for one or more Fence objects to be processed by the GPU.  If waitAll is set, then this waits for all Fence
 // objects to be processed.  Otherwise, this only waits for at least one Fence object to be processed.
@@ -174,11 +215,26 @@ Result TimestampFence::WaitForFences(
     Result result = Result::ErrorOutOfMemory;
 
     const Amdgpu::Device& amdgpuDevice = reinterpret_cast<const Amdgpu::Device&>(device);
-    AutoBuffer<amdgpu_cs_fence, 16, Platform> fenceList(fenceCount, amdgpuDevice.GetPlatform());
+    AutoBuffer<amdgpu_cs_fence, 16, Platform>               fenceList(fenceCount, amdgpuDevice.GetPlatform());
+    AutoBuffer<const Amdgpu::TimestampFence*, 16, Platform> batchedList(fenceCount, amdgpuDevice.GetPlatform());
+
+    uint32 count        = 0;
+    uint32 batchedCount = 0;
 
-    uint32 count = 0;
+    // Batched fences are waited for on the CPU, so remember when we started in order to honor the caller's timeout.
+    const int64 startTicks = GetPerfCpuTime();
 
-    if (fenceList.Capacity() >= fenceCount)
+    const auto AddKernelFence = [&fenceList, &count](const Amdgpu::TimestampFence& fence)
+    {
+        fenceList[count].context     = fence.m_pContext->Handle();
+        fenceList[count].ip_type     = fence.m_pContext->IpType();
+        fenceList[count].ip_instance = 0;
+        fenceList[count].ring        = fence.m_pContext->EngineId();
+        fenceList[count].fence       = fence.Timestamp();
+        count++;
+    };
+
+    if ((fenceList.Capacity() >= fenceCount) && (batchedList.Capacity() >= fenceCount))
     {
         result = Result::NotReady;
 
@@ -210,41 +266,87 @@ Result TimestampFence::WaitForFences(
                 break;
             }
 
-            const auto*const pContext = pFence->m_pContext;
-
-            if (pContext == nullptr)
+            if (pFence->m_pContext == nullptr)
             {
                 // If the fence is not associated with a submission context, return unavailable.
                 result = Result::ErrorUnavailable;
                 break;
             }
 
-            // We currently have no way to wait for a batched fence on Linux. This is OK for now because Vulkan (the
-            // only Linux client) doesn't permit the application to trigger queue batching. A solution must be found
-            // once PAL swap chain presents have been refactored because they will trigger batching internally.
-            PAL_ASSERT(pFence->IsBatched() == false);
-
-            fenceList[count].context = pContext->Handle();
-            fenceList[count].ip_type = pContext->IpType();
-            fenceList[count].ip_instance = 0;
-            fenceList[count].ring = pContext->EngineId();
-            fenceList[count].fence = pFence->Timestamp();
-            count++;
+            // We have no way to hand a batched fence to the kernel. Vulkan (the only Linux client) doesn't permit the
+            // application to trigger queue batching, but a Queue with an asynchronous submission thread batches every
+            // submit; its fences get a timestamp as soon as the worker reaches them.
+            if (pFence->IsBatched())
+            {
+                if (waitAll == false)
+                {
+                    // Any of the other fences may signal first, so this one is only checked while polling the rest.
+                    batchedList[batchedCount++] = pFence;
+                    continue;
+                }
+                else if (WaitForUnbatchedFence(*pFence, startTicks, timeout) == false)
+                {
+                    result = Result::Timeout;
+                    break;
+                }
+            }
+
+            AddKernelFence(*pFence);
         }
     }
 
-    if (result == Result::NotReady)
+    if ((result == Result::NotReady) && (batchedCount > 0))
     {
-        struct timespec startTime = {};
-        struct timespec stopTime = {};
-        uint64 timeoutLeft = 0;
+        // Poll the fences which reached the OS and pick up batched fences as they get there, until one of them
+        // signals, every fence has reached the OS or the timeout expires.
+        while (result == Result::NotReady)
+        {
+            if (count > 0)
+            {
+                const Result pollResult = amdgpuDevice.WaitForFences(&fenceList[0], count, false, 0);
+
+                if (pollResult != Result::Timeout)
+                {
+                    result = pollResult;
+                    break;
+                }
+            }
+
+            for (uint32 idx = 0; idx < batchedCount; )
+            {
+                if (batchedList[idx]->IsBatched() == false)
+                {
+                    AddKernelFence(*batchedList[idx]);
+                    batchedList[idx] = batchedList[--batchedCount];
+                }
+                else
+                {
+                    ++idx;
+                }
+            }
 
-        ComputeTimeoutExpiration(&startTime, 0);
-        ComputeTimeoutExpiration(&stopTime, timeout);
+            if (batchedCount == 0)
+            {
+                // Everything is in the kernel's hands now, so let it do the rest of the waiting below.
+                break;
+            }
+            else if (RemainingTimeout(startTicks, timeout) == 0)
+            {
+                result = Result::Timeout;
+            }
+            else
+            {
+                YieldThread();
+            }
+        }
+    }
 
+    if (result == Result::NotReady)
+    {
+        // Only give the kernel whatever is left of the timeout after waiting for batched fences.
         if (count > 0)
         {
-            result = amdgpuDevice.WaitForFences(&fenceList[0], count, waitAll, timeout);
+            result = amdgpuDevice.WaitForFences(&fenceList[0], count, waitAll, RemainingTimeout(startTicks, timeout));
         }
         else
         {
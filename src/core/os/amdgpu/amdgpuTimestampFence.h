@@ -32,6 +32,8 @@
 #include "palMutex.h"
 #include "palAutoBuffer.h"
 
+#include <atomic>
+
 namespace Pal
 {
 namespace Amdgpu
@@ -66,7 +68,7 @@ public:
 
     virtual Result Reset() override;
 
-    uint64 Timestamp() const { return m_timestamp; }
+    uint64 Timestamp() const { return m_timestamp.load(std::memory_order_acquire); }
 
     virtual Result WaitForFences(
         const Pal::Device&      device,
@@ -75,7 +77,7 @@ public:
         bool                    waitAll,
         uint64                  timeout) const override;
 
-    bool IsBatched() const { return m_timestamp == BatchedTimestamp; }
+    bool IsBatched() const { return (Timestamp() == BatchedTimestamp); }
 
 protected:
     SubmissionContext* m_pContext;
@@ -86,10 +88,11 @@ private:
     // These members track the Queue and OS-specific timestamp for the current associated submission.
     //
     // The maximum timestamp has been reserved; it indicates that the associated submission has been batched. Note that
-    // the timestamp may be modified asynchronously to normal fence operation when a batched submission is unrolled.
+    // the timestamp may be modified asynchronously to normal fence operation when a batched submission is unrolled, so
+    // it is published with release semantics and read with acquire semantics.
     static constexpr uint64 BatchedTimestamp = UINT64_MAX;
 
-    volatile uint64    m_timestamp;
+    std::atomic<uint64> m_timestamp;
 
     PAL_DISALLOW_COPY_AND_ASSIGN(TimestampFence);
 };
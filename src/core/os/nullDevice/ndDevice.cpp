@@ -1017,6 +1017,43 @@ Result Device::EarlyInit(
     m_chipProperties.uvdLevel = ipLevels.uvd;
     m_chipProperties.vcnLevel = ipLevels.vcn;
 
+    // Init paths. A null device can emulate a real GPU by loading the property snapshot a real device of the same
+    // model saved there; the OS which produced it doesn't matter here.
+    InitOutputPaths();
+
+    if (LoadPropertySnapshot(0, false) == false)
+    {
+        InitChipAndEngineProperties();
+    }
+
+    if (result == Result::Success)
+    {
+        result = InitMemoryProperties();
+
+        if (result == Result::Success)
+        {
+            InitMemoryHeapProperties();
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        result = InitSettings();
+    }
+
+    if (result == Result::Success)
+    {
+        // The base class assumes the chip properties have been initialized so it must be called last.
+        result = Pal::Device::EarlyInit(ipLevels);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Initializes the chip, engine and perf experiment properties from the static description of the emulated GPU.
+void Device::InitChipAndEngineProperties()
+{
     for (uint32 i = 0; i < EngineTypeCount; i++)
     {
         m_engineProperties.perEngine[i].preferredCmdAllocHeaps[CommandDataAlloc]   = GpuHeapGartUswc;
@@ -1100,32 +1137,6 @@ Result Device::EarlyInit(
     default:
         break;
     }
-
-    if (result == Result::Success)
-    {
-        result = InitMemoryProperties();
-
-        if (result == Result::Success)
-        {
-            InitMemoryHeapProperties();
-        }
-    }
-
-    // Init paths
-    InitOutputPaths();
-
-    if (result == Result::Success)
-    {
-        result = InitSettings();
-    }
-
-    if (result == Result::Success)
-    {
-        // The base class assumes the chip properties have been initialized so it must be called last.
-        result = Pal::Device::EarlyInit(ipLevels);
-    }
-
-    return result;
 }
 
 // =====================================================================================================================
@@ -1385,6 +1396,32 @@ void Device::InitOutputPaths()
         Strncpy(m_cacheFilePath, pPath, sizeof(m_cacheFilePath));
         Strncpy(m_debugFilePath, pPath, sizeof(m_debugFilePath));
     }
+#if defined(__unix__)
+    else
+    {
+        // 2. Otherwise use the same cache path as the amdgpu layer, so that device property snapshots saved by real
+        //    devices can be found.
+        pPath = getenv("AMD_SHADER_DISK_CACHE_PATH");
+
+        if (pPath == nullptr)
+        {
+            pPath = getenv("XDG_CACHE_HOME");
+        }
+
+        if (pPath != nullptr)
+        {
+            Strncpy(m_cacheFilePath, pPath, sizeof(m_cacheFilePath));
+        }
+        else
+        {
+            pPath = getenv("HOME");
+            if (pPath != nullptr)
+            {
+                Snprintf(m_cacheFilePath, sizeof(m_cacheFilePath), "%s/.cache", pPath);
+            }
+        }
+    }
+#endif
 }
 
 // =====================================================================================================================
@@ -409,6 +409,8 @@ private:
         InternalSettingScope settingType,
         size_t               bufferSz = 0) const override;
 
+    void InitChipAndEngineProperties();
+
 #if PAL_BUILD_GFX6
     void InitGfx6ChipProperties();
 #endif
@@ -29,7 +29,10 @@
 #include "core/os/nullDevice/ndPlatform.h"
 #include "palAssert.h"
 #include "palDbgPrint.h"
+#include "palJobSystemImpl.h"
+#include "palPlatformKey.h"
 #include "palSysMemory.h"
+#include "palSysUtil.h"
 
 #if PAL_BUILD_LAYERS
 #include "core/layers/decorators.h"
@@ -99,8 +102,16 @@ Platform::Platform(
     m_pClientPrivateData(nullptr),
     m_svmRangeStart(0),
     m_maxSvmSize(createInfo.maxSvmSize),
+    m_deviceSnapshotKey(0),
     m_logCb(),
-    m_eventProvider(this)
+    m_eventProvider(this),
+    m_metricsService(this),
+    m_initTimes(),
+    m_jobSystemInfo(),
+    m_jobSystem(this)
+#if PAL_ENABLE_CPU_TRACE
+    , m_cpuTracer(this)
+#endif
 {
     memset(&m_pDevice[0], 0, sizeof(m_pDevice));
     memset(&m_properties, 0, sizeof(m_properties));
@@ -116,17 +127,44 @@ Platform::Platform(
     m_flags.supportRgpTraces             = createInfo.flags.supportRgpTraces;
 #endif
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 573
+    // The key object only has to outlive platform creation, so keep just its digest.
+    if (createInfo.pDeviceSnapshotKey != nullptr)
+    {
+        m_flags.useDeviceSnapshot = 1;
+        m_deviceSnapshotKey       = createInfo.pDeviceSnapshotKey->GetKey64();
+    }
+#endif
+
     if (createInfo.pLogInfo != nullptr)
     {
         m_logCb = *createInfo.pLogInfo;
     }
 
+    // Zero selects the job system's default per-worker queue size.
+    m_jobSystemInfo.numWorkers       = 0;
+    m_jobSystemInfo.maxJobsPerWorker = 0;
+    m_jobSystemInfo.affinityMask     = 0;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 573
+    m_jobSystemInfo.numWorkers       = createInfo.jobSystemWorkerCount;
+    m_jobSystemInfo.affinityMask     = createInfo.jobSystemAffinityMask;
+#endif
+
     Util::Strncpy(&m_settingsPath[0], createInfo.pSettingsPath, MaxSettingsPathLength);
 }
 
 // =====================================================================================================================
 Platform::~Platform()
 {
+    // Jobs must already have been waited on by whoever submitted them; this only joins the idle workers before the
+    // rest of the platform goes away.
+    m_jobSystem.Destroy();
+
+#if PAL_ENABLE_CPU_TRACE
+    // The tracer may be registered with the DevDriver event server so it must be torn down first.
+    m_cpuTracer.Destroy();
+#endif
+
     DestroyDevDriver();
 #if PAL_ENABLE_SYSTEM_EVENTS
     SystemEventDestroy();
@@ -320,6 +358,13 @@ Result Platform::GetProperties(
 // Helper method which destroys all previously enumerated devices.
 void Platform::TearDownDevices()
 {
+    // The metrics service walks the device list from the message thread, so take it offline first. Unregistering
+    // waits for any request which is already being handled.
+    if ((m_pDevDriverServer != nullptr) && (m_deviceCount > 0))
+    {
+        m_pDevDriverServer->GetMessageChannel()->UnregisterService(&m_metricsService);
+    }
+
     for (uint32 gpu = 0; gpu < m_deviceCount; ++gpu)
     {
         const Result result = m_pDevice[gpu]->Cleanup();
@@ -337,8 +382,16 @@ void Platform::TearDownDevices()
 // This function is not re-entrant!
 Result Platform::Init()
 {
+    const uint64 startTime = GetPerfCpuTime();
+
     Result result = IPlatform::Init();
 
+    // The job system comes up first so that device enumeration and initialization can hand work to it.
+    if (result == Result::Success)
+    {
+        result = m_jobSystem.Init(m_jobSystemInfo);
+    }
+
     // Perform early initialization of the developer driver after the platform is available.
     if (result == Result::Success)
     {
@@ -360,7 +413,11 @@ Result Platform::Init()
 
     if (result == Result::Success)
     {
+        const uint64 enumerateStartTime = GetPerfCpuTime();
+
         result = ReEnumerateDevices();
+
+        m_initTimes.enumerateDevices = GetPerfCpuTime() - enumerateStartTime;
     }
 
     // Perform late initialization of the developer driver after devices have been enumerated.
@@ -369,6 +426,16 @@ Result Platform::Init()
         LateInitDevDriver();
     }
 
+#if PAL_ENABLE_CPU_TRACE
+    // The tracer depends on the final platform settings and the DevDriver event server. Tracing is a debugging aid
+    // so failing to set it up isn't fatal.
+    if (result == Result::Success)
+    {
+        const Result traceResult = m_cpuTracer.Init();
+        PAL_ALERT(traceResult != Result::Success);
+    }
+#endif
+
     if (result == Result::Success)
     {
         result = InitProperties();
@@ -377,6 +444,14 @@ Result Platform::Init()
 #if PAL_ENABLE_SYSTEM_EVENTS
     SystemEventInit();
 #endif
+
+    m_initTimes.total = GetPerfCpuTime() - startTime;
+
+    PAL_DPINFO("Platform init took %llu us (%llu us enumerating %u device(s))",
+               m_initTimes.total * 1000000 / GetPerfFrequency(),
+               m_initTimes.enumerateDevices * 1000000 / GetPerfFrequency(),
+               m_deviceCount);
+
     return result;
 }
 
@@ -432,6 +507,9 @@ Result Platform::EarlyInitDevDriver()
         createInfo.servers.settings = true;
         createInfo.servers.driverControl = true;
         createInfo.servers.rgp = true;
+#if PAL_ENABLE_CPU_TRACE
+        createInfo.servers.event = true;
+#endif
 
         m_pDevDriverServer = PAL_NEW(DevDriver::DevDriverServer, this, AllocInternal) (allocCb, createInfo);
         if (m_pDevDriverServer != nullptr)
@@ -563,7 +641,11 @@ void Platform::LateInitDevDriver()
     // need a device object for the OS specific ReadSetting function.
     if (m_deviceCount >= 1)
     {
+        const uint64 settingsStartTime = GetPerfCpuTime();
+
         m_settingsLoader.ReadSettings(m_pDevice[0]);
+
+        m_initTimes.settingsRead = GetPerfCpuTime() - settingsStartTime;
     }
 
     // And then before finishing init we have an opportunity to override the settings default values based on
@@ -691,6 +773,13 @@ Result Platform::ReEnumerateDevices()
     {
         TearDownDevices();
     }
+    else if ((m_pDevDriverServer != nullptr) && (m_deviceCount > 0))
+    {
+        // Live metrics are only useful to tools, so failing to expose them is not fatal.
+        const DevDriver::Result ddResult =
+            m_pDevDriverServer->GetMessageChannel()->RegisterService(&m_metricsService);
+        PAL_ALERT(ddResult != DevDriver::Result::Success);
+    }
     return result;
 }
 
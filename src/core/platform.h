@@ -25,10 +25,13 @@
 
 #pragma once
 
+#include "palJobSystem.h"
 #include "palLib.h"
 #include "palPlatform.h"
 #include "platformSettingsLoader.h"
 #include "core/eventProvider.h"
+#include "core/devDriverMetricsService.h"
+#include "core/cpuTrace.h"
 #include "core/g_palSettings.h"
 #include "core/g_palPlatformSettings.h"
 #include "ver.h"
@@ -67,6 +70,16 @@ class CmdBuffer;
 extern void PAL_STDCALL GetDefaultAllocCb(
     Util::AllocCallbacks* pAllocCb);
 
+// =====================================================================================================================
+// CPU time spent in the platform's one-time initialization, in performance counter ticks. Reported by the DevDriver
+// "metrics" URI service alongside each device's DeviceInitTimes.
+struct PlatformInitTimes
+{
+    uint64 enumerateDevices;  // Querying the OS for devices and early-initializing each of them.
+    uint64 settingsRead;      // Reading the platform settings through the first device.
+    uint64 total;             // All of Init(), including the phases above.
+};
+
 // =====================================================================================================================
 // Class which manages global functionality for a particular PAL instantiation.
 //
@@ -146,6 +159,9 @@ public:
     bool RequestShadowDescVaRange()      const { return m_flags.requestShadowDescVaRange; }
     bool InternalResidencyOptsDisabled() const { return m_flags.disableInternalResidencyOpts; }
 
+    bool   DeviceSnapshotEnabled() const { return m_flags.useDeviceSnapshot; }
+    uint64 DeviceSnapshotKey()     const { return m_deviceSnapshotKey; }
+
     gpusize GetSvmRangeStart() const { return m_svmRangeStart; }
     void SetSvmRangeStart(gpusize svmRangeStart) { m_svmRangeStart = svmRangeStart; }
     gpusize GetMaxSizeOfSvm() const { return m_maxSvmSize; }
@@ -157,6 +173,18 @@ public:
 
     EventProvider* GetEventProvider() { return &m_eventProvider; }
 
+    MetricsService* GetMetricsService() { return &m_metricsService; }
+
+    const PlatformInitTimes& InitTimes() const { return m_initTimes; }
+
+    // Shared worker pool for internal CPU work.  It has no workers unless the client asked for them, in which case
+    // submitted jobs simply run on the submitting thread.
+    Util::JobSystem<Platform>* GetJobSystem() { return &m_jobSystem; }
+
+#if PAL_ENABLE_CPU_TRACE
+    CpuTrace::Tracer* GetCpuTracer() { return &m_cpuTracer; }
+#endif
+
     virtual void LogEvent(
         PalEvent    eventId,
         const void* pEventData,
@@ -219,7 +247,9 @@ protected:
             uint32 supportRgpTraces             : 1; // Indicates that the client supports RGP tracing. PAL will use
                                                      // this flag and the hardware support flag to setup the
                                                      // DevDriver RgpServer.
-            uint32 reserved                     : 25; // Reserved for future use.
+            uint32 useDeviceSnapshot            : 1; // If set, devices save and reuse property snapshots keyed by
+                                                     // m_deviceSnapshotKey.
+            uint32 reserved                     : 24; // Reserved for future use.
         };
         uint32 u32All;
     } m_flags;
@@ -261,8 +291,17 @@ private:
     void*                  m_pClientPrivateData;
     gpusize                m_svmRangeStart;
     gpusize                m_maxSvmSize;
+    uint64                 m_deviceSnapshotKey;  // Digest of the client's device snapshot platform key.
     Util::LogCallbackInfo  m_logCb;
     EventProvider          m_eventProvider;
+    MetricsService         m_metricsService;
+    PlatformInitTimes      m_initTimes;
+
+    Util::JobSystemCreateInfo  m_jobSystemInfo;
+    Util::JobSystem<Platform>  m_jobSystem;
+#if PAL_ENABLE_CPU_TRACE
+    CpuTrace::Tracer       m_cpuTracer;
+#endif
 
     PAL_DISALLOW_COPY_AND_ASSIGN(Platform);
 };
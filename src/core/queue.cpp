@@ -24,6 +24,9 @@
  **********************************************************************************************************************/
 
 #include "core/cmdBuffer.h"
+#if defined(PAL_BUILD_GPUOPEN)
+#include "core/cmdBufDumpWriter.h"
+#endif
 #include "core/fence.h"
 #include "core/cmdStream.h"
 #include "core/device.h"
@@ -204,6 +207,36 @@ static void PAL_STDCALL WriteCmdDumpToFile(
     // operation of the "important" stuff...  but still make it apparent that the dump file isn't accurate.
     PAL_ALERT(result != Result::Success);
 }
+
+#if PAL_ENABLE_PRINTS_ASSERTS && defined(PAL_BUILD_GPUOPEN)
+// Struct for passing the compressed dump writer and submission identity to the snapshot callback.
+struct CmdDumpToWriterPayload
+{
+    CmdBufDumpWriter*           pWriter;
+    CmdBufDumpWriter::SubmitKey key;
+    uint32                      streamIndex;
+};
+
+// =====================================================================================================================
+// Callback function for snapshotting command buffers into the compressed dump writer.
+static void PAL_STDCALL SnapshotCmdDumpToWriter(
+    const CmdBufferDumpDesc&        cmdBufferDesc,
+    const CmdBufferChunkDumpDesc*   pChunks,
+    uint32                          numChunks,
+    void*                           pUserData)
+{
+    CmdDumpToWriterPayload* pPayload = static_cast<CmdDumpToWriterPayload*>(pUserData);
+
+    const Result result = pPayload->pWriter->SnapshotStream(pPayload->key,
+                                                            pPayload->streamIndex++,
+                                                            cmdBufferDesc,
+                                                            pChunks,
+                                                            numChunks);
+
+    // As with the uncompressed dumps, a failure here shouldn't affect the submission itself.
+    PAL_ALERT(result != Result::Success);
+}
+#endif
 #endif // PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 555
 
 // =====================================================================================================================
@@ -236,10 +269,15 @@ Queue::Queue(
     m_ifhMode(IfhModeDisabled),
     m_pQueueInfos(nullptr),
     m_queueCount(queueCount),
+    m_metrics(),
     m_stalled(false),
     m_pWaitingSemaphore(nullptr),
     m_batchedSubmissionCount(0),
+    m_batchedCmdCount(0),
     m_batchedCmds(pDevice->GetPlatform()),
+    m_asyncSubmit(false),
+    m_asyncSubmitDepth(Max(pDevice->Settings().asyncSubmitQueueDepth, 1u)),
+    m_submitThreadExit(false),
     m_deviceMembershipNode(this),
     m_lastFrameCnt(0),
     m_submitIdPerFrame(0)
@@ -267,6 +305,9 @@ Queue::~Queue()
 // queues' virtual functions.
 void Queue::Destroy()
 {
+    // The submission thread must drain any batched-up commands and exit before we tear anything else down.
+    StopSubmitThread();
+
     // NOTE: If there are still outstanding batched commands for this Queue, something has gone very wrong!
     PAL_ASSERT(m_batchedCmds.NumElements() == 0);
 
@@ -556,6 +597,8 @@ Result Queue::SubmitInternal(
     const MultiSubmitInfo& submitInfo,
     bool                   postBatching)
 {
+    PAL_CPU_TRACE_ZONE(m_pDevice->GetPlatform(), "Queue::SubmitInternal");
+
     Result result = Result::Success;
 
     if (submitInfo.pPerSubQueueInfo == nullptr)
@@ -609,6 +652,27 @@ Result Queue::SubmitInternal(
         if (result == Result::Success)
         {
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 555
+#if defined(PAL_BUILD_GPUOPEN)
+            CmdBufDumpWriter*const pDumpWriter = m_pDevice->GetCmdBufDumpWriter();
+
+            if (IsCmdDumpEnabled() && (pDumpWriter != nullptr))
+            {
+                // Snapshot the streams for the background writer rather than formatting them on this thread.
+                CmdDumpToWriterPayload payload = {};
+                payload.pWriter           = pDumpWriter;
+                payload.key.queueId       = reinterpret_cast<uint64>(this);
+                payload.key.engineIndex   = EngineId();
+                payload.key.frame         = m_pDevice->GetFrameCount();
+                payload.key.submitId      = NextSubmitIdPerFrame(payload.key.frame);
+
+                MultiSubmitInfo submitInfoCopy = submitInfo;
+                submitInfoCopy.pfnCmdDumpCb    = SnapshotCmdDumpToWriter;
+                submitInfoCopy.pUserData       = &payload;
+
+                DumpCmdBuffers(submitInfoCopy, internalSubmitInfos[0]);
+            }
+            else
+#endif
             if (IsCmdDumpEnabled())
             {
                 Util::File logFile;
@@ -675,21 +739,35 @@ Result Queue::SubmitInternal(
 
             // Either execute the submission immediately, or enqueue it for later, depending on whether or not we are
             // stalled and/or the caller is a function after the batching logic and thus must execute immediately.
-            if (postBatching || (m_stalled == false))
+            if (postBatching || (ShouldBatchCommands() == false))
             {
                 result = OsSubmit(submitInfo, &internalSubmitInfos[0]);
             }
             else
             {
+                if (m_asyncSubmit)
+                {
+                    WaitForSubmitSlot();
+                }
+
                 result = EnqueueSubmit(submitInfo, &internalSubmitInfos[0]);
             }
         }
 
         if (result == Result::Success)
         {
+            uint32 cmdBufferCount = 0;
             for (uint32 qIndex = 0; qIndex < submitInfo.perSubQueueInfoCount; qIndex++)
             {
                 m_pQueueInfos[qIndex].pQueueContext->PostProcessSubmit();
+                cmdBufferCount += submitInfo.pPerSubQueueInfo[qIndex].cmdBufferCount;
+            }
+
+            // Batched submissions are replayed with postBatching set; they were already counted when they were queued.
+            if (postBatching == false)
+            {
+                AtomicIncrement64(&m_metrics.submitCount);
+                AtomicAdd64(&m_metrics.cmdBufferCount, cmdBufferCount);
             }
         }
     }
@@ -839,16 +917,7 @@ Result Queue::OpenCommandDumpFile(
         constexpr uint32 MaxFilenameLength = 512;
         char filename[MaxFilenameLength] = {};
 
-        // Multiple submissions of one frame
-        if (m_lastFrameCnt == frameCnt)
-        {
-            m_submitIdPerFrame++;
-        }
-        else
-        {
-            // First submission of one frame
-            m_submitIdPerFrame = 0;
-        }
+        const uint32 submitId = NextSubmitIdPerFrame(frameCnt);
 
         // Add queue type and this pointer to file name to make name unique since there could be multiple queues/engines
         // and/or multiple vitual queues (on the same engine on) which command buffers are submitted
@@ -857,11 +926,9 @@ Result Queue::OpenCommandDumpFile(
             Type(),
             this,
             frameCnt,
-            m_submitIdPerFrame,
+            submitId,
             pSuffix[dumpFormat]);
 
-        m_lastFrameCnt = frameCnt;
-
         if (dumpFormat == CmdBufDumpFormat::CmdBufDumpFormatText)
         {
             PAL_ALERT_MSG(pLogFile->Open(&filename[0], FileAccessMode::FileAccessWrite) != Result::Success,
@@ -935,6 +1002,27 @@ Result Queue::OpenCommandDumpFile(
     }
 }
 
+// =====================================================================================================================
+// Returns the index of the next submission within the given frame on this Queue, used to name submit-time dumps.
+uint32 Queue::NextSubmitIdPerFrame(
+    uint32 frameCnt)
+{
+    // Multiple submissions of one frame
+    if (m_lastFrameCnt == frameCnt)
+    {
+        m_submitIdPerFrame++;
+    }
+    else
+    {
+        // First submission of one frame
+        m_submitIdPerFrame = 0;
+    }
+
+    m_lastFrameCnt = frameCnt;
+
+    return m_submitIdPerFrame;
+}
+
 #endif // PAL_ENABLE_PRINTS_ASSERTS
 #endif // PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 555
 
@@ -1241,15 +1329,16 @@ void Queue::DestroyTrackedCmdBuffer(
 
 // =====================================================================================================================
 // Waits for all requested submissions on this Queue to finish, including any batched-up submissions. This call never
-// fails, but may wait awhile if the command buffers are long-running, or forever if the GPU is hung.) We do not wait
-// for pending semaphore waits or delay operations.
+// fails, but may wait awhile if the command buffers are long-running, or forever if the GPU is hung.) Batched-up
+// commands are all executed before this returns, so it also waits for any semaphore wait which is blocking them.
 // NOTE: Part of the public IQueue interface.
 Result Queue::WaitIdle()
 {
     Result result = Result::Success;
 
-    // If this queue is blocked by a semaphore, this will spin loop until all batched submissions have been processed.
-    while (m_batchedSubmissionCount > 0)
+    // If this queue is blocked by a semaphore or has a submission thread, this will spin loop until all batched-up
+    // commands have been executed. Semaphore signals, presents and fence associations count as well as submissions.
+    while (m_batchedCmdCount > 0)
     {
         // Yield this CPU to give other threads a chance to run and so we don't burn too much power.
         YieldThread();
@@ -1275,7 +1364,7 @@ Result Queue::SignalQueueSemaphoreInternal(
 
     // Either signal the semaphore immediately, or enqueue it for later, depending on whether or not we are stalled
     // and/or the caller is a function after the batching logic and thus must execute immediately.
-    if (postBatching || (m_stalled == false))
+    if (postBatching || (ShouldBatchCommands() == false))
     {
         // The Semaphore object is responsible for notifying any stalled Queues which may get released by this signal
         // operation.
@@ -1287,14 +1376,19 @@ Result Queue::SignalQueueSemaphoreInternal(
         // this path didn't take the lock beforehand, so its possible that another thread released this Queue
         // from the stalled state before we were able to get into this method.
         MutexAuto lock(&m_batchedCmdsLock);
-        if (m_stalled)
+        if (ShouldBatchCommands())
         {
             BatchedQueueCmdData cmdData  = { };
             cmdData.command              = BatchedQueueCmd::SignalSemaphore;
             cmdData.semaphore.pSemaphore = pQueueSemaphore;
             cmdData.semaphore.value      = value;
 
-            result = m_batchedCmds.PushBack(cmdData);
+            result = BatchCmd(cmdData);
+
+            if ((result == Result::Success) && m_asyncSubmit)
+            {
+                NotifySubmitThread();
+            }
         }
         else
         {
@@ -1321,7 +1415,7 @@ Result Queue::WaitQueueSemaphoreInternal(
 
     // Either wait on the semaphore immediately, or enqueue it for later, depending on whether or not we are stalled
     // and/or the caller is a function after the batching logic and thus must execute immediately.
-    if (postBatching || (m_stalled == false))
+    if (postBatching || (ShouldBatchCommands() == false))
     {
         // If this Queue isn't stalled yet, we can execute the wait immediately (which, of course, could stall
         // this Queue).
@@ -1333,14 +1427,19 @@ Result Queue::WaitQueueSemaphoreInternal(
         // this path didn't take the lock beforehand, so its possible that another thread released this Queue
         // from the stalled state before we were able to get into this method.
         MutexAuto lock(&m_batchedCmdsLock);
-        if (m_stalled)
+        if (ShouldBatchCommands())
         {
             BatchedQueueCmdData cmdData  = { };
             cmdData.command              = BatchedQueueCmd::WaitSemaphore;
             cmdData.semaphore.pSemaphore = pQueueSemaphore;
             cmdData.semaphore.value      = value;
 
-            result = m_batchedCmds.PushBack(cmdData);
+            result = BatchCmd(cmdData);
+
+            if ((result == Result::Success) && m_asyncSubmit)
+            {
+                NotifySubmitThread();
+            }
         }
         else
         {
@@ -1389,7 +1488,7 @@ Result Queue::PresentDirectInternal(
         {
             // Either execute the present immediately, or enqueue it for later, depending on whether or not we are
             // stalled.
-            if (m_stalled == false)
+            if (ShouldBatchCommands() == false)
             {
                 result = OsPresentDirect(presentInfo);
             }
@@ -1399,13 +1498,18 @@ Result Queue::PresentDirectInternal(
                 // this path didn't take the lock beforehand, so its possible that another thread released this Queue
                 // from the stalled state before we were able to get into this method.
                 MutexAuto lock(&m_batchedCmdsLock);
-                if (m_stalled)
+                if (ShouldBatchCommands())
                 {
                     BatchedQueueCmdData cmdData = {};
                     cmdData.command             = BatchedQueueCmd::PresentDirect;
                     cmdData.presentDirect.info  = presentInfo;
 
-                    result = m_batchedCmds.PushBack(cmdData);
+                    result = BatchCmd(cmdData);
+
+                    if ((result == Result::Success) && m_asyncSubmit)
+                    {
+                        NotifySubmitThread();
+                    }
                 }
                 else
                 {
@@ -1504,7 +1608,7 @@ Result Queue::Delay(
                 cmdData.command    = BatchedQueueCmd::Delay;
                 cmdData.delay.time = delay;
 
-                result = m_batchedCmds.PushBack(cmdData);
+                result = BatchCmd(cmdData);
             }
             else
             {
@@ -1572,7 +1676,7 @@ Result Queue::AssociateFenceWithLastSubmit(
         pCoreFence->AssociateWithContext(m_pSubmissionContext);
 
         // Either associate the fence timestamp immediately or later, depending on whether or not we are stalled.
-        if (m_stalled == false)
+        if (ShouldBatchCommands() == false)
         {
             result = DoAssociateFenceWithLastSubmit(pCoreFence);
         }
@@ -1583,13 +1687,18 @@ Result Queue::AssociateFenceWithLastSubmit(
             // from the stalled state before we were able to get into this method.
             MutexAuto lock(&m_batchedCmdsLock);
 
-            if (m_stalled)
+            if (ShouldBatchCommands())
             {
                 BatchedQueueCmdData cmdData = { };
                 cmdData.command               = BatchedQueueCmd::AssociateFenceWithLastSubmit;
                 cmdData.associateFence.pFence = pCoreFence;
 
-                result = m_batchedCmds.PushBack(cmdData);
+                result = BatchCmd(cmdData);
+
+                if ((result == Result::Success) && m_asyncSubmit)
+                {
+                    NotifySubmitThread();
+                }
             }
             else
             {
@@ -1601,6 +1710,107 @@ Result Queue::AssociateFenceWithLastSubmit(
     return result;
 }
 
+// =====================================================================================================================
+// Adds GPU memory references to this Queue's own residency list. A Queue with a submission thread builds the residency
+// list of each batched-up submission on that thread, so the change must wait until every earlier submission has been
+// handed to the OS or those submissions would see references the client added after submitting them.
+Result Queue::AddGpuMemoryReferences(
+    uint32              gpuMemRefCount,
+    const GpuMemoryRef* pGpuMemoryRefs)
+{
+    Result result = Result::Success;
+
+    if (gpuMemRefCount > 0)
+    {
+        MutexAuto lock(&m_batchedCmdsLock);
+
+        if (m_asyncSubmit)
+        {
+            BatchedQueueCmdData cmdData = { };
+            cmdData.command                      = BatchedQueueCmd::AddGpuMemoryReferences;
+            cmdData.gpuMemoryRefs.count          = gpuMemRefCount;
+            cmdData.gpuMemoryRefs.pGpuMemoryRefs = static_cast<GpuMemoryRef*>(
+                PAL_MALLOC(sizeof(GpuMemoryRef) * gpuMemRefCount, m_pDevice->GetPlatform(), AllocInternal));
+
+            if (cmdData.gpuMemoryRefs.pGpuMemoryRefs == nullptr)
+            {
+                result = Result::ErrorOutOfMemory;
+            }
+            else
+            {
+                memcpy(cmdData.gpuMemoryRefs.pGpuMemoryRefs, pGpuMemoryRefs, sizeof(GpuMemoryRef) * gpuMemRefCount);
+
+                result = BatchCmd(cmdData);
+
+                if (result == Result::Success)
+                {
+                    NotifySubmitThread();
+                }
+                else
+                {
+                    PAL_SAFE_FREE(cmdData.gpuMemoryRefs.pGpuMemoryRefs, m_pDevice->GetPlatform());
+                }
+            }
+        }
+        else
+        {
+            result = OsAddGpuMemoryReferences(gpuMemRefCount, pGpuMemoryRefs);
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Removes GPU memory references from this Queue's own residency list. Like AddGpuMemoryReferences(), the change is
+// ordered after any batched-up submissions when this Queue has a submission thread.
+void Queue::RemoveGpuMemoryReferences(
+    uint32            gpuMemoryCount,
+    IGpuMemory*const* ppGpuMemory,
+    bool              forceRemove)
+{
+    if (gpuMemoryCount > 0)
+    {
+        MutexAuto lock(&m_batchedCmdsLock);
+
+        bool batched = false;
+
+        if (m_asyncSubmit)
+        {
+            BatchedQueueCmdData cmdData = { };
+            cmdData.command                   = BatchedQueueCmd::RemoveGpuMemoryReferences;
+            cmdData.gpuMemoryRefs.count       = gpuMemoryCount;
+            cmdData.gpuMemoryRefs.forceRemove = forceRemove;
+            cmdData.gpuMemoryRefs.ppGpuMemory = static_cast<IGpuMemory**>(
+                PAL_MALLOC(sizeof(IGpuMemory*) * gpuMemoryCount, m_pDevice->GetPlatform(), AllocInternal));
+
+            if (cmdData.gpuMemoryRefs.ppGpuMemory != nullptr)
+            {
+                memcpy(cmdData.gpuMemoryRefs.ppGpuMemory, ppGpuMemory, sizeof(IGpuMemory*) * gpuMemoryCount);
+
+                batched = (BatchCmd(cmdData) == Result::Success);
+
+                if (batched)
+                {
+                    NotifySubmitThread();
+                }
+                else
+                {
+                    PAL_SAFE_FREE(cmdData.gpuMemoryRefs.ppGpuMemory, m_pDevice->GetPlatform());
+                }
+            }
+        }
+
+        if (batched == false)
+        {
+            // There is no way to report a failure from here and the client may be about to free this memory, so
+            // dropping the reference early is the lesser evil if we couldn't batch the removal.
+            PAL_ALERT(m_asyncSubmit);
+            OsRemoveGpuMemoryReferences(gpuMemoryCount, ppGpuMemory, forceRemove);
+        }
+    }
+}
+
 // =====================================================================================================================
 // This must be called right after initialization to allow the queue to perform any initialization work which
 // requires a fully initialized queue.
@@ -1660,6 +1870,14 @@ Result Queue::LateInit()
         }
     }
 
+    // The initial submission above must reach the OS directly, so only start handing work off afterwards.
+    if ((result == Result::Success) &&
+        (Type() != QueueTypeTimer)  &&
+        TestAnyFlagSet(m_pDevice->Settings().asyncSubmitQueueTypeMask, 1u << Type()))
+    {
+        result = StartSubmitThread();
+    }
+
     return result;
 }
 
@@ -1675,65 +1893,287 @@ Result Queue::ReleaseFromStalledState()
 {
     Result result = Result::Success;
 
-    bool stalledAgain = false; // It is possible for one of the batched-up commands to be a Semaphore wait which
-                               // may cause this Queue to become stalled once more.
+    if (m_asyncSubmit)
+    {
+        // The submission thread owns execution of the batched-up commands, so just lift the stall and wake it up. The
+        // lock orders this against the submission thread marking the Queue as stalled after a semaphore wait.
+        m_batchedCmdsLock.Lock();
+        m_stalled = false;
+        m_batchedCmdsLock.Unlock();
 
-    MutexAuto lock(&m_batchedCmdsLock);
+        NotifySubmitThread();
+    }
+    else
+    {
+        bool stalledAgain = false; // It is possible for one of the batched-up commands to be a Semaphore wait which
+                                   // may cause this Queue to become stalled once more.
+
+        MutexAuto lock(&m_batchedCmdsLock);
+
+        // Execute all of the batched-up commands as long as we don't become stalled again and don't encounter an
+        // error.
+        while ((m_batchedCmds.NumElements() > 0) && (stalledAgain == false) && (result == Result::Success))
+        {
+            BatchedQueueCmdData cmdData = { };
+
+            result = m_batchedCmds.PopFront(&cmdData);
+            PAL_ASSERT(result == Result::Success);
+
+            result = ExecuteBatchedCmd(&cmdData, &stalledAgain);
+        }
+
+        // Update our stalled status: either we've completely drained all batched-up commands and are not stalled, or
+        // one of the batched-up commands caused this Queue to become stalled again.
+        m_stalled = stalledAgain;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Executes a single batched-up Queue command. Semaphore waits report whether they stalled this Queue through
+// pStalledAgain.
+Result Queue::ExecuteBatchedCmd(
+    BatchedQueueCmdData* pCmdData,
+    bool*                pStalledAgain)
+{
+    Result result = Result::Success;
+
+    switch (pCmdData->command)
+    {
+    case BatchedQueueCmd::Submit:
+        result = OsSubmit(pCmdData->submit.submitInfo, pCmdData->submit.pInternalSubmitInfo);
+
+        if (m_asyncSubmit)
+        {
+            AtomicIncrement64(&m_metrics.asyncSubmitCount);
+            AtomicAdd64(&m_metrics.asyncSubmitLatency,
+                        static_cast<uint64>(GetPerfCpuTime() - pCmdData->submit.enqueueTime));
+        }
+
+        // Once we've executed the submission, we need to free the submission's dynamic arrays. They are all stored
+        // in the same memory allocation which was saved in pDynamicMem for convenience.
+        PAL_SAFE_FREE(pCmdData->submit.pDynamicMem, m_pDevice->GetPlatform());
+
+        // Decrement this count to let Submit() stop throttling the caller.
+        PAL_ASSERT(m_batchedSubmissionCount > 0);
+        AtomicDecrement(&m_batchedSubmissionCount);
+        break;
+
+    case BatchedQueueCmd::SignalSemaphore:
+        result = static_cast<QueueSemaphore*>(pCmdData->semaphore.pSemaphore)->Signal(this, pCmdData->semaphore.value);
+        break;
+
+    case BatchedQueueCmd::WaitSemaphore:
+        result = static_cast<QueueSemaphore*>(pCmdData->semaphore.pSemaphore)->Wait(this,
+                                                                                     pCmdData->semaphore.value,
+                                                                                     pStalledAgain);
+        break;
 
-    // Execute all of the batched-up commands as long as we don't become stalled again and don't encounter an error.
-    while ((m_batchedCmds.NumElements() > 0) && (stalledAgain == false) && (result == Result::Success))
+    case BatchedQueueCmd::PresentDirect:
+        result = OsPresentDirect(pCmdData->presentDirect.info);
+        break;
+
+    case BatchedQueueCmd::Delay:
+        PAL_ASSERT(Type() == QueueTypeTimer);
+        result = OsDelay(pCmdData->delay.time, nullptr);
+        break;
+
+    case BatchedQueueCmd::AssociateFenceWithLastSubmit:
+        result = DoAssociateFenceWithLastSubmit(pCmdData->associateFence.pFence);
+        break;
+
+    case BatchedQueueCmd::AddGpuMemoryReferences:
+        result = OsAddGpuMemoryReferences(pCmdData->gpuMemoryRefs.count, pCmdData->gpuMemoryRefs.pGpuMemoryRefs);
+        PAL_SAFE_FREE(pCmdData->gpuMemoryRefs.pGpuMemoryRefs, m_pDevice->GetPlatform());
+        break;
+
+    case BatchedQueueCmd::RemoveGpuMemoryReferences:
+        OsRemoveGpuMemoryReferences(pCmdData->gpuMemoryRefs.count,
+                                    pCmdData->gpuMemoryRefs.ppGpuMemory,
+                                    pCmdData->gpuMemoryRefs.forceRemove);
+        PAL_SAFE_FREE(pCmdData->gpuMemoryRefs.ppGpuMemory, m_pDevice->GetPlatform());
+        break;
+
+    }
+
+    // Decrement this count to permit WaitIdle to return once every batched-up command has been executed.
+    PAL_ASSERT(m_batchedCmdCount > 0);
+    AtomicDecrement(&m_batchedCmdCount);
+
+    return result;
+}
+
+// =====================================================================================================================
+// Adds a command to the end of the batched-up commands. The caller must hold m_batchedCmdsLock.
+Result Queue::BatchCmd(
+    const BatchedQueueCmdData& cmdData)
+{
+    const Result result = m_batchedCmds.PushBack(cmdData);
+
+    if (result == Result::Success)
     {
-        BatchedQueueCmdData cmdData = { };
+        // We must track the number of batched-up commands to make WaitIdle spin until all of them have been executed.
+        AtomicIncrement(&m_batchedCmdCount);
+    }
 
-        result = m_batchedCmds.PopFront(&cmdData);
-        PAL_ASSERT(result == Result::Success);
+    return result;
+}
+
+// =====================================================================================================================
+// Creates the worker thread which performs this Queue's OS submissions. Once this succeeds, all client-facing commands
+// are batched-up and executed in order by the worker.
+Result Queue::StartSubmitThread()
+{
+    Result result = m_submitThreadWake.Init(Semaphore::MaximumCountLimit, 0);
+
+    if (result == Result::Success)
+    {
+        // The flag must be visible before the worker runs, since it changes how batched-up commands are executed.
+        m_asyncSubmit = true;
+        result        = m_submitThread.Begin(&SubmitThreadCallback, this);
 
-        switch (cmdData.command)
+        if (result != Result::Success)
         {
-        case BatchedQueueCmd::Submit:
-            result = OsSubmit(cmdData.submit.submitInfo, cmdData.submit.pInternalSubmitInfo);
+            m_asyncSubmit = false;
+        }
+    }
 
-            // Once we've executed the submission, we need to free the submission's dynamic arrays. They are all stored
-            // in the same memory allocation which was saved in pDynamicMem for convenience.
-            PAL_SAFE_FREE(cmdData.submit.pDynamicMem, m_pDevice->GetPlatform());
+    return result;
+}
 
-            // Decrement this count to permit WaitIdle to query the status of the queue's submissions.
-            PAL_ASSERT(m_batchedSubmissionCount > 0);
-            AtomicDecrement(&m_batchedSubmissionCount);
-            break;
+// =====================================================================================================================
+// Drains the submission thread and waits for it to exit. Afterwards, this Queue executes commands on the caller's
+// thread again.
+void Queue::StopSubmitThread()
+{
+    if (m_submitThread.IsCreated())
+    {
+        PAL_ASSERT(m_submitThread.IsNotCurrentThread());
 
-        case BatchedQueueCmd::SignalSemaphore:
-            result = static_cast<QueueSemaphore*>(cmdData.semaphore.pSemaphore)->Signal(this, cmdData.semaphore.value);
-            break;
+        m_submitThreadExit = true;
+        NotifySubmitThread();
+        m_submitThread.Join();
 
-        case BatchedQueueCmd::WaitSemaphore:
-            result = static_cast<QueueSemaphore*>(cmdData.semaphore.pSemaphore)->Wait(this, cmdData.semaphore.value,
-                                                                                      &stalledAgain);
-            break;
+        MutexAuto lock(&m_batchedCmdsLock);
+        m_asyncSubmit = false;
 
-        case BatchedQueueCmd::PresentDirect:
-            result = OsPresentDirect(cmdData.presentDirect.info);
-            break;
+        // Memory references can be changed from any thread through the Device, so one may have been batched-up after
+        // the worker's last pass. Apply whatever is left now that this thread owns the batch again.
+        bool stalledAgain = m_stalled;
 
-        case BatchedQueueCmd::Delay:
-            PAL_ASSERT(Type() == QueueTypeTimer);
-            result = OsDelay(cmdData.delay.time, nullptr);
-            break;
+        while ((m_batchedCmds.NumElements() > 0) && (stalledAgain == false))
+        {
+            BatchedQueueCmdData cmdData = { };
 
-        case BatchedQueueCmd::AssociateFenceWithLastSubmit:
-            result = DoAssociateFenceWithLastSubmit(cmdData.associateFence.pFence);
-            break;
+            const Result result = m_batchedCmds.PopFront(&cmdData);
+            PAL_ASSERT(result == Result::Success);
 
+            ExecuteBatchedCmd(&cmdData, &stalledAgain);
         }
+
+        m_stalled = stalledAgain;
     }
+}
+
+// =====================================================================================================================
+// Callback for executing a Queue's submission thread.
+void Queue::SubmitThreadCallback(
+    void* pParameter) // Opaque pointer to a Queue object
+{
+    static_cast<Queue*>(pParameter)->RunSubmitThread();
+}
+
+// =====================================================================================================================
+// Executes the background thread which hands batched-up commands to the OS. Each wake-up drains as much of the batch
+// as possible; the thread exits once StopSubmitThread() has asked it to and everything queued before that is done.
+void Queue::RunSubmitThread()
+{
+    while (m_submitThreadExit == false)
+    {
+        const Result waitResult = m_submitThreadWake.Wait(UINT32_MAX);
+        PAL_ASSERT(IsErrorResult(waitResult) == false);
+
+        if (waitResult == Result::Success)
+        {
+            const Result result = ProcessAsyncBatchedCmds();
+
+            // There is nobody to return an error to from here; the client will observe it through fences or device
+            // loss on its next operation.
+            PAL_ALERT(result != Result::Success);
+        }
+    }
+}
+
+// =====================================================================================================================
+// Called on the submission thread to execute batched-up commands in order until the batch is empty or a semaphore wait
+// stalls this Queue. Commands are popped under m_batchedCmdsLock but executed without it so the client can keep
+// batching while the worker is in the kernel. Semaphore waits are the exception: they must update m_stalled under the
+// lock so that a concurrent ReleaseFromStalledState() can't be lost.
+Result Queue::ProcessAsyncBatchedCmds()
+{
+    Result result = Result::Success;
+    bool   done   = false;
+
+    while (done == false)
+    {
+        BatchedQueueCmdData cmdData    = { };
+        bool                havePopped = false;
+        Result              cmdResult  = Result::Success;
+
+        m_batchedCmdsLock.Lock();
 
-    // Update our stalled status: either we've completely drained all batched-up commands and are not stalled, or
-    // one of the batched-up commands caused this Queue to become stalled again.
-    m_stalled = stalledAgain;
+        if (m_stalled || (m_batchedCmds.NumElements() == 0))
+        {
+            done = true;
+        }
+        else
+        {
+            cmdResult = m_batchedCmds.PopFront(&cmdData);
+            PAL_ASSERT(cmdResult == Result::Success);
+
+            if (cmdData.command == BatchedQueueCmd::WaitSemaphore)
+            {
+                bool stalledAgain = false;
+                cmdResult = ExecuteBatchedCmd(&cmdData, &stalledAgain);
+                m_stalled = stalledAgain;
+            }
+            else
+            {
+                havePopped = true;
+            }
+        }
+
+        m_batchedCmdsLock.Unlock();
+
+        if (havePopped)
+        {
+            cmdResult = ExecuteBatchedCmd(&cmdData, nullptr);
+        }
+
+        // Keep going after a failure so that WaitIdle() and StopSubmitThread() don't wait forever on commands which
+        // will never run, but report the first error we saw.
+        if (result == Result::Success)
+        {
+            result = cmdResult;
+        }
+    }
 
     return result;
 }
 
+// =====================================================================================================================
+// Throttles the client's thread when the submission thread falls too far behind. The limit doesn't apply while this
+// Queue is stalled on a semaphore wait because the matching signal may come from the very thread we would block.
+void Queue::WaitForSubmitSlot() const
+{
+    while ((m_batchedSubmissionCount >= m_asyncSubmitDepth) && (m_stalled == false))
+    {
+        // Yield this CPU to give the submission thread a chance to run and so we don't burn too much power.
+        YieldThread();
+    }
+}
+
 // =====================================================================================================================
 // Validates that the inputs to a Submit() call are legal according to the conditions defined in palQueue.h.
 Result Queue::ValidateSubmit(
@@ -1870,13 +2310,14 @@ Result Queue::EnqueueSubmit(
     // didn't take the lock beforehand, so its possible that another thread released this Queue from the stalled state
     // before we were able to get into this method.
     MutexAuto lock(&m_batchedCmdsLock);
-    if (m_stalled)
+    if (ShouldBatchCommands())
     {
         BatchedQueueCmdData cmdData;
         cmdData.command                    = BatchedQueueCmd::Submit;
         cmdData.submit.submitInfo          = submitInfo;
         cmdData.submit.pInternalSubmitInfo = pInternalSubmitInfo;
         cmdData.submit.pDynamicMem         = nullptr;
+        cmdData.submit.enqueueTime         = GetPerfCpuTime();
 
         // The submitInfo structure we are batching-up needs to have its own copies of the command buffer and memory
         // reference lists, because there's no guarantee those user arrays will remain valid once we become unstalled.
@@ -2028,13 +2469,20 @@ Result Queue::EnqueueSubmit(
 
         if (result == Result::Success)
         {
-            result = m_batchedCmds.PushBack(cmdData);
+            result = BatchCmd(cmdData);
 
             if (result == Result::Success)
             {
-                // We must track the number of batched submissions to make WaitIdle spin until all submissions have been
-                // submitted to the OS layer.
-                AtomicIncrement(&m_batchedSubmissionCount);
+                // We must track the number of batched submissions to throttle the caller when too many are pending.
+                const uint32 pendingSubmits = AtomicIncrement(&m_batchedSubmissionCount);
+
+                // Only batching threads update this value and they all hold m_batchedCmdsLock.
+                m_metrics.maxPendingSubmits = Max<uint64>(m_metrics.maxPendingSubmits, pendingSubmits);
+
+                if (m_asyncSubmit)
+                {
+                    NotifySubmitThread();
+                }
             }
             else
             {
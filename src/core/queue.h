@@ -30,6 +30,8 @@
 #include "palDeque.h"
 #include "palIntrusiveList.h"
 #include "palMutex.h"
+#include "palSemaphore.h"
+#include "palThread.h"
 
 namespace Pal
 {
@@ -95,6 +97,8 @@ enum class BatchedQueueCmd : uint32
     PresentDirect,                // Identifies a PresentDirect() call
     Delay,                        // Identifies a Delay() call
     AssociateFenceWithLastSubmit, // Identifies a AssociateFenceWithLastSubmit() call
+    AddGpuMemoryReferences,       // Identifies a per-queue AddGpuMemoryReferences() call
+    RemoveGpuMemoryReferences,    // Identifies a per-queue RemoveGpuMemoryReferences() call
 };
 
 // Defines the data payloads for each type of batched-up Queue command.
@@ -109,6 +113,7 @@ struct BatchedQueueCmdData
             MultiSubmitInfo           submitInfo;
             const InternalSubmitInfo* pInternalSubmitInfo;
             void*                     pDynamicMem;
+            int64                     enqueueTime;  // CPU timestamp of when this submission was batched-up.
         } submit;
 
         struct
@@ -132,6 +137,14 @@ struct BatchedQueueCmdData
             Fence* pFence;
         } associateFence;
 
+        struct
+        {
+            uint32        count;
+            GpuMemoryRef* pGpuMemoryRefs; // Our own copy of the references to add.
+            IGpuMemory**  ppGpuMemory;    // Our own copy of the memory objects to remove.
+            bool          forceRemove;
+        } gpuMemoryRefs;
+
     };
 };
 
@@ -173,6 +186,19 @@ private:
     PAL_DISALLOW_COPY_AND_ASSIGN(SubmissionContext);
 };
 
+// =====================================================================================================================
+// Cheap, always-on counters reported per queue by the DevDriver "metrics" URI service. They are written by the thread
+// submitting on the queue and may be read at any time by the DevDriver message thread.
+struct QueueMetrics
+{
+    volatile uint64 submitCount;            // Number of successful client submissions on this queue.
+    volatile uint64 cmdBufferCount;         // Total number of command buffers in those submissions.
+    volatile uint64 residencyListRebuilds;  // Number of submissions which had to rebuild the OS residency list.
+    volatile uint64 asyncSubmitCount;       // Number of submissions handed to the OS by the submission thread.
+    volatile uint64 asyncSubmitLatency;     // Total time those submissions spent batched-up, in perf-counter ticks.
+    volatile uint64 maxPendingSubmits;      // Highest number of batched-up submissions seen at once.
+};
+
 // =====================================================================================================================
 // Represents a queue of work for a particular GPU engine on a device. Work is submitted to a queue through CmdBuffer
 // objects, and work can be synchronized between multiple queues using QueueSemaphore objects.
@@ -274,8 +300,18 @@ public:
 
     Device*const GetDevice() { return m_pDevice; }
 
+    const QueueMetrics& Metrics() const { return m_metrics; }
+
     bool IsStalled() const { return m_stalled; }
 
+    bool   UsesAsyncSubmission()    const { return m_asyncSubmit; }
+    uint32 PendingSubmissionCount() const { return m_batchedSubmissionCount; }
+
+    // Changes the list of GPU memory references which the OS layer makes resident for every submission on this Queue.
+    // With asynchronous submission, the change is ordered after every submission which was batched-up before it.
+    Result AddGpuMemoryReferences(uint32 gpuMemRefCount, const GpuMemoryRef* pGpuMemoryRefs);
+    void   RemoveGpuMemoryReferences(uint32 gpuMemoryCount, IGpuMemory*const* ppGpuMemory, bool forceRemove);
+
     void IncFrameCount();
 
     static bool SupportsComputeShader(QueueType queueType)
@@ -314,6 +350,13 @@ protected:
 
     virtual Result DoAssociateFenceWithLastSubmit(Fence* pFence) = 0;
 
+    // Performs OS-specific changes to the GPU memory references made resident for every submission on this Queue.
+    // OS layers which don't keep such a list have nothing to do.
+    virtual Result OsAddGpuMemoryReferences(uint32 gpuMemRefCount, const GpuMemoryRef* pGpuMemoryRefs)
+        { return Result::Success; }
+    virtual void OsRemoveGpuMemoryReferences(uint32 gpuMemoryCount, IGpuMemory*const* ppGpuMemory, bool forceRemove)
+        { }
+
     Device*const        m_pDevice;
 
     // Each Queue is associated with an engine and a submission context. Note that the submission context is created
@@ -334,6 +377,8 @@ protected:
     SubQueueInfo* m_pQueueInfos; // m_pQueueInfos struct tracks per subQueue info when we do gang submission.
     const uint32  m_queueCount;
 
+    QueueMetrics  m_metrics;
+
 private:
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION < 518
     // A command buffer and a fence to track its submission state wrapped into one object.
@@ -363,6 +408,7 @@ private:
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 555
 #if PAL_ENABLE_PRINTS_ASSERTS
     bool IsCmdDumpEnabled() const;
+    uint32 NextSubmitIdPerFrame(uint32 frameCnt);
     Result OpenCommandDumpFile(
         const MultiSubmitInfo&      submitInfo,
         const InternalSubmitInfo&   internalSubmitInfo,
@@ -385,16 +431,40 @@ private:
     Result SubmitTrackedCmdBuffer(TrackedCmdBuffer* pTrackedCmdBuffer, const GpuMemory* pWrittenPrimary);
 #endif
 
+    // Client-facing commands must be batched-up if this Queue is stalled or hands its OS work off to a worker thread.
+    bool ShouldBatchCommands() const { return (m_stalled || m_asyncSubmit); }
+
+    Result BatchCmd(const BatchedQueueCmdData& cmdData);
+    Result ExecuteBatchedCmd(BatchedQueueCmdData* pCmdData, bool* pStalledAgain);
+
+    Result StartSubmitThread();
+    void   StopSubmitThread();
+    void   NotifySubmitThread() { m_submitThreadWake.Post(); }
+    Result ProcessAsyncBatchedCmds();
+    void   WaitForSubmitSlot() const;
+    void   RunSubmitThread();
+
+    static void SubmitThreadCallback(void* pParameter);
+
     // Tracks whether or not this Queue is stalled by a Queue Semaphore, and if so, the Semaphore which is blocking
     // this Queue.
     volatile bool     m_stalled;
     IQueueSemaphore*  m_pWaitingSemaphore;
 
     volatile uint32   m_batchedSubmissionCount; // How many batched submissions will be sent to OS layer later on.
+    volatile uint32   m_batchedCmdCount;        // How many batched-up commands haven't finished executing yet.
 
     Util::Deque<BatchedQueueCmdData, Platform>  m_batchedCmds;
     Util::Mutex                                 m_batchedCmdsLock;
 
+    // When asynchronous submission is enabled, every client-facing command is batched-up in m_batchedCmds and
+    // executed in order on m_submitThread, which keeps the OS submission work off of the client's thread.
+    bool             m_asyncSubmit;
+    uint32           m_asyncSubmitDepth;   // Max batched-up submissions before Submit() throttles the caller.
+    volatile bool    m_submitThreadExit;
+    Util::Thread     m_submitThread;
+    Util::Semaphore  m_submitThreadWake;   // Posted whenever a command is batched-up for the submission thread.
+
     // Each queue must register itself with its device and engine so that they can manage their internal lists.
     Util::IntrusiveListNode<Queue>              m_deviceMembershipNode;
 
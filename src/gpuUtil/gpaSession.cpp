@@ -27,6 +27,7 @@
 #include "palCmdAllocator.h"
 #include "palCmdBuffer.h"
 #include "palDequeImpl.h"
+#include "palFile.h"
 #include "palFence.h"
 #include "palGpuEvent.h"
 #include "palGpuMemory.h"
@@ -219,6 +220,9 @@ static constexpr ThreadTraceTokenConfig SqttTokenConfigMinimal =
     RegType::AllRegWrites
 };
 
+// Size of the staging buffer used to batch the small chunks of a streamed RGP file into fewer client writes.
+static constexpr size_t RgpStreamStagingSize = 256 * 1024;
+
 // =====================================================================================================================
 // Helper function to fill in the SqttFileChunkCpuInfo struct based on the hardware in the current system.
 // Required for writing RGP files.
@@ -2042,6 +2046,161 @@ void GpaSession::SetSampleTraceApiInfo(
     pSampleItem->pPerfSample->SetSampleTraceApiInfo(traceApiInfo);
 }
 
+// =====================================================================================================================
+// Sink for the RGP file contents produced by DumpRgpData().  The writer either fills a caller-provided buffer (or only
+// measures the file size if that buffer is null) or streams the file through a write callback.  In streaming mode,
+// small chunks are gathered in a staging buffer while large payloads such as the SQTT data are passed through to the
+// callback directly from the mapped trace memory.
+class GpaSession::RgpWriter
+{
+public:
+    // Constructs a writer which fills pBuffer, or only measures the file if pBuffer is null.
+    RgpWriter(void* pBuffer, size_t bufferSize)
+        :
+        m_pBuffer(pBuffer),
+        m_bufferSize(bufferSize),
+        m_pfnWrite(nullptr),
+        m_pUserData(nullptr),
+        m_pStaging(nullptr),
+        m_stagingSize(0),
+        m_stagingUsed(0),
+        m_offset(0),
+        m_result(Result::Success)
+    { }
+
+    // Constructs a writer which streams the file through pfnWrite using pStaging to batch small writes.
+    RgpWriter(RgpWriteCallback pfnWrite, void* pUserData, void* pStaging, size_t stagingSize)
+        :
+        m_pBuffer(nullptr),
+        m_bufferSize(0),
+        m_pfnWrite(pfnWrite),
+        m_pUserData(pUserData),
+        m_pStaging(pStaging),
+        m_stagingSize(stagingSize),
+        m_stagingUsed(0),
+        m_offset(0),
+        m_result(Result::Success)
+    { }
+
+    // Appends size bytes to the file.  Once a write fails, all further writes are dropped and the failure is reported
+    // by Finish().
+    void Write(const void* pData, size_t size)
+    {
+        if (m_result == Result::Success)
+        {
+            if (m_pfnWrite != nullptr)
+            {
+                if ((m_stagingUsed + size) <= m_stagingSize)
+                {
+                    memcpy(Util::VoidPtrInc(m_pStaging, m_stagingUsed), pData, size);
+                    m_stagingUsed += size;
+                }
+                else
+                {
+                    FlushStaging();
+
+                    if (m_result == Result::Success)
+                    {
+                        if (size <= m_stagingSize)
+                        {
+                            memcpy(m_pStaging, pData, size);
+                            m_stagingUsed = size;
+                        }
+                        else
+                        {
+                            m_result = m_pfnWrite(m_pUserData, pData, size);
+                        }
+                    }
+                }
+            }
+            else if (m_pBuffer != nullptr)
+            {
+                if (static_cast<size_t>(m_offset + size) > m_bufferSize)
+                {
+                    m_result = Result::ErrorInvalidMemorySize;
+                }
+                else
+                {
+                    memcpy(Util::VoidPtrInc(m_pBuffer, static_cast<size_t>(m_offset)), pData, size);
+                }
+            }
+        }
+
+        m_offset += size;
+    }
+
+    // Returns a pointer into the destination buffer where size bytes can be built in place, or null if they don't fit.
+    // Only valid for buffer writers; the caller must follow up with Skip(size).
+    void* DirectWritePtr(size_t size) const
+    {
+        return ((m_result == Result::Success) && (m_pBuffer != nullptr) &&
+                (static_cast<size_t>(m_offset + size) <= m_bufferSize))
+               ? Util::VoidPtrInc(m_pBuffer, static_cast<size_t>(m_offset))
+               : nullptr;
+    }
+
+    // Advances the file offset past data that was written in place through DirectWritePtr().
+    void Skip(size_t size) { m_offset += size; }
+
+    // Records a failure that occurred while producing the file contents.
+    void SetError(Result result)
+    {
+        if (m_result == Result::Success)
+        {
+            m_result = result;
+        }
+    }
+
+    // Returns true if the writer streams the file through a write callback.
+    bool IsStreaming() const { return (m_pfnWrite != nullptr); }
+
+    // Returns true if the writer only measures the file size.
+    bool IsSizeQuery() const { return ((m_pBuffer == nullptr) && (m_pfnWrite == nullptr)); }
+
+    // Flushes any staged data and returns the first failure encountered while writing the file.
+    Result Finish()
+    {
+        FlushStaging();
+        return m_result;
+    }
+
+    // The current write offset, which is also the total number of bytes written so far.
+    gpusize Offset() const { return m_offset; }
+
+private:
+    void FlushStaging()
+    {
+        if ((m_result == Result::Success) && (m_stagingUsed > 0))
+        {
+            m_result = m_pfnWrite(m_pUserData, m_pStaging, m_stagingUsed);
+        }
+        m_stagingUsed = 0;
+    }
+
+    void*const             m_pBuffer;
+    const size_t           m_bufferSize;
+    const RgpWriteCallback m_pfnWrite;
+    void*const             m_pUserData;
+    void*const             m_pStaging;
+    const size_t           m_stagingSize;
+    size_t                 m_stagingUsed;
+    gpusize                m_offset;
+    Result                 m_result;
+
+    PAL_DISALLOW_DEFAULT_CTOR(RgpWriter);
+    PAL_DISALLOW_COPY_AND_ASSIGN(RgpWriter);
+};
+
+// =====================================================================================================================
+// RgpWriteCallback used to stream an RGP file into a Util::File.
+static Result PAL_STDCALL WriteRgpDataToFile(
+    void*       pUserData,
+    const void* pData,
+    size_t      sizeInBytes)
+{
+    return static_cast<Util::File*>(pUserData)->Write(pData, sizeInBytes);
+}
+
 // =====================================================================================================================
 // Reports results of a particular sample.  Only valid for sessions in the _ready_ state.
 Result GpaSession::GetResults(
@@ -2105,6 +2264,83 @@ Result GpaSession::GetResults(
     return result;
 }
 
+// =====================================================================================================================
+// Streams the RGP file for a trace sample through pfnWrite in a single pass.  Only valid for sessions in the _ready_
+// state.
+Result GpaSession::StreamResults(
+    uint32           sampleId,
+    RgpWriteCallback pfnWrite,
+    void*            pUserData,
+    size_t*          pSizeInBytes
+    ) const
+{
+    PAL_ASSERT(m_sessionState == GpaSessionState::Complete);
+
+    Result result = Result::Success;
+
+    const SampleItem* pSampleItem = m_sampleItemArray.At(sampleId);
+
+    if (pfnWrite == nullptr)
+    {
+        result = Result::ErrorInvalidPointer;
+    }
+    else if (pSampleItem->sampleConfig.type != GpaSampleType::Trace)
+    {
+        result = Result::Unsupported;
+    }
+    else
+    {
+        TraceSample* pTraceSample = static_cast<TraceSample*>(pSampleItem->pPerfSample);
+
+        size_t bytesWritten = 0;
+
+        if ((pTraceSample->GetTraceBufferSize() > 0) &&
+            (pTraceSample->IsThreadTraceEnabled() || pTraceSample->IsSpmTraceEnabled()))
+        {
+            void* pStaging = PAL_MALLOC(RgpStreamStagingSize, m_pPlatform, Util::SystemAllocType::AllocInternalTemp);
+
+            if (pStaging != nullptr)
+            {
+                RgpWriter writer(pfnWrite, pUserData, pStaging, RgpStreamStagingSize);
+
+                result       = DumpRgpData(pTraceSample, &writer);
+                bytesWritten = static_cast<size_t>(writer.Offset());
+
+                PAL_SAFE_FREE(pStaging, m_pPlatform);
+            }
+            else
+            {
+                result = Result::ErrorOutOfMemory;
+            }
+        }
+
+        if (pSizeInBytes != nullptr)
+        {
+            *pSizeInBytes = bytesWritten;
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Streams the RGP file for a trace sample into pFile, which must be open for binary write access.
+Result GpaSession::StreamResults(
+    uint32      sampleId,
+    Util::File* pFile,
+    size_t*     pSizeInBytes
+    ) const
+{
+    Result result = Result::ErrorInvalidPointer;
+
+    if ((pFile != nullptr) && pFile->IsOpen())
+    {
+        result = StreamResults(sampleId, &WriteRgpDataToFile, pFile, pSizeInBytes);
+    }
+
+    return result;
+}
+
 // =====================================================================================================================
 // Moves the session to the _reset_ state, marking all sessions resources as unused and available for reuse when
 // the session is re-built.
@@ -3445,12 +3681,29 @@ Result GpaSession::AcquirePipeStatsQuery(
 }
 
 // =====================================================================================================================
-// Dump SQ thread trace data and spm trace data, if available, in rgp format.
+// Dump SQ thread trace data and spm trace data, if available, in rgp format into a caller-provided buffer.
 Result GpaSession::DumpRgpData(
     TraceSample* pTraceSample,
     void*        pRgpOutput,
     size_t*      pTraceSize   // [in|out] Size of the thread trace data and/or spm trace data.
     ) const
+{
+    RgpWriter writer(pRgpOutput, *pTraceSize);
+
+    const Result result = DumpRgpData(pTraceSample, &writer);
+
+    *pTraceSize = static_cast<size_t>(writer.Offset());
+
+    return result;
+}
+
+// =====================================================================================================================
+// Dump SQ thread trace data and spm trace data, if available, in rgp format.  The file is produced in a single pass,
+// chunk by chunk, into pWriter.
+Result GpaSession::DumpRgpData(
+    TraceSample* pTraceSample,
+    RgpWriter*   pWriter
+    ) const
 {
     ThreadTraceLayout* pThreadTraceLayout = nullptr;
     void* pResults = pTraceSample->GetPerfExpResults();
@@ -3462,10 +3715,7 @@ Result GpaSession::DumpRgpData(
 
     Result result = Result::Success;
 
-    gpusize curFileOffset = 0;
-
     SqttFileHeader fileHeader   = {};
-    SqttFileHeader* pFileHeader = &fileHeader;
     fileHeader.magicNumber      = SQTT_FILE_MAGIC_NUMBER;
     fileHeader.versionMajor     = RGP_FILE_FORMAT_SPEC_MAJOR_VER;
     fileHeader.versionMinor     = RGP_FILE_FORMAT_SPEC_MINOR_VER;
@@ -3493,35 +3743,13 @@ Result GpaSession::DumpRgpData(
     fileHeader.dayInYear         = time.tm_yday;
     fileHeader.isDaylightSavings = time.tm_isdst;
 
-    if (pRgpOutput != nullptr)
-    {
-        if (static_cast<size_t>(curFileOffset + sizeof(fileHeader)) > *pTraceSize)
-        {
-            result = Result::ErrorInvalidMemorySize;
-        }
-        else
-        {
-            memcpy(pRgpOutput, pFileHeader, sizeof(fileHeader));
-        }
-    }
-    curFileOffset += sizeof(fileHeader);
+    pWriter->Write(&fileHeader, sizeof(fileHeader));
 
     // Get cpu info for rgp dump
     SqttFileChunkCpuInfo cpuInfo = {};
     FillSqttCpuInfo(&cpuInfo);
 
-    if ((result == Result::Success) && (pRgpOutput != nullptr))
-    {
-        if (static_cast<size_t>(curFileOffset + sizeof(cpuInfo)) > *pTraceSize)
-        {
-            result = Result::ErrorInvalidMemorySize;
-        }
-        else
-        {
-            memcpy(Util::VoidPtrInc(pRgpOutput, static_cast<size_t>(curFileOffset)), &cpuInfo, sizeof(cpuInfo));
-        }
-    }
-    curFileOffset += sizeof(cpuInfo);
+    pWriter->Write(&cpuInfo, sizeof(cpuInfo));
 
     // Get gpu info for rgp dump
 
@@ -3537,18 +3765,7 @@ Result GpaSession::DumpRgpData(
     SqttFileChunkAsicInfo gpuInfo = {};
     FillSqttAsicInfo(m_deviceProps, m_perfExperimentProps, gpuClocksSample, &gpuInfo);
 
-    if ((result == Result::Success) && (pRgpOutput != nullptr))
-    {
-        if (static_cast<size_t>(curFileOffset + sizeof(gpuInfo)) > *pTraceSize)
-        {
-            result = Result::ErrorInvalidMemorySize;
-        }
-        else
-        {
-            memcpy(Util::VoidPtrInc(pRgpOutput, static_cast<size_t>(curFileOffset)), &gpuInfo, sizeof(gpuInfo));
-        }
-    }
-    curFileOffset += sizeof(gpuInfo);
+    pWriter->Write(&gpuInfo, sizeof(gpuInfo));
 
     // Get api info for rgp dump
     SqttFileChunkApiInfo apiInfo = {};
@@ -3560,7 +3777,6 @@ Result GpaSession::DumpRgpData(
     apiInfo.apiType = SQTT_API_TYPE_VULKAN;
     apiInfo.versionMajor = m_apiMajorVer;
     apiInfo.versionMinor = m_apiMinorVer;
-
     // Add the API specific trace info
     const SampleTraceApiInfo& traceApiInfo = pTraceSample->GetSampleTraceApiInfo();
 
@@ -3629,18 +3845,7 @@ Result GpaSession::DumpRgpData(
         break;
     }
 
-    if ((result == Result::Success) && (pRgpOutput != nullptr))
-    {
-        if (static_cast<size_t>(curFileOffset + sizeof(apiInfo)) > *pTraceSize)
-        {
-            result = Result::ErrorInvalidMemorySize;
-        }
-        else
-        {
-            memcpy(Util::VoidPtrInc(pRgpOutput, static_cast<size_t>(curFileOffset)), &apiInfo, sizeof(apiInfo));
-        }
-    }
-    curFileOffset += sizeof(apiInfo);
+    pWriter->Write(&apiInfo, sizeof(apiInfo));
 
     if (pTraceSample->IsThreadTraceEnabled())
     {
@@ -3666,18 +3871,7 @@ Result GpaSession::DumpRgpData(
 
             desc.sqttVersion = GfxipToSqttVersion(m_deviceProps.gfxLevel);
 
-            if ((result == Result::Success) && (pRgpOutput != nullptr))
-            {
-                if (static_cast<size_t>(curFileOffset + sizeof(desc)) > *pTraceSize)
-                {
-                    result = Result::ErrorInvalidMemorySize;
-                }
-                else
-                {
-                    memcpy(Util::VoidPtrInc(pRgpOutput, static_cast<size_t>(curFileOffset)), &desc, sizeof(desc));
-                }
-            }
-            curFileOffset += sizeof(desc);
+            pWriter->Write(&desc, sizeof(desc));
 
             // Get data info and data for rgp dump
             const auto& info  = *static_cast<const ThreadTraceInfoData*>(
@@ -3692,305 +3886,165 @@ Result GpaSession::DumpRgpData(
             data.header.chunkIdentifier.chunkType  = SQTT_FILE_CHUNK_TYPE_SQTT_DATA;
             data.header.chunkIdentifier.chunkIndex = i;
             data.header.sizeInBytes                = sizeof(data) + sqttBytesWritten;
-            data.offset                            = static_cast<int32>(curFileOffset + sizeof(data));
+            data.offset                            = static_cast<int32>(pWriter->Offset() + sizeof(data));
             data.size                              = sqttBytesWritten;
 
             data.header.majorVersion = RgpChunkVersionNumberLookup[SQTT_FILE_CHUNK_TYPE_SQTT_DATA].majorVersion;
             data.header.minorVersion = RgpChunkVersionNumberLookup[SQTT_FILE_CHUNK_TYPE_SQTT_DATA].minorVersion;
 
-            if ((result == Result::Success) && (pRgpOutput != nullptr))
-            {
-                if (static_cast<size_t>(curFileOffset + sizeof(data)) > *pTraceSize)
-                {
-                    result = Result::ErrorInvalidMemorySize;
-                }
-                else
-                {
-                    memcpy(Util::VoidPtrInc(pRgpOutput, static_cast<size_t>(curFileOffset)), &data, sizeof(data));
-                }
-            }
-            curFileOffset += sizeof(data);
+            pWriter->Write(&data, sizeof(data));
 
-            if ((result == Result::Success) && (pRgpOutput != nullptr))
-            {
-                if (static_cast<size_t>(curFileOffset + sqttBytesWritten) > *pTraceSize)
-                {
-                    result = Result::ErrorInvalidMemorySize;
-                }
-                else
-                {
-                    memcpy(Util::VoidPtrInc(pRgpOutput, static_cast<size_t>(curFileOffset)),
-                           pData,
-                           sqttBytesWritten);
-                }
-            }
-            curFileOffset += sqttBytesWritten;
+            // The SQTT data is written straight out of the mapped sample memory; in streaming mode it bypasses the
+            // staging buffer entirely.
+            pWriter->Write(pData, sqttBytesWritten);
         }
 
         // Write code object database to the RGP file.
-        if (result == Result::Success)
+        SqttFileChunkCodeObjectDatabase codeObjectDb   = {};
+        codeObjectDb.header.chunkIdentifier.chunkType  = SQTT_FILE_CHUNK_TYPE_CODE_OBJECT_DATABASE;
+        codeObjectDb.header.chunkIdentifier.chunkIndex = 0;
+        codeObjectDb.header.majorVersion =
+            RgpChunkVersionNumberLookup[SQTT_FILE_CHUNK_TYPE_CODE_OBJECT_DATABASE].majorVersion;
+        codeObjectDb.header.minorVersion =
+            RgpChunkVersionNumberLookup[SQTT_FILE_CHUNK_TYPE_CODE_OBJECT_DATABASE].minorVersion;
+        codeObjectDb.recordCount = static_cast<uint32>(m_curCodeObjectRecords.NumElements());
+
+        uint32 codeObjectDatabaseSize = sizeof(SqttFileChunkCodeObjectDatabase);
+        for (auto iter = m_curCodeObjectRecords.Begin(); iter.Get() != nullptr; iter.Next())
         {
-            if (pRgpOutput != nullptr)
-            {
-                if (static_cast<size_t>(curFileOffset + sizeof(SqttFileChunkCodeObjectDatabase)) > *pTraceSize)
-                {
-                    result = Result::ErrorInvalidMemorySize;
-                }
-                else
-                {
-                    SqttFileChunkCodeObjectDatabase codeObjectDb   = {};
-                    codeObjectDb.header.chunkIdentifier.chunkType  = SQTT_FILE_CHUNK_TYPE_CODE_OBJECT_DATABASE;
-                    codeObjectDb.header.chunkIdentifier.chunkIndex = 0;
-                    codeObjectDb.header.majorVersion =
-                        RgpChunkVersionNumberLookup[SQTT_FILE_CHUNK_TYPE_CODE_OBJECT_DATABASE].majorVersion;
-                    codeObjectDb.header.minorVersion =
-                        RgpChunkVersionNumberLookup[SQTT_FILE_CHUNK_TYPE_CODE_OBJECT_DATABASE].minorVersion;
-                    codeObjectDb.recordCount = static_cast<uint32>(m_curCodeObjectRecords.NumElements());
-
-                    uint32 codeObjectDatabaseSize = sizeof(SqttFileChunkCodeObjectDatabase);
-                    for (auto iter = m_curCodeObjectRecords.Begin(); iter.Get() != nullptr; iter.Next())
-                    {
-                        codeObjectDatabaseSize += (sizeof(SqttCodeObjectDatabaseRecord) + (*iter.Get())->recordSize);
-                    }
-
-                    // The sizes must be updated by adding the size of the rest of the chunk later.
-                    codeObjectDb.header.sizeInBytes                = codeObjectDatabaseSize;
-                    // TODO: Duplicate - will have to remove later once RGP spec is updated.
-                    codeObjectDb.size                              = codeObjectDatabaseSize;
-
-                    // The code object database starts from the beginning of the chunk.
-                    codeObjectDb.offset                            = static_cast<uint32>(curFileOffset);
+            codeObjectDatabaseSize += (sizeof(SqttCodeObjectDatabaseRecord) + (*iter.Get())->recordSize);
+        }
 
-                    // There are no flags for this chunk in the specification as of yet.
-                    codeObjectDb.flags                             = 0;
+        // The sizes must be updated by adding the size of the rest of the chunk later.
+        codeObjectDb.header.sizeInBytes                = codeObjectDatabaseSize;
+        // TODO: Duplicate - will have to remove later once RGP spec is updated.
+        codeObjectDb.size                              = codeObjectDatabaseSize;
 
-                    memcpy(Util::VoidPtrInc(pRgpOutput, static_cast<size_t>(curFileOffset)),
-                           &codeObjectDb,
-                           sizeof(SqttFileChunkCodeObjectDatabase));
-                }
-            }
+        // The code object database starts from the beginning of the chunk.
+        codeObjectDb.offset                            = static_cast<uint32>(pWriter->Offset());
 
-            curFileOffset += sizeof(SqttFileChunkCodeObjectDatabase);
+        // There are no flags for this chunk in the specification as of yet.
+        codeObjectDb.flags                             = 0;
 
-            for (auto iter = m_curCodeObjectRecords.Begin(); iter.Get() != nullptr; iter.Next())
-            {
-                SqttCodeObjectDatabaseRecord* pCodeObjectRecord = *iter.Get();
-                const size_t recordTotalSize = (sizeof(SqttCodeObjectDatabaseRecord) + pCodeObjectRecord->recordSize);
+        pWriter->Write(&codeObjectDb, sizeof(SqttFileChunkCodeObjectDatabase));
 
-                if ((result == Result::Success) && (pRgpOutput != nullptr))
-                {
-                    if (static_cast<size_t>(curFileOffset + recordTotalSize) > *pTraceSize)
-                    {
-                        result = Result::ErrorInvalidMemorySize;
-                    }
-                    else
-                    {
-                        // Copy one record to the buffer provided.
-                        memcpy(Util::VoidPtrInc(pRgpOutput, static_cast<size_t>(curFileOffset)),
-                               pCodeObjectRecord,
-                               recordTotalSize);
-                    }
-                }
+        for (auto iter = m_curCodeObjectRecords.Begin(); iter.Get() != nullptr; iter.Next())
+        {
+            const SqttCodeObjectDatabaseRecord* pCodeObjectRecord = *iter.Get();
 
-                curFileOffset += recordTotalSize;
-            }
+            pWriter->Write(pCodeObjectRecord, (sizeof(SqttCodeObjectDatabaseRecord) + pCodeObjectRecord->recordSize));
         }
 
         // Write API code object loader events to the RGP file.
-        if (result == Result::Success)
-        {
-            const size_t chunkTotalSize = (sizeof(SqttFileChunkCodeObjectLoaderEvents) +
-                (sizeof(SqttCodeObjectLoaderEventRecord) * m_curCodeObjectLoadEventRecords.NumElements()));
+        const size_t loaderEventsChunkSize = (sizeof(SqttFileChunkCodeObjectLoaderEvents) +
+            (sizeof(SqttCodeObjectLoaderEventRecord) * m_curCodeObjectLoadEventRecords.NumElements()));
 
-            if (pRgpOutput != nullptr)
-            {
-                if (static_cast<size_t>(curFileOffset + chunkTotalSize) > *pTraceSize)
-                {
-                    result = Result::ErrorInvalidMemorySize;
-                }
-                else
-                {
-                    SqttFileChunkCodeObjectLoaderEvents loaderEvents = {};
-                    loaderEvents.header.chunkIdentifier.chunkType    = SQTT_FILE_CHUNK_TYPE_CODE_OBJECT_LOADER_EVENTS;
-                    loaderEvents.header.chunkIdentifier.chunkIndex   = 0;
-                    loaderEvents.header.majorVersion =
-                        RgpChunkVersionNumberLookup[SQTT_FILE_CHUNK_TYPE_CODE_OBJECT_LOADER_EVENTS].majorVersion;
-                    loaderEvents.header.minorVersion =
-                        RgpChunkVersionNumberLookup[SQTT_FILE_CHUNK_TYPE_CODE_OBJECT_LOADER_EVENTS].minorVersion;
-                    loaderEvents.recordCount         =
-                        static_cast<uint32>(m_curCodeObjectLoadEventRecords.NumElements());
-                    loaderEvents.recordSize          = sizeof(SqttCodeObjectLoaderEventRecord);
-
-                    loaderEvents.header.sizeInBytes  = static_cast<int32>(chunkTotalSize);
-
-                    // The loader events start from the beginning of the chunk.
-                    loaderEvents.offset              = static_cast<uint32>(curFileOffset);
-
-                    // There are no flags for this chunk in the specification as of yet.
-                    loaderEvents.flags               = 0;
-
-                    memcpy(Util::VoidPtrInc(pRgpOutput, static_cast<size_t>(curFileOffset)),
-                           &loaderEvents,
-                           sizeof(SqttFileChunkCodeObjectLoaderEvents));
-                }
-            }
+        SqttFileChunkCodeObjectLoaderEvents loaderEvents = {};
+        loaderEvents.header.chunkIdentifier.chunkType    = SQTT_FILE_CHUNK_TYPE_CODE_OBJECT_LOADER_EVENTS;
+        loaderEvents.header.chunkIdentifier.chunkIndex   = 0;
+        loaderEvents.header.majorVersion =
+            RgpChunkVersionNumberLookup[SQTT_FILE_CHUNK_TYPE_CODE_OBJECT_LOADER_EVENTS].majorVersion;
+        loaderEvents.header.minorVersion =
+            RgpChunkVersionNumberLookup[SQTT_FILE_CHUNK_TYPE_CODE_OBJECT_LOADER_EVENTS].minorVersion;
+        loaderEvents.recordCount         = static_cast<uint32>(m_curCodeObjectLoadEventRecords.NumElements());
+        loaderEvents.recordSize          = sizeof(SqttCodeObjectLoaderEventRecord);
 
-            curFileOffset += sizeof(SqttFileChunkCodeObjectLoaderEvents);
+        loaderEvents.header.sizeInBytes  = static_cast<int32>(loaderEventsChunkSize);
 
-            constexpr SqttCodeObjectLoaderEventType PalToSqttLoadEvent[] =
-            {
-                SQTT_CODE_OBJECT_LOAD_TO_GPU_MEMORY,     // CodeObjectLoadEventType::LoadToGpuMemory
-                SQTT_CODE_OBJECT_UNLOAD_FROM_GPU_MEMORY, // CodeObjectLoadEventType::UnloadFromGpuMemory
-            };
+        // The loader events start from the beginning of the chunk.
+        loaderEvents.offset              = static_cast<uint32>(pWriter->Offset());
 
-            for (auto iter = m_curCodeObjectLoadEventRecords.Begin(); iter.Get() != nullptr; iter.Next())
-            {
-                const CodeObjectLoadEventRecord& srcRecord = *iter.Get();
+        // There are no flags for this chunk in the specification as of yet.
+        loaderEvents.flags               = 0;
 
-                if ((result == Result::Success) && (pRgpOutput != nullptr))
-                {
-                    SqttCodeObjectLoaderEventRecord sqttRecord = {};
-                    sqttRecord.eventType      =
-                        PalToSqttLoadEvent[static_cast<uint32>(srcRecord.eventType)];
-                    sqttRecord.baseAddress    = srcRecord.baseAddress;
-                    sqttRecord.codeObjectHash = { srcRecord.codeObjectHash.lower, srcRecord.codeObjectHash.upper };
-                    sqttRecord.timestamp      = srcRecord.timestamp;
-
-                    // Copy one record to the buffer provided.
-                    memcpy(Util::VoidPtrInc(pRgpOutput, static_cast<size_t>(curFileOffset)),
-                           &sqttRecord,
-                           sizeof(SqttCodeObjectLoaderEventRecord));
-                }
+        pWriter->Write(&loaderEvents, sizeof(SqttFileChunkCodeObjectLoaderEvents));
 
-                curFileOffset += sizeof(SqttCodeObjectLoaderEventRecord);
-            }
+        constexpr SqttCodeObjectLoaderEventType PalToSqttLoadEvent[] =
+        {
+            SQTT_CODE_OBJECT_LOAD_TO_GPU_MEMORY,     // CodeObjectLoadEventType::LoadToGpuMemory
+            SQTT_CODE_OBJECT_UNLOAD_FROM_GPU_MEMORY, // CodeObjectLoadEventType::UnloadFromGpuMemory
+        };
+
+        for (auto iter = m_curCodeObjectLoadEventRecords.Begin(); iter.Get() != nullptr; iter.Next())
+        {
+            const CodeObjectLoadEventRecord& srcRecord = *iter.Get();
+
+            SqttCodeObjectLoaderEventRecord sqttRecord = {};
+            sqttRecord.eventType      = PalToSqttLoadEvent[static_cast<uint32>(srcRecord.eventType)];
+            sqttRecord.baseAddress    = srcRecord.baseAddress;
+            sqttRecord.codeObjectHash = { srcRecord.codeObjectHash.lower, srcRecord.codeObjectHash.upper };
+            sqttRecord.timestamp      = srcRecord.timestamp;
+
+            pWriter->Write(&sqttRecord, sizeof(SqttCodeObjectLoaderEventRecord));
         }
 
         // Write API PSO -> internal pipeline correlation chunk.
-        if (result == Result::Success)
-        {
-            const size_t chunkTotalSize = (sizeof(SqttFileChunkPsoCorrelation) +
-                (sizeof(SqttPsoCorrelationRecord) * m_curPsoCorrelationRecords.NumElements()));
+        const size_t psoCorrelationChunkSize = (sizeof(SqttFileChunkPsoCorrelation) +
+            (sizeof(SqttPsoCorrelationRecord) * m_curPsoCorrelationRecords.NumElements()));
 
-            if (pRgpOutput != nullptr)
-            {
-                if (static_cast<size_t>(curFileOffset + chunkTotalSize) > *pTraceSize)
-                {
-                    result = Result::ErrorInvalidMemorySize;
-                }
-                else
-                {
-                    SqttFileChunkPsoCorrelation psoCorrelations       = {};
-                    psoCorrelations.header.chunkIdentifier.chunkType  = SQTT_FILE_CHUNK_TYPE_PSO_CORRELATION;
-                    psoCorrelations.header.chunkIdentifier.chunkIndex = 0;
-                    psoCorrelations.header.majorVersion =
-                        RgpChunkVersionNumberLookup[SQTT_FILE_CHUNK_TYPE_PSO_CORRELATION].majorVersion;
-                    psoCorrelations.header.minorVersion =
-                        RgpChunkVersionNumberLookup[SQTT_FILE_CHUNK_TYPE_PSO_CORRELATION].minorVersion;
-                    psoCorrelations.recordCount         = static_cast<uint32>(m_curPsoCorrelationRecords.NumElements());
-                    psoCorrelations.recordSize          = sizeof(SqttPsoCorrelationRecord);
-
-                    psoCorrelations.header.sizeInBytes  = static_cast<int32>(chunkTotalSize);
-
-                    // The PSO correlations start from the beginning of the chunk.
-                    psoCorrelations.offset              = static_cast<uint32>(curFileOffset);
-
-                    // There are no flags for this chunk in the specification as of yet.
-                    psoCorrelations.flags               = 0;
-
-                    memcpy(Util::VoidPtrInc(pRgpOutput, static_cast<size_t>(curFileOffset)),
-                           &psoCorrelations,
-                           sizeof(SqttFileChunkPsoCorrelation));
-                }
-            }
+        SqttFileChunkPsoCorrelation psoCorrelations       = {};
+        psoCorrelations.header.chunkIdentifier.chunkType  = SQTT_FILE_CHUNK_TYPE_PSO_CORRELATION;
+        psoCorrelations.header.chunkIdentifier.chunkIndex = 0;
+        psoCorrelations.header.majorVersion =
+            RgpChunkVersionNumberLookup[SQTT_FILE_CHUNK_TYPE_PSO_CORRELATION].majorVersion;
+        psoCorrelations.header.minorVersion =
+            RgpChunkVersionNumberLookup[SQTT_FILE_CHUNK_TYPE_PSO_CORRELATION].minorVersion;
+        psoCorrelations.recordCount         = static_cast<uint32>(m_curPsoCorrelationRecords.NumElements());
+        psoCorrelations.recordSize          = sizeof(SqttPsoCorrelationRecord);
 
-            curFileOffset += sizeof(SqttFileChunkPsoCorrelation);
+        psoCorrelations.header.sizeInBytes  = static_cast<int32>(psoCorrelationChunkSize);
 
-            for (auto iter = m_curPsoCorrelationRecords.Begin(); iter.Get() != nullptr; iter.Next())
-            {
-                const PsoCorrelationRecord& srcRecord = *iter.Get();
+        // The PSO correlations start from the beginning of the chunk.
+        psoCorrelations.offset              = static_cast<uint32>(pWriter->Offset());
 
-                if ((result == Result::Success) && (pRgpOutput != nullptr))
-                {
-                    SqttPsoCorrelationRecord sqttRecord = { };
-                    sqttRecord.apiPsoHash           = srcRecord.apiPsoHash;
-                    sqttRecord.internalPipelineHash =
-                        { srcRecord.internalPipelineHash.stable, srcRecord.internalPipelineHash.unique };
-
-                    // Copy one record to the buffer provided.
-                    memcpy(Util::VoidPtrInc(pRgpOutput, static_cast<size_t>(curFileOffset)),
-                           &sqttRecord,
-                           sizeof(SqttPsoCorrelationRecord));
-                }
+        // There are no flags for this chunk in the specification as of yet.
+        psoCorrelations.flags               = 0;
 
-                curFileOffset += sizeof(SqttPsoCorrelationRecord);
-            }
-        }
+        pWriter->Write(&psoCorrelations, sizeof(SqttFileChunkPsoCorrelation));
 
-        // Write shader ISA database to the RGP file.
-        if (result == Result::Success)
+        for (auto iter = m_curPsoCorrelationRecords.Begin(); iter.Get() != nullptr; iter.Next())
         {
-            // Shader ISA database header.
-            if (pRgpOutput != nullptr)
-            {
-                if (static_cast<size_t>(curFileOffset + sizeof(SqttFileChunkIsaDatabase)) > *pTraceSize)
-                {
-                    result = Result::ErrorInvalidMemorySize;
-                }
-                else
-                {
-                    SqttFileChunkIsaDatabase shaderIsaDb          = {};
-                    shaderIsaDb.header.chunkIdentifier.chunkType  = SQTT_FILE_CHUNK_TYPE_ISA_DATABASE;
-                    shaderIsaDb.header.chunkIdentifier.chunkIndex = 0;
-                    shaderIsaDb.header.majorVersion =
-                        RgpChunkVersionNumberLookup[SQTT_FILE_CHUNK_TYPE_ISA_DATABASE].majorVersion;
-                    shaderIsaDb.header.minorVersion =
-                        RgpChunkVersionNumberLookup[SQTT_FILE_CHUNK_TYPE_ISA_DATABASE].minorVersion;
-                    shaderIsaDb.recordCount = static_cast<uint32>(m_curShaderRecords.NumElements());
-
-                    int32 shaderDatabaseSize = sizeof(SqttFileChunkIsaDatabase);
-                    for (auto iter = m_curShaderRecords.Begin(); iter.Get() != nullptr; iter.Next())
-                    {
-                        shaderDatabaseSize += (*iter.Get()).recordSize;
-                    }
+            const PsoCorrelationRecord& srcRecord = *iter.Get();
 
-                    // The sizes must be updated by adding the size of the rest of the chunk later.
-                    shaderIsaDb.header.sizeInBytes                = shaderDatabaseSize;
-                    // TODO: Duplicate - will have to remove later once RGP spec is updated.
-                    shaderIsaDb.size                              = shaderDatabaseSize;
+            SqttPsoCorrelationRecord sqttRecord = { };
+            sqttRecord.apiPsoHash           = srcRecord.apiPsoHash;
+            sqttRecord.internalPipelineHash =
+                { srcRecord.internalPipelineHash.stable, srcRecord.internalPipelineHash.unique };
 
-                    // The ISA database starts from the beginning of the chunk.
-                    shaderIsaDb.offset                            = static_cast<uint32>(curFileOffset);
+            pWriter->Write(&sqttRecord, sizeof(SqttPsoCorrelationRecord));
+        }
 
-                    memcpy(Util::VoidPtrInc(pRgpOutput, static_cast<size_t>(curFileOffset)),
-                           &shaderIsaDb,
-                           sizeof(SqttFileChunkIsaDatabase));
-                }
-            }
+        // Write shader ISA database to the RGP file.
+        SqttFileChunkIsaDatabase shaderIsaDb          = {};
+        shaderIsaDb.header.chunkIdentifier.chunkType  = SQTT_FILE_CHUNK_TYPE_ISA_DATABASE;
+        shaderIsaDb.header.chunkIdentifier.chunkIndex = 0;
+        shaderIsaDb.header.majorVersion =
+            RgpChunkVersionNumberLookup[SQTT_FILE_CHUNK_TYPE_ISA_DATABASE].majorVersion;
+        shaderIsaDb.header.minorVersion =
+            RgpChunkVersionNumberLookup[SQTT_FILE_CHUNK_TYPE_ISA_DATABASE].minorVersion;
+        shaderIsaDb.recordCount = static_cast<uint32>(m_curShaderRecords.NumElements());
+
+        int32 shaderDatabaseSize = sizeof(SqttFileChunkIsaDatabase);
+        for (auto iter = m_curShaderRecords.Begin(); iter.Get() != nullptr; iter.Next())
+        {
+            shaderDatabaseSize += (*iter.Get()).recordSize;
+        }
 
-            curFileOffset += sizeof(SqttFileChunkIsaDatabase);
+        // The sizes must be updated by adding the size of the rest of the chunk later.
+        shaderIsaDb.header.sizeInBytes                = shaderDatabaseSize;
+        // TODO: Duplicate - will have to remove later once RGP spec is updated.
+        shaderIsaDb.size                              = shaderDatabaseSize;
 
-            for (auto iter = m_curShaderRecords.Begin(); iter.Get() != nullptr; iter.Next())
-            {
-                ShaderRecord* pShaderRecord = iter.Get();
+        // The ISA database starts from the beginning of the chunk.
+        shaderIsaDb.offset                            = static_cast<uint32>(pWriter->Offset());
 
-                if ((result == Result::Success) && (pRgpOutput != nullptr))
-                {
-                    if (static_cast<size_t>(curFileOffset + pShaderRecord->recordSize) > *pTraceSize)
-                    {
-                        result = Result::ErrorInvalidMemorySize;
-                    }
-                    else
-                    {
-                        // Copy one record to the buffer provided.
-                        memcpy(Util::VoidPtrInc(pRgpOutput, static_cast<size_t>(curFileOffset)),
-                               pShaderRecord->pRecord,
-                               pShaderRecord->recordSize);
-                    }
-                }
+        pWriter->Write(&shaderIsaDb, sizeof(SqttFileChunkIsaDatabase));
 
-                curFileOffset += pShaderRecord->recordSize;
-            }
+        for (auto iter = m_curShaderRecords.Begin(); iter.Get() != nullptr; iter.Next())
+        {
+            const ShaderRecord* pShaderRecord = iter.Get();
+
+            pWriter->Write(pShaderRecord->pRecord, pShaderRecord->recordSize);
         }
     }
 
@@ -4020,155 +4074,119 @@ Result GpaSession::DumpRgpData(
         eventTimings.queueEventTableRecordCount = numQueueEventRecords;
         eventTimings.queueEventTableSize = queueEventTableSize;
 
-        // Write the chunk header into the buffer
-        if ((result == Result::Success) && (pRgpOutput != nullptr))
+        // Write the chunk header
+        pWriter->Write(&eventTimings, sizeof(eventTimings));
+
+        if (pWriter->IsSizeQuery())
         {
-            if (static_cast<size_t>(curFileOffset + sizeof(eventTimings)) > *pTraceSize)
-            {
-                result = Result::ErrorInvalidMemorySize;
-            }
-            else
-            {
-                memcpy(Util::VoidPtrInc(pRgpOutput, static_cast<size_t>(curFileOffset)),
-                    &eventTimings,
-                    sizeof(eventTimings));
-            }
+            pWriter->Skip(queueInfoTableSize + queueEventTableSize);
         }
-        curFileOffset += sizeof(eventTimings);
-
-        // Write the queue info table
-        if ((result == Result::Success) && (pRgpOutput != nullptr))
+        else
         {
-            if (static_cast<size_t>(curFileOffset + queueInfoTableSize) > *pTraceSize)
-            {
-                result = Result::ErrorInvalidMemorySize;
-            }
-            else
+            // Write the queue info table
+            for (uint32 queueIndex = 0; queueIndex < numQueueInfoRecords; ++queueIndex)
             {
-                void* pQueueInfoTableFileOffset = Util::VoidPtrInc(pRgpOutput, static_cast<size_t>(curFileOffset));
-
-                for (uint32 queueIndex = 0; queueIndex < numQueueInfoRecords; ++queueIndex)
-                {
-                    TimedQueueState* pQueueState = m_timedQueuesArray.At(queueIndex);
+                TimedQueueState* pQueueState = m_timedQueuesArray.At(queueIndex);
 
-                    SqttQueueInfoRecord queueInfoRecord     = {};
-                    queueInfoRecord.queueID                 = pQueueState->queueId;
-                    queueInfoRecord.queueContext            = pQueueState->queueContext;
-                    queueInfoRecord.hardwareInfo.queueType  = PalQueueTypeToSqttQueueType[pQueueState->queueType];
-                    queueInfoRecord.hardwareInfo.engineType = PalEngineTypeToSqttEngineType[pQueueState->engineType];
+                SqttQueueInfoRecord queueInfoRecord     = {};
+                queueInfoRecord.queueID                 = pQueueState->queueId;
+                queueInfoRecord.queueContext            = pQueueState->queueContext;
+                queueInfoRecord.hardwareInfo.queueType  = PalQueueTypeToSqttQueueType[pQueueState->queueType];
+                queueInfoRecord.hardwareInfo.engineType = PalEngineTypeToSqttEngineType[pQueueState->engineType];
 
-                    memcpy(pQueueInfoTableFileOffset, &queueInfoRecord, sizeof(queueInfoRecord));
-
-                    pQueueInfoTableFileOffset = Util::VoidPtrInc(pQueueInfoTableFileOffset, sizeof(queueInfoRecord));
-                }
+                pWriter->Write(&queueInfoRecord, sizeof(queueInfoRecord));
             }
-        }
-        curFileOffset += queueInfoTableSize;
 
-        // Write the queue event table
-        if ((result == Result::Success) && (pRgpOutput != nullptr))
-        {
-            if (static_cast<size_t>(curFileOffset + queueEventTableSize) > *pTraceSize)
-            {
-                result = Result::ErrorInvalidMemorySize;
-            }
-            else
+            // Write the queue event table
+            for (uint32 eventIndex = 0; eventIndex < numQueueEventRecords; ++eventIndex)
             {
-                void* pQueueEventTableFileOffset = Util::VoidPtrInc(pRgpOutput, static_cast<size_t>(curFileOffset));
+                const TimedQueueEventItem* pQueueEvent = &m_queueEvents.At(eventIndex);
+
+                SqttQueueEventRecord queueEventRecord = {};
+                queueEventRecord.frameIndex           = pQueueEvent->frameIndex;
+                queueEventRecord.queueInfoIndex       = pQueueEvent->queueIndex;
+                queueEventRecord.cpuTimestamp         = pQueueEvent->cpuTimestamp;
 
-                for (uint32 eventIndex = 0; eventIndex < numQueueEventRecords; ++eventIndex)
+                switch (pQueueEvent->eventType)
                 {
-                    const TimedQueueEventItem* pQueueEvent = &m_queueEvents.At(eventIndex);
+                case TimedQueueEventType::Submit:
+                {
+                    const uint64* pPreTimestamp = reinterpret_cast<const uint64*>(Util::VoidPtrInc(
+                        pQueueEvent->gpuTimestamps.memInfo[0].pCpuAddr,
+                        static_cast<size_t>(pQueueEvent->gpuTimestamps.offsets[0])));
 
-                    SqttQueueEventRecord queueEventRecord = {};
-                    queueEventRecord.frameIndex           = pQueueEvent->frameIndex;
-                    queueEventRecord.queueInfoIndex       = pQueueEvent->queueIndex;
-                    queueEventRecord.cpuTimestamp         = pQueueEvent->cpuTimestamp;
+                    const uint64* pPostTimestamp = reinterpret_cast<const uint64*>(Util::VoidPtrInc(
+                        pQueueEvent->gpuTimestamps.memInfo[1].pCpuAddr,
+                        static_cast<size_t>(pQueueEvent->gpuTimestamps.offsets[1])));
 
-                    switch (pQueueEvent->eventType)
-                    {
-                    case TimedQueueEventType::Submit:
-                    {
-                        const uint64* pPreTimestamp = reinterpret_cast<const uint64*>(Util::VoidPtrInc(
-                            pQueueEvent->gpuTimestamps.memInfo[0].pCpuAddr,
-                            static_cast<size_t>(pQueueEvent->gpuTimestamps.offsets[0])));
-
-                        const uint64* pPostTimestamp = reinterpret_cast<const uint64*>(Util::VoidPtrInc(
-                            pQueueEvent->gpuTimestamps.memInfo[1].pCpuAddr,
-                            static_cast<size_t>(pQueueEvent->gpuTimestamps.offsets[1])));
-
-                        queueEventRecord.eventType        = SQTT_QUEUE_TIMING_EVENT_CMDBUF_SUBMIT;
-                        queueEventRecord.gpuTimestamps[0] = *pPreTimestamp;
-                        queueEventRecord.gpuTimestamps[1] = *pPostTimestamp;
-                        queueEventRecord.apiId            = pQueueEvent->apiId;
-                        queueEventRecord.sqttCbId         = pQueueEvent->sqttCmdBufId;
-                        queueEventRecord.submitSubIndex   = pQueueEvent->submitSubIndex;
-
-                        break;
-                    }
-
-                    case TimedQueueEventType::Signal:
-                    {
-                        queueEventRecord.eventType        = SQTT_QUEUE_TIMING_EVENT_SIGNAL_SEMAPHORE;
-                        queueEventRecord.apiId            = pQueueEvent->apiId;
+                    queueEventRecord.eventType        = SQTT_QUEUE_TIMING_EVENT_CMDBUF_SUBMIT;
+                    queueEventRecord.gpuTimestamps[0] = *pPreTimestamp;
+                    queueEventRecord.gpuTimestamps[1] = *pPostTimestamp;
+                    queueEventRecord.apiId            = pQueueEvent->apiId;
+                    queueEventRecord.sqttCbId         = pQueueEvent->sqttCmdBufId;
+                    queueEventRecord.submitSubIndex   = pQueueEvent->submitSubIndex;
 
-                        break;
-                    }
+                    break;
+                }
 
-                    case TimedQueueEventType::Wait:
-                    {
-                        queueEventRecord.eventType        = SQTT_QUEUE_TIMING_EVENT_WAIT_SEMAPHORE;
-                        queueEventRecord.apiId            = pQueueEvent->apiId;
+                case TimedQueueEventType::Signal:
+                {
+                    queueEventRecord.eventType        = SQTT_QUEUE_TIMING_EVENT_SIGNAL_SEMAPHORE;
+                    queueEventRecord.apiId            = pQueueEvent->apiId;
 
-                        break;
-                    }
+                    break;
+                }
 
-                    case TimedQueueEventType::Present:
-                    {
-                        const uint64* pTimestamp = reinterpret_cast<const uint64*>(Util::VoidPtrInc(
-                            pQueueEvent->gpuTimestamps.memInfo[0].pCpuAddr,
-                            static_cast<size_t>(pQueueEvent->gpuTimestamps.offsets[0])));
+                case TimedQueueEventType::Wait:
+                {
+                    queueEventRecord.eventType        = SQTT_QUEUE_TIMING_EVENT_WAIT_SEMAPHORE;
+                    queueEventRecord.apiId            = pQueueEvent->apiId;
 
-                        queueEventRecord.eventType        = SQTT_QUEUE_TIMING_EVENT_PRESENT;
-                        queueEventRecord.gpuTimestamps[0] = *pTimestamp;
-                        queueEventRecord.apiId            = pQueueEvent->apiId;
+                    break;
+                }
 
-                        break;
-                    }
+                case TimedQueueEventType::Present:
+                {
+                    const uint64* pTimestamp = reinterpret_cast<const uint64*>(Util::VoidPtrInc(
+                        pQueueEvent->gpuTimestamps.memInfo[0].pCpuAddr,
+                        static_cast<size_t>(pQueueEvent->gpuTimestamps.offsets[0])));
 
-                    case TimedQueueEventType::ExternalSignal:
-                    {
-                        queueEventRecord.eventType        = SQTT_QUEUE_TIMING_EVENT_SIGNAL_SEMAPHORE;
-                        queueEventRecord.gpuTimestamps[0] = ExtractGpuTimestampFromQueueEvent(*pQueueEvent);
-                        queueEventRecord.apiId            = pQueueEvent->apiId;
+                    queueEventRecord.eventType        = SQTT_QUEUE_TIMING_EVENT_PRESENT;
+                    queueEventRecord.gpuTimestamps[0] = *pTimestamp;
+                    queueEventRecord.apiId            = pQueueEvent->apiId;
 
-                        break;
-                    }
+                    break;
+                }
 
-                    case TimedQueueEventType::ExternalWait:
-                    {
-                        queueEventRecord.eventType        = SQTT_QUEUE_TIMING_EVENT_WAIT_SEMAPHORE;
-                        queueEventRecord.gpuTimestamps[0] = ExtractGpuTimestampFromQueueEvent(*pQueueEvent);
-                        queueEventRecord.apiId            = pQueueEvent->apiId;
+                case TimedQueueEventType::ExternalSignal:
+                {
+                    queueEventRecord.eventType        = SQTT_QUEUE_TIMING_EVENT_SIGNAL_SEMAPHORE;
+                    queueEventRecord.gpuTimestamps[0] = ExtractGpuTimestampFromQueueEvent(*pQueueEvent);
+                    queueEventRecord.apiId            = pQueueEvent->apiId;
 
-                        break;
-                    }
+                    break;
+                }
 
-                    default:
-                    {
-                        // Invalid event type
-                        PAL_ASSERT_ALWAYS();
-                        break;
-                    }
-                    }
+                case TimedQueueEventType::ExternalWait:
+                {
+                    queueEventRecord.eventType        = SQTT_QUEUE_TIMING_EVENT_WAIT_SEMAPHORE;
+                    queueEventRecord.gpuTimestamps[0] = ExtractGpuTimestampFromQueueEvent(*pQueueEvent);
+                    queueEventRecord.apiId            = pQueueEvent->apiId;
 
-                    memcpy(pQueueEventTableFileOffset, &queueEventRecord, sizeof(queueEventRecord));
+                    break;
+                }
 
-                    pQueueEventTableFileOffset = Util::VoidPtrInc(pQueueEventTableFileOffset, sizeof(queueEventRecord));
+                default:
+                {
+                    // Invalid event type
+                    PAL_ASSERT_ALWAYS();
+                    break;
+                }
                 }
+
+                pWriter->Write(&queueEventRecord, sizeof(queueEventRecord));
             }
         }
-        curFileOffset += queueEventTableSize;
 
         // SqttClockCalibration chunk
         SqttFileChunkClockCalibration clockCalibration = {};
@@ -4197,83 +4215,86 @@ Result GpaSession::DumpRgpData(
                 clockCalibration.gpuTimestamp = timestampCalibration.gpuTimestamp;
             }
 
-            // Write the chunk header into the buffer
-            if ((result == Result::Success) && (pRgpOutput != nullptr))
-            {
-                if (static_cast<size_t>(curFileOffset + sizeof(clockCalibration)) > *pTraceSize)
-                {
-                    result = Result::ErrorInvalidMemorySize;
-                }
-                else
-                {
-                    memcpy(Util::VoidPtrInc(pRgpOutput, static_cast<size_t>(curFileOffset)),
-                        &clockCalibration,
-                        sizeof(clockCalibration));
-                }
-            }
-            curFileOffset += sizeof(clockCalibration);
+            pWriter->Write(&clockCalibration, sizeof(clockCalibration));
         }
     }
 
-    if ((result == Result::Success) && (pTraceSample->IsSpmTraceEnabled()))
+    if (pTraceSample->IsSpmTraceEnabled())
     {
         // Add Spm chunk to RGP file.
-        result = AppendSpmTraceData(pTraceSample, (*pTraceSize), pRgpOutput, &curFileOffset);
+        AppendSpmTraceData(pTraceSample, pWriter);
     }
 
-    *pTraceSize = static_cast<size_t>(curFileOffset);
+    const Result writeResult = pWriter->Finish();
+
+    if (result == Result::Success)
+    {
+        result = writeResult;
+    }
 
     return result;
 }
 
 // =====================================================================================================================
-// Appends the spm trace data in the buffer provided. If nullptr buffer is provided, it returns the size required for
-// the spm data.
-Result GpaSession::AppendSpmTraceData(
+// Appends the spm trace data chunk to the RGP file being written by pWriter.
+void GpaSession::AppendSpmTraceData(
     TraceSample* pTraceSample,  // [in] The PerfSample from which to get the spm trace data.
-    size_t       bufferSize,    // [in] Size of the buffer.
-    void*        pRgpOutput,    // [out] The buffer into which spm trace data is written. May contain thread trace data.
-    gpusize*     pCurFileOffset // [in|out] Current wptr position in buffer.
+    RgpWriter*   pWriter        // [in] The RGP file being written. May already contain thread trace data.
     ) const
 {
-    Result result = Result::Success;
-
     // Initialize the Sqtt chunk, get the spm trace results and add to the file.
     gpusize spmDataSize   = 0;
     gpusize numSpmSamples = 0;
     pTraceSample->GetSpmResultsSize(&spmDataSize, &numSpmSamples);
 
-    if (pRgpOutput != nullptr)
+    // Write the chunk header first.
+    SqttFileChunkSpmDb spmDbChunk               = { };
+    spmDbChunk.header.chunkIdentifier.chunkType = SQTT_FILE_CHUNK_TYPE_SPM_DB;
+    spmDbChunk.header.sizeInBytes               = static_cast<int32>(sizeof(SqttFileChunkSpmDb) + spmDataSize);
+    spmDbChunk.numTimestamps                    = static_cast<uint32>(numSpmSamples);
+    spmDbChunk.numSpmCounterInfo                = pTraceSample->GetNumSpmCounters();
+
+    spmDbChunk.header.majorVersion = RgpChunkVersionNumberLookup[SQTT_FILE_CHUNK_TYPE_SPM_DB].majorVersion;
+    spmDbChunk.header.minorVersion = RgpChunkVersionNumberLookup[SQTT_FILE_CHUNK_TYPE_SPM_DB].minorVersion;
+
+    pWriter->Write(&spmDbChunk, sizeof(spmDbChunk));
+
+    const size_t spmDataBytes = static_cast<size_t>(spmDataSize);
+
+    if (pWriter->IsSizeQuery() || (spmDataBytes == 0))
     {
-        // Header for spm chunk.
-        if (static_cast<gpusize>(*pCurFileOffset + sizeof(SqttFileChunkSpmDb) + spmDataSize) > bufferSize)
+        pWriter->Skip(spmDataBytes);
+    }
+    else
+    {
+        // The SPM ring has to be de-interleaved into the RGP layout, so it can't be passed through directly like the
+        // SQTT data.  Build it in place when writing to a buffer, otherwise in a temporary allocation.
+        if (pWriter->IsStreaming() == false)
         {
-            result = Result::ErrorOutOfMemory;
+            void* pDst = pWriter->DirectWritePtr(spmDataBytes);
+
+            pWriter->SetError((pDst != nullptr) ? pTraceSample->GetSpmTraceResults(pDst, spmDataBytes)
+                                                : Result::ErrorInvalidMemorySize);
+            pWriter->Skip(spmDataBytes);
         }
         else
         {
-            // Write the chunk header first.
-            SqttFileChunkSpmDb spmDbChunk               = { };
-            spmDbChunk.header.chunkIdentifier.chunkType = SQTT_FILE_CHUNK_TYPE_SPM_DB;
-            spmDbChunk.header.sizeInBytes               = static_cast<int32>(sizeof(SqttFileChunkSpmDb) + spmDataSize);
-            spmDbChunk.numTimestamps                    = static_cast<uint32>(numSpmSamples);
-            spmDbChunk.numSpmCounterInfo                = pTraceSample->GetNumSpmCounters();
+            void* pTemp = PAL_MALLOC(spmDataBytes, m_pPlatform, Util::SystemAllocType::AllocInternalTemp);
 
-            spmDbChunk.header.majorVersion = RgpChunkVersionNumberLookup[SQTT_FILE_CHUNK_TYPE_SPM_DB].majorVersion;
-            spmDbChunk.header.minorVersion = RgpChunkVersionNumberLookup[SQTT_FILE_CHUNK_TYPE_SPM_DB].minorVersion;
-
-            memcpy(Util::VoidPtrInc(pRgpOutput, static_cast<size_t>(*pCurFileOffset)), &spmDbChunk, sizeof(spmDbChunk));
-
-            size_t curWriteOffset = static_cast<size_t>(*pCurFileOffset + sizeof(SqttFileChunkSpmDb));
+            if (pTemp != nullptr)
+            {
+                pWriter->SetError(pTraceSample->GetSpmTraceResults(pTemp, spmDataBytes));
+                pWriter->Write(pTemp, spmDataBytes);
 
-            result = pTraceSample->GetSpmTraceResults(Util::VoidPtrInc(pRgpOutput, curWriteOffset),
-                                                      (bufferSize - curWriteOffset));
+                PAL_SAFE_FREE(pTemp, m_pPlatform);
+            }
+            else
+            {
+                pWriter->SetError(Result::ErrorOutOfMemory);
+                pWriter->Skip(spmDataBytes);
+            }
         }
     }
-
-    (*pCurFileOffset) += (sizeof(SqttFileChunkSpmDb) + spmDataSize);
-
-    return result;
 }
 
 // =====================================================================================================================
@@ -35,7 +35,10 @@ CacheLayerBase::CacheLayerBase(
     m_allocator   { callbacks },
     m_pNextLayer  { nullptr },
     m_loadPolicy  { LinkPolicy::PassData | LinkPolicy::PassCalls },
-    m_storePolicy { LinkPolicy::PassData }
+    m_storePolicy { LinkPolicy::PassData },
+    m_queryCount  { 0 },
+    m_hitCount    { 0 },
+    m_storeCount  { 0 }
 {
     // Alloc and Free MUST NOT be nullptr
     PAL_ASSERT(callbacks.pfnAlloc != nullptr);
@@ -65,9 +68,16 @@ Result CacheLayerBase::Query(
     }
     else
     {
+        AtomicIncrement64(&m_queryCount);
+
         if (TestAnyFlagSet(m_loadPolicy, LinkPolicy::Skip) == false)
         {
             result = QueryInternal(pHashId, pQuery);
+
+            if (result == Result::Success)
+            {
+                AtomicIncrement64(&m_hitCount);
+            }
         }
 
         if ((result == Result::NotFound) &&
@@ -112,6 +122,11 @@ Result CacheLayerBase::Store(
         if (TestAnyFlagSet(m_storePolicy, LinkPolicy::Skip) == false)
         {
             result = StoreInternal(pHashId, pData, dataSize);
+
+            if (result == Result::Success)
+            {
+                AtomicIncrement64(&m_storeCount);
+            }
         }
 
         // Pass data to children on success
@@ -179,6 +194,25 @@ Result CacheLayerBase::Load(
     return result;
 }
 
+// =====================================================================================================================
+// Report this layer's usage counters
+Result CacheLayerBase::GetStats(
+    CacheLayerStats* pStats) const
+{
+    Result result = Result::ErrorInvalidPointer;
+
+    if (pStats != nullptr)
+    {
+        pStats->queryCount = m_queryCount;
+        pStats->hitCount   = m_hitCount;
+        pStats->storeCount = m_storeCount;
+
+        result = Result::Success;
+    }
+
+    return result;
+}
+
 // =====================================================================================================================
 // Link another cache layer to ourselves.
 Result CacheLayerBase::Link(
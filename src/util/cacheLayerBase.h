@@ -69,6 +69,9 @@ public:
 
     virtual uint32 GetStorePolicy() const final { return m_storePolicy; }
 
+    virtual Result GetStats(
+        CacheLayerStats* pStats) const final;
+
     virtual void Destroy() final { this->~CacheLayerBase(); }
 
 protected:
@@ -114,6 +117,11 @@ private:
     ICacheLayer*     m_pNextLayer;
     uint32           m_loadPolicy;
     uint32           m_storePolicy;
+
+    // Usage counters, updated atomically because cache layers may be shared between threads.
+    volatile uint64  m_queryCount;
+    volatile uint64  m_hitCount;
+    volatile uint64  m_storeCount;
 };
 
 } //namespace Util
@@ -183,6 +183,39 @@ Result VirtualDecommit(
     return result;
 }
 
+// =====================================================================================================================
+// Asks the kernel to back the specified committed range with transparent huge pages.
+Result VirtualAdviseHugePages(
+    void*  pMem,
+    size_t sizeInBytes)
+{
+    Result result = Result::Success;
+
+    if (sizeInBytes == 0)
+    {
+        result = Result::ErrorInvalidValue;
+    }
+    else if (pMem == nullptr)
+    {
+        result = Result::ErrorInvalidPointer;
+    }
+
+    if (result == Result::Success)
+    {
+#if defined(MADV_HUGEPAGE)
+        if (madvise(pMem, sizeInBytes, MADV_HUGEPAGE) != 0)
+        {
+            // The kernel was built without transparent huge page support.
+            result = Result::Unsupported;
+        }
+#else
+        result = Result::Unsupported;
+#endif
+    }
+
+    return result;
+}
+
 // =====================================================================================================================
 // Releases the specified amount of virtual address space, both freeing the backing memory and virtual address space
 // back to the OS.
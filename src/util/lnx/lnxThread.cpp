@@ -24,6 +24,7 @@
  **********************************************************************************************************************/
 
 #include "palAssert.h"
+#include "palInlineFuncs.h"
 #include <errno.h>
 #include <pthread.h>
 #include "palThread.h"
@@ -107,6 +108,35 @@ bool Thread::IsCreated() const
     return m_threadStatus == Result::Success;
 }
 
+// =====================================================================================================================
+// Restricts this thread to the logical processors set in the given mask.
+Result Thread::SetAffinityMask(
+    uint64 affinityMask)
+{
+    PAL_ASSERT(affinityMask != 0);
+
+    Result result = Result::ErrorUnavailable;
+
+    if ((m_threadStatus == Result::Success) || (m_threadStatus == Result::Unsupported))
+    {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+
+        for (uint32 cpu = 0; cpu < (sizeof(affinityMask) * 8); ++cpu)
+        {
+            if (TestAnyFlagSet(affinityMask, (1ull << cpu)))
+            {
+                CPU_SET(cpu, &cpuSet);
+            }
+        }
+
+        result = (pthread_setaffinity_np(m_threadId, sizeof(cpuSet), &cpuSet) == 0) ? Result::Success
+                                                                                    : Result::ErrorUnknown;
+    }
+
+    return result;
+}
+
 // =====================================================================================================================
 // Makes this Thread object represent the calling thread.
 Result Thread::SetToSelf()
@@ -0,0 +1,161 @@
+##
+ #######################################################################################################################
+ #
+ #  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ #
+ #  Permission is hereby granted, free of charge, to any person obtaining a copy
+ #  of this software and associated documentation files (the "Software"), to deal
+ #  in the Software without restriction, including without limitation the rights
+ #  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ #  copies of the Software, and to permit persons to whom the Software is
+ #  furnished to do so, subject to the following conditions:
+ #
+ #  The above copyright notice and this permission notice shall be included in all
+ #  copies or substantial portions of the Software.
+ #
+ #  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ #  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ #  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ #  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ #  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ #  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ #  SOFTWARE.
+ #
+ #######################################################################################################################
+
+# Converts a compressed command buffer dump container (written when the CmdBufDumpCompressed setting is enabled) back
+# into the per-submission files which the uncompressed submit-time dump path writes.
+#
+# Requires the "lz4" Python package.
+
+import os
+import struct
+import sys
+
+import lz4.frame
+
+ContainerMagic   = 0x44424350 # 'PCBD'
+ContainerVersion = 1
+
+# Layouts of CmdBufDumpContainerHeader and CmdBufDumpRecordHeader in src/core/cmdBufDumpWriter.h.
+ContainerHeader = struct.Struct("<8I")
+RecordHeader    = struct.Struct("<3Q10I")
+
+# CmdBufDumpFormat values.
+FormatText          = 0
+FormatBinary        = 1
+FormatBinaryHeaders = 2
+
+FormatSuffixes = [".txt", ".bin", ".pm4"]
+
+QueueTypeStrings   = ["# Universal Queue - QueueContext", "# Compute Queue - QueueContext",
+                      "# DMA Queue - QueueContext", ""]
+EngineQueueStrings = ["# Universal Queue -", "# Compute Queue -", "# DMA Queue -", " "]
+
+EngineTypeUniversal = 0
+EngineTypeDma       = 2
+SubEngineCe         = 1
+FlagIsPreamble      = 0x1
+FlagIsPostamble     = 0x2
+
+def readRecords(path):
+    with open(path, "rb") as f:
+        header = ContainerHeader.unpack(f.read(ContainerHeader.size))
+        (magic, version, headerSize, recordSize, asicFamily, asicRevision, dumpFormat, _) = header
+
+        if (magic != ContainerMagic) or (version != ContainerVersion):
+            sys.exit("{0} is not a version {1} command buffer dump container.".format(path, ContainerVersion))
+
+        f.seek(headerSize)
+
+        records = []
+        while True:
+            raw = f.read(recordSize)
+            if len(raw) < recordSize:
+                break
+
+            fields  = RecordHeader.unpack(raw[:RecordHeader.size])
+            payload = lz4.frame.decompress(f.read(fields[2]))
+
+            chunks = []
+            offset = 0
+            for _ in range(fields[6]):
+                (chunkSize,) = struct.unpack_from("<I", payload, offset)
+                chunks.append(payload[offset + 4 : offset + 4 + chunkSize])
+                offset += 4 + chunkSize
+
+            records.append({ "queueId": fields[0], "frame": fields[3], "submitId": fields[4], "stream": fields[5],
+                             "queueType": fields[7], "engineType": fields[8], "engineIndex": fields[9],
+                             "subEngineType": fields[10], "flags": fields[12], "chunks": chunks })
+
+    return (asicFamily, asicRevision, dumpFormat, records)
+
+def subEngineId(record):
+    if record["subEngineType"] == SubEngineCe:
+        return 2 if (record["flags"] & FlagIsPreamble) else 1
+    elif record["engineType"] == EngineTypeDma:
+        return 4
+    return 0
+
+def textHeader(record):
+    if record["flags"] & (FlagIsPreamble | FlagIsPostamble):
+        commandString = QueueTypeStrings[record["queueType"]]
+        suffix        = ""
+    else:
+        commandString = EngineQueueStrings[record["engineType"]]
+        suffix        = ""
+        if record["engineType"] == EngineTypeUniversal:
+            suffix = " CE" if (record["subEngineType"] == SubEngineCe) else " DE"
+
+    dwords = sum(len(chunk) // 4 for chunk in record["chunks"])
+    return "{0}{1} Command length = {2}\n".format(commandString, suffix, dwords)
+
+def writeSubmit(outDir, dumpFormat, asicFamily, asicRevision, streams):
+    first    = streams[0]
+    filename = "Frame_{0}_0x{1:x}_{2}_{3:04d}{4}".format(first["queueType"], first["queueId"], first["frame"],
+                                                          first["submitId"], FormatSuffixes[dumpFormat])
+
+    with open(os.path.join(outDir, filename), "w" if dumpFormat == FormatText else "wb") as f:
+        if dumpFormat == FormatText:
+            for record in streams:
+                f.write(textHeader(record))
+                for chunk in record["chunks"]:
+                    for (dword,) in struct.iter_unpack("<I", chunk[:len(chunk) & ~3]):
+                        f.write("0x{0:08x}\n".format(dword))
+        else:
+            if dumpFormat == FormatBinaryHeaders:
+                f.write(struct.pack("<5I", 20, 1, asicFamily, asicRevision, 0))
+
+            chunkCount = sum(len(record["chunks"]) for record in streams)
+            f.write(struct.pack("<3I", 12, first["engineIndex"], chunkCount))
+
+            for record in streams:
+                for chunk in record["chunks"]:
+                    if dumpFormat == FormatBinaryHeaders:
+                        f.write(struct.pack("<3I", 12, len(chunk), subEngineId(record)))
+                    f.write(chunk)
+
+if len(sys.argv) < 3 or len(sys.argv) > 4:
+    sys.exit("Usage: decodeCmdBufDump.py <container file> <output folder> [text|binary|binaryheaders]")
+
+(asicFamily, asicRevision, dumpFormat, records) = readRecords(sys.argv[1])
+
+if len(sys.argv) == 4:
+    formats = { "text": FormatText, "binary": FormatBinary, "binaryheaders": FormatBinaryHeaders }
+    if sys.argv[3].lower() not in formats:
+        sys.exit("Unknown output format '{0}'.".format(sys.argv[3]))
+    dumpFormat = formats[sys.argv[3].lower()]
+
+if not os.path.isdir(sys.argv[2]):
+    os.makedirs(sys.argv[2])
+
+# Records are written in submission order per queue, but streams from different queues may interleave.
+submits = {}
+for record in records:
+    submits.setdefault((record["queueId"], record["frame"], record["submitId"]), []).append(record)
+
+for key in submits:
+    streams = sorted(submits[key], key=lambda record: record["stream"])
+    writeSubmit(sys.argv[2], dumpFormat, asicFamily, asicRevision, streams)
+
+print("Decoded {0} streams from {1} submissions.".format(len(records), len(submits)))
@@ -780,6 +780,8 @@ if args.magicBufferFilename == "":
     wrapper.initial_indent = "    "
     wrapper.subsequent_indent = "    "
     jsonUintData = "\n".join(wrapper.wrap(jsonUintStr))
+    # Tools use the hash to tell whether their copy of the settings data is stale, so it's needed even unencoded.
+    settingsDataHash = fnv1a(jsonUintStr)
 else:
     # Otherwise perform one-time pad on the JSON data when creating the array
     magicBuffer = []